@@ -0,0 +1,141 @@
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <vector>
+
+#include "bench.hpp"
+
+namespace bench {
+
+struct entry {
+    const char *name;
+    function fn;
+};
+
+static std::vector<entry> &registry() {
+    static std::vector<entry> r;
+    return r;
+}
+
+registration::registration(const char *name, function fn) {
+    registry().push_back({name, fn});
+}
+
+static double runOnce(function fn, state &st, uint64_t iterations) {
+    st.iterations = iterations;
+    st.count = 0;
+    auto start = std::chrono::steady_clock::now();
+    fn(st);
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(end - start).count();
+}
+
+static void jsonString(FILE *f, const char *s) {
+    std::fputc('"', f);
+    for (; *s; s++) {
+        if (*s == '"' || *s == '\\') {
+            std::fputc('\\', f);
+        }
+        std::fputc(*s, f);
+    }
+    std::fputc('"', f);
+}
+
+}
+
+// Usage: fidbench [--json FILE] [substring ...]
+// Runs every benchmark whose name contains one of the given substrings, or
+// all of them if none are given.  With --json, the results are also written
+// to FILE in the same layout as Google Benchmark's JSON reporter, so they
+// can be compared across runs with its tools.
+int main(int argc, char **argv) {
+
+    const double minTime = 0.2;
+    const char *jsonName = 0;
+    std::vector<const char *> filters;
+
+    for (int i = 1; i < argc; i++) {
+        if (!std::strcmp(argv[i], "--json") && i + 1 < argc) {
+            jsonName = argv[++i];
+        } else {
+            filters.push_back(argv[i]);
+        }
+    }
+
+    FILE *json = 0;
+    if (jsonName) {
+        json = std::fopen(jsonName, "w");
+        if (!json) {
+            std::perror(jsonName);
+            return 1;
+        }
+        char date[64];
+        std::time_t now = std::time(0);
+        std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+        std::fprintf(json, "{\n  \"context\": {\n    \"date\": \"%s\",\n", date);
+        std::fprintf(json, "    \"executable\": ");
+        bench::jsonString(json, argv[0]);
+        std::fprintf(json, ",\n    \"library_build_type\": \"release\"\n  },\n  \"benchmarks\": [");
+    }
+
+    std::printf("%-40s %14s %14s %16s\n", "benchmark", "iterations", "ns/iter", "items/s");
+
+    bool first = true;
+    for (auto &e: bench::registry()) {
+
+        bool selected = filters.empty();
+        for (auto f: filters) {
+            if (std::strstr(e.name, f)) {
+                selected = true;
+            }
+        }
+        if (!selected) {
+            continue;
+        }
+
+        bench::state st;
+        uint64_t iterations = 1;
+        double elapsed = bench::runOnce(e.fn, st, iterations);
+        while (elapsed < minTime && iterations < (1ULL << 40)) {
+            double scale = elapsed > 0.0 ? 1.4 * minTime / elapsed : 100.0;
+            if (scale > 100.0) {
+                scale = 100.0;
+            }
+            iterations = (uint64_t)(iterations * scale) + 1;
+            elapsed = bench::runOnce(e.fn, st, iterations);
+        }
+
+        double perIter = elapsed / iterations;
+        double itemRate = st.items ? st.items / perIter : 1.0 / perIter;
+        std::printf("%-40s %14llu %14.1f %16.0f %s\n", e.name,
+            (unsigned long long)iterations, perIter * 1e9, itemRate, st.label.c_str());
+        std::fflush(stdout);
+
+        if (json) {
+            std::fprintf(json, "%s\n    {\n      \"name\": ", first ? "" : ",");
+            bench::jsonString(json, e.name);
+            std::fprintf(json, ",\n      \"run_name\": ");
+            bench::jsonString(json, e.name);
+            std::fprintf(json, ",\n      \"run_type\": \"iteration\",\n");
+            std::fprintf(json, "      \"iterations\": %llu,\n", (unsigned long long)iterations);
+            std::fprintf(json, "      \"real_time\": %.6e,\n", perIter * 1e9);
+            std::fprintf(json, "      \"cpu_time\": %.6e,\n", perIter * 1e9);
+            std::fprintf(json, "      \"time_unit\": \"ns\",\n");
+            std::fprintf(json, "      \"items_per_second\": %.6e", itemRate);
+            if (!st.label.empty()) {
+                std::fprintf(json, ",\n      \"label\": ");
+                bench::jsonString(json, st.label.c_str());
+            }
+            std::fprintf(json, "\n    }");
+            first = false;
+        }
+    }
+
+    if (json) {
+        std::fprintf(json, "\n  ]\n}\n");
+        std::fclose(json);
+    }
+
+    return 0;
+}
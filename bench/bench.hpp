@@ -0,0 +1,51 @@
+#pragma once
+
+//
+// Minimal micro-benchmark harness.  Each benchmark is a function taking a
+// bench::state, which loops on keepRunning() around the code being timed:
+//
+//    static void spec_parse(bench::state &st) {
+//        while (st.keepRunning()) {
+//            ...
+//        }
+//    }
+//    BENCHMARK(spec_parse);
+//
+// The harness increases the iteration count until a run takes long enough
+// to time reliably, then reports the time per iteration.
+//
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace bench {
+
+struct state {
+
+    uint64_t iterations = 0;    // Iterations requested for this run
+    uint64_t items = 0;         // Optional: items processed per iteration, for throughput
+    std::string label;          // Optional: extra text for the report
+
+    bool keepRunning() {
+        return count++ < iterations;
+    }
+
+    uint64_t count = 0;
+
+};
+
+typedef void (*function)(state &);
+
+struct registration {
+    registration(const char *name, function fn);
+};
+
+// Stop the optimiser discarding a result
+template <typename T> inline void doNotOptimize(T const &value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+}
+
+#define BENCHMARK(fn) static bench::registration bench_reg_##fn(#fn, fn)
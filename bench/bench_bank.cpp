@@ -0,0 +1,132 @@
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "bench.hpp"
+#include "fidlib.h"
+
+// A scale's worth of Q=800 resonators at 96k, the heaviest tables the
+// generator emits, run over 10ms blocks: as a bank, and as separate
+// Runs for comparison.  The label gives the speed as a multiple of
+// realtime.
+
+static const int RATE = 96000;
+static const int BANDS = 231;
+static const int BLOCK = RATE / 100;
+
+static double bandFreq(int i) {
+    return 32.7031956626 * pow(2.0, (i % 21) / 12.0 + i / 21 * 0.5);
+}
+
+// {gain, val[2], val[1]} for each band, as bpre_filter::calculate() emits
+static std::vector<double> bankTable() {
+    std::vector<double> table;
+    for (int i = 0; i < BANDS; i++) {
+        double f = bandFreq(i);
+        char spec[80];
+        std::snprintf(spec, sizeof(spec), "BpRe/800/%g", f);
+        FidFilter *filt = fid_design(spec, RATE, 0, 0, 0, 0);
+        FidFilter *iir = FFNEXT(filt);
+        table.push_back(40.0 / fid_response(iir, f / RATE));
+        table.push_back(iir->val[2]);
+        table.push_back(iir->val[1]);
+        free(filt);
+    }
+    return table;
+}
+
+static std::vector<double> bankInput() {
+    std::vector<double> in(BLOCK);
+    unsigned seed = 1;
+    for (auto &x : in) {
+        seed = seed * 1103515245 + 12345;
+        x = (seed >> 8) / double(1 << 24) - 0.5;
+    }
+    return in;
+}
+
+static void realtime(bench::state &st, std::chrono::steady_clock::time_point start) {
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    char label[40];
+    std::snprintf(label, sizeof(label), "%.1fx realtime", st.iterations * (BLOCK / double(RATE)) / secs);
+    st.label = label;
+    st.items = BLOCK;
+}
+
+static void bank_mix_231_96k(bench::state &st) {
+    std::vector<double> table = bankTable();
+    std::vector<double> in = bankInput(), out(BLOCK);
+    void *bank = fid_bank_new(table.data(), BANDS);
+    auto start = std::chrono::steady_clock::now();
+    while (st.keepRunning()) {
+        fid_bank_mix(bank, 0, in.data(), out.data(), BLOCK);
+        bench::doNotOptimize(out[0]);
+    }
+    realtime(st, start);
+    fid_bank_free(bank);
+}
+BENCHMARK(bank_mix_231_96k);
+
+static void bank_mix_multirate_231_96k(bench::state &st) {
+    std::vector<double> freq;
+    for (int i = 0; i < BANDS; i++) {
+        freq.push_back(bandFreq(i));
+    }
+    std::vector<double> in = bankInput(), out(BLOCK);
+    void *bank = fid_bank_new_multirate(RATE, freq.data(), BANDS, 800, 40);
+    auto start = std::chrono::steady_clock::now();
+    while (st.keepRunning()) {
+        fid_bank_mix(bank, 0, in.data(), out.data(), BLOCK);
+        bench::doNotOptimize(out[0]);
+    }
+    realtime(st, start);
+    fid_bank_free(bank);
+}
+BENCHMARK(bank_mix_multirate_231_96k);
+
+static void bank_run_231_96k(bench::state &st) {
+    std::vector<double> table = bankTable();
+    std::vector<double> in = bankInput(), out(BLOCK * BANDS);
+    void *bank = fid_bank_new(table.data(), BANDS);
+    auto start = std::chrono::steady_clock::now();
+    while (st.keepRunning()) {
+        fid_bank_run(bank, in.data(), out.data(), BLOCK);
+        bench::doNotOptimize(out[0]);
+    }
+    realtime(st, start);
+    fid_bank_free(bank);
+}
+BENCHMARK(bank_run_231_96k);
+
+static void bank_runbuf_231_96k(bench::state &st) {
+    std::vector<double> table = bankTable();
+    std::vector<double> in = bankInput(), out(BLOCK), sum(BLOCK);
+    std::vector<void *> runs, bufs;
+    double (*funcp)(void *, double);
+    for (int i = 0; i < BANDS; i++) {
+        char spec[80];
+        std::snprintf(spec, sizeof(spec), "BpRe/800/%g", bandFreq(i));
+        FidFilter *filt = fid_design(spec, RATE, 0, 0, 0, 0);
+        runs.push_back(fid_run_new(filt, &funcp));
+        bufs.push_back(fid_run_newbuf(runs.back()));
+        free(filt);
+    }
+    auto start = std::chrono::steady_clock::now();
+    while (st.keepRunning()) {
+        for (int i = 0; i < BANDS; i++) {
+            fid_run_block(bufs[i], in.data(), out.data(), BLOCK);
+            for (int n = 0; n < BLOCK; n++) {
+                sum[n] += out[n];
+            }
+        }
+        bench::doNotOptimize(sum[0]);
+    }
+    realtime(st, start);
+    for (int i = 0; i < BANDS; i++) {
+        fid_run_freebuf(bufs[i]);
+        fid_run_free(runs[i]);
+    }
+}
+BENCHMARK(bank_runbuf_231_96k);
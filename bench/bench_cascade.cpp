@@ -0,0 +1,142 @@
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "bench.hpp"
+#include "fidcascade.hpp"     // Includes fidlib.h
+
+// fid::Cascade against filter_step(), per sample through the function
+// from fid_run_new(), on the resonator of the scale tables and on
+// Butterworth cascades with constant and general numerators.  The
+// Cascade benches' labels give the largest difference from
+// filter_step()'s output.
+
+static const int BLOCK = 1024;
+
+static FidFilter *design(const char *spec) {
+    return fid_design(const_cast<char *>(spec), 48000, -1, -1, 0, 0);
+}
+
+static std::vector<double> noise() {
+    std::vector<double> in(BLOCK);
+    unsigned seed = 1;
+    for (auto &x : in) {
+        seed = seed * 1103515245 + 12345;
+        x = (seed >> 8) / double(1 << 24) - 0.5;
+    }
+    return in;
+}
+
+// filter_step()'s output for the first block
+static std::vector<double> reference(const char *spec, std::vector<double> const &in) {
+    double (*funcp)(void *, double);
+    FidFilter *ff = design(spec);
+    void *run = fid_run_new(ff, &funcp);
+    void *buf = fid_run_newbuf(run);
+    std::vector<double> out(BLOCK);
+    for (int n = 0; n < BLOCK; n++) {
+        out[n] = funcp(buf, in[n]);
+    }
+    fid_run_freebuf(buf);
+    fid_run_free(run);
+    free(ff);
+    return out;
+}
+
+static void runStep(bench::state &st, const char *spec) {
+    double (*funcp)(void *, double);
+    FidFilter *ff = design(spec);
+    void *run = fid_run_new(ff, &funcp);
+    void *buf = fid_run_newbuf(run);
+    std::vector<double> in = noise(), out(BLOCK);
+    while (st.keepRunning()) {
+        for (int n = 0; n < BLOCK; n++) {
+            out[n] = funcp(buf, in[n]);
+        }
+        bench::doNotOptimize(out[BLOCK - 1]);
+    }
+    fid_run_freebuf(buf);
+    fid_run_free(run);
+    free(ff);
+    st.items = BLOCK;
+}
+
+template <typename C>
+static void runCascade(bench::state &st, C &cascade, const char *spec) {
+    std::vector<double> in = noise(), out(BLOCK);
+    std::vector<double> ref = reference(spec, in);
+    double diff = 0;
+    cascade.process(in, out);
+    for (int n = 0; n < BLOCK; n++) {
+        diff = std::fmax(diff, std::fabs(out[n] - ref[n]));
+    }
+    while (st.keepRunning()) {
+        cascade.process(in, out);
+        bench::doNotOptimize(out[BLOCK - 1]);
+    }
+    char label[40];
+    std::snprintf(label, sizeof(label), "max diff %g", diff);
+    st.label = label;
+    st.items = BLOCK;
+}
+
+template <int Sections, fid::Numerator Num>
+static void runCascade(bench::state &st, const char *spec) {
+    FidFilter *ff = design(spec);
+    fid::Cascade<Sections, double, Num> cascade(ff);
+    free(ff);
+    runCascade(st, cascade, spec);
+}
+
+static void filter_step_bpre(bench::state &st) {
+    runStep(st, "BpRe/800/1000");
+}
+BENCHMARK(filter_step_bpre);
+
+static void cascade_bpre(bench::state &st) {
+    runCascade<1, fid::Numerator::BandPass>(st, "BpRe/800/1000");
+}
+BENCHMARK(cascade_bpre);
+
+// From a row of the scale tables, { gain, val[2], val[1] }, here with
+// fid_design()'s own gain so that the output can be compared
+static void cascade_bpre_row(bench::state &st) {
+    FidFilter *ff = design("BpRe/800/1000");
+    FidFilter *iir = FFNEXT(ff);
+    double row[3] = { ff->val[0], iir->val[2], iir->val[1] };
+    free(ff);
+    fid::Cascade<1, double, fid::Numerator::BandPass> cascade(row[0], row + 1);
+    runCascade(st, cascade, "BpRe/800/1000");
+}
+BENCHMARK(cascade_bpre_row);
+
+static void filter_step_lpbu8(bench::state &st) {
+    runStep(st, "LpBu8/1000");
+}
+BENCHMARK(filter_step_lpbu8);
+
+static void cascade_lpbu8(bench::state &st) {
+    runCascade<4, fid::Numerator::LowPass>(st, "LpBu8/1000");
+}
+BENCHMARK(cascade_lpbu8);
+
+static void filter_step_bsbu8(bench::state &st) {
+    runStep(st, "BsBu8/1000-2000");
+}
+BENCHMARK(filter_step_bsbu8);
+
+static void cascade_bsbu8(bench::state &st) {
+    runCascade<8, fid::Numerator::General>(st, "BsBu8/1000-2000");
+}
+BENCHMARK(cascade_bsbu8);
+
+static void filter_step_lpbu3(bench::state &st) {
+    runStep(st, "LpBu3/1000");
+}
+BENCHMARK(filter_step_lpbu3);
+
+static void cascade_lpbu3(bench::state &st) {
+    runCascade<2, fid::Numerator::General>(st, "LpBu3/1000");
+}
+BENCHMARK(cascade_lpbu3);
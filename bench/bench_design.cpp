@@ -0,0 +1,83 @@
+#include <cstdio>
+#include <cstdlib>
+
+#include "bench.hpp"
+#include "fidlib.h"
+
+// fid_design() for each family in the filter table, cycling through a few
+// members of each so that no single design dominates.
+
+static void designSpecs(bench::state &st, const char **specs, int n) {
+    char buf[64];
+    while (st.keepRunning()) {
+        for (int i = 0; i < n; i++) {
+            std::snprintf(buf, sizeof(buf), "%s", specs[i]);
+            FidFilter *ff = fid_design(buf, 48000, -1, -1, 0, 0);
+            free(ff);
+        }
+    }
+    st.items = n;
+}
+
+#define DESIGN_BENCH(family, ...)                                      \
+    static const char *family##_specs[] = { __VA_ARGS__ };             \
+    static void design_##family(bench::state &st) {                    \
+        designSpecs(st, family##_specs,                                \
+            sizeof(family##_specs) / sizeof(family##_specs[0]));       \
+    }                                                                  \
+    BENCHMARK(design_##family)
+
+DESIGN_BENCH(resonator, "BpRe/800/440", "BpRe/2/13.75", "BsRe/1000/10", "ApRe/50/1000");
+DESIGN_BENCH(pi, "Pi/1000", "PiZ/1000");
+DESIGN_BENCH(bessel, "LpBe4/1000", "HpBe6/200", "BpBe4/300-3000", "BsBe2/50-60");
+DESIGN_BENCH(butterworth, "LpBu4/1000", "HpBu6/200", "BpBu4/300-3000", "BsBu2/50-60");
+DESIGN_BENCH(chebyshev, "LpCh4/-1/1000", "HpCh6/-0.5/200", "BpCh4/-1/300-3000", "BsCh2/-1/50-60");
+DESIGN_BENCH(zdomain, "LpBeZ4/1000", "HpBuZ6/200", "BpChZ4/-1/300-3000", "BsBuZ2/50-60");
+DESIGN_BENCH(mixed, "LpBuBe4/50/300");
+DESIGN_BENCH(biquad, "LpBq/0/1000", "HpBq/0/200", "BpBq/0/1000", "BsBq/0/50", "ApBq/0/1000",
+             "PkBq/1.5/-6/1000", "LsBq/1/6/100", "HsBq/1/6/5000");
+DESIGN_BENCH(window, "LpBl/1000", "LpHm/1000", "LpHn/1000");
+DESIGN_BENCH(average, "LpBa/100");
+
+// fid_response() on a typical cascade: a 4th-order bandpass, which is two
+// IIR/FIR pairs, swept across the band
+static void response_bpbu4(bench::state &st) {
+    char spec[] = "BpBu4/300-3000";
+    FidFilter *ff = fid_design(spec, 48000, -1, -1, 0, 0);
+    double acc = 0;
+    while (st.keepRunning()) {
+        for (int i = 0; i < 64; i++) {
+            acc += fid_response(ff, i / 128.0);
+        }
+    }
+    bench::doNotOptimize(acc);
+    free(ff);
+    st.items = 64;
+}
+BENCHMARK(response_bpbu4);
+
+// As used by the generator: BpRe at Q=800
+static void response_bpre(bench::state &st) {
+    char spec[] = "BpRe/800/1000";
+    FidFilter *ff = fid_design(spec, 48000, -1, -1, 0, 0);
+    double acc = 0;
+    while (st.keepRunning()) {
+        acc += fid_response(ff, 1000.0 / 48000.0);
+    }
+    bench::doNotOptimize(acc);
+    free(ff);
+    st.items = 1;
+}
+BENCHMARK(response_bpre);
+
+static void flatten_lpbu8(bench::state &st) {
+    char spec[] = "LpBu8/1000";
+    FidFilter *ff = fid_design(spec, 48000, -1, -1, 0, 0);
+    while (st.keepRunning()) {
+        FidFilter *flat = fid_flatten(ff);
+        free(flat);
+    }
+    free(ff);
+    st.items = 1;
+}
+BENCHMARK(flatten_lpbu8);
@@ -0,0 +1,132 @@
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "bench.hpp"
+#include "fidlib.h"
+
+// One filter of every type in fidlib's filter table, normalised to a
+// peak gain of 1, run in fixed point over blocks of white noise at half
+// full scale, plus the Q=800 resonator at the bottom of a scale.  The
+// label gives the SNR against the double runner with each norm, and the
+// fixed-point runner's speed as a multiple of the double runner's on
+// the same blocks.
+
+static const int BLOCK = 4096;
+
+static FidFilter *normalised(const char *spec, double rate, double freq) {
+    FidFilter *ff = fid_design(const_cast<char *>(spec), rate, -1, -1, 0, 0);
+    double peak = fid_response(ff, freq / rate);
+    for (int i = 1; i < 4096; i++) {
+        peak = std::fmax(peak, fid_response(ff, 0.5 * i / 4096));
+        peak = std::fmax(peak, fid_response(ff, 0.5 * std::pow(1e-5, i / 4096.0)));
+    }
+    FidFilter *gain = (FidFilter *)std::calloc(1, FFCSIZE(1, 1));
+    gain->typ = 'F';
+    gain->len = 1;
+    gain->val[0] = 1.0 / peak;
+    return fid_cat(1, gain, ff, NULL);
+}
+
+static double doubleTime(FidFilter *ff, const std::vector<int> &in, int blocks) {
+    double (*funcp)(void *, double);
+    void *run = fid_run_new(ff, &funcp);
+    void *buf = fid_run_newbuf(run);
+    std::vector<double> data(BLOCK), out(BLOCK);
+    for (int n = 0; n < BLOCK; n++) {
+        data[n] = std::ldexp(in[n], -31);
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (int b = 0; b < blocks; b++) {
+        fid_run_block(buf, data.data(), out.data(), BLOCK);
+        bench::doNotOptimize(out[BLOCK - 1]);
+    }
+    fid_run_freebuf(buf);
+    fid_run_free(run);
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void runFixed(bench::state &st, const char *spec, double rate, double freq) {
+    int (*funcp)(void *, int);
+    FidFilter *ff = normalised(spec, rate, freq);
+    void *run = fid_run_new_fx(ff, FID_NORM_LINF, &funcp);
+    void *buf = fid_run_newbuf_fx(run);
+    std::vector<int> in(BLOCK), out(BLOCK);
+    unsigned seed = 1;
+    for (auto &x : in) {
+        seed = seed * 1103515245 + 12345;
+        x = int(seed >> 1) - 0x40000000;
+    }
+    auto start = std::chrono::steady_clock::now();
+    while (st.keepRunning()) {
+        fid_run_block_fx(buf, in.data(), out.data(), BLOCK);
+        bench::doNotOptimize(out[BLOCK - 1]);
+    }
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    char label[80];
+    std::snprintf(label, sizeof(label), "SNR %.1fdB, L1 %.1fdB, %.2fx double",
+                  fid_run_snr_fx(ff, FID_NORM_LINF, int(rate)),
+                  fid_run_snr_fx(ff, FID_NORM_L1, int(rate)),
+                  doubleTime(ff, in, int(st.iterations)) / secs);
+    st.label = label;
+    st.items = BLOCK;
+    fid_run_freebuf_fx(buf);
+    fid_run_free_fx(run);
+    free(ff);
+}
+
+#define FX_TYPE(name, spec, freq)                                                                  \
+    static void run_block_fx_##name(bench::state &st) {                                            \
+        runFixed(st, spec, 48000, freq);                                                           \
+    }                                                                                              \
+    BENCHMARK(run_block_fx_##name)
+
+FX_TYPE(bpre, "BpRe/800/1000", 1000);
+FX_TYPE(bsre, "BsRe/800/1000", 1000);
+FX_TYPE(apre, "ApRe/800/1000", 1000);
+FX_TYPE(pi, "Pi/1000", 1000);
+FX_TYPE(piz, "PiZ/1000", 1000);
+FX_TYPE(lpbe, "LpBe4/1000", 1000);
+FX_TYPE(hpbe, "HpBe4/1000", 1000);
+FX_TYPE(bpbe, "BpBe4/1000-2000", 1414);
+FX_TYPE(bsbe, "BsBe4/1000-2000", 1414);
+FX_TYPE(lpbu, "LpBu4/1000", 1000);
+FX_TYPE(hpbu, "HpBu4/1000", 1000);
+FX_TYPE(bpbu, "BpBu4/1000-2000", 1414);
+FX_TYPE(bsbu, "BsBu4/1000-2000", 1414);
+FX_TYPE(lpch, "LpCh4/-1/1000", 1000);
+FX_TYPE(hpch, "HpCh4/-1/1000", 1000);
+FX_TYPE(bpch, "BpCh4/-1/1000-2000", 1414);
+FX_TYPE(bsch, "BsCh4/-1/1000-2000", 1414);
+FX_TYPE(lpbez, "LpBeZ4/1000", 1000);
+FX_TYPE(hpbez, "HpBeZ4/1000", 1000);
+FX_TYPE(bpbez, "BpBeZ4/1000-2000", 1414);
+FX_TYPE(bsbez, "BsBeZ4/1000-2000", 1414);
+FX_TYPE(lpbuz, "LpBuZ4/1000", 1000);
+FX_TYPE(hpbuz, "HpBuZ4/1000", 1000);
+FX_TYPE(bpbuz, "BpBuZ4/1000-2000", 1414);
+FX_TYPE(bsbuz, "BsBuZ4/1000-2000", 1414);
+FX_TYPE(lpchz, "LpChZ4/-1/1000", 1000);
+FX_TYPE(hpchz, "HpChZ4/-1/1000", 1000);
+FX_TYPE(bpchz, "BpChZ4/-1/1000-2000", 1414);
+FX_TYPE(bschz, "BsChZ4/-1/1000-2000", 1414);
+FX_TYPE(lpbube, "LpBuBe4/50/1000", 1000);
+FX_TYPE(lpbq, "LpBq/0.7/1000", 1000);
+FX_TYPE(hpbq, "HpBq/0.7/1000", 1000);
+FX_TYPE(bpbq, "BpBq/2/1000", 1000);
+FX_TYPE(bsbq, "BsBq/2/1000", 1000);
+FX_TYPE(apbq, "ApBq/2/1000", 1000);
+FX_TYPE(pkbq, "PkBq/2/6/1000", 1000);
+FX_TYPE(lsbq, "LsBq/0.7/6/1000", 1000);
+FX_TYPE(hsbq, "HsBq/0.7/6/1000", 1000);
+FX_TYPE(lpbl, "LpBl/1000", 1000);
+FX_TYPE(lphm, "LpHm/1000", 1000);
+FX_TYPE(lphn, "LpHn/1000", 1000);
+FX_TYPE(lpba, "LpBa/1000", 1000);
+
+static void run_block_fx_bpre_low(bench::state &st) {
+    runFixed(st, "BpRe/800/13.75", 96000, 13.75);
+}
+BENCHMARK(run_block_fx_bpre_low);
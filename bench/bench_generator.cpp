@@ -0,0 +1,65 @@
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include <unistd.h>
+
+#include "bench.hpp"
+
+// End-to-end run of the generator, writing every scale table into a
+// scratch directory.  BENCH_CALC is the path of the calc executable, set
+// by the Makefile.
+
+#ifdef BENCH_CALC
+
+static void generator_run(bench::state &st) {
+    char dir[] = "/tmp/fidbench_genXXXXXX";
+    if (!mkdtemp(dir)) {
+        std::perror("mkdtemp");
+        std::exit(1);
+    }
+    std::string cmd = std::string("cd ") + dir + " && " + BENCH_CALC + " >/dev/null 2>&1";
+    while (st.keepRunning()) {
+        if (std::system(cmd.c_str()) != 0) {
+            std::fprintf(stderr, "generator_run: %s failed\n", BENCH_CALC);
+            std::exit(1);
+        }
+    }
+    std::system((std::string("rm -rf ") + dir).c_str());
+    st.items = 1;
+}
+BENCHMARK(generator_run);
+
+// Bulk import of Scala tunings, in scales per second: a library of equal 
+// temperaments from 5 to 20 notes, generated in parallel
+static void scala_import(bench::state &st) {
+    const int scales = 16;
+    char dir[] = "/tmp/fidbench_sclXXXXXX";
+    if (!mkdtemp(dir)) {
+        std::perror("mkdtemp");
+        std::exit(1);
+    }
+    for (int n = 5; n < 5 + scales; n++) {
+        std::string path = std::string(dir) + "/" + std::to_string(n) + "edo.scl";
+        FILE *f = std::fopen(path.c_str(), "w");
+        std::fprintf(f, "! %dedo.scl\n%d equal divisions of the octave\n%d\n", n, n, n);
+        for (int i = 1; i < n; i++) {
+            std::fprintf(f, "%.6f\n", 1200.0 * i / n);
+        }
+        std::fprintf(f, "2/1\n");
+        std::fclose(f);
+    }
+    std::string cmd = std::string(BENCH_CALC) + " --scl " + dir + " -o " + dir + "/out >/dev/null 2>&1";
+    while (st.keepRunning()) {
+        if (std::system(cmd.c_str()) != 0) {
+            std::fprintf(stderr, "scala_import: %s failed\n", BENCH_CALC);
+            std::exit(1);
+        }
+    }
+    std::system((std::string("rm -rf ") + dir).c_str());
+    st.items = scales;
+    st.label = "scales";
+}
+BENCHMARK(scala_import);
+
+#endif
@@ -0,0 +1,100 @@
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+#include "bench.hpp"
+#include "fidlib.h"
+
+// The JIT against the interpreted command list, on biquad cascades (with
+// the constant numerators of commands 26-28, and without) and long FIR
+// filters, both per sample through the step function and a block at a
+// time through fid_run_block().
+
+static const int BLOCK = 1024;
+
+typedef void *(*runNew)(FidFilter *, double (**)(void *, double));
+
+static FidFilter *design(const char *spec) {
+    return fid_design(const_cast<char *>(spec), 48000, -1, -1, 0, 0);
+}
+
+// A windowed-sinc low-pass at a quarter of the rate
+static FidFilter *longFir(int taps) {
+    std::vector<double> arr = { 'F', double(taps) };
+    for (int i = 0; i < taps; i++) {
+        double x = i - (taps - 1) / 2.0;
+        double sinc = x == 0 ? 0.5 : std::sin(0.5 * M_PI * x) / (M_PI * x);
+        arr.push_back(sinc * (0.54 - 0.46 * std::cos(2 * M_PI * i / (taps - 1))));
+    }
+    arr.push_back(0);
+    return fid_cv_array(arr.data());
+}
+
+static std::vector<double> noise() {
+    std::vector<double> in(BLOCK);
+    unsigned seed = 1;
+    for (auto &x : in) {
+        seed = seed * 1103515245 + 12345;
+        x = (seed >> 8) / double(1 << 24) - 0.5;
+    }
+    return in;
+}
+
+static void runStep(bench::state &st, FidFilter *ff, runNew make) {
+    double (*funcp)(void *, double);
+    void *run = make(ff, &funcp);
+    void *buf = fid_run_newbuf(run);
+    std::vector<double> in = noise();
+    double acc = 0;
+    while (st.keepRunning()) {
+        for (int n = 0; n < BLOCK; n++) {
+            acc += funcp(buf, in[n]);
+        }
+    }
+    bench::doNotOptimize(acc);
+    fid_run_freebuf(buf);
+    fid_run_free(run);
+    free(ff);
+    st.items = BLOCK;
+}
+
+static void runBlock(bench::state &st, FidFilter *ff, runNew make) {
+    double (*funcp)(void *, double);
+    void *run = make(ff, &funcp);
+    void *buf = fid_run_newbuf(run);
+    std::vector<double> in = noise(), out(BLOCK);
+    while (st.keepRunning()) {
+        fid_run_block(buf, in.data(), out.data(), BLOCK);
+        bench::doNotOptimize(out[BLOCK - 1]);
+    }
+    fid_run_freebuf(buf);
+    fid_run_free(run);
+    free(ff);
+    st.items = BLOCK;
+}
+
+#define JIT_BENCH(name, filt)                                          \
+    static void step_cmdlist_##name(bench::state &st) {                \
+        runStep(st, filt, fid_run_new);                                \
+    }                                                                  \
+    BENCHMARK(step_cmdlist_##name);                                    \
+    static void step_jit_##name(bench::state &st) {                    \
+        runStep(st, filt, fid_run_new_jit);                            \
+    }                                                                  \
+    BENCHMARK(step_jit_##name);                                        \
+    static void block_cmdlist_##name(bench::state &st) {               \
+        runBlock(st, filt, fid_run_new);                               \
+    }                                                                  \
+    BENCHMARK(block_cmdlist_##name);                                   \
+    static void block_jit_##name(bench::state &st) {                   \
+        runBlock(st, filt, fid_run_new_jit);                           \
+    }                                                                  \
+    BENCHMARK(block_jit_##name)
+
+JIT_BENCH(bpre, design("BpRe/800/1000"));                      // 23
+JIT_BENCH(lpbu8, design("LpBu8/1000"));                        // 27x4, 22
+JIT_BENCH(bpbe8, design("BpBe8/1000-2000"));                   // 28x4, 27x4, 22
+JIT_BENCH(bsbu8, design("BsBu8/1000-2000"));                   // 21x8, 22
+JIT_BENCH(lpbuz8, design("LpBuZ8/1000"));                      // 19x4, 22
+JIT_BENCH(fir64, longFir(64));                                 // 8x15, 6, 14
+JIT_BENCH(fir512, longFir(512));                               // 8x127, 6, 14
@@ -0,0 +1,81 @@
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "bench.hpp"
+#include "fidlib.h"
+
+// Text for a bank of long FIR filters separated by ';', as might be
+// loaded from an external design tool.
+static std::string firBank(int filters, int taps) {
+    std::string txt;
+    char num[32];
+    for (int f = 0; f < filters; f++) {
+        txt += "x";
+        for (int t = 0; t < taps; t++) {
+            std::snprintf(num, sizeof(num), " %.17g", (t + f * 0.5) * 1.234567e-4);
+            txt += num;
+        }
+        txt += ";\n";
+    }
+    return txt;
+}
+
+static void parse_fir_bank(bench::state &st) {
+    std::string txt = firBank(16, 1024);
+    while (st.keepRunning()) {
+        char *p = &txt[0];
+        char *end = p + txt.size();
+        while (p != end) {
+            FidFilter *ff;
+            char *err = fid_parse_n(48000, &p, end, &ff);
+            if (err) {
+                std::fprintf(stderr, "%s\n", err);
+                std::exit(1);
+            }
+            std::free(ff);
+            if (p != end) {
+                p++;
+            }
+        }
+    }
+    st.items = txt.size();
+    st.label = "bytes/s";
+}
+BENCHMARK(parse_fir_bank);
+
+static void parse_file_fir_bank(bench::state &st) {
+    std::string txt = firBank(16, 1024);
+    char fnam[] = "/tmp/fidbench_bank.txt";
+    FILE *out = std::fopen(fnam, "w");
+    std::fwrite(txt.data(), 1, txt.size(), out);
+    std::fclose(out);
+    while (st.keepRunning()) {
+        FidFilter **list;
+        char *err = fid_parse_file(48000, fnam, &list);
+        if (err) {
+            std::fprintf(stderr, "%s\n", err);
+            std::exit(1);
+        }
+        for (FidFilter **ff = list; *ff; ff++) {
+            std::free(*ff);
+        }
+        std::free(list);
+    }
+    std::remove(fnam);
+    st.items = txt.size();
+    st.label = "bytes/s";
+}
+BENCHMARK(parse_file_fir_bank);
+
+static void parse_mixed(bench::state &st) {
+    char txt[] = "LpBu4/100 x 0.5 / 1 -0.9 x 1 2 1";
+    while (st.keepRunning()) {
+        char *p = txt;
+        FidFilter *ff;
+        fid_parse(48000, &p, &ff);
+        std::free(ff);
+    }
+    st.items = 1;
+}
+BENCHMARK(parse_mixed);
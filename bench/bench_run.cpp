@@ -0,0 +1,330 @@
+#include <cstdio>
+#include <cstdlib>
+#include <initializer_list>
+#include <vector>
+
+#include "bench.hpp"
+#include "fidlib.h"
+
+// Sweeping a filter's frequency, once per 64-sample block: either
+// rebuilding the Run and its buffer each time, or retuning the running
+// filter in place.
+
+static const int BLOCK = 64;
+
+static FidFilter *sweepDesign(int i) {
+    char spec[] = "LpBu4";
+    double freq = 100.0 + (i & 255) * 10.0;
+    return fid_design(spec, 48000, freq, 0, 0, 0);
+}
+
+static void run_sweep_rebuild(bench::state &st) {
+    double (*funcp)(void *, double);
+    double acc = 0;
+    int i = 0;
+    while (st.keepRunning()) {
+        FidFilter *ff = sweepDesign(i++);
+        void *run = fid_run_new(ff, &funcp);
+        void *buf = fid_run_newbuf(run);
+        for (int n = 0; n < BLOCK; n++) {
+            acc += funcp(buf, n & 1 ? 1.0 : -1.0);
+        }
+        fid_run_freebuf(buf);
+        fid_run_free(run);
+        free(ff);
+    }
+    bench::doNotOptimize(acc);
+    st.items = BLOCK;
+}
+BENCHMARK(run_sweep_rebuild);
+
+static void run_sweep_update(bench::state &st) {
+    double (*funcp)(void *, double);
+    double acc = 0;
+    int i = 0;
+    FidFilter *ff = sweepDesign(i++);
+    void *run = fid_run_new(ff, &funcp);
+    void *buf = fid_run_newbuf(run);
+    free(ff);
+    while (st.keepRunning()) {
+        ff = sweepDesign(i++);
+        if (fid_run_update_coef(run, ff) != 1) {
+            fprintf(stderr, "run_sweep_update: structure changed\n");
+            exit(1);
+        }
+        for (int n = 0; n < BLOCK; n++) {
+            acc += funcp(buf, n & 1 ? 1.0 : -1.0);
+        }
+        free(ff);
+    }
+    fid_run_freebuf(buf);
+    fid_run_free(run);
+    bench::doNotOptimize(acc);
+    st.items = BLOCK;
+}
+BENCHMARK(run_sweep_update);
+
+// The same sweep through fid_run_block(), with and without a ramp over
+
+// A Q=800 resonator at the bottom of a scale, run in blocks by the
+// double and float runners, the latter with each section structure.
+// The float benches' labels are the RMS error of the impulse response
+// against the double runner's.
+static const int LOWBLOCK = 4096;
+
+static FidFilter *lowResonator() {
+    char spec[] = "BpRe/800/13.75";
+    return fid_design(spec, 96000, -1, -1, 0, 0);
+}
+
+static void run_block_bpre_low(bench::state &st) {
+    double (*funcp)(void *, double);
+    FidFilter *ff = lowResonator();
+    void *run = fid_run_new(ff, &funcp);
+    void *buf = fid_run_newbuf(run);
+    std::vector<double> data(LOWBLOCK, 0.0);
+    while (st.keepRunning()) {
+        data[0] = 1.0;
+        fid_run_block(buf, data.data(), data.data(), LOWBLOCK);
+    }
+    bench::doNotOptimize(data[LOWBLOCK - 1]);
+    fid_run_freebuf(buf);
+    fid_run_free(run);
+    free(ff);
+    st.items = LOWBLOCK;
+}
+BENCHMARK(run_block_bpre_low);
+
+static void runBlockFloat(bench::state &st, int form) {
+    float (*funcp)(void *, float);
+    FidFilter *ff = lowResonator();
+    void *run = fid_run_new_f_form(ff, form, &funcp);
+    void *buf = fid_run_newbuf_f(run);
+    std::vector<float> data(LOWBLOCK, 0.0f);
+    while (st.keepRunning()) {
+        data[0] = 1.0f;
+        fid_run_block_f(buf, data.data(), data.data(), LOWBLOCK);
+    }
+    bench::doNotOptimize(data[LOWBLOCK - 1]);
+    char label[40];
+    std::snprintf(label, sizeof(label), "error %.2g", fid_run_error_f(ff, form, 96000 * 4));
+    st.label = label;
+    fid_run_freebuf_f(buf);
+    fid_run_free_f(run);
+    free(ff);
+    st.items = LOWBLOCK;
+}
+
+static void run_block_f_bpre_low(bench::state &st) {
+    runBlockFloat(st, FID_FORM_AUTO);
+}
+BENCHMARK(run_block_f_bpre_low);
+
+static void run_block_f_coupled_bpre_low(bench::state &st) {
+    runBlockFloat(st, FID_FORM_COUPLED);
+}
+BENCHMARK(run_block_f_coupled_bpre_low);
+
+static void run_block_f_svf_bpre_low(bench::state &st) {
+    runBlockFloat(st, FID_FORM_SVF);
+}
+BENCHMARK(run_block_f_svf_bpre_low);
+
+// The silent tail of a Q=800 resonator's ring-down, which takes far too
+// long to reach naturally: each pass restarts the filter from an
+// impulse of 1e-309, so its state is subnormal throughout 4096 samples
+// of silence, run in blocks.  The same with an impulse of 1.0 gives the
+// speed with normal values.  The label is the number of subnormal state
+// values after the last block.
+static void runTail(bench::state &st, double impulse, int mode) {
+    double (*funcp)(void *, double);
+    char spec[] = "BpRe/800/10000";
+    FidFilter *ff = fid_design(spec, 96000, -1, -1, 0, 0);
+    void *run = fid_run_new(ff, &funcp);
+    void *buf = fid_run_newbuf(run);
+    double data[BLOCK];
+    double acc = 0;
+    fid_run_denormal(buf, mode | FID_DENORM_COUNT);
+    while (st.keepRunning()) {
+        fid_run_zapbuf(buf);
+        for (int b = 0; b < 4096 / BLOCK; b++) {
+            for (int n = 0; n < BLOCK; n++) {
+                data[n] = b == 0 && n == 0 ? impulse : 0.0;
+            }
+            fid_run_block(buf, data, data, BLOCK);
+            acc += data[BLOCK - 1];
+        }
+    }
+    char label[40];
+    std::snprintf(label, sizeof(label), "%d subnormal", fid_run_denormals(buf));
+    st.label = label;
+    fid_run_freebuf(buf);
+    fid_run_free(run);
+    free(ff);
+    bench::doNotOptimize(acc);
+    st.items = 4096;
+}
+
+static void denorm_tail_normal(bench::state &st) {
+    runTail(st, 1.0, 0);
+}
+BENCHMARK(denorm_tail_normal);
+
+static void denorm_tail_plain(bench::state &st) {
+    runTail(st, 1e-309, 0);
+}
+BENCHMARK(denorm_tail_plain);
+
+static void denorm_tail_ftz(bench::state &st) {
+    runTail(st, 1e-309, FID_DENORM_FTZ);
+}
+BENCHMARK(denorm_tail_ftz);
+
+static void denorm_tail_dc(bench::state &st) {
+    runTail(st, 1e-309, FID_DENORM_DC);
+}
+BENCHMARK(denorm_tail_dc);
+
+// each block, to show the cost of gliding between coefficient sets.
+static void runSweepBlock(bench::state &st, int ramp) {
+    double (*funcp)(void *, double);
+    double data[BLOCK];
+    double acc = 0;
+    int i = 0;
+    FidFilter *ff = sweepDesign(i++);
+    void *run = fid_run_new(ff, &funcp);
+    void *buf = fid_run_newbuf(run);
+    free(ff);
+    fid_run_ramp(buf, ramp);
+    for (int n = 0; n < BLOCK; n++) {
+        data[n] = n & 1 ? 1.0 : -1.0;
+    }
+    while (st.keepRunning()) {
+        ff = sweepDesign(i++);
+        fid_run_update_coef(run, ff);
+        fid_run_block(buf, data, data, BLOCK);
+        acc += data[BLOCK - 1];
+        free(ff);
+    }
+    fid_run_freebuf(buf);
+    fid_run_free(run);
+    bench::doNotOptimize(acc);
+    st.items = BLOCK;
+}
+
+static void run_sweep_block(bench::state &st) {
+    runSweepBlock(st, 0);
+}
+BENCHMARK(run_sweep_block);
+
+static void run_sweep_block_ramp(bench::state &st) {
+    runSweepBlock(st, BLOCK);
+}
+BENCHMARK(run_sweep_block_ramp);
+
+// filter_step() for each command of the interpreter.  Each filter below is
+// an IIR/FIR layout that fid_run_new() compiles to the given commands.
+// Command 9 (a lone IIR+FIR pair) isn't listed, since a 3+3 pair always
+// compiles to command 18, or to 23-25 when its FIR is a constant
+// numerator.  The IIR coefficients are kept small so that
+// the filters are stable.
+
+static FidFilter *layout(std::initializer_list<int> lens) {
+    std::vector<double> arr;
+    bool iir = true;
+    for (int len: lens) {
+        if (len) {
+            arr.push_back(iir ? 'I' : 'F');
+            arr.push_back(len);
+            for (int i = 0; i < len; i++) {
+                arr.push_back(i == 0 ? (len == 1 ? 0.5 : 1.0) : (iir ? 0.3 : 0.5) / (i + 1));
+            }
+        }
+        iir = !iir;
+    }
+    arr.push_back(0);
+    return fid_cv_array(arr.data());
+}
+
+static void stepLayout(bench::state &st, FidFilter *ff) {
+    double (*funcp)(void *, double);
+    void *run = fid_run_new(ff, &funcp);
+    void *buf = fid_run_newbuf(run);
+    double acc = 0;
+    while (st.keepRunning()) {
+        for (int n = 0; n < BLOCK; n++) {
+            acc += funcp(buf, n & 1 ? 1.0 : -1.0);
+        }
+    }
+    fid_run_freebuf(buf);
+    fid_run_free(run);
+    free(ff);
+    bench::doNotOptimize(acc);
+    st.items = BLOCK;
+}
+
+// Lengths alternate IIR, FIR, IIR, FIR, ...; 0 for none
+#define STEP_BENCH(name, ...)                                          \
+    static void step_##name(bench::state &st) {                        \
+        stepLayout(st, layout({ __VA_ARGS__ }));                       \
+    }                                                                  \
+    BENCHMARK(step_##name)
+
+STEP_BENCH(cmd01_iir, 3, 2);                    // 1, 15
+STEP_BENCH(cmd02_iir2, 4);                      // 2, 13
+STEP_BENCH(cmd03_iir3, 5);                      // 3, 13
+STEP_BENCH(cmd04_iir4n, 10);                    // 4x2, 13
+STEP_BENCH(cmd05_fir, 2, 3);                    // 5, 15
+STEP_BENCH(cmd06_fir2, 0, 4);                   // 6, 14
+STEP_BENCH(cmd07_fir3, 0, 5);                   // 7, 14
+STEP_BENCH(cmd08_fir4n, 0, 34);                 // 8x8, 14
+STEP_BENCH(cmd10_both2, 4, 4);                  // 10, 15
+STEP_BENCH(cmd11_both3, 5, 5);                  // 11, 15
+STEP_BENCH(cmd12_both4n, 10, 10);               // 12x2, 15
+STEP_BENCH(cmd13_endiir, 2);                    // 13
+STEP_BENCH(cmd14_endfir, 0, 2);                 // 14
+STEP_BENCH(cmd15_endboth, 2, 2);                // 15
+STEP_BENCH(cmd16_biquad_iir, 3);                // 16
+STEP_BENCH(cmd17_biquad_fir, 0, 3);             // 17
+STEP_BENCH(cmd18_biquad, 3, 3);                 // 18
+STEP_BENCH(cmd19_biquad_iir_x4, 3, 0, 3, 0, 3, 0, 3);          // 19x4
+STEP_BENCH(cmd20_biquad_fir_x4, 0, 3, 0, 3, 0, 3, 0, 3);       // 20x4
+STEP_BENCH(cmd21_biquad_x4, 3, 3, 3, 3, 3, 3, 3, 3);           // 21x4
+STEP_BENCH(cmd22_gain, 2, 0, 0, 1);             // 13, 22
+
+// Biquads whose FIR half is one of the constant numerators that get
+// commands 23-28, as fid_design() gives for BpRe, BpBu, LpBu and HpBu.
+static FidFilter *constBiquads(double mid, double end, int count) {
+    std::vector<double> arr;
+    for (int i = 0; i < count; i++) {
+        arr.insert(arr.end(), { 'I', 3, 1.0, 0.15, 0.1, 'F', 3, 1.0, mid, end });
+    }
+    arr.push_back(0);
+    return fid_cv_array(arr.data());
+}
+
+#define CONST_BENCH(name, mid, end, count)                             \
+    static void step_##name(bench::state &st) {                        \
+        stepLayout(st, constBiquads(mid, end, count));                 \
+    }                                                                  \
+    BENCHMARK(step_##name)
+
+CONST_BENCH(cmd23_biquad_bp, 0, -1, 1);         // 23
+CONST_BENCH(cmd24_biquad_lp, 2, 1, 1);          // 24
+CONST_BENCH(cmd25_biquad_hp, -2, 1, 1);         // 25
+CONST_BENCH(cmd26_biquad_bp_x4, 0, -1, 4);      // 26x4
+CONST_BENCH(cmd27_biquad_lp_x4, 2, 1, 4);       // 27x4
+CONST_BENCH(cmd28_biquad_hp_x4, -2, 1, 4);      // 28x4
+
+static void run_new_lpbu8(bench::state &st) {
+    double (*funcp)(void *, double);
+    char spec[] = "LpBu8/1000";
+    FidFilter *ff = fid_design(spec, 48000, -1, -1, 0, 0);
+    while (st.keepRunning()) {
+        void *run = fid_run_new(ff, &funcp);
+        fid_run_free(run);
+    }
+    free(ff);
+    st.items = 1;
+}
+BENCHMARK(run_new_lpbu8);
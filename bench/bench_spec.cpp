@@ -0,0 +1,55 @@
+#include <cstdio>
+
+#include "bench.hpp"
+#include "fidlib.h"
+
+// A spread of specs across the filter table, including the entries near
+// the end that a linear search reaches last.
+static const char *specs[] = {
+    "BpRe/800/440",
+    "BpRe/2/13.75",
+    "LpBu4/20.4",
+    "BpBu2/3-4",
+    "BsRe/1000/10",
+    "HpChZ3/-0.5/1200",
+    "LpBuBe4/50/300",
+    "PkBq/1.5/-6/1000",
+    "HsBq/1/6/1000",
+    "LpBa/100"
+};
+
+const int N_SPECS = sizeof(specs) / sizeof(specs[0]);
+
+// Parses a spec-string without designing anything: fid_rewrite_spec()
+// with no outputs requested is a bare parse_spec() call.
+static void spec_parse(bench::state &st) {
+    char *buf[N_SPECS];
+    for (int i = 0; i < N_SPECS; i++) {
+        buf[i] = (char *)specs[i];
+    }
+    while (st.keepRunning()) {
+        for (int i = 0; i < N_SPECS; i++) {
+            fid_rewrite_spec(buf[i], -1, -1, 0, 0, 0, 0, 0, 0);
+        }
+    }
+    st.items = N_SPECS;
+}
+BENCHMARK(spec_parse);
+
+static void spec_parse_bpre(bench::state &st) {
+    char spec[] = "BpRe/800/440";
+    while (st.keepRunning()) {
+        fid_rewrite_spec(spec, -1, -1, 0, 0, 0, 0, 0, 0);
+    }
+    st.items = 1;
+}
+BENCHMARK(spec_parse_bpre);
+
+static void spec_parse_lpba(bench::state &st) {
+    char spec[] = "LpBa/100";
+    while (st.keepRunning()) {
+        fid_rewrite_spec(spec, -1, -1, 0, 0, 0, 0, 0, 0);
+    }
+    st.items = 1;
+}
+BENCHMARK(spec_parse_lpba);
@@ -6,62 +6,237 @@
 #include <array>
 #include <vector>
 #include <utility>
+#include <algorithm>
+#include <map>
+#include <set>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <filesystem>
+#include <typeinfo>
+#ifdef __GNUG__
+#include <cxxabi.h>
+#endif
+#include <sstream>
 	
 
 #include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <limits.h>
 
-#include "fidlib.h"
+#include "fidcascade.hpp"     // Includes fidlib.h
 
 const int NUM_FREQS = 21;
 const int NUM_SCALES = 11;
 const double PI  = 3.141592653589793238463;
 
+// A scale is banks rows of notes each; the built-in generators all make 
+// NUM_SCALES rows of NUM_FREQS, the geometry of SMR
 struct scale {
 
     std::string filename;
     std::string classname;
     std::string name;
     std::string description;
-    std::array<std::string,11> scalename;
-    std::array<double,231> frequency;
-    std::array<std::string,231> notename;  
+    int banks = NUM_SCALES;
+    int notes = NUM_FREQS;
+    std::vector<std::string> scalename = std::vector<std::string>(NUM_SCALES);
+    std::vector<double> frequency = std::vector<double>(NUM_SCALES * NUM_FREQS);
+    std::vector<std::string> notename = std::vector<std::string>(NUM_SCALES * NUM_FREQS);
+
+    void resize(int nBanks, int nNotes) {
+        banks = nBanks;
+        notes = nNotes;
+        scalename.resize(banks);
+        frequency.resize(banks * notes);
+        notename.resize(banks * notes);
+    }
+
+};
+
+// An exact frequency ratio, for the just intonation generators.  Products of
+// intervals and octaves are kept as fractions in lowest terms, and only 
+// rounded when applied to a frequency, once, so the tables don't depend on
+// the order of floating point operations.
+struct rational {
+
+    int64_t num = 1;
+    int64_t den = 1;
+
+    rational() {}
+
+    rational(int64_t n, int64_t d = 1) {
+        set(n, d);
+    }
+
+    void set(__int128 n, __int128 d) {
+        if (d < 0) {
+            n = -n;
+            d = -d;
+        }
+        __int128 a = n < 0 ? -n : n, b = d;
+        while (b) {
+            __int128 t = a % b;
+            a = b;
+            b = t;
+        }
+        if (a > 1) {
+            n /= a;
+            d /= a;
+        }
+        if (d == 0 || n > INT64_MAX || n < -INT64_MAX || d > INT64_MAX) {
+            std::cerr << "Rational interval out of range" << std::endl;
+            exit(1);
+        }
+        num = n;
+        den = d;
+    }
+
+    rational operator*(rational const &r) const {
+        rational rv;
+        rv.set((__int128)num * r.num, (__int128)den * r.den);
+        return rv;
+    }
+
+    rational pow(int k) const {
+        rational rv;
+        for (int i = 0; i < k; i++) {
+            rv = rv * *this;
+        }
+        return rv;
+    }
+
+    // f * num / den, correctly rounded
+    double apply(double f) const {
+        if (f == 0.0 || num == 0) {
+            return 0.0;
+        }
+        bool neg = (f < 0) != (num < 0);
+        int e;
+        uint64_t m = (uint64_t)ldexp(fabs(frexp(f, &e)), 53);
+        unsigned __int128 n = (unsigned __int128)m * (uint64_t)(num < 0 ? -num : num);
+        unsigned __int128 d = (uint64_t)den;
+
+        // Scale so the quotient has 63 or 64 bits, well beyond a double's 53,
+        // and fold any remainder into its lowest bit so it rounds correctly
+        int s = 63 + bits(d) - bits(n);
+        if (s >= 0) {
+            n <<= s;
+        } else {
+            d <<= -s;
+        }
+        uint64_t q = n / d;
+        if (n % d) {
+            q |= 1;
+        }
+        double rv = ldexp((double)q, e - 53 - s);
+        return neg ? -rv : rv;
+    }
+
+    std::string str() const {
+        return den == 1 ? std::to_string(num) : std::to_string(num) + "/" + std::to_string(den);
+    }
+
+    static int bits(unsigned __int128 v) {
+        int b = 0;
+        while (v) {
+            v >>= 1;
+            b++;
+        }
+        return b;
+    }
+
+};
 
+// What choosing a scale for generation needs to know of it: its names, its
+// geometry, and the last of its frequencies at or below the cut (-1 if none)
+struct scaleSummary {
+    std::string classname;
+    std::string filename;
+    int banks;
+    int notes;
+    double lastBelow;
 };
 
 struct generator {
     // This must generate a complete scale object
     virtual scale generateScale() = 0;
+
+    // Generators that are costly to run may override this to answer from
+    // what they already know
+    virtual scaleSummary summarize(double cut) {
+        scale s = generateScale();
+        scaleSummary sum = { s.classname, s.filename, s.banks, s.notes, -1.0 };
+        for (double f: s.frequency) {
+            if (f <= cut) {
+                sum.lastBelow = f;
+            }
+        }
+        return sum;
+    }
 };
 
 struct interval_generator : generator {
 
     void generateFrequencies(scale &m, 
-        std::vector<double> n_intervals[NUM_SCALES], 
+        std::vector<double> n_intervals[], 
         std::vector<double> startFrequencies,
         std::vector<double> octaves ) {
 
-        for (int scaleIdx = 0; scaleIdx < NUM_SCALES; scaleIdx++) {
+        for (int scaleIdx = 0; scaleIdx < m.banks; scaleIdx++) {
             for (int noteIdx = 0; noteIdx < n_intervals[scaleIdx].size(); noteIdx++ ) {
-                m.frequency[scaleIdx * NUM_FREQS + noteIdx] = 
+                m.frequency[scaleIdx * m.notes + noteIdx] = 
                     n_intervals[scaleIdx][noteIdx] * startFrequencies[scaleIdx];
             }
 
-            for (int i = n_intervals[scaleIdx].size(); i < NUM_FREQS; i++) {
-                m.frequency[scaleIdx * NUM_FREQS + i] = 
-                    m.frequency[scaleIdx * NUM_FREQS + i - n_intervals[scaleIdx].size()] * octaves[scaleIdx];
+            for (int i = n_intervals[scaleIdx].size(); i < m.notes; i++) {
+                m.frequency[scaleIdx * m.notes + i] = 
+                    m.frequency[scaleIdx * m.notes + i - n_intervals[scaleIdx].size()] * octaves[scaleIdx];
             }
         }
     }
 
-    void generateNames(scale &m, std::vector<std::string> n_intervals_str[NUM_SCALES]) {
+    // As above, exactly: each note's ratio to the start frequency, octaves 
+    // included, is found as a fraction and the frequency rounded once
+    void generateFrequencies(scale &m, 
+        std::vector<rational> n_intervals[], 
+        std::vector<double> startFrequencies,
+        std::vector<rational> octaves ) {
 
-        for (int scaleIdx = 0; scaleIdx < NUM_SCALES; scaleIdx++) {
+        for (int scaleIdx = 0; scaleIdx < m.banks; scaleIdx++) {
+            int size = n_intervals[scaleIdx].size();
+            for (int noteIdx = 0; noteIdx < m.notes; noteIdx++) {
+                rational r = n_intervals[scaleIdx][noteIdx % size] * octaves[scaleIdx].pow(noteIdx / size);
+                m.frequency[scaleIdx * m.notes + noteIdx] = r.apply(startFrequencies[scaleIdx]);
+            }
+        }
+    }
+
+    // Name each note by its interval from the start of its octave
+    void generateNames(scale &m, std::vector<rational> n_intervals[]) {
+
+        for (int scaleIdx = 0; scaleIdx < m.banks; scaleIdx++) {
+            int size = n_intervals[scaleIdx].size();
+            for (int noteIdx = 0; noteIdx < m.notes; noteIdx++) {
+                m.notename[scaleIdx * m.notes + noteIdx] = n_intervals[scaleIdx][noteIdx % size].str();
+            }
+        }
+    }
+
+    void generateNames(scale &m, std::vector<std::string> n_intervals_str[]) {
+
+        for (int scaleIdx = 0; scaleIdx < m.banks; scaleIdx++) {
             for (int noteIdx = 0; noteIdx < n_intervals_str[scaleIdx].size(); noteIdx++ ) {
-                m.notename[scaleIdx * NUM_FREQS + noteIdx]  = n_intervals_str[scaleIdx][noteIdx];
+                m.notename[scaleIdx * m.notes + noteIdx]  = n_intervals_str[scaleIdx][noteIdx];
             }
 
-            for (int i = n_intervals_str[scaleIdx].size(); i < NUM_FREQS; i++) {
-                m.notename[scaleIdx * NUM_FREQS + i]  = m.notename[scaleIdx * NUM_FREQS + i - n_intervals_str[scaleIdx].size()];
+            for (int i = n_intervals_str[scaleIdx].size(); i < m.notes; i++) {
+                m.notename[scaleIdx * m.notes + i]  = m.notename[scaleIdx * m.notes + i - n_intervals_str[scaleIdx].size()];
             }
         }
     }
@@ -71,31 +246,48 @@ struct wcspread_generator : generator {
 
     virtual double cents() { return 78.0; }
 
-    void generateFrequencies(scale &m, std::pair<int,int> intervalPairs[11], float startFrequency) {
+    // One pair of intervals per row
+    template <int N>
+    void checkRows(scale const &m, std::pair<int,int> (&intervalPairs)[N]) {
+        if (m.banks > N) {
+            std::cerr << m.name << ": " << m.banks << " rows, but only " << N << " interval pairs" << std::endl;
+            exit(1);
+        }
+    }
 
-        for (int scaleIdx = 0; scaleIdx < NUM_SCALES; scaleIdx++) {
-            m.frequency[scaleIdx * NUM_FREQS] = startFrequency;
-            for (int noteIdx = 1; noteIdx < NUM_FREQS; noteIdx = noteIdx + 2) {
+    template <int N>
+    void generateFrequencies(scale &m, std::pair<int,int> (&intervalPairs)[N], float startFrequency) {
 
-                m.frequency[scaleIdx * NUM_FREQS + noteIdx] = 
-                    m.frequency[scaleIdx * NUM_FREQS + noteIdx - 1] *
+        checkRows(m, intervalPairs);
+        for (int scaleIdx = 0; scaleIdx < m.banks; scaleIdx++) {
+            m.frequency[scaleIdx * m.notes] = startFrequency;
+            for (int noteIdx = 1; noteIdx < m.notes; noteIdx = noteIdx + 2) {
+
+                m.frequency[scaleIdx * m.notes + noteIdx] = 
+                    m.frequency[scaleIdx * m.notes + noteIdx - 1] *
                     pow(2.0, cents() * intervalPairs[scaleIdx].first / 1200.0);
 
-                m.frequency[scaleIdx * NUM_FREQS + noteIdx + 1] = 
-                    m.frequency[scaleIdx * NUM_FREQS + noteIdx] *
-                    pow(2.0, cents() * intervalPairs[scaleIdx].second / 1200.0);
+                if (noteIdx + 1 < m.notes) {
+                    m.frequency[scaleIdx * m.notes + noteIdx + 1] = 
+                        m.frequency[scaleIdx * m.notes + noteIdx] *
+                        pow(2.0, cents() * intervalPairs[scaleIdx].second / 1200.0);
+                }
 
             }
         }
     }
 
-    void generateNames(scale &m, std::pair<int,int> intervalPairs[11]) {
-        for (int scaleIdx = 0; scaleIdx < NUM_SCALES; scaleIdx++) {
-            m.notename[scaleIdx * NUM_FREQS] = "0";
+    template <int N>
+    void generateNames(scale &m, std::pair<int,int> (&intervalPairs)[N]) {
+        checkRows(m, intervalPairs);
+        for (int scaleIdx = 0; scaleIdx < m.banks; scaleIdx++) {
+            m.notename[scaleIdx * m.notes] = "0";
 
-            for (int noteIdx = 1; noteIdx < NUM_FREQS; noteIdx = noteIdx + 2) {
-                m.notename[scaleIdx * NUM_FREQS + noteIdx] = "+" + std::to_string(intervalPairs[scaleIdx].first);
-                m.notename[scaleIdx * NUM_FREQS + noteIdx + 1] = "+" + std::to_string(intervalPairs[scaleIdx].second);
+            for (int noteIdx = 1; noteIdx < m.notes; noteIdx = noteIdx + 2) {
+                m.notename[scaleIdx * m.notes + noteIdx] = "+" + std::to_string(intervalPairs[scaleIdx].first);
+                if (noteIdx + 1 < m.notes) {
+                    m.notename[scaleIdx * m.notes + noteIdx + 1] = "+" + std::to_string(intervalPairs[scaleIdx].second);
+                }
             }
         }
     }
@@ -147,23 +339,21 @@ struct video_generator : generator {
 
 struct bp_generator : interval_generator {
 
-    double octave() { return 3.0; }
-
-   	double BP_intervals[14] = {
-        1.0, 
-        27.0/25, 
-        25.0/21.0, 
-        9.0/7.0, 
-        7.0/5.0, 
-        75.0/49.0, 
-        5.0/3.0, 
-        9.0/5.0, 
-        49.0/25.0, 
-        15.0/7.0, 
-        7.0/3.0, 
-        63.0/25.0, 
-        25.0/9.0, 
-        3.0
+   	rational BP_intervals[14] = {
+        rational(1), 
+        rational(27, 25), 
+        rational(25, 21), 
+        rational(9, 7), 
+        rational(7, 5), 
+        rational(75, 49), 
+        rational(5, 3), 
+        rational(9, 5), 
+        rational(49, 25), 
+        rational(15, 7), 
+        rational(7, 3), 
+        rational(63, 25), 
+        rational(25, 9), 
+        rational(3)
     };
 
    	std::string BP_intervals_str[14] = {
@@ -183,7 +373,7 @@ struct bp_generator : interval_generator {
         "C"
     };
 
-    std::vector<double> n_intervals[NUM_SCALES] = { 
+    std::vector<rational> n_intervals[NUM_SCALES] = { 
         { BP_intervals[0], BP_intervals[3], BP_intervals[7],  BP_intervals[10] },
         { BP_intervals[0], BP_intervals[3], BP_intervals[7],  BP_intervals[11] },
         { BP_intervals[0], BP_intervals[4], BP_intervals[6],  BP_intervals[10] },
@@ -214,7 +404,7 @@ struct bp_generator : interval_generator {
 
     std::vector<double> startFrequencies {std::vector<double>(11, 32.7031956626)}; // C1
 
-    std::vector<double> octaves {std::vector<double>(11, 3.0)}; // C1
+    std::vector<rational> octaves {std::vector<rational>(11, rational(3))};
 
     scale generateScale() override {
 
@@ -448,18 +638,18 @@ struct shrutis_generator : generator {
 struct mesopotamian_generator : interval_generator {
 
 	// Exact Mesopotamian tuning ratios:
-	double I    = 1.0;      		// Unison
-	double I0   = 256.0/243.0;		// Pythagorean minor second
-	double I1   = 9.0/8.0;			// Pythagorean major second
-	double I18  = 32.0/27.0;		// Pythagorean minor third
-	double I2   = 81.0/64.0;		// Pythagorean major third
-	double I3   = 4.0/3.0;			// Pythagorean perfect fourth
-	double I4   = 1024.0/729.0;		// Pythagorean diminished fifth
-	double I5   = 3.0/2.0; 			// Pythagorean perfect fifth
-	double I58  = 128.0/81.0;		// Pythagorean minor sixth
-	double I6   = 27.0/16.0;		// Pythagorean major sixth
-	double I7   = 16.0/9.0;			// Pythagorean minor seventh
-	double I8   = 243.0/128.0;		// Pythagorean major seventh
+	rational I    = 1;       		// Unison
+	rational I0   = rational(256, 243);		// Pythagorean minor second
+	rational I1   = rational(9, 8);			// Pythagorean major second
+	rational I18  = rational(32, 27);		// Pythagorean minor third
+	rational I2   = rational(81, 64);		// Pythagorean major third
+	rational I3   = rational(4, 3);			// Pythagorean perfect fourth
+	rational I4   = rational(1024, 729);		// Pythagorean diminished fifth
+	rational I5   = rational(3, 2); 			// Pythagorean perfect fifth
+	rational I58  = rational(128, 81);		// Pythagorean minor sixth
+	rational I6   = rational(27, 16);		// Pythagorean major sixth
+	rational I7   = rational(16, 9);			// Pythagorean minor seventh
+	rational I8   = rational(243, 128);		// Pythagorean major seventh
 	// No Augmented fourth 729:512
 
     scale generateScale() override {
@@ -483,7 +673,7 @@ struct mesopotamian_generator : interval_generator {
             "Mitum; A1-"
         };
 
-        std::vector<double> n_intervals[NUM_SCALES] = {
+        std::vector<rational> n_intervals[NUM_SCALES] = {
             { I, I0, I18, I3, I5, I58, I7 },   // Ishartum
             { I, I0, I18, I3, I5, I58, I7 },   // Ishartum
             { I, I1, I18, I3, I5, I6, I7 },    // Embulum
@@ -524,9 +714,10 @@ struct mesopotamian_generator : interval_generator {
             55.0 * 8.0,
             55.0}; 
 
-        std::vector<double> octaves {std::vector<double>(11, 2.0)};
+        std::vector<rational> octaves {std::vector<rational>(11, rational(2))};
 
         generateFrequencies(m, n_intervals, startFrequencies, octaves);
+        generateNames(m, n_intervals);
 
         return m;
 
@@ -889,18 +1080,18 @@ struct diatonicjust_generator : interval_generator {
             "F4-G7"
         };
 
-        std::vector<double> n_intervals[NUM_SCALES] = { 
-            { 1.0, 9.0/8.0, 5.0/4.0, 45.0/32.0, 8.0/5.0, 9.0/5.0 },
-            { 1.0, 9.0/8.0, 5.0/4.0, 45.0/32.0, 8.0/5.0, 9.0/5.0 },
-            { 1.0, 9.0/8.0, 5.0/4.0, 45.0/32.0, 8.0/5.0, 9.0/5.0 },
-            { 1.0, 9.0/8.0, 5.0/4.0, 45.0/32.0, 8.0/5.0, 9.0/5.0 },
-            { 1.0, 9.0/8.0, 5.0/4.0, 45.0/32.0, 8.0/5.0, 9.0/5.0 },
-            { 1.0, 9.0/8.0, 5.0/4.0, 45.0/32.0, 8.0/5.0, 9.0/5.0 },
-            { 1.0, 9.0/8.0, 5.0/4.0, 45.0/32.0, 8.0/5.0, 9.0/5.0 },
-            { 1.0, 9.0/8.0, 5.0/4.0, 45.0/32.0, 8.0/5.0, 9.0/5.0 },
-            { 1.0, 9.0/8.0, 5.0/4.0, 45.0/32.0, 8.0/5.0, 9.0/5.0 },
-            { 1.0, 9.0/8.0, 5.0/4.0, 45.0/32.0, 8.0/5.0, 9.0/5.0 },
-            { 1.0, 9.0/8.0, 5.0/4.0, 45.0/32.0, 8.0/5.0, 9.0/5.0 }            
+        std::vector<rational> n_intervals[NUM_SCALES] = { 
+            { rational(1), rational(9, 8), rational(5, 4), rational(45, 32), rational(8, 5), rational(9, 5) },
+            { rational(1), rational(9, 8), rational(5, 4), rational(45, 32), rational(8, 5), rational(9, 5) },
+            { rational(1), rational(9, 8), rational(5, 4), rational(45, 32), rational(8, 5), rational(9, 5) },
+            { rational(1), rational(9, 8), rational(5, 4), rational(45, 32), rational(8, 5), rational(9, 5) },
+            { rational(1), rational(9, 8), rational(5, 4), rational(45, 32), rational(8, 5), rational(9, 5) },
+            { rational(1), rational(9, 8), rational(5, 4), rational(45, 32), rational(8, 5), rational(9, 5) },
+            { rational(1), rational(9, 8), rational(5, 4), rational(45, 32), rational(8, 5), rational(9, 5) },
+            { rational(1), rational(9, 8), rational(5, 4), rational(45, 32), rational(8, 5), rational(9, 5) },
+            { rational(1), rational(9, 8), rational(5, 4), rational(45, 32), rational(8, 5), rational(9, 5) },
+            { rational(1), rational(9, 8), rational(5, 4), rational(45, 32), rational(8, 5), rational(9, 5) },
+            { rational(1), rational(9, 8), rational(5, 4), rational(45, 32), rational(8, 5), rational(9, 5) }            
         };
 
         std::vector<std::string> n_intervals_str[NUM_SCALES] = { 
@@ -932,9 +1123,10 @@ struct diatonicjust_generator : interval_generator {
             rootA * pow(2, 8.0/12.0) * 8
         }; 
 
-        std::vector<double> octaves {std::vector<double>(11, 2.0)}; // C1
+        std::vector<rational> octaves {std::vector<rational>(11, rational(2))};
 
         generateFrequencies(m, n_intervals, startFrequencies, octaves);
+        generateNames(m, n_intervals);
 
         return m;
 
@@ -1108,18 +1300,18 @@ struct ji_triad_generator : interval_generator {
             "Unison, P5, M7; G1-F#8"
         };
 
-        std::vector<double> n_intervals[NUM_SCALES] = { 
-            { 1.0, 9.0/8.0, 3.0/2.0 },  // M2_5
-            { 1.0, 5.0/4.0, 10.0/7.0 }, // M3_b5
-            { 1.0, 6.0/5.0, 15.0/8.0 }, // m3_M5
-            { 1.0, 5.0/4.0, 3.0/2.0 },  // M3_5
-            { 1.0, 6.0/5.0, 10.0/7.0 }, // m3_#5
-            { 1.0, 4.0/3.0, 3.0/2.0 },  // 4_5
-            { 1.0, 5.0/4.0, 5.0/3.0 },  // M3_M6
-            { 1.0, 6.0/5.0, 8.0/5.0 },  // m3_b6
-            { 1.0, 5.0/4.0, 8.0/5.0 },  // M3_#5
-            { 1.0, 6.0/5.0, 16.0/9.0 }, // m3_m7
-            { 1.0, 3.0/2.0, 15.0/8.0 }  // 5_M7     
+        std::vector<rational> n_intervals[NUM_SCALES] = { 
+            { rational(1), rational(9, 8), rational(3, 2) },  // M2_5
+            { rational(1), rational(5, 4), rational(10, 7) }, // M3_b5
+            { rational(1), rational(6, 5), rational(15, 8) }, // m3_M5
+            { rational(1), rational(5, 4), rational(3, 2) },  // M3_5
+            { rational(1), rational(6, 5), rational(10, 7) }, // m3_#5
+            { rational(1), rational(4, 3), rational(3, 2) },  // 4_5
+            { rational(1), rational(5, 4), rational(5, 3) },  // M3_M6
+            { rational(1), rational(6, 5), rational(8, 5) },  // m3_b6
+            { rational(1), rational(5, 4), rational(8, 5) },  // M3_#5
+            { rational(1), rational(6, 5), rational(16, 9) }, // m3_m7
+            { rational(1), rational(3, 2), rational(15, 8) }  // 5_M7     
         };
 
         std::vector<std::string> n_intervals_str[NUM_SCALES] = { 
@@ -1136,7 +1328,7 @@ struct ji_triad_generator : interval_generator {
             { "Oct", "P5", "M7" }   // 5_M7     
         };
 
-        std::vector<double> octaves {std::vector<double>(11, 2.0)}; 
+        std::vector<rational> octaves {std::vector<rational>(11, rational(2))}; 
         std::vector<double> startFrequencies {std::vector<double>(11, start_freq)}; // G1 
 
         generateFrequencies(m, n_intervals, startFrequencies, octaves);
@@ -1173,18 +1365,18 @@ struct ji_interval_generator : interval_generator {
             "Octave + M7; A0-A8"
         };
 
-        std::vector<double> n_intervals[NUM_SCALES] = { 
-            { 1.0, 16.0/15.0 }, // m2
-            { 1.0, 9.0/8.0 },   // M2
-            { 1.0, 6.0/5.0 },   // m3
-            { 1.0, 5.0/4.0 },   // M3
-            { 1.0, 4.0/3.0 },   // P4
-            { 1.0, 10.0/7.0 },  // d5
-            { 1.0, 3.0/2.0 },   // P5
-            { 1.0, 8.0/5.0 },   // m6
-            { 1.0, 5.0/3.0 },   // M6
-            { 1.0, 16.0/9.0 },  // m7
-            { 1.0, 15.0/8.0 }   // M7
+        std::vector<rational> n_intervals[NUM_SCALES] = { 
+            { rational(1), rational(16, 15) }, // m2
+            { rational(1), rational(9, 8) },   // M2
+            { rational(1), rational(6, 5) },   // m3
+            { rational(1), rational(5, 4) },   // M3
+            { rational(1), rational(4, 3) },   // P4
+            { rational(1), rational(10, 7) },  // d5
+            { rational(1), rational(3, 2) },   // P5
+            { rational(1), rational(8, 5) },   // m6
+            { rational(1), rational(5, 3) },   // M6
+            { rational(1), rational(16, 9) },  // m7
+            { rational(1), rational(15, 8) }   // M7
         };
 
         std::vector<std::string> n_intervals_str[NUM_SCALES] = { 
@@ -1201,7 +1393,7 @@ struct ji_interval_generator : interval_generator {
             { "Oct", "M7" }      
         };
 
-        std::vector<double> octaves {std::vector<double>(11, 2.0)}; 
+        std::vector<rational> octaves {std::vector<rational>(11, rational(2))}; 
         std::vector<double> startFrequencies {std::vector<double>(11, start_freq)}; // A0
 
         generateFrequencies(m, n_intervals, startFrequencies, octaves);
@@ -1560,174 +1752,1874 @@ struct userscale_generator : generator {
 };
 
 
-struct filter {
+// Scales described in a file rather than in code, for --scales.  A file holds
+// any number of scales, one directive per line; # starts a comment.
+//
+//   scale bohlenpierce BP.cpp          classname, and optionally the filename
+//   name Bohlen Pierce
+//   description Justly intoned intervals from the tritave.
+//   start 32.7031956626                default start frequency of each row, Hz
+//   period 3/1                         default interval the rows repeat at
+//   geometry 11 21                     rows, and notes in each; 11 21 if not given
+//   row C, E, H, A; C1- | 1/1:C 9/7:E 9/5:H 7/3:A
+//   row C, F, G, A; C1- | start=65.4 1/1:C 7/5:F 5/3:G 7/3:A
+//   ...
+//
+// Each row gives the scalename, then after the | the row's intervals from the 
+// start frequency, each optionally followed by :notename.  Intervals, and the
+// period, are written as in Scala: p/q or p is a ratio, a number with a '.' 
+// is cents, and n\N is n steps of N equal divisions of the period (of 2/1 for
+// the period itself).  start= and period= override the defaults for one row.
+// The row's notes repeat at the period until the row is full.  Any rows not 
+// given repeat the last one.  If every interval and period is a ratio, the
+// scale is generated exactly, as by the built-in just intonation generators.
+
+struct scaleRow {
+
+    std::string scalename;
+    double start;
+    double period;
+    std::vector<double> intervals;
+    std::vector<std::string> notenames;
+    std::string periodText;             // Both as written
+    std::vector<std::string> intervalText;
 
-    virtual std::string name() = 0;
+};
 
-    double frequencyCut = 20000.0;
-    bool frequencyCutEnabled = true;
-    double lastValid = -1.0;
+// Parse p/q or p as an exact ratio
+bool parseRatio(const char *s, rational &r) {
+    char *end;
+    long p = strtol(s, &end, 10);
+    long q = 1;
+    if (*end == '/') {
+        q = strtol(end + 1, &end, 10);
+    }
+    if (*end || p <= 0 || q <= 0 || end == s) {
+        return false;
+    }
+    r = rational(p, q);
+    return true;
+}
 
-    // Must return coefficients corresponding to the filter-calibrated frequency.
-    // If frequency cut enabled:
-    //   If the requested frequency exceeds the hard cut and valid coefficients have been previously generated, return those coefficients
-    //   If the requested frequency exceeds the hard cut and no valid coefficients have been previously generated, return the coefficients corresponding the to hard cut.
-    std::vector<double> generateCoeffs(double frequency) {
-        if (frequencyCutEnabled) {
-            if (frequency > frequencyCut) {
-                if (lastValid != -1.0) {
-                    return calculate(lastValid);
-                } else {
-                    return calculate(frequencyCut);
+struct data_generator : interval_generator {
+
+    scale base;
+    std::vector<scaleRow> rows;
+
+    scale generateScale() override {
+
+        scale m = base;
+        if (generateExact(m)) {
+            return m;
+        }
+
+        std::vector<std::vector<double>> n_intervals(m.banks);
+        std::vector<std::vector<std::string>> n_intervals_str(m.banks);
+        std::vector<double> startFrequencies;
+        std::vector<double> octaves;
+
+        for (int scaleIdx = 0; scaleIdx < m.banks; scaleIdx++) {
+            scaleRow &r = rows[std::min(scaleIdx, (int)rows.size() - 1)];
+            m.scalename[scaleIdx] = r.scalename;
+            n_intervals[scaleIdx] = r.intervals;
+            n_intervals_str[scaleIdx] = r.notenames;
+            startFrequencies.push_back(r.start);
+            octaves.push_back(r.period);
+        }
+
+        generateFrequencies(m, n_intervals.data(), startFrequencies, octaves);
+        generateNames(m, n_intervals_str.data());
+
+        return m;
+
+    };
+
+    // If every interval and period is a ratio, generate the scale exactly
+    bool generateExact(scale &m) {
+
+        std::vector<std::vector<rational>> n_intervals(m.banks);
+        std::vector<std::vector<std::string>> n_intervals_str(m.banks);
+        std::vector<double> startFrequencies;
+        std::vector<rational> octaves;
+
+        for (int scaleIdx = 0; scaleIdx < m.banks; scaleIdx++) {
+            scaleRow &r = rows[std::min(scaleIdx, (int)rows.size() - 1)];
+            rational period;
+            if (!parseRatio(r.periodText.c_str(), period)) {
+                return false;
+            }
+            for (auto &t: r.intervalText) {
+                rational v;
+                if (!parseRatio(t.c_str(), v)) {
+                    return false;
                 }
-            } else {
-                lastValid = frequency;
-                return calculate(frequency);
+                n_intervals[scaleIdx].push_back(v);
             }
-        } else {
-            return calculate(frequency);
+            m.scalename[scaleIdx] = r.scalename;
+            n_intervals_str[scaleIdx] = r.notenames;
+            startFrequencies.push_back(r.start);
+            octaves.push_back(period);
         }
-    }
 
-    virtual std::vector<double> calculate(double frequency) = 0;
+        generateFrequencies(m, n_intervals.data(), startFrequencies, octaves);
+        generateNames(m, n_intervals_str.data());
 
-};
+        return true;
 
-struct maxq_filter : filter {
+    };
 
-    int sampleRate = 96000;
+};
 
-    std::string name() override {
-        return "maxq" + std::to_string(sampleRate);
+// Parse a Scala style interval, see above; n\N is taken as steps of period
+bool parseInterval(const char *s, double period, double &value) {
+    char *end;
+    if (strchr(s, '\\')) {
+        long n = strtol(s, &end, 10);
+        if (*end != '\\') {
+            return false;
+        }
+        long divs = strtol(end + 1, &end, 10);
+        if (*end || divs <= 0) {
+            return false;
+        }
+        value = pow(period, n / (double)divs);
+    } else if (strchr(s, '.')) {
+        double cents = strtod(s, &end);
+        if (*end) {
+            return false;
+        }
+        value = pow(2.0, cents / 1200.0);
+    } else {
+        rational r;
+        if (!parseRatio(s, r)) {
+            return false;
+        }
+        value = r.num / (double)r.den;
     }
+    return value > 0.0 && isfinite(value);
+}
 
-    std::vector<double> calculate(double frequency) override {
-        std::vector<double> v;
-        v.push_back(2.0 * PI * calibrateFrequency(frequency) / (double)sampleRate);
-        return v;
+bool validIdentifier(std::string const &s) {
+    if (s.empty() || isdigit((unsigned char)s[0])) {
+        return false;
+    }
+    for (char c: s) {
+        if (!isalnum((unsigned char)c) && c != '_') {
+            return false;
+        }
     }
+    return true;
+}
 
-    double calibrateFrequency(double frequency) {
-        return frequency;
+// Read the scales in path, reporting the first error as file:line
+bool loadScales(std::string const &path, std::vector<std::unique_ptr<data_generator>> &scales) {
+
+    std::ifstream in(path);
+    if (!in) {
+        std::cerr << path << ": cannot open" << std::endl;
+        return false;
     }
 
-};
+    std::string line;
+    int lineNo = 0;
+    data_generator *cur = nullptr;
+    double start = 0.0;
+    double period = 2.0;
+    std::string periodText = "2/1";
+    std::string error;
+
+    // Check the scale just finished
+    auto finish = [&]() {
+        if (cur && cur->rows.empty()) {
+            error = "scale " + cur->base.classname + " has no rows";
+        }
+        return error.empty();
+    };
 
-struct bpre_filter : filter {
+    while (error.empty() && std::getline(in, line)) {
+        lineNo++;
 
-    int Qval = 800;
-  	double gain_q = 40;
-    int sampleRate = 96000;
+        size_t hash = line.find('#');
+        if (hash != std::string::npos) {
+            line.erase(hash);
+        }
+        size_t b = line.find_first_not_of(" \t\r");
+        if (b == std::string::npos) {
+            continue;
+        }
+        size_t e = line.find_first_of(" \t\r", b);
+        std::string key = line.substr(b, e - b);
+        size_t vb = e == std::string::npos ? e : line.find_first_not_of(" \t\r", e);
+        std::string value = vb == std::string::npos ? "" : line.substr(vb, line.find_last_not_of(" \t\r") + 1 - vb);
+
+        if (key == "scale") {
+            if (!finish()) {
+                break;
+            }
+            std::istringstream words(value);
+            scales.emplace_back(new data_generator());
+            cur = scales.back().get();
+            words >> cur->base.classname >> cur->base.filename;
+            if (!validIdentifier(cur->base.classname)) {
+                error = "bad classname '" + cur->base.classname + "'";
+            }
+            if (cur->base.filename.empty()) {
+                cur->base.filename = cur->base.classname + ".cpp";
+            }
+            start = 0.0;
+            period = 2.0;
+            periodText = "2/1";
+        } else if (!cur) {
+            error = "expected scale";
+        } else if (key == "name") {
+            cur->base.name = value;
+        } else if (key == "description") {
+            cur->base.description = value;
+        } else if (key == "start") {
+            char *end;
+            start = strtod(value.c_str(), &end);
+            if (*end || start <= 0.0) {
+                error = "bad start frequency '" + value + "'";
+            }
+        } else if (key == "period") {
+            if (!parseInterval(value.c_str(), 2.0, period)) {
+                error = "bad period '" + value + "'";
+            }
+            periodText = value;
+        } else if (key == "geometry") {
+            int banks = 0, notes = 0;
+            std::istringstream words(value);
+            words >> banks >> notes;
+            if (banks < 1 || notes < 1 || !cur->rows.empty()) {
+                error = "bad geometry '" + value + "', or not before the rows";
+            } else {
+                cur->base.resize(banks, notes);
+            }
+        } else if (key == "row") {
+            size_t bar = value.find('|');
+            if (bar == std::string::npos) {
+                error = "expected | in row";
+                break;
+            }
+            if (cur->rows.size() == cur->base.banks) {
+                error = "more than " + std::to_string(cur->base.banks) + " rows";
+                break;
+            }
 
-    std::string name() override {
-        return "bpre" + std::to_string(sampleRate) + "" + std::to_string(Qval) + "" + std::to_string((int)gain_q);
+            scaleRow r;
+            r.scalename = value.substr(0, value.find_last_not_of(" \t", bar - 1) + 1);
+            r.start = start;
+            r.period = period;
+            r.periodText = periodText;
+
+            std::istringstream words(value.substr(bar + 1));
+            std::string w;
+            bool named = false;
+            while (error.empty() && words >> w) {
+                if (w.compare(0, 6, "start=") == 0) {
+                    char *end;
+                    r.start = strtod(w.c_str() + 6, &end);
+                    if (*end || r.start <= 0.0) {
+                        error = "bad start frequency '" + w + "'";
+                    }
+                } else if (w.compare(0, 7, "period=") == 0) {
+                    if (!parseInterval(w.c_str() + 7, 2.0, r.period)) {
+                        error = "bad period '" + w + "'";
+                    }
+                    r.periodText = w.substr(7);
+                } else {
+                    size_t colon = w.find(':');
+                    std::string note = colon == std::string::npos ? "" : w.substr(colon + 1);
+                    double v;
+                    if (!parseInterval(w.substr(0, colon).c_str(), r.period, v)) {
+                        error = "bad interval '" + w + "'";
+                    }
+                    named = named || !note.empty();
+                    r.intervals.push_back(v);
+                    r.intervalText.push_back(w.substr(0, colon));
+                    r.notenames.push_back(note);
+                }
+            }
+
+            if (error.empty()) {
+                if (r.intervals.empty() || r.intervals.size() > cur->base.notes) {
+                    error = "a row needs 1 to " + std::to_string(cur->base.notes) + " intervals";
+                } else if (r.start <= 0.0) {
+                    error = "no start frequency";
+                }
+            }
+            if (!named) {
+                r.notenames.clear();
+            }
+            cur->rows.push_back(r);
+        } else {
+            error = "unknown directive '" + key + "'";
+        }
     }
 
-    std::vector<double> calculate(double frequency) override {
+    if (error.empty()) {
+        finish();
+    }
+    if (!error.empty()) {
+        std::cerr << path << ":" << lineNo << ": " << error << std::endl;
+        return false;
+    }
+    return true;
 
-	    char str[80];
-      	char *desc;
+}
 
-        double f = calibrateFrequency(frequency);
+// Scala tunings, for --scl.  A .scl file lists the pitches of one period of
+// a scale after 1/1, the last being the period; a .kbm file maps MIDI keys 
+// onto its degrees and fixes the frequency of one key.  The scale's rows are 
+// the mapped keys from the keyboard's middle note upward, each row starting
+// one key higher than the last.  Without a .kbm, degree 0 is C1 and every
+// degree is mapped.
 
-        sprintf(str, "BpRe/%d/%g", Qval, f);
+struct scalaTuning {
 
-        FidFilter *filt = fid_design(str, sampleRate, 0, 0, 0, &desc);
-        filt = FFNEXT(filt);
+    std::string description;
+    std::vector<double> pitch;          // Degrees 0 to n - 1, then the period
+    std::vector<std::string> text;      // Each as written, for the note names
 
-        int len = filt->len;
+};
 
-        double gain_adj = fid_response(filt, f / (double)sampleRate);
-        gain_adj = gain_q / gain_adj;
+struct keyboardMap {
 
-        std::vector<double> v;
-        v.push_back(gain_adj);
-        v.push_back(filt->val[2]);
-        v.push_back(filt->val[1]);
+    int first = 0;
+    int last = 127;
+    int middle = 24;
+    int reference = 24;
+    double frequency = 32.7031956626;   // C1
+    int octave = 0;                     // Degree of the formal octave, or 0 for the period
+    std::vector<int> map;               // Degree of each key, -1 if unmapped, or empty for linear
 
-        return v;
+};
 
+// Next line of a Scala file that isn't a comment
+bool scalaLine(std::istream &in, std::string &line) {
+    while (std::getline(in, line)) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (line.empty() || line[0] != '!') {
+            return true;
+        }
     }
+    return false;
+}
 
-    double calibrateFrequency(double f) {
-        return f;
+// First word of the next line of a Scala file
+bool scalaValue(std::istream &in, std::string &word) {
+    std::string line;
+    if (!scalaLine(in, line)) {
+        return false;
+    }
+    std::istringstream words(line);
+    return (bool)(words >> word);
+}
+
+bool readScala(std::string const &path, scalaTuning &t, std::string &error) {
+    std::ifstream in(path);
+    if (!in) {
+        error = "cannot open";
+        return false;
     }
 
-};
+    std::string count;
+    if (!scalaLine(in, t.description) || !scalaValue(in, count)) {
+        error = "missing description or note count";
+        return false;
+    }
+    int n = atoi(count.c_str());
+    if (n < 1 || n > 1024) {
+        error = "bad note count '" + count + "'";
+        return false;
+    }
 
-void procCoeff(std::ostream &f, scale s, filter *filt, int idx, bool isLast) {
-    std::vector<double> coeffs = filt->generateCoeffs(s.frequency[idx]);
-    if (coeffs.size() == 1) {
-        if (isLast) {
-            f << "\t\t" << coeffs[0] << std::endl;
-        } else {
-            f << "\t\t" << coeffs[0] << "," << std::endl;
+    t.pitch.assign(1, 1.0);
+    t.text.assign(1, "1/1");
+    for (int i = 0; i < n; i++) {
+        std::string word;
+        double p;
+        if (!scalaValue(in, word)) {
+            error = "expected " + std::to_string(n) + " pitches";
+            return false;
         }
-    } else {
-        f << "\t\t{ ";
-        for (int cidx = 0; cidx < coeffs.size() - 1; cidx++) {
-            f << coeffs[cidx] << ", ";
+        if (!parseInterval(word.c_str(), 2.0, p)) {
+            error = "bad pitch '" + word + "'";
+            return false;
         }
-        if (isLast) {
-            f << coeffs[coeffs.size() - 1] << " }";
-        } else {
-            f << coeffs[coeffs.size() - 1] << " },";
+        t.pitch.push_back(p);
+        t.text.push_back(word);
+    }
+    if (t.pitch.back() <= 1.0) {
+        error = "period must be above 1/1";
+        return false;
+    }
+    return true;
+}
+
+bool readKbm(std::string const &path, keyboardMap &k, std::string &error) {
+    std::ifstream in(path);
+    if (!in) {
+        error = "cannot open";
+        return false;
+    }
+
+    std::string v[7];
+    for (int i = 0; i < 7; i++) {
+        if (!scalaValue(in, v[i])) {
+            error = "expected 7 header values";
+            return false;
         }
-        f << std::endl;
     }
+    int size = atoi(v[0].c_str());
+    k.first = atoi(v[1].c_str());
+    k.last = atoi(v[2].c_str());
+    k.middle = atoi(v[3].c_str());
+    k.reference = atoi(v[4].c_str());
+    k.frequency = atof(v[5].c_str());
+    k.octave = atoi(v[6].c_str());
+    if (size < 0 || k.frequency <= 0.0 || k.first > k.last) {
+        error = "bad header";
+        return false;
+    }
+
+    k.map.clear();
+    for (int i = 0; i < size; i++) {
+        std::string word;
+        if (!scalaValue(in, word)) {
+            error = "expected " + std::to_string(size) + " keys";
+            return false;
+        }
+        k.map.push_back(word == "x" ? -1 : atoi(word.c_str()));
+    }
+    return true;
 }
 
-void procFilter(std::ostream &f, scale s, filter *filt, bool isLast = false) {
-    f << std::setprecision(16);
-    f << "\t.c_" << filt->name() << " = {" << std::endl;
-    for (int idx = 0; idx < 230; idx++) {
-        procCoeff(f, s, filt, idx, false);
+// Frequency ratio of a key to the middle note, or 0 if the key is unmapped
+double keyRatio(scalaTuning const &t, keyboardMap const &k, int key) {
+    int n = t.pitch.size() - 1;
+    int offset = key - k.middle;
+    int degree = offset;
+    if (!k.map.empty()) {
+        int size = k.map.size();
+        int idx = ((offset % size) + size) % size;
+        if (k.map[idx] < 0) {
+            return 0.0;
+        }
+        degree = k.map[idx] + (offset - idx) / size * (k.octave ? k.octave : n);
     }
-    procCoeff(f, s, filt, 230, true);
-    if (isLast) {
-        f << "\t}" << std::endl;
-    } else {
-        f << "\t}," << std::endl;
+    int idx = ((degree % n) + n) % n;
+    return pow(t.pitch[n], (degree - idx) / n) * t.pitch[idx];
+}
+
+// Degree of a key, for its note name
+int keyDegree(scalaTuning const &t, keyboardMap const &k, int key) {
+    int n = t.pitch.size() - 1;
+    int offset = key - k.middle;
+    int degree = offset;
+    if (!k.map.empty()) {
+        int size = k.map.size();
+        degree = k.map[((offset % size) + size) % size];
     }
+    return ((degree % n) + n) % n;
 }
 
-int main() {
+bool scalaScale(std::string const &path, keyboardMap const &k, scale &m, std::string &error) {
 
-    std::vector<generator *> generators;
-    std::vector<filter *> filters;
+    int needed = m.banks + m.notes - 1;
 
-    video_generator video = {};
-    generators.push_back(&video);
+    scalaTuning t;
+    if (!readScala(path, t, error)) {
+        return false;
+    }
 
-    bp_generator bp = {};
-    generators.push_back(&bp);
+    double ref = keyRatio(t, k, k.reference);
+    if (ref == 0.0) {
+        error = "reference key is unmapped";
+        return false;
+    }
 
-    gamelan_generator gamelan = {};
-    generators.push_back(&gamelan);
+    std::vector<double> freqs;
+    std::vector<std::string> names;
+    for (int key = std::max(k.middle, k.first); key <= k.last && freqs.size() < needed; key++) {
+        double r = keyRatio(t, k, key);
+        if (r != 0.0) {
+            freqs.push_back(k.frequency * r / ref);
+            names.push_back(t.text[keyDegree(t, k, key)]);
+        }
+    }
+    if (freqs.size() < needed) {
+        error = "fewer than " + std::to_string(needed) + " mapped keys";
+        return false;
+    }
 
-    b296_generator b296 = {};
-    generators.push_back(&b296);
+    m.name = std::filesystem::path(path).stem().string();
+    m.description = t.description;
+    for (int scaleIdx = 0; scaleIdx < m.banks; scaleIdx++) {
+        std::ostringstream row;
+        row << m.name << "; " << std::fixed << std::setprecision(2) << freqs[scaleIdx] << "Hz-";
+        m.scalename[scaleIdx] = row.str();
+        for (int noteIdx = 0; noteIdx < m.notes; noteIdx++) {
+            m.frequency[scaleIdx * m.notes + noteIdx] = freqs[scaleIdx + noteIdx];
+            m.notename[scaleIdx * m.notes + noteIdx] = names[scaleIdx + noteIdx];
+        }
+    }
+    return true;
 
-    shrutis_generator shrutis = {};
-    generators.push_back(&shrutis);
+}
 
-    mesopotamian_generator mesopotamian = {};
-    generators.push_back(&mesopotamian);
+// A Scala tuning, read from its file each time it is generated so that a
+// large library needn't be held in memory
+struct scala_generator : generator {
 
-    alphaspread1_generator alpha1 = {};
-    generators.push_back(&alpha1);
+    std::string path;
+    keyboardMap const *kbm;
+    std::string classname;
+    int banks;
+    int notes;
+    scaleSummary summary;
 
-    alphaspread2_generator alpha2 = {};
-    generators.push_back(&alpha2);
+    scale generateScale() override {
+        scale m;
+        m.resize(banks, notes);
+        std::string error;
+        if (!scalaScale(path, *kbm, m, error)) {
+            std::cerr << path << ": " << error << std::endl;
+        }
+        m.classname = classname;
+        m.filename = classname + ".cpp";
+        return m;
+    };
 
-    gammaspread_generator gamma_spread = {};
-    generators.push_back(&gamma_spread);
+    // Taken when the file was imported, so choosing scales doesn't read it
+    // again
+    scaleSummary summarize(double) override {
+        return summary;
+    }
 
-    gamma_generator gamma = {};
-    generators.push_back(&gamma);
-    
-    et17_generator et17 = {};
-    generators.push_back(&et17);
+};
+
+// Find the .scl files named in paths, searching directories, and make a 
+// generator for each that maps onto a scale.  Those that don't are skipped
+// with a warning.  Each is summarized against cut as it is read.
+void importScala(std::vector<std::string> const &paths, keyboardMap const &kbm, int banks, int notes,
+    double cut, std::vector<std::unique_ptr<scala_generator>> &scales) {
+
+    std::vector<std::string> files;
+    for (auto &p: paths) {
+        if (std::filesystem::is_directory(p)) {
+            std::vector<std::string> found;
+            for (auto &e: std::filesystem::recursive_directory_iterator(p)) {
+                if (e.is_regular_file() && e.path().extension() == ".scl") {
+                    found.push_back(e.path().string());
+                }
+            }
+            std::sort(found.begin(), found.end());
+            files.insert(files.end(), found.begin(), found.end());
+        } else {
+            files.push_back(p);
+        }
+    }
+
+    std::map<std::string, int> used;
+    for (auto &f: files) {
+        scale m;
+        m.resize(banks, notes);
+        std::string error;
+        if (!scalaScale(f, kbm, m, error)) {
+            std::cerr << f << ": " << error << ", skipped" << std::endl;
+            continue;
+        }
+
+        std::string classname = "scl_" + m.name;
+        for (char &c: classname) {
+            if (!isalnum((unsigned char)c)) {
+                c = '_';
+            }
+        }
+        if (used[classname]++) {
+            classname += "_" + std::to_string(used[classname]);
+        }
+
+        scala_generator *g = new scala_generator();
+        g->path = f;
+        g->kbm = &kbm;
+        g->classname = classname;
+        g->banks = banks;
+        g->notes = notes;
+        g->summary = { classname, classname + ".cpp", banks, notes, -1.0 };
+        for (double freq: m.frequency) {
+            if (freq <= cut) {
+                g->summary.lastBelow = freq;
+            }
+        }
+        scales.emplace_back(g);
+    }
+
+}
+
+
+// Designs shared between the sample rate variants of a filter, keyed on 
+// whatever determines the design, normalised to the sample rate, so that a
+// note at 96k shares the design of one an octave lower at 48k
+struct designShare {
+
+    // Bounded like filter::cache, as a whole library of scales feeds it
+    std::mutex lock;
+    std::map<std::pair<double, double>, std::vector<double>> designs;
+    size_t designLimit = 1 << 16;
+
+    bool find(std::pair<double, double> const &key, std::vector<double> &v) {
+        std::lock_guard<std::mutex> guard(lock);
+        auto it = designs.find(key);
+        if (it == designs.end()) {
+            return false;
+        }
+        v = it->second;
+        return true;
+    }
+
+    void add(std::pair<double, double> const &key, std::vector<double> const &v) {
+        std::lock_guard<std::mutex> guard(lock);
+        if (designs.size() >= designLimit) {
+            designs.clear();
+        }
+        designs.emplace(key, v);
+    }
+
+};
+
+// The designShare for each family of filters, by name
+struct designShares {
+
+    std::mutex lock;
+    std::map<std::string, designShare> families;
+
+    designShare *get(std::string const &family) {
+        std::lock_guard<std::mutex> guard(lock);
+        return &families[family];
+    }
+
+};
+
+struct filter {
+
+    virtual std::string name() = 0;
+
+    double frequencyCut = 20000.0;
+    bool frequencyCutEnabled = true;
+    double lastValid = -1.0;
+
+    // Design at full precision rather than as in the scale tables, where the 
+    // frequency may be rounded when passed to fidlib
+    bool exact = false;
+
+    // Must return coefficients corresponding to the filter-calibrated frequency.
+    // If frequency cut enabled:
+    //   If the requested frequency exceeds the hard cut and valid coefficients have been previously generated, return those coefficients
+    //   If the requested frequency exceeds the hard cut and no valid coefficients have been previously generated, return the coefficients corresponding the to hard cut.
+    std::vector<double> generateCoeffs(double frequency) {
+        if (frequencyCutEnabled) {
+            if (frequency > frequencyCut) {
+                if (lastValid != -1.0) {
+                    return cachedCalculate(lastValid);
+                } else {
+                    return cachedCalculate(frequencyCut);
+                }
+            } else {
+                lastValid = frequency;
+                return cachedCalculate(frequency);
+            }
+        } else {
+            return cachedCalculate(frequency);
+        }
+    }
+
+    // Scales share many frequencies (octaves, common roots, everything above 
+    // the cut), so keep the designs made for the tables, up to cacheLimit of 
+    // them so that memory stays bounded over a large library of scales
+    std::map<double, std::vector<double>> cache;
+    size_t cacheLimit = 1 << 16;
+    long designs = 0;
+    long cacheHits = 0;
+
+    // Designs from the other sample rates, if set (see designKey)
+    designShare *share = nullptr;
+
+    std::vector<double> const &cachedCalculate(double frequency) {
+        auto it = cache.find(frequency);
+        if (it != cache.end()) {
+            cacheHits++;
+            return it->second;
+        }
+        if (cache.size() >= cacheLimit) {
+            cache.clear();
+        }
+        std::vector<double> &v = cache[frequency];
+        std::pair<double, double> key;
+        bool shared = share && designKey(frequency, key);
+        if (shared && share->find(key, v)) {
+            cacheHits++;
+            return v;
+        }
+        designs++;
+        v = calculate(frequency);
+        if (shared) {
+            share->add(key, v);
+        }
+        return v;
+    }
+
+    // The values, independent of sample rate, that calculate() depends on; 
+    // false if it isn't worth sharing the design
+    virtual bool designKey(double frequency, std::pair<double, double> &key) {
+        return false;
+    }
+
+    // The name shared by all sample rates of this filter
+    virtual std::string family() = 0;
+
+    virtual std::vector<double> calculate(double frequency) = 0;
+
+    // A fidlib spec and rate whose fid_design_coef() coefficients are 
+    // calculate()'s after the gain, for --kernels; false if there are none
+    virtual bool kernelSpec(std::string &spec, int &rate) {
+        return false;
+    }
+
+    // For the interpolation tables (see procInterp), the error of approximate 
+    // coefficients against those from calculate(), in units of interpErrorUnit().
+    // Tables are refined until the error is within interpTolerance.
+    double interpTolerance = 0.01;
+    virtual double interpError(double frequency, std::vector<double> const &approx) = 0;
+    virtual std::string interpErrorUnit() = 0;
+
+};
+
+struct maxq_filter : filter {
+
+    int sampleRate = 96000;
+
+    std::string name() override {
+        return "maxq" + std::to_string(sampleRate);
+    }
+
+    std::string family() override {
+        return "maxq";
+    }
+
+    std::vector<double> calculate(double frequency) override {
+        std::vector<double> v;
+        v.push_back(2.0 * PI * calibrateFrequency(frequency) / (double)sampleRate);
+        return v;
+    }
+
+    double calibrateFrequency(double frequency) {
+        return frequency;
+    }
+
+    // The coefficient is proportional to the tuned frequency, so measure the 
+    // error as a detuning
+    double interpError(double frequency, std::vector<double> const &approx) override {
+        std::vector<double> exact = calculate(frequency);
+        return fabs(1200.0 * log2(approx[0] / exact[0]));
+    }
+
+    std::string interpErrorUnit() override {
+        return "cents";
+    }
+
+};
+
+// Section structures the resonator tables can be emitted in, indexed by 
+// FID_FORM_*; the direct form has no suffix on the table name
+const char *formNames[] = { "auto", "direct", "coupled", "svf" };
+
+struct bpre_filter : filter {
+
+    int Qval = 800;
+  	double gain_q = 40;
+    int sampleRate = 96000;
+
+    // FID_FORM_DIRECT gives { gain, val[2], val[1] }, the others the five 
+    // coefficients of fid_section_coef(), with the gain folded into the 
+    // last three
+    int form = FID_FORM_DIRECT;
+
+    bpre_filter() {
+        interpTolerance = 0.05;
+    }
+
+    std::string formSuffix() {
+        return form == FID_FORM_DIRECT ? "" : std::string("_") + formNames[form];
+    }
+
+    std::string name() override {
+        return "bpre" + std::to_string(sampleRate) + "" + std::to_string(Qval) + "" + std::to_string((int)gain_q) + formSuffix();
+    }
+
+    std::string family() override {
+        return "bpre" + std::to_string(Qval) + "_" + std::to_string((int)gain_q) + formSuffix();
+    }
+
+    // fidlib designs the resonator from the spec's frequency over the sample
+    // rate, and the gain is measured at the exact frequency over the rate
+    bool designKey(double frequency, std::pair<double, double> &key) override {
+        double f = calibrateFrequency(frequency);
+        std::string str = spec(f);
+        key.first = strtod(str.c_str() + str.rfind('/') + 1, 0) / sampleRate;
+        key.second = f / (double)sampleRate;
+        return true;
+    }
+
+    std::vector<double> calculate(double frequency) override {
+
+        double f = calibrateFrequency(frequency);
+
+        FidFilter *filt = design(f);
+        FidFilter *iir = FFNEXT(filt);
+
+        double gain_adj = fid_response(iir, f / (double)sampleRate);
+        gain_adj = gain_q / gain_adj;
+
+        std::vector<double> v;
+        if (form == FID_FORM_DIRECT) {
+            v.push_back(gain_adj);
+            v.push_back(iir->val[2]);
+            v.push_back(iir->val[1]);
+        } else {
+            FidFilter *fir = FFNEXT(iir);
+            double c[5];
+            if (!fid_section_coef(iir->val, iir->len, fir->val, fir->len, form, c)) {
+                std::cerr << spec(f) << " has no " << formNames[form] << " form" << std::endl;
+                exit(1);
+            }
+            double g = filt->val[0] * gain_adj;
+            v = { c[0], c[1], c[2] * g, c[3] * g, c[4] * g };
+        }
+
+        free(filt);
+        return v;
+
+    }
+
+    bool kernelSpec(std::string &str, int &rate) override {
+        str = spec(1000.0);
+        rate = sampleRate;
+        return form == FID_FORM_DIRECT;
+    }
+
+    std::string spec(double f) {
+
+	    char str[80];
+
+        if (exact) {
+            sprintf(str, "BpRe/%d/%.17g", Qval, f);
+        } else {
+            sprintf(str, "BpRe/%d/%g", Qval, f);
+        }
+        return str;
+
+    }
+
+    FidFilter *design(double f) {
+
+      	char *desc;
+        std::string str = spec(f);
+
+        FidFilter *filt = fid_design(&str[0], sampleRate, 0, 0, 0, &desc);
+        free(desc);
+        return filt;
+
+    }
+
+    double calibrateFrequency(double f) {
+        return f;
+    }
+
+    // Compare the gain of the approximate and exact filters at the centre 
+    // frequency and the -3dB points either side, where a shift in the peak
+    // is most audible.
+    double interpError(double frequency, std::vector<double> const &approx) override {
+
+        double f = calibrateFrequency(frequency);
+        std::vector<double> exact = calculate(frequency);
+
+        FidFilter *filt = design(f);
+        FidFilter *iir = FFNEXT(filt);
+
+        double probes[3] = { f, f * (1.0 - 0.5 / Qval), f * (1.0 + 0.5 / Qval) };
+        double exactResp[3];
+        for (int i = 0; i < 3; i++) {
+            exactResp[i] = exact[0] * fid_response(iir, probes[i] / (double)sampleRate);
+        }
+
+        iir->val[2] = approx[1];
+        iir->val[1] = approx[2];
+
+        double err = 0.0;
+        for (int i = 0; i < 3; i++) {
+            double resp = approx[0] * fid_response(iir, probes[i] / (double)sampleRate);
+            err = std::max(err, fabs(20.0 * log10(resp / exactResp[i])));
+        }
+
+        free(filt);
+        return err;
+
+    }
+
+    std::string interpErrorUnit() override {
+        return "dB";
+    }
+
+};
+
+void procCoeff(std::ostream &f, scale const &s, filter *filt, int idx, bool isLast) {
+    std::vector<double> coeffs = filt->generateCoeffs(s.frequency[idx]);
+    if (coeffs.size() == 1) {
+        if (isLast) {
+            f << "\t\t" << coeffs[0] << std::endl;
+        } else {
+            f << "\t\t" << coeffs[0] << "," << std::endl;
+        }
+    } else {
+        f << "\t\t{ ";
+        for (int cidx = 0; cidx < coeffs.size() - 1; cidx++) {
+            f << coeffs[cidx] << ", ";
+        }
+        if (isLast) {
+            f << coeffs[coeffs.size() - 1] << " }";
+        } else {
+            f << coeffs[coeffs.size() - 1] << " },";
+        }
+        f << std::endl;
+    }
+}
+
+void procFilter(std::ostream &f, scale const &s, filter *filt, bool isLast = false) {
+    f << std::setprecision(16);
+    f << "\t.c_" << filt->name() << " = {" << std::endl;
+    int last = s.frequency.size() - 1;
+    for (int idx = 0; idx < last; idx++) {
+        procCoeff(f, s, filt, idx, false);
+    }
+    procCoeff(f, s, filt, last, true);
+    if (isLast) {
+        f << "\t}" << std::endl;
+    } else {
+        f << "\t}," << std::endl;
+    }
+}
+
+// Interpolation tables for continuous tuning.  Each filter is sampled on a
+// grid of equal segments in log-frequency, INTERP_OCTAVES octaves up to the 
+// frequency cut, and each coefficient is approximated in each segment by a 
+// cubic in t, the fractional position through the segment:
+//
+//   c = c0 + t * (c1 + t * (c2 + t * c3))
+//
+// The cubic passes through the exact coefficients at t = 0, 1/3, 2/3 and 1,
+// so the tables are continuous across segment boundaries.  Starting from one
+// segment per octave, the resolution is doubled until interpError() is 
+// within the filter's interpTolerance at INTERP_CHECKS points inside every 
+// segment.
+
+const int INTERP_OCTAVES = 11;
+const int INTERP_CHECKS = 16;
+const int INTERP_MAX_SEGMENTS = 256;
+
+struct interpolation {
+
+    double minFrequency;
+    int segmentsPerOctave;
+    double maxError;
+    std::vector<std::vector<std::array<double,4>>> c; // [segment][coefficient]
+
+};
+
+// Power-basis coefficients of the cubic through v at t = 0, 1/3, 2/3, 1
+std::array<double,4> fitCubic(double v0, double v1, double v2, double v3) {
+    std::array<double,4> c;
+    c[0] = v0;
+    c[1] = (-11.0 * v0 + 18.0 * v1 - 9.0 * v2 + 2.0 * v3) / 2.0;
+    c[2] = 9.0 * (2.0 * v0 - 5.0 * v1 + 4.0 * v2 - v3) / 2.0;
+    c[3] = 9.0 * (-v0 + 3.0 * v1 - 3.0 * v2 + v3) / 2.0;
+    return c;
+}
+
+double evalCubic(std::array<double,4> const &c, double t) {
+    return c[0] + t * (c[1] + t * (c[2] + t * c[3]));
+}
+
+interpolation buildInterp(filter *filt) {
+
+    interpolation in;
+    filt->exact = true;
+    in.minFrequency = filt->frequencyCut / pow(2.0, INTERP_OCTAVES);
+
+    for (int spo = 1; ; spo *= 2) {
+
+        int nSeg = INTERP_OCTAVES * spo;
+        std::vector<std::vector<double>> nodes;
+        for (int i = 0; i <= 3 * nSeg; i++) {
+            nodes.push_back(filt->calculate(in.minFrequency * pow(2.0, i / (3.0 * spo))));
+        }
+
+        in.segmentsPerOctave = spo;
+        in.maxError = 0.0;
+        in.c.clear();
+
+        for (int seg = 0; seg < nSeg; seg++) {
+            std::vector<std::array<double,4>> sc;
+            for (int k = 0; k < nodes[0].size(); k++) {
+                sc.push_back(fitCubic(nodes[3 * seg][k], nodes[3 * seg + 1][k], 
+                    nodes[3 * seg + 2][k], nodes[3 * seg + 3][k]));
+            }
+            for (int j = 0; j < INTERP_CHECKS; j++) {
+                double t = (j + 0.5) / INTERP_CHECKS;
+                std::vector<double> approx;
+                for (int k = 0; k < sc.size(); k++) {
+                    approx.push_back(evalCubic(sc[k], t));
+                }
+                double f = in.minFrequency * pow(2.0, (seg + t) / spo);
+                in.maxError = std::max(in.maxError, filt->interpError(f, approx));
+            }
+            in.c.push_back(sc);
+        }
+
+        if (in.maxError <= filt->interpTolerance) {
+            break;
+        }
+        if (spo >= INTERP_MAX_SEGMENTS) {
+            std::cerr << "Warning: " << filt->name() << " interpolation error " << in.maxError << 
+                " " << filt->interpErrorUnit() << " exceeds tolerance" << std::endl;
+            break;
+        }
+
+    }
+
+    filt->exact = false;
+    return in;
+
+}
+
+void procInterp(std::ostream &f, filter *filt) {
+
+    interpolation in = buildInterp(filt);
+
+    int nSeg = in.c.size();
+    int nCoeff = in.c[0].size();
+
+    f << std::setprecision(16);
+    f << "// " << nSeg << " segments, " << in.segmentsPerOctave << " per octave; max error " << 
+        std::setprecision(3) << in.maxError << " " << filt->interpErrorUnit() << std::endl;
+    f << std::setprecision(16);
+    f << "static const double c_" << filt->name() << "[" << nSeg << "][" << nCoeff << "][4] = {" << std::endl;
+    for (int seg = 0; seg < nSeg; seg++) {
+        f << "\t{ ";
+        for (int k = 0; k < nCoeff; k++) {
+            std::array<double,4> const &c = in.c[seg][k];
+            f << "{ " << c[0] << ", " << c[1] << ", " << c[2] << ", " << c[3] << " }";
+            if (k != nCoeff - 1) {
+                f << ", ";
+            }
+        }
+        if (seg != nSeg - 1) {
+            f << " }," << std::endl;
+        } else {
+            f << " }" << std::endl;
+        }
+    }
+    f << "};" << std::endl;
+    f << "InterpTable interp_" << filt->name() << " = {" << std::endl;
+    f << "\t.minFrequency = " << in.minFrequency << "," << std::endl;
+    f << "\t.segmentsPerOctave = " << in.segmentsPerOctave << "," << std::endl;
+    f << "\t.segments = " << nSeg << "," << std::endl;
+    f << "\t.coeffs = " << nCoeff << "," << std::endl;
+    f << "\t.c = &c_" << filt->name() << "[0][0][0]" << std::endl;
+    f << "};" << std::endl << std::endl;
+
+}
+
+void writeInterp(std::vector<filter *> &filters, std::string const &dir) {
+
+    std::ofstream header;
+    header.open(dir + "/Interpolation.hpp");
+
+    header << "#pragma once" << std::endl << std::endl;
+    header << "// Generated coefficient interpolation tables; see procInterp() in build.cpp" << std::endl;
+    header << "struct InterpTable {" << std::endl;
+    header << "\tdouble minFrequency;" << std::endl;
+    header << "\tint segmentsPerOctave;" << std::endl;
+    header << "\tint segments;" << std::endl;
+    header << "\tint coeffs;" << std::endl;
+    header << "\tconst double *c;" << std::endl;
+    header << std::endl;
+    header << "\t// Coefficients at 'octaves' above minFrequency (e.g. a V/oct pitch)" << std::endl;
+    header << "\tvoid lookup(double octaves, double *out) const {" << std::endl;
+    header << "\t\tdouble x = octaves * segmentsPerOctave;" << std::endl;
+    header << "\t\tif (x < 0.0) x = 0.0;" << std::endl;
+    header << "\t\tint seg = (int)x;" << std::endl;
+    header << "\t\tif (seg >= segments) seg = segments - 1;" << std::endl;
+    header << "\t\tdouble t = x - seg;" << std::endl;
+    header << "\t\tif (t > 1.0) t = 1.0;" << std::endl;
+    header << "\t\tconst double *p = c + seg * coeffs * 4;" << std::endl;
+    header << "\t\tfor (int k = 0; k < coeffs; k++, p += 4) {" << std::endl;
+    header << "\t\t\tout[k] = p[0] + t * (p[1] + t * (p[2] + t * p[3]));" << std::endl;
+    header << "\t\t}" << std::endl;
+    header << "\t}" << std::endl;
+    header << "};" << std::endl << std::endl;
+    for (auto filt: filters) {
+        header << "extern InterpTable interp_" << filt->name() << ";" << std::endl;
+    }
+    header.close();
+
+    std::ofstream interpFile;
+    interpFile.open(dir + "/Interpolation.cpp");
+    interpFile << "#include \"Interpolation.hpp\"" << std::endl << std::endl;
+    for (auto filt: filters) {
+        procInterp(interpFile, filt);
+    }
+    interpFile.close();
+
+}
+
+// Unrolled C functions running each family of filter tables, for --kernels: 
+// kernel_<family>(buf, row + 1, row[0], x) runs one sample through the 
+// filter whose table row is row.  The kernels come from fid_gen_code(), 
+// after checking that fid_design_coef() gives the same coefficients as the 
+// table.
+bool writeKernels(std::vector<filter *> &filters, std::string const &dir) {
+
+    std::ofstream header;
+    header.open(dir + "/Kernels.hpp");
+
+    header << "#pragma once" << std::endl << std::endl;
+    header << "// Generated filter kernels; see writeKernels() in build.cpp.  For a table" << std::endl;
+    header << "// row, kernel_<family>(buf, row + 1, row[0], x) runs sample x through the" << std::endl;
+    header << "// filter with the state in buf[kernel_<family>_N_BUF], zeroed to start" << std::endl << std::endl;
+
+    std::set<std::string> done;
+    for (auto filt: filters) {
+        std::string spec;
+        int sampleRate;
+        if (!filt->kernelSpec(spec, sampleRate) || !done.insert(filt->family()).second) {
+            continue;
+        }
+        std::vector<double> row = filt->calculate(1000.0);
+        std::vector<double> coef(row.size());
+        std::string name = "kernel_" + filt->family();
+        int n;
+        char *code = fid_gen_code(&name[0], &spec[0], sampleRate, 0, 0, 0, &n);
+        if (n != (int)row.size() - 1) {
+            std::cerr << spec << " has " << n << " coefficients, but the " << filt->name() << " table has " << row.size() - 1 << std::endl;
+            free(code);
+            return false;
+        }
+        fid_design_coef(coef.data(), n, &spec[0], sampleRate, 0, 0, 0);
+        for (int i = 0; i < n; i++) {
+            if (coef[i] != row[i + 1]) {
+                std::cerr << spec << " coefficient " << i << " doesn't match the " << filt->name() << " table" << std::endl;
+                free(code);
+                return false;
+            }
+        }
+        header << code;
+        free(code);
+    }
+    header.close();
+    return true;
+
+}
+
+// The type of the scale files whose geometry isn't SMR's, for which the
+// Scale of Scales.hpp has no room: a template on the dimensions, with the 
+// tables of the filters in the order procScale() writes them
+void writeScaleTable(std::vector<filter *> &filters, std::string const &dir) {
+
+    std::ofstream header;
+    header.open(dir + "/ScaleTable.hpp");
+
+    header << "#pragma once" << std::endl << std::endl;
+    header << "// Generated scale type for any geometry; see writeScaleTable() in build.cpp." << std::endl;
+    header << "// The coefficients of note n of bank b are c_<filter>[b * Notes + n]" << std::endl;
+    header << "template <int Banks, int Notes>" << std::endl;
+    header << "struct ScaleTable {" << std::endl;
+    header << "\tint banks;" << std::endl;
+    header << "\tint notes;" << std::endl;
+    header << "\tconst char *name;" << std::endl;
+    header << "\tconst char *description;" << std::endl;
+    header << "\tconst char *scalename[Banks];" << std::endl;
+    header << "\tconst char *notedesc[Banks * Notes];" << std::endl;
+    for (auto filt: filters) {
+        int n = filt->calculate(1000.0).size();
+        header << "\tdouble c_" << filt->name() << "[Banks * Notes]";
+        if (n > 1) {
+            header << "[" << n << "]";
+        }
+        header << ";" << std::endl;
+    }
+    header << "};" << std::endl;
+    header.close();
+
+}
+
+// Timing of each (scale, filter) table, for --profile
+struct profileCell {
+    std::string scale;
+    std::string filter;
+    double start;       // Seconds since the profile started
+    double seconds;
+    long designs;
+    long cacheHits;
+    long bytes;
+    int job;
+};
+
+struct profiler {
+
+    std::chrono::steady_clock::time_point origin = std::chrono::steady_clock::now();
+    std::vector<profileCell> cells;
+
+    double now() {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - origin).count();
+    }
+
+    void report(std::ostream &out) {
+        std::vector<profileCell> sorted = cells;
+        std::sort(sorted.begin(), sorted.end(), 
+            [](profileCell const &a, profileCell const &b) { return a.seconds > b.seconds; });
+        double total = 0.0;
+        long designs = 0, hits = 0, bytes = 0;
+        out << std::left << std::setw(20) << "scale" << std::setw(20) << "filter" << std::right << 
+            std::setw(12) << "ms" << std::setw(10) << "designs" << std::setw(10) << "hits" << 
+            std::setw(10) << "bytes" << std::endl;
+        for (auto &c: sorted) {
+            out << std::left << std::setw(20) << c.scale << std::setw(20) << c.filter << std::right << 
+                std::setw(12) << std::fixed << std::setprecision(3) << c.seconds * 1000.0 << 
+                std::setw(10) << c.designs << std::setw(10) << c.cacheHits << std::setw(10) << c.bytes << std::endl;
+            total += c.seconds;
+            designs += c.designs;
+            hits += c.cacheHits;
+            bytes += c.bytes;
+        }
+        out << std::left << std::setw(40) << "total" << std::right << 
+            std::setw(12) << total * 1000.0 << std::setw(10) << designs << std::setw(10) << hits << 
+            std::setw(10) << bytes << std::endl;
+        out << std::defaultfloat;
+    }
+
+    // Chrome trace-event format, for chrome://tracing or Perfetto
+    void writeTrace(std::ostream &out) {
+        out << "{\"traceEvents\":[" << std::endl;
+        for (int i = 0; i < cells.size(); i++) {
+            profileCell &c = cells[i];
+            out << std::fixed << std::setprecision(3) << 
+                "{\"name\":\"" << c.filter << "\",\"cat\":\"" << c.scale << "\",\"ph\":\"X\"," <<
+                "\"ts\":" << c.start * 1e6 << ",\"dur\":" << c.seconds * 1e6 << ",\"pid\":1,\"tid\":" << c.job + 1 << "," <<
+                "\"args\":{\"scale\":\"" << c.scale << "\",\"designs\":" << c.designs << 
+                ",\"cacheHits\":" << c.cacheHits << ",\"bytes\":" << c.bytes << "}}" << 
+                (i == cells.size() - 1 ? "" : ",") << std::endl;
+        }
+        out << "]}" << std::endl;
+        out << std::defaultfloat;
+    }
+
+};
+
+// s as the contents of a C string literal
+std::string escaped(std::string const &s) {
+    std::string rv;
+    for (char c: s) {
+        if (c == '"' || c == '\\') {
+            rv += '\\';
+        }
+        rv += c;
+    }
+    return rv;
+}
+
+// Write a scale file.  Each filter's table is made in turn, or with 
+// parallel set each on its own thread, and all written out together.
+void procScale(std::ostream &scaleFile, scale &s, std::vector<filter *> &filters, profiler *prof = nullptr, int job = 0, 
+    bool parallel = false) {
+
+    std::vector<std::string> tables(filters.size());
+    std::vector<profileCell> cells(filters.size());
+
+    auto makeTable = [&](int i) {
+        filter *filt = filters[i];
+        long designs = filt->designs;
+        long hits = filt->cacheHits;
+        double start = prof ? prof->now() : 0.0;
+        std::ostringstream table;
+        procFilter(table, s, filt, i == filters.size() - 1);
+        tables[i] = table.str();
+        if (prof) {
+            cells[i] = { s.classname, filt->name(), start, prof->now() - start, 
+                filt->designs - designs, filt->cacheHits - hits, (long)tables[i].size(), job };
+        }
+    };
+
+    if (parallel) {
+        std::vector<std::thread> threads;
+        for (int i = 0; i < filters.size(); i++) {
+            threads.emplace_back(makeTable, i);
+        }
+        for (auto &t: threads) {
+            t.join();
+        }
+    } else {
+        for (int i = 0; i < filters.size(); i++) {
+            makeTable(i);
+        }
+    }
+
+    // SMR's Scales.hpp has the Scale type, of the default geometry; any
+    // other is a ScaleTable, from the header written by writeScaleTable()
+    if (s.banks == NUM_SCALES && s.notes == NUM_FREQS) {
+        scaleFile << "#include \"Scales.hpp\"" << std::endl;
+        scaleFile << "Scale " << s.classname << " = {" << std::endl;
+    } else {
+        scaleFile << "#include \"ScaleTable.hpp\"" << std::endl;
+        scaleFile << "ScaleTable<" << s.banks << ", " << s.notes << "> " << s.classname << " = {" << std::endl;
+        scaleFile << "\t.banks = " << s.banks << "," << std::endl;
+        scaleFile << "\t.notes = " << s.notes << "," << std::endl;
+    }
+    scaleFile << "\t.name = \"" << escaped(s.name) << "\"," << std::endl;
+    scaleFile << "\t.description = \"" << escaped(s.description) << "\"," << std::endl;
+    scaleFile << "\t.scalename = {" << std::endl;
+
+    for (int i = 0; i < s.scalename.size() - 1; i++) {
+        scaleFile << "\t\t\"" << escaped(s.scalename[i]) << "\"," << std::endl;
+    }
+    scaleFile << "\t\t\"" << escaped(s.scalename[s.scalename.size() - 1]) << "\"}," << std::endl;
+
+    scaleFile << "\t.notedesc = {" << std::endl;
+    for (int i = 0; i < s.notename.size() - 1; i++) {
+        scaleFile << "\t\t\"" << escaped(s.notename[i]) << "\"," << std::endl;
+    }
+    scaleFile << "\t\t\"" << escaped(s.notename[s.notename.size() - 1]) << "\"}," << std::endl;
+
+    for (auto &t: tables) {
+        scaleFile << t;
+    }
+    if (prof) {
+        prof->cells.insert(prof->cells.end(), cells.begin(), cells.end());
+    }
+
+    scaleFile << "};" << std::endl;
+
+}
+
+// Regression checks, for --check.  The generated scale tables are compared
+// against a reference set, line by line: the text outside numbers must match
+// exactly, and each number must be within maxUlp units in the last place, so 
+// that changes to fidlib or the formatting can't silently alter the shipped
+// coefficients.  The fast paths in fidlib are also checked against the 
+// reference implementations they replace.
+
+// Distance between two doubles in units in the last place
+long ulpDistance(double a, double b) {
+    if (a == b) {
+        return 0;
+    }
+    if (std::isnan(a) || std::isnan(b)) {
+        return LONG_MAX;
+    }
+    int64_t ia, ib;
+    memcpy(&ia, &a, sizeof(ia));
+    memcpy(&ib, &b, sizeof(ib));
+    // Map to a monotonic integer scale
+    if (ia < 0) ia = INT64_MIN - ia;
+    if (ib < 0) ib = INT64_MIN - ib;
+    uint64_t d = ia > ib ? (uint64_t)ia - (uint64_t)ib : (uint64_t)ib - (uint64_t)ia;
+    return d > LONG_MAX ? LONG_MAX : (long)d;
+}
+
+// Split a line into its numbers and the text around them
+void splitNumbers(std::string const &line, std::string &text, std::vector<double> &nums) {
+    const char *p = line.c_str();
+    text.clear();
+    nums.clear();
+    while (*p) {
+        bool start = isdigit(p[0]) || (p[0] == '.' && isdigit(p[1])) ||
+            ((p[0] == '-' || p[0] == '+') && (isdigit(p[1]) || (p[1] == '.' && isdigit(p[2]))));
+        // Digits inside identifiers (c_maxq48000) are text
+        if (start && (text.empty() || !(isalnum(text.back()) || text.back() == '_'))) {
+            char *q;
+            nums.push_back(strtod(p, &q));
+            text += '#';
+            p = q;
+        } else {
+            text += *p++;
+        }
+    }
+}
+
+bool compareTable(std::string const &name, std::string const &generated, std::string const &refName, long maxUlp) {
+
+    std::ifstream refFile(refName);
+    if (!refFile) {
+        std::cerr << refName << ": missing" << std::endl;
+        return false;
+    }
+
+    std::istringstream gen(generated);
+    std::string gl, rl, gt, rt;
+    std::vector<double> gn, rn;
+    int lineNo = 0, bad = 0;
+    long worst = 0;
+
+    while (true) {
+        bool gotGen = (bool)std::getline(gen, gl);
+        bool gotRef = (bool)std::getline(refFile, rl);
+        lineNo++;
+        if (!gotGen && !gotRef) {
+            break;
+        }
+        if (gotGen != gotRef) {
+            std::cerr << refName << ":" << lineNo << ": " << (gotGen ? "reference" : "generated") << 
+                " table is shorter" << std::endl;
+            return false;
+        }
+        if (gl == rl) {
+            continue;
+        }
+        splitNumbers(gl, gt, gn);
+        splitNumbers(rl, rt, rn);
+        bool ok = gt == rt && gn.size() == rn.size();
+        for (int i = 0; ok && i < gn.size(); i++) {
+            long d = ulpDistance(gn[i], rn[i]);
+            worst = std::max(worst, d);
+            ok = d <= maxUlp;
+        }
+        if (!ok) {
+            if (bad++ < 10) {
+                std::cerr << refName << ":" << lineNo << ": expected: " << rl << std::endl;
+                std::cerr << refName << ":" << lineNo << ": generated: " << gl << std::endl;
+            }
+        }
+    }
+
+    if (bad) {
+        std::cerr << refName << ": " << bad << " lines differ" << std::endl;
+    } else if (worst) {
+        std::cerr << name << ": within " << worst << " ulp" << std::endl;
+    }
+    return !bad;
+
+}
+
+// fid_parse()'s own number conversion against strtod()
+bool checkParse() {
+    uint64_t x = 0x9E3779B97F4A7C15ULL;
+    int bad = 0;
+    for (int i = 0; i < 100000; i++) {
+        x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+        char num[40], spec[48];
+        double d;
+        uint64_t bits = x & 0x7FEFFFFFFFFFFFFFULL;
+        memcpy(&d, &bits, sizeof(d));
+        int digits = 1 + (int)((x >> 56) % 17);
+        sprintf(num, "%.*g", digits, i & 1 ? d : 1e-3 * (double)(x >> 40));
+        sprintf(spec, "x %s", num);
+        char *p = spec;
+        FidFilter *ff;
+        char *err = fid_parse(48000, &p, &ff);
+        if (err) {
+            std::cerr << "fid_parse(\"" << spec << "\"): " << err << std::endl;
+            free(err);
+            return false;
+        }
+        if (ff->val[0] != strtod(num, 0) && bad++ < 10) {
+            std::cerr << "fid_parse(\"" << spec << "\") gave " << std::setprecision(17) << ff->val[0] << std::endl;
+        }
+        free(ff);
+    }
+    return !bad;
+}
+
+typedef void *(*runNew)(FidFilter *, double (**)(void *, double));
+
+FidFilter *designSpec(const char *spec) {
+    char buf[64];
+    strcpy(buf, spec);
+    return fid_design(buf, 48000, -1, -1, 0, 0);
+}
+
+// The output of a filter for 'in', one step at a time or a block at a time
+std::vector<double> runFilter(FidFilter *ff, std::vector<double> const &in, runNew make, bool block) {
+    double (*funcp)(void *, double);
+    void *run = make(ff, &funcp);
+    void *rb = fid_run_newbuf(run);
+    std::vector<double> out(in.size());
+    if (block) {
+        fid_run_block(rb, const_cast<double *>(in.data()), out.data(), in.size());
+    } else {
+        for (int i = 0; i < in.size(); i++) {
+            out[i] = funcp(rb, in[i]);
+        }
+    }
+    fid_run_freebuf(rb);
+    fid_run_free(run);
+    return out;
+}
+
+// Outputs must be the same, up to the sign of a zero
+bool sameOutput(const char *spec, const char *what, std::vector<double> const &got, 
+    std::vector<double> const &ref) {
+    for (int i = 0; i < ref.size(); i++) {
+        if (got[i] != ref[i]) {
+            std::cerr << spec << ": " << what << " differs at sample " << i << ": " << 
+                std::setprecision(17) << got[i] << " against " << ref[i] << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+// fid::Cascade against filter_step()
+template <int Sections, fid::Numerator Num>
+bool checkCascade(const char *spec, std::vector<double> const &in) {
+    FidFilter *ff = designSpec(spec);
+    if (!fid::Cascade<Sections, double, Num>::fits(ff)) {
+        std::cerr << spec << ": doesn't fit fid::Cascade<" << Sections << ">" << std::endl;
+        free(ff);
+        return false;
+    }
+    fid::Cascade<Sections, double, Num> cascade(ff);
+    std::vector<double> out(in.size());
+    cascade.process(in, out);
+    bool ok = sameOutput(spec, "fid::Cascade", out, runFilter(ff, in, fid_run_new, false));
+    free(ff);
+    return ok;
+}
+
+// Each of the runner's fast paths against something that doesn't take it: 
+// the block runner and the JIT against filter_step(), the constant 
+// numerators of commands 23-28 against the general biquads they replace, 
+// fid::Cascade against filter_step(), and a coefficient ramp, once it has 
+// run its course, against a filter built from the target design
+bool checkRun() {
+    const char *specs[] = { "LpBu4/1000", "BpRe/800/440", "HpBe3/200", "BpCh6/-1/300-3000", "LpBl/1000", 
+        "HpBu4/1000", "BpBu4/1000-2000", "BsBu4/1000-2000" };
+    std::vector<double> in(256);
+    for (int i = 0; i < in.size(); i++) {
+        in[i] = sin(i * 0.37) + (i == 0);
+    }
+    bool ok = true;
+
+    for (auto spec: specs) {
+        FidFilter *ff = designSpec(spec);
+        std::vector<double> ref = runFilter(ff, in, fid_run_new, false);
+        ok &= sameOutput(spec, "fid_run_block()", runFilter(ff, in, fid_run_new, true), ref);
+        ok &= sameOutput(spec, "JIT step", runFilter(ff, in, fid_run_new_jit, false), ref);
+        ok &= sameOutput(spec, "JIT block", runFilter(ff, in, fid_run_new_jit, true), ref);
+
+        // Marking the 3-value FIR filters as varying with frequency 
+        // stops fid_run_new() from treating them as constant numerators
+        for (FidFilter *f = ff; f->typ; f = FFNEXT(f)) {
+            if (f->typ == 'F' && f->len == 3) {
+                f->cbm = 0;
+            }
+        }
+        ok &= sameOutput(spec, "constant numerator", ref, runFilter(ff, in, fid_run_new, false));
+        free(ff);
+    }
+
+    ok &= checkCascade<1, fid::Numerator::BandPass>("BpRe/800/440", in);
+    ok &= checkCascade<2, fid::Numerator::LowPass>("LpBu4/1000", in);
+    ok &= checkCascade<2, fid::Numerator::HighPass>("HpBu4/1000", in);
+    ok &= checkCascade<4, fid::Numerator::General>("BsBu4/1000-2000", in);
+
+    // Glide from one design to another over 64 samples, then clear the
+    // state; from there the output must be that of the target design
+    const char *ramps[][2] = { { "LpBu4/1000", "LpBu4/2000" }, { "BpRe/800/440", "BpRe/800/880" }, 
+        { "BsBu4/1000-2000", "BsBu4/1500-3000" } };
+    for (auto ramp: ramps) {
+        for (runNew make: { fid_run_new, fid_run_new_jit }) {
+            double (*funcp)(void *, double);
+            FidFilter *from = designSpec(ramp[0]);
+            FidFilter *to = designSpec(ramp[1]);
+            void *run = make(from, &funcp);
+            void *rb = fid_run_newbuf(run);
+            std::vector<double> out(in.size());
+            fid_run_ramp(rb, 64);
+            fid_run_block(rb, in.data(), out.data(), 100);
+            if (fid_run_update_coef(run, to) != 1) {
+                std::cerr << ramp[1] << ": fid_run_update_coef() rejected the design" << std::endl;
+                ok = false;
+            }
+            fid_run_block(rb, in.data(), out.data(), 100);
+            fid_run_zapbuf(rb);
+            fid_run_block(rb, in.data(), out.data(), in.size());
+            ok &= sameOutput(ramp[1], make == fid_run_new ? "ramp end" : "JIT ramp end", 
+                out, runFilter(to, in, fid_run_new, false));
+            fid_run_freebuf(rb);
+            fid_run_free(run);
+            free(from);
+            free(to);
+        }
+    }
+    return ok;
+}
+
+bool checkTables(std::vector<generator *> &generators, std::vector<filter *> &filters, 
+    std::string const &dir, long maxUlp) {
+
+    bool ok = true;
+
+    for (auto g: generators) {
+        scale s = g->generateScale();
+        std::ostringstream scaleFile;
+        procScale(scaleFile, s, filters);
+        if (!compareTable(s.filename, scaleFile.str(), dir + "/" + s.filename, maxUlp)) {
+            ok = false;
+        }
+    }
+
+    if (!checkParse()) {
+        ok = false;
+    }
+    if (!checkRun()) {
+        ok = false;
+    }
+
+    std::cerr << (ok ? "PASS" : "FAIL") << std::endl;
+    return ok;
+
+}
+
+// Command-line options
+struct options {
+
+    std::vector<std::string> scaleFiles;    // Scale definitions to use instead of the built-in ones
+    std::vector<std::string> scalaPaths;    // Scala files, or directories of them, likewise
+    std::string kbmFile;                    // Keyboard map for the Scala files
+    int banks = NUM_SCALES;                 // Geometry of the Scala scales
+    int notes = NUM_FREQS;
+    std::vector<std::string> generators;    // Name patterns, or all if empty
+    std::vector<std::string> filters;       // Name patterns, or all if empty
+    std::vector<int> rates = { 48000, 96000 };
+    std::string outDir = ".";
+    int jobs = 0;                           // 0 for one per CPU
+    bool dryRun = false;
+    bool interpMode = false;
+    std::string checkDir;
+    long maxUlp = 4;
+    int form = FID_FORM_DIRECT;             // Section structure of the resonator tables
+    bool profileMode = false;
+    std::string traceFile;
+    bool kernels = false;                   // Also write Kernels.hpp
+
+};
+
+void usage(const char *prog) {
+    std::cerr << "Usage: " << prog << " [options]" << std::endl <<
+        "  -s, --scales FILE     generate the scales defined in FILE instead of the built-in ones (repeatable)" << std::endl <<
+        "      --scl PATH        generate the Scala .scl file PATH, or all those under directory PATH (repeatable)" << std::endl <<
+        "      --kbm FILE        map the Scala files onto keys with the Scala keyboard map FILE" << std::endl <<
+        "      --geometry BxN    make the Scala scales B rows of N notes (default 11x21)" << std::endl <<
+        "  -g, --generator PAT   only generate scales whose name contains PAT (repeatable)" << std::endl <<
+        "  -f, --filter PAT      only generate filter tables whose name contains PAT (repeatable)" << std::endl <<
+        "  -r, --rates LIST      comma-separated sample rates, or all for 44.1k to 192k (default 48000,96000)" << std::endl <<
+        "  -o, --output DIR      write files into DIR (default .)" << std::endl <<
+        "  -j, --jobs N          generate N scales at once (default one per CPU)" << std::endl <<
+        "  -n, --dry-run         list what would be generated, and stop" << std::endl <<
+        "      --interp          write the interpolation tables instead of the scales" << std::endl <<
+        "      --check DIR       compare the scales against those in DIR instead of writing them" << std::endl <<
+        "      --ulp N           tolerance for --check (default 4)" << std::endl <<
+        "      --form FORM       emit the resonators as direct, coupled or svf sections (default direct)" << std::endl <<
+        "      --kernels         also write unrolled C functions running the direct-form tables" << std::endl <<
+        "      --profile         report the time spent on each table" << std::endl <<
+        "      --trace FILE      with --profile, also write a Chrome trace" << std::endl;
+}
+
+bool parseArgs(int argc, char *argv[], options &opt) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if ((arg == "-s" || arg == "--scales") && hasValue) {
+            opt.scaleFiles.push_back(argv[++i]);
+        } else if (arg == "--scl" && hasValue) {
+            opt.scalaPaths.push_back(argv[++i]);
+        } else if (arg == "--kbm" && hasValue) {
+            opt.kbmFile = argv[++i];
+        } else if (arg == "--geometry" && hasValue) {
+            if (sscanf(argv[++i], "%dx%d", &opt.banks, &opt.notes) != 2 || opt.banks < 1 || opt.notes < 1) {
+                std::cerr << "Bad geometry: " << argv[i] << std::endl;
+                return false;
+            }
+        } else if ((arg == "-g" || arg == "--generator") && hasValue) {
+            opt.generators.push_back(argv[++i]);
+        } else if ((arg == "-f" || arg == "--filter") && hasValue) {
+            opt.filters.push_back(argv[++i]);
+        } else if ((arg == "-r" || arg == "--rates") && hasValue) {
+            opt.rates.clear();
+            std::istringstream list(strcmp(argv[++i], "all") ? argv[i] : "44100,48000,88200,96000,192000");
+            std::string rate;
+            while (std::getline(list, rate, ',')) {
+                int r = atoi(rate.c_str());
+                if (r <= 0) {
+                    std::cerr << "Bad sample rate: " << rate << std::endl;
+                    return false;
+                }
+                opt.rates.push_back(r);
+            }
+        } else if ((arg == "-o" || arg == "--output") && hasValue) {
+            opt.outDir = argv[++i];
+        } else if ((arg == "-j" || arg == "--jobs") && hasValue) {
+            opt.jobs = atoi(argv[++i]);
+        } else if (arg == "-n" || arg == "--dry-run") {
+            opt.dryRun = true;
+        } else if (arg == "--interp") {
+            opt.interpMode = true;
+        } else if (arg == "--check" && hasValue) {
+            opt.checkDir = argv[++i];
+        } else if (arg == "--ulp" && hasValue) {
+            opt.maxUlp = atol(argv[++i]);
+        } else if (arg == "--form" && hasValue) {
+            std::string name = argv[++i];
+            opt.form = -1;
+            for (int f = FID_FORM_DIRECT; f <= FID_FORM_SVF; f++) {
+                if (name == formNames[f]) {
+                    opt.form = f;
+                }
+            }
+            if (opt.form < 0) {
+                std::cerr << "Unknown section form: " << name << std::endl;
+                return false;
+            }
+        } else if (arg == "--kernels") {
+            opt.kernels = true;
+        } else if (arg == "--profile") {
+            opt.profileMode = true;
+        } else if (arg == "--trace" && hasValue) {
+            opt.profileMode = true;
+            opt.traceFile = argv[++i];
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Name of a generator's type, e.g. "mesopotamian_generator"
+std::string typeName(generator *g) {
+    const char *name = typeid(*g).name();
+#ifdef __GNUG__
+    int status;
+    char *demangled = abi::__cxa_demangle(name, 0, 0, &status);
+    if (demangled) {
+        std::string rv = demangled;
+        free(demangled);
+        return rv;
+    }
+#endif
+    return name;
+}
+
+bool matches(std::vector<std::string> const &patterns, std::vector<std::string> const &names) {
+    if (patterns.empty()) {
+        return true;
+    }
+    for (auto &p: patterns) {
+        for (auto &n: names) {
+            if (n.find(p) != std::string::npos) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// The filter tables for each scale, in the order they appear in a Scale:
+// each filter type for every sample rate in turn
+struct filterSet {
+
+    std::vector<std::unique_ptr<filter>> owned;
+    std::vector<filter *> list;
+    designShares &shares;
+
+    filterSet(options const &opt, designShares &shares) : shares(shares) {
+        for (int rate: opt.rates) {
+            maxq_filter *maxq = new maxq_filter();
+            maxq->sampleRate = rate;
+            add(maxq, opt);
+        }
+        for (int rate: opt.rates) {
+            bpre_filter *bpreLo = new bpre_filter();
+            bpreLo->gain_q = 2.0;
+            bpreLo->Qval = 2.0;
+            bpreLo->sampleRate = rate;
+            bpreLo->form = opt.form;
+            add(bpreLo, opt);
+        }
+        for (int rate: opt.rates) {
+            bpre_filter *bpreHi = new bpre_filter();
+            bpreHi->gain_q = 40.0;
+            bpreHi->Qval = 800.0;
+            bpreHi->sampleRate = rate;
+            bpreHi->form = opt.form;
+            add(bpreHi, opt);
+        }
+    }
+
+    void add(filter *filt, options const &opt) {
+        owned.emplace_back(filt);
+        filt->share = shares.get(filt->family());
+        if (matches(opt.filters, { filt->name() })) {
+            list.push_back(filt);
+        }
+    }
+
+};
+
+int main(int argc, char *argv[]) {
+
+    options opt;
+    if (!parseArgs(argc, argv, opt)) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    std::vector<generator *> generators;
+
+    video_generator video = {};
+    generators.push_back(&video);
+
+    bp_generator bp = {};
+    generators.push_back(&bp);
+
+    gamelan_generator gamelan = {};
+    generators.push_back(&gamelan);
+
+    b296_generator b296 = {};
+    generators.push_back(&b296);
+
+    shrutis_generator shrutis = {};
+    generators.push_back(&shrutis);
+
+    mesopotamian_generator mesopotamian = {};
+    generators.push_back(&mesopotamian);
+
+    alphaspread1_generator alpha1 = {};
+    generators.push_back(&alpha1);
+
+    alphaspread2_generator alpha2 = {};
+    generators.push_back(&alpha2);
+
+    gammaspread_generator gamma_spread = {};
+    generators.push_back(&gamma_spread);
+
+    gamma_generator gamma = {};
+    generators.push_back(&gamma);
+    
+    et17_generator et17 = {};
+    generators.push_back(&et17);
 
     indian_generator indian = {};
     generators.push_back(&indian);
@@ -1761,77 +3653,142 @@ int main() {
 
     userscale_generator user = {};
     generators.push_back(&user);
-    
-    maxq_filter maxq48 = {};
-    maxq48.sampleRate = 48000;
-    filters.push_back(&maxq48);
-
-    maxq_filter maxq96 = {};
-    maxq96.sampleRate = 96000;
-    filters.push_back(&maxq96);
-
-    bpre_filter bpreLo48 = {};
-    bpreLo48.gain_q = 2.0;
-    bpreLo48.Qval = 2.0;
-    bpreLo48.sampleRate = 48000;
-    filters.push_back(&bpreLo48);
-
-    bpre_filter bpreLo96 = {};
-    bpreLo96.gain_q = 2.0;
-    bpreLo96.Qval = 2.0;
-    bpreLo96.sampleRate = 96000;
-    filters.push_back(&bpreLo96);
-
-    bpre_filter bpreHi48 = {};
-    bpreHi48.gain_q = 40.0;
-    bpreHi48.Qval = 800.0;
-    bpreHi48.sampleRate = 48000;
-    filters.push_back(&bpreHi48);
-
-    bpre_filter bpreHi96 = {};
-    bpreHi96.gain_q = 40.0;
-    bpreHi96.Qval = 800.0;
-    bpreHi96.sampleRate = 96000;
-    filters.push_back(&bpreHi96);
-
-
-    for (auto g: generators) {
 
-        scale s = g->generateScale();
+    // Designs are shared between sample rates, and between jobs
+    designShares shares;
+    filterSet filters(opt, shares);
+    filter *probe = filters.owned[0].get();
+    double cut = probe->frequencyCutEnabled ? probe->frequencyCut : -1.0;
+
+    // Scales read from files replace the built-in ones
+    std::vector<std::unique_ptr<data_generator>> loaded;
+    std::vector<std::unique_ptr<scala_generator>> imported;
+    keyboardMap kbm;
+    if (!opt.scaleFiles.empty() || !opt.scalaPaths.empty()) {
+        generators.clear();
+        for (auto &path: opt.scaleFiles) {
+            if (!loadScales(path, loaded)) {
+                return 1;
+            }
+        }
+        for (auto &g: loaded) {
+            generators.push_back(g.get());
+        }
 
-		std::ofstream scaleFile;
-        scaleFile.open(s.filename);
+        std::string error;
+        if (!opt.kbmFile.empty() && !readKbm(opt.kbmFile, kbm, error)) {
+            std::cerr << opt.kbmFile << ": " << error << std::endl;
+            return 1;
+        }
+        importScala(opt.scalaPaths, kbm, opt.banks, opt.notes, cut, imported);
+        for (auto &g: imported) {
+            generators.push_back(g.get());
+        }
+    }
 
-        scaleFile << "#include \"Scales.hpp\"" << std::endl;
+    if (opt.interpMode) {
+        if (opt.form != FID_FORM_DIRECT) {
+            std::cerr << "--interp needs the direct form" << std::endl;
+            return 1;
+        }
+        writeInterp(filters.list, opt.outDir);
+        return 0;
+    }
 
-        scaleFile << "Scale " << s.classname << " = {" << std::endl;
-        scaleFile << "\t.name = \"" << s.name << "\"," << std::endl;
-        scaleFile << "\t.description = \"" << s.description << "\"," << std::endl;
-        scaleFile << "\t.scalename = {" << std::endl;
+    if (!opt.checkDir.empty()) {
+        return checkTables(generators, filters.list, opt.checkDir, opt.maxUlp) ? 0 : 1;
+    }
 
-        for (int i = 0; i < s.scalename.size() - 1; i++) {
-            scaleFile << "\t\t\"" << s.scalename[i] << "\"," << std::endl;
+    // Choose the scales, and find the lastValid frequency that each filter 
+    // would have on starting each one, had the whole catalogue been generated
+    // in order (see filter::generateCoeffs), so that every scale comes out the
+    // same however many are generated, and in whatever order
+    std::vector<std::pair<generator *, double>> work;
+    double lastValid = -1.0;
+    bool anyGeometry = false;
+    for (auto g: generators) {
+        scaleSummary s = g->summarize(cut);
+        std::string type = typeName(g);
+        std::vector<std::string> names = { s.classname, s.filename, type, type.substr(0, type.rfind("_generator")) };
+        if (matches(opt.generators, names)) {
+            work.push_back({ g, lastValid });
+            anyGeometry |= s.banks != NUM_SCALES || s.notes != NUM_FREQS;
+            if (opt.dryRun) {
+                std::cout << opt.outDir << "/" << s.filename << " (" << type << "):";
+                for (auto filt: filters.list) {
+                    std::cout << " " << filt->name();
+                }
+                std::cout << std::endl;
+            }
         }
-        scaleFile << "\t\t\"" << s.scalename[s.scalename.size() - 1] << "\"}," << std::endl;
-
-        scaleFile << "\t.notedesc = {" << std::endl;
-        for (int i = 0; i < s.notename.size() - 1; i++) {
-            scaleFile << "\t\t\"" << s.notename[i] << "\"," << std::endl;
+        if (s.lastBelow != -1.0) {
+            lastValid = s.lastBelow;
         }
-        scaleFile << "\t\t\"" << s.notename[s.notename.size() - 1] << "\"}," << std::endl;
+    }
 
-        procFilter(scaleFile, s, &maxq48);
-        procFilter(scaleFile, s, &maxq96);
-        procFilter(scaleFile, s, &bpreLo48);
-        procFilter(scaleFile, s, &bpreLo96);
-        procFilter(scaleFile, s, &bpreHi48);
-        procFilter(scaleFile, s, &bpreHi96, true);
+    if (opt.dryRun) {
+        return 0;
+    }
+
+    std::filesystem::create_directories(opt.outDir);
+    if (opt.kernels && !writeKernels(filters.list, opt.outDir)) {
+        return 1;
+    }
+    if (anyGeometry) {
+        writeScaleTable(filters.list, opt.outDir);
+    }
 
-        scaleFile << "};" << std::endl;
+    // Each job takes the next scale from the list, with its own filters so
+    // that their lastValid and local caches are its own.  With more jobs 
+    // than scales, each scale's filters run in parallel instead.
+    int jobs = opt.jobs > 0 ? opt.jobs : std::max(1u, std::thread::hardware_concurrency());
+    bool parallelFilters = jobs > work.size();
+    jobs = std::min(jobs, (int)work.size());
+
+    std::atomic<int> next(0);
+    profiler prof;
+    std::vector<profiler> jobProf(jobs, prof);
+
+    auto job = [&](int id) {
+        filterSet jobFilters(opt, shares);
+        while (true) {
+            int w = next++;
+            if (w >= work.size()) {
+                break;
+            }
+            scale s = work[w].first->generateScale();
+            for (auto filt: jobFilters.list) {
+                filt->lastValid = work[w].second;
+            }
 
-      scaleFile.close();
+            std::ofstream scaleFile;
+            scaleFile.open(opt.outDir + "/" + s.filename);
+            procScale(scaleFile, s, jobFilters.list, opt.profileMode ? &jobProf[id] : nullptr, id, parallelFilters);
+            scaleFile.close();
+        }
+    };
 
+    std::vector<std::thread> threads;
+    for (int id = 1; id < jobs; id++) {
+        threads.emplace_back(job, id);
+    }
+    if (jobs > 0) {
+        job(0);
+    }
+    for (auto &t: threads) {
+        t.join();
     }
 
-}
+    if (opt.profileMode) {
+        for (auto &p: jobProf) {
+            prof.cells.insert(prof.cells.end(), p.cells.begin(), p.cells.end());
+        }
+        prof.report(std::cout);
+        fid_stats_dump();
+        if (!opt.traceFile.empty()) {
+            std::ofstream trace(opt.traceFile);
+            prof.writeTrace(trace);
+        }
+    }
 
+}
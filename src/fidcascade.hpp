@@ -0,0 +1,222 @@
+#pragma once
+
+//
+// Header-only cascades of biquads, for filters whose shape is known at
+// compile time: the BpRe resonator of the scale tables, or a Butterworth
+// of given order.  fid_run_new() interprets a command list for every
+// sample; here the number of sections and the form of their numerators
+// are template parameters, so the loop over the sections is unrolled by
+// the compiler and the state kept in registers for a whole block.
+//
+//    fid::Cascade<1, double, fid::Numerator::BandPass> res(row[0], row + 1);
+//    res.process(in, out);
+//
+// Each section runs as fid_run_new() runs an IIR/FIR pair, with the sums
+// in the same order and the gain applied at the end, so for T = double
+// the output is the same, up to the sign of a zero.  The denominator of
+// section s is 1 + a[s][0] z^-1 + a[s][1] z^-2 (fidlib's val[1] and
+// val[2]), and the numerator b[s][0] + b[s][1] z^-1 + b[s][2] z^-2.
+//
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <utility>
+
+#if __cplusplus >= 202002L
+#include <span>
+#endif
+
+#include "fidlib.h"
+
+namespace fid {
+
+#if __cplusplus >= 202002L
+template <typename T> using span = std::span<T>;
+#else
+// Enough of C++20's std::span for process()
+template <typename T> class span {
+    T *ptr;
+    size_t len;
+public:
+    span(T *ptr, size_t len) : ptr(ptr), len(len) {}
+    template <size_t N> span(T (&arr)[N]) : ptr(arr), len(N) {}
+    template <typename C> span(C &&c) : ptr(c.data()), len(c.size()) {}
+    T *data() const { return ptr; }
+    size_t size() const { return len; }
+    T &operator[](size_t i) const { return ptr[i]; }
+};
+#endif
+
+// Numerators with constant coefficients, as fid_run_new() special-cases
+// in commands 23-28: these take adds in place of three multiplies
+enum class Numerator {
+    General,        // b[s][0..2] as given
+    BandPass,       // 1, 0, -1 (BpRe, BpBu, ...)
+    LowPass,        // 1, 2, 1 (LpBu, ...)
+    HighPass,       // 1, -2, 1 (HpBu, ...)
+};
+
+template <int Sections, typename T = double, Numerator Num = Numerator::General>
+struct Cascade {
+
+    T gain = 1;
+    T b[Sections][3];
+    T a[Sections][2];
+    T w[Sections][2] = {};  // w[n-1], w[n-2] of each section
+
+    // From a table row's coefficients: for a constant numerator, { a[s][1],
+    // a[s][0] } for each section, which for BpRe is the { val[2], val[1] }
+    // of the scale tables; otherwise { a[s][1], b[s][2], a[s][0], b[s][1],
+    // b[s][0] }.  Either way this is the fid_design_coef() order where only
+    // the denominators (or everything) vary with frequency.
+    Cascade(T gain, const T *coef) : gain(gain) {
+        for (int s = 0; s < Sections; s++) {
+            numerator(b[s]);
+            a[s][1] = *coef++;
+            if (Num == Numerator::General) b[s][2] = *coef++;
+            a[s][0] = *coef++;
+            if (Num == Numerator::General) {
+                b[s][1] = *coef++;
+                b[s][0] = *coef++;
+            }
+        }
+    }
+
+    // From separate arrays; b is ignored for a constant numerator
+    Cascade(T gain, const T (&bb)[Sections][3], const T (&aa)[Sections][2]) : gain(gain) {
+        for (int s = 0; s < Sections; s++) {
+            numerator(b[s]);
+            for (int k = 0; k < 3 && Num == Numerator::General; k++) b[s][k] = bb[s][k];
+            a[s][0] = aa[s][0];
+            a[s][1] = aa[s][1];
+        }
+    }
+
+    // From a FidFilter made of Sections IIR/FIR pairs of up to 3 values,
+    // plus any single-value gains, as fid_design() gives for the Bu, Be,
+    // Ch and Bq filters and BpRe.  As in fidlib, a filter that doesn't fit
+    // is a fatal error; check with fits() first if that's a possibility.
+    explicit Cascade(FidFilter *filt) {
+        if (!load(filt, this)) {
+            std::fprintf(stderr, "FidFilter doesn't fit fid::Cascade<%d>\n", Sections);
+            std::exit(1);
+        }
+    }
+
+    static bool fits(FidFilter *filt) {
+        return load(filt, nullptr);
+    }
+
+    void reset() {
+        for (auto &ws: w) ws[0] = ws[1] = 0;
+    }
+
+    // Run in[] through the filter into out[], which may be the same array
+    void process(span<const T> in, span<T> out) {
+        run(in.data(), out.data(), in.size() < out.size() ? in.size() : out.size(),
+            std::make_integer_sequence<int, Sections>());
+    }
+
+private:
+
+    static void numerator(T *bb) {
+        bb[0] = 1;
+        bb[1] = Num == Numerator::LowPass ? 2 : Num == Numerator::HighPass ? -2 : 0;
+        bb[2] = Num == Numerator::BandPass ? -1 : 1;
+    }
+
+    template <int... S>
+    void run(const T *in, T *out, size_t len, std::integer_sequence<int, S...>) {
+        T w1[Sections] = { w[S][0]... };
+        T w2[Sections] = { w[S][1]... };
+        for (size_t n = 0; n < len; n++) {
+            T x = in[n];
+            ((x = section<S>(x, w1[S], w2[S])), ...);
+            out[n] = x * gain;
+        }
+        ((w[S][0] = w1[S], w[S][1] = w2[S]), ...);
+    }
+
+    // One IIR/FIR pair, as run_cmds() does it
+    template <int S>
+    inline T section(T iir, T &w1, T &w2) const {
+        T fir;
+        iir -= a[S][1] * w2;
+        if (Num == Numerator::General) {
+            fir = b[S][2] * w2;
+        } else {
+            fir = w2;
+        }
+        iir -= a[S][0] * w1;
+        if (Num == Numerator::General) {
+            fir += b[S][1] * w1;
+        } else if (Num == Numerator::LowPass) {
+            fir = fir + (w1 + w1);
+        } else if (Num == Numerator::HighPass) {
+            fir = fir - (w1 + w1);
+        }
+        w2 = w1;
+        w1 = iir;
+        if (Num == Numerator::General) {
+            return fir + b[S][0] * iir;
+        } else if (Num == Numerator::BandPass) {
+            return iir - fir;
+        } else {
+            return iir + fir;
+        }
+    }
+
+    // Fill in 'cc' from the filter if it isn't null, returning false if
+    // the filter doesn't fit
+    static bool load(FidFilter *ff, Cascade *cc) {
+        double gain = 1;
+        int s = 0;
+        while (ff->typ) {
+            if (ff->typ == 'F' && ff->len == 1) {
+                gain *= ff->val[0];
+                ff = FFNEXT(ff);
+                continue;
+            }
+            double iir[3] = { 1, 0, 0 }, fir[3] = { 1, 0, 0 };
+            if (ff->typ == 'I') {
+                if (ff->len > 3) return false;
+                for (int k = 0; k < ff->len; k++) iir[k] = ff->val[k];
+                ff = FFNEXT(ff);
+                while (ff->typ == 'F' && ff->len == 1) {
+                    gain *= ff->val[0];
+                    ff = FFNEXT(ff);
+                }
+            }
+            if (ff->typ == 'F') {
+                if (ff->len > 3) return false;
+                for (int k = 0; k < ff->len; k++) fir[k] = ff->val[k];
+                ff = FFNEXT(ff);
+            } else if (ff->typ != 'I' && ff->typ) {
+                return false;
+            }
+            if (s == Sections) return false;
+            if (Num != Numerator::General) {
+                T bb[3];
+                numerator(bb);
+                for (int k = 0; k < 3; k++) {
+                    if (fir[k] != bb[k]) return false;
+                }
+            }
+            double adj = 1.0 / iir[0];
+            gain *= adj;
+            if (cc) {
+                for (int k = 0; k < 3; k++) cc->b[s][k] = fir[k];
+                cc->a[s][0] = iir[1] * adj;
+                cc->a[s][1] = iir[2] * adj;
+            }
+            s++;
+        }
+        if (s != Sections) return false;
+        if (cc) cc->gain = gain;
+        return true;
+    }
+
+};
+
+}
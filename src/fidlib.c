@@ -109,6 +109,86 @@
 //	free(fbuf1);
 //	fid_run_free(run);
 //
+//	// Or choose the JIT for this filter: the command list compiled to
+//	// machine code (x86-64 Linux only; elsewhere the same as
+//	// fid_run_new()).  Everything else works the same, with the
+//	// same results.
+//	run= fid_run_new_jit(filt, &funcp);
+//
+//	// Retune a running filter to a new design of the same spec (e.g. at
+//	// a new frequency) without rebuilding it or disturbing the buffers.
+//	// Returns 0 if the new filter doesn't have the same structure and
+//	// constant coefficients, in which case a new Run is needed.
+//	// Safe against fid_run_block() running concurrently in another
+//	// thread; returns -1, changing nothing, while a block that started
+//	// before the last update is still running, so try again later
+//	ok= fid_run_update_coef(run, filt2);
+//
+//	// Make a buffer glide linearly to updated coefficients over 'len'
+//	// samples instead of jumping, to avoid zipper noise on a sweep
+//	fid_run_ramp(fbuf1, len);
+//
+//	// Run a block of samples at a time (in[] and out[] may be the same)
+//	fid_run_block(fbuf1, in, out, len);
+//
+//	// Protect fid_run_block() on a buffer against subnormal state
+//	// values, which are very slow on some CPUs, as a high-Q filter
+//	// rings down into silence: any of FID_DENORM_FTZ (set the FPU to
+//	// flush them to zero for the duration of the block),
+//	// FID_DENORM_DC (add a tiny offset to the input, alternating in
+//	// sign) and FID_DENORM_COUNT (count them after each block, for
+//	// fid_run_denormals() to return)
+//	fid_run_denormal(fbuf1, FID_DENORM_FTZ | FID_DENORM_COUNT);
+//	cnt= fid_run_denormals(fbuf1);
+//
+//	// Run a bank of BpRe resonators over the same input, from a table
+//	// of n_band {gain, val[2], val[1]} triples as in the scale tables.
+//	// fid_bank_run() gives each band's output in out[band*len+i], 
+//	// fid_bank_mix() their sum, each times weight[band] if weight != 0
+//	bank= fid_bank_new(coef, n_band);
+//	fid_bank_run(bank, in, out, len);
+//	fid_bank_mix(bank, weight, in, out, len);
+//
+//	// Or design the bank from the bands' frequencies, Q and peak gain,
+//	// running the low bands at rate/2, rate/4 and so on.  Only
+//	// fid_bank_mix() is available on a multirate bank
+//	bank= fid_bank_new_multirate(rate, freq, n_band, q, gain);
+//	fid_bank_mix(bank, weight, in, out, len);
+//	// Denormal protection for either kind, FID_DENORM_FTZ and/or
+//	// FID_DENORM_DC as for fid_run_denormal()
+//	fid_bank_denormal(bank, FID_DENORM_FTZ);
+//	fid_bank_zap(bank);
+//	fid_bank_free(bank);
+//
+//	// Run a filter in single precision, with sections arranged to
+//	// stay accurate for poles near the unit circle.  Check the RMS
+//	// error of its impulse response against the double runner first
+//	err= fid_run_error_f(filt, FID_FORM_AUTO, len);
+//	run= fid_run_new_f(filt, &funcp_f);
+//	// Or with every biquad in a given structure, FID_FORM_DIRECT,
+//	// FID_FORM_COUPLED or FID_FORM_SVF
+//	run= fid_run_new_f_form(filt, FID_FORM_SVF, &funcp_f);
+//	fbuf1= fid_run_newbuf_f(run);
+//	out_f= funcp_f(fbuf1, in_f);
+//	fid_run_block_f(fbuf1, in_f, out_f, len);
+//	fid_run_denormal_f(fbuf1, FID_DENORM_FTZ | FID_DENORM_DC);
+//	fid_run_zapbuf_f(fbuf1);
+//	fid_run_freebuf_f(fbuf1);
+//	fid_run_free_f(run);
+//
+//	// Run a filter in fixed point, with Q31 samples, 32-bit state and
+//	// 64-bit sums, scaled so that full-scale sinusoids
+//	// (FID_NORM_LINF) or any input at all (FID_NORM_L1) stay in
+//	// range.  Check the SNR in dB against the double runner first
+//	snr= fid_run_snr_fx(filt, FID_NORM_LINF, len);
+//	run= fid_run_new_fx(filt, FID_NORM_LINF, &funcp_x);
+//	fbuf1= fid_run_newbuf_fx(run);
+//	out_x= funcp_x(fbuf1, in_x);
+//	fid_run_block_fx(fbuf1, in_x, out_x, len);	// No subnormals in integers
+//	fid_run_zapbuf_fx(fbuf1);
+//	fid_run_freebuf_fx(fbuf1);
+//	fid_run_free_fx(run);
+//
 //	// Convert an arbitrary filter into a new filter which is a single 
 //	// IIR/FIR pair.  This is done by convolving the coefficients.  This 
 //	// flattened filter will give the same result, in theory.  However, 
@@ -125,6 +205,14 @@
 //	// of the string.  Returns a strdup'd error string on error, or else 0.
 //	err= fid_parse(double rate, char **pp, FidFilter **ffp);
 //
+//	// The same, but for text from *pp to 'end' which needn't be
+//	// NUL-terminated (e.g. a memory-mapped file)
+//	err= fid_parse_n(double rate, char **pp, char *end, FidFilter **ffp);
+//
+//	// Load a whole file of filters separated by ',' or ';', returned
+//	// as a 0-terminated array.  Free each filter, then the array.
+//	err= fid_parse_file(double rate, char *fnam, FidFilter ***listp);
+//
 //	// Set up your own fatal-error handler (default is to dump a message 
 //	// to STDERR and exit on fatal conditions)
 //	fid_set_error_handler(&my_error_func);
@@ -132,12 +220,29 @@
 //	// Get the version number of the library as a string (e.g. "1.0.0")
 //	txt= fid_version();
 //
+//	// With fidlib built with -DFID_STATS, print counts of calls, 
+//	// iterations, allocations and time spent in the design code to 
+//	// STDERR, or zero them
+//	fid_stats_dump();
+//	fid_stats_reset();
+//
+//	// Convert a biquad section to the coefficients of another section
+//	// structure (FID_FORM_COUPLED, FID_FORM_SVF), for running in
+//	// float or fixed point.  Gives 5 coefficients in coef[]
+//	ok= fid_section_coef(iir, n_iir, fir, n_fir, FID_FORM_SVF, coef);
+//
 //	// Design a filter and reduce it to a list of all the non-const 
 //	// coefficients, which is returned in the given double[].  The number
 //	// of coefficients expected must be provided (as a check).
 //	#define N_COEF <whatever>
 //	double coef[N_COEF], gain;
 //
+//	// Generate C source for a fully unrolled function 'name' (and
+//	// name_block()) running any design of the given spec, taking
+//	// the coefficients from fid_design_coef() above.  Returns the
+//	// number of coefficients in n_coef; free the text when done
+//	txt= fid_gen_code("lp4", "LpBu4", rate, freq0, freq1, adj, &n_coef);
+//
 //	// Rewrite a filter spec in a full and/or separated-out form
 //	char *full, *min;
 //	double minf0, minf1;
@@ -222,7 +327,9 @@
 //
 //	  RF_COMBINED -- easy to understand code, lower accuracy
 //	  RF_CMDLIST  -- faster pre-compiled code
-//	  RF_JIT      -- fastest JIT run-time generated code (no longer supported)
+//	  RF_JIT      -- as RF_CMDLIST, but fid_run_new() compiles the
+//	                 command list to machine code at run time where
+//	                 it can (x86-64 Linux), as fid_run_new_jit() does
 //
 
 #ifndef RF_COMBINED
@@ -235,6 +342,10 @@
 #endif
 #endif
 
+#ifdef RF_JIT
+#define RF_CMDLIST
+#endif
+
 //
 //	Includes
 //
@@ -245,6 +356,8 @@
 #include <string.h>
 #include <ctype.h>
 #include <math.h>
+#include <locale.h>
+#include <float.h>
 #include "fidlib.h"
 
 #ifndef M_PI
@@ -264,6 +377,45 @@ extern FidFilter *mkfilter(char *, ...);
  #define STATIC_INLINE static inline 
 #endif
 
+// Macro for working variables that need a separate copy per thread
+#ifdef T_MSVC
+ #define THREAD_LOCAL __declspec(thread)
+#else
+ #define THREAD_LOCAL __thread
+#endif
+
+// Switch the FPU to flush subnormals to zero (FTZ) and treat
+// subnormal inputs as zero (DAZ), returning the previous state for
+// fpu_restore().  On targets where we don't know how, do nothing.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+ #include <xmmintrin.h>
+ STATIC_INLINE unsigned long
+ fpu_ftz_on() {
+    unsigned int csr= _mm_getcsr();
+    _mm_setcsr(csr | 0x8040);	// FTZ | DAZ
+    return csr;
+ }
+ STATIC_INLINE void
+ fpu_restore(unsigned long csr) {
+    _mm_setcsr((unsigned int)csr);
+ }
+#elif defined(__aarch64__)
+ STATIC_INLINE unsigned long
+ fpu_ftz_on() {
+    unsigned long fpcr;
+    __asm__ __volatile__("mrs %0, fpcr" : "=r" (fpcr));
+    __asm__ __volatile__("msr fpcr, %0" : : "r" (fpcr | (1UL << 24)));	// FZ
+    return fpcr;
+ }
+ STATIC_INLINE void
+ fpu_restore(unsigned long fpcr) {
+    __asm__ __volatile__("msr fpcr, %0" : : "r" (fpcr));
+ }
+#else
+ STATIC_INLINE unsigned long fpu_ftz_on() { return 0; }
+ STATIC_INLINE void fpu_restore(unsigned long state) { }
+#endif
+
 // MinGW and MSVC fixes
 #if defined(T_MINGW) || defined(T_MSVC)
  #ifndef vsnprintf
@@ -281,6 +433,59 @@ extern FidFilter *mkfilter(char *, ...);
 #endif
 
 
+//
+//	Instrumentation.  If FID_STATS is defined, the design code
+//	counts calls, iterations and time spent in the main routines,
+//	for fid_stats_dump() to report.  Otherwise the STAT_* macros
+//	expand to nothing.  The counters are updated atomically, except
+//	on MSVC, where they may miss counts with several threads.
+//
+
+#ifdef FID_STATS
+
+#include <time.h>
+
+typedef struct FidStat {
+   unsigned long long calls;	// Number of calls
+   unsigned long long count;	// Iterations, designs or bytes, depending on the counter
+   unsigned long long ns;	// Time spent, where measured
+} FidStat;
+
+static FidStat st_design, st_response, st_alloc, st_bpres, st_peak, st_adj_single, st_adj_dual;
+static FidStat st_denorm;
+
+static unsigned long long 
+stats_now() {
+   struct timespec ts;
+#ifdef T_LINUX
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+#else
+   timespec_get(&ts, TIME_UTC);
+#endif
+   return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+#ifdef T_MSVC
+ #define STAT_ADD(vv, nn) ((vv) += (nn))
+#else
+ #define STAT_ADD(vv, nn) __atomic_fetch_add(&(vv), (nn), __ATOMIC_RELAXED)
+#endif
+
+ #define STAT_CALL(st) STAT_ADD((st).calls, 1)
+ #define STAT_COUNT(st, nn) STAT_ADD((st).count, (nn))
+ #define STAT_START(tt) unsigned long long tt= stats_now()
+ #define STAT_STOP(st, tt) STAT_ADD((st).ns, stats_now() - (tt))
+
+#else
+
+ #define STAT_CALL(st)
+ #define STAT_COUNT(st, nn)
+ #define STAT_START(tt)
+ #define STAT_STOP(st, tt)
+
+#endif
+
+
 //
 //	Support code
 //
@@ -320,6 +525,8 @@ static void *
 Alloc(int size) {
    void *vp= calloc(1, size);
    if (!vp) error("Out of memory");
+   STAT_CALL(st_alloc);
+   STAT_COUNT(st_alloc, size);
    return vp;
 }
 
@@ -571,6 +778,7 @@ fid_response(FidFilter *filt, double freq) {
    double theta= freq * 2 * M_PI;
    double zz[2];
 
+   STAT_CALL(st_response);
    top[0]= 1;
    top[1]= 0;
    bot[0]= 1;
@@ -726,7 +934,9 @@ search_peak(FidFilter *ff, double f0, double f3) {
    // Binary search, modified, taking two intermediate points.  Do 20
    // subdivisions, which should give 1/2^20 == 1e-6 accuracy compared
    // to original range.
+   STAT_CALL(st_peak);
    for (a= 0; a<20; a++) {
+      STAT_COUNT(st_peak, 1);
       f1= 0.51 * f0 + 0.49 * f3;
       f2= 0.49 * f0 + 0.51 * f3;
       if (f1 == f2) break;		// We're hitting FP limit
@@ -1301,6 +1511,35 @@ static struct {
    { 0, 0, 0 }
 };
 
+//
+//	Call the design routine for filter[fi].  With FID_STATS, the
+//	calls and time are recorded per filter type.
+//
+
+#ifdef FID_STATS
+
+static FidStat st_des[sizeof(filter) / sizeof(filter[0])];
+
+static FidFilter *
+stats_design(int fi, double rate, double f0, double f1, int order, int n_arg, double *arg) {
+   FidFilter *rv;
+   STAT_START(t0);
+   rv= filter[fi].rout(rate, f0, f1, order, n_arg, arg);
+   STAT_STOP(st_des[fi], t0);
+   STAT_CALL(st_des[fi]);
+   return rv;
+}
+
+#define RUN_DESIGN(fi, rate, f0, f1, order, n_arg, arg) \
+   stats_design(fi, rate, f0, f1, order, n_arg, arg)
+
+#else
+
+#define RUN_DESIGN(fi, rate, f0, f1, order, n_arg, arg) \
+   filter[fi].rout(rate, f0, f1, order, n_arg, arg)
+
+#endif
+
 //
 //	Design a filter.  Spec and range are passed as arguments.  The
 //	return value is a pointer to a FidFilter as documented earlier
@@ -1355,8 +1594,10 @@ fid_design(char *spec, double rate, double freq0, double freq1, int f_adj, char
    Spec sp;
    double f0, f1;
    char *err;
+   STAT_START(t0);
 
    // Parse the filter-spec
+   STAT_CALL(st_design);
    sp.spec= spec;
    sp.in_f0= freq0;
    sp.in_f1= freq1;
@@ -1377,7 +1618,7 @@ fid_design(char *spec, double rate, double freq0, double freq1, int f_adj, char
 
    // Generate the filter
    if (!sp.adj)
-      rv= filter[sp.fi].rout(rate, f0, f1, sp.order, sp.n_arg, sp.argarr);
+      rv= RUN_DESIGN(sp.fi, rate, f0, f1, sp.order, sp.n_arg, sp.argarr);
    else if (strstr(filter[sp.fi].fmt, "#R"))
       rv= auto_adjust_dual(&sp, rate, f0, f1);
    else 
@@ -1425,6 +1666,7 @@ fid_design(char *spec, double rate, double freq0, double freq1, int f_adj, char
       *descp= desc;
    }
 
+   STAT_STOP(st_design, t0);
    return rv;
 }
 
@@ -1438,15 +1680,16 @@ fid_design(char *spec, double rate, double freq0, double freq1, int f_adj, char
 static FidFilter *
 auto_adjust_single(Spec *sp, double rate, double f0) {
    double a0, a1, a2;
-   FidFilter *(*design)(double,double,double,int,int,double*)= filter[sp->fi].rout;
    FidFilter *rv= 0;
    double resp;
    double r0, r2;
    int incr;		// Increasing (1) or decreasing (0)
    int a;
 
-#define DESIGN(aa) design(rate, aa, aa, sp->order, sp->n_arg, sp->argarr)
-#define TEST(aa) { if (rv) {free(rv);rv= 0;} rv= DESIGN(aa); resp= fid_response(rv, f0); }
+   STAT_CALL(st_adj_single);
+
+#define DESIGN(aa) RUN_DESIGN(sp->fi, rate, aa, aa, sp->order, sp->n_arg, sp->argarr)
+#define TEST(aa) { if (rv) {free(rv);rv= 0;} rv= DESIGN(aa); resp= fid_response(rv, f0); STAT_COUNT(st_adj_single, 1); }
 
    // Try and establish a range within which we can find the point
    a0= f0; TEST(a0); r0= resp;
@@ -1493,7 +1736,6 @@ static FidFilter *
 auto_adjust_dual(Spec *sp, double rate, double f0, double f1) {
    double mid= 0.5 * (f0+f1);
    double wid= 0.5 * fabs(f1-f0);
-   FidFilter *(*design)(double,double,double,int,int,double*)= filter[sp->fi].rout;
    FidFilter *rv= 0;
    int bpass= -1;
    double delta;
@@ -1505,15 +1747,17 @@ auto_adjust_dual(Spec *sp, double rate, double f0, double f1) {
    int cnt_design= 0;
 
 #define DESIGN(mm,ww) { if (rv) {free(rv);rv= 0;} \
-   rv= design(rate, mm-ww, mm+ww, sp->order, sp->n_arg, sp->argarr); \
+   rv= RUN_DESIGN(sp->fi, rate, mm-ww, mm+ww, sp->order, sp->n_arg, sp->argarr); \
    r0= fid_response(rv, f0); r1= fid_response(rv, f1); \
-   err0= fabs(M301DB-r0); err1= fabs(M301DB-r1); cnt_design++; }
+   err0= fabs(M301DB-r0); err1= fabs(M301DB-r1); cnt_design++; \
+   STAT_COUNT(st_adj_dual, 1); }
 
 #define INC_WID ((r0+r1 < 1.0) == bpass)
 #define INC_MID ((r0 > r1) == bpass)
 #define MATCH (err0 < 0.000000499 && err1 < 0.000000499)
 #define PERR (err0+err1)
 
+   STAT_CALL(st_adj_dual);
    DESIGN(mid, wid);
    bpass= (fid_response(rv, 0) < 0.5);
    delta= wid * 0.5;
@@ -1680,6 +1924,294 @@ fid_design_coef(double *coef, int n_coef, char *spec, double rate,
    return gain;
 }
    
+//
+//	Generate C source for running a filter: a fully unrolled,
+//	branch-free function named 'name' that runs one sample, and
+//	name_block() for runs of samples, which keeps the state and
+//	coefficients in locals across the loop.  The code is the same
+//	for every design of the given spec, with the non-constant
+//	coefficients passed in coef[] in fid_design_coef() order, and
+//	its gain passed separately.  Arguments after 'name' are as for
+//	fid_design_coef(), whose walk over the filter this follows.
+//	The sums are done in the same order as fid_run_new(), so the
+//	results match it bit for bit.  Returns a malloc'd string, and
+//	the number of coefficients in *n_coefp if it is non-zero.
+//
+
+typedef struct GenBuf {
+   char *buf;		// Text so far, NUL-terminated
+   int len;		// Its length
+   int max;		// Space allocated
+} GenBuf;
+
+static void
+gen_printf(GenBuf *gb, char *fmt, ...) {
+   va_list ap;
+   int len;
+
+   for (;;) {
+      va_start(ap, fmt);
+      len= vsnprintf(gb->buf + gb->len, gb->max - gb->len, fmt, ap);
+      va_end(ap);
+      if (len < 0) error("fid_gen_code: bad format");
+      if (gb->len + len < gb->max) break;
+      gb->max= 2 * (gb->len + len + 256);
+      if (!(gb->buf= realloc(gb->buf, gb->max))) error("Out of memory");
+   }
+   gb->len += len;
+}
+
+//
+//	Output "acc op coefficient * value;", or as near as a constant
+//	coefficient of 0, 1 or -1 allows, for op -= (IIR) or += (FIR,
+//	which is = for the first term).  Returns 0 if nothing was
+//	output.
+//
+
+static int
+gen_term(GenBuf *gb, char *ind, char *acc, int iir, int first, int var, int idx, 
+	 double val, int sidx) {
+   if (var)
+      gen_printf(gb, "%s%s %s c%d * s%d;\n", ind, acc, iir ? "-=" : first ? "=" : "+=", idx, sidx);
+   else if (val == 0.0)
+      return 0;
+   else if (val == 1.0 || val == -1.0) {
+      int neg= (val < 0) != iir;
+      if (first && !iir)
+	 gen_printf(gb, "%s%s= %ss%d;\n", ind, acc, neg ? "-" : "", sidx);
+      else
+	 gen_printf(gb, "%s%s %s s%d;\n", ind, acc, neg ? "-=" : "+=", sidx);
+   } else
+      gen_printf(gb, "%s%s %s %.17g * s%d;\n", ind, acc, iir ? "-=" : first ? "=" : "+=", val, sidx);
+   return 1;
+}
+
+//
+//	Output the body of the step, from 'iir' holding the input to
+//	'iir' holding the output before the gain.  Counts the
+//	coefficients and state values, and sets *use_firp if the 'fir'
+//	variable is needed.
+//
+
+static void
+gen_body(GenBuf *gb, FidFilter *ff, char *ind, int *n_coefp, int *n_bufp, int *use_firp) {
+   static double const_one= 1;
+   int n_coef= 0, n_buf= 0;
+   int a, len;
+
+   *use_firp= 0;
+   while (ff->typ) {
+      double *iir, *fir, iir_adj= 1.0;
+      int n_iir, n_fir, iir_cbm, fir_cbm, first= 1;
+      int var0, idx0= 0;
+
+      if (ff->typ == 'F' && ff->len == 1) {
+	 ff= FFNEXT(ff);
+	 continue;
+      }
+      if (ff->typ != 'I' && ff->typ != 'F')
+	 error("fid_gen_code can't handle FidFilter type: %c", ff->typ);
+
+      iir= fir= &const_one;
+      n_iir= n_fir= 1;
+      iir_cbm= fir_cbm= ~0;
+      if (ff->typ == 'I') {
+	 iir= ff->val; n_iir= ff->len; iir_cbm= ff->cbm;
+	 iir_adj= 1.0 / ff->val[0];
+	 ff= FFNEXT(ff);
+      }
+      if (ff->typ == 'F') {
+	 fir= ff->val; n_fir= ff->len; fir_cbm= ff->cbm;
+	 ff= FFNEXT(ff);
+      }
+
+      // As fid_design_coef(): highest delay first, IIR before FIR
+      len= n_fir > n_iir ? n_fir : n_iir;
+      for (a= len-1; a>0; a--) {
+	 if (a < n_iir) {
+	    int var= !(iir_cbm & (1<<(a<15?a:15)));
+	    gen_term(gb, ind, "iir", 1, 0, var, n_coef, iir_adj * iir[a], n_buf + a-1);
+	    if (var) n_coef++;
+	 }
+	 if (a < n_fir) {
+	    int var= !(fir_cbm & (1<<(a<15?a:15)));
+	    if (gen_term(gb, ind, "fir", 0, first, var, n_coef, fir[a], n_buf + a-1))
+	       first= 0;
+	    if (var) n_coef++;
+	 }
+      }
+      var0= !(fir_cbm & 1);
+      if (var0) idx0= n_coef++;
+      if (len < 2) continue;	// Just a gain
+
+      // Shift the history along, and put w[n] in at the front
+      for (a= len-1; a>1; a--)
+	 gen_printf(gb, "%ss%d= s%d;\n", ind, n_buf + a-1, n_buf + a-2);
+      gen_printf(gb, "%ss%d= iir;\n", ind, n_buf);
+
+      if (!first) *use_firp= 1;
+      if (var0)
+	 gen_printf(gb, "%siir= %sc%d * s%d;\n", ind, first ? "" : "fir + ", idx0, n_buf);
+      else if (fir[0] == 1.0) {
+	 if (!first) gen_printf(gb, "%siir= fir + s%d;\n", ind, n_buf);
+      } else if (fir[0] == 0.0)
+	 gen_printf(gb, "%siir= %s;\n", ind, first ? "0" : "fir");
+      else if (fir[0] == -1.0)
+	 gen_printf(gb, "%siir= %s- s%d;\n", ind, first ? "" : "fir ", n_buf);
+      else
+	 gen_printf(gb, "%siir= %s%.17g * s%d;\n", ind, first ? "" : "fir + ", fir[0], n_buf);
+      n_buf += len-1;
+   }
+   *n_coefp= n_coef;
+   *n_bufp= n_buf;
+}
+
+char *
+fid_gen_code(char *name, char *spec, double rate, double freq0, double freq1, 
+	     int adj, int *n_coefp) {
+   FidFilter *filt= fid_design(spec, rate, freq0, freq1, adj, 0);
+   GenBuf gb= { 0, 0, 0 }, step= { 0, 0, 0 }, loop= { 0, 0, 0 };
+   double *coef;
+   char *p;
+   int n_coef, n_buf, use_fir, a;
+
+   for (p= name; *p; p++) 
+      if (!(isalpha(*p) || *p == '_' || (p != name && isdigit(*p))))
+	 break;
+   if (!*name || *p)
+      error("fid_gen_code: \"%s\" isn't a C identifier", name);
+
+   gen_body(&step, filt, "   ", &n_coef, &n_buf, &use_fir);
+   gen_body(&loop, filt, "      ", &n_coef, &n_buf, &use_fir);
+   free(filt);
+
+   // Check the count against fid_design_coef() itself
+   coef= ALLOC_ARR(n_coef + 1, double);
+   fid_design_coef(coef, n_coef, spec, rate, freq0, freq1, adj);
+   free(coef);
+
+   gen_printf(&gb, "//\n"
+	      "//\t%s at %gHz, generated by fid_gen_code().  coef[] takes the\n"
+	      "//\t%d values given by fid_design_coef() for any design of this\n"
+	      "//\tspec, and gain the value it returns (or any other gain).\n"
+	      "//\tbuf[] holds %d values of state, zeroed to start.\n"
+	      "//\n\n", spec, rate, n_coef, n_buf);
+   gen_printf(&gb, "#define %s_N_COEF %d\n#define %s_N_BUF %d\n\n", name, n_coef, name, n_buf);
+
+   for (a= 0; a<2; a++) {
+      int b;
+      if (a == 0)
+	 gen_printf(&gb, "static inline double\n"
+		    "%s(double *buf, const double *coef, double gain, double in) {\n", name);
+      else
+	 gen_printf(&gb, "static inline void\n"
+		    "%s_block(double *buf, const double *coef, double gain, \n"
+		    "%*sconst double *in, double *out, int len) {\n", name, (int)strlen(name) + 7, "");
+      for (b= 0; b<n_coef; b++)
+	 gen_printf(&gb, "   const double c%d= coef[%d];\n", b, b);
+      for (b= 0; b<n_buf; b++)
+	 gen_printf(&gb, "   double s%d= buf[%d];\n", b, b);
+      if (!n_coef) gen_printf(&gb, "   (void)coef;\n");
+      if (!n_buf) gen_printf(&gb, "   (void)buf;\n");
+      if (a == 0) {
+	 gen_printf(&gb, "   double iir= in%s;\n\n%s\n", use_fir ? ", fir" : "", step.buf ? step.buf : "");
+      } else {
+	 gen_printf(&gb, "   double iir%s;\n   int i;\n\n"
+		    "   for (i= 0; i<len; i++) {\n"
+		    "      iir= in[i];\n%s"
+		    "      out[i]= iir * gain;\n"
+		    "   }\n", use_fir ? ", fir" : "", loop.buf ? loop.buf : "");
+      }
+      for (b= 0; b<n_buf; b++)
+	 gen_printf(&gb, "   buf[%d]= s%d;\n", b, b);
+      if (a == 0)
+	 gen_printf(&gb, "   return iir * gain;\n");
+      gen_printf(&gb, "}\n\n");
+   }
+
+   free(step.buf);
+   free(loop.buf);
+   if (n_coefp) *n_coefp= n_coef;
+   return gb.buf;
+}
+   
+//
+//	Convert a 2nd-order section, an IIR of n_iir (1..3) and an FIR
+//	of n_fir (1..3) coefficients, into the coefficients of one of
+//	the section structures below.  Five coefficients are written to
+//	coef[], and 1 is returned, or 0 if the section can't be
+//	represented in that form (only FID_FORM_COUPLED, for real
+//	poles).  The IIR needn't be normalised.
+//
+//	  FID_FORM_DIRECT: a1, a2, b0, b1, b2, the IIR and FIR divided
+//	    through by the IIR's first coefficient:
+//	      w[n]= x[n] - a1*w[n-1] - a2*w[n-2]
+//	      y[n]= b0*w[n] + b1*w[n-1] + b2*w[n-2]
+//
+//	  FID_FORM_COUPLED: rc, rs, d, cu, cv, the Gold-Rader coupled
+//	    form, for a complex pole pair r*exp(+/-j*theta), with
+//	    rc= r*cos(theta) - 1 and rs= r*sin(theta):
+//	      y[n]= d*x[n] + cu*u[n] + cv*v[n]
+//	      u[n+1]= u[n] + rc*u[n] - rs*v[n] + x[n]
+//	      v[n+1]= v[n] + rs*u[n] + rc*v[n]
+//
+//	  FID_FORM_SVF: g, k, m0, m1, m2, the trapezoidal state-variable
+//	    filter, as the bilinear transform of the analog section
+//	    (m0*(s^2 + k*s + 1) + m1*s + m2) / (s^2 + k*s + 1), s
+//	    normalised so that g= tan(pi * f0 / rate)
+//
+//	The coefficients of the last two stay well-scaled as the poles
+//	approach z=1, where those of the direct form are dominated by
+//	rounding in anything shorter than a double.
+//
+
+int
+fid_section_coef(double *iir, int n_iir, double *fir, int n_fir, int form, double *coef) {
+   double a1= n_iir > 1 ? iir[1] / iir[0] : 0.0;
+   double a2= n_iir > 2 ? iir[2] / iir[0] : 0.0;
+   double b0= fir[0] / iir[0];
+   double b1= n_fir > 1 ? fir[1] / iir[0] : 0.0;
+   double b2= n_fir > 2 ? fir[2] / iir[0] : 0.0;
+   double rr, p, q, g, k, d0, d1;
+
+   if (n_iir < 1 || n_iir > 3 || n_fir < 1 || n_fir > 3)
+      error("fid_section_coef: a section has at most 3 IIR and 3 FIR coefficients");
+
+   switch (form) {
+    case FID_FORM_DIRECT:
+       coef[0]= a1; coef[1]= a2;
+       coef[2]= b0; coef[3]= b1; coef[4]= b2;
+       return 1;
+    case FID_FORM_COUPLED:
+       // Split off the direct path: H= d + (p*z + q) / (z^2 + a1*z + a2)
+       if (4*a2 <= a1*a1) return 0;
+       rr= sqrt(a2 - 0.25*a1*a1);
+       p= b1 - b0*a1;
+       q= b2 - b0*a2;
+       coef[0]= -0.5 * (a1 + 2.0);
+       coef[1]= rr;
+       coef[2]= b0;
+       coef[3]= p;
+       coef[4]= (q - 0.5*a1*p) / rr;
+       return 1;
+    case FID_FORM_SVF:
+       // Map back through the bilinear transform: the denominator
+       // becomes g^2*d1*s^2 + 2*g*(1-a2)*s + d0
+       d0= 1.0 + a1 + a2;
+       d1= 1.0 - a1 + a2;
+       g= sqrt(d0 / d1);
+       k= 2.0 * (1.0 - a2) / (g * d1);
+       coef[0]= g;
+       coef[1]= k;
+       coef[2]= (b0 - b1 + b2) / d1;
+       coef[3]= 2.0 * g * (b0 - b2) / d0 - coef[2] * k;
+       coef[4]= (b0 + b1 + b2) / d0 - coef[2];
+       return 1;
+   }
+   error("fid_section_coef: unknown form %d", form);
+   return 0;
+}
+
 //
 //	List all the known filters to the given file handle
 //
@@ -1804,15 +2336,261 @@ fid_flatten(FidFilter *filt) {
 }
 
 //
-//	Parse a filter-spec and freq0/freq1 arguments.  Returns a
-//	strdup'd error string on error, or else 0.
+//	Fast number parsing for spec-strings and filter lists.  These
+//	don't depend on the current locale, and avoid the overhead of
+//	strtod() for the short decimal numbers that normally appear.
+//
+//	parse_double() uses the exact fast path (Clinger): if the
+//	decimal mantissa fits in 53 bits and the power of ten is within
+//	1e22, a single multiply or divide of two exact doubles gives
+//	the correctly rounded result, the same as strtod().  Where long
+//	double has a 64-bit mantissa (x86), up to 19 digits are handled
+//	the same way in long double, and the result is used unless it
+//	is too close to a halfway point between two doubles to round
+//	reliably.  That covers "%.17g" output.  Anything else (big
+//	exponents, hex, inf/nan, leading white space) falls back to
+//	strtod(), with the '.' translated to the locale's decimal point
+//	if necessary.
+//
+//	The text runs up to 'end', or up to the NUL if 'end' is 0, so
+//	these can also be used on text that isn't NUL-terminated.
 //
 
-static char *
-parse_spec(Spec *sp) {
-   double *arg;
+static double
+locale_strtod(char *p, char *end, char **endp) {
+   char *dp= localeconv()->decimal_point;
+   char buf[128], *tmp, *q;
+   int a, len;
+   double rv;
+
+   if (!end && dp[0] == '.' && !dp[1]) 
+      return strtod(p, endp);
+
+   // Copy the text with the decimal point replaced, into 'buf' if it
+   // fits, otherwise into a copy on the heap.  Only the white space
+   // and characters that strtod() may accept are copied, not the
+   // rest of the spec.
+   for (len= 0; p+len != end && p[len] && isspace(p[len]); len++) ;
+   for (; p+len != end && p[len] && 
+	   (isalnum(p[len]) || strchr("+-.()_", p[len])); len++) ;
+   tmp= len < sizeof(buf) ? buf : Alloc(len+1);
+   for (a= 0; a<len; a++)
+      tmp[a]= (p[a] == '.') ? dp[0] : p[a];
+   tmp[a]= 0;
+   rv= strtod(tmp, &q);
+   *endp= p + (q-tmp);
+   if (tmp != buf) free(tmp);
+   return rv;
+}
+
+static double
+parse_double(char *p, char *end, char **endp) {
+   static double pow10[]= {
+      1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+      1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+   };
+   unsigned long long mant= 0;
+   int n_dig= 0;
+   int exp10= 0;
+   int neg= 0;
+   char *q= p;
+   double val;
+
+#define DIGIT(qq) ((qq) != end && isdigit(*(qq)))
+
+   if (q != end && (*q == '+' || *q == '-')) neg= (*q++ == '-');
+   if (!DIGIT(q) && !(q != end && *q == '.' && DIGIT(q+1))) goto slow;
+   if (q[0] == '0' && q+1 != end && (q[1] == 'x' || q[1] == 'X')) goto slow;
+
+   for (; DIGIT(q); q++) {
+      if (n_dig >= 19) goto slow;
+      mant= mant * 10 + (*q - '0');
+      if (mant) n_dig++;
+   }
+   if (q != end && *q == '.') {
+      for (q++; DIGIT(q); q++) {
+	 if (n_dig >= 19) goto slow;
+	 mant= mant * 10 + (*q - '0');
+	 if (mant) n_dig++;
+	 exp10--;
+      }
+   }
+   if (q != end && (*q == 'e' || *q == 'E')) {
+      char *r= q+1;
+      int eneg= 0, ev= 0;
+      if (r != end && (*r == '+' || *r == '-')) eneg= (*r++ == '-');
+      if (DIGIT(r)) {
+	 for (; DIGIT(r); r++) {
+	    if (ev > 1000) goto slow;
+	    ev= ev * 10 + (*r - '0');
+	 }
+	 exp10 += eneg ? -ev : ev;
+	 q= r;
+      }
+   }
+   if (exp10 < -22 || exp10 > 22) goto slow;
+
+#undef DIGIT
+
+   if (mant <= (1ULL<<53)) {
+      val= (double)mant;
+      val= exp10 < 0 ? val / pow10[-exp10] : val * pow10[exp10];
+   } else {
+#if LDBL_MANT_DIG == 64 && (defined(__x86_64__) || defined(__i386__))
+      // x87 layout: 64-bit mantissa with explicit top bit first.
+      // The 11 bits below double precision must not be within one
+      // unit of halfway (0x400), as the exact value may then round
+      // the other way.
+      union { long double ld; unsigned long long mant; } uu;
+      unsigned int low;
+      uu.ld= (long double)mant;
+      uu.ld= exp10 < 0 ? uu.ld / pow10[-exp10] : uu.ld * pow10[exp10];
+      low= (unsigned int)(uu.mant & 0x7FF);
+      if (low >= 0x3FF && low <= 0x401) goto slow;
+      val= (double)uu.ld;
+#else
+      goto slow;
+#endif
+   }
+   *endp= q;
+   return neg ? -val : val;
+
+ slow:
+   return locale_strtod(p, end, endp);
+}
+
+static int
+parse_int(char *p, char **endp) {
+   int neg= 0;
+   int val= 0;
+   char *q= p;
+
+   if (*q == '+' || *q == '-') neg= (*q++ == '-');
+   if (!isdigit(*q)) return (int)strtol(p, endp, 10);
+   for (; isdigit(*q); q++) {
+      if (q-p > 9) return (int)strtol(p, endp, 10);
+      val= val * 10 + (*q - '0');
+   }
+   *endp= q;
+   return neg ? -val : val;
+}
+
+//
+//	Spec-string dispatch.  Every format in filter[] starts with a
+//	unique name made up of letters ("BpRe", "LpBuZ", etc), which
+//	has to be matched exactly by the leading letters of the
+//	spec-string.  A small hash table over these names is built on
+//	first use, so that parse_spec() can go straight to the right
+//	entry rather than trying every format in turn.
+//
+
+#define SPEC_HASH_SIZE 256	// Power of 2, comfortably more than 2x entries in filter[]
+
+static unsigned char spec_hash[SPEC_HASH_SIZE];	// filter[] index + 1, or 0 if empty
+static long spec_hash_state= 0;		// SPEC_HASH_EMPTY/BUILDING/READY
+
+#define SPEC_HASH_EMPTY 0
+#define SPEC_HASH_BUILDING 1
+#define SPEC_HASH_READY 2
+
+#ifdef T_MSVC
+ #include <intrin.h>
+ #define STATE_LOAD() _InterlockedCompareExchange((volatile long *)&spec_hash_state, 0, 0)
+ #define STATE_STORE(vv) _InterlockedExchange((volatile long *)&spec_hash_state, (vv))
+ #define STATE_CAS(ep, vv) (*(ep) == _InterlockedCompareExchange( \
+	(volatile long *)&spec_hash_state, (vv), *(ep)))
+#else
+ #define STATE_LOAD() __atomic_load_n(&spec_hash_state, __ATOMIC_ACQUIRE)
+ #define STATE_STORE(vv) __atomic_store_n(&spec_hash_state, (vv), __ATOMIC_RELEASE)
+ #define STATE_CAS(ep, vv) __atomic_compare_exchange_n(&spec_hash_state, (ep), (vv), 0, \
+					 __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+#endif
+
+STATIC_INLINE int
+spec_name_len(char *p) {
+   int len= 0;
+   while (isalpha(p[len])) len++;
+   return len;
+}
+
+STATIC_INLINE unsigned int
+spec_name_hash(char *p, int len) {
+   unsigned int hh= 2166136261U;	// FNV-1a
+   while (len-- > 0) {
+      hh ^= (unsigned char)*p++;
+      hh *= 16777619U;
+   }
+   return hh;
+}
+
+//
+//	Build spec_hash[].  Only the one thread that moves the state
+//	from EMPTY to BUILDING writes the table; any others that get
+//	here meanwhile wait for it to become READY, and nothing writes
+//	spec_hash[] after that.
+//
+
+static void
+spec_hash_init() {
+   long empty= SPEC_HASH_EMPTY;
    int a;
 
+   for (a= 0; filter[a].fmt; a++) ;
+   if (a > 255) error("Internal error: too many filters for spec_hash[]");
+
+   if (!STATE_CAS(&empty, SPEC_HASH_BUILDING)) {
+      while (STATE_LOAD() != SPEC_HASH_READY) ;
+      return;
+   }
+
+   for (a= 0; filter[a].fmt; a++) {
+      char *fmt= filter[a].fmt;
+      int len= spec_name_len(fmt);
+      unsigned int hh= spec_name_hash(fmt, len);
+      while (spec_hash[hh & (SPEC_HASH_SIZE-1)]) hh++;
+      spec_hash[hh & (SPEC_HASH_SIZE-1)]= a+1;
+   }
+   STATE_STORE(SPEC_HASH_READY);
+}
+
+//
+//	Find the filter[] index whose name matches the start of the
+//	given spec-string, or -1 if none does.
+//
+
+static int
+spec_lookup(char *spec) {
+   int len= spec_name_len(spec);
+   unsigned int hh= spec_name_hash(spec, len);
+   int ent;
+
+   if (STATE_LOAD() != SPEC_HASH_READY) spec_hash_init();
+
+   while ((ent= spec_hash[hh & (SPEC_HASH_SIZE-1)])) {
+      char *fmt= filter[ent-1].fmt;
+      if (0 == memcmp(fmt, spec, len) && !isalpha(fmt[len]))
+	 return ent-1;
+      hh++;
+   }
+   return -1;
+}
+
+//
+//	Try to match a spec-string against the format of filter[a].
+//	Returns 0 if it doesn't match and the next format should be
+//	tried, or else 1, in which case *errp is 0 for a successful
+//	match, or a strdup'd error string.
+//
+
+static int
+match_spec(Spec *sp, int a, char **errp) {
+   char *fmt= filter[a].fmt;
+   char *p= sp->spec;
+   double *arg;
+   char ch, *q;
+
+#define FAIL(err) { *errp= (err); return 1; }
+
    arg= sp->argarr;
    sp->n_arg= 0;
    sp->order= 0;
@@ -1822,106 +2600,119 @@ parse_spec(Spec *sp) {
    sp->minlen= -1;
    sp->n_freq= 0;
    
-   for (a= 0; 1; a++) {
-      char *fmt= filter[a].fmt;
-      char *p= sp->spec;
-      char ch, *q;
-
-      if (!fmt) return strdupf("Spec-string \"%s\" matches no known format", sp->spec);
-
-      while (*p && (ch= *fmt++)) {
-	 if (ch != '#') {
-	    if (ch == *p++) continue;
-	    p= 0; break;
-	 }
+   while (*p && (ch= *fmt++)) {
+      if (ch != '#') {
+	 if (ch == *p++) continue;
+	 return 0;
+      }
 
-	 if (isalpha(*p)) { p= 0; break; }
+      if (isalpha(*p)) return 0;
 
-	 // Handling a format character
-	 switch (ch= *fmt++) {
-	  default:
-	     return strdupf("Internal error: Unknown format #%c in format: %s", 
-			    fmt[-1], filter[a].fmt);
-	  case 'o':
-	  case 'O':
-	     sp->order= (int)strtol(p, &q, 10);
-	     if (p == q) {
-		if (ch == 'O') goto bad;
-		sp->order= 1;
-	     }
-	     if (sp->order <= 0) 
-		return strdupf("Bad order %d in spec-string \"%s\"", sp->order, sp->spec);
-	     p= q; break;
-	  case 'V':
-	     sp->n_arg++; 
-	     *arg++= strtod(p, &q);
-	     if (p == q) goto bad; 
-	     p= q; break;
-	  case 'F':
-	     sp->minlen= p-1-sp->spec;
-	     sp->n_freq= 1;
-	     sp->adj= (p[0] == '=');
-	     if (sp->adj) p++;
-	     sp->f0= strtod(p, &q);
-	     sp->f1= 0;
-	     if (p == q) goto bad; 
-	     p= q; break;
-	  case 'R':
-	     sp->minlen= p-1-sp->spec;
-	     sp->n_freq= 2;
-	     sp->adj= (p[0] == '=');
-	     if (sp->adj) p++;
-	     sp->f0= strtod(p, &q);
-	     if (p == q) goto bad; 
-	     p= q;
-	     if (*p++ != '-') goto bad;
-	     sp->f1= strtod(p, &q);
-	     if (p == q) goto bad; 
-	     if (sp->f0 > sp->f1) 
-		return strdupf("Backwards frequency range in spec-string \"%s\"", sp->spec);
-	     p= q; break;
-	 }
+      // Handling a format character
+      switch (ch= *fmt++) {
+       default:
+	  FAIL(strdupf("Internal error: Unknown format #%c in format: %s", 
+		       fmt[-1], filter[a].fmt));
+       case 'o':
+       case 'O':
+	  sp->order= parse_int(p, &q);
+	  if (p == q) {
+	     if (ch == 'O') goto bad;
+	     sp->order= 1;
+	  }
+	  if (sp->order <= 0) 
+	     FAIL(strdupf("Bad order %d in spec-string \"%s\"", sp->order, sp->spec));
+	  p= q; break;
+       case 'V':
+	  sp->n_arg++; 
+	  *arg++= parse_double(p, 0, &q);
+	  if (p == q) goto bad; 
+	  p= q; break;
+       case 'F':
+	  sp->minlen= p-1-sp->spec;
+	  sp->n_freq= 1;
+	  sp->adj= (p[0] == '=');
+	  if (sp->adj) p++;
+	  sp->f0= parse_double(p, 0, &q);
+	  sp->f1= 0;
+	  if (p == q) goto bad; 
+	  p= q; break;
+       case 'R':
+	  sp->minlen= p-1-sp->spec;
+	  sp->n_freq= 2;
+	  sp->adj= (p[0] == '=');
+	  if (sp->adj) p++;
+	  sp->f0= parse_double(p, 0, &q);
+	  if (p == q) goto bad; 
+	  p= q;
+	  if (*p++ != '-') goto bad;
+	  sp->f1= parse_double(p, 0, &q);
+	  if (p == q) goto bad; 
+	  if (sp->f0 > sp->f1) 
+	     FAIL(strdupf("Backwards frequency range in spec-string \"%s\"", sp->spec));
+	  p= q; break;
       }
+   }
 
-      if (p == 0) continue;
-
-      if (fmt[0] == '/' && fmt[1] == '#' && fmt[2] == 'F') {
-	 sp->minlen= p-sp->spec;
-	 sp->n_freq= 1;
-	 if (sp->in_f0 < 0.0) 
-	    return strdupf("Frequency omitted from filter-spec, and no default provided");
-	 sp->f0= sp->in_f0;
-	 sp->f1= 0;
-	 sp->adj= sp->in_adj;
-	 fmt += 3;
-      } else if (fmt[0] == '/' && fmt[1] == '#' && fmt[2] == 'R') {
-	 sp->minlen= p-sp->spec;
-	 sp->n_freq= 2;
-	 if (sp->in_f0 < 0.0 || sp->in_f1 < 0.0)
-	    return strdupf("Frequency omitted from filter-spec, and no default provided");
-	 sp->f0= sp->in_f0;
-	 sp->f1= sp->in_f1;
-	 sp->adj= sp->in_adj;
-	 fmt += 3;
-      }
+   if (fmt[0] == '/' && fmt[1] == '#' && fmt[2] == 'F') {
+      sp->minlen= p-sp->spec;
+      sp->n_freq= 1;
+      if (sp->in_f0 < 0.0) 
+	 FAIL(strdupf("Frequency omitted from filter-spec, and no default provided"));
+      sp->f0= sp->in_f0;
+      sp->f1= 0;
+      sp->adj= sp->in_adj;
+      fmt += 3;
+   } else if (fmt[0] == '/' && fmt[1] == '#' && fmt[2] == 'R') {
+      sp->minlen= p-sp->spec;
+      sp->n_freq= 2;
+      if (sp->in_f0 < 0.0 || sp->in_f1 < 0.0)
+	 FAIL(strdupf("Frequency omitted from filter-spec, and no default provided"));
+      sp->f0= sp->in_f0;
+      sp->f1= sp->in_f1;
+      sp->adj= sp->in_adj;
+      fmt += 3;
+   }
 
-      // Check for trailing unmatched format characters
-      if (*fmt) {
-      bad:
-	 return strdupf("Bad match of spec-string \"%s\" to format \"%s\"", 
-			sp->spec, filter[a].fmt);
-      }
-      if (sp->n_arg > MAXARG) 
-	 return strdupf("Internal error -- maximum arguments exceeded");
+   // Check for trailing unmatched format characters
+   if (*fmt) {
+   bad:
+      FAIL(strdupf("Bad match of spec-string \"%s\" to format \"%s\"", 
+		   sp->spec, filter[a].fmt));
+   }
+   if (sp->n_arg > MAXARG) 
+      FAIL(strdupf("Internal error -- maximum arguments exceeded"));
       
-      // Set the minlen to the whole string if unset
-      if (sp->minlen < 0) sp->minlen= p-sp->spec;
+   // Set the minlen to the whole string if unset
+   if (sp->minlen < 0) sp->minlen= p-sp->spec;
       
-      // Save values, return
-      sp->fi= a;
-      return 0;
-   }
-   return 0;
+   // Save values, return
+   sp->fi= a;
+   FAIL(0);
+
+#undef FAIL
+}
+
+//
+//	Parse a filter-spec and freq0/freq1 arguments.  Returns a
+//	strdup'd error string on error, or else 0.
+//
+
+static char *
+parse_spec(Spec *sp) {
+   char *err;
+   int a;
+
+   // Normally the name picks out the only format that can match
+   a= spec_lookup(sp->spec);
+   if (a >= 0 && match_spec(sp, a, &err)) return err;
+
+   // Otherwise try them all in turn, which gives the same errors
+   // for partial matches as always
+   for (a= 0; filter[a].fmt; a++) 
+      if (match_spec(sp, a, &err)) return err;
+
+   return strdupf("Spec-string \"%s\" matches no known format", sp->spec);
 }
    
 
@@ -2083,92 +2874,102 @@ fid_cat(int freeme, ...) {
 //
 
 // Skip white space (including comments)
-static void 
-skipWS(char **pp) {
-   char *p= *pp;
-
-   while (*p) {
+static char *
+skipWS(char *p, char *end) {
+   while (p != end) {
       if (isspace(*p)) { p++; continue; }
       if (*p == '#') {
-         while (*p && *p != '\n') p++;
+         while (p != end && *p != '\n') p++;
          continue;
       }
       break;
    }
-   *pp= p;
+   return p;
 }
 
-// Grab a word from the input into the given buffer.  Returns 0: end
-// of file or error, else 1: success.  Error is indicated when the
-// word doesn't fit in the buffer.
-static int 
-grabWord(char **pp, char *buf, int buflen) {
-   char *p, *q;
-   int len; 
+// Find the end of the word starting at 'p'
+static char *
+wordEnd(char *p, char *end) {
+   char *q= p;
    
-   skipWS(pp);
-   p= *pp;
-   if (!*p) return 0;
-
-   q= p;
-   if (*q == ',' || *q == ';' || *q == ')' || *q == ']' || *q == '}') {
+   if (q == end) return q;
+   if (*q == ',' || *q == ';' || *q == ')' || *q == ']' || *q == '}') 
+      return q+1;
+   while (q != end && *q && *q != '#' && !isspace(*q) && 
+	  (*q != ',' && *q != ';' && *q != ')' && *q != ']' && *q != '}'))
       q++;
-   } else {
-      while (*q && *q != '#' && !isspace(*q) && 
-	     (*q != ',' && *q != ';' && *q != ')' && *q != ']' && *q != '}'))
-	 q++;
+   return q;
+}
+
+// Returns 1 if the word from 'p' to 'q' is a number, which is put
+// in *valp, or 0 otherwise.  If the word is followed by a delimiter,
+// the number parsing can't run past it, so the text is treated as
+// terminated, which saves copying it for strtod().
+STATIC_INLINE int
+wordNumber(char *p, char *q, char *end, double *valp) {
+   char *r;
+   if (p == q) return 0;
+   *valp= parse_double(p, q == end ? end : 0, &r);
+   return r == q;
+}
+
+// Quick check for a word which is certainly a plain decimal number,
+// without working out its value: [+-]digits[.digits][e[+-]digits].
+// Anything else (hex, inf, nan, or not a number) returns 0.
+static int
+wordDecimal(char *p, char *q) {
+   int n_dig= 0;
+
+   if (p != q && (*p == '+' || *p == '-')) p++;
+   for (; p != q && isdigit(*p); p++) n_dig++;
+   if (p != q && *p == '.') 
+      for (p++; p != q && isdigit(*p); p++) n_dig++;
+   if (!n_dig) return 0;
+   if (p != q && (*p == 'e' || *p == 'E')) {
+      p++;
+      if (p != q && (*p == '+' || *p == '-')) p++;
+      if (p == q || !isdigit(*p)) return 0;
+      while (p != q && isdigit(*p)) p++;
    }
-   len= q-p;
-   if (len >= buflen) return 0;
-   
-   memcpy(buf, p, len);
-   buf[len]= 0;
-   
-   *pp= q;
-   return 1;
+   return p == q;
 }
 
 //
-//	Parse an entire filter specification, perhaps consisting of
-//	several FIR, IIR and predefined filters.  Stops at the first
-//	,; or unmatched )]}.  Returns either 0 on success, or else a
-//	strdup'd error string.
-//
-//	This duplicates code from Fiview filter.c, I know, but this
-//	may have to expand in the future to handle '+' operations, and
-//	special filter types like tunable heterodyne filters.  At that
-//	point, the filter.c code will have to be modified to call a
-//	version of this routine.
+//	State for the two passes of fid_parse_n().  The first pass
+//	checks the syntax, designs any predefined filters and works
+//	out the exact size of the output; the second pass fills in the
+//	output.  This avoids growing the output buffer as it goes, and
+//	there is no limit on the length of a coefficient list.  Plain
+//	decimal numbers are only recognised in the first pass, and
+//	their values are only worked out in the second.
 //
 
-char *
-fid_parse(double rate, char **pp, FidFilter **ffp) {
+typedef struct ParseOut ParseOut;
+struct ParseOut {
+   char *rv;		// Output buffer, or 0 in the first pass
+   int len;		// Bytes of output so far
+   FidFilter **pre;	// Predefined filters designed in the first pass
+   int n_pre, max_pre;
+   int i_pre;		// Next one to copy in the second pass
+};
+
+static char *
+parse_pass(double rate, char **pp, char *end, ParseOut *po) {
    char buf[128];
-   char *p= *pp, *rew;
-#define INIT_LEN 128
-   char *rv= Alloc(INIT_LEN);
-   char *rvend= rv + INIT_LEN;
-   char *rvp= rv;
-   char *tmp;
-#undef INIT_LEN
-   FidFilter *curr;
+   char *p= *pp, *q, *rew;
    int xtra= FFCSIZE(0,0);
    int typ= -1;		// First time through
-   double val;
-   char dmy;
+   double val= 0;
+
+#define ERR(ptr, msg) { *pp= ptr; return msg; }
+#define NUMBER(pp, qq) (po->rv ? wordNumber(pp, qq, end, &val) : \
+			(wordDecimal(pp, qq) || wordNumber(pp, qq, end, &val)))
 
-#define ERR(ptr, msg) { *pp= ptr; *ffp= 0; return msg; }
-#define INCBUF { tmp= realloc(rv, (rvend-rv) * 2); if (!tmp) error("Out of memory"); \
- rvend= (rvend-rv) * 2 + tmp; rvp= (rvp-rv) + tmp; \
- curr= (void*)(((char*)curr) - rv + tmp); rv= tmp; }
-   
    while (1) {
       rew= p;
-      if (!grabWord(&p, buf, sizeof(buf))) {
-	 if (*p) ERR(p, strdupf("Filter element unexpectedly long -- syntax error?"));
-	 buf[0]= 0;
-      }
-      if (!buf[0] || !buf[1]) switch (buf[0]) {
+      p= skipWS(p, end);
+      q= wordEnd(p, end);
+      if (q-p <= 1) switch (p == q ? 0 : *p) {
        default:
 	  break;
        case 0:
@@ -2177,28 +2978,25 @@ fid_parse(double rate, char **pp, FidFilter **ffp) {
        case ')':
        case ']':
        case '}':
-	  // End of filter, return it
-	  tmp= realloc(rv, (rvp-rv) + xtra);
-	  if (!tmp) error("Out of memory");
-	  curr= (void*)((rvp-rv) + tmp);
-	  curr->typ= 0; curr->cbm= 0; curr->len= 0;
-	  *pp= buf[0] ? (p-1) : p;
-	  *ffp= (FidFilter*)tmp;
+	  // End of filter
+	  *pp= p;
 	  return 0;
        case '/':
 	  if (typ > 0) ERR(rew, strdupf("Filter syntax error; unexpected '/'"));
 	  typ= 'I';
+	  p= q;
 	  continue;
        case 'x':
 	  if (typ > 0) ERR(rew, strdupf("Filter syntax error; unexpected 'x'"));
 	  typ= 'F';
+	  p= q;
 	  continue;
       }
 
       if (typ < 0) typ= 'F';		// Assume 'x' if missing
-      if (!typ) ERR(p, strdupf("Expecting a 'x' or '/' before this"));
+      if (!typ) ERR(q, strdupf("Expecting a 'x' or '/' before this"));
 
-      if (1 != sscanf(buf, "%lf %c", &val, &dmy)) {
+      if (!NUMBER(p, q)) {
 	 // Must be a predefined filter
 	 FidFilter *ff;
 	 FidFilter *ff1;
@@ -2208,80 +3006,312 @@ fid_parse(double rate, char **pp, FidFilter **ffp) {
 	 int len;
 
 	 if (typ != 'F') ERR(rew, strdupf("Predefined filters cannot be used with '/'"));
-
-	 // Parse the filter-spec
-	 memset(&sp, 0, sizeof(sp));
-	 sp.spec= buf;
-	 sp.in_f0= sp.in_f1= -1;
-	 if ((err= parse_spec(&sp))) ERR(rew, err);
-	 f0= sp.f0;
-	 f1= sp.f1;
+	 if (q-p >= sizeof(buf)) ERR(p, strdupf("Filter element unexpectedly long -- syntax error?"));
+
+	 if (po->rv) {
+	    // Second pass: already designed
+	    ff= po->pre[po->i_pre++];
+	 } else {
+	    memcpy(buf, p, q-p);
+	    buf[q-p]= 0;
+
+	    // Parse the filter-spec
+	    memset(&sp, 0, sizeof(sp));
+	    sp.spec= buf;
+	    sp.in_f0= sp.in_f1= -1;
+	    if ((err= parse_spec(&sp))) ERR(rew, err);
+	    f0= sp.f0;
+	    f1= sp.f1;
 	 
-	 // Adjust frequencies to range 0-0.5, and check them
-	 f0 /= rate;
-	 if (f0 > 0.5) ERR(rew, strdupf("Frequency of %gHz out of range with "
-					"sampling rate of %gHz", f0*rate, rate));
-	 f1 /= rate;
-	 if (f1 > 0.5) ERR(rew, strdupf("Frequency of %gHz out of range with "
-					"sampling rate of %gHz", f1*rate, rate));
+	    // Adjust frequencies to range 0-0.5, and check them
+	    f0 /= rate;
+	    if (f0 > 0.5) ERR(rew, strdupf("Frequency of %gHz out of range with "
+					   "sampling rate of %gHz", f0*rate, rate));
+	    f1 /= rate;
+	    if (f1 > 0.5) ERR(rew, strdupf("Frequency of %gHz out of range with "
+					   "sampling rate of %gHz", f1*rate, rate));
 	 
-	 // Okay we now have a successful spec-match to filter[sp.fi], and sp.n_arg
-	 // args are now in sp.argarr[]
+	    // Okay we now have a successful spec-match to filter[sp.fi], and sp.n_arg
+	    // args are now in sp.argarr[]
 	 
-	 // Generate the filter
-	 if (!sp.adj)
-	    ff= filter[sp.fi].rout(rate, f0, f1, sp.order, sp.n_arg, sp.argarr);
-	 else if (strstr(filter[sp.fi].fmt, "#R"))
-	    ff= auto_adjust_dual(&sp, rate, f0, f1);
-	 else 
-	    ff= auto_adjust_single(&sp, rate, f0);
+	    // Generate the filter
+	    if (!sp.adj)
+	       ff= RUN_DESIGN(sp.fi, rate, f0, f1, sp.order, sp.n_arg, sp.argarr);
+	    else if (strstr(filter[sp.fi].fmt, "#R"))
+	       ff= auto_adjust_dual(&sp, rate, f0, f1);
+	    else 
+	       ff= auto_adjust_single(&sp, rate, f0);
+
+	    // Keep it for the second pass
+	    if (po->n_pre == po->max_pre) {
+	       po->max_pre= po->max_pre ? po->max_pre * 2 : 8;
+	       po->pre= realloc(po->pre, po->max_pre * sizeof(FidFilter*));
+	       if (!po->pre) error("Out of memory");
+	    }
+	    po->pre[po->n_pre++]= ff;
+	 }
 
 	 // Append it to our FidFilter to return
 	 for (ff1= ff; ff1->typ; ff1= FFNEXT(ff1)) ;
 	 len= ((char*)ff1-(char*)ff);
-	 while (rvp + len + xtra >= rvend) INCBUF;
-	 memcpy(rvp, ff, len); rvp += len;
-	 free(ff);
+	 if (po->rv) {
+	    memcpy(po->rv + po->len, ff, len);
+	    free(ff);
+	 }
+	 po->len += len;
+	 p= q;
 	 typ= 0;
 	 continue;
       }
 
-      // Must be a list of coefficients
-      curr= (void*)rvp;
-      rvp += xtra;
-      while (rvp + sizeof(double) >= rvend) INCBUF;
-      curr->typ= typ;
-      curr->cbm= ~0;
-      curr->len= 1;
-      *(double*)rvp= val;
-      rvp += sizeof(double);
-
-      // See how many more coefficients we can pick up
-      while (1) {
-	 rew= p;
-	 if (!grabWord(&p, buf, sizeof(buf))) {
-	    if (*p) ERR(p, strdupf("Filter element unexpectedly long -- syntax error?"));
-	    buf[0]= 0;
+      // Must be a list of coefficients; pick up as many as we can
+      {
+	 FidFilter *curr= po->rv ? (FidFilter*)(po->rv + po->len) : 0;
+	 int cnt= 0;
+
+	 po->len += xtra;
+	 while (1) {
+	    if (po->rv) *(double*)(po->rv + po->len)= val;
+	    po->len += sizeof(double);
+	    cnt++;
+
+	    p= q;
+	    rew= p;
+	    p= skipWS(p, end);
+	    q= wordEnd(p, end);
+	    if (!NUMBER(p, q)) {
+	       p= rew;
+	       break;
+	    }
 	 }
-	 if (1 != sscanf(buf, "%lf %c", &val, &dmy)) {
-	    p= rew;
-	    break;
+	 if (po->rv) {
+	    curr->typ= typ;
+	    curr->cbm= ~0;
+	    curr->len= cnt;
 	 }
-	 while (rvp + sizeof(double) >= rvend) INCBUF;
-	 curr->len++;
-	 *(double*)rvp= val;
-	 rvp += sizeof(double);
       }
       typ= 0;
       continue;
    }
 
-#undef INCBUF
+#undef NUMBER
 #undef ERR
 
    return strdupf("Internal error, shouldn't reach here");
 }
 
+//
+//	Parse an entire filter specification, perhaps consisting of
+//	several FIR, IIR and predefined filters.  Stops at the first
+//	,; or unmatched )]}.  Returns either 0 on success, or else a
+//	strdup'd error string.
+//
+//	fid_parse_n() takes text running from *pp to 'end', which
+//	doesn't have to be NUL-terminated, so it can be used directly
+//	on a memory-mapped file or a slice of a larger buffer.
+//	fid_parse() is the same for a NUL-terminated string.
+//
+//	This duplicates code from Fiview filter.c, I know, but this
+//	may have to expand in the future to handle '+' operations, and
+//	special filter types like tunable heterodyne filters.  At that
+//	point, the filter.c code will have to be modified to call a
+//	version of this routine.
+//
+
+char *
+fid_parse_n(double rate, char **pp, char *end, FidFilter **ffp) {
+   ParseOut po;
+   char *p= *pp;
+   char *err;
+   int a;
+
+   // First pass: check everything and find the output size
+   memset(&po, 0, sizeof(po));
+   err= parse_pass(rate, &p, end, &po);
+   if (err) {
+      for (a= 0; a<po.n_pre; a++) free(po.pre[a]);
+      free(po.pre);
+      *pp= p;
+      *ffp= 0;
+      return err;
+   }
+
+   // Second pass: fill in the output, which is already terminated
+   // thanks to the zeroed allocation
+   po.rv= Alloc(po.len + FFCSIZE(0,0));
+   po.len= 0;
+   p= *pp;
+   err= parse_pass(rate, &p, end, &po);
+   if (err) error("Internal error: fid_parse second pass failed: %s", err);
+   free(po.pre);
+
+   *pp= p;
+   *ffp= (FidFilter*)po.rv;
+   return 0;
+}
+
+char *
+fid_parse(double rate, char **pp, FidFilter **ffp) {
+   return fid_parse_n(rate, pp, *pp + strlen(*pp), ffp);
+}
+
+//
+//	Load a file containing a list of filters separated by ',' or
+//	';', for example a bank of externally-designed FIR filters.
+//	The file is memory-mapped where possible, and parsed in place
+//	with fid_parse_n().  The filters are returned as a 0-terminated
+//	array of FidFilter*, which should be released by free()ing each
+//	filter and then the array.  Returns either 0 on success, or
+//	else a strdup'd error string, including the line number.
+//
+
+#ifdef T_LINUX
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+char *
+fid_parse_file(double rate, char *fnam, FidFilter ***listp) {
+   FidFilter **list, *ff;
+   int n_list= 0, max_list= 16;
+   char *txt, *p, *end, *err;
+   long len;
+#ifdef T_LINUX
+   struct stat st;
+   int fd;
+
+   fd= open(fnam, O_RDONLY);
+   if (fd < 0) return strdupf("Can't open file: %s", fnam);
+   if (fstat(fd, &st) < 0) { close(fd); return strdupf("Can't stat file: %s", fnam); }
+   len= st.st_size;
+   txt= len ? mmap(0, len, PROT_READ, MAP_PRIVATE, fd, 0) : "";
+   close(fd);
+   if (txt == MAP_FAILED) return strdupf("Can't map file: %s", fnam);
+#else
+   FILE *in= fopen(fnam, "rb");
+   if (!in) return strdupf("Can't open file: %s", fnam);
+   fseek(in, 0, SEEK_END);
+   len= ftell(in);
+   fseek(in, 0, SEEK_SET);
+   txt= Alloc(len + 1);
+   if (len != fread(txt, 1, len, in)) { 
+      fclose(in); free(txt); 
+      return strdupf("Can't read file: %s", fnam); 
+   }
+   fclose(in);
+#endif
+
+   list= ALLOC_ARR(max_list, FidFilter*);
+   p= txt;
+   end= txt + len;
+   err= 0;
+   while ((p= skipWS(p, end)) != end) {
+      if ((err= fid_parse_n(rate, &p, end, &ff))) break;
+      if (n_list + 1 >= max_list) {
+	 list= realloc(list, (max_list *= 2) * sizeof(FidFilter*));
+	 if (!list) error("Out of memory");
+      }
+      list[n_list++]= ff;
+      if (p == end) break;
+      if (*p != ',' && *p != ';') {
+	 err= strdupf("Unmatched '%c'", *p);
+	 break;
+      }
+      p++;
+   }
+   list[n_list]= 0;
+
+   if (err) {
+      char *tmp= err, *q;
+      int line= 1;
+      for (q= txt; q < p; q++) 
+	 if (*q == '\n') line++;
+      err= strdupf("%s:%d: %s", fnam, line, tmp);
+      free(tmp);
+      while (n_list > 0) free(list[--n_list]);
+      free(list);
+      list= 0;
+   }
+
+#ifdef T_LINUX
+   if (len) munmap(txt, len);
+#else
+   free(txt);
+#endif
+
+   *listp= list;
+   return err;
+}
+
+//
+//	Report the FID_STATS counters to STDERR, or reset them.  In a
+//	build without FID_STATS, fid_stats_dump() just says so.
+//
+
+#ifdef FID_STATS
+
+static void
+stats_line(char *name, FidStat *st, char *count) {
+   fprintf(stderr, "  %-16s %12llu", name, st->calls);
+   if (count) fprintf(stderr, " %12llu %-10s", st->count, count);
+   else fprintf(stderr, " %12s %-10s", "", "");
+   if (st->ns) 
+      fprintf(stderr, " %12.3f ms %10.0f ns/call", st->ns * 1e-6, 
+	      st->calls ? (double)st->ns / st->calls : 0.0);
+   fprintf(stderr, "\n");
+}
+
+void 
+fid_stats_dump() {
+   int a;
+   fprintf(stderr, "fidlib stats:\n");
+   fprintf(stderr, "  %-16s %12s\n", "", "calls");
+   stats_line("fid_design", &st_design, 0);
+   for (a= 0; filter[a].fmt; a++) {
+      char name[32], *p= name, *q= filter[a].fmt;
+      if (!st_des[a].calls) continue;
+      p += sprintf(p, "  ");
+      while (*q && *q != '#' && *q != '/' && p-name < sizeof(name)-1) *p++= *q++;
+      *p= 0;
+      stats_line(name, &st_des[a], 0);
+   }
+   stats_line("bandpass_res", &st_bpres, "iterations");
+   stats_line("search_peak", &st_peak, "iterations");
+   stats_line("auto_adj_single", &st_adj_single, "designs");
+   stats_line("auto_adj_dual", &st_adj_dual, "designs");
+   stats_line("fid_response", &st_response, 0);
+   stats_line("Alloc", &st_alloc, "bytes");
+   stats_line("fid_run_block", &st_denorm, "subnormals");
+}
+
+void 
+fid_stats_reset() {
+   memset(&st_design, 0, sizeof(st_design));
+   memset(&st_response, 0, sizeof(st_response));
+   memset(&st_alloc, 0, sizeof(st_alloc));
+   memset(&st_bpres, 0, sizeof(st_bpres));
+   memset(&st_peak, 0, sizeof(st_peak));
+   memset(&st_adj_single, 0, sizeof(st_adj_single));
+   memset(&st_adj_dual, 0, sizeof(st_adj_dual));
+   memset(&st_denorm, 0, sizeof(st_denorm));
+   memset(st_des, 0, sizeof(st_des));
+}
+
+#else
+
+void 
+fid_stats_dump() {
+   fprintf(stderr, "fidlib stats: not available, build with -DFID_STATS\n");
+}
+
+void 
+fid_stats_reset() {
+}
+
+#endif
+
 
 //
 //	Filter-running code
@@ -2293,11 +3323,26 @@ fid_parse(double rate, char **pp, FidFilter **ffp) {
 
 #ifdef RF_CMDLIST
 #include "fidrf_cmdlist.h"
-#endif
-
-#ifdef RF_JIT
 #include "fidrf_jit.h"
 #endif
 
+//
+//	Resonator bank
+//
+
+#include "fidrf_bank.h"
+
+//
+//	Single-precision runner
+//
+
+#include "fidrf_float.h"
+
+//
+//	Fixed-point runner
+//
+
+#include "fidrf_fixed.h"
+
 
 // END //
@@ -27,6 +27,22 @@ struct FidFilter {
 // Includes space for the final termination, and zeros the memory.
 #define FFALLOC(n_head,n_val) (FidFilter*)Alloc(FFCSIZE(n_head, n_val))
 
+// Denormal protection modes for fid_run_denormal(), fid_run_denormal_f()
+// and fid_bank_denormal(), or'd together
+#define FID_DENORM_FTZ 1	// Flush-to-zero and denormals-are-zero within a block
+#define FID_DENORM_DC 2		// Add a tiny offset of alternating sign to the input
+#define FID_DENORM_COUNT 4	// Count subnormal state values after each block
+
+// Section structures for fid_section_coef() and fid_run_new_f_form()
+#define FID_FORM_AUTO 0		// fid_run_new_f(): chosen by pole position
+#define FID_FORM_DIRECT 1	// Direct form
+#define FID_FORM_COUPLED 2	// Gold-Rader coupled form
+#define FID_FORM_SVF 3		// Trapezoidal state-variable filter
+
+// Signal scaling for fid_run_new_fx()
+#define FID_NORM_LINF 0		// Peak gain: full-scale sinusoids don't overflow
+#define FID_NORM_L1 1		// Impulse response sum: no input overflows
+
 // These are so you can use easier names to refer to running filters
 typedef void FidRun;
 typedef double (FidFunc)(void*, double);
@@ -42,6 +58,8 @@ extern "C" {
 
 extern void fid_set_error_handler(void(*rout)(char *));
 extern char *fid_version();
+extern void fid_stats_dump();
+extern void fid_stats_reset();
 extern double fid_response_pha(FidFilter *filt, double freq, double *phase);
 extern double fid_response(FidFilter *filt, double freq);
 extern int fid_calc_delay(FidFilter *filt);
@@ -49,6 +67,10 @@ extern FidFilter *fid_design(char *spec, double rate, double freq0, double freq1
 			     int f_adj, char **descp);
 extern double fid_design_coef(double *coef, int n_coef, char *spec, 
 			      double rate, double freq0, double freq1, int adj);
+extern char *fid_gen_code(char *name, char *spec, double rate, double freq0, 
+			  double freq1, int adj, int *n_coefp);
+extern int fid_section_coef(double *iir, int n_iir, double *fir, int n_fir, 
+			    int form, double *coef);
 extern void fid_list_filters(FILE *out);
 extern int fid_list_filters_buf(char *buf, char *bufend);
 extern FidFilter *fid_flatten(FidFilter *filt);
@@ -58,18 +80,64 @@ extern void fid_rewrite_spec(char *spec, double freq0, double freq1, int adj,
 extern FidFilter *fid_cv_array(double *arr);
 extern FidFilter *fid_cat(int freeme, ...);
 extern char *fid_parse(double rate, char **pp, FidFilter **ffp);
+extern char *fid_parse_n(double rate, char **pp, char *end, FidFilter **ffp);
+extern char *fid_parse_file(double rate, char *fnam, FidFilter ***listp);
 
 //
 //	Filter running prototypes
 //
 
 extern void *fid_run_new(FidFilter *filt, double(**funcpp)(void *, double));
+extern void *fid_run_new_jit(FidFilter *filt, double(**funcpp)(void *, double));
 extern void *fid_run_newbuf(void *run);
 extern int fid_run_bufsize(void *run);
 extern void fid_run_initbuf(void *run, void *buf);
 extern void fid_run_zapbuf(void *buf);
 extern void fid_run_freebuf(void *runbuf);
 extern void fid_run_free(void *run);
+extern int fid_run_update_coef(void *run, FidFilter *filt);
+extern void fid_run_ramp(void *runbuf, int len);
+extern void fid_run_block(void *runbuf, double *in, double *out, int len);
+extern void fid_run_denormal(void *runbuf, int mode);
+extern int fid_run_denormals(void *runbuf);
+
+//
+//	Single-precision filter running prototypes
+//
+
+extern void *fid_run_new_f(FidFilter *filt, float(**funcpp)(void *, float));
+extern void *fid_run_new_f_form(FidFilter *filt, int form, float(**funcpp)(void *, float));
+extern void *fid_run_newbuf_f(void *run);
+extern void fid_run_block_f(void *runbuf, float *in, float *out, int len);
+extern void fid_run_denormal_f(void *runbuf, int mode);
+extern void fid_run_zapbuf_f(void *buf);
+extern void fid_run_freebuf_f(void *runbuf);
+extern void fid_run_free_f(void *run);
+extern double fid_run_error_f(FidFilter *filt, int form, int len);
+
+//
+//	Fixed-point filter running prototypes
+//
+
+extern void *fid_run_new_fx(FidFilter *filt, int norm, int(**funcpp)(void *, int));
+extern void *fid_run_newbuf_fx(void *run);
+extern void fid_run_block_fx(void *runbuf, int *in, int *out, int len);
+extern void fid_run_zapbuf_fx(void *buf);
+extern void fid_run_freebuf_fx(void *runbuf);
+extern void fid_run_free_fx(void *run);
+extern double fid_run_snr_fx(FidFilter *filt, int norm, int len);
+
+//
+//	Resonator bank prototypes
+//
+
+extern void *fid_bank_new(double *coef, int n_band);
+extern void *fid_bank_new_multirate(double rate, double *freq, int n_band, double q, double gain);
+extern void fid_bank_run(void *bank, double *in, double *out, int len);
+extern void fid_bank_mix(void *bank, double *weight, double *in, double *out, int len);
+extern void fid_bank_denormal(void *bank, int mode);
+extern void fid_bank_zap(void *bank);
+extern void fid_bank_free(void *bank);
 
 #ifdef __cplusplus
 }
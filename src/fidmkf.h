@@ -199,12 +199,14 @@ c_exp(double *aa) {
 
 #define MAXPZ 64 
 
-static int n_pol;		// Number of poles
-static double pol[MAXPZ];	// Pole values (see above)
-static char poltyp[MAXPZ];	// Pole value types: 1 real, 2 first of complex pair, 0 second
-static int n_zer;		// Same for zeros ...
-static double zer[MAXPZ];
-static char zertyp[MAXPZ];	
+// These are per-thread, so that filters may be designed in several
+// threads at once
+static THREAD_LOCAL int n_pol;		// Number of poles
+static THREAD_LOCAL double pol[MAXPZ];	// Pole values (see above)
+static THREAD_LOCAL char poltyp[MAXPZ];	// Pole value types: 1 real, 2 first of complex pair, 0 second
+static THREAD_LOCAL int n_zer;		// Same for zeros ...
+static THREAD_LOCAL double zer[MAXPZ];
+static THREAD_LOCAL char zertyp[MAXPZ];	
 
 
 //
@@ -764,7 +766,9 @@ bandpass_res(double freq, double qfact) {
    cexpj(val, theta);
    mag= exp(-theta / (2.0 * qfact));
    th0= 0; th2= M_PI;
+   STAT_CALL(st_bpres);
    for (cnt= 60; cnt > 0; cnt--) {
+      STAT_COUNT(st_bpres, 1);
       th1= 0.5 * (th0 + th2);
       cexpj(pol, th1);
       cmulr(pol, mag);
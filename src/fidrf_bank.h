@@ -0,0 +1,550 @@
+//
+//	Resonator bank: many BpRe resonators run over the same input.
+//
+//	Each band is a 'BpRe' filter as emitted in the scale tables, a
+//	triple {gain, val[2], val[1]} of the overall gain and the two
+//	feedback coefficients of its IIR stage.  The band computes:
+//
+//	  w[n]= x[n] - val[1]*w[n-1] - val[2]*w[n-2]
+//	  y[n]= gain * (w[n] - w[n-2])
+//
+//	which is the same filter as fid_run_new() would run for the
+//	design, up to rounding (the gain is applied at the output
+//	rather than the input).
+//
+//	Bands are stored in groups of BANK_LANES, structure-of-arrays,
+//	so that each SIMD lane runs a different band.  The last group
+//	is padded with silent bands.  With gcc the lanes are a vector
+//	type; other compilers get a plain loop over the bands.
+//
+
+#define BANK_LANES 4
+#define BANK_BLOCK 64		// Samples per pass over the groups in fid_bank_mix()
+
+typedef struct Bank {
+   int magic;		// Magic: 0x64966326
+   int n_band;		// Number of resonators
+   int n_grp;		// Number of groups of BANK_LANES
+   double *coef;	// Per group: gain[], val[2][], val[1][] of BANK_LANES each
+   double *state;	// Per group: w[n-1][], w[n-2][] of BANK_LANES each
+   void *mem;		// Allocation holding coef and state
+   int denorm;		// FID_DENORM_* modes set by fid_bank_denormal(), or 0
+   double dc;		// Offset added to the state with FID_DENORM_DC
+} Bank;
+
+#define BANK_MAGIC 0x64966326
+
+//
+//	Create a bank of n_band resonators from a table of n_band
+//	{gain, val[2], val[1]} triples, as emitted by the generator.
+//
+
+void *
+fid_bank_new(double *coef, int n_band) {
+   Bank *bb= ALLOC(Bank);
+   int a, b;
+
+   bb->magic= BANK_MAGIC;
+   bb->n_band= n_band;
+   bb->n_grp= (n_band + BANK_LANES-1) / BANK_LANES;
+
+   // Align for the vector loads
+   bb->mem= Alloc(bb->n_grp * 5 * BANK_LANES * sizeof(double) + 64);
+   bb->coef= (double*)(((size_t)bb->mem + 63) & ~(size_t)63);
+   bb->state= bb->coef + bb->n_grp * 3 * BANK_LANES;
+
+   for (a= 0; a<n_band; a++) {
+      double *cf= bb->coef + (a / BANK_LANES) * 3 * BANK_LANES + a % BANK_LANES;
+      for (b= 0; b<3; b++)
+	 cf[b * BANK_LANES]= coef[a*3 + b];
+   }
+   return bb;
+}
+
+// With FID_DENORM_DC, nudge every band's state by a tiny offset,
+// alternating in sign from one call to the next
+static void
+bank_nudge(Bank *bb) {
+   int a, n= bb->n_grp * BANK_LANES;
+   if (!(bb->denorm & FID_DENORM_DC)) return;
+   for (a= 0; a<n; a++)
+      bb->state[(a / BANK_LANES) * 2 * BANK_LANES + a % BANK_LANES] += bb->dc;
+   bb->dc= -bb->dc;
+}
+
+static void
+bank_zap(void *bank) {
+   Bank *bb= bank;
+   memset(bb->state, 0, bb->n_grp * 2 * BANK_LANES * sizeof(double));
+}
+
+static void
+bank_free(void *bank) {
+   Bank *bb= bank;
+   free(bb->mem);
+   free(bb);
+}
+
+#if defined(__GNUC__) && !defined(T_MSVC)
+
+typedef double BankVec __attribute__((vector_size(BANK_LANES * sizeof(double))));
+
+//
+//	Run every band over the input, giving each band's output in
+//	out[band*len ... band*len+len-1].  out[] must not overlap in[].
+//
+
+static void
+bank_run(void *bank, double *in, double *out, int len) {
+   Bank *bb= bank;
+   int a, b, i;
+
+   for (a= 0; a<bb->n_grp; a++) {
+      BankVec *cf= (BankVec*)(bb->coef + a * 3 * BANK_LANES);
+      BankVec *st= (BankVec*)(bb->state + a * 2 * BANK_LANES);
+      BankVec gain= cf[0], c2= cf[1], c1= cf[2];
+      BankVec w1= st[0], w2= st[1];
+      int n_lane= bb->n_band - a * BANK_LANES;
+      double *op= out + a * BANK_LANES * len;
+      if (n_lane > BANK_LANES) n_lane= BANK_LANES;
+
+      for (i= 0; i<len; i++) {
+	 BankVec w0= in[i] - c1 * w1 - c2 * w2;
+	 BankVec y= gain * (w0 - w2);
+	 w2= w1; w1= w0;
+	 for (b= 0; b<n_lane; b++)
+	    op[b*len + i]= y[b];
+      }
+      st[0]= w1; st[1]= w2;
+   }
+}
+
+//
+//	Run every band over the input, giving the sum of the bands'
+//	outputs, each multiplied by weight[band], or by 1 if weight is
+//	0.  in[] and out[] may be the same.
+//
+
+static void
+bank_mix(void *bank, double *weight, double *in, double *out, int len) {
+   Bank *bb= bank;
+   BankVec acc[BANK_BLOCK];
+   int a, b, i, blk;
+
+   for (blk= 0; blk<len; blk += BANK_BLOCK) {
+      int cnt= len - blk < BANK_BLOCK ? len - blk : BANK_BLOCK;
+      double *ip= in + blk;
+      memset(acc, 0, sizeof(acc));
+
+      for (a= 0; a<bb->n_grp; a++) {
+	 BankVec *cf= (BankVec*)(bb->coef + a * 3 * BANK_LANES);
+	 BankVec *st= (BankVec*)(bb->state + a * 2 * BANK_LANES);
+	 BankVec w1= st[0], w2= st[1];
+	 BankVec c2= cf[1], c1= cf[2];
+	 BankVec gain;
+	 for (b= 0; b<BANK_LANES; b++) {
+	    int band= a * BANK_LANES + b;
+	    gain[b]= cf[0][b] * (weight && band < bb->n_band ? weight[band] : 1.0);
+	 }
+
+	 for (i= 0; i<cnt; i++) {
+	    BankVec w0= ip[i] - c1 * w1 - c2 * w2;
+	    acc[i] += gain * (w0 - w2);
+	    w2= w1; w1= w0;
+	 }
+	 st[0]= w1; st[1]= w2;
+      }
+
+      for (i= 0; i<cnt; i++) {
+	 double sum= 0;
+	 for (b= 0; b<BANK_LANES; b++) sum += acc[i][b];
+	 out[blk + i]= sum;
+      }
+   }
+}
+
+#else
+
+static void
+bank_run(void *bank, double *in, double *out, int len) {
+   Bank *bb= bank;
+   int a, i;
+
+   for (a= 0; a<bb->n_band; a++) {
+      double *cf= bb->coef + (a / BANK_LANES) * 3 * BANK_LANES + a % BANK_LANES;
+      double *st= bb->state + (a / BANK_LANES) * 2 * BANK_LANES + a % BANK_LANES;
+      double w1= st[0], w2= st[BANK_LANES];
+      double *op= out + a * len;
+      for (i= 0; i<len; i++) {
+	 double w0= in[i] - cf[2*BANK_LANES] * w1 - cf[BANK_LANES] * w2;
+	 op[i]= cf[0] * (w0 - w2);
+	 w2= w1; w1= w0;
+      }
+      st[0]= w1; st[BANK_LANES]= w2;
+   }
+}
+
+static void
+bank_mix(void *bank, double *weight, double *in, double *out, int len) {
+   Bank *bb= bank;
+   double acc[BANK_BLOCK];
+   int a, i, blk;
+
+   for (blk= 0; blk<len; blk += BANK_BLOCK) {
+      int cnt= len - blk < BANK_BLOCK ? len - blk : BANK_BLOCK;
+      double *ip= in + blk;
+      memset(acc, 0, sizeof(acc));
+
+      for (a= 0; a<bb->n_band; a++) {
+	 double *cf= bb->coef + (a / BANK_LANES) * 3 * BANK_LANES + a % BANK_LANES;
+	 double *st= bb->state + (a / BANK_LANES) * 2 * BANK_LANES + a % BANK_LANES;
+	 double w1= st[0], w2= st[BANK_LANES];
+	 double gain= cf[0] * (weight ? weight[a] : 1.0);
+	 for (i= 0; i<cnt; i++) {
+	    double w0= ip[i] - cf[2*BANK_LANES] * w1 - cf[BANK_LANES] * w2;
+	    acc[i] += gain * (w0 - w2);
+	    w2= w1; w1= w0;
+	 }
+	 st[0]= w1; st[BANK_LANES]= w2;
+      }
+      memcpy(out + blk, acc, cnt * sizeof(double));
+   }
+}
+
+#endif
+
+//
+//	Multirate bank: the same resonators, with the low bands run at
+//	decimated rates.
+//
+//	Each band goes to the lowest level (rate/2, rate/4, ... down to
+//	rate/2^(MRB_LEVELS-1)) at which its frequency is still below
+//	MRB_EDGE of that level's rate, and is redesigned with fid_design()
+//	at that rate.  A band at level k costs 1/2^k of a full-rate band,
+//	and its coefficients sit further from 1.0.
+//
+//	The levels are linked by half-band FIR filters, 15 taps of which
+//	only the centre and the four pairs at odd offsets are non-zero,
+//	run polyphase so that only kept samples are computed.  Going down,
+//	each decimator passes 0 to 0.1 of its input rate flat to 0.02dB
+//	and rejects everything that would alias onto it by 53dB.  Going up,
+//	the sum of each level's bands plus the interpolated level above is
+//	interpolated by the same filter.  Each level adds 14 samples of its
+//	own rate, plus 1 sample of the level below, to the latency of the
+//	bands under it, so about 9ms at 96k for the lowest level: nothing
+//	against the ringing time of a tuned resonator, but the bands of
+//	different levels are not phase-aligned.
+//
+//	Only fid_bank_mix() is available on a multirate bank, since the
+//	per-band outputs of fid_bank_run() would each need interpolating.
+//
+
+#define MRB_LEVELS 7		// Full rate plus up to 6 halvings
+#define MRB_EDGE 0.2		// Highest band frequency as a fraction of its level's rate
+#define MRB_CHUNK 256		// Full-rate samples per pass through the levels
+#define MRB_TAPS 15		// Half-band filter length
+#define MRB_MAGIC 0x64966327
+
+typedef struct MrLevel {
+   Bank *bank;		// Bands run at this level, or 0 if none
+   int *band;		// Caller's index of each of those bands
+   double *weight;	// Caller's weights, gathered for those bands
+   double *x;		// Input at this level's rate
+   double *y;		// Output at this level's rate, including the levels above
+   double dec[MRB_TAPS];	// Decimator into the level below: input history, newest first
+   int phase;		// Decimator: 1 if an odd number of inputs has been taken
+   double itp[MRB_TAPS/2+1];	// Interpolator from the level above: input history
+   double carry;	// Interpolated sample left over from the last pass
+   int have;		// 1 if 'carry' is valid
+} MrLevel;
+
+typedef struct MrBank {
+   int magic;		// Magic: MRB_MAGIC; same place as Bank.magic
+   int n_band;		// Number of resonators
+   int n_level;		// Number of levels in use, 1 + the deepest
+   double hb[4];	// Half-band taps at offsets 1,3,5,7 from the centre
+   MrLevel lev[MRB_LEVELS];
+   void *mem;		// Allocation holding the x[] and y[] buffers
+   int denorm;		// FID_DENORM_* modes set by fid_bank_denormal(), or 0
+} MrBank;
+
+//
+//	Design the half-band lowpass: the ideal sinc, Blackman windowed,
+//	with the side taps scaled for unity gain at DC.
+//
+
+static void
+mrbank_halfband(double *hb) {
+   double sum= 0;
+   int a;
+
+   for (a= 0; a<4; a++) {
+      int d= 2*a + 1;
+      double t= MRB_TAPS/2 + d + 1;	// Window position, excluding the zero end points
+      double w= 0.42 - 0.5 * cos(2*M_PI*t/(MRB_TAPS+1)) + 0.08 * cos(4*M_PI*t/(MRB_TAPS+1));
+      hb[a]= sin(M_PI*d/2) / (M_PI*d) * w;
+      sum += hb[a];
+   }
+   for (a= 0; a<4; a++) hb[a] *= 0.25 / sum;
+}
+
+//
+//	Create a multirate bank of n_band BpRe resonators of the given Q,
+//	centred on freq[], each with a peak gain of 'gain', for input at
+//	'rate'.  The design is the same as the generator's bpre tables.
+//
+
+void *
+fid_bank_new_multirate(double rate, double *freq, int n_band, double q, double gain) {
+   MrBank *mb= ALLOC(MrBank);
+   int *level= ALLOC_ARR(n_band, int);
+   int count[MRB_LEVELS];
+   double *buf;
+   int a, k, size;
+
+   mb->magic= MRB_MAGIC;
+   mb->n_band= n_band;
+   mb->n_level= 1;
+   mrbank_halfband(mb->hb);
+
+   memset(count, 0, sizeof(count));
+   for (a= 0; a<n_band; a++) {
+      k= 0;
+      while (k < MRB_LEVELS-1 && freq[a] <= MRB_EDGE * rate / (2 << k)) k++;
+      level[a]= k;
+      count[k]++;
+      if (k >= mb->n_level) mb->n_level= k+1;
+   }
+
+   for (k= 0; k<mb->n_level; k++) {
+      MrLevel *lv= &mb->lev[k];
+      double lrate= rate / (1 << k);
+      double *coef;
+      int n= 0;
+
+      lv->have= 1;		// One sample of slack for the decimator's phase
+      if (!count[k]) continue;
+
+      lv->band= ALLOC_ARR(count[k], int);
+      lv->weight= ALLOC_ARR(count[k], double);
+      coef= ALLOC_ARR(count[k] * 3, double);
+      for (a= 0; a<n_band; a++) {
+	 char *spec;
+	 FidFilter *filt, *iir;
+	 if (level[a] != k) continue;
+
+	 spec= strdupf("BpRe/%.17g/%.17g", q, freq[a]);
+	 filt= fid_design(spec, lrate, 0, 0, 0, 0);
+	 iir= FFNEXT(filt);
+	 coef[n*3]= gain / fid_response(iir, freq[a] / lrate);
+	 coef[n*3+1]= iir->val[2];
+	 coef[n*3+2]= iir->val[1];
+	 lv->band[n++]= a;
+	 free(filt);
+	 free(spec);
+      }
+      lv->bank= fid_bank_new(coef, n);
+      free(coef);
+   }
+   free(level);
+
+   // x[] below full rate and y[] at every level, each with room for
+   // the extra sample a decimator's phase can give
+   size= 0;
+   for (k= 0; k<mb->n_level; k++)
+      size += 2 * ((MRB_CHUNK >> k) + 2);
+   mb->mem= buf= ALLOC_ARR(size, double);
+   for (k= 0; k<mb->n_level; k++) {
+      if (k) { mb->lev[k].x= buf; buf += (MRB_CHUNK >> k) + 2; }
+      mb->lev[k].y= buf; buf += (MRB_CHUNK >> k) + 2;
+   }
+   return mb;
+}
+
+//
+//	Run one chunk of up to MRB_CHUNK samples through the levels.
+//
+
+static void
+mrbank_chunk(MrBank *mb, double *weight, double *in, double *out, int len) {
+   double *hb= mb->hb;
+   int n[MRB_LEVELS];
+   int a, i, j, k;
+
+   // Decimate down through the levels
+   mb->lev[0].x= in;
+   n[0]= len;
+   for (k= 0; k+1<mb->n_level; k++) {
+      MrLevel *lv= &mb->lev[k];
+      double *d= lv->dec;
+      double *xo= mb->lev[k+1].x;
+      int cnt= 0;
+      for (i= 0; i<n[k]; i++) {
+	 memmove(d+1, d, (MRB_TAPS-1) * sizeof(double));
+	 d[0]= lv->x[i];
+	 if ((lv->phase ^= 1)) continue;
+	 xo[cnt++]= 0.5 * d[7] + hb[0] * (d[6] + d[8]) + hb[1] * (d[4] + d[10]) +
+	    hb[2] * (d[2] + d[12]) + hb[3] * (d[0] + d[14]);
+      }
+      n[k+1]= cnt;
+   }
+
+   // Run the bands and interpolate back up
+   for (k= mb->n_level-1; k>=0; k--) {
+      MrLevel *lv= &mb->lev[k];
+      double *y= lv->y;
+
+      if (lv->bank) {
+	 if (weight) {
+	    for (a= 0; a<lv->bank->n_band; a++)
+	       lv->weight[a]= weight[lv->band[a]];
+	 }
+	 bank_mix(lv->bank, weight ? lv->weight : 0, lv->x, y, n[k]);
+      } else {
+	 memset(y, 0, n[k] * sizeof(double));
+      }
+      if (k+1 == mb->n_level) continue;
+
+      // Two outputs per input from the level above; as that level
+      // gets floor() of half of this one's samples, with one sample
+      // of slack there is always enough, and at most one left over
+      j= 0;
+      if (lv->have && j < n[k]) { y[j++] += lv->carry; lv->have= 0; }
+      for (i= 0; i<n[k+1]; i++) {
+	 double *h= lv->itp;
+	 double v[2];
+	 memmove(h+1, h, (MRB_TAPS/2) * sizeof(double));
+	 h[0]= mb->lev[k+1].y[i];
+	 v[0]= 2 * (hb[0] * (h[3] + h[4]) + hb[1] * (h[2] + h[5]) +
+		    hb[2] * (h[1] + h[6]) + hb[3] * (h[0] + h[7]));
+	 v[1]= h[3];
+	 for (a= 0; a<2; a++) {
+	    if (j < n[k]) y[j++] += v[a];
+	    else { lv->carry= v[a]; lv->have= 1; }
+	 }
+      }
+   }
+   memcpy(out, mb->lev[0].y, len * sizeof(double));
+}
+
+static void
+mrbank_mix(MrBank *mb, double *weight, double *in, double *out, int len) {
+   int i;
+   for (i= 0; i<len; i += MRB_CHUNK)
+      mrbank_chunk(mb, weight, in + i, out + i, len - i < MRB_CHUNK ? len - i : MRB_CHUNK);
+}
+
+static void
+mrbank_zap(MrBank *mb) {
+   int k;
+   for (k= 0; k<mb->n_level; k++) {
+      MrLevel *lv= &mb->lev[k];
+      if (lv->bank) bank_zap(lv->bank);
+      memset(lv->dec, 0, sizeof(lv->dec));
+      memset(lv->itp, 0, sizeof(lv->itp));
+      lv->phase= 0;
+      lv->carry= 0;
+      lv->have= 1;
+   }
+}
+
+static void
+mrbank_free(MrBank *mb) {
+   int k;
+   for (k= 0; k<mb->n_level; k++) {
+      MrLevel *lv= &mb->lev[k];
+      if (!lv->bank) continue;
+      bank_free(lv->bank);
+      free(lv->band);
+      free(lv->weight);
+   }
+   free(mb->mem);
+   free(mb);
+}
+
+//
+//	Entry points, for either kind of bank
+//
+
+void
+fid_bank_run(void *bank, double *in, double *out, int len) {
+   Bank *bb= bank;
+   unsigned long fpu= 0;
+
+   if (bb->magic == MRB_MAGIC)
+      error("fid_bank_run() is not available on a multirate bank; use fid_bank_mix()");
+   if (bb->denorm & FID_DENORM_FTZ) fpu= fpu_ftz_on();
+   bank_nudge(bb);
+   bank_run(bank, in, out, len);
+   if (bb->denorm & FID_DENORM_FTZ) fpu_restore(fpu);
+}
+
+void
+fid_bank_mix(void *bank, double *weight, double *in, double *out, int len) {
+   MrBank *mb= bank;
+   int multi= mb->magic == MRB_MAGIC;
+   int denorm= multi ? mb->denorm : ((Bank*)bank)->denorm;
+   unsigned long fpu= 0;
+   int k;
+
+   if (denorm & FID_DENORM_FTZ) fpu= fpu_ftz_on();
+   if (multi) {
+      for (k= 0; k<mb->n_level; k++) 
+	 if (mb->lev[k].bank) bank_nudge(mb->lev[k].bank);
+      mrbank_mix(mb, weight, in, out, len);
+   } else {
+      bank_nudge(bank);
+      bank_mix(bank, weight, in, out, len);
+   }
+   if (denorm & FID_DENORM_FTZ) fpu_restore(fpu);
+}
+
+//
+//	Set the denormal protection for fid_bank_run() and fid_bank_mix()
+//	on either kind of bank, as fid_run_denormal() does for
+//	fid_run_block(): FID_DENORM_FTZ sets the FPU to flush subnormals
+//	to zero for the duration of the call, and FID_DENORM_DC adds a
+//	tiny offset (1e-20) to every band's state at the start of each
+//	call, alternating in sign, rather than to every input sample,
+//	which would cost an add in the inner loop.  FID_DENORM_COUNT is
+//	not available on a bank.
+//
+
+void
+fid_bank_denormal(void *bank, int mode) {
+   int k;
+
+   if (((Bank*)bank)->magic == MRB_MAGIC) {
+      MrBank *mb= bank;
+      mb->denorm= mode;
+      for (k= 0; k<mb->n_level; k++) 
+	 if (mb->lev[k].bank) fid_bank_denormal(mb->lev[k].bank, mode);
+      return;
+   }
+   if (((Bank*)bank)->magic != BANK_MAGIC)
+      error("Bad handle passed to fid_bank_denormal()");
+
+   ((Bank*)bank)->denorm= mode;
+   if (!(mode & FID_DENORM_DC)) 
+      ((Bank*)bank)->dc= 0.0;
+   else if (((Bank*)bank)->dc == 0.0) 
+      ((Bank*)bank)->dc= 1e-20;
+}
+
+void
+fid_bank_zap(void *bank) {
+   if (((Bank*)bank)->magic == MRB_MAGIC)
+      mrbank_zap(bank);
+   else
+      bank_zap(bank);
+}
+
+void
+fid_bank_free(void *bank) {
+   if (((Bank*)bank)->magic == MRB_MAGIC)
+      mrbank_free(bank);
+   else
+      bank_free(bank);
+}
+
+// END //
@@ -17,20 +17,101 @@
 //	portable (unlike the JIT option).
 //
 
+typedef double (RunKern)(double *buf, double *coef, double in);
+
 typedef struct Run {
    int magic;		// Magic: 0x64966325
    int buf_size;	// Length of working buffer required in doubles	
-   double *coef;	// Coefficient list
+   double *coef;	// Coefficient list in use, one of bank[]; see fid_run_update_coef()
    char *cmd;		// Command list
+   int coef_cnt;	// Number of coefficients
+   unsigned seq;	// Incremented every time 'coef' is updated
+   double *bank[2];	// Double-buffered coefficient lists
+   long busy[2];	// Number of blocks running on each bank; see coef_claim()
+   char *cvar;		// For each coefficient, 1 if it varies with frequency, 0 if constant
+   RunKern *kern;	// Compiled run_cmds(), or 0; see fidrf_jit.h
+   void *jit;		// Pages holding the compiled code, or 0
+   int jit_len;		// Their length in bytes
 } Run;
 
+static void jit_free(Run *rr);
+
 typedef struct RunBuf {
-   double *coef;
+   Run *run;		// Coefficients are picked up from run->coef on each step
    char *cmd;
    int mov_cnt;		// Number of bytes to memmove
+   int ramp_len;	// Coefficient ramp length in samples, or 0 for none
+   int ramp_left;	// Samples left of ramp in progress
+   unsigned seq;	// Value of run->seq when ramp started
+   double ramp_mul;	// 1.0/ramp_len
+   double *ramp_cur;	// Ramped coefficients, following buf[]
+   double *ramp_inc;	// Per-sample increments
+   double *ramp_targ;	// Coefficient bank the ramp in progress is heading for
+   int denorm;		// FID_DENORM_* modes for fid_run_block(), or 0
+   int n_denorm;	// Subnormal state values found after the last block
+   double dc;		// Next offset to add to the input, for FID_DENORM_DC
    double buf[0];
 } RunBuf;
 
+//
+//	The coefficient list in use is switched with a single pointer
+//	store, which the filter_step() picks up once per sample.  The
+//	acquire/release ordering makes sure that the new coefficients
+//	are all visible before the pointer is.
+//
+//	A block claims the bank it runs on by counting itself into
+//	busy[] (BUSY_ADD), and the update checks the count of the bank
+//	it is about to rewrite.  Each side stores and then loads the
+//	other's variable, so these and the switch of the pointer
+//	(COEF_STORE) are sequentially consistent: then either the update
+//	sees the claim, or the block sees the new pointer and claims
+//	again.
+//
+
+#ifdef T_MSVC
+ #include <intrin.h>
+ #define COEF_LOAD(rr) (*(double * volatile *)&(rr)->coef)
+ #define COEF_STORE(rr, vv) _InterlockedExchangePointer((void * volatile *)&(rr)->coef, (vv))
+ #define SEQ_LOAD(rr) (*(volatile unsigned *)&(rr)->seq)
+ #define SEQ_STORE(rr, vv) (*(volatile unsigned *)&(rr)->seq= (vv))
+ #define BUSY_ADD(rr, ii, nn) _InterlockedExchangeAdd((volatile long *)&(rr)->busy[ii], (nn))
+#else
+ #define COEF_LOAD(rr) __atomic_load_n(&(rr)->coef, __ATOMIC_SEQ_CST)
+ #define COEF_STORE(rr, vv) __atomic_store_n(&(rr)->coef, (vv), __ATOMIC_SEQ_CST)
+ #define SEQ_LOAD(rr) __atomic_load_n(&(rr)->seq, __ATOMIC_ACQUIRE)
+ #define SEQ_STORE(rr, vv) __atomic_store_n(&(rr)->seq, (vv), __ATOMIC_RELEASE)
+ #define BUSY_ADD(rr, ii, nn) __atomic_fetch_add(&(rr)->busy[ii], (nn), __ATOMIC_SEQ_CST)
+#endif
+
+//
+//	Claim the coefficient bank in use, so that fid_run_update_coef()
+//	won't rewrite it until coef_release(), returning the bank and
+//	its index in *idxp.  If the pointer is switched between loading
+//	it and counting in, the claim may be on the bank that is about
+//	to be rewritten, so drop it and try again.
+//
+
+static double *
+coef_claim(Run *rr, int *idxp) {
+   double *coef;
+   int idx;
+
+   while (1) {
+      coef= COEF_LOAD(rr);
+      idx= coef != rr->bank[0];
+      BUSY_ADD(rr, idx, 1);
+      if (coef == COEF_LOAD(rr)) break;
+      BUSY_ADD(rr, idx, -1);
+   }
+   *idxp= idx;
+   return coef;
+}
+
+static void
+coef_release(Run *rr, int idx) {
+   BUSY_ADD(rr, idx, -1);
+}
+
 
 //
 //	Filter processing routine.  This is designed to avoid too many
@@ -64,18 +145,31 @@ typedef struct RunBuf {
 //	 20  Nx (FIR + FIR end-stage) (0+3)
 //	 21  Nx (IIR+FIR + IIR+FIR end-stage) (2+3)
 //	 22  Gain coefficient (0+1)
+//	 23  IIR + constant FIR 1,0,-1 end-stage (2+0)
+//	 24  IIR + constant FIR 1,2,1 end-stage (2+0)
+//	 25  IIR + constant FIR 1,-2,1 end-stage (2+0)
+//	 26  Nx (IIR + constant FIR 1,0,-1 end-stage) (2+0)
+//	 27  Nx (IIR + constant FIR 1,2,1 end-stage) (2+0)
+//	 28  Nx (IIR + constant FIR 1,-2,1 end-stage) (2+0)
 //
 //	Most filters are made up of 2x2 IIR/FIR pairs, which means a
 //	list of command 18 bytes.  The other big job would be long FIR
 //	filters.  These have to be handled with a list of 7,6,5
 //	commands, plus a 13 command.
 //
+//	Where the FIR half of a pair is marked constant in the 'cbm'
+//	bitmap and is one of the bilinear band-pass, low-pass or
+//	high-pass numerators (1,0,-1; 1,2,1; 1,-2,1), commands 23-28
+//	are used instead of 18/21.  These carry only the two IIR
+//	coefficients, and do the FIR part with adds, so a BpRe stage
+//	takes 2 multiplies rather than 5.  The result is bit-for-bit
+//	the same.
+//
 
 typedef unsigned char uchar;
 
-static double 
-filter_step(void *fbuf, double iir) {
-   double *coef= ((RunBuf*)fbuf)->coef;
+static inline double 
+run_cmds(RunBuf *fbuf, double *coef, double iir) {
    uchar *cmd= ((RunBuf*)fbuf)->cmd;
    double *buf= &((RunBuf*)fbuf)->buf[0];
    uchar ch;
@@ -116,6 +210,19 @@ filter_step(void *fbuf, double iir) {
        fir= 0
 #define GAIN \
        iir *= *coef++
+#define ENDCONST(fir_expr) \
+       iir -= *coef++ * tmp; \
+       fir= tmp; \
+       tmp= *buf++; \
+       iir -= *coef++ * tmp; \
+       fir= fir_expr; \
+       tmp= *buf++; \
+       buf[-1]= iir; \
+       iir += fir; \
+       fir= 0
+#define ENDBP ENDCONST(-fir)
+#define ENDLP ENDCONST(fir + (tmp + tmp))
+#define ENDHP ENDCONST(fir - (tmp + tmp))
 
    while ((ch= *cmd++)) switch (ch) {
     case 1:
@@ -174,6 +281,24 @@ filter_step(void *fbuf, double iir) {
        break;
     case 22:
        GAIN; break;
+    case 23:
+       ENDBP; break;
+    case 24:
+       ENDLP; break;
+    case 25:
+       ENDHP; break;
+    case 26:
+       cnt= *cmd++; 
+       do { ENDBP; } while (--cnt > 0);
+       break;
+    case 27:
+       cnt= *cmd++; 
+       do { ENDLP; } while (--cnt > 0);
+       break;
+    case 28:
+       cnt= *cmd++; 
+       do { ENDHP; } while (--cnt > 0);
+       break;
    }
 
 #undef IIR
@@ -183,59 +308,133 @@ filter_step(void *fbuf, double iir) {
 #undef ENDFIR
 #undef ENDBOTH
 #undef GAIN
+#undef ENDCONST
+#undef ENDBP
+#undef ENDLP
+#undef ENDHP
 
    return iir;
 }
 
+//
+//	Coefficient ramping.  When a buffer has a ramp length set with
+//	fid_run_ramp(), then instead of jumping to new coefficients as
+//	soon as fid_run_update_coef() switches them in, it works
+//	through its own copy of the coefficients, adding a fixed
+//	increment per sample to arrive at the new values after
+//	'ramp_len' samples.  A new update part-way through starts a
+//	new ramp from wherever the coefficients have got to.
+//
+//	The ramp lands on the bank it set out for, not on whatever is
+//	current by then: an update published between loading 'seq' and
+//	landing would otherwise be jumped to, and the ramp that should
+//	follow would start from the new values and go nowhere.
+//
+
+static double *
+ramp_step(RunBuf *rb) {
+   Run *rr= rb->run;
+   double *cur= rb->ramp_cur;
+   double *inc= rb->ramp_inc;
+   double *targ;
+   unsigned seq= SEQ_LOAD(rr);
+   int a, n= rr->coef_cnt;
+
+   if (seq != rb->seq) {
+      targ= COEF_LOAD(rr);
+      rb->seq= seq;
+      rb->ramp_targ= targ;
+      for (a= 0; a<n; a++) 
+	 inc[a]= (targ[a] - cur[a]) * rb->ramp_mul;
+      rb->ramp_left= rb->ramp_len;
+   }
+   if (rb->ramp_left) {
+      if (--rb->ramp_left) {
+	 for (a= 0; a<n; a++) 
+	    cur[a] += inc[a];
+      } else {
+	 // Land exactly on the target
+	 memcpy(cur, rb->ramp_targ, n * sizeof(double));
+      }
+   }
+   return cur;
+}
+
+static double 
+filter_step(void *fbuf, double iir) {
+   RunBuf *rb= fbuf;
+   return run_cmds(rb, rb->ramp_len ? ramp_step(rb) : COEF_LOAD(rb->run), iir);
+}
+
 
 //
-//	Create an instance of a filter, ready to run.  This returns a
-//	void* handle, and a function to call to execute the filter.
-//	Working buffers for the filter instances must be allocated
-//	separately using fid_run_newbuf().  This allows many
-//	simultaneous instances of the filter to be run.  
+//	Check for a 3-coefficient FIR which is marked constant and which
+//	has one of the numerators handled by commands 23-25, returning
+//	the command, or 0 if none applies.
 //
-//	The sub-filters are executed in the precise order that they
-//	are given.  This may lead to some inefficiency.  Normally when
-//	an IIR filter is followed by an FIR filter, the buffers can be
-//	shared.  However, if the sub-filters are not in IIR/FIR pairs,
-//	then extra memory accesses are required.
+
+static int
+const_fir(double *fir, int fir_cbm) {
+   if ((fir_cbm & 7) != 7 || fir[0] != 1.0 || fir[2] != (fir[1] == 0.0 ? -1.0 : 1.0))
+      return 0;
+   if (fir[1] == 0.0) return 23;
+   if (fir[1] == 2.0) return 24;
+   if (fir[1] == -2.0) return 25;
+   return 0;
+}
+
 //
-//	In any case, factors are extracted from IIR filters (so that
-//	the first coefficient is 1), and single-element FIR filters
-//	are merged into the global gain factor, and are ignored.
+//	Compile a filter into a command list and coefficient list,
+//	returned in newly allocated arrays.  For each coefficient,
+//	cvar[] is set to 1 if it may change with the frequency of the
+//	filter, or 0 if it is a constant according to the FidFilter
+//	'cbm' bitmaps.  The required working buffer size is returned.
 //
-//	The returned handle must be released using fid_run_free().
+//	Factors are extracted from IIR filters (so that the first
+//	coefficient is 1), and single-element FIR filters are merged
+//	into the global gain factor, and are ignored.
 //
 
-void *
-fid_run_new(FidFilter *filt, double (**funcpp)(void *,double)) {
+static int
+compile_run(FidFilter *filt, double **coefp, char **cvarp, int *coef_cntp, 
+	    uchar **cmdp, int *cmd_cntp) {
    int buf_size= 0;
    uchar *cp, prev;
    FidFilter *ff;
    double *dp;
+   char *vp;
    double gain= 1.0;
    int a;
    double *coef_tmp;
+   char *cvar_tmp;
    uchar *cmd_tmp;
    int coef_cnt, coef_max;
    int cmd_cnt, cmd_max;
    int filt_cnt= 0;
-   Run *rr;
 
    for (ff= filt; ff->len; ff= FFNEXT(ff))
       filt_cnt += ff->len;
 
    // Allocate worst-case sizes for temporary arrays
    coef_tmp= ALLOC_ARR(coef_max= filt_cnt + 1, double);
+   cvar_tmp= ALLOC_ARR(coef_max, char);
    cmd_tmp= ALLOC_ARR(cmd_max= filt_cnt + 4, char);
    dp= coef_tmp;
+   vp= cvar_tmp;
    cp= cmd_tmp;
    prev= 0;
 
+   // Output a coefficient: an IIR value (adjusted), an FIR value, or
+   // an unadjusted IIR value, along with its constant flag
+#define CBM(cbm, ii) ((cbm) & (1<<((ii)<15?(ii):15)))
+#define C_IIR(ii) (*vp++= !(CBM(iir_cbm, ii) && CBM(iir_cbm, 0)), *dp++= iir[ii]*adj)
+#define C_FIR(ii) (*vp++= !CBM(fir_cbm, ii), *dp++= fir[ii])
+#define C_IIR1(ii) (*vp++= !CBM(iir_cbm, ii), *dp++= iir[ii])
+
    // Generate command and coefficient lists
    while (filt->len) {
-      int n_iir, n_fir, cnt;
+      int n_iir, n_fir, cnt, ccmd;
+      int iir_cbm= 0, fir_cbm= 0;
       double *iir, *fir;
       double adj;
       if (filt->typ == 'F' && filt->len == 1) {
@@ -245,10 +444,10 @@ fid_run_new(FidFilter *filt, double (**funcpp)(void *,double)) {
       }
       if (filt->typ == 'F') {
 	 iir= 0; n_iir= 0;
-	 fir= filt->val; n_fir= filt->len;
+	 fir= filt->val; n_fir= filt->len; fir_cbm= filt->cbm;
 	 filt= FFNEXT(filt);
       } else if (filt->typ == 'I') {
-	 iir= filt->val; n_iir= filt->len;
+	 iir= filt->val; n_iir= filt->len; iir_cbm= filt->cbm;
 	 fir= 0; n_fir= 0;
 	 filt= FFNEXT(filt);
 	 while (filt->typ == 'F' && filt->len == 1) {
@@ -256,7 +455,7 @@ fid_run_new(FidFilter *filt, double (**funcpp)(void *,double)) {
 	    filt= FFNEXT(filt);
 	 }
 	 if (filt->typ == 'F') {
-	    fir= filt->val; n_fir= filt->len;
+	    fir= filt->val; n_fir= filt->len; fir_cbm= filt->cbm;
 	    filt= FFNEXT(filt); 
 	 }
       } else 
@@ -270,32 +469,38 @@ fid_run_new(FidFilter *filt, double (**funcpp)(void *,double)) {
 	 adj= 1.0 / iir[0];
 	 gain *= adj;
       }
-      if (n_fir == 3 && n_iir == 3) {
+      if (n_fir == 3 && n_iir == 3 && (ccmd= const_fir(fir, fir_cbm))) {
+	 if (prev == ccmd) { cp[-1]= prev= ccmd+3; *cp++= 2; }
+	 else if (prev == ccmd+3) { cp[-1]++; }
+	 else *cp++= prev= ccmd;
+	 C_IIR(2);
+	 C_IIR(1);
+      } else if (n_fir == 3 && n_iir == 3) {
 	 if (prev == 18) { cp[-1]= prev= 21; *cp++= 2; }
 	 else if (prev == 21) { cp[-1]++; }
 	 else *cp++= prev= 18;
-	 *dp++= iir[2]*adj; *dp++= fir[2];
-	 *dp++= iir[1]*adj; *dp++= fir[1];
-	 *dp++= fir[0];
+	 C_IIR(2); C_FIR(2);
+	 C_IIR(1); C_FIR(1);
+	 C_FIR(0);
       } else if (n_fir == 3 && n_iir == 0) {
 	 if (prev == 17) { cp[-1]= prev= 20; *cp++= 2; }
 	 else if (prev == 20) { cp[-1]++; }
 	 else *cp++= prev= 17;
-	 *dp++= fir[2];
-	 *dp++= fir[1];
-	 *dp++= fir[0];
+	 C_FIR(2);
+	 C_FIR(1);
+	 C_FIR(0);
       } else if (n_fir == 0 && n_iir == 3) {
 	 if (prev == 16) { cp[-1]= prev= 19; *cp++= 2; }
 	 else if (prev == 19) { cp[-1]++; }
 	 else *cp++= prev= 16;
-	 *dp++= iir[2]*adj;
-	 *dp++= iir[1]*adj;
+	 C_IIR(2);
+	 C_IIR(1);
       } else {
-	 prev= 0;	// Just cancel 'prev' as we only use it for 16-18,19-21
+	 prev= 0;	// Just cancel 'prev' as we only use it for 16-28
 	 if (cnt > n_fir) {
 	    a= 0; 
 	    while (cnt > n_fir && cnt > 2) {
-	       *dp++= iir[--cnt] * adj; a++;
+	       --cnt; C_IIR(cnt); a++;
 	    }
 	    while (a >= 4) { 
 	       int nn= a/4; if (nn > 255) nn= 255;
@@ -306,7 +511,7 @@ fid_run_new(FidFilter *filt, double (**funcpp)(void *,double)) {
 	 if (cnt > n_iir) {
 	    a= 0; 
 	    while (cnt > n_iir && cnt > 2) {
-	       *dp++= fir[--cnt]; a++;
+	       --cnt; C_FIR(cnt); a++;
 	    }
 	    while (a >= 4) { 
 	       int nn= a/4; if (nn > 255) nn= 255;
@@ -317,7 +522,7 @@ fid_run_new(FidFilter *filt, double (**funcpp)(void *,double)) {
 	 a= 0;
 	 while (cnt > 2) {
 	    cnt--; a++;
-	    *dp++= iir[cnt]*adj; *dp++= fir[cnt];
+	    C_IIR(cnt); C_FIR(cnt);
 	 }
 	 while (a >= 4) { 
 	    int nn= a/4; if (nn > 255) nn= 255;
@@ -327,22 +532,28 @@ fid_run_new(FidFilter *filt, double (**funcpp)(void *,double)) {
 
 	 if (!n_fir) {
 	    *cp++= 13;
-	    *dp++= iir[1];
+	    C_IIR1(1);
 	 } else if (!n_iir) {
 	    *cp++= 14;
-	    *dp++= fir[1];
-	    *dp++= fir[0];
+	    C_FIR(1);
+	    C_FIR(0);
 	 } else {
 	    *cp++= 15;
-	    *dp++= iir[1];
-	    *dp++= fir[1];
-	    *dp++= fir[0];
+	    C_IIR1(1);
+	    C_FIR(1);
+	    C_FIR(0);
 	 }
       }
    }
+
+#undef C_IIR1
+#undef C_FIR
+#undef C_IIR
+#undef CBM
    
    if (gain != 1.0) {
       *cp++= 22;
+      *vp++= 1;
       *dp++= gain;
    }
    *cp++= 0;
@@ -354,17 +565,6 @@ fid_run_new(FidFilter *filt, double (**funcpp)(void *,double)) {
        cmd_cnt > cmd_max) 
       error("fid_run_new internal error; arrays exceeded");
 
-   // Allocate the final Run structure to return
-   rr= (Run*)Alloc(sizeof(Run) +
-		   coef_cnt*sizeof(double) +
-		   cmd_cnt*sizeof(char));
-   rr->magic= 0x64966325;
-   rr->buf_size= buf_size;
-   rr->coef= (double*)(rr+1);
-   rr->cmd= (char*)(rr->coef + coef_cnt);
-   memcpy(rr->coef, coef_tmp, coef_cnt*sizeof(double));
-   memcpy(rr->cmd, cmd_tmp, cmd_cnt*sizeof(char));
-
    //DEBUG   {
    //DEBUG      int a;
    //DEBUG      for (cp= cmd_tmp; *cp; cp++) printf("%d ", *cp);
@@ -372,12 +572,142 @@ fid_run_new(FidFilter *filt, double (**funcpp)(void *,double)) {
    //DEBUG      //for (a= 0; a<coef_cnt; a++) printf("%g ", coef_tmp[a]);
    //DEBUG      //printf("\n");
    //DEBUG   }
-   
+
+   *coefp= coef_tmp;
+   *cvarp= cvar_tmp;
+   *coef_cntp= coef_cnt;
+   *cmdp= cmd_tmp;
+   *cmd_cntp= cmd_cnt;
+   return buf_size;
+}
+
+//
+//	Create an instance of a filter, ready to run.  This returns a
+//	void* handle, and a function to call to execute the filter.
+//	Working buffers for the filter instances must be allocated
+//	separately using fid_run_newbuf().  This allows many
+//	simultaneous instances of the filter to be run.  
+//
+//	The sub-filters are executed in the precise order that they
+//	are given.  This may lead to some inefficiency.  Normally when
+//	an IIR filter is followed by an FIR filter, the buffers can be
+//	shared.  However, if the sub-filters are not in IIR/FIR pairs,
+//	then extra memory accesses are required.
+//
+//	The returned handle must be released using fid_run_free().
+//
+
+static Run *
+run_new(FidFilter *filt) {
+   double *coef_tmp;
+   char *cvar_tmp;
+   uchar *cmd_tmp;
+   int coef_cnt, cmd_cnt;
+   int buf_size;
+   Run *rr;
+
+   buf_size= compile_run(filt, &coef_tmp, &cvar_tmp, &coef_cnt, &cmd_tmp, &cmd_cnt);
+
+   // Allocate the final Run structure to return, with both
+   // coefficient banks starting off the same
+   rr= (Run*)Alloc(sizeof(Run) +
+		   2*coef_cnt*sizeof(double) +
+		   coef_cnt*sizeof(char) +
+		   cmd_cnt*sizeof(char));
+   rr->magic= 0x64966325;
+   rr->buf_size= buf_size;
+   rr->coef_cnt= coef_cnt;
+   rr->bank[0]= (double*)(rr+1);
+   rr->bank[1]= rr->bank[0] + coef_cnt;
+   rr->coef= rr->bank[0];
+   rr->cvar= (char*)(rr->bank[1] + coef_cnt);
+   rr->cmd= rr->cvar + coef_cnt;
+   memcpy(rr->bank[0], coef_tmp, coef_cnt*sizeof(double));
+   memcpy(rr->bank[1], coef_tmp, coef_cnt*sizeof(double));
+   memcpy(rr->cvar, cvar_tmp, coef_cnt*sizeof(char));
+   memcpy(rr->cmd, cmd_tmp, cmd_cnt*sizeof(char));
+
    free(coef_tmp);
+   free(cvar_tmp);
    free(cmd_tmp);
+   return rr;
+}
 
+void *
+fid_run_new(FidFilter *filt, double (**funcpp)(void *,double)) {
+#ifdef RF_JIT
+   return fid_run_new_jit(filt, funcpp);
+#else
    *funcpp= filter_step;
-   return rr;
+   return run_new(filt);
+#endif
+}
+
+//
+//	Retune a running filter: replace its coefficients with those
+//	of 'filt', typically the same filter spec designed for a new
+//	frequency.  This avoids creating a new Run and re-pointing all
+//	the buffers.  The filter must compile to the same command list
+//	and the same constant coefficients; if it doesn't, 0 is
+//	returned and nothing is changed, otherwise 1 (or -1, below).
+//
+//	Only the non-constant coefficients are written, into the bank
+//	not currently in use, which is then switched in with a single
+//	atomic store.  So a fid_run_block() running concurrently in
+//	another thread sees either the old or the new coefficients,
+//	never a mixture.  A block claims the bank it started on until
+//	it finishes, and while a block that started before the last
+//	update is still running on the other bank, -1 is returned and
+//	nothing is changed: try again later, e.g. on the next control
+//	tick.  Only one thread may update a Run.
+//
+//	The function returned by fid_run_new() doesn't claim a bank, as
+//	that would cost two atomic operations per sample, so to update
+//	a Run from another thread, run its buffers with fid_run_block()
+//	(a block of one sample if need be).
+//
+//	Buffers with a ramp set by fid_run_ramp() glide to the new
+//	coefficients rather than jumping.
+//
+
+int 
+fid_run_update_coef(void *run, FidFilter *filt) {
+   Run *rr= run;
+   double *coef_tmp, *cur, *nxt;
+   char *cvar_tmp;
+   uchar *cmd_tmp;
+   int coef_cnt, cmd_cnt;
+   int a, ok, idx;
+
+   if (rr->magic != 0x64966325)
+      error("Bad handle passed to fid_run_update_coef()");
+
+   compile_run(filt, &coef_tmp, &cvar_tmp, &coef_cnt, &cmd_tmp, &cmd_cnt);
+
+   // Check the structure matches
+   cur= rr->coef;
+   ok= (coef_cnt == rr->coef_cnt &&
+	0 == memcmp(cmd_tmp, rr->cmd, cmd_cnt) &&
+	0 == memcmp(cvar_tmp, rr->cvar, coef_cnt));
+   for (a= 0; ok && a<coef_cnt; a++) 
+      if (!rr->cvar[a] && coef_tmp[a] != cur[a]) ok= 0;
+
+   // Rewrite the other bank, unless a block is still running on it
+   idx= cur == rr->bank[0];
+   if (ok && BUSY_ADD(rr, idx, 0)) 
+      ok= -1;
+   if (ok == 1) {
+      nxt= rr->bank[idx];
+      for (a= 0; a<coef_cnt; a++) 
+	 if (rr->cvar[a]) nxt[a]= coef_tmp[a];
+      COEF_STORE(rr, nxt);
+      SEQ_STORE(rr, rr->seq + 1);
+   }
+
+   free(coef_tmp);
+   free(cvar_tmp);
+   free(cmd_tmp);
+   return ok;
 }
 
 //
@@ -394,11 +724,13 @@ fid_run_newbuf(void *run) {
       error("Bad handle passed to fid_run_newbuf()");
    
    siz= rr->buf_size ? rr->buf_size : 1;   // Minimum one element to avoid problems
-   rb= Alloc(sizeof(RunBuf) + siz * sizeof(double));
-   rb->coef= rr->coef;
+   rb= Alloc(sizeof(RunBuf) + (siz + 2*rr->coef_cnt) * sizeof(double));
+   rb->run= rr;
    rb->cmd= rr->cmd;
    rb->mov_cnt= (siz-1) * sizeof(double);
-   // rb->buf[] already zerod
+   rb->ramp_cur= rb->buf + siz;
+   rb->ramp_inc= rb->ramp_cur + rr->coef_cnt;
+   // rb->buf[] already zerod, ramping and denormal protection off
 
    return rb;
 }
@@ -416,7 +748,7 @@ fid_run_bufsize(void *run) {
       error("Bad handle passed to fid_run_bufsize()");
    
    siz= rr->buf_size ? rr->buf_size : 1;   // Minimum one element to avoid problems
-   return sizeof(RunBuf) + siz * sizeof(double);
+   return sizeof(RunBuf) + (siz + 2*rr->coef_cnt) * sizeof(double);
 }
 
 //
@@ -438,12 +770,156 @@ fid_run_initbuf(void *run, void *buf) {
       error("Bad handle passed to fid_run_initbuf()");
    
    siz= rr->buf_size ? rr->buf_size : 1;   // Minimum one element to avoid problems
-   rb->coef= rr->coef;
+   rb->run= rr;
    rb->cmd= rr->cmd;
    rb->mov_cnt= (siz-1) * sizeof(double);
+   rb->ramp_len= 0;
+   rb->ramp_left= 0;
+   rb->ramp_cur= rb->buf + siz;
+   rb->ramp_inc= rb->ramp_cur + rr->coef_cnt;
+   rb->ramp_targ= 0;
+   rb->denorm= 0;
+   rb->n_denorm= 0;
+   rb->dc= 0.0;
    memset(rb->buf, 0, rb->mov_cnt + sizeof(double));
 }
 
+//
+//	Set the length of the coefficient ramp for a buffer, in
+//	samples, or 0 to switch ramping off.  With ramping on, when
+//	fid_run_update_coef() changes the coefficients the buffer
+//	moves linearly to the new ones over this many samples, which
+//	avoids zipper noise on a sweep.  This must be called from the
+//	thread running the buffer.
+//
+
+void 
+fid_run_ramp(void *runbuf, int len) {
+   RunBuf *rb= runbuf;
+   Run *rr= rb->run;
+
+   if (rr->magic != 0x64966325)
+      error("Bad handle passed to fid_run_ramp()");
+   if (len < 0) len= 0;
+
+   if (len && !rb->ramp_len) {
+      int idx;
+      rb->seq= SEQ_LOAD(rr);
+      rb->ramp_targ= coef_claim(rr, &idx);
+      memcpy(rb->ramp_cur, rb->ramp_targ, rr->coef_cnt * sizeof(double));
+      coef_release(rr, idx);
+      rb->ramp_left= 0;
+   }
+   if (rb->ramp_left > len) 
+      rb->ramp_left= len;
+   rb->ramp_len= len;
+   rb->ramp_mul= len ? 1.0 / len : 0.0;
+}
+
+//
+//	Run a block of 'len' samples through the filter, from in[] to
+//	out[], which may be the same array.  Without a ramp, the
+//	coefficients are fixed for the duration of the block, so an
+//	update from another thread takes effect from the next block.
+//	The block claims its coefficient bank until it finishes; see
+//	fid_run_update_coef().  Denormal protection set by
+//	fid_run_denormal() applies here.
+//
+
+void 
+fid_run_block(void *runbuf, double *in, double *out, int len) {
+   RunBuf *rb= runbuf;
+   RunKern *kern= rb->run->kern;
+   double *coef;
+   double dc= rb->dc;		// 0.0 unless FID_DENORM_DC is set
+   unsigned long fpu= 0;
+   int idx;
+   
+   if (rb->denorm & FID_DENORM_FTZ) fpu= fpu_ftz_on();
+   coef= coef_claim(rb->run, &idx);
+
+   if (kern) {
+      // Compiled by fid_run_new_jit()
+      while (len-- > 0) {
+	 if (rb->ramp_len) coef= ramp_step(rb);
+	 *out++= kern(rb->buf, coef, *in++ + dc);
+	 dc= -dc;
+      }
+   } else if (!rb->ramp_len) {
+      while (len-- > 0) {
+	 *out++= run_cmds(rb, coef, *in++ + dc);
+	 dc= -dc;
+      }
+   } else {
+      while (len-- > 0) {
+	 *out++= run_cmds(rb, ramp_step(rb), *in++ + dc);
+	 dc= -dc;
+      }
+   }
+   rb->dc= dc;
+
+   coef_release(rb->run, idx);
+   if (rb->denorm & FID_DENORM_FTZ) fpu_restore(fpu);
+
+   // Count after restoring the FPU state, as with DAZ set a
+   // subnormal compares equal to zero
+   if (rb->denorm & FID_DENORM_COUNT) {
+      int a, cnt= 0, n= rb->mov_cnt / sizeof(double) + 1;
+      for (a= 0; a<n; a++) 
+	 if (rb->buf[a] != 0.0 && fabs(rb->buf[a]) < DBL_MIN) cnt++;
+      rb->n_denorm= cnt;
+      STAT_CALL(st_denorm);
+      STAT_COUNT(st_denorm, cnt);
+   }
+}
+
+//
+//	Set the denormal protection for fid_run_block() on a buffer,
+//	any of these or'd together, or 0 for none (the default):
+//
+//	  FID_DENORM_FTZ -- set the FPU to flush subnormal results to
+//		zero and to treat subnormal inputs as zero, restoring the
+//		previous setting before returning.  Only on SSE2 and ARM64;
+//		elsewhere this does nothing.
+//	  FID_DENORM_DC -- add a tiny offset (1e-20) to the input,
+//		changing sign every sample, which keeps the state values of
+//		a ringing-down filter well clear of the subnormal range.
+//	  FID_DENORM_COUNT -- after each block, count the subnormal
+//		values in the buffer's state, for fid_run_denormals(), and
+//		with FID_STATS for fid_stats_dump().
+//
+//	As with fid_run_ramp(), this must be called from the thread
+//	running the buffer.  Per-sample calls through the function
+//	returned by fid_run_new() are not affected.
+//
+
+void 
+fid_run_denormal(void *runbuf, int mode) {
+   RunBuf *rb= runbuf;
+
+   if (rb->run->magic != 0x64966325)
+      error("Bad handle passed to fid_run_denormal()");
+
+   rb->denorm= mode;
+   if (!(mode & FID_DENORM_DC)) 
+      rb->dc= 0.0;
+   else if (rb->dc == 0.0) 
+      rb->dc= 1e-20;
+   if (!(mode & FID_DENORM_COUNT)) 
+      rb->n_denorm= 0;
+}
+
+//
+//	Return the number of subnormal state values found at the end of
+//	the last fid_run_block() on the buffer, with FID_DENORM_COUNT
+//	set, or 0.
+//
+
+int 
+fid_run_denormals(void *runbuf) {
+   return ((RunBuf*)runbuf)->n_denorm;
+}
+
 //
 //	Reinitialise an instance of the filter, allowing it to start
 //	afresh.  It assumes that the buffer was correctly initialised
@@ -473,6 +949,7 @@ fid_run_freebuf(void *runbuf) {
 
 void 
 fid_run_free(void *run) {
+   if (((Run*)run)->jit) jit_free(run);
    free(run);
 }
 
@@ -0,0 +1,674 @@
+//
+//	Fixed-point filter-running code.
+//
+//	This runs a filter without any floating point once it is set
+//	up, for ports to processors with no FPU.  Samples are 32-bit
+//	integers with full scale at +/-2^31 (Q31), coefficients and
+//	state are 32-bit, and each result is summed in 64 bits.  (The
+//	setup in fid_run_new_fx() still uses doubles.)
+//
+//	The sections are those of the float runner's command list,
+//	runf_compile() with FID_FORM_SVF, which pairs up the IIR and FIR
+//	filters and merges the gains as compile_run() does for
+//	fid_run_new().  Every biquad runs as a state-variable filter:
+//	in direct form the state of a 13Hz Q=800 resonator at 96k grows
+//	to 1e9 times its input, more than any 32-bit state can hold
+//	with bits to spare, whereas the SVF's grows by about Q.
+//
+//	Each signal -- a section's input and output, and each of its
+//	state values -- has its own binary exponent E, so that the
+//	integer v stands for v * 2^(E-31).  E is chosen from the norm
+//	of the transfer function from the filter's input to that
+//	signal: either its peak gain over frequency (FID_NORM_LINF),
+//	which a full-scale sinusoid just reaches, or the sum of the
+//	absolute values of its impulse response (FID_NORM_L1), which no
+//	input can exceed.  Each coefficient is held as a 32-bit
+//	mantissa and a right shift, which also lines the product up
+//	with the exponent of the sum it goes into, so the tiny damping
+//	terms of a high-Q section keep their full precision.
+//
+//	Sums are kept with FX_FRAC bits below the LSB of the result,
+//	which is then saturated to 32 bits.  The bits dropped from each
+//	state value are added back into the next sample's sum
+//	(first-order error feedback), so the rounding noise is shaped
+//	away from low frequencies, where a section's near-integrators
+//	would otherwise pile it up.
+//
+//	fid_run_snr_fx() gives the signal-to-noise ratio of the output
+//	against the double runner's, for checking a filter is suitable.
+//
+
+typedef struct RunX {
+   int magic;		// Magic: 0x64966329
+   int buf_size;	// Number of ints of state required per buffer
+   int *prog;		// Command list, each command followed by its terms
+} RunX;
+
+typedef struct RunBufX {
+   RunX *run;
+   int buf[0];
+} RunBufX;
+
+#define RUNX_MAGIC 0x64966329
+
+#define FX_FRAC 24		// Bits kept below the LSB of a result
+#define FX_SRMIN 2		// Smallest right shift of a term, to leave headroom
+#define FX_EMAX 80		// Largest exponent of a filter's output
+
+//
+//	Commands, each one section taking its input x from the previous
+//	one.  A term is two ints, a mantissa and a right shift, which
+//	multiply a 32-bit value into a 64-bit sum:
+//
+//	  0  END
+//	  1  State-variable biquad: terms x,ic2 -> v3; ic1,ic1,v3 ->
+//	     ic1; ic2,ic1,v3 -> ic2; x,ic1,ic2,v3 -> y.  State: ic1eq,
+//	     ic2eq and the residue of each
+//	  2  First order: terms x,w1,w1 -> w0; w0,w1 -> y; then the
+//	     error feedback factor (-1, 0 or 1).  State: w1 and its
+//	     residue
+//	  3  General: the section length N, terms x,w1..w[N-1] -> w0;
+//	     w0..w[N-1] -> y.  State: w1..w[N-1]
+//	  4  Gain: term x -> y
+//
+
+#define FX_T(pp, v) (((long long)(pp)[0] * (v)) >> (pp)[1])
+
+//
+//	Saturate a sum to 32 bits, setting *res to the bits dropped, to
+//	be fed back next time
+//
+
+STATIC_INLINE int
+fx_sat(long long acc, int *res) {
+   long long v= acc >> FX_FRAC;
+   if (v > 0x7FFFFFFFLL) { *res= 0; return 0x7FFFFFFF; }
+   if (v < -0x80000000LL) { *res= 0; return -0x7FFFFFFF-1; }
+   *res= (int)(acc - v * (1LL << FX_FRAC));
+   return (int)v;
+}
+
+//
+//	Round a sum to 32 bits, saturating
+//
+
+STATIC_INLINE int
+fx_round(long long acc) {
+   int res;
+   return fx_sat(acc + (1LL << (FX_FRAC-1)), &res);
+}
+
+static int
+runx_cmds(RunBufX *rb, int x) {
+   int *pp= rb->run->prog;
+   int *st= rb->buf;
+   long long a1, a2, y;
+   int v3, w0, res;
+   int a, n;
+
+   for (;;) switch (*pp++) {
+    case 0:
+       return x;
+    case 1:
+       v3= fx_round(FX_T(pp, x) + FX_T(pp+2, st[1]));
+       a1= FX_T(pp+4, st[0]) + FX_T(pp+6, st[0]) + FX_T(pp+8, v3) + st[2];
+       a2= FX_T(pp+10, st[1]) + FX_T(pp+12, st[0]) + FX_T(pp+14, v3) + st[3];
+       y= FX_T(pp+16, x) + FX_T(pp+18, st[0]) + FX_T(pp+20, st[1]) + FX_T(pp+22, v3);
+       st[0]= fx_sat(a1, &st[2]);
+       st[1]= fx_sat(a2, &st[3]);
+       x= fx_round(y);
+       pp += 24; st += 4;
+       break;
+    case 2:
+       a1= FX_T(pp, x) + FX_T(pp+2, st[0]) + FX_T(pp+4, st[0]) + pp[10] * (long long)st[1];
+       w0= fx_sat(a1, &res);
+       x= fx_round(FX_T(pp+6, w0) + FX_T(pp+8, st[0]));
+       st[0]= w0; st[1]= res;
+       pp += 11; st += 2;
+       break;
+    case 3:
+       n= *pp++;
+       a1= FX_T(pp, x);
+       for (a= 0; a<n-1; a++) a1 += FX_T(pp+2+2*a, st[a]);
+       w0= fx_sat(a1, &res);
+       pp += 2*n;
+       y= FX_T(pp, w0);
+       for (a= 0; a<n-1; a++) y += FX_T(pp+2+2*a, st[a]);
+       pp += 2*n;
+       memmove(st+1, st, (n-2) * sizeof(int));
+       st[0]= w0;
+       x= fx_round(y);
+       st += n-1;
+       break;
+    case 4:
+       x= fx_round(FX_T(pp, x));
+       pp += 2;
+       break;
+   }
+}
+
+static int
+runx_step(void *fbuf, int x) {
+   return runx_cmds(fbuf, x);
+}
+
+//
+//	Setup.  The sections of the float command list are gathered
+//	with the node gains needed to choose their exponents: [0] the
+//	output, [1] ic1eq or w, [2] ic2eq and [3] v3.
+//
+
+typedef struct FxSect {
+   int cmd;		// Float runner command: 4, 5, 6 or 8
+   int n;		// Section length, for the general section
+   double *c;		// Its coefficients in the float command list
+   double pk[4];	// Norm of the gain from the filter input to each node
+} FxSect;
+
+//
+//	The SVF's extra coefficients: those of the output as a sum of
+//	x, ic1eq, ic2eq and v3
+//
+
+static void
+fx_svf_out(double *c, double *p) {
+   p[0]= c[3];
+   p[1]= c[4] * (1.0 - c[0]) + c[5] * c[1];
+   p[2]= c[5];
+   p[3]= c[4] * c[1] + c[5] * c[2];
+}
+
+//
+//	Response of each node of a section to its input at z, into
+//	rv[node][2]
+//
+
+static void
+fx_sect_resp(FxSect *ss, double *zz, double rv[4][2]) {
+   double *c= ss->c;
+   double zi[2], bot[2], tmp[2];
+   int a;
+
+   memset(rv, 0, 4 * 2 * sizeof(double));
+   switch (ss->cmd) {
+    case 8: {
+       // With h= (z+1)/2, ic1eq and ic2eq solve:
+       //   (h-1+e)*ic1 + a2*ic2 = a2,  -a2*ic1 + (h-1+a3)*ic2 = a3
+       double aa[2], dd[2], det[2], p[4];
+       aa[0]= 0.5 * (zz[0] - 1.0) + c[0]; aa[1]= 0.5 * zz[1];
+       dd[0]= 0.5 * (zz[0] - 1.0) + c[2]; dd[1]= 0.5 * zz[1];
+       cass(det, aa); cmul(det, dd); det[0] += c[1] * c[1];
+       cassz(rv[1], 0.5 * c[1] * (zz[0] - 1.0), 0.5 * c[1] * zz[1]);
+       cdiv(rv[1], det);
+       cass(rv[2], aa); cmulr(rv[2], c[2]); rv[2][0] += c[1] * c[1];
+       cdiv(rv[2], det);
+       cassz(rv[3], 1.0, 0.0); csub(rv[3], rv[2]);
+       fx_svf_out(c, p);
+       rv[0][0]= p[0];
+       for (a= 1; a<4; a++) {
+	  cass(tmp, rv[a]); cmulr(tmp, p[a]); cadd(rv[0], tmp);
+       }
+       break; }
+    case 4:
+       cassz(zi, 1.0, 0.0); cdiv(zi, zz);
+       cassz(bot, 1.0, 0.0); cass(tmp, zi); cmulr(tmp, c[0]); cadd(bot, tmp);
+       cassz(rv[1], 1.0, 0.0); cdiv(rv[1], bot);
+       cass(rv[0], zi); cmulr(rv[0], c[2]); caddz(rv[0], c[1], 0.0);
+       cdiv(rv[0], bot);
+       break;
+    case 5:
+       cassz(zi, 1.0, 0.0); cdiv(zi, zz);
+       evaluate(tmp, c, ss->n-1, zi);
+       // tmp= 1 + sum(c[a] z^-(a+1)) = 1 + z^-1 * (that polynomial)
+       cmul(tmp, zi); caddz(tmp, 1.0, 0.0);
+       cassz(rv[1], 1.0, 0.0); cdiv(rv[1], tmp);
+       evaluate(rv[0], c + ss->n-1, ss->n, zi);
+       cdiv(rv[0], tmp);
+       break;
+    case 6:
+       rv[0][0]= c[0];
+       break;
+   }
+}
+
+//
+//	Peak gains of every node, over a grid of frequencies with extra
+//	points across each SVF's resonance
+//
+
+static void
+fx_norm_linf(FxSect *sect, int n_sect) {
+   int n_freq= 0, max_freq= 2050, a, b, i;
+   double *freq, *pre;
+
+   for (a= 0; a<n_sect; a++)
+      if (sect[a].cmd == 8) max_freq += 33;
+   freq= ALLOC_ARR(max_freq, double);
+   pre= ALLOC_ARR(2*max_freq, double);
+
+   freq[n_freq++]= 0.0;
+   freq[n_freq++]= 0.5;
+   for (i= 1; i<1024; i++) {
+      freq[n_freq++]= 0.5 * i / 1024;
+      freq[n_freq++]= 0.5 * pow(1e-6, i / 1024.0);
+   }
+   for (a= 0; a<n_sect; a++) if (sect[a].cmd == 8) {
+      double *c= sect[a].c;
+      double g= c[2] / c[1];
+      double k= c[0] / ((1.0 - c[0]) * g) - g;
+      double f0= atan(g) / M_PI;
+      for (i= -16; i<=16; i++) {
+	 double ff= f0 * (1.0 + k * i / 8.0);
+	 if (ff > 0 && ff < 0.5) freq[n_freq++]= ff;
+      }
+   }
+
+   for (i= 0; i<n_freq; i++) {
+      pre[2*i]= 1.0; pre[2*i+1]= 0.0;
+   }
+   for (a= 0; a<n_sect; a++) {
+      FxSect *ss= &sect[a];
+      for (b= 0; b<4; b++) ss->pk[b]= 0.0;
+      for (i= 0; i<n_freq; i++) {
+	 double theta= 2 * M_PI * freq[i];
+	 double zz[2], rv[4][2];
+	 zz[0]= cos(theta); zz[1]= sin(theta);
+	 fx_sect_resp(ss, zz, rv);
+	 for (b= 0; b<4; b++) {
+	    double mag;
+	    cmul(rv[b], pre + 2*i);
+	    mag= hypot(rv[b][0], rv[b][1]);
+	    if (mag > ss->pk[b]) ss->pk[b]= mag;
+	 }
+	 cass(pre + 2*i, rv[0]);
+      }
+   }
+   free(pre);
+   free(freq);
+}
+
+//
+//	Sums of the absolute impulse responses of every node, run in
+//	double with the same arithmetic as the fixed-point sections,
+//	until the response has died away or for 2^22 samples, which is
+//	enough for all but the very highest-Q low filters
+//
+
+static void
+fx_norm_l1(FxSect *sect, int n_sect, int buf_size) {
+   double *st= ALLOC_ARR(buf_size + 1, double);
+   double peak= 0.0;
+   long cnt;
+   int a, b;
+
+   for (a= 0; a<n_sect; a++)
+      for (b= 0; b<4; b++) sect[a].pk[b]= 0.0;
+
+   for (cnt= 0; cnt < (1L<<22); cnt++) {
+      double x= cnt ? 0.0 : 1.0, sum= 0.0;
+      double *sp= st;
+      for (a= 0; a<n_sect; a++) {
+	 FxSect *ss= &sect[a];
+	 double *c= ss->c, p[4], v3, i1, i2, w0, y;
+	 switch (ss->cmd) {
+	  case 8:
+	     fx_svf_out(c, p);
+	     v3= x - sp[1];
+	     i1= sp[0] - 2*c[0]*sp[0] + 2*c[1]*v3;
+	     i2= sp[1] + 2*c[1]*sp[0] + 2*c[2]*v3;
+	     y= p[0]*x + p[1]*sp[0] + p[2]*sp[1] + p[3]*v3;
+	     ss->pk[3] += fabs(v3);
+	     sp[0]= i1; sp[1]= i2;
+	     ss->pk[1] += fabs(i1); ss->pk[2] += fabs(i2);
+	     sp += 2;
+	     break;
+	  case 4:
+	     w0= x - c[0] * sp[0];
+	     y= c[1] * w0 + c[2] * sp[0];
+	     sp[0]= w0;
+	     ss->pk[1] += fabs(w0);
+	     sp += 1;
+	     break;
+	  case 5:
+	     w0= x;
+	     for (b= 0; b<ss->n-1; b++) w0 -= c[b] * sp[b];
+	     y= c[ss->n-1] * w0;
+	     for (b= 0; b<ss->n-1; b++) y += c[ss->n+b] * sp[b];
+	     memmove(sp+1, sp, (ss->n-2) * sizeof(double));
+	     sp[0]= w0;
+	     ss->pk[1] += fabs(w0);
+	     sp += ss->n-1;
+	     break;
+	  default:
+	     y= c[0] * x;
+	     break;
+	 }
+	 ss->pk[0] += fabs(y);
+	 x= y;
+      }
+      for (b= 0; b<buf_size; b++) sum += fabs(st[b]);
+      if (sum > peak) peak= sum;
+      if (cnt >= 64 && sum <= 1e-15 * peak) break;
+   }
+   free(st);
+}
+
+//
+//	Exponent for a signal of the given peak, i.e. the least E with
+//	peak <= 2^E, clamped to a sane range
+//
+
+static int
+fx_exp(double peak) {
+   int ee;
+   double mm;
+   if (!(peak > 0)) return -40;
+   mm= frexp(peak, &ee);
+   if (mm == 0.5) ee--;
+   return ee < -40 ? -40 : ee > 40 ? 40 : ee;
+}
+
+//
+//	Raise the exponent 'et' of a result, if need be, so that the
+//	term for multiplying a value of exponent 'ev' by 'cc' fits its
+//	sum.  A norm can be well below the size of the terms that cancel
+//	to make it up.
+//
+
+static int
+fx_fit(int et, double cc, int ev) {
+   int ec;
+   if (cc == 0.0) return et;
+   frexp(cc, &ec);
+   return ec + ev + FX_SRMIN - 31 + FX_FRAC > et ? ec + ev + FX_SRMIN - 31 + FX_FRAC : et;
+}
+
+//
+//	Store the term for multiplying a value of exponent 'ev' by 'cc'
+//	into a sum for a result of exponent 'et'
+//
+
+static int *
+fx_term(int *pp, double cc, int ev, int et) {
+   double mant;
+   int ec, sr;
+
+   if (cc == 0.0) {
+      *pp++= 0; *pp++= FX_SRMIN;
+      return pp;
+   }
+   frexp(cc, &ec);
+   sr= et + 31 - FX_FRAC - ec - ev;
+   if (sr < FX_SRMIN)
+      error("Internal error: fid_run_new_fx term too big for its result");
+   if (sr > 62) sr= 62;
+   mant= floor(ldexp(cc, 31 - ec) + 0.5);
+   if (mant > 0x7FFFFFFF) mant= 0x7FFFFFFF;
+   if (mant < -0x7FFFFFFF) mant= -0x7FFFFFFF;
+   *pp++= (int)mant;
+   *pp++= sr;
+   return pp;
+}
+
+//
+//	Gather the sections of a filter with their node norms.  The
+//	sections point into *coefp, which the caller frees along with
+//	them.  Also gives the number of ints of command list and of
+//	state the fixed-point version needs.
+//
+
+static FxSect *
+fx_gather(FidFilter *filt, int norm, double **coefp, int *n_sectp, 
+	  int *prog_cntp, int *buf_sizep) {
+   FxSect *sect;
+   double *coef, *dp;
+   unsigned char *cmd, *cp;
+   int n_coef, n_cmd, n_sect= 0, buf_size= 0, f_buf_size;
+   int prog_cnt= 1 + 3*FX_EMAX/4;	// END, and steps down to Q31
+
+   f_buf_size= runf_compile(filt, FID_FORM_SVF, &coef, &n_coef, &cmd, &n_cmd);
+   sect= ALLOC_ARR(n_cmd, FxSect);
+
+   for (cp= cmd, dp= coef; *cp; ) {
+      FxSect *ss= &sect[n_sect++];
+      ss->cmd= *cp++;
+      ss->c= dp;
+      switch (ss->cmd) {
+       case 8:
+	  dp += 6; prog_cnt += 25; buf_size += 4;
+	  break;
+       case 4:
+	  dp += 3; prog_cnt += 12; buf_size += 2;
+	  break;
+       case 5:
+	  ss->n= *cp++;
+	  dp += 2*ss->n-1; prog_cnt += 2 + 4*ss->n; buf_size += ss->n-1;
+	  break;
+       case 6:
+	  dp += 1; prog_cnt += 3;
+	  break;
+       default:
+	  error("Internal error: fid_run_new_fx got float command %d", ss->cmd);
+      }
+   }
+
+   if (norm == FID_NORM_L1)
+      fx_norm_l1(sect, n_sect, f_buf_size);
+   else if (norm == FID_NORM_LINF)
+      fx_norm_linf(sect, n_sect);
+   else
+      error("fid_run_new_fx: unknown norm %d", norm);
+
+   free(cmd);
+   *coefp= coef;
+   *n_sectp= n_sect;
+   *prog_cntp= prog_cnt;
+   *buf_sizep= buf_size;
+   return sect;
+}
+
+//
+//	Compile a filter to a fixed-point command list, scaling the
+//	signals by the given FID_NORM_* norm
+//
+
+void *
+fid_run_new_fx(FidFilter *filt, int norm, int (**funcpp)(void *, int)) {
+   RunX *rr;
+   FxSect *sect;
+   double *coef;
+   int *prog, *pp;
+   int n_sect, prog_cnt, buf_size;
+   int e_in= 0, a, b;
+
+   sect= fx_gather(filt, norm, &coef, &n_sect, &prog_cnt, &buf_size);
+   pp= prog= ALLOC_ARR(prog_cnt, int);
+   for (a= 0; a<n_sect; a++) {
+      FxSect *ss= &sect[a];
+      double *c= ss->c, p[4];
+      int e_out= fx_exp(ss->pk[0]);
+      int e1= fx_exp(ss->pk[1]), e2, e3, beta, cnt;
+
+      switch (ss->cmd) {
+       case 8:
+	  fx_svf_out(c, p);
+	  e2= fx_exp(ss->pk[2]);
+	  e3= fx_exp(ss->pk[3]);
+	  // v3 is often the small difference of two large values
+	  for (cnt= 0; cnt<10; cnt++) {
+	     int sum= e1 + e2 + e3;
+	     e3= fx_fit(fx_fit(e3, 1.0, e_in), 1.0, e2);
+	     e1= fx_fit(e1, 2*c[1], e3);
+	     e2= fx_fit(fx_fit(e2, 2*c[1], e1), 2*c[2], e3);
+	     if (e1 + e2 + e3 == sum) break;
+	  }
+	  for (b= 0; b<4; b++)
+	     e_out= fx_fit(e_out, p[b], b == 0 ? e_in : b == 1 ? e1 : b == 2 ? e2 : e3);
+	  if (a == n_sect-1 && e_out < 0) e_out= 0;
+	  *pp++= 1;
+	  pp= fx_term(pp, 1.0, e_in, e3);
+	  pp= fx_term(pp, -1.0, e2, e3);
+	  pp= fx_term(pp, 1.0, e1, e1);
+	  pp= fx_term(pp, -2*c[0], e1, e1);
+	  pp= fx_term(pp, 2*c[1], e3, e1);
+	  pp= fx_term(pp, 1.0, e2, e2);
+	  pp= fx_term(pp, 2*c[1], e1, e2);
+	  pp= fx_term(pp, 2*c[2], e3, e2);
+	  pp= fx_term(pp, p[0], e_in, e_out);
+	  pp= fx_term(pp, p[1], e1, e_out);
+	  pp= fx_term(pp, p[2], e2, e_out);
+	  pp= fx_term(pp, p[3], e3, e_out);
+	  break;
+       case 4:
+	  // Feed the error back by the integer nearest the pole
+	  beta= c[0] < -0.5 ? 1 : c[0] > 0.5 ? -1 : 0;
+	  e1= fx_fit(e1, 1.0, e_in);
+	  e_out= fx_fit(fx_fit(e_out, c[1], e1), c[2], e1);
+	  if (a == n_sect-1 && e_out < 0) e_out= 0;
+	  *pp++= 2;
+	  pp= fx_term(pp, 1.0, e_in, e1);
+	  pp= fx_term(pp, beta, e1, e1);
+	  pp= fx_term(pp, -c[0] - beta, e1, e1);
+	  pp= fx_term(pp, c[1], e1, e_out);
+	  pp= fx_term(pp, c[2], e1, e_out);
+	  *pp++= beta;
+	  break;
+       case 5:
+	  e1= fx_fit(e1, 1.0, e_in);
+	  for (b= 0; b<ss->n-1; b++) e1= fx_fit(e1, c[b], e1);
+	  for (b= 0; b<ss->n; b++) e_out= fx_fit(e_out, c[ss->n-1+b], e1);
+	  if (a == n_sect-1 && e_out < 0) e_out= 0;
+	  *pp++= 3;
+	  *pp++= ss->n;
+	  pp= fx_term(pp, 1.0, e_in, e1);
+	  for (b= 0; b<ss->n-1; b++) pp= fx_term(pp, -c[b], e1, e1);
+	  for (b= 0; b<ss->n; b++) pp= fx_term(pp, c[ss->n-1+b], e1, e_out);
+	  break;
+       case 6:
+	  e_out= fx_fit(e_out, c[0], e_in);
+	  if (a == n_sect-1 && e_out < 0) e_out= 0;
+	  *pp++= 4;
+	  pp= fx_term(pp, c[0], e_in, e_out);
+	  break;
+      }
+      e_in= e_out;
+   }
+
+   // Bring the output down to Q31 in saturating steps, if it can
+   // exceed full scale
+   if (e_in > FX_EMAX)
+      error("fid_run_new_fx: filter gain of 2^%d is too large", e_in);
+   while (e_in > 0) {
+      int step= e_in < 4 ? e_in : 4;
+      *pp++= 4;
+      pp= fx_term(pp, 1.0, e_in, e_in - step);
+      e_in -= step;
+   }
+   *pp++= 0;
+
+   rr= (RunX*)Alloc(sizeof(RunX) + prog_cnt * sizeof(int));
+   rr->magic= RUNX_MAGIC;
+   rr->buf_size= buf_size;
+   rr->prog= (int*)(rr+1);
+   memcpy(rr->prog, prog, (pp - prog) * sizeof(int));
+
+   free(prog);
+   free(sect);
+   free(coef);
+
+   *funcpp= runx_step;
+   return rr;
+}
+
+//
+//	Create a new instance of the given fixed-point filter
+//
+
+void *
+fid_run_newbuf_fx(void *run) {
+   RunX *rr= run;
+   RunBufX *rb;
+
+   if (rr->magic != RUNX_MAGIC)
+      error("Bad handle passed to fid_run_newbuf_fx()");
+
+   rb= Alloc(sizeof(RunBufX) + rr->buf_size * sizeof(int));
+   rb->run= rr;
+   return rb;
+}
+
+//
+//	Run a block of 'len' samples through the filter, from in[] to
+//	out[], which may be the same array.  The arithmetic is all
+//	integer, so there are no subnormals to protect against, and no
+//	fid_run_denormal() for this runner.
+//
+
+void
+fid_run_block_fx(void *runbuf, int *in, int *out, int len) {
+   RunBufX *rb= runbuf;
+   while (len-- > 0)
+      *out++= runx_cmds(rb, *in++);
+}
+
+//
+//	Reinitialise an instance of the filter, allowing it to start
+//	afresh
+//
+
+void
+fid_run_zapbuf_fx(void *buf) {
+   RunBufX *rb= buf;
+   memset(rb->buf, 0, rb->run->buf_size * sizeof(int));
+}
+
+void
+fid_run_freebuf_fx(void *runbuf) {
+   free(runbuf);
+}
+
+void
+fid_run_free_fx(void *run) {
+   free(run);
+}
+
+//
+//	Run 'len' samples of white noise at half full scale through
+//	the fixed-point filter and the double one, returning the ratio
+//	of the double output's power to that of the difference in dB.
+//	Saturation, where the filter's gain takes the output past full
+//	scale, shows up as a poor ratio too, so normalise the filter
+//	first.
+//
+
+double
+fid_run_snr_fx(FidFilter *filt, int norm, int len) {
+   double (*funcp)(void *, double);
+   int (*funcp_x)(void *, int);
+   void *run= fid_run_new(filt, &funcp);
+   void *buf= fid_run_newbuf(run);
+   void *run_x= fid_run_new_fx(filt, norm, &funcp_x);
+   void *buf_x= fid_run_newbuf_fx(run_x);
+   unsigned int seed= 1;
+   double sig= 0, err= 0;
+   int a;
+
+   for (a= 0; a<len; a++) {
+      int x, y_x;
+      double y;
+      seed= seed * 1103515245 + 12345;
+      x= (int)(seed >> 1) - 0x40000000;
+      y= funcp(buf, ldexp(x, -31));
+      y_x= funcp_x(buf_x, x);
+      sig += y * y;
+      err += (y - ldexp(y_x, -31)) * (y - ldexp(y_x, -31));
+   }
+
+   fid_run_freebuf_fx(buf_x);
+   fid_run_free_fx(run_x);
+   fid_run_freebuf(buf);
+   fid_run_free(run);
+   return err > 0 ? 10 * log10(sig / err) : 999.0;
+}
+
+// END //
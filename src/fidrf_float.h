@@ -0,0 +1,417 @@
+//
+//	Single-precision filter-running code.
+//
+//	This runs the same filters as fid_run_new(), but with float
+//	coefficients, state and samples, for large numbers of filters
+//	where memory bandwidth matters more than the last few bits.
+//
+//	Done naively, a float direct-form biquad is useless for the
+//	sort of filters fidlib designs: for a pole pair near z=1 the
+//	coefficients are close to -2 and 1, and rounding them to float
+//	moves a 13Hz Q=800 resonator at 96k by several Hz.  So each
+//	2nd-order IIR section is compiled to one of three forms,
+//	depending on where its poles are:
+//
+//	  - poles near z=1 (val[1] < -1): the state is kept as w[n-1]
+//	    and the difference d[n-1]= w[n-1]-w[n-2], and the
+//	    coefficients as A= 1+val[1]+val[2] and B= 1-val[2], which
+//	    are small numbers that float holds to full relative
+//	    precision:
+//
+//	      d[n]= x[n] + d[n-1] - B*d[n-1] - A*w[n-1]
+//	      w[n]= w[n-1] + d[n]
+//
+//	  - poles near z=-1 (val[1] > 1): the same, mirrored, using the
+//	    sum s[n-1]= w[n-1]+w[n-2] and A= 1-val[1]+val[2]
+//
+//	  - otherwise: direct form, but still with B= 1-val[2] in place
+//	    of val[2], as that is close to 1 for high Q
+//
+//	In the first two the rounding error of w[n] is not fed back
+//	through the resonance, as A is small.  The FIR half is worked
+//	out from the same state.  First-order sections are run in
+//	direct form, and anything else (long FIR filters, flattened
+//	IIR filters) as a general direct-form II section.
+//
+//	Alternatively fid_run_new_f_form() runs every biquad in one of
+//	the structures of fid_section_coef(): plain direct form (for
+//	comparison), the coupled form, or the state-variable filter.
+//	Biquads with real poles, which have no coupled form, get the
+//	automatic choice.
+//
+//	fid_run_error_f() gives the error of the float impulse response
+//	against the double one, for checking whether a filter is
+//	suitable.
+//
+
+typedef struct RunF {
+   int magic;		// Magic: 0x64966328
+   int buf_size;	// Number of floats of state required per buffer
+   float *coef;		// Coefficient list
+   unsigned char *cmd;	// Command list
+} RunF;
+
+typedef struct RunBufF {
+   RunF *run;
+   int denorm;		// FID_DENORM_* modes for fid_run_block_f(), or 0
+   float dc;		// Offset added to the next input with FID_DENORM_DC
+   float buf[0];
+} RunBufF;
+
+#define RUNF_MAGIC 0x64966328
+
+//
+//	Commands, each one section taking its input from the previous
+//	one, with the coefficients and state values it uses:
+//
+//	  0  END
+//	  1  Biquad, direct form: val[1], B, fir[0..2]; w[n-1], w[n-2]
+//	  2  Biquad, difference form: A, B, fir[0]+fir[1]+fir[2], fir[0],
+//	     fir[2]; w[n-1], d[n-1]
+//	  3  Biquad, sum form: A, B, fir[1]-fir[0]-fir[2], fir[0], fir[2];
+//	     w[n-1], s[n-1]
+//	  4  First order: val[1], fir[0..1]; w[n-1]
+//	  5  General: followed by a count byte N (the section length,
+//	     2..255), val[1..N-1], fir[0..N-1]; w[n-1..n-N+1]
+//	  6  Gain: gain
+//	  7  Biquad, coupled form: rc, rs, d, cu, cv; u[n], v[n]
+//	  8  Biquad, state-variable: 1-a1, a2, a3, m0, m1, m2, where
+//	     a1= 1/(1+g*(g+k)), a2= g*a1, a3= g*a2; ic1eq, ic2eq
+//
+
+static float
+runf_cmds(RunBufF *rb, float x) {
+   RunF *rr= rb->run;
+   unsigned char *cmd= rr->cmd;
+   float *coef= rr->coef;
+   float *st= rb->buf;
+   float w0, d0, y;
+   int a, n;
+
+   for (;;) switch (*cmd++) {
+    case 0:
+       return x;
+    case 1:
+       w0= x - coef[0] * st[0] - st[1] + coef[1] * st[1];
+       x= coef[2] * w0 + coef[3] * st[0] + coef[4] * st[1];
+       st[1]= st[0]; st[0]= w0;
+       coef += 5; st += 2;
+       break;
+    case 2:
+       d0= x + st[1] - coef[1] * st[1] - coef[0] * st[0];
+       x= coef[2] * st[0] + coef[3] * d0 - coef[4] * st[1];
+       st[0] += d0; st[1]= d0;
+       coef += 5; st += 2;
+       break;
+    case 3:
+       d0= x - st[1] + coef[1] * st[1] + coef[0] * st[0];
+       x= coef[2] * st[0] + coef[3] * d0 + coef[4] * st[1];
+       st[0]= d0 - st[0]; st[1]= d0;
+       coef += 5; st += 2;
+       break;
+    case 4:
+       w0= x - coef[0] * st[0];
+       x= coef[1] * w0 + coef[2] * st[0];
+       st[0]= w0;
+       coef += 3; st += 1;
+       break;
+    case 5:
+       n= *cmd++;
+       w0= x;
+       for (a= 0; a<n-1; a++) w0 -= coef[a] * st[a];
+       y= coef[n-1] * w0;
+       for (a= 0; a<n-1; a++) y += coef[n+a] * st[a];
+       memmove(st+1, st, (n-2) * sizeof(float));
+       st[0]= w0;
+       x= y;
+       coef += 2*n-1; st += n-1;
+       break;
+    case 6:
+       x *= *coef++;
+       break;
+    case 7:
+       y= coef[2] * x + coef[3] * st[0] + coef[4] * st[1];
+       w0= st[0] + coef[0] * st[0] - coef[1] * st[1] + x;
+       st[1] += coef[1] * st[0] + coef[0] * st[1];
+       st[0]= w0;
+       x= y;
+       coef += 5; st += 2;
+       break;
+    case 8:
+       d0= x - st[1];					// v3
+       w0= st[0] - coef[0] * st[0] + coef[1] * d0;	// v1
+       y= st[1] + coef[1] * st[0] + coef[2] * d0;	// v2
+       x= coef[3] * x + coef[4] * w0 + coef[5] * y;
+       st[0]= 2 * w0 - st[0];
+       st[1]= 2 * y - st[1];
+       coef += 6; st += 2;
+       break;
+   }
+}
+
+static float
+runf_step(void *fbuf, float x) {
+   return runf_cmds(fbuf, x);
+}
+
+//
+//	Compile a filter to a command and coefficient list as above,
+//	pairing up IIR and FIR filters and merging gains as
+//	compile_run() does, with biquads in the given FID_FORM_*.  The
+//	coefficients are left as doubles in an allocated array, for the
+//	caller to convert and free, as is the command list.  Returns
+//	the number of state values required.
+//
+
+static int
+runf_compile(FidFilter *filt, int form, double **coefp, int *coef_cntp, 
+	     unsigned char **cmdp, int *cmd_cntp) {
+   double gain= 1.0;
+   double *coef_tmp, *dp;
+   unsigned char *cmd_tmp, *cp;
+   int buf_size= 0;
+   int filt_cnt= 0, a;
+   FidFilter *ff;
+
+   for (ff= filt; ff->len; ff= FFNEXT(ff))
+      filt_cnt += ff->len;
+
+   // Worst case is a general section per filter, of twice its
+   // length, or an SVF per 3-coefficient IIR
+   dp= coef_tmp= ALLOC_ARR(2*filt_cnt + 1, double);
+   cp= cmd_tmp= ALLOC_ARR(2*filt_cnt + 2, unsigned char);
+
+   while (filt->len) {
+      double iir[3]= { 1.0, 0.0, 0.0 };
+      double fir[3]= { 1.0, 0.0, 0.0 };
+      double *ip= iir, *fp= fir, adj= 1.0;
+      int n_iir= 1, n_fir= 1, n;
+
+      if (filt->typ == 'F' && filt->len == 1) {
+	 gain *= filt->val[0];
+	 filt= FFNEXT(filt);
+	 continue;
+      }
+      if (filt->typ == 'I') {
+	 ip= filt->val; n_iir= filt->len;
+	 filt= FFNEXT(filt);
+	 while (filt->typ == 'F' && filt->len == 1) {
+	    gain *= filt->val[0];
+	    filt= FFNEXT(filt);
+	 }
+      } else if (filt->typ != 'F')
+	 error("Internal error: fid_run_new_f can only handle IIR + FIR types");
+      if (filt->typ == 'F') {
+	 fp= filt->val; n_fir= filt->len;
+	 filt= FFNEXT(filt);
+      }
+      adj= 1.0 / ip[0];
+      gain *= adj;
+      n= n_iir > n_fir ? n_iir : n_fir;
+
+      if (n_iir == 3 && n_fir <= 3) {
+	 double c1= ip[1] * adj, c2= ip[2] * adj;
+	 double f0= fp[0], f1= n_fir > 1 ? fp[1] : 0.0, f2= n_fir > 2 ? fp[2] : 0.0;
+	 double sc[5];
+	 if (form == FID_FORM_COUPLED && fid_section_coef(ip, 3, fp, n_fir, form, sc)) {
+	    // fid_section_coef() scales the FIR by 1/ip[0], already in 'gain'
+	    *cp++= 7;
+	    *dp++= sc[0]; *dp++= sc[1];
+	    for (a= 2; a<5; a++) *dp++= sc[a] * ip[0];
+	 } else if (form == FID_FORM_SVF) {
+	    double a1, g;
+	    fid_section_coef(ip, 3, fp, n_fir, form, sc);
+	    g= sc[0];
+	    a1= 1.0 / (1.0 + g * (g + sc[1]));
+	    *cp++= 8;
+	    *dp++= g * (g + sc[1]) * a1;	// 1-a1
+	    *dp++= g * a1;
+	    *dp++= g * g * a1;
+	    for (a= 2; a<5; a++) *dp++= sc[a] * ip[0];
+	 } else if (form == FID_FORM_DIRECT) {
+	    *cp++= 1;
+	    *dp++= c1; *dp++= 1.0 - c2;
+	    *dp++= f0; *dp++= f1; *dp++= f2;
+	 } else if (c1 < -1.0) {
+	    *cp++= 2;
+	    *dp++= 1.0 + c1 + c2; *dp++= 1.0 - c2;
+	    *dp++= f0 + f1 + f2; *dp++= f0; *dp++= f2;
+	 } else if (c1 > 1.0) {
+	    *cp++= 3;
+	    *dp++= 1.0 - c1 + c2; *dp++= 1.0 - c2;
+	    *dp++= f1 - f0 - f2; *dp++= f0; *dp++= f2;
+	 } else {
+	    *cp++= 1;
+	    *dp++= c1; *dp++= 1.0 - c2;
+	    *dp++= f0; *dp++= f1; *dp++= f2;
+	 }
+	 buf_size += 2;
+      } else if (n == 2) {
+	 *cp++= 4;
+	 *dp++= n_iir > 1 ? ip[1] * adj : 0.0;
+	 *dp++= fp[0]; *dp++= n_fir > 1 ? fp[1] : 0.0;
+	 buf_size += 1;
+      } else if (n > 1) {
+	 if (n > 255)
+	    error("fid_run_new_f: filter of length %d is too long", n);
+	 *cp++= 5; *cp++= n;
+	 for (a= 1; a<n; a++) *dp++= a < n_iir ? ip[a] * adj : 0.0;
+	 for (a= 0; a<n; a++) *dp++= a < n_fir ? fp[a] : 0.0;
+	 buf_size += n-1;
+      } else {
+	 gain *= fp[0];		// A lone 1-element IIR
+      }
+   }
+   if (gain != 1.0) {
+      *cp++= 6;
+      *dp++= gain;
+   }
+   *cp++= 0;
+
+   *coefp= coef_tmp; *coef_cntp= dp - coef_tmp;
+   *cmdp= cmd_tmp; *cmd_cntp= cp - cmd_tmp;
+   return buf_size;
+}
+
+void *
+fid_run_new_f_form(FidFilter *filt, int form, float (**funcpp)(void *, float)) {
+   RunF *rr;
+   double *coef_tmp;
+   unsigned char *cmd_tmp;
+   int coef_cnt, cmd_cnt, buf_size, a;
+
+   buf_size= runf_compile(filt, form, &coef_tmp, &coef_cnt, &cmd_tmp, &cmd_cnt);
+   rr= (RunF*)Alloc(sizeof(RunF) + coef_cnt * sizeof(float) + cmd_cnt);
+   rr->magic= RUNF_MAGIC;
+   rr->buf_size= buf_size;
+   rr->coef= (float*)(rr+1);
+   rr->cmd= (unsigned char*)(rr->coef + coef_cnt);
+   for (a= 0; a<coef_cnt; a++)
+      rr->coef[a]= (float)coef_tmp[a];
+   memcpy(rr->cmd, cmd_tmp, cmd_cnt);
+
+   free(coef_tmp);
+   free(cmd_tmp);
+
+   *funcpp= runf_step;
+   return rr;
+}
+
+void *
+fid_run_new_f(FidFilter *filt, float (**funcpp)(void *, float)) {
+   return fid_run_new_f_form(filt, FID_FORM_AUTO, funcpp);
+}
+
+//
+//	Create a new instance of the given float filter
+//
+
+void *
+fid_run_newbuf_f(void *run) {
+   RunF *rr= run;
+   RunBufF *rb;
+
+   if (rr->magic != RUNF_MAGIC)
+      error("Bad handle passed to fid_run_newbuf_f()");
+
+   rb= Alloc(sizeof(RunBufF) + rr->buf_size * sizeof(float));
+   rb->run= rr;
+   return rb;
+}
+
+//
+//	Run a block of 'len' samples through the filter, from in[] to
+//	out[], which may be the same array.  Denormal protection set by
+//	fid_run_denormal_f() applies here.
+//
+
+void
+fid_run_block_f(void *runbuf, float *in, float *out, int len) {
+   RunBufF *rb= runbuf;
+   float dc= rb->dc;		// 0.0 unless FID_DENORM_DC is set
+   unsigned long fpu= 0;
+
+   if (rb->denorm & FID_DENORM_FTZ) fpu= fpu_ftz_on();
+   while (len-- > 0) {
+      *out++= runf_cmds(rb, *in++ + dc);
+      dc= -dc;
+   }
+   rb->dc= dc;
+   if (rb->denorm & FID_DENORM_FTZ) fpu_restore(fpu);
+}
+
+//
+//	Set the denormal protection for fid_run_block_f() on a buffer:
+//	FID_DENORM_FTZ and FID_DENORM_DC as for fid_run_denormal(), or 0
+//	for none.  Float state goes subnormal below 1.2e-38, far sooner
+//	than double.  FID_DENORM_COUNT is not available here.
+//
+
+void
+fid_run_denormal_f(void *runbuf, int mode) {
+   RunBufF *rb= runbuf;
+
+   if (rb->run->magic != RUNF_MAGIC)
+      error("Bad handle passed to fid_run_denormal_f()");
+
+   rb->denorm= mode;
+   if (!(mode & FID_DENORM_DC)) 
+      rb->dc= 0.0f;
+   else if (rb->dc == 0.0f) 
+      rb->dc= 1e-20f;
+}
+
+//
+//	Reinitialise an instance of the filter, allowing it to start
+//	afresh
+//
+
+void
+fid_run_zapbuf_f(void *buf) {
+   RunBufF *rb= buf;
+   memset(rb->buf, 0, rb->run->buf_size * sizeof(float));
+}
+
+void
+fid_run_freebuf_f(void *runbuf) {
+   free(runbuf);
+}
+
+void
+fid_run_free_f(void *run) {
+   free(run);
+}
+
+//
+//	Compare the float (with biquads in the given FID_FORM_*) and
+//	double impulse responses of a filter over 'len' samples,
+//	returning the RMS of the difference relative to the RMS of the
+//	double response, e.g. 1e-6 for about 120dB below the signal.
+//
+
+double
+fid_run_error_f(FidFilter *filt, int form, int len) {
+   double (*funcp)(void *, double);
+   float (*funcp_f)(void *, float);
+   void *run= fid_run_new(filt, &funcp);
+   void *buf= fid_run_newbuf(run);
+   void *run_f= fid_run_new_f_form(filt, form, &funcp_f);
+   void *buf_f= fid_run_newbuf_f(run_f);
+   double sum= 0, err= 0;
+   int a;
+
+   for (a= 0; a<len; a++) {
+      double y= funcp(buf, a ? 0.0 : 1.0);
+      double y_f= funcp_f(buf_f, a ? 0.0f : 1.0f);
+      sum += y * y;
+      err += (y - y_f) * (y - y_f);
+   }
+
+   fid_run_freebuf_f(buf_f);
+   fid_run_free_f(run_f);
+   fid_run_freebuf(buf);
+   fid_run_free(run);
+   return sum > 0 ? sqrt(err / sum) : sqrt(err);
+}
+
+// END //
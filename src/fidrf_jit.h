@@ -0,0 +1,404 @@
+//
+//	Run-time compiled filter-running code, for x86-64 Linux.
+//
+//	This compiles the command list of a Run made by the
+//	command-list code into straight-line machine code, with no
+//	command dispatch, no loop counters and no memmove of the
+//	buffer: each delay value is loaded and stored once at a fixed
+//	offset.  The arithmetic is exactly that of run_cmds(), done in
+//	the same order, so the results are identical bit for bit, and
+//	the Run is otherwise the same, working with fid_run_newbuf(),
+//	fid_run_update_coef(), fid_run_block() and the rest.
+//
+//	The coefficients are not built into the code but loaded from
+//	the Run's current coefficient list on every step (once per
+//	block through fid_run_block()), so that retuning works as
+//	before.  The code uses scalar SSE2, or the
+//	three-operand AVX forms of the same instructions where the CPU
+//	has them, which saves the register copies.  Wider vectors are
+//	no use here, as every sum feeds into the next one and doing
+//	them in another order would change the results.
+//
+//	Two entry points are generated into one page, which is mapped
+//	writable to fill in and then switched to executable (never both
+//	at once):
+//
+//	  - the step function returned through 'funcpp', with the same
+//	    signature as filter_step().  This loads the coefficient list
+//	    from the Run and falls through into the kernel, or jumps to
+//	    filter_step() if the buffer has a ramp set by fid_run_ramp().
+//
+//	  - the kernel, Run.kern, taking the state buffer and coefficient
+//	    list directly, which fid_run_block() calls per sample.
+//
+//	On any other platform, or if the page can't be had,
+//	fid_run_new_jit() gives an ordinary command-list Run instead.
+//
+
+#if defined(T_LINUX) && defined(__x86_64__)
+#define JIT_X64
+#endif
+
+#ifdef JIT_X64
+
+#include <sys/mman.h>
+#include <stddef.h>
+
+typedef struct Jit {
+   uchar *code;		// Output, or 0 when just measuring the code
+   int len;		// Bytes output so far
+   int avx;		// Use the VEX (AVX) encodings
+   int siz;		// Buffer length in doubles (at least 1)
+   int pos;		// Index into buf[] of the next delay value
+   int ci;		// Index into coef[] of the next coefficient
+} Jit;
+
+// XMM registers: the 'iir', 'fir' and 'tmp' of run_cmds(), and a
+// scratch register for products
+#define X_IIR 0
+#define X_FIR 1
+#define X_TMP 2
+#define X_T 3
+
+// General registers of the kernel: buf (rdi) and coef (rsi), as
+// passed in by the SysV calling convention
+#define R_BUF 7
+#define R_COEF 6
+
+// SSE2 opcodes (after 0F), and their prefix bytes
+#define OP_LOAD 0x10	// movsd xmm, m64
+#define OP_STORE 0x11	// movsd m64, xmm
+#define OP_MOVE 0x28	// movapd xmm, xmm
+#define OP_ADD 0x58	// addsd
+#define OP_MUL 0x59	// mulsd
+#define OP_SUB 0x5C	// subsd
+#define OP_XOR 0x57	// xorpd
+#define PFX_SD 0xF2
+#define PFX_PD 0x66
+
+static void
+jit_byte(Jit *jj, int val) {
+   if (jj->code) jj->code[jj->len]= val;
+   jj->len++;
+}
+
+static void
+jit_int(Jit *jj, int val) {
+   int a;
+   for (a= 0; a<4; a++)
+      jit_byte(jj, (unsigned)val >> (8*a));
+}
+
+//
+//	Output one SSE2 instruction 'dst= src1 op src2', where src2 is
+//	either an XMM register (base < 0) or the double at [base+disp].
+//	src1 is -1 for instructions with only one source.  Without AVX
+//	the two-operand form is used, copying src1 into dst first if
+//	needed.
+//
+
+static void
+jit_sse(Jit *jj, int pfx, int op, int dst, int src1, int base, int src2) {
+   int pp= pfx == PFX_SD ? 3 : 1;
+
+   if (jj->avx) {
+      // Two-byte VEX prefix: R, vvvv (inverted), L=0, pp
+      jit_byte(jj, 0xC5);
+      jit_byte(jj, 0x80 | (~(src1 < 0 ? 0 : src1) & 15) << 3 | pp);
+   } else {
+      if (src1 >= 0 && src1 != dst) {
+	 if (base < 0 && src2 == dst)
+	    error("Internal error: fid_run_new_jit register clash");
+	 jit_sse(jj, PFX_PD, OP_MOVE, dst, -1, -1, src1);
+      }
+      jit_byte(jj, pfx);
+      jit_byte(jj, 0x0F);
+   }
+   jit_byte(jj, op);
+
+   if (base < 0)
+      jit_byte(jj, 0xC0 | dst << 3 | src2);
+   else if (src2 == 0)
+      jit_byte(jj, dst << 3 | base);
+   else if (src2 >= -128 && src2 < 128) {
+      jit_byte(jj, 0x40 | dst << 3 | base);
+      jit_byte(jj, src2);
+   } else {
+      jit_byte(jj, 0x80 | dst << 3 | base);
+      jit_int(jj, src2);
+   }
+}
+
+// Common cases: to/from buf[] and the next coefficient
+#define J_LOAD(xx, ii) jit_sse(jj, PFX_SD, OP_LOAD, xx, -1, R_BUF, 8*(ii))
+#define J_STORE(xx, ii) jit_sse(jj, PFX_SD, OP_STORE, xx, -1, R_BUF, 8*(ii))
+#define J_OP(op, dd, s1, s2) jit_sse(jj, PFX_SD, op, dd, s1, -1, s2)
+#define J_COEF(dd, s1) jit_sse(jj, PFX_SD, OP_MUL, dd, s1, R_COEF, 8*jj->ci++)
+#define J_ZERO(xx) jit_sse(jj, PFX_PD, OP_XOR, xx, xx, -1, xx)
+
+//
+//	tmp= *buf++, as run_cmds() sees it after its memmove: the next
+//	delay value is loaded from one place further on, and stored
+//	back where the memmove would have put it, or if this is an
+//	end-stage then iir is stored there instead.  The final value
+//	is never used, so isn't loaded.
+//
+
+static void
+jit_next(Jit *jj, int end) {
+   int pos= jj->pos++;
+
+   if (pos+1 < jj->siz) J_LOAD(X_TMP, pos+1);
+   if (end) J_STORE(X_IIR, pos);
+   else if (pos+1 < jj->siz) J_STORE(X_TMP, pos);
+}
+
+// The macros of run_cmds()
+static void
+jit_iir(Jit *jj, int end) {
+   J_COEF(X_T, X_TMP);
+   J_OP(OP_SUB, X_IIR, X_IIR, X_T);
+   jit_next(jj, end);
+}
+
+static void
+jit_fir(Jit *jj) {
+   J_COEF(X_T, X_TMP);
+   J_OP(OP_ADD, X_FIR, X_FIR, X_T);
+   jit_next(jj, 0);
+}
+
+static void
+jit_both(Jit *jj) {
+   J_COEF(X_T, X_TMP);
+   J_OP(OP_SUB, X_IIR, X_IIR, X_T);
+   jit_fir(jj);
+}
+
+// iir= fir + coef * iir; fir= 0, for ENDFIR and ENDBOTH
+static void
+jit_endfir(Jit *jj) {
+   J_COEF(X_T, X_IIR);
+   J_OP(OP_ADD, X_IIR, X_FIR, X_T);
+   J_ZERO(X_FIR);
+}
+
+//
+//	ENDCONST for commands 23-25.  For the band-pass numerator
+//	-(tmp) is added to iir at the end, which is done as a
+//	subtraction, giving the same result.
+//
+
+static void
+jit_endconst(Jit *jj, int ccmd) {
+   J_COEF(X_T, X_TMP);
+   J_OP(OP_SUB, X_IIR, X_IIR, X_T);
+   jit_sse(jj, PFX_PD, OP_MOVE, X_FIR, -1, -1, X_TMP);
+   jit_next(jj, 0);
+   J_COEF(X_T, X_TMP);
+   J_OP(OP_SUB, X_IIR, X_IIR, X_T);
+   if (ccmd != 23) {
+      J_OP(OP_ADD, X_T, X_TMP, X_TMP);
+      J_OP(ccmd == 24 ? OP_ADD : OP_SUB, X_FIR, X_FIR, X_T);
+   }
+   jit_next(jj, 1);
+   J_OP(ccmd == 23 ? OP_SUB : OP_ADD, X_IIR, X_IIR, X_FIR);
+   J_ZERO(X_FIR);
+}
+
+//
+//	Output the step function and kernel for the Run, returning
+//	their offsets in the code.
+//
+
+static void
+jit_compile(Jit *jj, Run *rr, int *stepp, int *kernp) {
+   uchar *cmd= (uchar*)rr->cmd;
+   uchar ch;
+   int cnt, fallback, jump;
+   unsigned long long addr= (unsigned long long)(size_t)&filter_step;
+   int a;
+
+   jj->siz= rr->buf_size ? rr->buf_size : 1;
+   jj->pos= 0;
+   jj->ci= 0;
+
+   // Ramping buffers go to filter_step(): mov rax, imm64; jmp rax
+   fallback= jj->len;
+   jit_byte(jj, 0x48); jit_byte(jj, 0xB8);
+   for (a= 0; a<8; a++) jit_byte(jj, addr >> (8*a));
+   jit_byte(jj, 0xFF); jit_byte(jj, 0xE0);
+
+   // Step function: if (rb->ramp_len) goto fallback
+   *stepp= jj->len;
+   jit_byte(jj, 0x8B); jit_byte(jj, 0x87);		// mov eax, [rdi+d32]
+   jit_int(jj, offsetof(RunBuf, ramp_len));
+   jit_byte(jj, 0x85); jit_byte(jj, 0xC0);		// test eax, eax
+   jit_byte(jj, 0x0F); jit_byte(jj, 0x85);		// jnz rel32
+   jump= jj->len + 4;
+   jit_int(jj, fallback - jump);
+
+   // rsi= rb->run->coef; rdi= rb->buf
+   jit_byte(jj, 0x48); jit_byte(jj, 0x8B); jit_byte(jj, 0x87);	// mov rax, [rdi+d32]
+   jit_int(jj, offsetof(RunBuf, run));
+   jit_byte(jj, 0x48); jit_byte(jj, 0x8B); jit_byte(jj, 0xB0);	// mov rsi, [rax+d32]
+   jit_int(jj, offsetof(Run, coef));
+   jit_byte(jj, 0x48); jit_byte(jj, 0x8D); jit_byte(jj, 0xBF);	// lea rdi, [rdi+d32]
+   jit_int(jj, offsetof(RunBuf, buf));
+
+   // Fall through NOPs into the kernel, aligned to 16
+   while (jj->len & 15) jit_byte(jj, 0x90);
+   *kernp= jj->len;
+
+   // Kernel: iir in xmm0 already
+   J_LOAD(X_TMP, 0);
+   J_ZERO(X_FIR);
+
+   while ((ch= *cmd++)) switch (ch) {
+    case 1: case 2: case 3:
+       for (a= 0; a<ch; a++) jit_iir(jj, 0);
+       break;
+    case 4:
+       cnt= *cmd++;
+       for (a= 0; a<4*cnt; a++) jit_iir(jj, 0);
+       break;
+    case 5: case 6: case 7:
+       for (a= 0; a<ch-4; a++) jit_fir(jj);
+       break;
+    case 8:
+       cnt= *cmd++;
+       for (a= 0; a<4*cnt; a++) jit_fir(jj);
+       break;
+    case 9: case 10: case 11:
+       for (a= 0; a<ch-8; a++) jit_both(jj);
+       break;
+    case 12:
+       cnt= *cmd++;
+       for (a= 0; a<4*cnt; a++) jit_both(jj);
+       break;
+    case 13:
+       jit_iir(jj, 1);
+       break;
+    case 14:
+       J_COEF(X_T, X_TMP);
+       J_OP(OP_ADD, X_FIR, X_FIR, X_T);
+       jit_next(jj, 1);
+       jit_endfir(jj);
+       break;
+    case 15:
+       J_COEF(X_T, X_TMP);
+       J_OP(OP_SUB, X_IIR, X_IIR, X_T);
+       J_COEF(X_T, X_TMP);
+       J_OP(OP_ADD, X_FIR, X_FIR, X_T);
+       jit_next(jj, 1);
+       jit_endfir(jj);
+       break;
+    case 16: case 17: case 18:
+    case 19: case 20: case 21:
+       cnt= ch >= 19 ? *cmd++ : 1;
+       while (cnt-- > 0) {
+	  if (ch == 16 || ch == 19) {
+	     jit_iir(jj, 0);
+	     jit_iir(jj, 1);
+	     continue;
+	  }
+	  if (ch == 17 || ch == 20) jit_fir(jj);
+	  else jit_both(jj);
+	  J_COEF(X_T, X_TMP);
+	  if (ch == 18 || ch == 21) {
+	     J_OP(OP_SUB, X_IIR, X_IIR, X_T);
+	     J_COEF(X_T, X_TMP);
+	  }
+	  J_OP(OP_ADD, X_FIR, X_FIR, X_T);
+	  jit_next(jj, 1);
+	  jit_endfir(jj);
+       }
+       break;
+    case 22:
+       J_COEF(X_IIR, X_IIR);
+       break;
+    case 23: case 24: case 25:
+       jit_endconst(jj, ch);
+       break;
+    case 26: case 27: case 28:
+       cnt= *cmd++;
+       while (cnt-- > 0) jit_endconst(jj, ch-3);
+       break;
+    default:
+       error("Internal error: fid_run_new_jit can't compile command %d", ch);
+   }
+
+   if (jj->ci != rr->coef_cnt || jj->pos > jj->siz)
+      error("Internal error: fid_run_new_jit compiled %d coefficients of %d",
+	    jj->ci, rr->coef_cnt);
+
+   jit_byte(jj, 0xC3);		// ret
+}
+
+#undef J_LOAD
+#undef J_STORE
+#undef J_OP
+#undef J_COEF
+#undef J_ZERO
+
+//
+//	Create an instance of a filter, as fid_run_new(), but with the
+//	command list compiled to machine code.
+//
+
+void *
+fid_run_new_jit(FidFilter *filt, double (**funcpp)(void *,double)) {
+   Run *rr= run_new(filt);
+   Jit jj;
+   int step, kern;
+   void *code;
+
+   *funcpp= filter_step;
+
+   // Measure, then compile into a writable page, then make it
+   // executable.  On failure just use the interpreter.
+   memset(&jj, 0, sizeof(jj));
+   jj.avx= __builtin_cpu_supports("avx");
+   jit_compile(&jj, rr, &step, &kern);
+   code= mmap(0, jj.len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+   if (code == MAP_FAILED)
+      return rr;
+   jj.code= code;
+   jj.len= 0;
+   jit_compile(&jj, rr, &step, &kern);
+   if (0 != mprotect(code, jj.len, PROT_READ | PROT_EXEC)) {
+      munmap(code, jj.len);
+      return rr;
+   }
+
+   rr->jit= code;
+   rr->jit_len= jj.len;
+   rr->kern= (RunKern*)(jj.code + kern);
+   *funcpp= (FidFunc*)(jj.code + step);
+   return rr;
+}
+
+static void
+jit_free(Run *rr) {
+   munmap(rr->jit, rr->jit_len);
+}
+
+#else
+
+//
+//	No JIT for this platform: use the command-list code
+//
+
+void *
+fid_run_new_jit(FidFilter *filt, double (**funcpp)(void *,double)) {
+   *funcpp= filter_step;
+   return run_new(filt);
+}
+
+static void
+jit_free(Run *rr) {
+}
+
+#endif
+
+// END //
@@ -0,0 +1,1647 @@
+#include "Scales.hpp"
+Scale bohlenpierce = {
+	.name = "Bohlen Pierce",
+	.description = "The Bohlen Pierce scale is derived from 13 divisions of a 'tritave' - a frequency ratio of 3:1, compared to the octave ratio of 2:1. Here the scale consists of various intervals taken from an justly intonation scale.",
+	.scalename = {
+		"C, E, H, A; C1-",
+		"C, E, H, Bb; C1-",
+		"C, F, G, A; C1-",
+		"C, F, H, J; C1-",
+		"C, F, H, A; C1-",
+		"C, F, H, Bb; C1-",
+		"C, G, H, A; C1-",
+		"C, G, H, Bb; C1-",
+		"C, G, A, Bb; C1-",
+		"C, G, Jb, B; C1-",
+		"C, Gb, J, B; C1-"},
+	.notedesc = {
+		"C",
+		"E",
+		"H",
+		"A",
+		"C",
+		"E",
+		"H",
+		"A",
+		"C",
+		"E",
+		"H",
+		"A",
+		"C",
+		"E",
+		"H",
+		"A",
+		"C",
+		"E",
+		"H",
+		"A",
+		"C",
+		"C",
+		"E",
+		"H",
+		"Bb",
+		"C",
+		"E",
+		"H",
+		"Bb",
+		"C",
+		"E",
+		"H",
+		"Bb",
+		"C",
+		"E",
+		"H",
+		"Bb",
+		"C",
+		"E",
+		"H",
+		"Bb",
+		"C",
+		"C",
+		"F",
+		"G",
+		"A",
+		"C",
+		"F",
+		"G",
+		"A",
+		"C",
+		"F",
+		"G",
+		"A",
+		"C",
+		"F",
+		"G",
+		"A",
+		"C",
+		"F",
+		"G",
+		"A",
+		"C",
+		"C",
+		"F",
+		"H",
+		"J",
+		"C",
+		"F",
+		"H",
+		"J",
+		"C",
+		"F",
+		"H",
+		"J",
+		"C",
+		"F",
+		"H",
+		"J",
+		"C",
+		"F",
+		"H",
+		"J",
+		"C",
+		"C",
+		"F",
+		"H",
+		"A",
+		"C",
+		"F",
+		"H",
+		"A",
+		"C",
+		"F",
+		"H",
+		"A",
+		"C",
+		"F",
+		"H",
+		"A",
+		"C",
+		"F",
+		"H",
+		"A",
+		"C",
+		"C",
+		"F",
+		"H",
+		"Bb",
+		"C",
+		"F",
+		"H",
+		"Bb",
+		"C",
+		"F",
+		"H",
+		"Bb",
+		"C",
+		"F",
+		"H",
+		"Bb",
+		"C",
+		"F",
+		"H",
+		"Bb",
+		"C",
+		"C",
+		"G",
+		"H",
+		"A",
+		"C",
+		"G",
+		"H",
+		"A",
+		"C",
+		"G",
+		"H",
+		"A",
+		"C",
+		"G",
+		"H",
+		"A",
+		"C",
+		"G",
+		"H",
+		"A",
+		"C",
+		"C",
+		"G",
+		"H",
+		"Bb",
+		"C",
+		"G",
+		"H",
+		"Bb",
+		"C",
+		"G",
+		"H",
+		"Bb",
+		"C",
+		"G",
+		"H",
+		"Bb",
+		"C",
+		"G",
+		"H",
+		"Bb",
+		"C",
+		"C",
+		"G",
+		"A",
+		"Bb",
+		"C",
+		"G",
+		"A",
+		"Bb",
+		"C",
+		"G",
+		"A",
+		"Bb",
+		"C",
+		"G",
+		"A",
+		"Bb",
+		"C",
+		"G",
+		"A",
+		"Bb",
+		"C",
+		"C",
+		"G",
+		"Jb",
+		"B",
+		"C",
+		"G",
+		"Jb",
+		"B",
+		"C",
+		"G",
+		"Jb",
+		"B",
+		"C",
+		"G",
+		"Jb",
+		"B",
+		"C",
+		"G",
+		"Jb",
+		"B",
+		"C",
+		"C",
+		"Gb",
+		"J",
+		"B",
+		"C",
+		"Gb",
+		"J",
+		"B",
+		"C",
+		"Gb",
+		"J",
+		"B",
+		"C",
+		"Gb",
+		"J",
+		"B",
+		"C",
+		"Gb",
+		"J",
+		"B",
+		"C"},
+	.c_maxq48000 = {
+		0.004280838301772239,
+		0.005503934959421451,
+		0.007705508943190032,
+		0.009988622704135227,
+		0.01284251490531672,
+		0.01651180487826436,
+		0.02311652682957009,
+		0.02996586811240568,
+		0.03852754471595016,
+		0.04953541463479306,
+		0.06934958048871029,
+		0.08989760433721702,
+		0.1155826341478505,
+		0.1486062439043792,
+		0.2080487414661308,
+		0.2696928130116511,
+		0.3467479024435514,
+		0.4458187317131375,
+		0.6241462243983925,
+		0.8090784390349532,
+		1.040243707330654,
+		0.004280838301772239,
+		0.005503934959421451,
+		0.007705508943190032,
+		0.01078771252046604,
+		0.01284251490531672,
+		0.01651180487826436,
+		0.02311652682957009,
+		0.03236313756139814,
+		0.03852754471595016,
+		0.04953541463479306,
+		0.06934958048871029,
+		0.0970894126841944,
+		0.1155826341478505,
+		0.1486062439043792,
+		0.2080487414661308,
+		0.2912682380525832,
+		0.3467479024435514,
+		0.4458187317131375,
+		0.6241462243983925,
+		0.8738047141577496,
+		1.040243707330654,
+		0.004280838301772239,
+		0.005993173622481135,
+		0.007134730502953733,
+		0.009988622704135227,
+		0.01284251490531672,
+		0.01797952086744341,
+		0.0214041915088612,
+		0.02996586811240568,
+		0.03852754471595016,
+		0.05393856260233022,
+		0.06421257452658359,
+		0.08989760433721702,
+		0.1155826341478505,
+		0.1618156878069907,
+		0.1926377235797508,
+		0.2696928130116511,
+		0.3467479024435514,
+		0.485447063420972,
+		0.5779131707392523,
+		0.8090784390349532,
+		1.040243707330654,
+		0.004280838301772239,
+		0.005993173622481135,
+		0.007705508943190032,
+		0.009173224932369085,
+		0.01284251490531672,
+		0.01797952086744341,
+		0.02311652682957009,
+		0.02751967479710726,
+		0.03852754471595016,
+		0.05393856260233022,
+		0.06934958048871029,
+		0.08255902439132178,
+		0.1155826341478505,
+		0.1618156878069907,
+		0.2080487414661308,
+		0.2476770731739653,
+		0.3467479024435514,
+		0.485447063420972,
+		0.6241462243983925,
+		0.7430312195218959,
+		1.040243707330654,
+		0.004280838301772239,
+		0.005993173622481135,
+		0.007705508943190032,
+		0.009988622704135227,
+		0.01284251490531672,
+		0.01797952086744341,
+		0.02311652682957009,
+		0.02996586811240568,
+		0.03852754471595016,
+		0.05393856260233022,
+		0.06934958048871029,
+		0.08989760433721702,
+		0.1155826341478505,
+		0.1618156878069907,
+		0.2080487414661308,
+		0.2696928130116511,
+		0.3467479024435514,
+		0.485447063420972,
+		0.6241462243983925,
+		0.8090784390349532,
+		1.040243707330654,
+		0.004280838301772239,
+		0.005993173622481135,
+		0.007705508943190032,
+		0.01078771252046604,
+		0.01284251490531672,
+		0.01797952086744341,
+		0.02311652682957009,
+		0.03236313756139814,
+		0.03852754471595016,
+		0.05393856260233022,
+		0.06934958048871029,
+		0.0970894126841944,
+		0.1155826341478505,
+		0.1618156878069907,
+		0.2080487414661308,
+		0.2912682380525832,
+		0.3467479024435514,
+		0.485447063420972,
+		0.6241462243983925,
+		0.8738047141577496,
+		1.040243707330654,
+		0.004280838301772239,
+		0.007134730502953733,
+		0.007705508943190032,
+		0.009988622704135227,
+		0.01284251490531672,
+		0.0214041915088612,
+		0.02311652682957009,
+		0.02996586811240568,
+		0.03852754471595016,
+		0.06421257452658359,
+		0.06934958048871029,
+		0.08989760433721702,
+		0.1155826341478505,
+		0.1926377235797508,
+		0.2080487414661308,
+		0.2696928130116511,
+		0.3467479024435514,
+		0.5779131707392523,
+		0.6241462243983925,
+		0.8090784390349532,
+		1.040243707330654,
+		0.004280838301772239,
+		0.007134730502953733,
+		0.007705508943190032,
+		0.01078771252046604,
+		0.01284251490531672,
+		0.0214041915088612,
+		0.02311652682957009,
+		0.03236313756139814,
+		0.03852754471595016,
+		0.06421257452658359,
+		0.06934958048871029,
+		0.0970894126841944,
+		0.1155826341478505,
+		0.1926377235797508,
+		0.2080487414661308,
+		0.2912682380525832,
+		0.3467479024435514,
+		0.5779131707392523,
+		0.6241462243983925,
+		0.8738047141577496,
+		1.040243707330654,
+		0.004280838301772239,
+		0.007134730502953733,
+		0.009988622704135227,
+		0.01078771252046604,
+		0.01284251490531672,
+		0.0214041915088612,
+		0.02996586811240568,
+		0.03236313756139814,
+		0.03852754471595016,
+		0.06421257452658359,
+		0.08989760433721702,
+		0.0970894126841944,
+		0.1155826341478505,
+		0.1926377235797508,
+		0.2696928130116511,
+		0.2912682380525832,
+		0.3467479024435514,
+		0.5779131707392523,
+		0.8090784390349532,
+		0.8738047141577496,
+		1.040243707330654,
+		0.004280838301772239,
+		0.007134730502953733,
+		0.00839044307147359,
+		0.01189121750492289,
+		0.01284251490531672,
+		0.0214041915088612,
+		0.02517132921442077,
+		0.03567365251476867,
+		0.03852754471595016,
+		0.06421257452658359,
+		0.07551398764326231,
+		0.107020957544306,
+		0.1155826341478505,
+		0.1926377235797508,
+		0.226541962929787,
+		0.321062872632918,
+		0.3467479024435514,
+		0.5779131707392523,
+		0.6796258887893608,
+		0.963188617898754,
+		1.040243707330654,
+		0.004280838301772239,
+		0.006552303523120775,
+		0.009173224932369085,
+		0.01189121750492289,
+		0.01284251490531672,
+		0.01965691056936232,
+		0.02751967479710726,
+		0.03567365251476867,
+		0.03852754471595016,
+		0.05897073170808698,
+		0.08255902439132178,
+		0.107020957544306,
+		0.1155826341478505,
+		0.1769121951242609,
+		0.2476770731739653,
+		0.321062872632918,
+		0.3467479024435514,
+		0.5307365853727827,
+		0.7430312195218959,
+		0.963188617898754,
+		1.040243707330654
+	},
+	.c_maxq96000 = {
+		0.00214041915088612,
+		0.002751967479710726,
+		0.003852754471595016,
+		0.004994311352067613,
+		0.006421257452658361,
+		0.008255902439132178,
+		0.01155826341478505,
+		0.01498293405620284,
+		0.01926377235797508,
+		0.02476770731739653,
+		0.03467479024435514,
+		0.04494880216860851,
+		0.05779131707392524,
+		0.07430312195218959,
+		0.1040243707330654,
+		0.1348464065058256,
+		0.1733739512217757,
+		0.2229093658565688,
+		0.3120731121991963,
+		0.4045392195174766,
+		0.520121853665327,
+		0.00214041915088612,
+		0.002751967479710726,
+		0.003852754471595016,
+		0.005393856260233022,
+		0.006421257452658361,
+		0.008255902439132178,
+		0.01155826341478505,
+		0.01618156878069907,
+		0.01926377235797508,
+		0.02476770731739653,
+		0.03467479024435514,
+		0.0485447063420972,
+		0.05779131707392524,
+		0.07430312195218959,
+		0.1040243707330654,
+		0.1456341190262916,
+		0.1733739512217757,
+		0.2229093658565688,
+		0.3120731121991963,
+		0.4369023570788748,
+		0.520121853665327,
+		0.00214041915088612,
+		0.002996586811240568,
+		0.003567365251476867,
+		0.004994311352067613,
+		0.006421257452658361,
+		0.008989760433721704,
+		0.0107020957544306,
+		0.01498293405620284,
+		0.01926377235797508,
+		0.02696928130116511,
+		0.0321062872632918,
+		0.04494880216860851,
+		0.05779131707392524,
+		0.08090784390349534,
+		0.09631886178987539,
+		0.1348464065058256,
+		0.1733739512217757,
+		0.242723531710486,
+		0.2889565853696262,
+		0.4045392195174766,
+		0.520121853665327,
+		0.00214041915088612,
+		0.002996586811240568,
+		0.003852754471595016,
+		0.004586612466184543,
+		0.006421257452658361,
+		0.008989760433721704,
+		0.01155826341478505,
+		0.01375983739855363,
+		0.01926377235797508,
+		0.02696928130116511,
+		0.03467479024435514,
+		0.04127951219566089,
+		0.05779131707392524,
+		0.08090784390349534,
+		0.1040243707330654,
+		0.1238385365869826,
+		0.1733739512217757,
+		0.242723531710486,
+		0.3120731121991963,
+		0.3715156097609479,
+		0.520121853665327,
+		0.00214041915088612,
+		0.002996586811240568,
+		0.003852754471595016,
+		0.004994311352067613,
+		0.006421257452658361,
+		0.008989760433721704,
+		0.01155826341478505,
+		0.01498293405620284,
+		0.01926377235797508,
+		0.02696928130116511,
+		0.03467479024435514,
+		0.04494880216860851,
+		0.05779131707392524,
+		0.08090784390349534,
+		0.1040243707330654,
+		0.1348464065058256,
+		0.1733739512217757,
+		0.242723531710486,
+		0.3120731121991963,
+		0.4045392195174766,
+		0.520121853665327,
+		0.00214041915088612,
+		0.002996586811240568,
+		0.003852754471595016,
+		0.005393856260233022,
+		0.006421257452658361,
+		0.008989760433721704,
+		0.01155826341478505,
+		0.01618156878069907,
+		0.01926377235797508,
+		0.02696928130116511,
+		0.03467479024435514,
+		0.0485447063420972,
+		0.05779131707392524,
+		0.08090784390349534,
+		0.1040243707330654,
+		0.1456341190262916,
+		0.1733739512217757,
+		0.242723531710486,
+		0.3120731121991963,
+		0.4369023570788748,
+		0.520121853665327,
+		0.00214041915088612,
+		0.003567365251476867,
+		0.003852754471595016,
+		0.004994311352067613,
+		0.006421257452658361,
+		0.0107020957544306,
+		0.01155826341478505,
+		0.01498293405620284,
+		0.01926377235797508,
+		0.0321062872632918,
+		0.03467479024435514,
+		0.04494880216860851,
+		0.05779131707392524,
+		0.09631886178987539,
+		0.1040243707330654,
+		0.1348464065058256,
+		0.1733739512217757,
+		0.2889565853696262,
+		0.3120731121991963,
+		0.4045392195174766,
+		0.520121853665327,
+		0.00214041915088612,
+		0.003567365251476867,
+		0.003852754471595016,
+		0.005393856260233022,
+		0.006421257452658361,
+		0.0107020957544306,
+		0.01155826341478505,
+		0.01618156878069907,
+		0.01926377235797508,
+		0.0321062872632918,
+		0.03467479024435514,
+		0.0485447063420972,
+		0.05779131707392524,
+		0.09631886178987539,
+		0.1040243707330654,
+		0.1456341190262916,
+		0.1733739512217757,
+		0.2889565853696262,
+		0.3120731121991963,
+		0.4369023570788748,
+		0.520121853665327,
+		0.00214041915088612,
+		0.003567365251476867,
+		0.004994311352067613,
+		0.005393856260233022,
+		0.006421257452658361,
+		0.0107020957544306,
+		0.01498293405620284,
+		0.01618156878069907,
+		0.01926377235797508,
+		0.0321062872632918,
+		0.04494880216860851,
+		0.0485447063420972,
+		0.05779131707392524,
+		0.09631886178987539,
+		0.1348464065058256,
+		0.1456341190262916,
+		0.1733739512217757,
+		0.2889565853696262,
+		0.4045392195174766,
+		0.4369023570788748,
+		0.520121853665327,
+		0.00214041915088612,
+		0.003567365251476867,
+		0.004195221535736795,
+		0.005945608752461445,
+		0.006421257452658361,
+		0.0107020957544306,
+		0.01258566460721039,
+		0.01783682625738433,
+		0.01926377235797508,
+		0.0321062872632918,
+		0.03775699382163115,
+		0.05351047877215299,
+		0.05779131707392524,
+		0.09631886178987539,
+		0.1132709814648935,
+		0.160531436316459,
+		0.1733739512217757,
+		0.2889565853696262,
+		0.3398129443946804,
+		0.481594308949377,
+		0.520121853665327,
+		0.00214041915088612,
+		0.003276151761560387,
+		0.004586612466184543,
+		0.005945608752461445,
+		0.006421257452658361,
+		0.009828455284681162,
+		0.01375983739855363,
+		0.01783682625738433,
+		0.01926377235797508,
+		0.02948536585404349,
+		0.04127951219566089,
+		0.05351047877215299,
+		0.05779131707392524,
+		0.08845609756213046,
+		0.1238385365869826,
+		0.160531436316459,
+		0.1733739512217757,
+		0.2653682926863913,
+		0.3715156097609479,
+		0.481594308949377,
+		0.520121853665327
+	},
+	.c_bpre4800022 = {
+		{ 0.00213813037056729, 0.9978618696294329, -1.997843563667202 },
+		{ 0.002748186517267886, 0.9972518134827467, -1.99722156183576 },
+		{ 0.003845345252415304, 0.9961546547476051, -1.996095394234924 },
+		{ 0.004981863345433093, 0.9950181366545799, -1.994918613311871 },
+		{ 0.006400686081937342, 0.9935993139180634, -1.993434913778113 },
+		{ 0.008221922720160708, 0.9917780772798828, -1.99150656411867 },
+		{ 0.0114917066978524, 0.9885082933023419, -1.987977015126093 },
+		{ 0.01487122455580887, 0.9851287754445013, -1.984237568594551 },
+		{ 0.01907942696748694, 0.980920573032614, -1.979450541276753 },
+		{ 0.02446352392291808, 0.9755364760772108, -1.973113224180117 },
+		{ 0.03408052293083973, 0.965919477069212, -1.961193955824454 },
+		{ 0.04395356510094009, 0.956046434899069, -1.948147786861718 },
+		{ 0.05615309090685808, 0.943846909093188, -1.930877105010223 },
+		{ 0.07160988106328864, 0.928390118938355, -1.907136098338473 },
+		{ 0.09879694251940001, 0.9012030574874965, -1.860204915716481 },
+		{ 0.1261498050452322, 0.8738501949551878, -1.806115820130426 },
+		{ 0.1591769341492267, 0.8408230658510152, -1.731262485254997 },
+		{ 0.1998124079535937, 0.800187592048897, -1.624233966742962 },
+		{ 0.2680721816824918, 0.731927818319098, -1.405393705037293 },
+		{ 0.3327156145979807, 0.6672843854031534, -1.150702981609485 },
+		{ 0.4055520265074005, 0.5944479734932402, -0.8068061056672411 },
+		{ 0.00213813037056729, 0.9978618696294329, -1.997843563667202 },
+		{ 0.002748186517267886, 0.9972518134827467, -1.99722156183576 },
+		{ 0.003845345252415304, 0.9961546547476051, -1.996095394234924 },
+		{ 0.005379338591919128, 0.9946206614080949, -1.994504600669607 },
+		{ 0.006400686081937342, 0.9935993139180634, -1.993434913778113 },
+		{ 0.008221922720160708, 0.9917780772798828, -1.99150656411867 },
+		{ 0.0114917066978524, 0.9885082933023419, -1.987977015126093 },
+		{ 0.01605134026837022, 0.9839486597316831, -1.982909784943262 },
+		{ 0.01907942696748694, 0.980920573032614, -1.979450541276753 },
+		{ 0.02446352392291808, 0.9755364760772108, -1.973113224180117 },
+		{ 0.03408052293083973, 0.965919477069212, -1.961193955824454 },
+		{ 0.04738521978786064, 0.9526147802122965, -1.94341899989187 },
+		{ 0.05615309090685808, 0.943846909093188, -1.930877105010223 },
+		{ 0.07160988106328864, 0.928390118938355, -1.907136098338473 },
+		{ 0.09879694251940001, 0.9012030574874965, -1.860204915716481 },
+		{ 0.1355263185150873, 0.8644736814894968, -1.785942567984391 },
+		{ 0.1591769341492267, 0.8408230658510152, -1.731262485254997 },
+		{ 0.1998124079535937, 0.800187592048897, -1.624233966742962 },
+		{ 0.2680721816824918, 0.731927818319098, -1.405393705037293 },
+		{ 0.353965647476904, 0.6460343525239944, -1.056611610501834 },
+		{ 0.4055520265074005, 0.5944479734932402, -0.8068061056672411 },
+		{ 0.00213813037056729, 0.9978618696294329, -1.997843563667202 },
+		{ 0.002992103227616398, 0.9970078967723913, -1.996972032444201 },
+		{ 0.00356100806131926, 0.9964389919386875, -1.996388178459016 },
+		{ 0.004981863345433093, 0.9950181366545799, -1.994918613311871 },
+		{ 0.006400686081937342, 0.9935993139180634, -1.993434913778113 },
+		{ 0.008949445993621973, 0.9910505540070533, -1.990728747995121 },
+		{ 0.010645033480368, 0.9893549665196336, -1.988899282836953 },
+		{ 0.01487122455580887, 0.9851287754445013, -1.984237568594551 },
+		{ 0.01907942696748694, 0.980920573032614, -1.979450541276753 },
+		{ 0.02660884072074166, 0.9733911592793467, -1.97052119781779 },
+		{ 0.03159635648817693, 0.9684036435118276, -1.964346921817052 },
+		{ 0.04395356510094009, 0.956046434899069, -1.948147786861718 },
+		{ 0.05615309090685808, 0.943846909093188, -1.930877105010223 },
+		{ 0.0777212708169847, 0.9222787291832732, -1.897166850488962 },
+		{ 0.09182538606238837, 0.9081746139425293, -1.872878644988852 },
+		{ 0.1261498050452322, 0.8738501949551878, -1.806115820130426 },
+		{ 0.1591769341492267, 0.8408230658510152, -1.731262485254997 },
+		{ 0.2155115074315438, 0.7844884925691782, -1.578320437408007 },
+		{ 0.2509552064603365, 0.7490447935398723, -1.465007896944705 },
+		{ 0.3327156145979807, 0.6672843854031534, -1.150702981609485 },
+		{ 0.4055520265074005, 0.5944479734932402, -0.8068061056672411 },
+		{ 0.00213813037056729, 0.9978618696294329, -1.997843563667202 },
+		{ 0.002992103227616398, 0.9970078967723913, -1.996972032444201 },
+		{ 0.003845345252415304, 0.9961546547476051, -1.996095394234924 },
+		{ 0.004576111558501068, 0.9954238884415031, -1.995339933453512 },
+		{ 0.006400686081937342, 0.9935993139180634, -1.993434913778113 },
+		{ 0.008949445993621973, 0.9910505540070533, -1.990728747995121 },
+		{ 0.0114917066978524, 0.9885082933023419, -1.987977015126093 },
+		{ 0.01366561456754153, 0.9863343854325303, -1.985582273885323 },
+		{ 0.01907942696748694, 0.980920573032614, -1.979450541276753 },
+		{ 0.02660884072074166, 0.9733911592793467, -1.97052119781779 },
+		{ 0.03408052293083973, 0.965919477069212, -1.961193955824454 },
+		{ 0.040439085875119, 0.9595609141250745, -1.952886540525939 },
+		{ 0.05615309090685808, 0.943846909093188, -1.930877105010223 },
+		{ 0.0777212708169847, 0.9222787291832732, -1.897166850488962 },
+		{ 0.09879694251940001, 0.9012030574874965, -1.860204915716481 },
+		{ 0.1164773138082877, 0.8835226861948419, -1.826046274758217 },
+		{ 0.1591769341492267, 0.8408230658510152, -1.731262485254997 },
+		{ 0.2155115074315438, 0.7844884925691782, -1.578320437408007 },
+		{ 0.2680721816824918, 0.731927818319098, -1.405393705037293 },
+		{ 0.310311742518487, 0.689688257481525, -1.244322404749831 },
+		{ 0.4055520265074005, 0.5944479734932402, -0.8068061056672411 },
+		{ 0.00213813037056729, 0.9978618696294329, -1.997843563667202 },
+		{ 0.002992103227616398, 0.9970078967723913, -1.996972032444201 },
+		{ 0.003845345252415304, 0.9961546547476051, -1.996095394234924 },
+		{ 0.004981863345433093, 0.9950181366545799, -1.994918613311871 },
+		{ 0.006400686081937342, 0.9935993139180634, -1.993434913778113 },
+		{ 0.008949445993621973, 0.9910505540070533, -1.990728747995121 },
+		{ 0.0114917066978524, 0.9885082933023419, -1.987977015126093 },
+		{ 0.01487122455580887, 0.9851287754445013, -1.984237568594551 },
+		{ 0.01907942696748694, 0.980920573032614, -1.979450541276753 },
+		{ 0.02660884072074166, 0.9733911592793467, -1.97052119781779 },
+		{ 0.03408052293083973, 0.965919477069212, -1.961193955824454 },
+		{ 0.04395356510094009, 0.956046434899069, -1.948147786861718 },
+		{ 0.05615309090685808, 0.943846909093188, -1.930877105010223 },
+		{ 0.0777212708169847, 0.9222787291832732, -1.897166850488962 },
+		{ 0.09879694251940001, 0.9012030574874965, -1.860204915716481 },
+		{ 0.1261498050452322, 0.8738501949551878, -1.806115820130426 },
+		{ 0.1591769341492267, 0.8408230658510152, -1.731262485254997 },
+		{ 0.2155115074315438, 0.7844884925691782, -1.578320437408007 },
+		{ 0.2680721816824918, 0.731927818319098, -1.405393705037293 },
+		{ 0.3327156145979807, 0.6672843854031534, -1.150702981609485 },
+		{ 0.4055520265074005, 0.5944479734932402, -0.8068061056672411 },
+		{ 0.00213813037056729, 0.9978618696294329, -1.997843563667202 },
+		{ 0.002992103227616398, 0.9970078967723913, -1.996972032444201 },
+		{ 0.003845345252415304, 0.9961546547476051, -1.996095394234924 },
+		{ 0.005379338591919128, 0.9946206614080949, -1.994504600669607 },
+		{ 0.006400686081937342, 0.9935993139180634, -1.993434913778113 },
+		{ 0.008949445993621973, 0.9910505540070533, -1.990728747995121 },
+		{ 0.0114917066978524, 0.9885082933023419, -1.987977015126093 },
+		{ 0.01605134026837022, 0.9839486597316831, -1.982909784943262 },
+		{ 0.01907942696748694, 0.980920573032614, -1.979450541276753 },
+		{ 0.02660884072074166, 0.9733911592793467, -1.97052119781779 },
+		{ 0.03408052293083973, 0.965919477069212, -1.961193955824454 },
+		{ 0.04738521978786064, 0.9526147802122965, -1.94341899989187 },
+		{ 0.05615309090685808, 0.943846909093188, -1.930877105010223 },
+		{ 0.0777212708169847, 0.9222787291832732, -1.897166850488962 },
+		{ 0.09879694251940001, 0.9012030574874965, -1.860204915716481 },
+		{ 0.1355263185150873, 0.8644736814894968, -1.785942567984391 },
+		{ 0.1591769341492267, 0.8408230658510152, -1.731262485254997 },
+		{ 0.2155115074315438, 0.7844884925691782, -1.578320437408007 },
+		{ 0.2680721816824918, 0.731927818319098, -1.405393705037293 },
+		{ 0.353965647476904, 0.6460343525239944, -1.056611610501834 },
+		{ 0.4055520265074005, 0.5944479734932402, -0.8068061056672411 },
+		{ 0.00213813037056729, 0.9978618696294329, -1.997843563667202 },
+		{ 0.00356100806131926, 0.9964389919386875, -1.996388178459016 },
+		{ 0.003845345252415304, 0.9961546547476051, -1.996095394234924 },
+		{ 0.004981863345433093, 0.9950181366545799, -1.994918613311871 },
+		{ 0.006400686081937342, 0.9935993139180634, -1.993434913778113 },
+		{ 0.010645033480368, 0.9893549665196336, -1.988899282836953 },
+		{ 0.0114917066978524, 0.9885082933023419, -1.987977015126093 },
+		{ 0.01487122455580887, 0.9851287754445013, -1.984237568594551 },
+		{ 0.01907942696748694, 0.980920573032614, -1.979450541276753 },
+		{ 0.03159635648817693, 0.9684036435118276, -1.964346921817052 },
+		{ 0.03408052293083973, 0.965919477069212, -1.961193955824454 },
+		{ 0.04395356510094009, 0.956046434899069, -1.948147786861718 },
+		{ 0.05615309090685808, 0.943846909093188, -1.930877105010223 },
+		{ 0.09182538606238837, 0.9081746139425293, -1.872878644988852 },
+		{ 0.09879694251940001, 0.9012030574874965, -1.860204915716481 },
+		{ 0.1261498050452322, 0.8738501949551878, -1.806115820130426 },
+		{ 0.1591769341492267, 0.8408230658510152, -1.731262485254997 },
+		{ 0.2509552064603365, 0.7490447935398723, -1.465007896944705 },
+		{ 0.2680721816824918, 0.731927818319098, -1.405393705037293 },
+		{ 0.3327156145979807, 0.6672843854031534, -1.150702981609485 },
+		{ 0.4055520265074005, 0.5944479734932402, -0.8068061056672411 },
+		{ 0.00213813037056729, 0.9978618696294329, -1.997843563667202 },
+		{ 0.00356100806131926, 0.9964389919386875, -1.996388178459016 },
+		{ 0.003845345252415304, 0.9961546547476051, -1.996095394234924 },
+		{ 0.005379338591919128, 0.9946206614080949, -1.994504600669607 },
+		{ 0.006400686081937342, 0.9935993139180634, -1.993434913778113 },
+		{ 0.010645033480368, 0.9893549665196336, -1.988899282836953 },
+		{ 0.0114917066978524, 0.9885082933023419, -1.987977015126093 },
+		{ 0.01605134026837022, 0.9839486597316831, -1.982909784943262 },
+		{ 0.01907942696748694, 0.980920573032614, -1.979450541276753 },
+		{ 0.03159635648817693, 0.9684036435118276, -1.964346921817052 },
+		{ 0.03408052293083973, 0.965919477069212, -1.961193955824454 },
+		{ 0.04738521978786064, 0.9526147802122965, -1.94341899989187 },
+		{ 0.05615309090685808, 0.943846909093188, -1.930877105010223 },
+		{ 0.09182538606238837, 0.9081746139425293, -1.872878644988852 },
+		{ 0.09879694251940001, 0.9012030574874965, -1.860204915716481 },
+		{ 0.1355263185150873, 0.8644736814894968, -1.785942567984391 },
+		{ 0.1591769341492267, 0.8408230658510152, -1.731262485254997 },
+		{ 0.2509552064603365, 0.7490447935398723, -1.465007896944705 },
+		{ 0.2680721816824918, 0.731927818319098, -1.405393705037293 },
+		{ 0.353965647476904, 0.6460343525239944, -1.056611610501834 },
+		{ 0.4055520265074005, 0.5944479734932402, -0.8068061056672411 },
+		{ 0.00213813037056729, 0.9978618696294329, -1.997843563667202 },
+		{ 0.00356100806131926, 0.9964389919386875, -1.996388178459016 },
+		{ 0.004981863345433093, 0.9950181366545799, -1.994918613311871 },
+		{ 0.005379338591919128, 0.9946206614080949, -1.994504600669607 },
+		{ 0.006400686081937342, 0.9935993139180634, -1.993434913778113 },
+		{ 0.010645033480368, 0.9893549665196336, -1.988899282836953 },
+		{ 0.01487122455580887, 0.9851287754445013, -1.984237568594551 },
+		{ 0.01605134026837022, 0.9839486597316831, -1.982909784943262 },
+		{ 0.01907942696748694, 0.980920573032614, -1.979450541276753 },
+		{ 0.03159635648817693, 0.9684036435118276, -1.964346921817052 },
+		{ 0.04395356510094009, 0.956046434899069, -1.948147786861718 },
+		{ 0.04738521978786064, 0.9526147802122965, -1.94341899989187 },
+		{ 0.05615309090685808, 0.943846909093188, -1.930877105010223 },
+		{ 0.09182538606238837, 0.9081746139425293, -1.872878644988852 },
+		{ 0.1261498050452322, 0.8738501949551878, -1.806115820130426 },
+		{ 0.1355263185150873, 0.8644736814894968, -1.785942567984391 },
+		{ 0.1591769341492267, 0.8408230658510152, -1.731262485254997 },
+		{ 0.2509552064603365, 0.7490447935398723, -1.465007896944705 },
+		{ 0.3327156145979807, 0.6672843854031534, -1.150702981609485 },
+		{ 0.353965647476904, 0.6460343525239944, -1.056611610501834 },
+		{ 0.4055520265074005, 0.5944479734932402, -0.8068061056672411 },
+		{ 0.00213813037056729, 0.9978618696294329, -1.997843563667202 },
+		{ 0.00356100806131926, 0.9964389919386875, -1.996388178459016 },
+		{ 0.004186436265890606, 0.9958135637341204, -1.995743311892902 },
+		{ 0.005927967936610307, 0.99407203206339, -1.993931051812916 },
+		{ 0.006400686081937342, 0.9935993139180634, -1.993434913778113 },
+		{ 0.010645033480368, 0.9893549665196336, -1.988899282836953 },
+		{ 0.01250680988758247, 0.9874931901125362, -1.986863588301248 },
+		{ 0.01767871542918787, 0.9823212845710725, -1.981060054480943 },
+		{ 0.01907942696748694, 0.980920573032614, -1.979450541276753 },
+		{ 0.03159635648817693, 0.9684036435118276, -1.964346921817052 },
+		{ 0.03705306207597796, 0.9629469379241449, -1.957352886825251 },
+		{ 0.05210399856180996, 0.9478960014381975, -1.936751542323232 },
+		{ 0.05615309090685808, 0.943846909093188, -1.930877105010223 },
+		{ 0.09182538606238837, 0.9081746139425293, -1.872878644988852 },
+		{ 0.1070911523598911, 0.8929088476428892, -1.844543168082686 },
+		{ 0.1483089690117504, 0.8516910309882705, -1.757070590226838 },
+		{ 0.1591769341492267, 0.8408230658510152, -1.731262485254997 },
+		{ 0.2509552064603365, 0.7490447935398723, -1.465007896944705 },
+		{ 0.2880965547495923, 0.7119034452504451, -1.331531936150793 },
+		{ 0.3822023935535329, 0.6177976064465229, -0.9236085502484143 },
+		{ 0.4055520265074005, 0.5944479734932402, -0.8068061056672411 },
+		{ 0.00213813037056729, 0.9978618696294329, -1.997843563667202 },
+		{ 0.003270790267049781, 0.996729209732952, -1.996686347436827 },
+		{ 0.004576111558501068, 0.9954238884415031, -1.995339933453512 },
+		{ 0.005927967936610307, 0.99407203206339, -1.993931051812916 },
+		{ 0.006400686081937342, 0.9935993139180634, -1.993434913778113 },
+		{ 0.009780331028531207, 0.9902196689717119, -1.989835175394499 },
+		{ 0.01366561456754153, 0.9863343854325303, -1.985582273885323 },
+		{ 0.01767871542918787, 0.9823212845710725, -1.981060054480943 },
+		{ 0.01907942696748694, 0.980920573032614, -1.979450541276753 },
+		{ 0.02905490044798031, 0.970945099552068, -1.96751906839557 },
+		{ 0.040439085875119, 0.9595609141250745, -1.952886540525939 },
+		{ 0.05210399856180996, 0.9478960014381975, -1.936751542323232 },
+		{ 0.05615309090685808, 0.943846909093188, -1.930877105010223 },
+		{ 0.08465672730903114, 0.9153432726910237, -1.88544821416823 },
+		{ 0.1164773138082877, 0.8835226861948419, -1.826046274758217 },
+		{ 0.1483089690117504, 0.8516910309882705, -1.757070590226838 },
+		{ 0.1591769341492267, 0.8408230658510152, -1.731262485254997 },
+		{ 0.2330766120632692, 0.7669233879368824, -1.52385549748784 },
+		{ 0.310311742518487, 0.689688257481525, -1.244322404749831 },
+		{ 0.3822023935535329, 0.6177976064465229, -0.9236085502484143 },
+		{ 0.4055520265074005, 0.5944479734932402, -0.8068061056672411 }
+	},
+	.c_bpre9600022 = {
+		{ 0.001069637247203921, 0.9989303627527961, -1.998925783809403 },
+		{ 0.001375038624242553, 0.9986249613757645, -1.998617393250046 },
+		{ 0.001924524523528158, 0.9980754754764819, -1.998060646037268 },
+		{ 0.002494041794954015, 0.9975059582050525, -1.997481046187205 },
+		{ 0.003205480593886903, 0.9967945194061132, -1.996753353074436 },
+		{ 0.00411944627890273, 0.9958805537211192, -1.995812534462474 },
+		{ 0.005762456300231793, 0.9942375436998655, -1.994104337029959 },
+		{ 0.007463463924782311, 0.9925365360753734, -1.99231289039875 },
+		{ 0.009585655883097306, 0.9904143441169532, -1.9900450405969 },
+		{ 0.01230749923010783, 0.987692500769957, -1.987082866571412 },
+		{ 0.01718797470260833, 0.9828120252974176, -1.981620135515566 },
+		{ 0.02222372962979911, 0.9777762703702053, -1.975778662905154 },
+		{ 0.0284821622362549, 0.9715178377637685, -1.968226482625675 },
+		{ 0.03646996988327159, 0.9635300301175647, -1.958112225661992 },
+		{ 0.05068284673625138, 0.9493171532672823, -1.938779749978804 },
+		{ 0.06520045199263018, 0.9347995480075864, -1.917235444262919 },
+		{ 0.08303595171305381, 0.9169640482870719, -1.888225560245654 },
+		{ 0.1054679480049026, 0.894532051996404, -1.847658433198611 },
+		{ 0.1444721989802731, 0.8555278010205735, -1.765903992144223 },
+		{ 0.1831252327301608, 0.8168747672704507, -1.670223827743031 },
+		{ 0.2289954776444562, 0.7710045223558938, -1.536804252994784 },
+		{ 0.001069637247203921, 0.9989303627527961, -1.998925783809403 },
+		{ 0.001375038624242553, 0.9986249613757645, -1.998617393250046 },
+		{ 0.001924524523528158, 0.9980754754764819, -1.998060646037268 },
+		{ 0.002693296218219336, 0.9973067037817878, -1.997277649312739 },
+		{ 0.003205480593886903, 0.9967945194061132, -1.996753353074436 },
+		{ 0.00411944627890273, 0.9958805537211192, -1.995812534462474 },
+		{ 0.005762456300231793, 0.9942375436998655, -1.994104337029959 },
+		{ 0.00805813691949177, 0.9919418630805351, -1.991681080922646 },
+		{ 0.009585655883097306, 0.9904143441169532, -1.9900450405969 },
+		{ 0.01230749923010783, 0.987692500769957, -1.987082866571412 },
+		{ 0.01718797470260833, 0.9828120252974176, -1.981620135515566 },
+		{ 0.02398013329023842, 0.9760198667098412, -1.973691994054368 },
+		{ 0.0284821622362549, 0.9715178377637685, -1.968226482625675 },
+		{ 0.03646996988327159, 0.9635300301175647, -1.958112225661992 },
+		{ 0.05068284673625138, 0.9493171532672823, -1.938779749978804 },
+		{ 0.07022923175382008, 0.9297707682485489, -1.909342288530238 },
+		{ 0.08303595171305381, 0.9169640482870719, -1.888225560245654 },
+		{ 0.1054679480049026, 0.894532051996404, -1.847658433198611 },
+		{ 0.1444721989802731, 0.8555278010205735, -1.765903992144223 },
+		{ 0.1962373780006856, 0.8037626219998008, -1.634329113474992 },
+		{ 0.2289954776444562, 0.7710045223558938, -1.536804252994784 },
+		{ 0.001069637247203921, 0.9989303627527961, -1.998925783809403 },
+		{ 0.001497172376370285, 0.9985028276236334, -1.998493854809566 },
+		{ 0.001782091956530137, 0.998217908043473, -1.998205193313834 },
+		{ 0.002494041794954015, 0.9975059582050525, -1.997481046187205 },
+		{ 0.003205480593886903, 0.9967945194061132, -1.996753353074436 },
+		{ 0.004484779620934166, 0.9955152203794041, -1.995434586845518 },
+		{ 0.005336757229044919, 0.994663242770956, -1.994549014599737 },
+		{ 0.007463463924782311, 0.9925365360753734, -1.99231289039875 },
+		{ 0.009585655883097306, 0.9904143441169532, -1.9900450405969 },
+		{ 0.0133941216071846, 0.9866058783928602, -1.985883452033073 },
+		{ 0.01592498075003302, 0.9840750192499694, -1.983052500980955 },
+		{ 0.02222372962979911, 0.9777762703702053, -1.975778662905154 },
+		{ 0.0284821622362549, 0.9715178377637685, -1.968226482625675 },
+		{ 0.03964656027948734, 0.9603534397206444, -1.953940632910485 },
+		{ 0.04701804112683493, 0.9529819588756806, -1.943929784902842 },
+		{ 0.06520045199263018, 0.9347995480075864, -1.917235444262919 },
+		{ 0.08303595171305381, 0.9169640482870719, -1.888225560245654 },
+		{ 0.114286450048039, 0.8857135499523409, -1.830437666508658 },
+		{ 0.1345262606296594, 0.8654737393704512, -1.788134457020435 },
+		{ 0.1831252327301608, 0.8168747672704507, -1.670223827743031 },
+		{ 0.2289954776444562, 0.7710045223558938, -1.536804252994784 },
+		{ 0.001069637247203921, 0.9989303627527961, -1.998925783809403 },
+		{ 0.001497172376370285, 0.9985028276236334, -1.998493854809566 },
+		{ 0.001924524523528158, 0.9980754754764819, -1.998060646037268 },
+		{ 0.002290679385273405, 0.9977093206147285, -1.997688307718037 },
+		{ 0.003205480593886903, 0.9967945194061132, -1.996753353074436 },
+		{ 0.004484779620934166, 0.9955152203794041, -1.995434586845518 },
+		{ 0.005762456300231793, 0.9942375436998655, -1.994104337029959 },
+		{ 0.006856311789448063, 0.9931436882105881, -1.992955006819352 },
+		{ 0.009585655883097306, 0.9904143441169532, -1.9900450405969 },
+		{ 0.0133941216071846, 0.9866058783928602, -1.985883452033073 },
+		{ 0.01718797470260833, 0.9828120252974176, -1.981620135515566 },
+		{ 0.02042819858629896, 0.9795718014137987, -1.977885450183161 },
+		{ 0.0284821622362549, 0.9715178377637685, -1.968226482625675 },
+		{ 0.03964656027948734, 0.9603534397206444, -1.953940632910485 },
+		{ 0.05068284673625138, 0.9493171532672823, -1.938779749978804 },
+		{ 0.06004112526567734, 0.9399588747359331, -1.92510234201768 },
+		{ 0.08303595171305381, 0.9169640482870719, -1.888225560245654 },
+		{ 0.114286450048039, 0.8857135499523409, -1.830437666508658 },
+		{ 0.1444721989802731, 0.8555278010205735, -1.765903992144223 },
+		{ 0.1695252818528946, 0.8304747181471117, -1.705596468027286 },
+		{ 0.2289954776444562, 0.7710045223558938, -1.536804252994784 },
+		{ 0.001069637247203921, 0.9989303627527961, -1.998925783809403 },
+		{ 0.001497172376370285, 0.9985028276236334, -1.998493854809566 },
+		{ 0.001924524523528158, 0.9980754754764819, -1.998060646037268 },
+		{ 0.002494041794954015, 0.9975059582050525, -1.997481046187205 },
+		{ 0.003205480593886903, 0.9967945194061132, -1.996753353074436 },
+		{ 0.004484779620934166, 0.9955152203794041, -1.995434586845518 },
+		{ 0.005762456300231793, 0.9942375436998655, -1.994104337029959 },
+		{ 0.007463463924782311, 0.9925365360753734, -1.99231289039875 },
+		{ 0.009585655883097306, 0.9904143441169532, -1.9900450405969 },
+		{ 0.0133941216071846, 0.9866058783928602, -1.985883452033073 },
+		{ 0.01718797470260833, 0.9828120252974176, -1.981620135515566 },
+		{ 0.02222372962979911, 0.9777762703702053, -1.975778662905154 },
+		{ 0.0284821622362549, 0.9715178377637685, -1.968226482625675 },
+		{ 0.03964656027948734, 0.9603534397206444, -1.953940632910485 },
+		{ 0.05068284673625138, 0.9493171532672823, -1.938779749978804 },
+		{ 0.06520045199263018, 0.9347995480075864, -1.917235444262919 },
+		{ 0.08303595171305381, 0.9169640482870719, -1.888225560245654 },
+		{ 0.114286450048039, 0.8857135499523409, -1.830437666508658 },
+		{ 0.1444721989802731, 0.8555278010205735, -1.765903992144223 },
+		{ 0.1831252327301608, 0.8168747672704507, -1.670223827743031 },
+		{ 0.2289954776444562, 0.7710045223558938, -1.536804252994784 },
+		{ 0.001069637247203921, 0.9989303627527961, -1.998925783809403 },
+		{ 0.001497172376370285, 0.9985028276236334, -1.998493854809566 },
+		{ 0.001924524523528158, 0.9980754754764819, -1.998060646037268 },
+		{ 0.002693296218219336, 0.9973067037817878, -1.997277649312739 },
+		{ 0.003205480593886903, 0.9967945194061132, -1.996753353074436 },
+		{ 0.004484779620934166, 0.9955152203794041, -1.995434586845518 },
+		{ 0.005762456300231793, 0.9942375436998655, -1.994104337029959 },
+		{ 0.00805813691949177, 0.9919418630805351, -1.991681080922646 },
+		{ 0.009585655883097306, 0.9904143441169532, -1.9900450405969 },
+		{ 0.0133941216071846, 0.9866058783928602, -1.985883452033073 },
+		{ 0.01718797470260833, 0.9828120252974176, -1.981620135515566 },
+		{ 0.02398013329023842, 0.9760198667098412, -1.973691994054368 },
+		{ 0.0284821622362549, 0.9715178377637685, -1.968226482625675 },
+		{ 0.03964656027948734, 0.9603534397206444, -1.953940632910485 },
+		{ 0.05068284673625138, 0.9493171532672823, -1.938779749978804 },
+		{ 0.07022923175382008, 0.9297707682485489, -1.909342288530238 },
+		{ 0.08303595171305381, 0.9169640482870719, -1.888225560245654 },
+		{ 0.114286450048039, 0.8857135499523409, -1.830437666508658 },
+		{ 0.1444721989802731, 0.8555278010205735, -1.765903992144223 },
+		{ 0.1962373780006856, 0.8037626219998008, -1.634329113474992 },
+		{ 0.2289954776444562, 0.7710045223558938, -1.536804252994784 },
+		{ 0.001069637247203921, 0.9989303627527961, -1.998925783809403 },
+		{ 0.001782091956530137, 0.998217908043473, -1.998205193313834 },
+		{ 0.001924524523528158, 0.9980754754764819, -1.998060646037268 },
+		{ 0.002494041794954015, 0.9975059582050525, -1.997481046187205 },
+		{ 0.003205480593886903, 0.9967945194061132, -1.996753353074436 },
+		{ 0.005336757229044919, 0.994663242770956, -1.994549014599737 },
+		{ 0.005762456300231793, 0.9942375436998655, -1.994104337029959 },
+		{ 0.007463463924782311, 0.9925365360753734, -1.99231289039875 },
+		{ 0.009585655883097306, 0.9904143441169532, -1.9900450405969 },
+		{ 0.01592498075003302, 0.9840750192499694, -1.983052500980955 },
+		{ 0.01718797470260833, 0.9828120252974176, -1.981620135515566 },
+		{ 0.02222372962979911, 0.9777762703702053, -1.975778662905154 },
+		{ 0.0284821622362549, 0.9715178377637685, -1.968226482625675 },
+		{ 0.04701804112683493, 0.9529819588756806, -1.943929784902842 },
+		{ 0.05068284673625138, 0.9493171532672823, -1.938779749978804 },
+		{ 0.06520045199263018, 0.9347995480075864, -1.917235444262919 },
+		{ 0.08303595171305381, 0.9169640482870719, -1.888225560245654 },
+		{ 0.1345262606296594, 0.8654737393704512, -1.788134457020435 },
+		{ 0.1444721989802731, 0.8555278010205735, -1.765903992144223 },
+		{ 0.1831252327301608, 0.8168747672704507, -1.670223827743031 },
+		{ 0.2289954776444562, 0.7710045223558938, -1.536804252994784 },
+		{ 0.001069637247203921, 0.9989303627527961, -1.998925783809403 },
+		{ 0.001782091956530137, 0.998217908043473, -1.998205193313834 },
+		{ 0.001924524523528158, 0.9980754754764819, -1.998060646037268 },
+		{ 0.002693296218219336, 0.9973067037817878, -1.997277649312739 },
+		{ 0.003205480593886903, 0.9967945194061132, -1.996753353074436 },
+		{ 0.005336757229044919, 0.994663242770956, -1.994549014599737 },
+		{ 0.005762456300231793, 0.9942375436998655, -1.994104337029959 },
+		{ 0.00805813691949177, 0.9919418630805351, -1.991681080922646 },
+		{ 0.009585655883097306, 0.9904143441169532, -1.9900450405969 },
+		{ 0.01592498075003302, 0.9840750192499694, -1.983052500980955 },
+		{ 0.01718797470260833, 0.9828120252974176, -1.981620135515566 },
+		{ 0.02398013329023842, 0.9760198667098412, -1.973691994054368 },
+		{ 0.0284821622362549, 0.9715178377637685, -1.968226482625675 },
+		{ 0.04701804112683493, 0.9529819588756806, -1.943929784902842 },
+		{ 0.05068284673625138, 0.9493171532672823, -1.938779749978804 },
+		{ 0.07022923175382008, 0.9297707682485489, -1.909342288530238 },
+		{ 0.08303595171305381, 0.9169640482870719, -1.888225560245654 },
+		{ 0.1345262606296594, 0.8654737393704512, -1.788134457020435 },
+		{ 0.1444721989802731, 0.8555278010205735, -1.765903992144223 },
+		{ 0.1962373780006856, 0.8037626219998008, -1.634329113474992 },
+		{ 0.2289954776444562, 0.7710045223558938, -1.536804252994784 },
+		{ 0.001069637247203921, 0.9989303627527961, -1.998925783809403 },
+		{ 0.001782091956530137, 0.998217908043473, -1.998205193313834 },
+		{ 0.002494041794954015, 0.9975059582050525, -1.997481046187205 },
+		{ 0.002693296218219336, 0.9973067037817878, -1.997277649312739 },
+		{ 0.003205480593886903, 0.9967945194061132, -1.996753353074436 },
+		{ 0.005336757229044919, 0.994663242770956, -1.994549014599737 },
+		{ 0.007463463924782311, 0.9925365360753734, -1.99231289039875 },
+		{ 0.00805813691949177, 0.9919418630805351, -1.991681080922646 },
+		{ 0.009585655883097306, 0.9904143441169532, -1.9900450405969 },
+		{ 0.01592498075003302, 0.9840750192499694, -1.983052500980955 },
+		{ 0.02222372962979911, 0.9777762703702053, -1.975778662905154 },
+		{ 0.02398013329023842, 0.9760198667098412, -1.973691994054368 },
+		{ 0.0284821622362549, 0.9715178377637685, -1.968226482625675 },
+		{ 0.04701804112683493, 0.9529819588756806, -1.943929784902842 },
+		{ 0.06520045199263018, 0.9347995480075864, -1.917235444262919 },
+		{ 0.07022923175382008, 0.9297707682485489, -1.909342288530238 },
+		{ 0.08303595171305381, 0.9169640482870719, -1.888225560245654 },
+		{ 0.1345262606296594, 0.8654737393704512, -1.788134457020435 },
+		{ 0.1831252327301608, 0.8168747672704507, -1.670223827743031 },
+		{ 0.1962373780006856, 0.8037626219998008, -1.634329113474992 },
+		{ 0.2289954776444562, 0.7710045223558938, -1.536804252994784 },
+		{ 0.001069637247203921, 0.9989303627527961, -1.998925783809403 },
+		{ 0.001782091956530137, 0.998217908043473, -1.998205193313834 },
+		{ 0.00209541351183734, 0.9979045864881677, -1.997887005049713 },
+		{ 0.002968389636823071, 0.997031610363177, -1.996996312678305 },
+		{ 0.003205480593886903, 0.9967945194061132, -1.996753353074436 },
+		{ 0.005336757229044919, 0.994663242770956, -1.994549014599737 },
+		{ 0.00627308071461736, 0.9937269192854421, -1.993569018896777 },
+		{ 0.008878774028719344, 0.9911212259714108, -1.990804493540739 },
+		{ 0.009585655883097306, 0.9904143441169532, -1.9900450405969 },
+		{ 0.01592498075003302, 0.9840750192499694, -1.983052500980955 },
+		{ 0.01870140226125688, 0.981298597738805, -1.9798865070137 },
+		{ 0.02640049227714218, 0.9735995077228612, -1.970774606999846 },
+		{ 0.0284821622362549, 0.9715178377637685, -1.968226482625675 },
+		{ 0.04701804112683493, 0.9529819588756806, -1.943929784902842 },
+		{ 0.05506145827350648, 0.9449385417279206, -1.932474833940748 },
+		{ 0.07712891962731304, 0.9228710803726979, -1.898147713707466 },
+		{ 0.08303595171305381, 0.9169640482870719, -1.888225560245654 },
+		{ 0.1345262606296594, 0.8654737393704512, -1.788134457020435 },
+		{ 0.1562562917269186, 0.8437437082731019, -1.738312940086215 },
+		{ 0.2139989780881486, 0.7860010219118818, -1.582856885595029 },
+		{ 0.2289954776444562, 0.7710045223558938, -1.536804252994784 },
+		{ 0.001069637247203921, 0.9989303627527961, -1.998925783809403 },
+		{ 0.001636734583572939, 0.9983632654164276, -1.998352541044356 },
+		{ 0.002290679385273405, 0.9977093206147285, -1.997688307718037 },
+		{ 0.002968389636823071, 0.997031610363177, -1.996996312678305 },
+		{ 0.003205480593886903, 0.9967945194061132, -1.996753353074436 },
+		{ 0.004902181204546266, 0.9950978187955756, -1.995001457469892 },
+		{ 0.006856311789448063, 0.9931436882105881, -1.992955006819352 },
+		{ 0.008878774028719344, 0.9911212259714108, -1.990804493540739 },
+		{ 0.009585655883097306, 0.9904143441169532, -1.9900450405969 },
+		{ 0.01463453503178842, 0.9853654649682361, -1.98450250301531 },
+		{ 0.02042819858629896, 0.9795718014137987, -1.977885450183161 },
+		{ 0.02640049227714218, 0.9735995077228612, -1.970774606999846 },
+		{ 0.0284821622362549, 0.9715178377637685, -1.968226482625675 },
+		{ 0.04326426183037842, 0.9567357381696494, -1.949085503047812 },
+		{ 0.06004112526567734, 0.9399588747359331, -1.92510234201768 },
+		{ 0.07712891962731304, 0.9228710803726979, -1.898147713707466 },
+		{ 0.08303595171305381, 0.9169640482870719, -1.888225560245654 },
+		{ 0.1242583783234111, 0.8757416216766691, -1.810083080211179 },
+		{ 0.1695252818528946, 0.8304747181471117, -1.705596468027286 },
+		{ 0.2139989780881486, 0.7860010219118818, -1.582856885595029 },
+		{ 0.2289954776444562, 0.7710045223558938, -1.536804252994784 }
+	},
+	.c_bpre4800080040 = {
+		{ 0.0001070206878125991, 0.9999946489657299, -1.999976323461319 },
+		{ 0.0001375981285725969, 0.9999931200993797, -1.999962826930819 },
+		{ 0.0001926371149365062, 0.9999903681523851, -1.999930993767595 },
+		{ 0.0002497142545187204, 0.9999875142924568, -1.999887743047706 },
+		{ 0.0003210603454233985, 0.9999839469830901, -1.999819020340863 },
+		{ 0.0004127915457362342, 0.9999793604401385, -1.99970672930481 },
+		{ 0.0005779055430794499, 0.99997110480092, -1.999436764056811 },
+		{ 0.000749133962907502, 0.9999625434268561, -1.999064677081657 },
+		{ 0.0009631670203265879, 0.9999518416896416, -1.998467686919606 },
+		{ 0.001238349077864998, 0.9999380825983807, -1.997484898963806 },
+		{ 0.001733665540765597, 0.9999133167439224, -1.995106083804795 },
+		{ 0.002247313554449345, 0.9998876343258949, -1.99181195255472 },
+		{ 0.002889356577960396, 0.9998555321900823, -1.986512025392025 },
+		{ 0.003714830976628071, 0.9998142591326046, -1.977773027411333 },
+		{ 0.005200615607480529, 0.9997399721187489, -1.956616949272647 },
+		{ 0.006741183218765366, 0.9996629410179696, -1.927380791926447 },
+		{ 0.00866682503628508, 0.9995666588529682, -1.880558108737762 },
+		{ 0.01114237152697835, 0.9994428825257495, -1.804013680965982 },
+		{ 0.01559759822103543, 0.9992201208171313, -1.622291265876923 },
+		{ 0.02021673389308701, 0.9989891638418877, -1.379634339036823 },
+		{ 0.02598920966063914, 0.9987005398311792, -1.011361816575309 },
+		{ 0.0001070206878125991, 0.9999946489657299, -1.999976323461319 },
+		{ 0.0001375981285725969, 0.9999931200993797, -1.999962826930819 },
+		{ 0.0001926371149365062, 0.9999903681523851, -1.999930993767595 },
+		{ 0.0002696912601901127, 0.9999865154425878, -1.999870142481835 },
+		{ 0.0003210603454233985, 0.9999839469830901, -1.999819020340863 },
+		{ 0.0004127915457362342, 0.9999793604401385, -1.99970672930481 },
+		{ 0.0005779055430794499, 0.99997110480092, -1.999436764056811 },
+		{ 0.0008090619825076944, 0.9999595469223466, -1.998912288193666 },
+		{ 0.0009631670203265879, 0.9999518416896416, -1.998467686919606 },
+		{ 0.001238349077864998, 0.9999380825983807, -1.997484898963806 },
+		{ 0.001733665540765597, 0.9999133167439224, -1.995106083804795 },
+		{ 0.002427087761703799, 0.9998786456763282, -1.990460277609724 },
+		{ 0.002889356577960396, 0.9998555321900823, -1.986512025392025 },
+		{ 0.003714830976628071, 0.9998142591326046, -1.977773027411333 },
+		{ 0.005200615607480529, 0.9997399721187489, -1.956616949272647 },
+		{ 0.007280434730446718, 0.9996359802264226, -1.915411868248778 },
+		{ 0.00866682503628508, 0.9995666588529682, -1.880558108737762 },
+		{ 0.01114237152697835, 0.9994428825257495, -1.804013680965982 },
+		{ 0.01559759822103543, 0.9992201208171313, -1.622291265876923 },
+		{ 0.0218332126584749, 0.9989083397966778, -1.283126173459151 },
+		{ 0.02598920966063914, 0.9987005398311792, -1.011361816575309 },
+		{ 0.0001070206878125991, 0.9999946489657299, -1.999976323461319 },
+		{ 0.0001498289268545128, 0.9999925085567669, -1.999956590627838 },
+		{ 0.0001783674341407171, 0.9999910816309115, -1.999940177743249 },
+		{ 0.0002497142545187204, 0.9999875142924568, -1.999887743047706 },
+		{ 0.0003210603454233985, 0.9999839469830901, -1.999819020340863 },
+		{ 0.0004494870157425383, 0.9999775259204756, -1.99965427707565 },
+		{ 0.0005350977123748493, 0.9999732451149836, -1.999515129198531 },
+		{ 0.000749133962907502, 0.9999625434268561, -1.999064677081657 },
+		{ 0.0009631670203265879, 0.9999518416896416, -1.998467686919606 },
+		{ 0.001348418454625628, 0.999932579113055, -1.997024017675215 },
+		{ 0.001605250188075069, 0.9999197374924035, -1.995798063661091 },
+		{ 0.002247313554449345, 0.9998876343258949, -1.99181195255472 },
+		{ 0.002889356577960396, 0.9998555321900823, -1.986512025392025 },
+		{ 0.004044982635310271, 0.9997977509755862, -1.973673194857432 },
+		{ 0.004815392055299514, 0.9997592324572451, -1.962769200588452 },
+		{ 0.006741183218765366, 0.9996629410179696, -1.927380791926447 },
+		{ 0.00866682503628508, 0.9995666588529682, -1.880558108737762 },
+		{ 0.01213249379003417, 0.9993933756324886, -1.768396624752651 },
+		{ 0.01444260930265769, 0.9992778696297425, -1.674604262866392 },
+		{ 0.02021673389308701, 0.9989891638418877, -1.379634339036823 },
+		{ 0.02598920966063914, 0.9987005398311792, -1.011361816575309 },
+		{ 0.0001070206878125991, 0.9999946489657299, -1.999976323461319 },
+		{ 0.0001498289268545128, 0.9999925085567669, -1.999956590627838 },
+		{ 0.0001926371149365062, 0.9999903681523851, -1.999930993767595 },
+		{ 0.0002293294188978367, 0.9999885335307168, -1.999904386490939 },
+		{ 0.0003210603454233985, 0.9999839469830901, -1.999819020340863 },
+		{ 0.0004494870157425383, 0.9999775259204756, -1.99965427707565 },
+		{ 0.0005779055430794499, 0.99997110480092, -1.999436764056811 },
+		{ 0.0006879811762912412, 0.9999656009702266, -1.999208328059108 },
+		{ 0.0009631670203265879, 0.9999518416896416, -1.998467686919606 },
+		{ 0.001348418454625628, 0.999932579113055, -1.997024017675215 },
+		{ 0.001733665540765597, 0.9999133167439224, -1.995106083804795 },
+		{ 0.002063869097579954, 0.9998968066241262, -1.993085046728886 },
+		{ 0.002889356577960396, 0.9998555321900823, -1.986512025392025 },
+		{ 0.004044982635310271, 0.9997977509755862, -1.973673194857432 },
+		{ 0.005200615607480529, 0.9997399721187489, -1.956616949272647 },
+		{ 0.006190983648956903, 0.999690452145046, -1.938669137131863 },
+		{ 0.00866682503628508, 0.9995666588529682, -1.880558108737762 },
+		{ 0.01213249379003417, 0.9993933756324886, -1.768396624752651 },
+		{ 0.01559759822103543, 0.9992201208171313, -1.622291265876923 },
+		{ 0.01856715550472058, 0.9990716422303736, -1.472158915747857 },
+		{ 0.02598920966063914, 0.9987005398311792, -1.011361816575309 },
+		{ 0.0001070206878125991, 0.9999946489657299, -1.999976323461319 },
+		{ 0.0001498289268545128, 0.9999925085567669, -1.999956590627838 },
+		{ 0.0001926371149365062, 0.9999903681523851, -1.999930993767595 },
+		{ 0.0002497142545187204, 0.9999875142924568, -1.999887743047706 },
+		{ 0.0003210603454233985, 0.9999839469830901, -1.999819020340863 },
+		{ 0.0004494870157425383, 0.9999775259204756, -1.99965427707565 },
+		{ 0.0005779055430794499, 0.99997110480092, -1.999436764056811 },
+		{ 0.000749133962907502, 0.9999625434268561, -1.999064677081657 },
+		{ 0.0009631670203265879, 0.9999518416896416, -1.998467686919606 },
+		{ 0.001348418454625628, 0.999932579113055, -1.997024017675215 },
+		{ 0.001733665540765597, 0.9999133167439224, -1.995106083804795 },
+		{ 0.002247313554449345, 0.9998876343258949, -1.99181195255472 },
+		{ 0.002889356577960396, 0.9998555321900823, -1.986512025392025 },
+		{ 0.004044982635310271, 0.9997977509755862, -1.973673194857432 },
+		{ 0.005200615607480529, 0.9997399721187489, -1.956616949272647 },
+		{ 0.006741183218765366, 0.9996629410179696, -1.927380791926447 },
+		{ 0.00866682503628508, 0.9995666588529682, -1.880558108737762 },
+		{ 0.01213249379003417, 0.9993933756324886, -1.768396624752651 },
+		{ 0.01559759822103543, 0.9992201208171313, -1.622291265876923 },
+		{ 0.02021673389308701, 0.9989891638418877, -1.379634339036823 },
+		{ 0.02598920966063914, 0.9987005398311792, -1.011361816575309 },
+		{ 0.0001070206878125991, 0.9999946489657299, -1.999976323461319 },
+		{ 0.0001498289268545128, 0.9999925085567669, -1.999956590627838 },
+		{ 0.0001926371149365062, 0.9999903681523851, -1.999930993767595 },
+		{ 0.0002696912601901127, 0.9999865154425878, -1.999870142481835 },
+		{ 0.0003210603454233985, 0.9999839469830901, -1.999819020340863 },
+		{ 0.0004494870157425383, 0.9999775259204756, -1.99965427707565 },
+		{ 0.0005779055430794499, 0.99997110480092, -1.999436764056811 },
+		{ 0.0008090619825076944, 0.9999595469223466, -1.998912288193666 },
+		{ 0.0009631670203265879, 0.9999518416896416, -1.998467686919606 },
+		{ 0.001348418454625628, 0.999932579113055, -1.997024017675215 },
+		{ 0.001733665540765597, 0.9999133167439224, -1.995106083804795 },
+		{ 0.002427087761703799, 0.9998786456763282, -1.990460277609724 },
+		{ 0.002889356577960396, 0.9998555321900823, -1.986512025392025 },
+		{ 0.004044982635310271, 0.9997977509755862, -1.973673194857432 },
+		{ 0.005200615607480529, 0.9997399721187489, -1.956616949272647 },
+		{ 0.007280434730446718, 0.9996359802264226, -1.915411868248778 },
+		{ 0.00866682503628508, 0.9995666588529682, -1.880558108737762 },
+		{ 0.01213249379003417, 0.9993933756324886, -1.768396624752651 },
+		{ 0.01559759822103543, 0.9992201208171313, -1.622291265876923 },
+		{ 0.0218332126584749, 0.9989083397966778, -1.283126173459151 },
+		{ 0.02598920966063914, 0.9987005398311792, -1.011361816575309 },
+		{ 0.0001070206878125991, 0.9999946489657299, -1.999976323461319 },
+		{ 0.0001783674341407171, 0.9999910816309115, -1.999940177743249 },
+		{ 0.0001926371149365062, 0.9999903681523851, -1.999930993767595 },
+		{ 0.0002497142545187204, 0.9999875142924568, -1.999887743047706 },
+		{ 0.0003210603454233985, 0.9999839469830901, -1.999819020340863 },
+		{ 0.0005350977123748493, 0.9999732451149836, -1.999515129198531 },
+		{ 0.0005779055430794499, 0.99997110480092, -1.999436764056811 },
+		{ 0.000749133962907502, 0.9999625434268561, -1.999064677081657 },
+		{ 0.0009631670203265879, 0.9999518416896416, -1.998467686919606 },
+		{ 0.001605250188075069, 0.9999197374924035, -1.995798063661091 },
+		{ 0.001733665540765597, 0.9999133167439224, -1.995106083804795 },
+		{ 0.002247313554449345, 0.9998876343258949, -1.99181195255472 },
+		{ 0.002889356577960396, 0.9998555321900823, -1.986512025392025 },
+		{ 0.004815392055299514, 0.9997592324572451, -1.962769200588452 },
+		{ 0.005200615607480529, 0.9997399721187489, -1.956616949272647 },
+		{ 0.006741183218765366, 0.9996629410179696, -1.927380791926447 },
+		{ 0.00866682503628508, 0.9995666588529682, -1.880558108737762 },
+		{ 0.01444260930265769, 0.9992778696297425, -1.674604262866392 },
+		{ 0.01559759822103543, 0.9992201208171313, -1.622291265876923 },
+		{ 0.02021673389308701, 0.9989891638418877, -1.379634339036823 },
+		{ 0.02598920966063914, 0.9987005398311792, -1.011361816575309 },
+		{ 0.0001070206878125991, 0.9999946489657299, -1.999976323461319 },
+		{ 0.0001783674341407171, 0.9999910816309115, -1.999940177743249 },
+		{ 0.0001926371149365062, 0.9999903681523851, -1.999930993767595 },
+		{ 0.0002696912601901127, 0.9999865154425878, -1.999870142481835 },
+		{ 0.0003210603454233985, 0.9999839469830901, -1.999819020340863 },
+		{ 0.0005350977123748493, 0.9999732451149836, -1.999515129198531 },
+		{ 0.0005779055430794499, 0.99997110480092, -1.999436764056811 },
+		{ 0.0008090619825076944, 0.9999595469223466, -1.998912288193666 },
+		{ 0.0009631670203265879, 0.9999518416896416, -1.998467686919606 },
+		{ 0.001605250188075069, 0.9999197374924035, -1.995798063661091 },
+		{ 0.001733665540765597, 0.9999133167439224, -1.995106083804795 },
+		{ 0.002427087761703799, 0.9998786456763282, -1.990460277609724 },
+		{ 0.002889356577960396, 0.9998555321900823, -1.986512025392025 },
+		{ 0.004815392055299514, 0.9997592324572451, -1.962769200588452 },
+		{ 0.005200615607480529, 0.9997399721187489, -1.956616949272647 },
+		{ 0.007280434730446718, 0.9996359802264226, -1.915411868248778 },
+		{ 0.00866682503628508, 0.9995666588529682, -1.880558108737762 },
+		{ 0.01444260930265769, 0.9992778696297425, -1.674604262866392 },
+		{ 0.01559759822103543, 0.9992201208171313, -1.622291265876923 },
+		{ 0.0218332126584749, 0.9989083397966778, -1.283126173459151 },
+		{ 0.02598920966063914, 0.9987005398311792, -1.011361816575309 },
+		{ 0.0001070206878125991, 0.9999946489657299, -1.999976323461319 },
+		{ 0.0001783674341407171, 0.9999910816309115, -1.999940177743249 },
+		{ 0.0002497142545187204, 0.9999875142924568, -1.999887743047706 },
+		{ 0.0002696912601901127, 0.9999865154425878, -1.999870142481835 },
+		{ 0.0003210603454233985, 0.9999839469830901, -1.999819020340863 },
+		{ 0.0005350977123748493, 0.9999732451149836, -1.999515129198531 },
+		{ 0.000749133962907502, 0.9999625434268561, -1.999064677081657 },
+		{ 0.0008090619825076944, 0.9999595469223466, -1.998912288193666 },
+		{ 0.0009631670203265879, 0.9999518416896416, -1.998467686919606 },
+		{ 0.001605250188075069, 0.9999197374924035, -1.995798063661091 },
+		{ 0.002247313554449345, 0.9998876343258949, -1.99181195255472 },
+		{ 0.002427087761703799, 0.9998786456763282, -1.990460277609724 },
+		{ 0.002889356577960396, 0.9998555321900823, -1.986512025392025 },
+		{ 0.004815392055299514, 0.9997592324572451, -1.962769200588452 },
+		{ 0.006741183218765366, 0.9996629410179696, -1.927380791926447 },
+		{ 0.007280434730446718, 0.9996359802264226, -1.915411868248778 },
+		{ 0.00866682503628508, 0.9995666588529682, -1.880558108737762 },
+		{ 0.01444260930265769, 0.9992778696297425, -1.674604262866392 },
+		{ 0.02021673389308701, 0.9989891638418877, -1.379634339036823 },
+		{ 0.0218332126584749, 0.9989083397966778, -1.283126173459151 },
+		{ 0.02598920966063914, 0.9987005398311792, -1.011361816575309 },
+		{ 0.0001070206878125991, 0.9999946489657299, -1.999976323461319 },
+		{ 0.0001783674341407171, 0.9999910816309115, -1.999940177743249 },
+		{ 0.0002097601833153738, 0.9999895119951877, -1.999919113162254 },
+		{ 0.0002972781997127801, 0.9999851360902526, -1.999843737785229 },
+		{ 0.0003210603454233985, 0.9999839469830901, -1.999819020340863 },
+		{ 0.0005350977123748493, 0.9999732451149836, -1.999515129198531 },
+		{ 0.0006292749721931283, 0.9999685362991947, -1.999334982524384 },
+		{ 0.0008918247359064992, 0.999955408868115, -1.998682959260549 },
+		{ 0.0009631670203265879, 0.9999518416896416, -1.998467686919606 },
+		{ 0.001605250188075069, 0.9999197374924035, -1.995798063661091 },
+		{ 0.001887760380897262, 0.9999056120310551, -1.99420623525709 },
+		{ 0.00267534540092856, 0.9998662327329656, -1.988424437354783 },
+		{ 0.002889356577960396, 0.9998555321900823, -1.986512025392025 },
+		{ 0.004815392055299514, 0.9997592324572451, -1.962769200588452 },
+		{ 0.00566276053882529, 0.9997168631467475, -1.948622133922139 },
+		{ 0.008024962629718493, 0.9995987518775488, -1.897420304134652 },
+		{ 0.00866682503628508, 0.9995666588529682, -1.880558108737762 },
+		{ 0.01444260930265769, 0.9992778696297425, -1.674604262866392 },
+		{ 0.01698343470527481, 0.9991508282821204, -1.55495520523531 },
+		{ 0.02406522917758147, 0.9987967385682133, -1.141122814478123 },
+		{ 0.02598920966063914, 0.9987005398311792, -1.011361816575309 },
+		{ 0.0001070206878125991, 0.9999946489657299, -1.999976323461319 },
+		{ 0.0001638068903970985, 0.9999918096560561, -1.999948877324133 },
+		{ 0.0002293294188978367, 0.9999885335307168, -1.999904386490939 },
+		{ 0.0002972781997127801, 0.9999851360902526, -1.999843737785229 },
+		{ 0.0003210603454233985, 0.9999839469830901, -1.999819020340863 },
+		{ 0.0004914195495488072, 0.999975429120327, -1.999589050812929 },
+		{ 0.0006879811762912412, 0.9999656009702266, -1.999208328059108 },
+		{ 0.0008918247359064992, 0.999955408868115, -1.998682959260549 },
+		{ 0.0009631670203265879, 0.9999518416896416, -1.998467686919606 },
+		{ 0.001474213677588005, 0.9999262893357636, -1.996449881099182 },
+		{ 0.002063869097579954, 0.9998968066241262, -1.993085046728886 },
+		{ 0.00267534540092856, 0.9998662327329656, -1.988424437354783 },
+		{ 0.002889356577960396, 0.9998555321900823, -1.986512025392025 },
+		{ 0.004422317593624389, 0.9997788841430876, -1.968565937811832 },
+		{ 0.006190983648956903, 0.999690452145046, -1.938669137131863 },
+		{ 0.008024962629718493, 0.9995987518775488, -1.897420304134652 },
+		{ 0.00866682503628508, 0.9995666588529682, -1.880558108737762 },
+		{ 0.01326401946345747, 0.9993367990951183, -1.724296816384703 },
+		{ 0.01856715550472058, 0.9990716422303736, -1.472158915747857 },
+		{ 0.02406522917758147, 0.9987967385682133, -1.141122814478123 },
+		{ 0.02598920966063914, 0.9987005398311792, -1.011361816575309 }
+	},
+	.c_bpre9600080040 = {
+		{ 5.351041548811428e-05, 0.9999973244792858, -1.999992743091807 },
+		{ 6.879918261637079e-05, 0.9999965600437735, -1.999988986724268 },
+		{ 9.631878940227642e-05, 0.9999951840645958, -1.999980340377572 },
+		{ 0.0001248575169938711, 0.9999937571267417, -1.999968814082157 },
+		{ 0.0001605308169597262, 0.9999919734593324, -1.999950741208276 },
+		{ 0.0002063968378580633, 0.9999896801668197, -1.999921520869871 },
+		{ 0.0002889548589148728, 0.999985552296092, -1.99985196168342 },
+		{ 0.0003745704890205105, 0.9999812715380505, -1.999756790251714 },
+		{ 0.0004815893083607977, 0.9999759205549109, -1.999604842970141 },
+		{ 0.0006191841236475288, 0.9999690408199551, -1.999355641351559 },
+		{ 0.0008668515561691685, 0.9999566574326721, -1.998754461826764 },
+		{ 0.001123688344113333, 0.9999438155846032, -1.997923818299962 },
+		{ 0.001444730470133754, 0.999927763485984, -1.996588979329848 },
+		{ 0.00185750174580942, 0.9999071252534431, -1.994388948516752 },
+		{ 0.002600476863858049, 0.9998699776064631, -1.989059301445751 },
+		{ 0.003370875679306612, 0.9998314563054962, -1.981676993117409 },
+		{ 0.004333882081379363, 0.9997833059483281, -1.969803219113973 },
+		{ 0.005571961930946094, 0.9997214024545787, -1.950245238340118 },
+		{ 0.007800320233993908, 0.9996099843524628, -1.903026865002523 },
+		{ 0.01011092271413867, 0.9994944541326319, -1.83810317634653 },
+		{ 0.01299882906822196, 0.9993500587037454, -1.734953036344066 },
+		{ 5.351041548811428e-05, 0.9999973244792858, -1.999992743091807 },
+		{ 6.879918261637079e-05, 0.9999965600437735, -1.999988986724268 },
+		{ 9.631878940227642e-05, 0.9999951840645958, -1.999980340377572 },
+		{ 0.0001348460846822813, 0.9999932576985645, -1.999964164148689 },
+		{ 0.0001605308169597262, 0.9999919734593324, -1.999950741208276 },
+		{ 0.0002063968378580633, 0.9999896801668197, -1.999921520869871 },
+		{ 0.0002889548589148728, 0.999985552296092, -1.99985196168342 },
+		{ 0.0004045350824713036, 0.9999797732566128, -1.999717938787118 },
+		{ 0.0004815893083607977, 0.9999759205549109, -1.999604842970141 },
+		{ 0.0006191841236475288, 0.9999690408199551, -1.999355641351559 },
+		{ 0.0008668515561691685, 0.9999566574326721, -1.998754461826764 },
+		{ 0.001213580700282687, 0.9999393209971936, -1.997583269756928 },
+		{ 0.001444730470133754, 0.999927763485984, -1.996588979329848 },
+		{ 0.00185750174580942, 0.9999071252534431, -1.994388948516752 },
+		{ 0.002600476863858049, 0.9998699776064631, -1.989059301445751 },
+		{ 0.003640548703308562, 0.9998179735463963, -1.978647976786009 },
+		{ 0.004333882081379363, 0.9997833059483281, -1.969803219113973 },
+		{ 0.005571961930946094, 0.9997214024545787, -1.950245238340118 },
+		{ 0.007800320233993908, 0.9996099843524628, -1.903026865002523 },
+		{ 0.01091958726271276, 0.9994540208517237, -1.811638559021681 },
+		{ 0.01299882906822196, 0.9993500587037454, -1.734953036344066 },
+		{ 5.351041548811428e-05, 0.9999973244792858, -1.999992743091807 },
+		{ 7.491460373136694e-05, 0.9999962542713682, -1.999987274752161 },
+		{ 8.9183915914962e-05, 0.9999955408055136, -1.999982814764736 },
+		{ 0.0001248575169938711, 0.9999937571267417, -1.999968814082157 },
+		{ 0.0001605308169597262, 0.9999919734593324, -1.999950741208276 },
+		{ 0.0002247447705970371, 0.9999887628971018, -1.999907948599101 },
+		{ 0.0002675506457704426, 0.9999866224680127, -1.999872089443367 },
+		{ 0.0003745704890205105, 0.9999812715380505, -1.999756790251714 },
+		{ 0.0004815893083607977, 0.9999759205549109, -1.999604842970141 },
+		{ 0.0006742205916383023, 0.9999662889883114, -1.999239004134489 },
+		{ 0.0008026411998669712, 0.9999598679409105, -1.998929163213287 },
+		{ 0.001123688344113333, 0.9999438155846032, -1.997923818299962 },
+		{ 0.001444730470133754, 0.999927763485984, -1.996588979329848 },
+		{ 0.002022593589723311, 0.9998988703741923, -1.993356700561298 },
+		{ 0.002407840968865237, 0.999879608981624, -1.990610061937231 },
+		{ 0.003370875679306612, 0.9998314563054962, -1.981676993117409 },
+		{ 0.004333882081379363, 0.9997833059483281, -1.969803219113973 },
+		{ 0.006067167157460935, 0.9996966418031464, -1.941079574276902 },
+		{ 0.00722260880310387, 0.999638869607291, -1.916737335335853 },
+		{ 0.01011092271413867, 0.9994944541326319, -1.83810317634653 },
+		{ 0.01299882906822196, 0.9993500587037454, -1.734953036344066 },
+		{ 5.351041548811428e-05, 0.9999973244792858, -1.999992743091807 },
+		{ 7.491460373136694e-05, 0.9999962542713682, -1.999987274752161 },
+		{ 9.631878940227642e-05, 0.9999951840645958, -1.999980340377572 },
+		{ 0.0001146650381506545, 0.9999942667489234, -1.999973229818036 },
+		{ 0.0001605308169597262, 0.9999919734593324, -1.999950741208276 },
+		{ 0.0002247447705970371, 0.9999887628971018, -1.999907948599101 },
+		{ 0.0002889548589148728, 0.999985552296092, -1.99985196168342 },
+		{ 0.0003439935464365712, 0.999982800337199, -1.999793471519887 },
+		{ 0.0004815893083607977, 0.9999759205549109, -1.999604842970141 },
+		{ 0.0006742205916383023, 0.9999662889883114, -1.999239004134489 },
+		{ 0.0008668515561691685, 0.9999566574326721, -1.998754461826764 },
+		{ 0.001031961172360522, 0.9999484019808854, -1.998244692397603 },
+		{ 0.001444730470133754, 0.999927763485984, -1.996588979329848 },
+		{ 0.002022593589723311, 0.9998988703741923, -1.993356700561298 },
+		{ 0.002600476863858049, 0.9998699776064631, -1.989059301445751 },
+		{ 0.003095731412274959, 0.9998452140931845, -1.984530061672989 },
+		{ 0.004333882081379363, 0.9997833059483281, -1.969803219113973 },
+		{ 0.006067167157460935, 0.9996966418031464, -1.941079574276902 },
+		{ 0.007800320233993908, 0.9996099843524628, -1.903026865002523 },
+		{ 0.009285733373454425, 0.9995357133341326, -1.863123820583315 },
+		{ 0.01299882906822196, 0.9993500587037454, -1.734953036344066 },
+		{ 5.351041548811428e-05, 0.9999973244792858, -1.999992743091807 },
+		{ 7.491460373136694e-05, 0.9999962542713682, -1.999987274752161 },
+		{ 9.631878940227642e-05, 0.9999951840645958, -1.999980340377572 },
+		{ 0.0001248575169938711, 0.9999937571267417, -1.999968814082157 },
+		{ 0.0001605308169597262, 0.9999919734593324, -1.999950741208276 },
+		{ 0.0002247447705970371, 0.9999887628971018, -1.999907948599101 },
+		{ 0.0002889548589148728, 0.999985552296092, -1.99985196168342 },
+		{ 0.0003745704890205105, 0.9999812715380505, -1.999756790251714 },
+		{ 0.0004815893083607977, 0.9999759205549109, -1.999604842970141 },
+		{ 0.0006742205916383023, 0.9999662889883114, -1.999239004134489 },
+		{ 0.0008668515561691685, 0.9999566574326721, -1.998754461826764 },
+		{ 0.001123688344113333, 0.9999438155846032, -1.997923818299962 },
+		{ 0.001444730470133754, 0.999927763485984, -1.996588979329848 },
+		{ 0.002022593589723311, 0.9998988703741923, -1.993356700561298 },
+		{ 0.002600476863858049, 0.9998699776064631, -1.989059301445751 },
+		{ 0.003370875679306612, 0.9998314563054962, -1.981676993117409 },
+		{ 0.004333882081379363, 0.9997833059483281, -1.969803219113973 },
+		{ 0.006067167157460935, 0.9996966418031464, -1.941079574276902 },
+		{ 0.007800320233993908, 0.9996099843524628, -1.903026865002523 },
+		{ 0.01011092271413867, 0.9994944541326319, -1.83810317634653 },
+		{ 0.01299882906822196, 0.9993500587037454, -1.734953036344066 },
+		{ 5.351041548811428e-05, 0.9999973244792858, -1.999992743091807 },
+		{ 7.491460373136694e-05, 0.9999962542713682, -1.999987274752161 },
+		{ 9.631878940227642e-05, 0.9999951840645958, -1.999980340377572 },
+		{ 0.0001348460846822813, 0.9999932576985645, -1.999964164148689 },
+		{ 0.0001605308169597262, 0.9999919734593324, -1.999950741208276 },
+		{ 0.0002247447705970371, 0.9999887628971018, -1.999907948599101 },
+		{ 0.0002889548589148728, 0.999985552296092, -1.99985196168342 },
+		{ 0.0004045350824713036, 0.9999797732566128, -1.999717938787118 },
+		{ 0.0004815893083607977, 0.9999759205549109, -1.999604842970141 },
+		{ 0.0006742205916383023, 0.9999662889883114, -1.999239004134489 },
+		{ 0.0008668515561691685, 0.9999566574326721, -1.998754461826764 },
+		{ 0.001213580700282687, 0.9999393209971936, -1.997583269756928 },
+		{ 0.001444730470133754, 0.999927763485984, -1.996588979329848 },
+		{ 0.002022593589723311, 0.9998988703741923, -1.993356700561298 },
+		{ 0.002600476863858049, 0.9998699776064631, -1.989059301445751 },
+		{ 0.003640548703308562, 0.9998179735463963, -1.978647976786009 },
+		{ 0.004333882081379363, 0.9997833059483281, -1.969803219113973 },
+		{ 0.006067167157460935, 0.9996966418031464, -1.941079574276902 },
+		{ 0.007800320233993908, 0.9996099843524628, -1.903026865002523 },
+		{ 0.01091958726271276, 0.9994540208517237, -1.811638559021681 },
+		{ 0.01299882906822196, 0.9993500587037454, -1.734953036344066 },
+		{ 5.351041548811428e-05, 0.9999973244792858, -1.999992743091807 },
+		{ 8.9183915914962e-05, 0.9999955408055136, -1.999982814764736 },
+		{ 9.631878940227642e-05, 0.9999951840645958, -1.999980340377572 },
+		{ 0.0001248575169938711, 0.9999937571267417, -1.999968814082157 },
+		{ 0.0001605308169597262, 0.9999919734593324, -1.999950741208276 },
+		{ 0.0002675506457704426, 0.9999866224680127, -1.999872089443367 },
+		{ 0.0002889548589148728, 0.999985552296092, -1.99985196168342 },
+		{ 0.0003745704890205105, 0.9999812715380505, -1.999756790251714 },
+		{ 0.0004815893083607977, 0.9999759205549109, -1.999604842970141 },
+		{ 0.0008026411998669712, 0.9999598679409105, -1.998929163213287 },
+		{ 0.0008668515561691685, 0.9999566574326721, -1.998754461826764 },
+		{ 0.001123688344113333, 0.9999438155846032, -1.997923818299962 },
+		{ 0.001444730470133754, 0.999927763485984, -1.996588979329848 },
+		{ 0.002407840968865237, 0.999879608981624, -1.990610061937231 },
+		{ 0.002600476863858049, 0.9998699776064631, -1.989059301445751 },
+		{ 0.003370875679306612, 0.9998314563054962, -1.981676993117409 },
+		{ 0.004333882081379363, 0.9997833059483281, -1.969803219113973 },
+		{ 0.00722260880310387, 0.999638869607291, -1.916737335335853 },
+		{ 0.007800320233993908, 0.9996099843524628, -1.903026865002523 },
+		{ 0.01011092271413867, 0.9994944541326319, -1.83810317634653 },
+		{ 0.01299882906822196, 0.9993500587037454, -1.734953036344066 },
+		{ 5.351041548811428e-05, 0.9999973244792858, -1.999992743091807 },
+		{ 8.9183915914962e-05, 0.9999955408055136, -1.999982814764736 },
+		{ 9.631878940227642e-05, 0.9999951840645958, -1.999980340377572 },
+		{ 0.0001348460846822813, 0.9999932576985645, -1.999964164148689 },
+		{ 0.0001605308169597262, 0.9999919734593324, -1.999950741208276 },
+		{ 0.0002675506457704426, 0.9999866224680127, -1.999872089443367 },
+		{ 0.0002889548589148728, 0.999985552296092, -1.99985196168342 },
+		{ 0.0004045350824713036, 0.9999797732566128, -1.999717938787118 },
+		{ 0.0004815893083607977, 0.9999759205549109, -1.999604842970141 },
+		{ 0.0008026411998669712, 0.9999598679409105, -1.998929163213287 },
+		{ 0.0008668515561691685, 0.9999566574326721, -1.998754461826764 },
+		{ 0.001213580700282687, 0.9999393209971936, -1.997583269756928 },
+		{ 0.001444730470133754, 0.999927763485984, -1.996588979329848 },
+		{ 0.002407840968865237, 0.999879608981624, -1.990610061937231 },
+		{ 0.002600476863858049, 0.9998699776064631, -1.989059301445751 },
+		{ 0.003640548703308562, 0.9998179735463963, -1.978647976786009 },
+		{ 0.004333882081379363, 0.9997833059483281, -1.969803219113973 },
+		{ 0.00722260880310387, 0.999638869607291, -1.916737335335853 },
+		{ 0.007800320233993908, 0.9996099843524628, -1.903026865002523 },
+		{ 0.01091958726271276, 0.9994540208517237, -1.811638559021681 },
+		{ 0.01299882906822196, 0.9993500587037454, -1.734953036344066 },
+		{ 5.351041548811428e-05, 0.9999973244792858, -1.999992743091807 },
+		{ 8.9183915914962e-05, 0.9999955408055136, -1.999982814764736 },
+		{ 0.0001248575169938711, 0.9999937571267417, -1.999968814082157 },
+		{ 0.0001348460846822813, 0.9999932576985645, -1.999964164148689 },
+		{ 0.0001605308169597262, 0.9999919734593324, -1.999950741208276 },
+		{ 0.0002675506457704426, 0.9999866224680127, -1.999872089443367 },
+		{ 0.0003745704890205105, 0.9999812715380505, -1.999756790251714 },
+		{ 0.0004045350824713036, 0.9999797732566128, -1.999717938787118 },
+		{ 0.0004815893083607977, 0.9999759205549109, -1.999604842970141 },
+		{ 0.0008026411998669712, 0.9999598679409105, -1.998929163213287 },
+		{ 0.001123688344113333, 0.9999438155846032, -1.997923818299962 },
+		{ 0.001213580700282687, 0.9999393209971936, -1.997583269756928 },
+		{ 0.001444730470133754, 0.999927763485984, -1.996588979329848 },
+		{ 0.002407840968865237, 0.999879608981624, -1.990610061937231 },
+		{ 0.003370875679306612, 0.9998314563054962, -1.981676993117409 },
+		{ 0.003640548703308562, 0.9998179735463963, -1.978647976786009 },
+		{ 0.004333882081379363, 0.9997833059483281, -1.969803219113973 },
+		{ 0.00722260880310387, 0.999638869607291, -1.916737335335853 },
+		{ 0.01011092271413867, 0.9994944541326319, -1.83810317634653 },
+		{ 0.01091958726271276, 0.9994540208517237, -1.811638559021681 },
+		{ 0.01299882906822196, 0.9993500587037454, -1.734953036344066 },
+		{ 5.351041548811428e-05, 0.9999973244792858, -1.999992743091807 },
+		{ 8.9183915914962e-05, 0.9999955408055136, -1.999982814764736 },
+		{ 0.0001048803666481015, 0.999994755983844, -1.999977156152025 },
+		{ 0.0001486396522029892, 0.9999925680175092, -1.999957217997487 },
+		{ 0.0001605308169597262, 0.9999919734593324, -1.999950741208276 },
+		{ 0.0002675506457704426, 0.9999866224680127, -1.999872089443367 },
+		{ 0.0003146399610436026, 0.9999842680258499, -1.999825872063896 },
+		{ 0.000445917338989405, 0.9999777041855058, -1.999659562933581 },
+		{ 0.0004815893083607977, 0.9999759205549109, -1.999604842970141 },
+		{ 0.0008026411998669712, 0.9999598679409105, -1.998929163213287 },
+		{ 0.0009439024642344614, 0.9999528049018388, -1.99852741914239 },
+		{ 0.001337717437656104, 0.999933114129623, -1.997070520944823 },
+		{ 0.001444730470133754, 0.999927763485984, -1.996588979329848 },
+		{ 0.002407840968865237, 0.999879608981624, -1.990610061937231 },
+		{ 0.002831580714816425, 0.999858421551145, -1.987042771879988 },
+		{ 0.00401288389578005, 0.999799355809729, -1.974086881771594 },
+		{ 0.004333882081379363, 0.9997833059483281, -1.969803219113973 },
+		{ 0.00722260880310387, 0.999638869607291, -1.916737335335853 },
+		{ 0.008493520850013661, 0.9995753239661933, -1.885233638890376 },
+		{ 0.01203623636336063, 0.9993981881953824, -1.771981734830587 },
+		{ 0.01299882906822196, 0.9993500587037454, -1.734953036344066 },
+		{ 5.351041548811428e-05, 0.9999973244792858, -1.999992743091807 },
+		{ 8.190361289476763e-05, 0.9999959048196428, -1.999985171685885 },
+		{ 0.0001146650381506545, 0.9999942667489234, -1.999973229818036 },
+		{ 0.0001486396522029892, 0.9999925680175092, -1.999957217997487 },
+		{ 0.0001605308169597262, 0.9999919734593324, -1.999950741208276 },
+		{ 0.000245711284121601, 0.9999877144846965, -1.999891116981706 },
+		{ 0.0003439935464365712, 0.999982800337199, -1.999793471519887 },
+		{ 0.000445917338989405, 0.9999777041855058, -1.999659562933581 },
+		{ 0.0004815893083607977, 0.9999759205549109, -1.999604842970141 },
+		{ 0.0007371204224551655, 0.9999631439886988, -1.999093836986588 },
+		{ 0.001031961172360522, 0.9999484019808854, -1.998244692397603 },
+		{ 0.001337717437656104, 0.999933114129623, -1.997070520944823 },
+		{ 0.001444730470133754, 0.999927763485984, -1.996588979329848 },
+		{ 0.002211281040894106, 0.9998894359593402, -1.992070483147097 },
+		{ 0.003095731412274959, 0.9998452140931845, -1.984530061672989 },
+		{ 0.00401288389578005, 0.999799355809729, -1.974086881771594 },
+		{ 0.004333882081379363, 0.9997833059483281, -1.969803219113973 },
+		{ 0.006633109685225794, 0.9996683445498903, -1.929671866678435 },
+		{ 0.009285733373454425, 0.9995357133341326, -1.863123820583315 },
+		{ 0.01203623636336063, 0.9993981881953824, -1.771981734830587 },
+		{ 0.01299882906822196, 0.9993500587037454, -1.734953036344066 }
+	}
+};
@@ -0,0 +1,1647 @@
+#include "Scales.hpp"
+Scale buchla296 = {
+	.name = "Buchla 296 EQ",
+	.description = "Frequencies from the Buchla 296 EQ module. Each scale is shifted up 50 cents from previous scale.",
+	.scalename = {
+		"20.000Hz",
+		"20.586Hz",
+		"21.189Hz",
+		"21.810Hz",
+		"22.449Hz",
+		"23.107Hz",
+		"23.794Hz",
+		"24.481Hz",
+		"25.198Hz",
+		"25.937Hz",
+		"26.697Hz"},
+	.notedesc = {
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		""},
+	.c_maxq48000 = {
+		0.002617993877991494,
+		0.005235987755982988,
+		0.007853981633974482,
+		0.01047197551196598,
+		0.01308996938995747,
+		0.01963495408493621,
+		0.03272492347489368,
+		0.04581489286485114,
+		0.06544984694978735,
+		0.08246680715673207,
+		0.1047197551196598,
+		0.1308996938995747,
+		0.1701696020694471,
+		0.2094395102393196,
+		0.2617993877991494,
+		0.3403392041388942,
+		0.4581489286485115,
+		0.6544984694978736,
+		1.047197551196598,
+		1.308996938995747,
+		2.617993877991494,
+		0.002694706954135615,
+		0.005389413908271229,
+		0.008084120862406844,
+		0.01077882781654246,
+		0.01347353477067807,
+		0.02021030215601711,
+		0.03368383692669518,
+		0.04715737169737325,
+		0.06736767385339036,
+		0.08488326905527185,
+		0.1077882781654246,
+		0.1347353477067807,
+		0.1751559520188149,
+		0.2155765563308492,
+		0.2694706954135614,
+		0.3503119040376299,
+		0.4715737169737326,
+		0.6736767385339036,
+		1.077882781654246,
+		1.347353477067807,
+		1.347353477067807,
+		0.00277366789499056,
+		0.00554733578998112,
+		0.00832100368497168,
+		0.01109467157996224,
+		0.0138683394749528,
+		0.0208025092124292,
+		0.034670848687382,
+		0.0485391881623348,
+		0.06934169737476401,
+		0.08737053869220264,
+		0.1109467157996224,
+		0.138683394749528,
+		0.1802884131743864,
+		0.2218934315992448,
+		0.277366789499056,
+		0.3605768263487728,
+		0.485391881623348,
+		0.69341697374764,
+		1.109467157996224,
+		1.38683394749528,
+		1.38683394749528,
+		0.00285494256802003,
+		0.00570988513604006,
+		0.008564827704060089,
+		0.01141977027208012,
+		0.01427471284010015,
+		0.02141206926015022,
+		0.03568678210025037,
+		0.04996149494035052,
+		0.07137356420050074,
+		0.08993069089263094,
+		0.1141977027208012,
+		0.1427471284010015,
+		0.1855712669213019,
+		0.2283954054416024,
+		0.285494256802003,
+		0.3711425338426038,
+		0.4996149494035052,
+		0.7137356420050075,
+		1.141977027208012,
+		1.427471284010015,
+		1.427471284010015,
+		0.002938598770751732,
+		0.005877197541503463,
+		0.008815796312255195,
+		0.01175439508300693,
+		0.01469299385375866,
+		0.02203949078063799,
+		0.03673248463439665,
+		0.0514254784881553,
+		0.0734649692687933,
+		0.09256586127867954,
+		0.1175439508300693,
+		0.1469299385375866,
+		0.1910089200988626,
+		0.2350879016601385,
+		0.2938598770751732,
+		0.3820178401977251,
+		0.5142547848815531,
+		0.7346496926879328,
+		1.175439508300693,
+		1.469299385375866,
+		1.469299385375866,
+		0.003024706287332573,
+		0.006049412574665145,
+		0.009074118861997719,
+		0.01209882514933029,
+		0.01512353143666287,
+		0.0226852971549943,
+		0.03780882859165716,
+		0.05293236002832003,
+		0.07561765718331433,
+		0.09527824805097607,
+		0.1209882514933029,
+		0.1512353143666287,
+		0.1966059086766173,
+		0.2419765029866059,
+		0.3024706287332573,
+		0.3932118173532345,
+		0.5293236002832002,
+		0.7561765718331434,
+		1.209882514933029,
+		1.512353143666287,
+		1.512353143666287,
+		0.003113336946741051,
+		0.006226673893482101,
+		0.009340010840223152,
+		0.0124533477869642,
+		0.01556668473370525,
+		0.02335002710055788,
+		0.03891671183426314,
+		0.05448339656796838,
+		0.07783342366852627,
+		0.0980701138223431,
+		0.124533477869642,
+		0.1556668473370525,
+		0.2023669015381683,
+		0.2490669557392841,
+		0.3113336946741051,
+		0.4047338030763366,
+		0.5448339656796839,
+		0.7783342366852626,
+		1.24533477869642,
+		1.556668473370525,
+		1.556668473370525,
+		0.003204564682705384,
+		0.006409129365410768,
+		0.009613694048116152,
+		0.01281825873082154,
+		0.01602282341352692,
+		0.02403423512029038,
+		0.0400570585338173,
+		0.05607988194734422,
+		0.08011411706763459,
+		0.1009437875052196,
+		0.1281825873082154,
+		0.1602282341352692,
+		0.20829670437585,
+		0.2563651746164307,
+		0.3204564682705384,
+		0.4165934087516999,
+		0.5607988194734422,
+		0.8011411706763459,
+		1.281825873082153,
+		1.602282341352692,
+		1.602282341352692,
+		0.003298465595377395,
+		0.006596931190754789,
+		0.009895396786132181,
+		0.01319386238150958,
+		0.01649232797688697,
+		0.02473849196533045,
+		0.04123081994221742,
+		0.0577231479191044,
+		0.08246163988443485,
+		0.1039016662543879,
+		0.1319386238150957,
+		0.1649232797688697,
+		0.2144002636995306,
+		0.2638772476301915,
+		0.3298465595377394,
+		0.4288005273990612,
+		0.5772314791910439,
+		0.8246163988443485,
+		1.319386238150958,
+		1.649232797688697,
+		1.649232797688697,
+		0.003395118014813559,
+		0.006790236029627118,
+		0.01018535404444068,
+		0.01358047205925424,
+		0.01697559007406779,
+		0.0254633851111017,
+		0.04243897518516949,
+		0.05941456525923728,
+		0.08487795037033898,
+		0.1069462174666271,
+		0.1358047205925423,
+		0.169755900740678,
+		0.2206826709628814,
+		0.2716094411850847,
+		0.3395118014813559,
+		0.4413653419257627,
+		0.5941456525923728,
+		0.8487795037033897,
+		1.358047205925424,
+		1.697559007406779,
+		1.697559007406779,
+		0.003494602566316209,
+		0.006989205132632418,
+		0.01048380769894863,
+		0.01397841026526484,
+		0.01747301283158104,
+		0.02620951924737156,
+		0.04368253207895261,
+		0.06115554491053366,
+		0.08736506415790522,
+		0.1100799808389606,
+		0.1397841026526483,
+		0.1747301283158104,
+		0.2271491668105536,
+		0.2795682053052967,
+		0.3494602566316209,
+		0.4542983336211072,
+		0.6115554491053365,
+		0.8736506415790523,
+		1.397841026526484,
+		1.747301283158105,
+		1.747301283158105
+	},
+	.c_maxq96000 = {
+		0.001308996938995747,
+		0.002617993877991494,
+		0.003926990816987241,
+		0.005235987755982988,
+		0.006544984694978736,
+		0.009817477042468103,
+		0.01636246173744684,
+		0.02290744643242557,
+		0.03272492347489368,
+		0.04123340357836604,
+		0.05235987755982989,
+		0.06544984694978735,
+		0.08508480103472356,
+		0.1047197551196598,
+		0.1308996938995747,
+		0.1701696020694471,
+		0.2290744643242557,
+		0.3272492347489368,
+		0.5235987755982988,
+		0.6544984694978736,
+		1.308996938995747,
+		0.001347353477067807,
+		0.002694706954135615,
+		0.004042060431203422,
+		0.005389413908271229,
+		0.006736767385339037,
+		0.01010515107800855,
+		0.01684191846334759,
+		0.02357868584868663,
+		0.03368383692669518,
+		0.04244163452763593,
+		0.0538941390827123,
+		0.06736767385339036,
+		0.08757797600940746,
+		0.1077882781654246,
+		0.1347353477067807,
+		0.1751559520188149,
+		0.2357868584868663,
+		0.3368383692669518,
+		0.5389413908271229,
+		0.6736767385339036,
+		0.6736767385339036,
+		0.00138683394749528,
+		0.00277366789499056,
+		0.00416050184248584,
+		0.00554733578998112,
+		0.0069341697374764,
+		0.0104012546062146,
+		0.017335424343691,
+		0.0242695940811674,
+		0.034670848687382,
+		0.04368526934610132,
+		0.0554733578998112,
+		0.06934169737476401,
+		0.0901442065871932,
+		0.1109467157996224,
+		0.138683394749528,
+		0.1802884131743864,
+		0.242695940811674,
+		0.34670848687382,
+		0.554733578998112,
+		0.69341697374764,
+		0.69341697374764,
+		0.001427471284010015,
+		0.00285494256802003,
+		0.004282413852030044,
+		0.00570988513604006,
+		0.007137356420050074,
+		0.01070603463007511,
+		0.01784339105012519,
+		0.02498074747017526,
+		0.03568678210025037,
+		0.04496534544631547,
+		0.05709885136040059,
+		0.07137356420050074,
+		0.09278563346065095,
+		0.1141977027208012,
+		0.1427471284010015,
+		0.1855712669213019,
+		0.2498074747017526,
+		0.3568678210025037,
+		0.5709885136040059,
+		0.7137356420050075,
+		0.7137356420050075,
+		0.001469299385375866,
+		0.002938598770751732,
+		0.004407898156127597,
+		0.005877197541503463,
+		0.007346496926879329,
+		0.01101974539031899,
+		0.01836624231719832,
+		0.02571273924407765,
+		0.03673248463439665,
+		0.04628293063933977,
+		0.05877197541503463,
+		0.0734649692687933,
+		0.09550446004943128,
+		0.1175439508300693,
+		0.1469299385375866,
+		0.1910089200988626,
+		0.2571273924407765,
+		0.3673248463439664,
+		0.5877197541503464,
+		0.7346496926879328,
+		0.7346496926879328,
+		0.001512353143666286,
+		0.003024706287332573,
+		0.004537059430998859,
+		0.006049412574665145,
+		0.007561765718331433,
+		0.01134264857749715,
+		0.01890441429582858,
+		0.02646618001416002,
+		0.03780882859165716,
+		0.04763912402548803,
+		0.06049412574665147,
+		0.07561765718331433,
+		0.09830295433830863,
+		0.1209882514933029,
+		0.1512353143666287,
+		0.1966059086766173,
+		0.2646618001416001,
+		0.3780882859165717,
+		0.6049412574665146,
+		0.7561765718331434,
+		0.7561765718331434,
+		0.001556668473370525,
+		0.003113336946741051,
+		0.004670005420111576,
+		0.006226673893482101,
+		0.007783342366852627,
+		0.01167501355027894,
+		0.01945835591713157,
+		0.02724169828398419,
+		0.03891671183426314,
+		0.04903505691117155,
+		0.06226673893482101,
+		0.07783342366852627,
+		0.1011834507690842,
+		0.124533477869642,
+		0.1556668473370525,
+		0.2023669015381683,
+		0.2724169828398419,
+		0.3891671183426313,
+		0.6226673893482102,
+		0.7783342366852626,
+		0.7783342366852626,
+		0.001602282341352692,
+		0.003204564682705384,
+		0.004806847024058076,
+		0.006409129365410768,
+		0.00801141170676346,
+		0.01201711756014519,
+		0.02002852926690865,
+		0.02803994097367211,
+		0.0400570585338173,
+		0.0504718937526098,
+		0.06409129365410768,
+		0.08011411706763459,
+		0.104148352187925,
+		0.1281825873082154,
+		0.1602282341352692,
+		0.20829670437585,
+		0.2803994097367211,
+		0.400570585338173,
+		0.6409129365410767,
+		0.8011411706763459,
+		0.8011411706763459,
+		0.001649232797688697,
+		0.003298465595377395,
+		0.00494769839306609,
+		0.006596931190754789,
+		0.008246163988443484,
+		0.01236924598266523,
+		0.02061540997110871,
+		0.0288615739595522,
+		0.04123081994221742,
+		0.05195083312719396,
+		0.06596931190754787,
+		0.08246163988443485,
+		0.1072001318497653,
+		0.1319386238150957,
+		0.1649232797688697,
+		0.2144002636995306,
+		0.2886157395955219,
+		0.4123081994221742,
+		0.6596931190754788,
+		0.8246163988443485,
+		0.8246163988443485,
+		0.00169755900740678,
+		0.003395118014813559,
+		0.005092677022220339,
+		0.006790236029627118,
+		0.008487795037033896,
+		0.01273169255555085,
+		0.02121948759258474,
+		0.02970728262961864,
+		0.04243897518516949,
+		0.05347310873331355,
+		0.06790236029627117,
+		0.08487795037033898,
+		0.1103413354814407,
+		0.1358047205925423,
+		0.169755900740678,
+		0.2206826709628814,
+		0.2970728262961864,
+		0.4243897518516949,
+		0.6790236029627118,
+		0.8487795037033897,
+		0.8487795037033897,
+		0.001747301283158105,
+		0.003494602566316209,
+		0.005241903849474313,
+		0.006989205132632418,
+		0.008736506415790522,
+		0.01310475962368578,
+		0.02184126603947631,
+		0.03057777245526683,
+		0.04368253207895261,
+		0.05503999041948029,
+		0.06989205132632417,
+		0.08736506415790522,
+		0.1135745834052768,
+		0.1397841026526483,
+		0.1747301283158104,
+		0.2271491668105536,
+		0.3057777245526683,
+		0.4368253207895261,
+		0.6989205132632418,
+		0.8736506415790523,
+		0.8736506415790523
+	},
+	.c_bpre4800022 = {
+		{ 0.001308140576202039, 0.9986918594237979, -1.998685010018692 },
+		{ 0.002614569920637108, 0.997385430079363, -1.997358050414093 },
+		{ 0.003919290271836576, 0.9960807097281631, -1.996019145897885 },
+		{ 0.005222303865404294, 0.9947776961345957, -1.994668321207849 },
+		{ 0.006523612934019088, 0.9934763870659811, -1.993305601107747 },
+		{ 0.009769442934496907, 0.9902305570655034, -1.989846921182752 },
+		{ 0.01622932380422996, 0.9837706761957699, -1.982708540531767 },
+		{ 0.02264706291156888, 0.977352937088431, -1.975278063791437 },
+		{ 0.0321952566573174, 0.9678047433426826, -1.96359152233569 },
+		{ 0.0403948714633683, 0.9596051285366316, -1.952945487964958 },
+		{ 0.05101271384588681, 0.9489872861541132, -1.938310529875129 },
+		{ 0.06335397876340393, 0.936646021236596, -1.920077746055618 },
+		{ 0.08156560308814979, 0.9184343969118502, -1.890724643781505 },
+		{ 0.09942313071785158, 0.9005768692821483, -1.85904470469991 },
+		{ 0.1226942309016544, 0.8773057690983458, -1.813338126214828 },
+		{ 0.1564782585691656, 0.8435217414308342, -1.737780083204439 },
+		{ 0.2047306878917468, 0.7952693121082532, -1.610128109741939 },
+		{ 0.2790959537047832, 0.7209040462952165, -1.3652849734476 },
+		{ 0.4076151528116109, 0.592384847188389, -0.7961924235778532 },
+		{ 0.4802973560351845, 0.5197026439648156, -0.3933279871543974 },
+		{ 0.7398789079381607, 0.2700908381440199, 1.039405287929631 },
+		{ 0.00134644328012339, 0.9986535567199275, -1.998646300198849 },
+		{ 0.002691080178012048, 0.9973089198219895, -1.997279913177347 },
+		{ 0.004033900071270594, 0.995966099928739, -1.995900879159809 },
+		{ 0.005374918443499284, 0.9946250815565034, -1.994509211727385 },
+		{ 0.00671411169892103, 0.9932858883013322, -1.993104965112384 },
+		{ 0.01005424384791521, 0.9899457561524646, -1.98953936879797 },
+		{ 0.01670091458713412, 0.9832990854132578, -1.982174061501757 },
+		{ 0.02330289447947277, 0.9766971055205951, -1.974499603142827 },
+		{ 0.03312284534350517, 0.9668771546565089, -1.962415603388802 },
+		{ 0.04155357027253479, 0.9584464297275972, -1.951395204812653 },
+		{ 0.05246760522328715, 0.9475323947767403, -1.936229818043813 },
+		{ 0.06514844543402179, 0.9348515545684409, -1.91731590875993 },
+		{ 0.08385239431142487, 0.9161476056917469, -1.886829475701175 },
+		{ 0.1021821258043835, 0.8978178741994839, -1.853889701083562 },
+		{ 0.1260525709257454, 0.8739474290790309, -1.806320600553937 },
+		{ 0.1606741139261265, 0.8393258860770326, -1.727615399458557 },
+		{ 0.210051085362849, 0.7899489146377676, -1.594583759853708 },
+		{ 0.2859757058674841, 0.7140242941326391, -1.339567005508098 },
+		{ 0.4166345987782409, 0.5833654012219879, -0.7492395787390707 },
+		{ 0.4901686400410659, 0.5098313599788664, -0.3345651108605218 },
+		{ 0.4901686400410659, 0.5098313599788664, -0.3345651108605218 },
+		{ 0.001385875228750349, 0.9986141247712854, -1.998606436845897 },
+		{ 0.002769823280430545, 0.9972301767195765, -1.997199446516288 },
+		{ 0.004151859879667926, 0.9958481401203343, -1.995779045121037 },
+		{ 0.00553197463985578, 0.994468025360158, -1.994345275489733 },
+		{ 0.006910163743135805, 0.9930898362573357, -1.992898174127832 },
+		{ 0.0103473185522944, 0.9896526814484117, -1.989222193970147 },
+		{ 0.01718604495388928, 0.9828139550462114, -1.981622334030035 },
+		{ 0.02397745031174256, 0.9760225496882667, -1.973695201012532 },
+		{ 0.03407672976662275, 0.9659232702335765, -1.961198809733188 },
+		{ 0.04274482807925972, 0.9572551719207887, -1.949789454991341 },
+		{ 0.05396274280561603, 0.94603725719452, -1.934072495845795 },
+		{ 0.06699199176495559, 0.9330080082396199, -1.914449038117404 },
+		{ 0.08620047915328576, 0.9137995208482035, -1.882780782338724 },
+		{ 0.1050135080001345, 0.8949864920001305, -1.848526207627336 },
+		{ 0.129496626307412, 0.8705033736959507, -1.799012120431442 },
+		{ 0.1649704357004552, 0.8350295643024064, -1.717025517767106 },
+		{ 0.2154899423807657, 0.7845100576193216, -1.578385286381233 },
+		{ 0.2929888082152131, 0.7070111917865342, -1.312804452044947 },
+		{ 0.425774594819782, 0.5742254051813456, -0.7007495584217788 },
+		{ 0.5001338660807175, 0.4998661339561809, -0.274371264583852 },
+		{ 0.5001338660807175, 0.4998661339561809, -0.274371264583852 },
+		{ 0.001426455895240981, 0.9985735441048086, -1.99856539919271 },
+		{ 0.002850870487636939, 0.9971491295123642, -1.997116573299605 },
+		{ 0.00427325974182389, 0.9957267402581863, -1.995653541086623 },
+		{ 0.005693613512736483, 0.9943063864872657, -1.994176348058254 },
+		{ 0.007111960716485446, 0.9928880392837605, -1.992684999053546 },
+		{ 0.0106489186606876, 0.9893510813393938, -1.988895064084697 },
+		{ 0.01768514468566958, 0.9823148553143392, -1.981052703664423 },
+		{ 0.02467132934775175, 0.9753286706523649, -1.972863820349207 },
+		{ 0.03505752502878588, 0.9649424749712309, -1.959939705916605 },
+		{ 0.04396939596236098, 0.9560306040376511, -1.948126203215348 },
+		{ 0.05549928892112468, 0.9445007110788957, -1.931835260769299 },
+		{ 0.06888614188130679, 0.9311138581210775, -1.911472258033789 },
+		{ 0.08861114623944402, 0.9113888537605569, -1.878572235625468 },
+		{ 0.1079182899998449, 0.8920817100017546, -1.842946283952823 },
+		{ 0.1330269832194987, 0.8669730167851177, -1.791402437806357 },
+		{ 0.1693703572410203, 0.830629642758982, -1.705988631883808 },
+		{ 0.2210494133091798, 0.7789505866918773, -1.561503969866092 },
+		{ 0.3001350621528272, 0.6998649378473201, -1.284964382263244 },
+		{ 0.4350332458509612, 0.5649667541492061, -0.6507092913186464 },
+		{ 0.5101897099517176, 0.4898102900674429, -0.2127924496177046 },
+		{ 0.5101897099517176, 0.4898102900674429, -0.2127924496177046 },
+		{ 0.001468217816248849, 0.9985317821837905, -1.998523153198054 },
+		{ 0.002934286494646915, 0.9970657135053568, -1.997031222803193 },
+		{ 0.004398196139148163, 0.9956018038608564, -1.995524257061292 },
+		{ 0.005859962952061176, 0.9941400370479462, -1.994002277542695 },
+		{ 0.007319564072293398, 0.9926804359279015, -1.992465346602733 },
+		{ 0.01095923052452219, 0.9890407694757699, -1.988557713302334 },
+		{ 0.01819864206551619, 0.9818013579349238, -1.980464505674146 },
+		{ 0.02538500001065952, 0.9746149999894459, -1.972004558088688 },
+		{ 0.03606603046781115, 0.9639339695321889, -1.958636577486015 },
+		{ 0.04522820456917449, 0.9547717954308317, -1.946403104557688 },
+		{ 0.05707826831374998, 0.9429217316863241, -1.929514900810176 },
+		{ 0.07083118075589943, 0.9291688192459892, -1.908382490155529 },
+		{ 0.09108565272928341, 0.908914347270867, -1.874197319634442 },
+		{ 0.1108986079138078, 0.8891013920863362, -1.837139482534981 },
+		{ 0.1366453053446676, 0.8633546946589855, -1.783478557553976 },
+		{ 0.1738747093254628, 0.826125290674826, -1.694487865638184 },
+		{ 0.2267304444984996, 0.7732695555024528, -1.543913705712731 },
+		{ 0.3074153641361957, 0.6925846358638089, -1.256008902179833 },
+		{ 0.4444074019617811, 0.5555925980388281, -0.5991163753419888 },
+		{ 0.5203258942889953, 0.4796741057261301, -0.1499286218729219 },
+		{ 0.5203258942889953, 0.4796741057261301, -0.1499286218729219 },
+		{ 0.001511213124224398, 0.9984887868758239, -1.998479644911151 },
+		{ 0.00302013595802807, 0.9969798640419725, -1.996943324034889 },
+		{ 0.004526785013117772, 0.9954732149868931, -1.995391062193872 },
+		{ 0.006031150694851306, 0.9939688493051503, -1.993822910989786 },
+		{ 0.007533229978230984, 0.9924667700220973, -1.992238915730397 },
+		{ 0.01127856944502141, 0.9887214305550061, -1.988209731333116 },
+		{ 0.0187268353655005, 0.9812731646345542, -1.979857212587438 },
+		{ 0.02611899178603367, 0.9738810082142181, -1.971116415679633 },
+		{ 0.03710297636819457, 0.9628970236319132, -1.957287751884411 },
+		{ 0.04652217534636493, 0.953477824653663, -1.944617753458106 },
+		{ 0.05870069186418361, 0.9412993081358301, -1.927108114698053 },
+		{ 0.07282920051761457, 0.9271707994855631, -1.905173635791604 },
+		{ 0.09362581649408343, 0.9063741835066589, -1.869648256771578 },
+		{ 0.113955380542079, 0.8860446194629006, -1.831097337220453 },
+		{ 0.1403548712223855, 0.8596451287820932, -1.775223328145982 },
+		{ 0.1784858394740597, 0.8215141605273626, -1.682501747698816 },
+		{ 0.2325343142257713, 0.7674656857764968, -1.525586432097565 },
+		{ 0.3148298366138123, 0.6851701633871259, -1.225902415510689 },
+		{ 0.4538934383291282, 0.5461065616709837, -0.5459758565057048 },
+		{ 0.5305412327097324, 0.4694587673156281, -0.08583614616651944 },
+		{ 0.5305412327097324, 0.4694587673156281, -0.08583614616651944 },
+		{ 0.001555454729262751, 0.9984445452707769, -1.998434859984515 },
+		{ 0.00310849654367364, 0.9968915034563288, -1.996852792349049 },
+		{ 0.004659116147249786, 0.9953408838527555, -1.995253851969447 },
+		{ 0.006207330336585323, 0.9937926696634198, -1.993638067024906 },
+		{ 0.007753149327562022, 0.9922468506728032, -1.992005472080438 },
+		{ 0.01160712068577102, 0.9883928793142421, -1.98785084482457 },
+		{ 0.01927027827310414, 0.9807297217269808, -1.979229990848019 },
+		{ 0.02687395856453869, 0.9731260414357598, -1.970198219067849 },
+		{ 0.03816921292148821, 0.9618307870786812, -1.955891351097543 },
+		{ 0.0478522201804451, 0.9521477798197139, -1.942767681522022 },
+		{ 0.06036780207733185, 0.939632197922719, -1.924611138758414 },
+		{ 0.07488165812884919, 0.9251183418746799, -1.901840397269782 },
+		{ 0.09623282350770188, 0.9037671764924801, -1.864918108698393 },
+		{ 0.1170912170549355, 0.8829087829455615, -1.824807647127904 },
+		{ 0.1441554933819691, 0.8558445066216932, -1.766626707522699 },
+		{ 0.1832048906951582, 0.8167951093051896, -1.670011097818363 },
+		{ 0.2384631084886365, 0.761536891514043, -1.506490459407893 },
+		{ 0.3223791786008725, 0.6776208214005921, -1.194606343653173 },
+		{ 0.4634886657929204, 0.5365113342074936, -0.4912929784588528 },
+		{ 0.5408306234841613, 0.4591693765439113, -0.02060873541089938 },
+		{ 0.5408306234841613, 0.4591693765439113, -0.02060873541089938 },
+		{ 0.001601001276094648, 0.9983989987239235, -1.998388737694005 },
+		{ 0.003199432823041382, 0.9968005671769773, -1.996759556159502 },
+		{ 0.004795311803067845, 0.9952046881969331, -1.995112487424263 },
+		{ 0.006388635778829572, 0.9936113642211721, -1.993447583502725 },
+		{ 0.007979382870366007, 0.9920206171301686, -1.991764917487923 },
+		{ 0.01194519833352312, 0.9880548016664796, -1.987480635083925 },
+		{ 0.01982926589264465, 0.9801707341076076, -1.978582291290896 },
+		{ 0.02765048709785108, 0.9723495129022303, -1.969248848473326 },
+		{ 0.03926539487893233, 0.9607346051211118, -1.954445701399986 },
+		{ 0.04921936548674114, 0.9507806345133064, -1.940850180010093 },
+		{ 0.06208064061513859, 0.9379193593848755, -1.922020382139831 },
+		{ 0.0769887768842069, 0.9230112231209597, -1.898379314307523 },
+		{ 0.09890841462597388, 0.9010915853740744, -1.859998642853983 },
+		{ 0.12030750559877, 0.8796924944059488, -1.818260179988584 },
+		{ 0.1480508395940387, 0.8519491604076459, -1.757669409204326 },
+		{ 0.1880339547681303, 0.8119660452319626, -1.656993429108932 },
+		{ 0.2445181941364372, 0.7554818058642918, -1.486595250933973 },
+		{ 0.3300624197827104, 0.669937580217667, -1.162088546726668 },
+		{ 0.4731887978232737, 0.5268112021768417, -0.4350882272635425 },
+		{ 0.5511824636530355, 0.4488175363879275, 0.04560323660121401 },
+		{ 0.5511824636530355, 0.4488175363879275, 0.04560323660121401 },
+		{ 0.001647872188578292, 0.9983521278114309, -1.998341256928443 },
+		{ 0.003293028894407177, 0.9967069711056115, -1.996663523489943 },
+		{ 0.004935481104918056, 0.9950645188950916, -1.994966842357327 },
+		{ 0.006575239757794758, 0.9934247602427224, -1.993251255969506 },
+		{ 0.008212250826220751, 0.9917877491738246, -1.991516875736275 },
+		{ 0.01229305111824534, 0.987706948881823, -1.987098749560013 },
+		{ 0.02040434832526456, 0.9795956516748487, -1.977913255819842 },
+		{ 0.02844903352509363, 0.9715509664750643, -1.968267317589758 },
+		{ 0.04039242202608263, 0.9596075779741008, -1.952948753113537 },
+		{ 0.05062444023346798, 0.9493755597665759, -1.938862732695615 },
+		{ 0.0638406008251642, 0.9361593991798595, -1.919331587956004 },
+		{ 0.07915317575656106, 0.9208468242438793, -1.894782808513153 },
+		{ 0.1016542875608475, 0.8983457124412617, -1.854881373728941 },
+		{ 0.1236050057315144, 0.8763949942717898, -1.81144560321486 },
+		{ 0.1520411262808107, 0.8479588737200378, -1.748339370515311 },
+		{ 0.1929744527448327, 0.8070255472584105, -1.643427172752604 },
+		{ 0.2506997433507905, 0.7493002566506215, -1.465873242146357 },
+		{ 0.3378800263229542, 0.6621199736786265, -1.128310585066056 },
+		{ 0.48299109870895, 0.5170089013318144, -0.3773801737750752 },
+		{ 0.5615965665909173, 0.4384034334125619, 0.1127056671745064 },
+		{ 0.5615965665909173, 0.4384034334125619, 0.1127056671745064 },
+		{ 0.001696119551054008, 0.9983038804489478, -1.998292363401204 },
+		{ 0.003389362280576161, 0.9966106377194274, -1.996564608696513 },
+		{ 0.005079733067999592, 0.9949202669320053, -1.994816789807909 },
+		{ 0.006767223783225238, 0.9932327762169108, -1.993048974439781 },
+		{ 0.008451878292919089, 0.9915481217070891, -1.991261175534208 },
+		{ 0.01265099174217066, 0.9873490082578413, -1.986704759995409 },
+		{ 0.02099594539260055, 0.9790040546074195, -1.97722216178339 },
+		{ 0.02927036851041609, 0.9707296314896114, -1.967252225205885 },
+		{ 0.04155106106227208, 0.9584489389377673, -1.951398574344826 },
+		{ 0.05206857326072321, 0.947931426739281, -1.936802311597005 },
+		{ 0.06564820053597095, 0.9343517994653484, -1.91654170386748 },
+		{ 0.08137563144914491, 0.9186243685509321, -1.891046109812851 },
+		{ 0.1044715092084383, 0.8955284907921567, -1.849558671459882 },
+		{ 0.1269867148384236, 0.8730132851641345, -1.804349508207978 },
+		{ 0.1561292695045493, 0.8438707304955987, -1.738617651772435 },
+		{ 0.1980287221806568, 0.8019712778204779, -1.629287335961449 },
+		{ 0.2570101746096487, 0.7429898253905977, -1.444288345566749 },
+		{ 0.3458312266507192, 0.6541687733496169, -1.093239100662774 },
+		{ 0.4928875611863874, 0.5071124388242795, -0.3182266965469441 },
+		{ 0.5720632159748635, 0.4279367840257424, 0.1805255437958342 },
+		{ 0.5720632159748635, 0.4279367840257424, 0.1805255437958342 },
+		{ 0.001745775831543726, 0.9982542241684563, -1.998242022591035 },
+		{ 0.003488503929833759, 0.9965114960701666, -1.996462732474573 },
+		{ 0.005228189615528074, 0.9947718103844722, -1.994662188456448 },
+		{ 0.006964825201371345, 0.993035174798802, -1.99284046315192 },
+		{ 0.008698454985342132, 0.9913015450146585, -1.990997574350656 },
+		{ 0.01301926753906038, 0.9869807324609409, -1.98629830420017 },
+		{ 0.02160447501177203, 0.9783955249882298, -1.976508273530819 },
+		{ 0.0301150044437427, 0.9698849955562602, -1.96620245708619 },
+		{ 0.04274219668300996, 0.9572578033169939, -1.949793015283825 },
+		{ 0.05355269492989, 0.9464473050701169, -1.934666074944017 },
+		{ 0.06750540904372425, 0.9324945909579567, -1.913645298583027 },
+		{ 0.08365749798873109, 0.916342502011277, -1.887163287192563 },
+		{ 0.1073622762555442, 0.8926377237453927, -1.844020434695685 },
+		{ 0.1304538378374095, 0.8695461621658472, -1.796960684071593 },
+		{ 0.1603164190077283, 0.8396835809922871, -1.728488763246233 },
+		{ 0.2031978941484288, 0.796802105853356, -1.614551337987681 },
+		{ 0.2634497062913738, 0.7365502937086515, -1.421810837055737 },
+		{ 0.3539157517869163, 0.6460842482131186, -1.056838584927624 },
+		{ 0.5028777367628576, 0.4971222632506864, -0.257649851033726 },
+		{ 0.5825751442109521, 0.4174248557891108, 0.2488857697063662 },
+		{ 0.5825751442109521, 0.4174248557891108, 0.2488857697063662 }
+	},
+	.c_bpre9600022 = {
+		{ 0.0006542843320947731, 0.9993457156679052, -1.999344002755713 },
+		{ 0.001308140576202039, 0.9986918594237979, -1.998685010018692 },
+		{ 0.001961569012413439, 0.9980384309875864, -1.998023024875438 },
+		{ 0.002614569920637108, 0.997385430079363, -1.997358050414093 },
+		{ 0.003267143580597968, 0.9967328564194023, -1.996690089724441 },
+		{ 0.004896710353390803, 0.9951032896466093, -1.995007143542836 },
+		{ 0.008147855678190834, 0.9918521443218089, -1.991585510829916 },
+		{ 0.01138837904441449, 0.9886116209555856, -1.988089880701676 },
+		{ 0.01622932380422996, 0.9837706761957699, -1.982708540531767 },
+		{ 0.0204056306120214, 0.9795943693879784, -1.977911760995221 },
+		{ 0.02584021528595585, 0.9741597847140442, -1.971454267340247 },
+		{ 0.0321952566573174, 0.9678047433426826, -1.96359152233569 },
+		{ 0.04165016986913888, 0.9583498301308613, -1.951265443823383 },
+		{ 0.05101271384588681, 0.9489872861541132, -1.938310529875129 },
+		{ 0.06335397876340393, 0.936646021236596, -1.920077746055618 },
+		{ 0.08156560308814979, 0.9184343969118502, -1.890724643781505 },
+		{ 0.1082212650504314, 0.8917787349495687, -1.842359759854594 },
+		{ 0.150939315304721, 0.8490606846952792, -1.750931273603519 },
+		{ 0.2303345875067601, 0.7696654124932398, -1.532575203407267 },
+		{ 0.2790959537047832, 0.7209040462952165, -1.3652849734476 },
+		{ 0.4802973560351845, 0.5197026439648156, -0.3933279871543974 },
+		{ 0.0006734484064395957, 0.9993265515935855, -1.999324736851631 },
+		{ 0.001346446548159318, 0.9986535534518413, -1.998646296895524 },
+		{ 0.00201898819229581, 0.9979810118077093, -1.997964690088847 },
+		{ 0.002691080178012048, 0.9973089198219895, -1.997279913177347 },
+		{ 0.003362709757918426, 0.9966372902422086, -1.996591982882329 },
+		{ 0.005039821825975901, 0.9949601781742143, -1.994858322723686 },
+		{ 0.008385616576248247, 0.9916143834239484, -1.991331928206249 },
+		{ 0.01172012793919217, 0.9882798720608423, -1.98772720050237 },
+		{ 0.01670088240836122, 0.9832991175916458, -1.982174098033462 },
+		{ 0.02099722690511907, 0.9790027730949477, -1.977220661606855 },
+		{ 0.02658724336655965, 0.9734127566334543, -1.970547482938858 },
+		{ 0.03312278206277887, 0.9668772179384728, -1.96241568385883 },
+		{ 0.04284400138292632, 0.9571559986186928, -1.949655229997292 },
+		{ 0.05246748119353407, 0.9475325188084488, -1.936229996206028 },
+		{ 0.06514844543402179, 0.9348515545684409, -1.91731590875993 },
+		{ 0.08385269411844924, 0.916147305883193, -1.886828961934364 },
+		{ 0.111209296494843, 0.888790703505481, -1.83652936180167 },
+		{ 0.1550004176731637, 0.8449995823269023, -1.74131861414131 },
+		{ 0.2362163911016441, 0.7637836088984811, -1.513771513608838 },
+		{ 0.2859752385504078, 0.7140247614605997, -1.339568770483282 },
+		{ 0.2859752385504078, 0.7140247614605997, -1.339568770483282 },
+		{ 0.0006931778621496687, 0.9993068221378685, -1.99930489948946 },
+		{ 0.00138587196076074, 0.9986141280392427, -1.998606440150124 },
+		{ 0.002078089167127073, 0.997921910832874, -1.997904619060063 },
+		{ 0.002769823280430545, 0.9972301767195765, -1.997199446516288 },
+		{ 0.003461071379112974, 0.996538928621123, -1.99649092959273 },
+		{ 0.005187112343377357, 0.9948128876569765, -1.994704983749436 },
+		{ 0.008630263198380965, 0.9913697368016694, -1.991070523616424 },
+		{ 0.01206146462026417, 0.9879385353797405, -1.987353103362405 },
+		{ 0.01718604495388928, 0.9828139550462114, -1.981622334030035 },
+		{ 0.02160581976345519, 0.9783941802365693, -1.976506692567172 },
+		{ 0.02735553402366706, 0.9726444659764018, -1.969610044717238 },
+		{ 0.03407660332968098, 0.965923396672645, -1.961198971528126 },
+		{ 0.0440713829753031, 0.9559286170254575, -1.947987103812585 },
+		{ 0.05396274280561603, 0.94603725719452, -1.934072495845795 },
+		{ 0.0669922970882225, 0.9330077029135132, -1.914448560830551 },
+		{ 0.08620047915328576, 0.9137995208482035, -1.882780782338724 },
+		{ 0.1142742763026246, 0.8857257236974215, -1.830461941487138 },
+		{ 0.1591604244655455, 0.8408395755353897, -1.731302577977447 },
+		{ 0.2422233804211103, 0.7577766195795075, -1.494182130077109 },
+		{ 0.2929878827577707, 0.7070121172626258, -1.312808020234979 },
+		{ 0.2929878827577707, 0.7070121172626258, -1.312808020234979 },
+		{ 0.0007134824762420159, 0.9992865175237824, -1.999284480568314 },
+		{ 0.001426452627367689, 0.9985735473726328, -1.998565402497865 },
+		{ 0.002138917354637106, 0.9978610826453681, -1.997842763197659 },
+		{ 0.002850870487636939, 0.9971491295123642, -1.997116573299605 },
+		{ 0.003562325439510939, 0.9964376745606123, -1.9963868234441 },
+		{ 0.005338710243877914, 0.9946612897561632, -1.994546977853306 },
+		{ 0.008882017459914003, 0.9911179825400902, -1.990801018148108 },
+		{ 0.0124127022626055, 0.9875872977374531, -1.986967164286591 },
+		{ 0.01768514468566958, 0.9823148553143392, -1.981052703664423 },
+		{ 0.02223182500265507, 0.9777681749973512, -1.975769103883473 },
+		{ 0.02814573567901824, 0.9718542643209919, -1.968640741562509 },
+		{ 0.03505758818531696, 0.9649424118158956, -1.959939624579515 },
+		{ 0.04533311895690226, 0.9546668810430984, -1.946258882995516 },
+		{ 0.05549922710449642, 0.9445007728963248, -1.931835351188466 },
+		{ 0.06888614188130679, 0.9311138581210775, -1.911472258033789 },
+		{ 0.08861114623944402, 0.9113888537605569, -1.878572235625468 },
+		{ 0.1174182266266238, 0.8825817733739335, -1.824146412112662 },
+		{ 0.1634206924342509, 0.8365793075658281, -1.720866705332756 },
+		{ 0.2483572962177654, 0.7516427037823263, -1.473774710307364 },
+		{ 0.3001355202236615, 0.6998644797869391, -1.284962579276429 },
+		{ 0.3001355202236615, 0.6998644797869391, -1.284962579276429 },
+		{ 0.000734378564062191, 0.9992656214359575, -1.999263463396241 },
+		{ 0.001468221083899164, 0.998531778916103, -1.998523149891943 },
+		{ 0.002201521417850886, 0.9977984785821515, -1.997779070447923 },
+		{ 0.002934286494646915, 0.9970657135053568, -1.997031222803193 },
+		{ 0.003666503660693397, 0.9963334963394043, -1.99627962470368 },
+		{ 0.005494711187779167, 0.9945052888123672, -1.994384189315899 },
+		{ 0.009141100895548182, 0.9908588991046727, -1.990523130251636 },
+		{ 0.01277408867608158, 0.9872259113239715, -1.986569024372678 },
+		{ 0.01819860993570171, 0.9818013900642985, -1.980464542545276 },
+		{ 0.02287575230637814, 0.9771242476936246, -1.97500701773698 },
+		{ 0.02895842947572499, 0.9710415705243127, -1.967638415751427 },
+		{ 0.03606596737943885, 0.9639340326215218, -1.958636659274341 },
+		{ 0.04663000505012733, 0.9533699949499497, -1.944468328831466 },
+		{ 0.05707826831374998, 0.9429217316863241, -1.929514900810176 },
+		{ 0.07083118075589943, 0.9291688192459892, -1.908382490155529 },
+		{ 0.09108565272928341, 0.908914347270867, -1.874197319634442 },
+		{ 0.1206425325832678, 0.8793574674172346, -1.817572527475153 },
+		{ 0.1677832999369664, 0.8322167000630359, -1.709992072432989 },
+		{ 0.2546191590614035, 0.7453808409389311, -1.45251819980822 },
+		{ 0.307414910848833, 0.6925850891595415, -1.256010723742897 },
+		{ 0.307414910848833, 0.6925850891595415, -1.256010723742897 },
+		{ 0.0007558922486576448, 0.9992441077513662, -1.999241821395098 },
+		{ 0.001511209856629727, 0.9984887901433708, -1.998479648218246 },
+		{ 0.002265959793451134, 0.9977340402065538, -1.997713478633179 },
+		{ 0.00302013595802807, 0.9969798640419725, -1.996943324034889 },
+		{ 0.003773735529036803, 0.9962262644711277, -1.996169192600407 },
+		{ 0.005655275794667299, 0.9943447242053463, -1.994216433554368 },
+		{ 0.009407669808361559, 0.9905923301916658, -1.990236645375695 },
+		{ 0.01314590327953358, 0.9868540967205932, -1.986158284261889 },
+		{ 0.0187268353655005, 0.9812731646345542, -1.979857212587438 },
+		{ 0.02353810895988601, 0.9764618910401281, -1.974219539964769 },
+		{ 0.02979419289729217, 0.9702058071027145, -1.966601884849222 },
+		{ 0.03710291334823947, 0.9628970866533783, -1.95728783413677 },
+		{ 0.04796313962854602, 0.9520368603718338, -1.942612708827689 },
+		{ 0.05870056865093095, 0.9412994313516293, -1.927108298353245 },
+		{ 0.07282950393263952, 0.9271704960696781, -1.905173145806581 },
+		{ 0.09362581649408343, 0.9063741835066589, -1.869648256771578 },
+		{ 0.1239488109851136, 0.8760511890160851, -1.81072914907863 },
+		{ 0.1722499390599292, 0.8277500609405751, -1.698659942101946 },
+		{ 0.2610097688934631, 0.7389902311065983, -1.430381312904644 },
+		{ 0.3148293881839551, 0.685170611830096, -1.225904255298235 },
+		{ 0.3148293881839551, 0.685170611830096, -1.225904255298235 },
+		{ 0.0007780300299953333, 0.9992219699700244, -1.999219547705061 },
+		{ 0.00155545799662654, 0.9984445420033748, -1.998434856676407 },
+		{ 0.002332277833571373, 0.9976677221664314, -1.997645938704088 },
+		{ 0.00310849654367364, 0.9968915034563288, -1.996852792349049 },
+		{ 0.003884117849515017, 0.9961158821506678, -1.996055419394886 },
+		{ 0.005820499449808374, 0.9941795005501983, -1.994043592939361 },
+		{ 0.00968200979337178, 0.9903179902066711, -1.989941206857639 },
+		{ 0.01352848929355131, 0.986471510706599, -1.985734467714217 },
+		{ 0.01927027827310414, 0.9807297217269808, -1.979229990848019 },
+		{ 0.02421939975240472, 0.9757806002476755, -1.973405759411478 },
+		{ 0.03065372651323959, 0.969346273486786, -1.965529782067068 },
+		{ 0.03816927587479213, 0.9618307241270058, -1.955891268368397 },
+		{ 0.04933329894631142, 0.9506667010537818, -1.940689656568868 },
+		{ 0.0603677405787511, 0.9396322594215046, -1.924611231317178 },
+		{ 0.07488135538289838, 0.9251186446189987, -1.90184089170158 },
+		{ 0.09623282350770188, 0.9037671764924801, -1.864918108698393 },
+		{ 0.1273391887385059, 0.8726608112629117, -1.803603602913736 },
+		{ 0.1768227278409018, 0.8231772721598865, -1.686849704109659 },
+		{ 0.2675306598859175, 0.7324693401143106, -1.407329193724168 },
+		{ 0.3223796221166166, 0.6776203778989468, -1.19460448600915 },
+		{ 0.3223796221166166, 0.6776203778989468, -1.19460448600915 },
+		{ 0.0008008212954207471, 0.9991991787045881, -1.999196612418305 },
+		{ 0.001600998008832883, 0.9983990019911765, -1.998388741003156 },
+		{ 0.002400537190936803, 0.997599462809064, -1.997576384816246 },
+		{ 0.003199436085046064, 0.9968005639149548, -1.996759552813787 },
+		{ 0.003997682166535424, 0.9960023178337328, -1.995938264120685 },
+		{ 0.005990542466281828, 0.9940094575337197, -1.993865480751785 },
+		{ 0.009964276347890306, 0.9900357236522365, -1.989636594561454 },
+		{ 0.01392215677353873, 0.9860778432265022, -1.985297128210411 },
+		{ 0.0198292979684259, 0.9801707020315958, -1.978582254050492 },
+		{ 0.02492019069552108, 0.9750798093045031, -1.972564670488857 },
+		{ 0.03153763140488434, 0.9684623685951228, -1.96442083051048 },
+		{ 0.0392652691216477, 0.9607347308809856, -1.954445867836379 },
+		{ 0.05074156028296116, 0.9492584397170635, -1.938696301382564 },
+		{ 0.06208076339090333, 0.9379192366115268, -1.922020195519442 },
+		{ 0.07698907893458111, 0.9230109210662926, -1.898378815317162 },
+		{ 0.09890841462597388, 0.9010915853740744, -1.859998642853983 },
+		{ 0.1308154362486524, 0.8691845637517338, -1.796183439968734 },
+		{ 0.181502852651682, 0.8184971473485212, -1.674542348004932 },
+		{ 0.2741823905575524, 0.7258176094425112, -1.383329376571612 },
+		{ 0.3300615428582371, 0.6699384571644829, -1.162092296626625 },
+		{ 0.3300615428582371, 0.6699384571644829, -1.162092296626625 },
+		{ 0.0008242758095945148, 0.99917572419041, -1.999173005347739 },
+		{ 0.001647872188578292, 0.9983521278114309, -1.998341256928443 },
+		{ 0.002470792961387758, 0.9975292070386166, -1.997504757587326 },
+		{ 0.003293041941511302, 0.9967069580587478, -1.99666351009852 },
+		{ 0.004114590339943719, 0.9958854096600794, -1.995817550831644 },
+		{ 0.006165532454345486, 0.9938344675456887, -1.993681943156212 },
+		{ 0.0102547541540114, 0.9897452458460455, -1.98932244550702 },
+		{ 0.01432715038157412, 0.9856728496185053, -1.984845885141864 },
+		{ 0.02040438038243629, 0.9795956196176564, -1.97791321844934 },
+		{ 0.02564094925611077, 0.9743590507439113, -1.971695363638563 },
+		{ 0.03244669440132623, 0.9675533056012261, -1.963273484317806 },
+		{ 0.04039235921995252, 0.9596076407802717, -1.952948836834598 },
+		{ 0.05218898907049382, 0.9478110109305871, -1.936629695184268 },
+		{ 0.0638402944643469, 0.9361597055373563, -1.919332058360661 },
+		{ 0.07915317575656106, 0.9208468242438793, -1.894782808513153 },
+		{ 0.1016539935774421, 0.8983460064242567, -1.854881925331212 },
+		{ 0.1343786875028289, 0.8656213124979197, -1.788457084659328 },
+		{ 0.1862924519968875, 0.8137075480039662, -1.661715565610331 },
+		{ 0.2809666897149593, 0.7190333103075366, -1.358344160591059 },
+		{ 0.3378795929666525, 0.6621204070352776, -1.128312476827489 },
+		{ 0.3378795929666525, 0.6621204070352776, -1.128312476827489 },
+		{ 0.0008484196835064549, 0.9991515803164943, -1.999148699831072 },
+		{ 0.001696119551054008, 0.9983038804489478, -1.998292363401204 },
+		{ 0.002543100213347444, 0.9974568997866551, -1.997430997443704 },
+		{ 0.003389355757839325, 0.9966106442422289, -1.996564615396631 },
+		{ 0.004234906362408874, 0.9957650936375954, -1.995693203902194 },
+		{ 0.006345629377181176, 0.9936543706228245, -1.993492790999715 },
+		{ 0.01055366259336715, 0.9894463374066426, -1.988998463232111 },
+		{ 0.01474387518291279, 0.9852561248171011, -1.984380171899598 },
+		{ 0.02099594539260055, 0.9790040546074195, -1.97722216178339 },
+		{ 0.02638229949364772, 0.9736177005063544, -1.970796717297665 },
+		{ 0.03338125433858265, 0.9666187456620882, -1.962086727201166 },
+		{ 0.04155106106227208, 0.9584489389377673, -1.951398574344826 },
+		{ 0.05367632873758277, 0.9463236712627223, -1.934487257746386 },
+		{ 0.06564820053597095, 0.9343517994653484, -1.91654170386748 },
+		{ 0.08137563144914491, 0.9186243685509321, -1.891046109812851 },
+		{ 0.1044715092084383, 0.8955284907921567, -1.849558671459882 },
+		{ 0.1380314243602772, 0.8619685756398534, -1.780409518695889 },
+		{ 0.1911929937560364, 0.8088070062441453, -1.648347956106805 },
+		{ 0.287881724138548, 0.7121182758673446, -1.332348142440785 },
+		{ 0.3458312266507192, 0.6541687733496169, -1.093239100662774 },
+		{ 0.3458312266507192, 0.6541687733496169, -1.093239100662774 },
+		{ 0.0008732692153327811, 0.999126730784667, -1.999123679056075 },
+		{ 0.001745775831543726, 0.9982542241684563, -1.998242022591035 },
+		{ 0.002617520514586711, 0.9973824794854137, -1.997355037947819 },
+		{ 0.003488497407767561, 0.9965115025923189, -1.996462739179223 },
+		{ 0.004358726742077359, 0.995641273257923, -1.995565113524622 },
+		{ 0.006530960492004332, 0.9934690395079964, -1.99329786799184 },
+		{ 0.01086122056193354, 0.9891387794380675, -1.988664347916158 },
+		{ 0.01517260621149585, 0.9848273937885057, -1.983899558909327 },
+		{ 0.02160447501177203, 0.9783955249882298, -1.976508273530819 },
+		{ 0.02714476664299597, 0.9728552333570073, -1.96986770408145 },
+		{ 0.03434240490932543, 0.9656575950915295, -1.960858546816853 },
+		{ 0.04274219668300996, 0.9572578033169939, -1.949793015283825 },
+		{ 0.05520493029203208, 0.944795069708449, -1.932265436386056 },
+		{ 0.06750540904372425, 0.9324945909579567, -1.913645298583027 },
+		{ 0.08365749798873109, 0.916342502011277, -1.887163287192563 },
+		{ 0.1073622762555442, 0.8926377237453927, -1.844020434695685 },
+		{ 0.1417749166397963, 0.8582250833602172, -1.772027798386187 },
+		{ 0.1962063397779948, 0.8037936602220241, -1.634416177588925 },
+		{ 0.2949310223530425, 0.7050689776544464, -1.305295025177927 },
+		{ 0.3539157517869163, 0.6460842482131186, -1.056838584927624 },
+		{ 0.3539157517869163, 0.6460842482131186, -1.056838584927624 }
+	},
+	.c_bpre4800080040 = {
+		{ 6.544973985505914e-05, 0.9999967275130072, -1.999989873636191 },
+		{ 0.0001308992655307203, 0.9999934550367233, -1.999966039621294 },
+		{ 0.0001963485770216042, 0.999990182571149, -1.999928498163521 },
+		{ 0.0002617976743329386, 0.9999869101162835, -1.999877249565034 },
+		{ 0.0003272465574614608, 0.9999836376721271, -1.999812294221941 },
+		{ 0.0004908678282452066, 0.9999754566085878, -1.99958994230369 },
+		{ 0.0008181063539619711, 0.9999590946823018, -1.998888291536252 },
+		{ 0.001145339525295149, 0.999942733023735, -1.997844155832761 },
+		{ 0.001636179243036451, 0.9999181910378485, -1.995636212674323 },
+		{ 0.002061563920467126, 0.9998969218039766, -1.993100351165815 },
+		{ 0.002617822538175064, 0.9998691088730915, -1.988913616644928 },
+		{ 0.003272224631937593, 0.9998363887684031, -1.982727511232789 },
+		{ 0.004253787619847361, 0.9997873106190072, -1.970902500808017 },
+		{ 0.005235302426596641, 0.9997382348786703, -1.956039156542228 },
+		{ 0.006543913891171157, 0.9996728043054415, -1.93153560580651 },
+		{ 0.008506670504248266, 0.9995746664747874, -1.884882045155949 },
+		{ 0.01145044414781988, 0.9994274777926092, -1.793232003503657 },
+		{ 0.01635577030852028, 0.999182211484574, -1.586057885332092 },
+		{ 0.02616281152404031, 0.9986918594237979, -0.9993459297119817 },
+		{ 0.03269816505592801, 0.9983650917472036, -0.5172149448122223 },
+		{ 0.0653428716119502, 0.9967328564194025, 1.729221378230289 },
+		{ 6.736782116887341e-05, 0.9999966316292997, -1.999989370231912 },
+		{ 0.0001347349396295081, 0.9999932632535832, -1.999964217624587 },
+		{ 0.0002021019678326621, 0.9999898949055743, -1.999924542653948 },
+		{ 0.0002694689715763089, 0.9999865265525497, -1.999870345271558 },
+		{ 0.0003368368366393144, 0.9999831582599573, -1.999801627184588 },
+		{ 0.0005052531276181065, 0.9999747374963031, -1.999566302020044 },
+		{ 0.000842082801273217, 0.999957896018107, -1.998823422417203 },
+		{ 0.001178900805004449, 0.9999410549871688, -1.997717712214201 },
+		{ 0.001684120662543777, 0.9999157939725701, -1.995379299751387 },
+		{ 0.002121968891961618, 0.9998939016094497, -1.992693448488951 },
+		{ 0.002694526341304881, 0.9998652736942238, -1.98825898115044 },
+		{ 0.003368113096627194, 0.9998315953629895, -1.981707032551292 },
+		{ 0.004378436416133465, 0.9997810795023273, -1.969183310588708 },
+		{ 0.005388708689674243, 0.9997305661939473, -1.953443453142391 },
+		{ 0.006735658987405523, 0.9996632190861007, -1.927499571625549 },
+		{ 0.008755921497621312, 0.9995622052953095, -1.878119850430429 },
+		{ 0.01178588147703538, 0.9994107062002668, -1.781183706034937 },
+		{ 0.01683482646818588, 0.9991582587335406, -1.562408684277204 },
+		{ 0.02692893321964946, 0.9986535534518415, -0.9457515904472396 },
+		{ 0.03365561816184943, 0.9983172292624267, -0.4428092057234024 },
+		{ 0.03365561816184943, 0.9983172292624267, -0.4428092057234024 },
+		{ 6.934198904880023e-05, 0.9999965329149055, -1.999988839671907 },
+		{ 0.0001386828919857598, 0.999993065858194, -1.99996229314396 },
+		{ 0.0002080240707363283, 0.9999895987971407, -1.999920360423167 },
+		{ 0.000277364822334353, 0.9999861317644699, -1.999863042281258 },
+		{ 0.0003467082547332299, 0.9999826647765445, -1.999790339809779 },
+		{ 0.0005200601282567604, 0.999973997277508, -1.999541276647057 },
+		{ 0.000866753986714568, 0.9999566623411977, -1.998754738991741 },
+		{ 0.001213442697659372, 0.9999393278690102, -1.997583810141231 },
+		{ 0.001733470410335167, 0.9999133265605485, -1.995107181957292 },
+		{ 0.002184145410266572, 0.9998907927491842, -1.992262447318105 },
+		{ 0.002773475134508282, 0.9998613262991386, -1.987565640071958 },
+		{ 0.003466812098001588, 0.9998266612877672, -1.980626159739642 },
+		{ 0.004506708317312916, 0.9997746652061893, -1.967362447134434 },
+		{ 0.005546565660948484, 0.9997226718286726, -1.950694520760639 },
+		{ 0.006933008987064711, 0.9996533509861649, -1.923225943177121 },
+		{ 0.00901240111642871, 0.9995493811881481, -1.870965666349816 },
+		{ 0.01213111451561107, 0.9993934443131418, -1.768447973005041 },
+		{ 0.0173279446028924, 0.9991336035801937, -1.537465898096877 },
+		{ 0.02771745038095746, 0.9986141280392423, -0.8896616476034382 },
+		{ 0.03464109150346521, 0.998267964336792, -0.3655441615390128 },
+		{ 0.03464109150346521, 0.998267964336792, -0.3655441615390128 },
+		{ 7.137398017752052e-05, 0.9999964313207378, -1.999988280609858 },
+		{ 0.0001427465968483634, 0.9999928626705736, -1.999960260101145 },
+		{ 0.0002141197475048081, 0.999989294016782, -1.999915938503472 },
+		{ 0.0002854921748597306, 0.9999857253920887, -1.999855316642691 },
+		{ 0.0003568673537604555, 0.9999821567310437, -1.999778393735065 },
+		{ 0.0005352946993328458, 0.9999732352977693, -1.999514783135767 },
+		{ 0.0008921499409772937, 0.9999553925063828, -1.99868200902159 },
+		{ 0.00124900027838708, 0.9999375500333698, -1.997441992332253 },
+		{ 0.00178426008536921, 0.9999107870025943, -1.994818988171283 },
+		{ 0.002248141430157949, 0.9998875929335193, -1.991805964199397 },
+		{ 0.002854738367595224, 0.9998572630899369, -1.986831249446675 },
+		{ 0.003568387005592339, 0.9998215816369567, -1.979481146717088 },
+		{ 0.004638743477752682, 0.9997680628265191, -1.965434062842947 },
+		{ 0.005709075891276044, 0.9997145468808555, -1.947784006185624 },
+		{ 0.007136137345423286, 0.9996431951070255, -1.918702446290214 },
+		{ 0.009276411058465758, 0.99953617944789, -1.863394927898947 },
+		{ 0.01248649336715698, 0.9993756758044027, -1.754985820507084 },
+		{ 0.01783543949394741, 0.9991082280939014, -1.511168806521345 },
+		{ 0.02852905420961843, 0.998573547372633, -0.8310019194557351 },
+		{ 0.03565523372309126, 0.9982172481782771, -0.2854091866325083 },
+		{ 0.03565523372309126, 0.9982172481782771, -0.2854091866325083 },
+		{ 7.346501342475782e-05, 0.9999963267649858, -1.999987691455841 },
+		{ 0.0001469294884088975, 0.9999926535271023, -1.999958112274665 },
+		{ 0.0002203936511465715, 0.9999889803190736, -1.999911263038858 },
+		{ 0.0002938578974043437, 0.9999853071081753, -1.999847143799037 },
+		{ 0.0003673223685637926, 0.999981633959856, -1.999765756545571 },
+		{ 0.0005509810229822468, 0.9999724510662762, -1.999486740037111 },
+		{ 0.0009182961839964028, 0.9999540853684799, -1.998604987927545 },
+		{ 0.001285597422336339, 0.9999357201716059, -1.997291804267703 },
+		{ 0.001836539829899176, 0.9999081730087226, -1.994513746407149 },
+		{ 0.00231401240780966, 0.9998842993820316, -1.991322474660341 },
+		{ 0.002938384688666884, 0.9998530807960196, -1.986053403951267 },
+		{ 0.003672920118900577, 0.9998163547768306, -1.978268815516585 },
+		{ 0.00477465207139657, 0.9997612674594765, -1.963392025809157 },
+		{ 0.005876337672184288, 0.999706183177292, -1.944701961457518 },
+		{ 0.007345165723559406, 0.9996327432792291, -1.913914796168875 },
+		{ 0.009548164277980381, 0.9995225919121787, -1.855385710037845 },
+		{ 0.01285225615158615, 0.9993573876195246, -1.740759189021027 },
+		{ 0.0183578111803385, 0.9990821094431592, -1.483450146274367 },
+		{ 0.0293644277644836, 0.9985317789161028, -0.7697086736888269 },
+		{ 0.0366988629085328, 0.9981650646758801, -0.2024649436095281 },
+		{ 0.0366988629085328, 0.9981650646758801, -0.2024649436095281 },
+		{ 7.561804960107254e-05, 0.9999962191167516, -1.999987070256422 },
+		{ 0.0001512347224150555, 0.9999924382641602, -1.999955843134097 },
+		{ 0.0002268518980769874, 0.9999886574095018, -1.999906318717616 },
+		{ 0.0003024683012356823, 0.9999848765855004, -1.999838497957894 },
+		{ 0.000378086466507654, 0.9999810958085181, -1.999752382194401 },
+		{ 0.0005671249206849047, 0.9999716437649808, -1.999457049856437 },
+		{ 0.0009451982491462286, 0.9999527401095507, -1.998523438372118 },
+		{ 0.001323265811567681, 0.9999338368114788, -1.997132755017972 },
+		{ 0.00189035182832901, 0.9999054824525986, -1.994190453500422 },
+		{ 0.002381813940730076, 0.9998809093143611, -1.990810375205341 },
+		{ 0.003024477174736076, 0.9998487761468837, -1.985229577186248 },
+		{ 0.003780543047467007, 0.9998109741659511, -1.976984679077028 },
+		{ 0.004914554912252795, 0.9997542725656208, -1.961229396631628 },
+		{ 0.006048525849549628, 0.9996975758167218, -1.941439173036763 },
+		{ 0.007560389914541224, 0.9996219824270407, -1.90884569090159 },
+		{ 0.009827902183539046, 0.9995086055132141, -1.846912198776734 },
+		{ 0.01322871899381433, 0.9993385650705737, -1.725727301298933 },
+		{ 0.01889548009563251, 0.9990552264351803, -1.454242832030522 },
+		{ 0.03022419825590967, 0.9984887901433707, -0.7057253723465918 },
+		{ 0.03777328876617531, 0.9981113487337611, -0.1167165637144113 },
+		{ 0.03777328876617531, 0.9981113487337611, -0.1167165637144113 },
+		{ 7.783344891433439e-05, 0.9999961083433104, -1.999986415537534 },
+		{ 0.0001556663128091844, 0.9999922166854034, -1.999953445468677 },
+		{ 0.0002334988624033869, 0.9999883250590039, -1.999901090465688 },
+		{ 0.0003113314140250057, 0.9999844334313871, -1.999829350671225 },
+		{ 0.0003891672078642632, 0.9999805417861908, -1.999738226187715 },
+		{ 0.0005837420446059335, 0.9999708129030798, -1.999425622276893 },
+		{ 0.0009728955456822414, 0.9999513552571991, -1.998437070511009 },
+		{ 0.00136203934784753, 0.9999318981535433, -1.996964299924797 },
+		{ 0.001945743765124806, 0.9999027128807096, -1.993848014274645 },
+		{ 0.002451602297060282, 0.9998774199502113, -1.990267980041923 },
+		{ 0.003113096063044536, 0.9998443452177297, -1.984356986190748 },
+		{ 0.00389133133386526, 0.9998054348990169, -1.975624396714658 },
+		{ 0.005058536693025509, 0.9997470732416446, -1.958939399602986 },
+		{ 0.006225704395814532, 0.9996887149910181, -1.937984087198696 },
+		{ 0.007781845721877976, 0.9996109092892218, -1.903481689553494 },
+		{ 0.01011579394676041, 0.9994942104552342, -1.837949422249387 },
+		{ 0.01361622015370669, 0.9993191902013021, -1.709845135712823 },
+		{ 0.01944892154955854, 0.9990275546118781, -1.423474820634211 },
+		{ 0.03110916410598233, 0.998444542003375, -0.6389941613433251 },
+		{ 0.03887926073180774, 0.9980560516076578, -0.02821975918706655 },
+		{ 0.03887926073180774, 0.9980560516076578, -0.02821975918706655 },
+		{ 8.011419718104379e-05, 0.9999959942974024, -1.999985725067511 },
+		{ 0.0001602276047352296, 0.9999919886272129, -1.999950912063162 },
+		{ 0.0002403408749235334, 0.9999879829567065, -1.999895561142319 },
+		{ 0.0003204539667890205, 0.9999839773022456, -1.999819673055917 },
+		{ 0.0004005697107562565, 0.9999799717292789, -1.999723250408788 },
+		{ 0.0006008467719677413, 0.9999699576625333, -1.999392349884904 },
+		{ 0.001001402167446791, 0.9999499299935081, -1.998345620806773 },
+		{ 0.001401949420345342, 0.9999299025619891, -1.996785879928781 },
+		{ 0.00200275374859186, 0.9998998623304133, -1.993485339093145 },
+		{ 0.002523436746365462, 0.9998738281821464, -1.989693464633902 },
+		{ 0.003204308623536594, 0.9998397845746707, -1.983432802997205 },
+		{ 0.0040053361045808, 0.9997997353427467, -1.974184240156893 },
+		{ 0.005206741434302461, 0.9997396629486832, -1.956514398232751 },
+		{ 0.006408156825903176, 0.9996795941640354, -1.934325848311958 },
+		{ 0.008009831403346547, 0.9995995091558357, -1.89780311632339 },
+		{ 0.01041212736090372, 0.9994793936727469, -1.828469261696355 },
+		{ 0.01401507274215229, 0.9992992466928523, -1.69306725674565 },
+		{ 0.02001851509617783, 0.9989990744235373, -1.391078299446115 },
+		{ 0.03201999401766889, 0.9983990003575501, -0.569474390298456 },
+		{ 0.0400172845903119, 0.9979991572309734, 0.06288937424427384 },
+		{ 0.0400172845903119, 0.9979991572309734, 0.06288937424427384 },
+		{ 8.246147445669214e-05, 0.9999958769299416, -1.999984997105084 },
+		{ 0.0001649226089342681, 0.9999917538768825, -1.999948234785538 },
+		{ 0.0002473835866622167, 0.9999876308244608, -1.999889713255628 },
+		{ 0.0003298490236859698, 0.9999835077563148, -1.999809432620968 },
+		{ 0.0004123039723890961, 0.9999793848197035, -1.999707397359597 },
+		{ 0.0006184527711926255, 0.9999690773889253, -1.999357126096412 },
+		{ 0.001030743994062499, 0.9999484628461045, -1.998248769779354 },
+		{ 0.001443026717482693, 0.9999278487282555, -1.996596937702984 },
+		{ 0.002061437806917266, 0.9998969281846788, -1.99310119850209 },
+		{ 0.002597372488330096, 0.9998701313936167, -1.989084991121486 },
+		{ 0.003298245449839377, 0.9998350898023453, -1.982453851778209 },
+		{ 0.004122657257541742, 0.9997938673203383, -1.972658617305606 },
+		{ 0.005359314792201171, 0.9997320351481984, -1.953946365056684 },
+		{ 0.006595859417113115, 0.9996702084357705, -1.930453778661501 },
+		{ 0.008244464700697004, 0.9995877771313583, -1.891794284644109 },
+		{ 0.01071715385887993, 0.9994641437369278, -1.818443413677237 },
+		{ 0.01442558284662833, 0.9992787214987573, -1.675349426302968 },
+		{ 0.02060481927064939, 0.9989697597863696, -1.356977098472686 },
+		{ 0.03295798911433975, 0.9983521212772314, -0.4971219813523112 },
+		{ 0.0411883519413745, 0.9979405842333899, 0.1565480318162718 },
+		{ 0.0411883519413745, 0.9979405842333899, 0.1565480318162718 },
+		{ 8.487781222262453e-05, 0.9999957561100296, -1.99998422931131 },
+		{ 0.0001697552642343111, 0.9999915122380697, -1.999945405273894 },
+		{ 0.0002546323560347505, 0.99998726838412, -1.999883528433106 },
+		{ 0.0003395094727414407, 0.9999830245809054, -1.999798600343783 },
+		{ 0.000424385459013665, 0.9999787807302524, -1.999690619851419 },
+		{ 0.0006365748115841841, 0.9999681712642254, -1.999319832188429 },
+		{ 0.001060946762944127, 0.9999469526698603, -1.998146202886054 },
+		{ 0.001485309709440033, 0.9999257345257384, -1.996396810920563 },
+		{ 0.00212183724549909, 0.9998939081537399, -1.992694342763168 },
+		{ 0.002673477030703574, 0.9998663261501288, -1.988440491386253 },
+		{ 0.003394835389959559, 0.9998302587758845, -1.981417285449207 },
+		{ 0.00424344938135569, 0.99978782756296, -1.971042927291965 },
+		{ 0.005516306260989384, 0.9997241849377844, -1.951227441185643 },
+		{ 0.006789094536394872, 0.9996605463638522, -1.926353940997023 },
+		{ 0.008485998419712407, 0.9995757001430627, -1.885434564816909 },
+		{ 0.011031091041605, 0.9994484459495172, -1.807840153715187 },
+		{ 0.01484813425200649, 0.9992575933994674, -1.656638724934427 },
+		{ 0.02120824538690043, 0.9989395878907261, -1.321097914908667 },
+		{ 0.03392243467553466, 0.99830388371589, -0.4219417392298905 },
+		{ 0.04239400129357646, 0.9978803002552937, 0.252580108322387 },
+		{ 0.04239400129357646, 0.9978803002552937, 0.252580108322387 },
+		{ 8.736488422253174e-05, 0.9999956317558556, -1.999983419545192 },
+		{ 0.0001747293868158632, 0.9999912635307928, -1.999942414943968 },
+		{ 0.0002620935077670552, 0.9999868953248118, -1.999876986803775 },
+		{ 0.0003494579785756238, 0.9999825271706361, -1.99978713679492 },
+		{ 0.0004368206048028332, 0.9999781589700933, -1.999672863827568 },
+		{ 0.0006552273294716513, 0.9999672386340268, -1.999280350159511 },
+		{ 0.001092033623440129, 0.999945398319662, -1.998037589784965 },
+		{ 0.001528830377117489, 0.9999235584823121, -1.99618486538193 },
+		{ 0.002184007620023425, 0.9998907996206673, -1.992263413548702 },
+		{ 0.002751809896555597, 0.9998624095080836, -1.987757874643579 },
+		{ 0.003494305027686388, 0.9998252854442102, -1.980319258529398 },
+		{ 0.00436777674557408, 0.9997816111660578, -1.969331909632603 },
+		{ 0.005677925035200987, 0.9997161041437734, -1.948348230286346 },
+		{ 0.006987999549424169, 0.9996506014135967, -1.922013794221441 },
+		{ 0.008734599617471986, 0.9995632700257985, -1.878704946523718 },
+		{ 0.01135423813101616, 0.9994322888844043, -1.796628614084921 },
+		{ 0.01528304586787142, 0.9992358477182806, -1.636886190053994 },
+		{ 0.0218293470740838, 0.9989085326629704, -1.283363027976121 },
+		{ 0.03491559030515248, 0.9982542274352358, -0.3438930251466941 },
+		{ 0.04363486812885388, 0.9978182566268884, 0.3507971039905788 },
+		{ 0.04363486812885388, 0.9978182566268884, 0.3507971039905788 }
+	},
+	.c_bpre9600080040 = {
+		{ 3.272489670228179e-05, 0.9999983637551649, -1.999996650283825 },
+		{ 6.544973985505914e-05, 0.9999967275130072, -1.999989873636191 },
+		{ 9.817452946394225e-05, 0.9999950912735266, -1.999979670074317 },
+		{ 0.0001308992655307203, 0.9999934550367233, -1.999966039621294 },
+		{ 0.0001636239480564454, 0.9999918188025971, -1.999948982306083 },
+		{ 0.000245435420091438, 0.9999877282289955, -1.999891346739041 },
+		{ 0.0004090573601817421, 0.9999795471319911, -1.999711825688978 },
+		{ 0.0005726779616604306, 0.9999713661019173, -1.999446645458944 },
+		{ 0.0008181063539619711, 0.9999590946823018, -1.998888291536252 },
+		{ 0.001030808524387041, 0.9999484595737805, -1.998248550685797 },
+		{ 0.001308954103101908, 0.9999345522948448, -1.997193711497798 },
+		{ 0.001636179243036451, 0.9999181910378485, -1.995636212674323 },
+		{ 0.002127006913888707, 0.9998936496543057, -1.992658977396362 },
+		{ 0.002617822538175064, 0.9998691088730915, -1.988913616644928 },
+		{ 0.003272224631937593, 0.9998363887684031, -1.982727511232789 },
+		{ 0.004253787619847361, 0.9997873106190072, -1.970902500808017 },
+		{ 0.005726041762763776, 0.9997136979118617, -1.947475135541913 },
+		{ 0.008179557783405379, 0.99959102211083, -1.893472985504651 },
+		{ 0.01308568664189507, 0.9993457156679053, -1.73148418071596 },
+		{ 0.01635577030852028, 0.999182211484574, -1.586057885332092 },
+		{ 0.03269816505592801, 0.9983650917472036, -0.5172149448122223 },
+		{ 3.368393894359313e-05, 0.9999983158132317, -1.999996500461532 },
+		{ 6.736758327689794e-05, 0.9999966316211184, -1.999989370188458 },
+		{ 0.0001010512392003598, 0.999994947440023, -1.999978609269108 },
+		{ 0.0001347349396295081, 0.9999932632535832, -1.999964217624587 },
+		{ 0.0001684191274459172, 0.9999915790945229, -1.999946195619681 },
+		{ 0.0002526281593245835, 0.9999873686683762, -1.999885256547688 },
+		{ 0.000421045832598483, 0.9999789477874559, -1.999695306288496 },
+		{ 0.0005894590890595689, 0.999970527059257, -1.99941460591174 },
+		{ 0.0008420780586578596, 0.9999578960999157, -1.998823426907246 },
+		{ 0.001061012589659296, 0.9999469493975417, -1.998145977472392 },
+		{ 0.001347308551658882, 0.9999326345780618, -1.997028855655254 },
+		{ 0.001684127455012943, 0.9999157941361809, -1.995379317537342 },
+		{ 0.002189338037369692, 0.9998905337597348, -1.992225985725478 },
+		{ 0.002694535856827862, 0.999865274021429, -1.988259037800485 },
+		{ 0.003368113096627194, 0.9998315953629895, -1.981707032551292 },
+		{ 0.004378440015725773, 0.9997810786843836, -1.969183081700274 },
+		{ 0.005893809162774646, 0.9997053096789408, -1.944375048732133 },
+		{ 0.008419185300999976, 0.999579040763431, -1.887211377975686 },
+		{ 0.01346900195978836, 0.9993265499584416, -1.715926807829102 },
+		{ 0.0168348943796662, 0.9991582603684095, -1.562410318137121 },
+		{ 0.0168348943796662, 0.9991582603684095, -1.562410318137121 },
+		{ 3.467102457047674e-05, 0.99999826645595, -1.999996343142609 },
+		{ 6.934156620038099e-05, 0.9999965329230867, -1.999988839716395 },
+		{ 0.0001040123058293433, 0.9999947993850469, -1.999977489671636 },
+		{ 0.0001386828919857598, 0.999993065858194, -1.99996229314396 },
+		{ 0.0001733548786532824, 0.9999913323507083, -1.999943250322668 },
+		{ 0.0002600317545194687, 0.9999869985542353, -1.999878814767422 },
+		{ 0.0004333816888432593, 0.999978330935825, -1.999677824266582 },
+		{ 0.000606730551872068, 0.9999696634743527, -1.999380688385901 },
+		{ 0.000866753986714568, 0.9999566623411977, -1.998754738991741 },
+		{ 0.001092102522326042, 0.9999453948837326, -1.998037346270399 },
+		{ 0.001386785646595107, 0.999930660745603, -1.996854266484649 },
+		{ 0.0017334811721002, 0.9999133268877697, -1.995107218560257 },
+		{ 0.002253481112729632, 0.9998873262554084, -1.99176733072619 },
+		{ 0.002773475134508282, 0.9998613262991386, -1.987565640071958 },
+		{ 0.003466804960701913, 0.9998266604697861, -1.980625977990514 },
+		{ 0.004506708317312916, 0.9997746652061893, -1.967362447134434 },
+		{ 0.006066477311416205, 0.9996966761538931, -1.941092818653064 },
+		{ 0.008665849723476891, 0.9995667079190831, -1.880584838717228 },
+		{ 0.0138635301252277, 0.9993068237729803, -1.699492697381427 },
+		{ 0.01732805220421543, 0.9991336068498509, -1.537469245838841 },
+		{ 0.01732805220421543, 0.9991336068498509, -1.537469245838841 },
+		{ 3.568702193067722e-05, 0.999998215658777, -1.999996177978201 },
+		{ 7.137342578191489e-05, 0.9999964313289189, -1.99998828065541 },
+		{ 0.0001070601602998579, 0.9999946469940637, -1.999976307982572 },
+		{ 0.0001427465968483634, 0.9999928626705736, -1.999960260101145 },
+		{ 0.0001784344728425684, 0.9999910783257238, -1.999940136700725 },
+		{ 0.0002676491405762424, 0.9999866175593398, -1.999872000467647 },
+		{ 0.0004460799451657949, 0.9999776960044575, -1.999659321242162 },
+		{ 0.0006245098895073035, 0.99996877452917, -1.999344778018839 },
+		{ 0.0008921499409772937, 0.9999553925063828, -1.99868200902159 },
+		{ 0.001124102305227259, 0.9999437948872523, -1.997922309295405 },
+		{ 0.001427420122002294, 0.9999286289980585, -1.996669353563424 },
+		{ 0.001784273093123126, 0.9999107868389842, -1.994818969339205 },
+		{ 0.002319506241612604, 0.9998840246881229, -1.991281525132661 },
+		{ 0.002854741683915118, 0.9998572632535382, -1.986831279439008 },
+		{ 0.003568387005592339, 0.9998215816369567, -1.979481146717088 },
+		{ 0.004638743477752682, 0.9997680628265191, -1.965434062842947 },
+		{ 0.00624422144037835, 0.9996877891643984, -1.937617455741268 },
+		{ 0.008919708776941097, 0.99955401459546, -1.873573286526632 },
+		{ 0.01426961765421323, 0.9992865191588612, -1.682134092891764 },
+		{ 0.01783556950610941, 0.9991082264591146, -1.511167092146515 },
+		{ 0.01783556950610941, 0.9991082264591146, -1.511167092146515 },
+		{ 3.673254044104288e-05, 0.9999981633808064, -1.999996004550372 },
+		{ 7.34648791254597e-05, 0.9999963267568048, -1.999987691409193 },
+		{ 0.0001101971291570202, 0.9999944901443575, -1.999975060676401 },
+		{ 0.0001469294884088975, 0.9999926535271023, -1.999958112274665 },
+		{ 0.0001836620275744611, 0.9999908169377636, -1.999936846608188 },
+		{ 0.0002754924088853754, 0.9999862254382688, -1.999864793158195 },
+		{ 0.0004591533625167449, 0.9999770424207146, -1.999639735744704 },
+		{ 0.0006428090412494731, 0.9999678595692992, -1.999306760706567 },
+		{ 0.0009182909964068069, 0.9999540854502884, -1.998604992816382 },
+		{ 0.001157039672424574, 0.99994214801759, -1.997800483207141 },
+		{ 0.001469246311438736, 0.9999265376996551, -1.996473510810799 },
+		{ 0.001836544381469018, 0.9999081731723319, -1.994513765785204 },
+		{ 0.002387468535816454, 0.9998806266047343, -1.990767007750584 },
+		{ 0.002938384688666884, 0.9998530807960196, -1.986053403951267 },
+		{ 0.003672920118900577, 0.9998163547768306, -1.978268815516585 },
+		{ 0.00477465207139657, 0.9997612674594765, -1.963392025809157 },
+		{ 0.006427160785000691, 0.9996786421743362, -1.933938075546439 },
+		{ 0.009181012865092588, 0.9995409493578336, -1.866154353789341 },
+		{ 0.01468760702611889, 0.9992656198009131, -1.663802896707709 },
+		{ 0.01835785669077387, 0.9990821110779036, -1.483451901593362 },
+		{ 0.01835785669077387, 0.9990821110779036, -1.483451901593362 },
+		{ 3.780906053627295e-05, 0.9999981095565886, -1.999995822338037 },
+		{ 7.56175041633345e-05, 0.9999962191249326, -1.999987070304196 },
+		{ 0.000113426270668411, 0.9999943286886691, -1.999973743851392 },
+		{ 0.0001512347224150555, 0.9999924382641602, -1.999955843134097 },
+		{ 0.0001890441266896212, 0.9999905478595876, -1.999933368368452 },
+		{ 0.0002835644705541974, 0.9999858217819795, -1.999857168254878 },
+		{ 0.000472604708443877, 0.9999763697755817, -1.999619008192181 },
+		{ 0.0006616438500811933, 0.9999669178585252, -1.999266513183219 },
+		{ 0.0009451982491462286, 0.9999527401095507, -1.998523438372118 },
+		{ 0.001190942428953871, 0.9999404528842509, -1.99767146472634 },
+		{ 0.001512295763335518, 0.9999243852146438, -1.996266101409437 },
+		{ 0.001890360859708704, 0.9999054826162076, -1.994190473440395 },
+		{ 0.002457428429796286, 0.9998771287341365, -1.990222011295555 },
+		{ 0.003024491611920465, 0.9998487764740833, -1.985229640701058 },
+		{ 0.003780552269843094, 0.9998109733479826, -1.976984481074292 },
+		{ 0.004914554912252795, 0.9997542725656208, -1.961229396631628 },
+		{ 0.006615453600877863, 0.9996692278301728, -1.930042943679176 },
+		{ 0.009449972596332163, 0.9995275015902164, -1.858305105636149 },
+		{ 0.01511781283435776, 0.9992441093863756, -1.644449383812275 },
+		{ 0.01889557038505037, 0.9990552280698808, -1.454244628692608 },
+		{ 0.01889557038505037, 0.9990552280698808, -1.454244628692608 },
+		{ 3.891676231124386e-05, 0.9999980541697623, -1.999995630964493 },
+		{ 7.783330785682877e-05, 0.9999961083351291, -1.999986415488599 },
+		{ 0.0001167497719668704, 0.999994162512464, -1.999972353681575 },
+		{ 0.0001556663128091844, 0.9999922166854034, -1.999953445468677 },
+		{ 0.000194584550502686, 0.9999902708457672, -1.999929690733966 },
+		{ 0.0002918731520544021, 0.9999854063450524, -1.999849103049284 },
+		{ 0.000486453688757703, 0.9999756773328038, -1.999597065705199 },
+		{ 0.0006810312689950194, 0.999965948497019, -1.999223898646596 },
+		{ 0.0009728955456822414, 0.9999513552571991, -1.998437070511009 },
+		{ 0.001225838715525203, 0.999938708096757, -1.997534829795081 },
+		{ 0.001556608607276265, 0.9999221695800775, -1.996046423652105 },
+		{ 0.001945760315800745, 0.9999027127171006, -1.993847993756314 },
+		{ 0.002529428296650585, 0.9998735286233179, -1.989644806746375 },
+		{ 0.003113094481667232, 0.999844345381329, -1.984357018869126 },
+		{ 0.003891301415077312, 0.9998054357169808, -1.975624600448522 },
+		{ 0.005058536693025509, 0.9997470732416446, -1.958939399602986 },
+		{ 0.006809269228482915, 0.9996595371431727, -1.925919058109826 },
+		{ 0.009726826051733127, 0.9995136590421752, -1.850000587234647 },
+		{ 0.01556063538652596, 0.9992219683350515, -1.624019182123087 },
+		{ 0.01944908696945794, 0.999027552977223, -1.423472982283226 },
+		{ 0.01944908696945794, 0.999027552977223, -1.423472982283226 },
+		{ 4.005713870491624e-05, 0.9999979971466957, -1.999995429835004 },
+		{ 8.011396282491219e-05, 0.9999959943055836, -1.999985725117639 },
+		{ 0.0001201707984880937, 0.9999939914603019, -1.999970885803822 },
+		{ 0.0001602276252123611, 0.9999919886190317, -1.999950911971087 },
+		{ 0.0002002858582409723, 0.9999899858144973, -1.99992580413319 },
+		{ 0.0003004256423748509, 0.9999849787184472, -1.999840570476014 },
+		{ 0.0005007073514178004, 0.9999749646833703, -1.999573842140811 },
+		{ 0.0007009869947338001, 0.9999649506667666, -1.999178776713899 },
+		{ 0.001001401944437448, 0.9999499299116998, -1.998345615483109 },
+		{ 0.00126175817401502, 0.9999369121010317, -1.997390119342262 },
+		{ 0.001602218489375359, 0.9999198890784553, -1.995813764152467 },
+		{ 0.002002768328242041, 0.9998998626576295, -1.993485381319958 },
+		{ 0.002603540177671367, 0.9998698230013161, -1.989033444771235 },
+		{ 0.003204335105427007, 0.999839784247474, -1.983432735745373 },
+		{ 0.004005316765004505, 0.9997997345247877, -1.974184030528522 },
+		{ 0.005206741434302461, 0.9997396629486832, -1.956514398232751 },
+		{ 0.007008764439966348, 0.9996495619430105, -1.921553119233724 },
+		{ 0.01001176343281866, 0.9994994119175545, -1.841216217988727 },
+		{ 0.01601641014344397, 0.9991991795220562, -1.602458417127615 },
+		{ 0.0200186608566467, 0.9989990776927541, -1.391082060063749 },
+		{ 0.0200186608566467, 0.9989990776927541, -1.391082060063749 },
+		{ 4.123077973709948e-05, 0.9999979384628457, -1.999995218501978 },
+		{ 8.246147445669214e-05, 0.9999958769299416, -1.999984997105084 },
+		{ 0.0001236921758157305, 0.9999938153931059, -1.999969335775387 },
+		{ 0.000164925191842691, 0.9999917538441579, -1.999948234407403 },
+		{ 0.0002061530486767782, 0.999989692356728, -1.999921693985307 },
+		{ 0.0003092287761454666, 0.9999845385749349, -1.9998315437172 },
+		{ 0.0005153786374072063, 0.9999742310910336, -1.999549257198157 },
+		{ 0.0007215263737334272, 0.9999639237133786, -1.999131007495713 },
+		{ 0.001030745464348281, 0.9999484627642959, -1.998248764302181 },
+		{ 0.001298728411545882, 0.9999350635884395, -1.997236870856768 },
+		{ 0.001649190719809731, 0.9999175415014708, -1.9955673215431 },
+		{ 0.002061434866512276, 0.9998969283482867, -1.993101220227979 },
+		{ 0.002679836933656666, 0.9998660085972511, -1.988385873631353 },
+		{ 0.003298201660753784, 0.9998350906203335, -1.982454024781619 },
+		{ 0.004122657257541742, 0.9997938673203383, -1.972658617305606 },
+		{ 0.005359294978591605, 0.9997320359661022, -1.953946644322675 },
+		{ 0.007214092500413716, 0.9996392956955812, -1.916931931038315 },
+		{ 0.01030506449225094, 0.9994847471504353, -1.831924298491992 },
+		{ 0.01648578900292704, 0.9991757209206151, -1.579706833055193 },
+		{ 0.02060478989539234, 0.9989697614209301, -1.356979020951952 },
+		{ 0.02060478989539234, 0.9989697614209301, -1.356979020951952 },
+		{ 4.243895114722124e-05, 0.9999978780527631, -1.99999499634795 },
+		{ 8.487781222262453e-05, 0.9999957561100296, -1.99998422931131 },
+		{ 0.0001273165832569929, 0.999993634171798, -1.999967698933336 },
+		{ 0.0001697554567991, 0.9999915122544316, -1.999945405468022 },
+		{ 0.0002121938551615622, 0.9999893903088433, -1.999917348409457 },
+		{ 0.0003182899385011917, 0.9999840855054772, -1.999821992878222 },
+		{ 0.0005304804167062601, 0.9999734759831685, -1.999523231886218 },
+		{ 0.0007426686436447557, 0.9999628665734234, -1.999080424612433 },
+		{ 0.001060946762944127, 0.9999469526698603, -1.998146202886054 },
+		{ 0.00133678319008337, 0.9999331608413278, -1.99707456372607 },
+		{ 0.001697489731542628, 0.9999151257861261, -1.995306376738826 },
+		{ 0.00212183724549909, 0.9998939081537399, -1.992694342763168 },
+		{ 0.002758343341763662, 0.9998620829583371, -1.987700079824158 },
+		{ 0.003394835389959559, 0.9998302587758845, -1.981417285449207 },
+		{ 0.00424344938135569, 0.99978782756296, -1.971042927291965 },
+		{ 0.005516306260989384, 0.9997241849377844, -1.951227441185643 },
+		{ 0.007425445556836175, 0.9996287277782024, -1.912039798827979 },
+		{ 0.01060693536997453, 0.9994696533115579, -1.822096942871267 },
+		{ 0.01696841549268516, 0.9991515819513522, -1.555713722715377 },
+		{ 0.02120824538690043, 0.9989395878907261, -1.321097914908667 },
+		{ 0.02120824538690043, 0.9989395878907261, -1.321097914908667 },
+		{ 4.368248980757637e-05, 0.9999978158755429, -1.999994762817213 },
+		{ 8.736488422253174e-05, 0.9999956317558556, -1.999983419545192 },
+		{ 0.0001310471832186612, 0.999993447640939, -1.999965970231907 },
+		{ 0.0001747297525504975, 0.9999912635471551, -1.999942415143305 },
+		{ 0.0002184114949897459, 0.999989079425417, -1.999912753766626 },
+		{ 0.0003276163480527996, 0.9999836191828477, -1.999811888284809 },
+		{ 0.0005460242652861545, 0.9999726987871529, -1.999495683256062 },
+		{ 0.0007644297973840539, 0.999961778510715, -1.999026868855125 },
+		{ 0.001092033623440129, 0.999945398319662, -1.998037589784965 },
+		{ 0.001375952279395949, 0.9999312023874861, -1.996902671497256 },
+		{ 0.001747228833761316, 0.9999126389061247, -1.995029958767254 },
+		{ 0.002184007620023425, 0.9998907996206673, -1.992263413548702 },
+		{ 0.002839164038628494, 0.9998580419958493, -1.986973657232747 },
+		{ 0.003494305027686388, 0.9998252854442102, -1.980319258529398 },
+		{ 0.00436777674557408, 0.9997816111660578, -1.969331909632603 },
+		{ 0.005677925035200987, 0.9997161041437734, -1.948348230286346 },
+		{ 0.00764298331376087, 0.9996178508401503, -1.906861794931287 },
+		{ 0.01091765341590038, 0.9994541173375446, -1.811703981335337 },
+		{ 0.01746542114551457, 0.9991267324194844, -1.530407398591551 },
+		{ 0.0218293470740838, 0.9989085326629704, -1.283363027976121 },
+		{ 0.0218293470740838, 0.9989085326629704, -1.283363027976121 }
+	}
+};
@@ -0,0 +1,1647 @@
+#include "Scales.hpp"
+Scale et_triads = {
+	.name = "Triads (ET)",
+	.description = "Western triads in G, Equal Temperament",
+	.scalename = {
+		"Unison, M2, P5; G1-D8",
+		"Unison, M3, d5; G1-C#8",
+		"Unison, m3, P5; G1-D8",
+		"Unison, M3, P5; G1-D8",
+		"Unison, P4, P5; G1-D8",
+		"Unison, M3, M6; G1-E8",
+		"Unison, m3, m6; G1-D#8",
+		"Unison, m3, M6; G1-E8",
+		"Unison, m3, m7; G1-F8",
+		"Unison, P5, m7; G1-F8",
+		"Unison, P5, M7; G1-F#8"},
+	.notedesc = {
+		"Oct",
+		"M2",
+		"P5",
+		"Oct",
+		"M2",
+		"P5",
+		"Oct",
+		"M2",
+		"P5",
+		"Oct",
+		"M2",
+		"P5",
+		"Oct",
+		"M2",
+		"P5",
+		"Oct",
+		"M2",
+		"P5",
+		"Oct",
+		"M2",
+		"P5",
+		"Oct",
+		"M3",
+		"d5",
+		"Oct",
+		"M3",
+		"d5",
+		"Oct",
+		"M3",
+		"d5",
+		"Oct",
+		"M3",
+		"d5",
+		"Oct",
+		"M3",
+		"d5",
+		"Oct",
+		"M3",
+		"d5",
+		"Oct",
+		"M3",
+		"d5",
+		"Oct",
+		"m3",
+		"M7",
+		"Oct",
+		"m3",
+		"M7",
+		"Oct",
+		"m3",
+		"M7",
+		"Oct",
+		"m3",
+		"M7",
+		"Oct",
+		"m3",
+		"M7",
+		"Oct",
+		"m3",
+		"M7",
+		"Oct",
+		"m3",
+		"M7",
+		"Oct",
+		"M3",
+		"P5",
+		"Oct",
+		"M3",
+		"P5",
+		"Oct",
+		"M3",
+		"P5",
+		"Oct",
+		"M3",
+		"P5",
+		"Oct",
+		"M3",
+		"P5",
+		"Oct",
+		"M3",
+		"P5",
+		"Oct",
+		"M3",
+		"P5",
+		"Oct",
+		"m3",
+		"d5",
+		"Oct",
+		"m3",
+		"d5",
+		"Oct",
+		"m3",
+		"d5",
+		"Oct",
+		"m3",
+		"d5",
+		"Oct",
+		"m3",
+		"d5",
+		"Oct",
+		"m3",
+		"d5",
+		"Oct",
+		"m3",
+		"d5",
+		"Oct",
+		"P4",
+		"P5",
+		"Oct",
+		"P4",
+		"P5",
+		"Oct",
+		"P4",
+		"P5",
+		"Oct",
+		"P4",
+		"P5",
+		"Oct",
+		"P4",
+		"P5",
+		"Oct",
+		"P4",
+		"P5",
+		"Oct",
+		"P4",
+		"P5",
+		"Oct",
+		"M3",
+		"M6",
+		"Oct",
+		"M3",
+		"M6",
+		"Oct",
+		"M3",
+		"M6",
+		"Oct",
+		"M3",
+		"M6",
+		"Oct",
+		"M3",
+		"M6",
+		"Oct",
+		"M3",
+		"M6",
+		"Oct",
+		"M3",
+		"M6",
+		"Oct",
+		"m3",
+		"m6",
+		"Oct",
+		"m3",
+		"m6",
+		"Oct",
+		"m3",
+		"m6",
+		"Oct",
+		"m3",
+		"m6",
+		"Oct",
+		"m3",
+		"m6",
+		"Oct",
+		"m3",
+		"m6",
+		"Oct",
+		"m3",
+		"m6",
+		"Oct",
+		"M3",
+		"m6",
+		"Oct",
+		"M3",
+		"m6",
+		"Oct",
+		"M3",
+		"m6",
+		"Oct",
+		"M3",
+		"m6",
+		"Oct",
+		"M3",
+		"m6",
+		"Oct",
+		"M3",
+		"m6",
+		"Oct",
+		"M3",
+		"m6",
+		"Oct",
+		"m3",
+		"m7",
+		"Oct",
+		"m3",
+		"m7",
+		"Oct",
+		"m3",
+		"m7",
+		"Oct",
+		"m3",
+		"m7",
+		"Oct",
+		"m3",
+		"m7",
+		"Oct",
+		"m3",
+		"m7",
+		"Oct",
+		"m3",
+		"m7",
+		"Oct",
+		"P5",
+		"M7",
+		"Oct",
+		"P5",
+		"M7",
+		"Oct",
+		"P5",
+		"M7",
+		"Oct",
+		"P5",
+		"M7",
+		"Oct",
+		"P5",
+		"M7",
+		"Oct",
+		"P5",
+		"M7",
+		"Oct",
+		"P5",
+		"M7"},
+	.c_maxq48000 = {
+		0.006414010322505164,
+		0.00719948316447661,
+		0.009610157057369574,
+		0.01282802064501033,
+		0.01439896632895322,
+		0.01922031411473915,
+		0.02565604129002066,
+		0.02879793265790644,
+		0.03844062822947829,
+		0.05131208258004132,
+		0.05759586531581288,
+		0.07688125645895659,
+		0.1026241651600826,
+		0.1151917306316258,
+		0.1537625129179132,
+		0.2052483303201653,
+		0.2303834612632515,
+		0.3075250258358264,
+		0.4104966606403305,
+		0.460766922526503,
+		0.6150500516716527,
+		0.006414010322505164,
+		0.008081146619567259,
+		0.009070780387287833,
+		0.01282802064501033,
+		0.01616229323913452,
+		0.01814156077457567,
+		0.02565604129002066,
+		0.03232458647826904,
+		0.03628312154915133,
+		0.05131208258004132,
+		0.06464917295653808,
+		0.07256624309830266,
+		0.1026241651600826,
+		0.1292983459130762,
+		0.1451324861966053,
+		0.2052483303201653,
+		0.2585966918261523,
+		0.2902649723932106,
+		0.4104966606403305,
+		0.5171933836523046,
+		0.5805299447864213,
+		0.006414010322505164,
+		0.007627586711224039,
+		0.0121080391693757,
+		0.01282802064501033,
+		0.01525517342244808,
+		0.0242160783387514,
+		0.02565604129002066,
+		0.03051034684489616,
+		0.04843215667750279,
+		0.05131208258004132,
+		0.06102069368979231,
+		0.09686431335500559,
+		0.1026241651600826,
+		0.1220413873795846,
+		0.1937286267100112,
+		0.2052483303201653,
+		0.2440827747591693,
+		0.3874572534200224,
+		0.4104966606403305,
+		0.4881655495183385,
+		0.7749145068400447,
+		0.006414010322505164,
+		0.008081146619567259,
+		0.009610157057369574,
+		0.01282802064501033,
+		0.01616229323913452,
+		0.01922031411473915,
+		0.02565604129002066,
+		0.03232458647826904,
+		0.03844062822947829,
+		0.05131208258004132,
+		0.06464917295653808,
+		0.07688125645895659,
+		0.1026241651600826,
+		0.1292983459130762,
+		0.1537625129179132,
+		0.2052483303201653,
+		0.2585966918261523,
+		0.3075250258358264,
+		0.4104966606403305,
+		0.5171933836523046,
+		0.6150500516716527,
+		0.006414010322505164,
+		0.007627586711224039,
+		0.009070780387287833,
+		0.01282802064501033,
+		0.01525517342244808,
+		0.01814156077457567,
+		0.02565604129002066,
+		0.03051034684489616,
+		0.03628312154915133,
+		0.05131208258004132,
+		0.06102069368979231,
+		0.07256624309830266,
+		0.1026241651600826,
+		0.1220413873795846,
+		0.1451324861966053,
+		0.2052483303201653,
+		0.2440827747591693,
+		0.2902649723932106,
+		0.4104966606403305,
+		0.4881655495183385,
+		0.5805299447864213,
+		0.006414010322505164,
+		0.008561676603537889,
+		0.009610157057369574,
+		0.01282802064501033,
+		0.01712335320707578,
+		0.01922031411473915,
+		0.02565604129002066,
+		0.03424670641415156,
+		0.03844062822947829,
+		0.05131208258004132,
+		0.06849341282830311,
+		0.07688125645895659,
+		0.1026241651600826,
+		0.1369868256566062,
+		0.1537625129179132,
+		0.2052483303201653,
+		0.2739736513132124,
+		0.3075250258358264,
+		0.4104966606403305,
+		0.5479473026264249,
+		0.6150500516716527,
+		0.006414010322505164,
+		0.008081146619567259,
+		0.01078703657518983,
+		0.01282802064501033,
+		0.01616229323913452,
+		0.02157407315037966,
+		0.02565604129002066,
+		0.03232458647826904,
+		0.04314814630075931,
+		0.05131208258004132,
+		0.06464917295653808,
+		0.08629629260151862,
+		0.1026241651600826,
+		0.1292983459130762,
+		0.1725925852030372,
+		0.2052483303201653,
+		0.2585966918261523,
+		0.3451851704060745,
+		0.4104966606403305,
+		0.5171933836523046,
+		0.690370340812149,
+		0.006414010322505164,
+		0.007627586711224039,
+		0.01018160673327959,
+		0.01282802064501033,
+		0.01525517342244808,
+		0.02036321346655917,
+		0.02565604129002066,
+		0.03051034684489616,
+		0.04072642693311835,
+		0.05131208258004132,
+		0.06102069368979231,
+		0.0814528538662367,
+		0.1026241651600826,
+		0.1220413873795846,
+		0.1629057077324734,
+		0.2052483303201653,
+		0.2440827747591693,
+		0.3258114154649468,
+		0.4104966606403305,
+		0.4881655495183385,
+		0.6516228309298936,
+		0.006414010322505164,
+		0.008081146619567259,
+		0.01018160673327959,
+		0.01282802064501033,
+		0.01616229323913452,
+		0.02036321346655917,
+		0.02565604129002066,
+		0.03232458647826904,
+		0.04072642693311835,
+		0.05131208258004132,
+		0.06464917295653808,
+		0.0814528538662367,
+		0.1026241651600826,
+		0.1292983459130762,
+		0.1629057077324734,
+		0.2052483303201653,
+		0.2585966918261523,
+		0.3258114154649468,
+		0.4104966606403305,
+		0.5171933836523046,
+		0.6516228309298936,
+		0.006414010322505164,
+		0.007627586711224039,
+		0.01142846714891751,
+		0.01282802064501033,
+		0.01525517342244808,
+		0.02285693429783502,
+		0.02565604129002066,
+		0.03051034684489616,
+		0.04571386859567004,
+		0.05131208258004132,
+		0.06102069368979231,
+		0.09142773719134008,
+		0.1026241651600826,
+		0.1220413873795846,
+		0.1828554743826802,
+		0.2052483303201653,
+		0.2440827747591693,
+		0.3657109487653603,
+		0.4104966606403305,
+		0.4881655495183385,
+		0.7314218975307206,
+		0.006414010322505164,
+		0.009610157057369574,
+		0.0121080391693757,
+		0.01282802064501033,
+		0.01922031411473915,
+		0.0242160783387514,
+		0.02565604129002066,
+		0.03844062822947829,
+		0.04843215667750279,
+		0.05131208258004132,
+		0.07688125645895659,
+		0.09686431335500559,
+		0.1026241651600826,
+		0.1537625129179132,
+		0.1937286267100112,
+		0.2052483303201653,
+		0.3075250258358264,
+		0.3874572534200224,
+		0.4104966606403305,
+		0.6150500516716527,
+		0.7749145068400447
+	},
+	.c_maxq96000 = {
+		0.003207005161252582,
+		0.003599741582238305,
+		0.004805078528684787,
+		0.006414010322505164,
+		0.00719948316447661,
+		0.009610157057369574,
+		0.01282802064501033,
+		0.01439896632895322,
+		0.01922031411473915,
+		0.02565604129002066,
+		0.02879793265790644,
+		0.03844062822947829,
+		0.05131208258004132,
+		0.05759586531581288,
+		0.07688125645895659,
+		0.1026241651600826,
+		0.1151917306316258,
+		0.1537625129179132,
+		0.2052483303201653,
+		0.2303834612632515,
+		0.3075250258358264,
+		0.003207005161252582,
+		0.00404057330978363,
+		0.004535390193643916,
+		0.006414010322505164,
+		0.008081146619567259,
+		0.009070780387287833,
+		0.01282802064501033,
+		0.01616229323913452,
+		0.01814156077457567,
+		0.02565604129002066,
+		0.03232458647826904,
+		0.03628312154915133,
+		0.05131208258004132,
+		0.06464917295653808,
+		0.07256624309830266,
+		0.1026241651600826,
+		0.1292983459130762,
+		0.1451324861966053,
+		0.2052483303201653,
+		0.2585966918261523,
+		0.2902649723932106,
+		0.003207005161252582,
+		0.00381379335561202,
+		0.006054019584687849,
+		0.006414010322505164,
+		0.007627586711224039,
+		0.0121080391693757,
+		0.01282802064501033,
+		0.01525517342244808,
+		0.0242160783387514,
+		0.02565604129002066,
+		0.03051034684489616,
+		0.04843215667750279,
+		0.05131208258004132,
+		0.06102069368979231,
+		0.09686431335500559,
+		0.1026241651600826,
+		0.1220413873795846,
+		0.1937286267100112,
+		0.2052483303201653,
+		0.2440827747591693,
+		0.3874572534200224,
+		0.003207005161252582,
+		0.00404057330978363,
+		0.004805078528684787,
+		0.006414010322505164,
+		0.008081146619567259,
+		0.009610157057369574,
+		0.01282802064501033,
+		0.01616229323913452,
+		0.01922031411473915,
+		0.02565604129002066,
+		0.03232458647826904,
+		0.03844062822947829,
+		0.05131208258004132,
+		0.06464917295653808,
+		0.07688125645895659,
+		0.1026241651600826,
+		0.1292983459130762,
+		0.1537625129179132,
+		0.2052483303201653,
+		0.2585966918261523,
+		0.3075250258358264,
+		0.003207005161252582,
+		0.00381379335561202,
+		0.004535390193643916,
+		0.006414010322505164,
+		0.007627586711224039,
+		0.009070780387287833,
+		0.01282802064501033,
+		0.01525517342244808,
+		0.01814156077457567,
+		0.02565604129002066,
+		0.03051034684489616,
+		0.03628312154915133,
+		0.05131208258004132,
+		0.06102069368979231,
+		0.07256624309830266,
+		0.1026241651600826,
+		0.1220413873795846,
+		0.1451324861966053,
+		0.2052483303201653,
+		0.2440827747591693,
+		0.2902649723932106,
+		0.003207005161252582,
+		0.004280838301768944,
+		0.004805078528684787,
+		0.006414010322505164,
+		0.008561676603537889,
+		0.009610157057369574,
+		0.01282802064501033,
+		0.01712335320707578,
+		0.01922031411473915,
+		0.02565604129002066,
+		0.03424670641415156,
+		0.03844062822947829,
+		0.05131208258004132,
+		0.06849341282830311,
+		0.07688125645895659,
+		0.1026241651600826,
+		0.1369868256566062,
+		0.1537625129179132,
+		0.2052483303201653,
+		0.2739736513132124,
+		0.3075250258358264,
+		0.003207005161252582,
+		0.00404057330978363,
+		0.005393518287594914,
+		0.006414010322505164,
+		0.008081146619567259,
+		0.01078703657518983,
+		0.01282802064501033,
+		0.01616229323913452,
+		0.02157407315037966,
+		0.02565604129002066,
+		0.03232458647826904,
+		0.04314814630075931,
+		0.05131208258004132,
+		0.06464917295653808,
+		0.08629629260151862,
+		0.1026241651600826,
+		0.1292983459130762,
+		0.1725925852030372,
+		0.2052483303201653,
+		0.2585966918261523,
+		0.3451851704060745,
+		0.003207005161252582,
+		0.00381379335561202,
+		0.005090803366639794,
+		0.006414010322505164,
+		0.007627586711224039,
+		0.01018160673327959,
+		0.01282802064501033,
+		0.01525517342244808,
+		0.02036321346655917,
+		0.02565604129002066,
+		0.03051034684489616,
+		0.04072642693311835,
+		0.05131208258004132,
+		0.06102069368979231,
+		0.0814528538662367,
+		0.1026241651600826,
+		0.1220413873795846,
+		0.1629057077324734,
+		0.2052483303201653,
+		0.2440827747591693,
+		0.3258114154649468,
+		0.003207005161252582,
+		0.00404057330978363,
+		0.005090803366639794,
+		0.006414010322505164,
+		0.008081146619567259,
+		0.01018160673327959,
+		0.01282802064501033,
+		0.01616229323913452,
+		0.02036321346655917,
+		0.02565604129002066,
+		0.03232458647826904,
+		0.04072642693311835,
+		0.05131208258004132,
+		0.06464917295653808,
+		0.0814528538662367,
+		0.1026241651600826,
+		0.1292983459130762,
+		0.1629057077324734,
+		0.2052483303201653,
+		0.2585966918261523,
+		0.3258114154649468,
+		0.003207005161252582,
+		0.00381379335561202,
+		0.005714233574458755,
+		0.006414010322505164,
+		0.007627586711224039,
+		0.01142846714891751,
+		0.01282802064501033,
+		0.01525517342244808,
+		0.02285693429783502,
+		0.02565604129002066,
+		0.03051034684489616,
+		0.04571386859567004,
+		0.05131208258004132,
+		0.06102069368979231,
+		0.09142773719134008,
+		0.1026241651600826,
+		0.1220413873795846,
+		0.1828554743826802,
+		0.2052483303201653,
+		0.2440827747591693,
+		0.3657109487653603,
+		0.003207005161252582,
+		0.004805078528684787,
+		0.006054019584687849,
+		0.006414010322505164,
+		0.009610157057369574,
+		0.0121080391693757,
+		0.01282802064501033,
+		0.01922031411473915,
+		0.0242160783387514,
+		0.02565604129002066,
+		0.03844062822947829,
+		0.04843215667750279,
+		0.05131208258004132,
+		0.07688125645895659,
+		0.09686431335500559,
+		0.1026241651600826,
+		0.1537625129179132,
+		0.1937286267100112,
+		0.2052483303201653,
+		0.3075250258358264,
+		0.3874572534200224
+	},
+	.c_bpre4800022 = {
+		{ 0.003201866288643763, 0.9967981337113654, -1.996757060234848 },
+		{ 0.003593270279843708, 0.9964067297201568, -1.996354990509996 },
+		{ 0.004793553129661453, 0.995206446870339, -1.995114313795211 },
+		{ 0.006393487132687735, 0.9936065128673215, -1.993442482915876 },
+		{ 0.007173628968382158, 0.9928263710316179, -1.992619788024624 },
+		{ 0.009564102178687457, 0.9904358978218357, -1.990068257175529 },
+		{ 0.01274611051097516, 0.9872538894892359, -1.986599885979389 },
+		{ 0.01429579698418819, 0.9857042030158116, -1.98488086689542 },
+		{ 0.01903679650984277, 0.9809632034902522, -1.979499764664712 },
+		{ 0.02532969389660592, 0.9746703061036448, -1.972071298045083 },
+		{ 0.02838722415696337, 0.9716127758430366, -1.968343480294637 },
+		{ 0.03771119339833019, 0.9622888066018583, -1.956492376078495 },
+		{ 0.05001785657602598, 0.9499821434239846, -1.939722816583335 },
+		{ 0.05596861381858907, 0.9440313861814109, -1.931147834504842 },
+		{ 0.07400025268914147, 0.9259997473112286, -1.903276415136619 },
+		{ 0.09753380904399873, 0.9024661909569682, -1.862534279738735 },
+		{ 0.108804741904404, 0.891195258095596, -1.84122780449662 },
+		{ 0.1425244679802554, 0.8574755320204597, -1.770333165268908 },
+		{ 0.1855547741814696, 0.8144452258203794, -1.663706411638779 },
+		{ 0.2057710119479237, 0.7942289880520762, -1.607112005154733 },
+		{ 0.2647357119875735, 0.7352642880137701, -1.417267194837147 },
+		{ 0.003201866288643763, 0.9967981337113654, -1.996757060234848 },
+		{ 0.004032420351849574, 0.995967579648152, -1.99590240676733 },
+		{ 0.004525123595710226, 0.9954748764043035, -1.995392783971677 },
+		{ 0.006393487132687735, 0.9936065128673215, -1.993442482915876 },
+		{ 0.008048593274544517, 0.9919514067255844, -1.991691243155729 },
+		{ 0.009029744504671285, 0.9909702554957032, -1.990642635663237 },
+		{ 0.01274611051097516, 0.9872538894892359, -1.986599885979389 },
+		{ 0.01603240669539133, 0.9839675933048655, -1.982931177691716 },
+		{ 0.01797801699622542, 0.9820219830040292, -1.980717491454658 },
+		{ 0.02532969389660592, 0.9746703061036448, -1.972071298045083 },
+		{ 0.03180771195789074, 0.9681922880422043, -1.964080680251197 },
+		{ 0.03563276177921157, 0.9643672382208521, -1.959197471233227 },
+		{ 0.05001785657602598, 0.9499821434239846, -1.939722816583335 },
+		{ 0.06260375472812528, 0.9373962452719558, -1.921224026261177 },
+		{ 0.06999582984641198, 0.9300041701537132, -1.909713580549767 },
+		{ 0.09753380904399873, 0.9024661909569682, -1.862534279738735 },
+		{ 0.1212880493063797, 0.8787119506961812, -1.816244584825735 },
+		{ 0.1350922434969453, 0.864907756503297, -1.786895143515801 },
+		{ 0.1855547741814696, 0.8144452258203794, -1.663706411638779 },
+		{ 0.2278658130660425, 0.772134186935479, -1.54035689744841 },
+		{ 0.2519345727408895, 0.7480654272595667, -1.461683819799863 },
+		{ 0.003201866288643763, 0.9967981337113654, -1.996757060234848 },
+		{ 0.003806532025864093, 0.9961934679741439, -1.9961353988494 },
+		{ 0.006035730563976651, 0.9939642694360237, -1.993818109060076 },
+		{ 0.006393487132687735, 0.9936065128673215, -1.993442482915876 },
+		{ 0.007598574365664685, 0.9924014256343514, -1.992169593748362 },
+		{ 0.01203501815220637, 0.9879649818479194, -1.987382121992113 },
+		{ 0.01274611051097516, 0.9872538894892359, -1.986599885979389 },
+		{ 0.01513941039893861, 0.9848605896010932, -1.983936825550939 },
+		{ 0.02392519464249001, 0.9760748053577598, -1.973757650197085 },
+		{ 0.02532969389660592, 0.9746703061036448, -1.972071298045083 },
+		{ 0.03004961905065011, 0.969950380949413, -1.966283935281568 },
+		{ 0.04727803670133689, 0.9527219632986798, -1.943568222565742 },
+		{ 0.05001785657602598, 0.9499821434239846, -1.939722816583335 },
+		{ 0.05919625849621272, 0.9408037415039114, -1.926368394147137 },
+		{ 0.09232097946502396, 0.9076790205367768, -1.871992389610808 },
+		{ 0.09753380904399873, 0.9024661909569682, -1.862534279738735 },
+		{ 0.1148885517004107, 0.8851114483060925, -1.829235310265093 },
+		{ 0.1761187956808483, 0.823881204322603, -1.688681565563275 },
+		{ 0.1855547741814696, 0.8144452258203794, -1.663706411638779 },
+		{ 0.2165772113286436, 0.7834227886713574, -1.57510958880094 },
+		{ 0.3212193169032087, 0.6787806830968353, -1.199456770773543 },
+		{ 0.003201866288643763, 0.9967981337113654, -1.996757060234848 },
+		{ 0.004032420351849574, 0.995967579648152, -1.99590240676733 },
+		{ 0.004793553129661453, 0.995206446870339, -1.995114313795211 },
+		{ 0.006393487132687735, 0.9936065128673215, -1.993442482915876 },
+		{ 0.008048593274544517, 0.9919514067255844, -1.991691243155729 },
+		{ 0.009564102178687457, 0.9904358978218357, -1.990068257175529 },
+		{ 0.01274611051097516, 0.9872538894892359, -1.986599885979389 },
+		{ 0.01603240669539133, 0.9839675933048655, -1.982931177691716 },
+		{ 0.01903679650984277, 0.9809632034902522, -1.979499764664712 },
+		{ 0.02532969389660592, 0.9746703061036448, -1.972071298045083 },
+		{ 0.03180771195789074, 0.9681922880422043, -1.964080680251197 },
+		{ 0.03771119339833019, 0.9622888066018583, -1.956492376078495 },
+		{ 0.05001785657602598, 0.9499821434239846, -1.939722816583335 },
+		{ 0.06260375472812528, 0.9373962452719558, -1.921224026261177 },
+		{ 0.07400025268914147, 0.9259997473112286, -1.903276415136619 },
+		{ 0.09753380904399873, 0.9024661909569682, -1.862534279738735 },
+		{ 0.1212880493063797, 0.8787119506961812, -1.816244584825735 },
+		{ 0.1425244679802554, 0.8574755320204597, -1.770333165268908 },
+		{ 0.1855547741814696, 0.8144452258203794, -1.663706411638779 },
+		{ 0.2278658130660425, 0.772134186935479, -1.54035689744841 },
+		{ 0.2647357119875735, 0.7352642880137701, -1.417267194837147 },
+		{ 0.003201866288643763, 0.9967981337113654, -1.996757060234848 },
+		{ 0.003806532025864093, 0.9961934679741439, -1.9961353988494 },
+		{ 0.004525123595710226, 0.9954748764043035, -1.995392783971677 },
+		{ 0.006393487132687735, 0.9936065128673215, -1.993442482915876 },
+		{ 0.007598574365664685, 0.9924014256343514, -1.992169593748362 },
+		{ 0.009029744504671285, 0.9909702554957032, -1.990642635663237 },
+		{ 0.01274611051097516, 0.9872538894892359, -1.986599885979389 },
+		{ 0.01513941039893861, 0.9848605896010932, -1.983936825550939 },
+		{ 0.01797801699622542, 0.9820219830040292, -1.980717491454658 },
+		{ 0.02532969389660592, 0.9746703061036448, -1.972071298045083 },
+		{ 0.03004961905065011, 0.969950380949413, -1.966283935281568 },
+		{ 0.03563276177921157, 0.9643672382208521, -1.959197471233227 },
+		{ 0.05001785657602598, 0.9499821434239846, -1.939722816583335 },
+		{ 0.05919625849621272, 0.9408037415039114, -1.926368394147137 },
+		{ 0.06999582984641198, 0.9300041701537132, -1.909713580549767 },
+		{ 0.09753380904399873, 0.9024661909569682, -1.862534279738735 },
+		{ 0.1148885517004107, 0.8851114483060925, -1.829235310265093 },
+		{ 0.1350922434969453, 0.864907756503297, -1.786895143515801 },
+		{ 0.1855547741814696, 0.8144452258203794, -1.663706411638779 },
+		{ 0.2165772113286436, 0.7834227886713574, -1.57510958880094 },
+		{ 0.2519345727408895, 0.7480654272595667, -1.461683819799863 },
+		{ 0.003201866288643763, 0.9967981337113654, -1.996757060234848 },
+		{ 0.004271689139652995, 0.9957283108603474, -1.995655165543826 },
+		{ 0.004793553129661453, 0.995206446870339, -1.995114313795211 },
+		{ 0.006393487132687735, 0.9936065128673215, -1.993442482915876 },
+		{ 0.008525143929762899, 0.9914748560704251, -1.991182902834333 },
+		{ 0.009564102178687457, 0.9904358978218357, -1.990068257175529 },
+		{ 0.01274611051097516, 0.9872538894892359, -1.986599885979389 },
+		{ 0.01697760978050481, 0.9830223902198703, -1.98185961909105 },
+		{ 0.01903679650984277, 0.9809632034902522, -1.979499764664712 },
+		{ 0.02532969389660592, 0.9746703061036448, -1.972071298045083 },
+		{ 0.03366691708007948, 0.9663330829199375, -1.961722512131246 },
+		{ 0.03771119339833019, 0.9622888066018583, -1.956492376078495 },
+		{ 0.05001785657602598, 0.9499821434239846, -1.939722816583335 },
+		{ 0.06620025062283011, 0.9337997493796442, -1.915683929838771 },
+		{ 0.07400025268914147, 0.9259997473112286, -1.903276415136619 },
+		{ 0.09753380904399873, 0.9024661909569682, -1.862534279738735 },
+		{ 0.1280180280633102, 0.8719819719414862, -1.802163694945135 },
+		{ 0.1425244679802554, 0.8574755320204597, -1.770333165268908 },
+		{ 0.1855547741814696, 0.8144452258203794, -1.663706411638779 },
+		{ 0.239647938258562, 0.7603520617415391, -1.502628737008348 },
+		{ 0.2647357119875735, 0.7352642880137701, -1.417267194837147 },
+		{ 0.003201866288643763, 0.9967981337113654, -1.996757060234848 },
+		{ 0.004032420351849574, 0.995967579648152, -1.99590240676733 },
+		{ 0.00537900008344386, 0.9946209999165567, -1.994504953804058 },
+		{ 0.006393487132687735, 0.9936065128673215, -1.993442482915876 },
+		{ 0.008048593274544517, 0.9919514067255844, -1.991691243155729 },
+		{ 0.01072907947466966, 0.9892709205254852, -1.988807993479254 },
+		{ 0.01274611051097516, 0.9872538894892359, -1.986599885979389 },
+		{ 0.01603240669539133, 0.9839675933048655, -1.982931177691716 },
+		{ 0.02134304580296829, 0.9786569541973403, -1.976815340305844 },
+		{ 0.02532969389660592, 0.9746703061036448, -1.972071298045083 },
+		{ 0.03180771195789074, 0.9681922880422043, -1.964080680251197 },
+		{ 0.04223050331532974, 0.9577694966846801, -1.950484218257796 },
+		{ 0.05001785657602598, 0.9499821434239846, -1.939722816583335 },
+		{ 0.06260375472812528, 0.9373962452719558, -1.921224026261177 },
+		{ 0.08267759122039414, 0.9173224087796253, -1.88883644405978 },
+		{ 0.09753380904399873, 0.9024661909569682, -1.862534279738735 },
+		{ 0.1212880493063797, 0.8787119506961812, -1.816244584825735 },
+		{ 0.1585195983507837, 0.8414804016492542, -1.732856688975128 },
+		{ 0.1855547741814696, 0.8144452258203794, -1.663706411638779 },
+		{ 0.2278658130660425, 0.772134186935479, -1.54035689744841 },
+		{ 0.2919107336402808, 0.7080892663597902, -1.316954421651064 },
+		{ 0.003201866288643763, 0.9967981337113654, -1.996757060234848 },
+		{ 0.003806532025864093, 0.9961934679741439, -1.9961353988494 },
+		{ 0.005077864197470507, 0.9949221358025436, -1.994818734900936 },
+		{ 0.006393487132687735, 0.9936065128673215, -1.993442482915876 },
+		{ 0.007598574365664685, 0.9924014256343514, -1.992169593748362 },
+		{ 0.01012991777617712, 0.989870082224633, -1.989457538864665 },
+		{ 0.01274611051097516, 0.9872538894892359, -1.986599885979389 },
+		{ 0.01513941039893861, 0.9848605896010932, -1.983936825550939 },
+		{ 0.02015728444715758, 0.9798427155528432, -1.97820101732274 },
+		{ 0.02532969389660592, 0.9746703061036448, -1.972071298045083 },
+		{ 0.03004961905065011, 0.969950380949413, -1.966283935281568 },
+		{ 0.03990825277803053, 0.9600917472219703, -1.953593160270272 },
+		{ 0.05001785657602598, 0.9499821434239846, -1.939722816583335 },
+		{ 0.05919625849621272, 0.9408037415039114, -1.926368394147137 },
+		{ 0.07822395757819908, 0.9217760424235261, -1.896331997427839 },
+		{ 0.09753380904399873, 0.9024661909569682, -1.862534279738735 },
+		{ 0.1148885517004107, 0.8851114483060925, -1.829235310265093 },
+		{ 0.1503289276173477, 0.8496710723859783, -1.752362003179018 },
+		{ 0.1855547741814696, 0.8144452258203794, -1.663706411638779 },
+		{ 0.2165772113286436, 0.7834227886713574, -1.57510958880094 },
+		{ 0.2780585962413487, 0.7219414037589278, -1.36911694221468 },
+		{ 0.003201866288643763, 0.9967981337113654, -1.996757060234848 },
+		{ 0.004032420351849574, 0.995967579648152, -1.99590240676733 },
+		{ 0.005077864197470507, 0.9949221358025436, -1.994818734900936 },
+		{ 0.006393487132687735, 0.9936065128673215, -1.993442482915876 },
+		{ 0.008048593274544517, 0.9919514067255844, -1.991691243155729 },
+		{ 0.01012991777617712, 0.989870082224633, -1.989457538864665 },
+		{ 0.01274611051097516, 0.9872538894892359, -1.986599885979389 },
+		{ 0.01603240669539133, 0.9839675933048655, -1.982931177691716 },
+		{ 0.02015728444715758, 0.9798427155528432, -1.97820101732274 },
+		{ 0.02532969389660592, 0.9746703061036448, -1.972071298045083 },
+		{ 0.03180771195789074, 0.9681922880422043, -1.964080680251197 },
+		{ 0.03990825277803053, 0.9600917472219703, -1.953593160270272 },
+		{ 0.05001785657602598, 0.9499821434239846, -1.939722816583335 },
+		{ 0.06260375472812528, 0.9373962452719558, -1.921224026261177 },
+		{ 0.07822395757819908, 0.9217760424235261, -1.896331997427839 },
+		{ 0.09753380904399873, 0.9024661909569682, -1.862534279738735 },
+		{ 0.1212880493063797, 0.8787119506961812, -1.816244584825735 },
+		{ 0.1503289276173477, 0.8496710723859783, -1.752362003179018 },
+		{ 0.1855547741814696, 0.8144452258203794, -1.663706411638779 },
+		{ 0.2278658130660425, 0.772134186935479, -1.54035689744841 },
+		{ 0.2780585962413487, 0.7219414037589278, -1.36911694221468 },
+		{ 0.003201866288643763, 0.9967981337113654, -1.996757060234848 },
+		{ 0.003806532025864093, 0.9961934679741439, -1.9961353988494 },
+		{ 0.005697941137181249, 0.9943020588628291, -1.994171822396902 },
+		{ 0.006393487132687735, 0.9936065128673215, -1.993442482915876 },
+		{ 0.007598574365664685, 0.9924014256343514, -1.992169593748362 },
+		{ 0.01136340279995649, 0.9886365972000836, -1.988117149403563 },
+		{ 0.01274611051097516, 0.9872538894892359, -1.986599885979389 },
+		{ 0.01513941039893861, 0.9848605896010932, -1.983936825550939 },
+		{ 0.02259767867671928, 0.9774023213233605, -1.975336537903339 },
+		{ 0.02532969389660592, 0.9746703061036448, -1.972071298045083 },
+		{ 0.03004961905065011, 0.969950380949413, -1.966283935281568 },
+		{ 0.04468470227186307, 0.9553152977282937, -1.947148728928402 },
+		{ 0.05001785657602598, 0.9499821434239846, -1.939722816583335 },
+		{ 0.05919625849621272, 0.9408037415039114, -1.926368394147137 },
+		{ 0.08737256246672778, 0.9126274375363427, -1.880741141441922 },
+		{ 0.09753380904399873, 0.9024661909569682, -1.862534279738735 },
+		{ 0.1148885517004107, 0.8851114483060925, -1.829235310265093 },
+		{ 0.1671117053831055, 0.8328882946198586, -1.711678582026151 },
+		{ 0.1855547741814696, 0.8144452258203794, -1.663706411638779 },
+		{ 0.2165772113286436, 0.7834227886713574, -1.57510958880094 },
+		{ 0.306296634657814, 0.6937033653424187, -1.260497365967171 },
+		{ 0.003201866288643763, 0.9967981337113654, -1.996757060234848 },
+		{ 0.004793553129661453, 0.995206446870339, -1.995114313795211 },
+		{ 0.006035730563976651, 0.9939642694360237, -1.993818109060076 },
+		{ 0.006393487132687735, 0.9936065128673215, -1.993442482915876 },
+		{ 0.009564102178687457, 0.9904358978218357, -1.990068257175529 },
+		{ 0.01203501815220637, 0.9879649818479194, -1.987382121992113 },
+		{ 0.01274611051097516, 0.9872538894892359, -1.986599885979389 },
+		{ 0.01903679650984277, 0.9809632034902522, -1.979499764664712 },
+		{ 0.02392519464249001, 0.9760748053577598, -1.973757650197085 },
+		{ 0.02532969389660592, 0.9746703061036448, -1.972071298045083 },
+		{ 0.03771119339833019, 0.9622888066018583, -1.956492376078495 },
+		{ 0.04727803670133689, 0.9527219632986798, -1.943568222565742 },
+		{ 0.05001785657602598, 0.9499821434239846, -1.939722816583335 },
+		{ 0.07400025268914147, 0.9259997473112286, -1.903276415136619 },
+		{ 0.09232097946502396, 0.9076790205367768, -1.871992389610808 },
+		{ 0.09753380904399873, 0.9024661909569682, -1.862534279738735 },
+		{ 0.1425244679802554, 0.8574755320204597, -1.770333165268908 },
+		{ 0.1761187956808483, 0.823881204322603, -1.688681565563275 },
+		{ 0.1855547741814696, 0.8144452258203794, -1.663706411638779 },
+		{ 0.2647357119875735, 0.7352642880137701, -1.417267194837147 },
+		{ 0.3212193169032087, 0.6787806830968353, -1.199456770773543 }
+	},
+	.c_bpre9600022 = {
+		{ 0.001602216693488222, 0.9983977833065164, -1.998387506684898 },
+		{ 0.001798251995040575, 0.9982017480049598, -1.998188801530481 },
+		{ 0.002399655738662764, 0.9976003442613375, -1.997577283223565 },
+		{ 0.003201869550653083, 0.9967981304493513, -1.996757056889078 },
+		{ 0.003593270279843708, 0.9964067297201568, -1.996354990509996 },
+		{ 0.004793540102701143, 0.9952064598975611, -1.995114327323801 },
+		{ 0.006393493635923263, 0.9936065063641825, -1.993442476078507 },
+		{ 0.007173628968382158, 0.9928263710316179, -1.992619788024624 },
+		{ 0.009564134590150016, 0.9904358654098977, -1.990068222265821 },
+		{ 0.01274607820308212, 0.9872539217970443, -1.986599921613149 },
+		{ 0.01429579698418819, 0.9857042030158116, -1.98488086689542 },
+		{ 0.01903679650984277, 0.9809632034902522, -1.979499764664712 },
+		{ 0.02532972579237131, 0.9746702742076341, -1.972071259562314 },
+		{ 0.02838722415696337, 0.9716127758430366, -1.968343480294637 },
+		{ 0.03771119339833019, 0.9622888066018583, -1.956492376078495 },
+		{ 0.05001779440032295, 0.9499822056001724, -1.939722904581009 },
+		{ 0.05596861381858907, 0.9440313861814109, -1.931147834504842 },
+		{ 0.07400025268914147, 0.9259997473112286, -1.903276415136619 },
+		{ 0.09753380904399873, 0.9024661909569682, -1.862534279738735 },
+		{ 0.108804741904404, 0.891195258095596, -1.84122780449662 },
+		{ 0.1425244679802554, 0.8574755320204597, -1.770333165268908 },
+		{ 0.001602216693488222, 0.9983977833065164, -1.998387506684898 },
+		{ 0.002018246836070207, 0.9979817531639302, -1.99796544343532 },
+		{ 0.002265127198467978, 0.9977348728015388, -1.997714326344058 },
+		{ 0.003201869550653083, 0.9967981304493513, -1.996757056889078 },
+		{ 0.004032426870504835, 0.9959675731295595, -1.995902400037819 },
+		{ 0.004525110565148678, 0.995474889435039, -1.995392797475744 },
+		{ 0.006393493635923263, 0.9936065063641825, -1.993442476078507 },
+		{ 0.008048593274544517, 0.9919514067255844, -1.991691243155729 },
+		{ 0.009029776933849551, 0.9909702230662784, -1.990642600875287 },
+		{ 0.01274607820308212, 0.9872539217970443, -1.986599921613149 },
+		{ 0.01603237449491755, 0.9839676255051303, -1.982931214071721 },
+		{ 0.0179779848594081, 0.9820220151406239, -1.980717528275909 },
+		{ 0.02532972579237131, 0.9746702742076341, -1.972071259562314 },
+		{ 0.03180774364185535, 0.9681922563581861, -1.964080640311271 },
+		{ 0.03563276177921157, 0.9643672382208521, -1.959197471233227 },
+		{ 0.05001779440032295, 0.9499822056001724, -1.939722904581009 },
+		{ 0.06260363202447335, 0.9373963679768456, -1.921224213340504 },
+		{ 0.06999582984641198, 0.9300041701537132, -1.909713580549767 },
+		{ 0.09753380904399873, 0.9024661909569682, -1.862534279738735 },
+		{ 0.1212883368623883, 0.8787116631384149, -1.816243992388378 },
+		{ 0.1350922434969453, 0.864907756503297, -1.786895143515801 },
+		{ 0.001602216693488222, 0.9983977833065164, -1.998387506684898 },
+		{ 0.001905080679129224, 0.9980949193208749, -1.998080388158578 },
+		{ 0.003022432832100748, 0.9969775671678996, -1.996940971518858 },
+		{ 0.003201869550653083, 0.9967981304493513, -1.996757056889078 },
+		{ 0.003806532025864093, 0.9961934679741439, -1.9961353988494 },
+		{ 0.006035724058558792, 0.9939642759415045, -1.993818115881097 },
+		{ 0.006393493635923263, 0.9936065063641825, -1.993442476078507 },
+		{ 0.007598574365664685, 0.9924014256343514, -1.992169593748362 },
+		{ 0.01203501815220637, 0.9879649818479194, -1.987382121992113 },
+		{ 0.01274607820308212, 0.9872539217970443, -1.986599921613149 },
+		{ 0.01513941039893861, 0.9848605896010932, -1.983936825550939 },
+		{ 0.02392522658422125, 0.9760747734157871, -1.973757612031066 },
+		{ 0.02532972579237131, 0.9746702742076341, -1.972071259562314 },
+		{ 0.03004961905065011, 0.969950380949413, -1.966283935281568 },
+		{ 0.04727809905774619, 0.9527219009431749, -1.943568135781725 },
+		{ 0.05001779440032295, 0.9499822056001724, -1.939722904581009 },
+		{ 0.05919638165034716, 0.9408036183529976, -1.926368210056912 },
+		{ 0.09232097946502396, 0.9076790205367768, -1.871992389610808 },
+		{ 0.09753380904399873, 0.9024661909569682, -1.862534279738735 },
+		{ 0.1148882620418162, 0.8851117379581842, -1.82923588949804 },
+		{ 0.1761185260628829, 0.8238814739371405, -1.688682266214865 },
+		{ 0.001602216693488222, 0.9983977833065164, -1.998387506684898 },
+		{ 0.002018246836070207, 0.9979817531639302, -1.99796544343532 },
+		{ 0.002399655738662764, 0.9976003442613375, -1.997577283223565 },
+		{ 0.003201869550653083, 0.9967981304493513, -1.996757056889078 },
+		{ 0.004032426870504835, 0.9959675731295595, -1.995902400037819 },
+		{ 0.004793540102701143, 0.9952064598975611, -1.995114327323801 },
+		{ 0.006393493635923263, 0.9936065063641825, -1.993442476078507 },
+		{ 0.008048593274544517, 0.9919514067255844, -1.991691243155729 },
+		{ 0.009564134590150016, 0.9904358654098977, -1.990068222265821 },
+		{ 0.01274607820308212, 0.9872539217970443, -1.986599921613149 },
+		{ 0.01603237449491755, 0.9839676255051303, -1.982931214071721 },
+		{ 0.01903679650984277, 0.9809632034902522, -1.979499764664712 },
+		{ 0.02532972579237131, 0.9746702742076341, -1.972071259562314 },
+		{ 0.03180774364185535, 0.9681922563581861, -1.964080640311271 },
+		{ 0.03771119339833019, 0.9622888066018583, -1.956492376078495 },
+		{ 0.05001779440032295, 0.9499822056001724, -1.939722904581009 },
+		{ 0.06260363202447335, 0.9373963679768456, -1.921224213340504 },
+		{ 0.07400025268914147, 0.9259997473112286, -1.903276415136619 },
+		{ 0.09753380904399873, 0.9024661909569682, -1.862534279738735 },
+		{ 0.1212883368623883, 0.8787116631384149, -1.816243992388378 },
+		{ 0.1425244679802554, 0.8574755320204597, -1.770333165268908 },
+		{ 0.001602216693488222, 0.9983977833065164, -1.998387506684898 },
+		{ 0.001905080679129224, 0.9980949193208749, -1.998080388158578 },
+		{ 0.002265127198467978, 0.9977348728015388, -1.997714326344058 },
+		{ 0.003201869550653083, 0.9967981304493513, -1.996757056889078 },
+		{ 0.003806532025864093, 0.9961934679741439, -1.9961353988494 },
+		{ 0.004525110565148678, 0.995474889435039, -1.995392797475744 },
+		{ 0.006393493635923263, 0.9936065063641825, -1.993442476078507 },
+		{ 0.007598574365664685, 0.9924014256343514, -1.992169593748362 },
+		{ 0.009029776933849551, 0.9909702230662784, -1.990642600875287 },
+		{ 0.01274607820308212, 0.9872539217970443, -1.986599921613149 },
+		{ 0.01513941039893861, 0.9848605896010932, -1.983936825550939 },
+		{ 0.0179779848594081, 0.9820220151406239, -1.980717528275909 },
+		{ 0.02532972579237131, 0.9746702742076341, -1.972071259562314 },
+		{ 0.03004961905065011, 0.969950380949413, -1.966283935281568 },
+		{ 0.03563276177921157, 0.9643672382208521, -1.959197471233227 },
+		{ 0.05001779440032295, 0.9499822056001724, -1.939722904581009 },
+		{ 0.05919638165034716, 0.9408036183529976, -1.926368210056912 },
+		{ 0.06999582984641198, 0.9300041701537132, -1.909713580549767 },
+		{ 0.09753380904399873, 0.9024661909569682, -1.862534279738735 },
+		{ 0.1148882620418162, 0.8851117379581842, -1.82923588949804 },
+		{ 0.1350922434969453, 0.864907756503297, -1.786895143515801 },
+		{ 0.001602216693488222, 0.9983977833065164, -1.998387506684898 },
+		{ 0.002138130370567426, 0.9978618696294329, -1.997843563667202 },
+		{ 0.002399655738662764, 0.9976003442613375, -1.997577283223565 },
+		{ 0.003201869550653083, 0.9967981304493513, -1.996757056889078 },
+		{ 0.004271695656773346, 0.995728304343321, -1.995655158803373 },
+		{ 0.004793540102701143, 0.9952064598975611, -1.995114327323801 },
+		{ 0.006393493635923263, 0.9936065063641825, -1.993442476078507 },
+		{ 0.008525143929762899, 0.9914748560704251, -1.991182902834333 },
+		{ 0.009564134590150016, 0.9904358654098977, -1.990068222265821 },
+		{ 0.01274607820308212, 0.9872539217970443, -1.986599921613149 },
+		{ 0.01697757761080473, 0.9830224223892035, -1.981859655685487 },
+		{ 0.01903679650984277, 0.9809632034902522, -1.979499764664712 },
+		{ 0.02532972579237131, 0.9746702742076341, -1.972071259562314 },
+		{ 0.03366685383496548, 0.9663331461662921, -1.961722592845494 },
+		{ 0.03771119339833019, 0.9622888066018583, -1.956492376078495 },
+		{ 0.05001779440032295, 0.9499822056001724, -1.939722904581009 },
+		{ 0.06620025062283011, 0.9337997493796442, -1.915683929838771 },
+		{ 0.07400025268914147, 0.9259997473112286, -1.903276415136619 },
+		{ 0.09753380904399873, 0.9024661909569682, -1.862534279738735 },
+		{ 0.1280183134139537, 0.8719816865860999, -1.802163088738755 },
+		{ 0.1425244679802554, 0.8574755320204597, -1.770333165268908 },
+		{ 0.001602216693488222, 0.9983977833065164, -1.998387506684898 },
+		{ 0.002018246836070207, 0.9979817531639302, -1.99796544343532 },
+		{ 0.002693126506913035, 0.9973068734930874, -1.997277822687978 },
+		{ 0.003201869550653083, 0.9967981304493513, -1.996757056889078 },
+		{ 0.004032426870504835, 0.9959675731295595, -1.995902400037819 },
+		{ 0.00537900659330004, 0.9946209934067776, -1.994504947013024 },
+		{ 0.006393493635923263, 0.9936065063641825, -1.993442476078507 },
+		{ 0.008048593274544517, 0.9919514067255844, -1.991691243155729 },
+		{ 0.01072907947466966, 0.9892709205254852, -1.988807993479254 },
+		{ 0.01274607820308212, 0.9872539217970443, -1.986599921613149 },
+		{ 0.01603237449491755, 0.9839676255051303, -1.982931214071721 },
+		{ 0.02134301377619053, 0.9786569862238147, -1.976815377888588 },
+		{ 0.02532972579237131, 0.9746702742076341, -1.972071259562314 },
+		{ 0.03180774364185535, 0.9681922563581861, -1.964080640311271 },
+		{ 0.04223050331532974, 0.9577694966846801, -1.950484218257796 },
+		{ 0.05001779440032295, 0.9499822056001724, -1.939722904581009 },
+		{ 0.06260363202447335, 0.9373963679768456, -1.921224213340504 },
+		{ 0.08267759122039414, 0.9173224087796253, -1.88883644405978 },
+		{ 0.09753380904399873, 0.9024661909569682, -1.862534279738735 },
+		{ 0.1212883368623883, 0.8787116631384149, -1.816243992388378 },
+		{ 0.1585195983507837, 0.8414804016492542, -1.732856688975128 },
+		{ 0.001602216693488222, 0.9983977833065164, -1.998387506684898 },
+		{ 0.001905080679129224, 0.9980949193208749, -1.998080388158578 },
+		{ 0.002542163396101586, 0.9974578366039056, -1.997431953353165 },
+		{ 0.003201869550653083, 0.9967981304493513, -1.996757056889078 },
+		{ 0.003806532025864093, 0.9961934679741439, -1.9961353988494 },
+		{ 0.005077851174361973, 0.9949221488260438, -1.994818748455509 },
+		{ 0.006393493635923263, 0.9936065063641825, -1.993442476078507 },
+		{ 0.007598574365664685, 0.9924014256343514, -1.992169593748362 },
+		{ 0.01012995016878969, 0.9898700498312105, -1.989457503826128 },
+		{ 0.01274607820308212, 0.9872539217970443, -1.986599921613149 },
+		{ 0.01513941039893861, 0.9848605896010932, -1.983936825550939 },
+		{ 0.02015728444715758, 0.9798427155528432, -1.97820101732274 },
+		{ 0.02532972579237131, 0.9746702742076341, -1.972071259562314 },
+		{ 0.03004961905065011, 0.969950380949413, -1.966283935281568 },
+		{ 0.03990831561676508, 0.9600916843841145, -1.953593076765058 },
+		{ 0.05001779440032295, 0.9499822056001724, -1.939722904581009 },
+		{ 0.05919638165034716, 0.9408036183529976, -1.926368210056912 },
+		{ 0.07822395757819908, 0.9217760424235261, -1.896331997427839 },
+		{ 0.09753380904399873, 0.9024661909569682, -1.862534279738735 },
+		{ 0.1148882620418162, 0.8851117379581842, -1.82923588949804 },
+		{ 0.1503286495599155, 0.8496713504402321, -1.752362654093637 },
+		{ 0.001602216693488222, 0.9983977833065164, -1.998387506684898 },
+		{ 0.002018246836070207, 0.9979817531639302, -1.99796544343532 },
+		{ 0.002542163396101586, 0.9974578366039056, -1.997431953353165 },
+		{ 0.003201869550653083, 0.9967981304493513, -1.996757056889078 },
+		{ 0.004032426870504835, 0.9959675731295595, -1.995902400037819 },
+		{ 0.005077851174361973, 0.9949221488260438, -1.994818748455509 },
+		{ 0.006393493635923263, 0.9936065063641825, -1.993442476078507 },
+		{ 0.008048593274544517, 0.9919514067255844, -1.991691243155729 },
+		{ 0.01012995016878969, 0.9898700498312105, -1.989457503826128 },
+		{ 0.01274607820308212, 0.9872539217970443, -1.986599921613149 },
+		{ 0.01603237449491755, 0.9839676255051303, -1.982931214071721 },
+		{ 0.02015728444715758, 0.9798427155528432, -1.97820101732274 },
+		{ 0.02532972579237131, 0.9746702742076341, -1.972071259562314 },
+		{ 0.03180774364185535, 0.9681922563581861, -1.964080640311271 },
+		{ 0.03990831561676508, 0.9600916843841145, -1.953593076765058 },
+		{ 0.05001779440032295, 0.9499822056001724, -1.939722904581009 },
+		{ 0.06260363202447335, 0.9373963679768456, -1.921224213340504 },
+		{ 0.07822395757819908, 0.9217760424235261, -1.896331997427839 },
+		{ 0.09753380904399873, 0.9024661909569682, -1.862534279738735 },
+		{ 0.1212883368623883, 0.8787116631384149, -1.816243992388378 },
+		{ 0.1503286495599155, 0.8496713504402321, -1.752362654093637 },
+		{ 0.001602216693488222, 0.9983977833065164, -1.998387506684898 },
+		{ 0.001905080679129224, 0.9980949193208749, -1.998080388158578 },
+		{ 0.002853040488605892, 0.9971469595113996, -1.997114353682704 },
+		{ 0.003201869550653083, 0.9967981304493513, -1.996757056889078 },
+		{ 0.003806532025864093, 0.9961934679741439, -1.9961353988494 },
+		{ 0.005697934629499154, 0.9943020653705209, -1.994171829202509 },
+		{ 0.006393493635923263, 0.9936065063641825, -1.993442476078507 },
+		{ 0.007598574365664685, 0.9924014256343514, -1.992169593748362 },
+		{ 0.01136340279995649, 0.9886365972000836, -1.988117149403563 },
+		{ 0.01274607820308212, 0.9872539217970443, -1.986599921613149 },
+		{ 0.01513941039893861, 0.9848605896010932, -1.983936825550939 },
+		{ 0.02259767867671928, 0.9774023213233605, -1.975336537903339 },
+		{ 0.02532972579237131, 0.9746702742076341, -1.972071259562314 },
+		{ 0.03004961905065011, 0.969950380949413, -1.966283935281568 },
+		{ 0.04468463974803309, 0.9553153602535356, -1.94714881456053 },
+		{ 0.05001779440032295, 0.9499822056001724, -1.939722904581009 },
+		{ 0.05919638165034716, 0.9408036183529976, -1.926368210056912 },
+		{ 0.08737286112178211, 0.912627138879761, -1.880740620136492 },
+		{ 0.09753380904399873, 0.9024661909569682, -1.862534279738735 },
+		{ 0.1148882620418162, 0.8851117379581842, -1.82923588949804 },
+		{ 0.1671114328181644, 0.8328885671819604, -1.711679265563538 },
+		{ 0.001602216693488222, 0.9983977833065164, -1.998387506684898 },
+		{ 0.002399655738662764, 0.9976003442613375, -1.997577283223565 },
+		{ 0.003022432832100748, 0.9969775671678996, -1.996940971518858 },
+		{ 0.003201869550653083, 0.9967981304493513, -1.996757056889078 },
+		{ 0.004793540102701143, 0.9952064598975611, -1.995114327323801 },
+		{ 0.006035724058558792, 0.9939642759415045, -1.993818115881097 },
+		{ 0.006393493635923263, 0.9936065063641825, -1.993442476078507 },
+		{ 0.009564134590150016, 0.9904358654098977, -1.990068222265821 },
+		{ 0.01203501815220637, 0.9879649818479194, -1.987382121992113 },
+		{ 0.01274607820308212, 0.9872539217970443, -1.986599921613149 },
+		{ 0.01903679650984277, 0.9809632034902522, -1.979499764664712 },
+		{ 0.02392522658422125, 0.9760747734157871, -1.973757612031066 },
+		{ 0.02532972579237131, 0.9746702742076341, -1.972071259562314 },
+		{ 0.03771119339833019, 0.9622888066018583, -1.956492376078495 },
+		{ 0.04727809905774619, 0.9527219009431749, -1.943568135781725 },
+		{ 0.05001779440032295, 0.9499822056001724, -1.939722904581009 },
+		{ 0.07400025268914147, 0.9259997473112286, -1.903276415136619 },
+		{ 0.09232097946502396, 0.9076790205367768, -1.871992389610808 },
+		{ 0.09753380904399873, 0.9024661909569682, -1.862534279738735 },
+		{ 0.1425244679802554, 0.8574755320204597, -1.770333165268908 },
+		{ 0.1761185260628829, 0.8238814739371405, -1.688682266214865 }
+	},
+	.c_bpre4800080040 = {
+		{ 0.0001603495931073119, 0.9999919825240636, -1.999950843351133 },
+		{ 0.0001799862692379033, 0.9999910006865385, -1.999939168585815 },
+		{ 0.0002402525133026303, 0.999987987374518, -1.999895633501168 },
+		{ 0.0003206981509704915, 0.9999839650960449, -1.999819410420593 },
+		{ 0.0003599709187077813, 0.9999820014540647, -1.999774676670639 },
+		{ 0.0004805050298573805, 0.9999759749587874, -1.999606572226021 },
+		{ 0.0006413933699626556, 0.9999679304164839, -1.999309742726944 },
+		{ 0.0007199353584600718, 0.9999640032320768, -1.999134754544961 },
+		{ 0.0009609941450424898, 0.9999519503311609, -1.998474483547209 },
+		{ 0.001282761530290752, 0.99993586202504, -1.997303600119783 },
+		{ 0.001439844801581978, 0.999928007759921, -1.996611760364314 },
+		{ 0.001921942114637871, 0.9999039029710927, -1.993996360723552 },
+		{ 0.00256544008444602, 0.9998717280001567, -1.989349920009726 },
+		{ 0.002879585945502869, 0.9998560207027247, -1.986602506088068 },
+		{ 0.003843699536351093, 0.9998078151768245, -1.976213680582106 },
+		{ 0.005130552499903791, 0.9997434727811843, -1.957769755091089 },
+		{ 0.005758757290257835, 0.9997120621354871, -1.946877475516094 },
+		{ 0.007686660371978903, 0.9996156672886553, -1.905804880099845 },
+		{ 0.01025978887345443, 0.9994870113685824, -1.833375465653553 },
+		{ 0.01151585641623928, 0.999424207179188, -1.790907776077773 },
+		{ 0.01537036650894814, 0.9992314822889434, -1.632860892900521 },
+		{ 0.0001603495931073119, 0.9999919825240636, -1.999950843351133 },
+		{ 0.0002020276145478931, 0.9999898986198159, -1.999924594401133 },
+		{ 0.0002267684702885599, 0.9999886615818823, -1.99990638345531 },
+		{ 0.0003206981509704915, 0.9999839650960449, -1.999819410420593 },
+		{ 0.0004040548563145437, 0.9999797973089454, -1.999718585171967 },
+		{ 0.0004535358527901039, 0.9999773233577725, -1.999648221386612 },
+		{ 0.0006413933699626556, 0.9999679304164839, -1.999309742726944 },
+		{ 0.0008081015496520695, 0.9999595950260391, -1.998914825264178 },
+		{ 0.0009070607347291105, 0.9999546470661576, -1.998638352918822 },
+		{ 0.001282761530290752, 0.99993586202504, -1.997303600119783 },
+		{ 0.001616163804652782, 0.999919191848252, -1.995741305683054 },
+		{ 0.001814073462184046, 0.999909296352814, -1.994645990766496 },
+		{ 0.00256544008444602, 0.9998717280001567, -1.989349920009726 },
+		{ 0.003232199412693112, 0.9998383900628629, -1.98314494157025 },
+		{ 0.003627982381309483, 0.9998186009327792, -1.978794035731978 },
+		{ 0.005130552499903791, 0.9997434727811843, -1.957769755091089 },
+		{ 0.006463883821208399, 0.9996768068977846, -1.933187347098545 },
+		{ 0.007255306649982921, 0.9996372347711799, -1.915988633294648 },
+		{ 0.01025978887345443, 0.9994870113685824, -1.833375465653553 },
+		{ 0.01292568137550575, 0.9993537166141615, -1.737858402905473 },
+		{ 0.01450798132700733, 0.9992746011409711, -1.671737962592194 },
+		{ 0.0001603495931073119, 0.9999919825240636, -1.999950843351133 },
+		{ 0.0001906889201534229, 0.9999904655571863, -1.999932285978054 },
+		{ 0.0003026986714271285, 0.9999848650665017, -1.999838263372452 },
+		{ 0.0003206981509704915, 0.9999839650960449, -1.999819410420593 },
+		{ 0.0003813760221932181, 0.9999809312052784, -1.999748217383028 },
+		{ 0.0006053931155918867, 0.9999697303947933, -1.999383350816027 },
+		{ 0.0006413933699626556, 0.9999679304164839, -1.999309742726944 },
+		{ 0.0007627447720074379, 0.9999618627741754, -1.999031070515955 },
+		{ 0.001210767906161515, 0.9999394617058355, -1.9975943227302 },
+		{ 0.001282761530290752, 0.99993586202504, -1.997303600119783 },
+		{ 0.001525460455043487, 0.9999237270027994, -1.996201495338461 },
+		{ 0.002421461876222308, 0.9998789269129513, -1.990504129302991 },
+		{ 0.00256544008444602, 0.9998717280001567, -1.989349920009726 },
+		{ 0.003050804558647559, 0.9998474598231686, -1.984972955964274 },
+		{ 0.00484265194137008, 0.9997578681574255, -1.962348733697547 },
+		{ 0.005130552499903791, 0.9997434727811843, -1.957769755091089 },
+		{ 0.006101209910639277, 0.9996949422605439, -1.940422462249227 },
+		{ 0.009684131322499557, 0.9995157949426802, -1.85129681415655 },
+		{ 0.01025978887345443, 0.9994870113685824, -1.833375465653553 },
+		{ 0.0122004156783339, 0.9993899792165599, -1.765850670972606 },
+		{ 0.01936348092095433, 0.9990318259745596, -1.428270102724889 },
+		{ 0.0001603495931073119, 0.9999919825240636, -1.999950843351133 },
+		{ 0.0002020276145478931, 0.9999898986198159, -1.999924594401133 },
+		{ 0.0002402525133026303, 0.999987987374518, -1.999895633501168 },
+		{ 0.0003206981509704915, 0.9999839650960449, -1.999819410420593 },
+		{ 0.0004040548563145437, 0.9999797973089454, -1.999718585171967 },
+		{ 0.0004805050298573805, 0.9999759749587874, -1.999606572226021 },
+		{ 0.0006413933699626556, 0.9999679304164839, -1.999309742726944 },
+		{ 0.0008081015496520695, 0.9999595950260391, -1.998914825264178 },
+		{ 0.0009609941450424898, 0.9999519503311609, -1.998474483547209 },
+		{ 0.001282761530290752, 0.99993586202504, -1.997303600119783 },
+		{ 0.001616163804652782, 0.999919191848252, -1.995741305683054 },
+		{ 0.001921942114637871, 0.9999039029710927, -1.993996360723552 },
+		{ 0.00256544008444602, 0.9998717280001567, -1.989349920009726 },
+		{ 0.003232199412693112, 0.9998383900628629, -1.98314494157025 },
+		{ 0.003843699536351093, 0.9998078151768245, -1.976213680582106 },
+		{ 0.005130552499903791, 0.9997434727811843, -1.957769755091089 },
+		{ 0.006463883821208399, 0.9996768068977846, -1.933187347098545 },
+		{ 0.007686660371978903, 0.9996156672886553, -1.905804880099845 },
+		{ 0.01025978887345443, 0.9994870113685824, -1.833375465653553 },
+		{ 0.01292568137550575, 0.9993537166141615, -1.737858402905473 },
+		{ 0.01537036650894814, 0.9992314822889434, -1.632860892900521 },
+		{ 0.0001603495931073119, 0.9999919825240636, -1.999950843351133 },
+		{ 0.0001906889201534229, 0.9999904655571863, -1.999932285978054 },
+		{ 0.0002267684702885599, 0.9999886615818823, -1.99990638345531 },
+		{ 0.0003206981509704915, 0.9999839650960449, -1.999819410420593 },
+		{ 0.0003813760221932181, 0.9999809312052784, -1.999748217383028 },
+		{ 0.0004535358527901039, 0.9999773233577725, -1.999648221386612 },
+		{ 0.0006413933699626556, 0.9999679304164839, -1.999309742726944 },
+		{ 0.0007627447720074379, 0.9999618627741754, -1.999031070515955 },
+		{ 0.0009070607347291105, 0.9999546470661576, -1.998638352918822 },
+		{ 0.001282761530290752, 0.99993586202504, -1.997303600119783 },
+		{ 0.001525460455043487, 0.9999237270027994, -1.996201495338461 },
+		{ 0.001814073462184046, 0.999909296352814, -1.994645990766496 },
+		{ 0.00256544008444602, 0.9998717280001567, -1.989349920009726 },
+		{ 0.003050804558647559, 0.9998474598231686, -1.984972955964274 },
+		{ 0.003627982381309483, 0.9998186009327792, -1.978794035731978 },
+		{ 0.005130552499903791, 0.9997434727811843, -1.957769755091089 },
+		{ 0.006101209910639277, 0.9996949422605439, -1.940422462249227 },
+		{ 0.007255306649982921, 0.9996372347711799, -1.915988633294648 },
+		{ 0.01025978887345443, 0.9994870113685824, -1.833375465653553 },
+		{ 0.0122004156783339, 0.9993899792165599, -1.765850670972606 },
+		{ 0.01450798132700733, 0.9992746011409711, -1.671737962592194 },
+		{ 0.0001603495931073119, 0.9999919825240636, -1.999950843351133 },
+		{ 0.0002140408029515046, 0.9999892979600933, -1.999915996474394 },
+		{ 0.0002402525133026303, 0.999987987374518, -1.999895633501168 },
+		{ 0.0003206981509704915, 0.9999839650960449, -1.999819410420593 },
+		{ 0.0004280814727634833, 0.9999785960019963, -1.999685396104728 },
+		{ 0.0004805050298573805, 0.9999759749587874, -1.999606572226021 },
+		{ 0.0006413933699626556, 0.9999679304164839, -1.999309742726944 },
+		{ 0.0008561537828800881, 0.9999571924621234, -1.998784491390396 },
+		{ 0.0009609941450424898, 0.9999519503311609, -1.998474483547209 },
+		{ 0.001282761530290752, 0.99993586202504, -1.997303600119783 },
+		{ 0.001712261729676578, 0.9999143869203432, -1.99522507617636 },
+		{ 0.001921942114637871, 0.9999039029710927, -1.993996360723552 },
+		{ 0.00256544008444602, 0.9998717280001567, -1.989349920009726 },
+		{ 0.0034243905143373, 0.9998287814974788, -1.98109440254788 },
+		{ 0.003843699536351093, 0.9998078151768245, -1.976213680582106 },
+		{ 0.005130552499903791, 0.9997434727811843, -1.957769755091089 },
+		{ 0.006848194709681473, 0.9996575923107331, -1.925077468264887 },
+		{ 0.007686660371978903, 0.9996156672886553, -1.905804880099845 },
+		{ 0.01025978887345443, 0.9994870113685824, -1.833375465653553 },
+		{ 0.01369399632535796, 0.9993153002293662, -1.70660670088199 },
+		{ 0.01537036650894814, 0.9992314822889434, -1.632860892900521 },
+		{ 0.0001603495931073119, 0.9999919825240636, -1.999950843351133 },
+		{ 0.0002020276145478931, 0.9999898986198159, -1.999924594401133 },
+		{ 0.0002696741374074438, 0.9999865162934245, -1.999870158017709 },
+		{ 0.0003206981509704915, 0.9999839650960449, -1.999819410420593 },
+		{ 0.0004040548563145437, 0.9999797973089454, -1.999718585171967 },
+		{ 0.0005393465286912328, 0.9999730327359353, -1.999507615180677 },
+		{ 0.0006413933699626556, 0.9999679304164839, -1.999309742726944 },
+		{ 0.0008081015496520695, 0.9999595950260391, -1.998914825264178 },
+		{ 0.001078678512694529, 0.999946066199104, -1.998084637693308 },
+		{ 0.001282761530290752, 0.99993586202504, -1.997303600119783 },
+		{ 0.001616163804652782, 0.999919191848252, -1.995741305683054 },
+		{ 0.002157290668922532, 0.9998921354706697, -1.99245010970846 },
+		{ 0.00256544008444602, 0.9998717280001567, -1.989349920009726 },
+		{ 0.003232199412693112, 0.9998383900628629, -1.98314494157025 },
+		{ 0.004314348642712832, 0.9997842825760958, -1.970073168649486 },
+		{ 0.005130552499903791, 0.9997434727811843, -1.957769755091089 },
+		{ 0.006463883821208399, 0.9996768068977846, -1.933187347098545 },
+		{ 0.008627766605252468, 0.9995686116861983, -1.881619723307976 },
+		{ 0.01025978887345443, 0.9994870113685824, -1.833375465653553 },
+		{ 0.01292568137550575, 0.9993537166141615, -1.737858402905473 },
+		{ 0.01725181129280358, 0.9991374094682743, -1.541355538462134 },
+		{ 0.0001603495931073119, 0.9999919825240636, -1.999950843351133 },
+		{ 0.0001906889201534229, 0.9999904655571863, -1.999932285978054 },
+		{ 0.000254538511871426, 0.9999872730800867, -1.99988360964204 },
+		{ 0.0003206981509704915, 0.9999839650960449, -1.999819410420593 },
+		{ 0.0003813760221932181, 0.9999809312052784, -1.999748217383028 },
+		{ 0.0005090787622234937, 0.9999745463875961, -1.999559908152373 },
+		{ 0.0006413933699626556, 0.9999679304164839, -1.999309742726944 },
+		{ 0.0007627447720074379, 0.9999618627741754, -1.999031070515955 },
+		{ 0.001018134814320826, 0.9999490932594624, -1.998290722692466 },
+		{ 0.001282761530290752, 0.99993586202504, -1.997303600119783 },
+		{ 0.001525460455043487, 0.9999237270027994, -1.996201495338461 },
+		{ 0.002036217798719734, 0.9998981891104207, -1.993267625875558 },
+		{ 0.00256544008444602, 0.9998717280001567, -1.989349920009726 },
+		{ 0.003050804558647559, 0.9998474598231686, -1.984972955964274 },
+		{ 0.004072249170363887, 0.9997963882591158, -1.973319364839386 },
+		{ 0.005130552499903791, 0.9997434727811843, -1.957769755091089 },
+		{ 0.006101209910639277, 0.9996949422605439, -1.940422462249227 },
+		{ 0.008143669182978703, 0.9995928179759731, -1.894396538041369 },
+		{ 0.01025978887345443, 0.9994870113685824, -1.833375465653553 },
+		{ 0.0122004156783339, 0.9993899792165599, -1.765850670972606 },
+		{ 0.01628393486402549, 0.999185803384061, -1.589554178814092 },
+		{ 0.0001603495931073119, 0.9999919825240636, -1.999950843351133 },
+		{ 0.0002020276145478931, 0.9999898986198159, -1.999924594401133 },
+		{ 0.000254538511871426, 0.9999872730800867, -1.99988360964204 },
+		{ 0.0003206981509704915, 0.9999839650960449, -1.999819410420593 },
+		{ 0.0004040548563145437, 0.9999797973089454, -1.999718585171967 },
+		{ 0.0005090787622234937, 0.9999745463875961, -1.999559908152373 },
+		{ 0.0006413933699626556, 0.9999679304164839, -1.999309742726944 },
+		{ 0.0008081015496520695, 0.9999595950260391, -1.998914825264178 },
+		{ 0.001018134814320826, 0.9999490932594624, -1.998290722692466 },
+		{ 0.001282761530290752, 0.99993586202504, -1.997303600119783 },
+		{ 0.001616163804652782, 0.999919191848252, -1.995741305683054 },
+		{ 0.002036217798719734, 0.9998981891104207, -1.993267625875558 },
+		{ 0.00256544008444602, 0.9998717280001567, -1.989349920009726 },
+		{ 0.003232199412693112, 0.9998383900628629, -1.98314494157025 },
+		{ 0.004072249170363887, 0.9997963882591158, -1.973319364839386 },
+		{ 0.005130552499903791, 0.9997434727811843, -1.957769755091089 },
+		{ 0.006463883821208399, 0.9996768068977846, -1.933187347098545 },
+		{ 0.008143669182978703, 0.9995928179759731, -1.894396538041369 },
+		{ 0.01025978887345443, 0.9994870113685824, -1.833375465653553 },
+		{ 0.01292568137550575, 0.9993537166141615, -1.737858402905473 },
+		{ 0.01628393486402549, 0.999185803384061, -1.589554178814092 },
+		{ 0.0001603495931073119, 0.9999919825240636, -1.999950843351133 },
+		{ 0.0001906889201534229, 0.9999904655571863, -1.999932285978054 },
+		{ 0.0002857098610605677, 0.9999857145112071, -1.999855106878225 },
+		{ 0.0003206981509704915, 0.9999839650960449, -1.999819410420593 },
+		{ 0.0003813760221932181, 0.9999809312052784, -1.999748217383028 },
+		{ 0.0005714151369485634, 0.999971429259213, -1.999449020713854 },
+		{ 0.0006413933699626556, 0.9999679304164839, -1.999309742726944 },
+		{ 0.0007627447720074379, 0.9999618627741754, -1.999031070515955 },
+		{ 0.001142813948150687, 0.9999428593347134, -1.997853527914739 },
+		{ 0.001282761530290752, 0.99993586202504, -1.997303600119783 },
+		{ 0.001525460455043487, 0.9999237270027994, -1.996201495338461 },
+		{ 0.002285562595138271, 0.9998857219344829, -1.991533000325126 },
+		{ 0.00256544008444602, 0.9998717280001567, -1.989349920009726 },
+		{ 0.003050804558647559, 0.9998474598231686, -1.984972955964274 },
+		{ 0.0045708805524548, 0.9997714572556161, -1.966432342927127 },
+		{ 0.005130552499903791, 0.9997434727811843, -1.957769755091089 },
+		{ 0.006101209910639277, 0.9996949422605439, -1.940422462249227 },
+		{ 0.009140723647190216, 0.9995429651075202, -1.867312305528995 },
+		{ 0.01025978887345443, 0.9994870113685824, -1.833375465653553 },
+		{ 0.0122004156783339, 0.9993899792165599, -1.765850670972606 },
+		{ 0.01827718755928944, 0.9990861407306839, -1.487771038503012 },
+		{ 0.0001603495931073119, 0.9999919825240636, -1.999950843351133 },
+		{ 0.0002402525133026303, 0.999987987374518, -1.999895633501168 },
+		{ 0.0003026986714271285, 0.9999848650665017, -1.999838263372452 },
+		{ 0.0003206981509704915, 0.9999839650960449, -1.999819410420593 },
+		{ 0.0004805050298573805, 0.9999759749587874, -1.999606572226021 },
+		{ 0.0006053931155918867, 0.9999697303947933, -1.999383350816027 },
+		{ 0.0006413933699626556, 0.9999679304164839, -1.999309742726944 },
+		{ 0.0009609941450424898, 0.9999519503311609, -1.998474483547209 },
+		{ 0.001210767906161515, 0.9999394617058355, -1.9975943227302 },
+		{ 0.001282761530290752, 0.99993586202504, -1.997303600119783 },
+		{ 0.001921942114637871, 0.9999039029710927, -1.993996360723552 },
+		{ 0.002421461876222308, 0.9998789269129513, -1.990504129302991 },
+		{ 0.00256544008444602, 0.9998717280001567, -1.989349920009726 },
+		{ 0.003843699536351093, 0.9998078151768245, -1.976213680582106 },
+		{ 0.00484265194137008, 0.9997578681574255, -1.962348733697547 },
+		{ 0.005130552499903791, 0.9997434727811843, -1.957769755091089 },
+		{ 0.007686660371978903, 0.9996156672886553, -1.905804880099845 },
+		{ 0.009684131322499557, 0.9995157949426802, -1.85129681415655 },
+		{ 0.01025978887345443, 0.9994870113685824, -1.833375465653553 },
+		{ 0.01537036650894814, 0.9992314822889434, -1.632860892900521 },
+		{ 0.01936348092095433, 0.9990318259745596, -1.428270102724889 }
+	},
+	.c_bpre9600080040 = {
+		{ 8.017495725848303e-05, 0.9999959912539967, -1.999985706413705 },
+		{ 8.999333708739178e-05, 0.9999955003331457, -1.999982542236833 },
+		{ 0.000120126617415889, 0.9999939936692211, -1.999970904998273 },
+		{ 0.0001603497182797666, 0.9999919825158824, -1.999950843258994 },
+		{ 0.0001799862692379033, 0.9999910006865385, -1.999939168585815 },
+		{ 0.0002402539579671925, 0.9999879874072427, -1.999895634037066 },
+		{ 0.0003206992561748759, 0.9999839650796827, -1.999819410068407 },
+		{ 0.0003599709187077813, 0.9999820014540647, -1.999774676670639 },
+		{ 0.0004805028445858339, 0.9999759748769773, -1.99960656962848 },
+		{ 0.0006413910496939774, 0.9999679304982937, -1.999309746166673 },
+		{ 0.0007199353584600718, 0.9999640032320768, -1.999134754544961 },
+		{ 0.0009609941450424898, 0.9999519503311609, -1.998474483547209 },
+		{ 0.001282761179125894, 0.9999358619432331, -1.997303593324514 },
+		{ 0.001439844801581978, 0.999928007759921, -1.996611760364314 },
+		{ 0.001921942114637871, 0.9999039029710927, -1.993996360723552 },
+		{ 0.002565440786858962, 0.9998717281637601, -1.989349946990546 },
+		{ 0.002879585945502869, 0.9998560207027247, -1.986602506088068 },
+		{ 0.003843699536351093, 0.9998078151768245, -1.976213680582106 },
+		{ 0.005130552499903791, 0.9997434727811843, -1.957769755091089 },
+		{ 0.005758757290257835, 0.9997120621354871, -1.946877475516094 },
+		{ 0.007686660371978903, 0.9996156672886553, -1.905804880099845 },
+		{ 8.017495725848303e-05, 0.9999959912539967, -1.999985706413705 },
+		{ 0.0001010140623681478, 0.999994949297153, -1.999978623134617 },
+		{ 0.0001133845565560898, 0.9999943307748709, -1.999973761079143 },
+		{ 0.0001603497182797666, 0.9999919825158824, -1.999950843258994 },
+		{ 0.0002020284485491571, 0.9999898986034534, -1.99992459417321 },
+		{ 0.0002267692119973054, 0.9999886616146065, -1.999906383962968 },
+		{ 0.0003206992561748759, 0.9999839650796827, -1.999819410068407 },
+		{ 0.0004040548563145437, 0.9999797973089454, -1.999718585171967 },
+		{ 0.0004535355097153633, 0.9999773232759618, -1.999648218930248 },
+		{ 0.0006413910496939774, 0.9999679304982937, -1.999309746166673 },
+		{ 0.0008080982278907826, 0.9999595951078482, -1.998914829576402 },
+		{ 0.0009070572999136622, 0.9999546471479662, -1.998638357748879 },
+		{ 0.001282761179125894, 0.9999358619432331, -1.997303593324514 },
+		{ 0.001616165006075819, 0.9999191917664461, -1.995741297145098 },
+		{ 0.001814073462184046, 0.999909296352814, -1.994645990766496 },
+		{ 0.002565440786858962, 0.9998717281637601, -1.989349946990546 },
+		{ 0.003232203088139012, 0.9998383903900593, -1.983145009401197 },
+		{ 0.003627982381309483, 0.9998186009327792, -1.978794035731978 },
+		{ 0.005130552499903791, 0.9997434727811843, -1.957769755091089 },
+		{ 0.006463885231962107, 0.9996768060799256, -1.93318701161995 },
+		{ 0.007255306649982921, 0.9996372347711799, -1.915988633294648 },
+		{ 8.017495725848303e-05, 0.9999959912539967, -1.999985706413705 },
+		{ 9.534468734389889e-05, 0.99999523276723, -1.999980687784888 },
+		{ 0.0001513499083880542, 0.9999924325046172, -1.999955781606605 },
+		{ 0.0001603497182797666, 0.9999919825158824, -1.999950843258994 },
+		{ 0.0001906889201534229, 0.9999904655571863, -1.999932285978054 },
+		{ 0.0003026988484489674, 0.9999848650828639, -1.99983826370579 },
+		{ 0.0003206992561748759, 0.9999839650796827, -1.999819410068407 },
+		{ 0.0003813760221932181, 0.9999809312052784, -1.999748217383028 },
+		{ 0.0006053931155918867, 0.9999697303947933, -1.999383350816027 },
+		{ 0.0006413910496939774, 0.9999679304982937, -1.999309746166673 },
+		{ 0.0007627447720074379, 0.9999618627741754, -1.999031070515955 },
+		{ 0.001210767587062398, 0.999939461624028, -1.997594316311407 },
+		{ 0.001282761179125894, 0.9999358619432331, -1.997303593324514 },
+		{ 0.001525460455043487, 0.9999237270027994, -1.996201495338461 },
+		{ 0.002421472558462221, 0.9998789267493468, -1.990504103822282 },
+		{ 0.002565440786858962, 0.9998717281637601, -1.989349946990546 },
+		{ 0.003050837643482306, 0.9998474594959691, -1.984972891902056 },
+		{ 0.00484265194137008, 0.9997578681574255, -1.962348733697547 },
+		{ 0.005130552499903791, 0.9997434727811843, -1.957769755091089 },
+		{ 0.006101138436417942, 0.9996949430784174, -1.94042277933557 },
+		{ 0.00968408499798051, 0.9995157957604071, -1.851297309379625 },
+		{ 8.017495725848303e-05, 0.9999959912539967, -1.999985706413705 },
+		{ 0.0001010140623681478, 0.999994949297153, -1.999978623134617 },
+		{ 0.000120126617415889, 0.9999939936692211, -1.999970904998273 },
+		{ 0.0001603497182797666, 0.9999919825158824, -1.999950843258994 },
+		{ 0.0002020284485491571, 0.9999898986034534, -1.99992459417321 },
+		{ 0.0002402539579671925, 0.9999879874072427, -1.999895634037066 },
+		{ 0.0003206992561748759, 0.9999839650796827, -1.999819410068407 },
+		{ 0.0004040548563145437, 0.9999797973089454, -1.999718585171967 },
+		{ 0.0004805028445858339, 0.9999759748769773, -1.99960656962848 },
+		{ 0.0006413910496939774, 0.9999679304982937, -1.999309746166673 },
+		{ 0.0008080982278907826, 0.9999595951078482, -1.998914829576402 },
+		{ 0.0009609941450424898, 0.9999519503311609, -1.998474483547209 },
+		{ 0.001282761179125894, 0.9999358619432331, -1.997303593324514 },
+		{ 0.001616165006075819, 0.9999191917664461, -1.995741297145098 },
+		{ 0.001921942114637871, 0.9999039029710927, -1.993996360723552 },
+		{ 0.002565440786858962, 0.9998717281637601, -1.989349946990546 },
+		{ 0.003232203088139012, 0.9998383903900593, -1.983145009401197 },
+		{ 0.003843699536351093, 0.9998078151768245, -1.976213680582106 },
+		{ 0.005130552499903791, 0.9997434727811843, -1.957769755091089 },
+		{ 0.006463885231962107, 0.9996768060799256, -1.93318701161995 },
+		{ 0.007686660371978903, 0.9996156672886553, -1.905804880099845 },
+		{ 8.017495725848303e-05, 0.9999959912539967, -1.999985706413705 },
+		{ 9.534468734389889e-05, 0.99999523276723, -1.999980687784888 },
+		{ 0.0001133845565560898, 0.9999943307748709, -1.999973761079143 },
+		{ 0.0001603497182797666, 0.9999919825158824, -1.999950843258994 },
+		{ 0.0001906889201534229, 0.9999904655571863, -1.999932285978054 },
+		{ 0.0002267692119973054, 0.9999886616146065, -1.999906383962968 },
+		{ 0.0003206992561748759, 0.9999839650796827, -1.999819410068407 },
+		{ 0.0003813760221932181, 0.9999809312052784, -1.999748217383028 },
+		{ 0.0004535355097153633, 0.9999773232759618, -1.999648218930248 },
+		{ 0.0006413910496939774, 0.9999679304982937, -1.999309746166673 },
+		{ 0.0007627447720074379, 0.9999618627741754, -1.999031070515955 },
+		{ 0.0009070572999136622, 0.9999546471479662, -1.998638357748879 },
+		{ 0.001282761179125894, 0.9999358619432331, -1.997303593324514 },
+		{ 0.001525460455043487, 0.9999237270027994, -1.996201495338461 },
+		{ 0.001814073462184046, 0.999909296352814, -1.994645990766496 },
+		{ 0.002565440786858962, 0.9998717281637601, -1.989349946990546 },
+		{ 0.003050837643482306, 0.9998474594959691, -1.984972891902056 },
+		{ 0.003627982381309483, 0.9998186009327792, -1.978794035731978 },
+		{ 0.005130552499903791, 0.9997434727811843, -1.957769755091089 },
+		{ 0.006101138436417942, 0.9996949430784174, -1.94042277933557 },
+		{ 0.007255306649982921, 0.9996372347711799, -1.915988633294648 },
+		{ 8.017495725848303e-05, 0.9999959912539967, -1.999985706413705 },
+		{ 0.000107020687815012, 0.9999946489657299, -1.999976323461319 },
+		{ 0.000120126617415889, 0.9999939936692211, -1.999970904998273 },
+		{ 0.0001603497182797666, 0.9999919825158824, -1.999950843258994 },
+		{ 0.0002140418817224206, 0.999989297943731, -1.999915996233891 },
+		{ 0.0002402539579671925, 0.9999879874072427, -1.999895634037066 },
+		{ 0.0003206992561748759, 0.9999839650796827, -1.999819410068407 },
+		{ 0.0004280814727634833, 0.9999785960019963, -1.999685396104728 },
+		{ 0.0004805028445858339, 0.9999759748769773, -1.99960656962848 },
+		{ 0.0006413910496939774, 0.9999679304982937, -1.999309746166673 },
+		{ 0.0008561491896146907, 0.9999571925439324, -1.998784495954072 },
+		{ 0.0009609941450424898, 0.9999519503311609, -1.998474483547209 },
+		{ 0.001282761179125894, 0.9999358619432331, -1.997303593324514 },
+		{ 0.00171226855332445, 0.9999143870839539, -1.995225094256315 },
+		{ 0.001921942114637871, 0.9999039029710927, -1.993996360723552 },
+		{ 0.002565440786858962, 0.9998717281637601, -1.989349946990546 },
+		{ 0.0034243905143373, 0.9998287814974788, -1.98109440254788 },
+		{ 0.003843699536351093, 0.9998078151768245, -1.976213680582106 },
+		{ 0.005130552499903791, 0.9997434727811843, -1.957769755091089 },
+		{ 0.006848170598617235, 0.9996575914928905, -1.925077113377608 },
+		{ 0.007686660371978903, 0.9996156672886553, -1.905804880099845 },
+		{ 8.017495725848303e-05, 0.9999959912539967, -1.999985706413705 },
+		{ 0.0001010140623681478, 0.999994949297153, -1.999978623134617 },
+		{ 0.0001348375232386478, 0.9999932581239859, -1.999964168245442 },
+		{ 0.0001603497182797666, 0.9999919825158824, -1.999950843258994 },
+		{ 0.0002020284485491571, 0.9999898986034534, -1.99992459417321 },
+		{ 0.000269675082457539, 0.9999865162770624, -1.999870157718951 },
+		{ 0.0003206992561748759, 0.9999839650796827, -1.999819410068407 },
+		{ 0.0004040548563145437, 0.9999797973089454, -1.999718585171967 },
+		{ 0.0005393465286912328, 0.9999730327359353, -1.999507615180677 },
+		{ 0.0006413910496939774, 0.9999679304982937, -1.999309746166673 },
+		{ 0.0008080982278907826, 0.9999595951078482, -1.998914829576402 },
+		{ 0.001078674422920264, 0.9999460662809119, -1.998084643421218 },
+		{ 0.001282761179125894, 0.9999358619432331, -1.997303593324514 },
+		{ 0.001616165006075819, 0.9999191917664461, -1.995741297145098 },
+		{ 0.002157290668922532, 0.9998921354706697, -1.99245010970846 },
+		{ 0.002565440786858962, 0.9998717281637601, -1.989349946990546 },
+		{ 0.003232203088139012, 0.9998383903900593, -1.983145009401197 },
+		{ 0.004314348642712832, 0.9997842825760958, -1.970073168649486 },
+		{ 0.005130552499903791, 0.9997434727811843, -1.957769755091089 },
+		{ 0.006463885231962107, 0.9996768060799256, -1.93318701161995 },
+		{ 0.008627766605252468, 0.9995686116861983, -1.881619723307976 },
+		{ 8.017495725848303e-05, 0.9999959912539967, -1.999985706413705 },
+		{ 9.534468734389889e-05, 0.99999523276723, -1.999980687784888 },
+		{ 0.00012726966087585, 0.9999936365197964, -1.999967720409916 },
+		{ 0.0001603497182797666, 0.9999919825158824, -1.999950843258994 },
+		{ 0.0001906889201534229, 0.9999904655571863, -1.999932285978054 },
+		{ 0.0002545410008714389, 0.9999872731128111, -1.999883610207857 },
+		{ 0.0003206992561748759, 0.9999839650796827, -1.999819410068407 },
+		{ 0.0003813760221932181, 0.9999809312052784, -1.999748217383028 },
+		{ 0.0005090738860599832, 0.9999745463057859, -1.999559905405264 },
+		{ 0.0006413910496939774, 0.9999679304982937, -1.999309746166673 },
+		{ 0.0007627447720074379, 0.9999618627741754, -1.999031070515955 },
+		{ 0.001018134814320826, 0.9999490932594624, -1.998290722692466 },
+		{ 0.001282761179125894, 0.9999358619432331, -1.997303593324514 },
+		{ 0.001525460455043487, 0.9999237270027994, -1.996201495338461 },
+		{ 0.002036228240448031, 0.9998981889468129, -1.993267604412823 },
+		{ 0.002565440786858962, 0.9998717281637601, -1.989349946990546 },
+		{ 0.003050837643482306, 0.9998474594959691, -1.984972891902056 },
+		{ 0.004072249170363887, 0.9997963882591158, -1.973319364839386 },
+		{ 0.005130552499903791, 0.9997434727811843, -1.957769755091089 },
+		{ 0.006101138436417942, 0.9996949430784174, -1.94042277933557 },
+		{ 0.008143625397619373, 0.9995928187937629, -1.894396957711739 },
+		{ 8.017495725848303e-05, 0.9999959912539967, -1.999985706413705 },
+		{ 0.0001010140623681478, 0.999994949297153, -1.999978623134617 },
+		{ 0.00012726966087585, 0.9999936365197964, -1.999967720409916 },
+		{ 0.0001603497182797666, 0.9999919825158824, -1.999950843258994 },
+		{ 0.0002020284485491571, 0.9999898986034534, -1.99992459417321 },
+		{ 0.0002545410008714389, 0.9999872731128111, -1.999883610207857 },
+		{ 0.0003206992561748759, 0.9999839650796827, -1.999819410068407 },
+		{ 0.0004040548563145437, 0.9999797973089454, -1.999718585171967 },
+		{ 0.0005090738860599832, 0.9999745463057859, -1.999559905405264 },
+		{ 0.0006413910496939774, 0.9999679304982937, -1.999309746166673 },
+		{ 0.0008080982278907826, 0.9999595951078482, -1.998914829576402 },
+		{ 0.001018134814320826, 0.9999490932594624, -1.998290722692466 },
+		{ 0.001282761179125894, 0.9999358619432331, -1.997303593324514 },
+		{ 0.001616165006075819, 0.9999191917664461, -1.995741297145098 },
+		{ 0.002036228240448031, 0.9998981889468129, -1.993267604412823 },
+		{ 0.002565440786858962, 0.9998717281637601, -1.989349946990546 },
+		{ 0.003232203088139012, 0.9998383903900593, -1.983145009401197 },
+		{ 0.004072249170363887, 0.9997963882591158, -1.973319364839386 },
+		{ 0.005130552499903791, 0.9997434727811843, -1.957769755091089 },
+		{ 0.006463885231962107, 0.9996768060799256, -1.93318701161995 },
+		{ 0.008143625397619373, 0.9995928187937629, -1.894396957711739 },
+		{ 8.017495725848303e-05, 0.9999959912539967, -1.999985706413705 },
+		{ 9.534468734389889e-05, 0.99999523276723, -1.999980687784888 },
+		{ 0.0001428554407236486, 0.9999928572300939, -1.999960204938692 },
+		{ 0.0001603497182797666, 0.9999919825158824, -1.999950843258994 },
+		{ 0.0001906889201534229, 0.9999904655571863, -1.999932285978054 },
+		{ 0.0002857096092226998, 0.9999857145275692, -1.999855107193774 },
+		{ 0.0003206992561748759, 0.9999839650796827, -1.999819410068407 },
+		{ 0.0003813760221932181, 0.9999809312052784, -1.999748217383028 },
+		{ 0.0005714151369485634, 0.999971429259213, -1.999449020713854 },
+		{ 0.0006413910496939774, 0.9999679304982937, -1.999309746166673 },
+		{ 0.0007627447720074379, 0.9999618627741754, -1.999031070515955 },
+		{ 0.001142813948150687, 0.9999428593347134, -1.997853527914739 },
+		{ 0.001282761179125894, 0.9999358619432331, -1.997303593324514 },
+		{ 0.001525460455043487, 0.9999237270027994, -1.996201495338461 },
+		{ 0.002285570871343192, 0.9998857220980886, -1.991533024389042 },
+		{ 0.002565440786858962, 0.9998717281637601, -1.989349946990546 },
+		{ 0.003050837643482306, 0.9998474594959691, -1.984972891902056 },
+		{ 0.004570884146666731, 0.9997714564376801, -1.966432104124481 },
+		{ 0.005130552499903791, 0.9997434727811843, -1.957769755091089 },
+		{ 0.006101138436417942, 0.9996949430784174, -1.94042277933557 },
+		{ 0.00914068258134502, 0.9995429659252693, -1.867312774300711 },
+		{ 8.017495725848303e-05, 0.9999959912539967, -1.999985706413705 },
+		{ 0.000120126617415889, 0.9999939936692211, -1.999970904998273 },
+		{ 0.0001513499083880542, 0.9999924325046172, -1.999955781606605 },
+		{ 0.0001603497182797666, 0.9999919825158824, -1.999950843258994 },
+		{ 0.0002402539579671925, 0.9999879874072427, -1.999895634037066 },
+		{ 0.0003026988484489674, 0.9999848650828639, -1.99983826370579 },
+		{ 0.0003206992561748759, 0.9999839650796827, -1.999819410068407 },
+		{ 0.0004805028445858339, 0.9999759748769773, -1.99960656962848 },
+		{ 0.0006053931155918867, 0.9999697303947933, -1.999383350816027 },
+		{ 0.0006413910496939774, 0.9999679304982937, -1.999309746166673 },
+		{ 0.0009609941450424898, 0.9999519503311609, -1.998474483547209 },
+		{ 0.001210767587062398, 0.999939461624028, -1.997594316311407 },
+		{ 0.001282761179125894, 0.9999358619432331, -1.997303593324514 },
+		{ 0.001921942114637871, 0.9999039029710927, -1.993996360723552 },
+		{ 0.002421472558462221, 0.9998789267493468, -1.990504103822282 },
+		{ 0.002565440786858962, 0.9998717281637601, -1.989349946990546 },
+		{ 0.003843699536351093, 0.9998078151768245, -1.976213680582106 },
+		{ 0.00484265194137008, 0.9997578681574255, -1.962348733697547 },
+		{ 0.005130552499903791, 0.9997434727811843, -1.957769755091089 },
+		{ 0.007686660371978903, 0.9996156672886553, -1.905804880099845 },
+		{ 0.00968408499798051, 0.9995157957604071, -1.851297309379625 }
+	}
+};
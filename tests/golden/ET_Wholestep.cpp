@@ -0,0 +1,1647 @@
+#include "Scales.hpp"
+Scale et_wholestep = {
+	.name = "Whole Step (ET)",
+	.description = "Whole Step scales, Equal Temperament",
+	.scalename = {
+		"A2-B5",
+		"A5-B8",
+		"B2-C#5",
+		"B5-C#8",
+		"C2-D5",
+		"C5-D8",
+		"D2-E5",
+		"D5-E8",
+		"E2-F#5",
+		"E5-F#8",
+		"F4-G7"},
+	.notedesc = {
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		""},
+	.c_maxq48000 = {
+		0.01439896632895322,
+		0.01616229323913452,
+		0.01814156077457567,
+		0.02036321346655918,
+		0.02285693429783503,
+		0.02565604129002067,
+		0.02879793265790645,
+		0.03232458647826906,
+		0.03628312154915134,
+		0.04072642693311837,
+		0.04571386859567007,
+		0.05131208258004134,
+		0.05759586531581291,
+		0.06464917295653812,
+		0.0725662430983027,
+		0.08145285386623675,
+		0.09142773719134016,
+		0.1026241651600827,
+		0.1151917306316258,
+		0.1292983459130763,
+		0.1451324861966054,
+		0.1151917306316258,
+		0.1292983459130762,
+		0.1451324861966053,
+		0.1629057077324735,
+		0.1828554743826802,
+		0.2052483303201653,
+		0.2303834612632516,
+		0.2585966918261525,
+		0.2902649723932108,
+		0.325811415464947,
+		0.3657109487653605,
+		0.4104966606403307,
+		0.4607669225265033,
+		0.5171933836523049,
+		0.5805299447864216,
+		0.651622830929894,
+		0.7314218975307213,
+		0.8209933212806616,
+		0.9215338450530066,
+		1.03438676730461,
+		1.161059889572843,
+		0.01616229323913452,
+		0.01814156077457567,
+		0.02036321346655918,
+		0.02285693429783503,
+		0.02565604129002067,
+		0.02879793265790645,
+		0.03232458647826906,
+		0.03628312154915134,
+		0.04072642693311837,
+		0.04571386859567007,
+		0.05131208258004134,
+		0.05759586531581291,
+		0.06464917295653812,
+		0.0725662430983027,
+		0.08145285386623675,
+		0.09142773719134016,
+		0.1026241651600827,
+		0.1151917306316258,
+		0.1292983459130763,
+		0.1451324861966054,
+		0.1629057077324735,
+		0.1292983459130762,
+		0.1451324861966053,
+		0.1629057077324735,
+		0.1828554743826802,
+		0.2052483303201653,
+		0.2303834612632516,
+		0.2585966918261525,
+		0.2902649723932108,
+		0.325811415464947,
+		0.3657109487653605,
+		0.4104966606403307,
+		0.4607669225265033,
+		0.5171933836523049,
+		0.5805299447864216,
+		0.651622830929894,
+		0.7314218975307213,
+		0.8209933212806616,
+		0.9215338450530066,
+		1.03438676730461,
+		1.161059889572843,
+		1.303245661859788,
+		0.01712335320707578,
+		0.01922031411473915,
+		0.02157407315037966,
+		0.0242160783387514,
+		0.02718162889413514,
+		0.03051034684489617,
+		0.03424670641415157,
+		0.03844062822947832,
+		0.04314814630075934,
+		0.04843215667750282,
+		0.0543632577882703,
+		0.06102069368979234,
+		0.06849341282830317,
+		0.07688125645895665,
+		0.08629629260151868,
+		0.09686431335500566,
+		0.1087265155765406,
+		0.1220413873795847,
+		0.1369868256566063,
+		0.1537625129179133,
+		0.1725925852030374,
+		0.1369868256566062,
+		0.1537625129179132,
+		0.1725925852030373,
+		0.1937286267100112,
+		0.2174530311530811,
+		0.2440827747591693,
+		0.2739736513132126,
+		0.3075250258358265,
+		0.3451851704060747,
+		0.3874572534200226,
+		0.4349060623061624,
+		0.4881655495183387,
+		0.5479473026264253,
+		0.6150500516716532,
+		0.6903703408121494,
+		0.7749145068400453,
+		0.8698121246123249,
+		0.9763310990366779,
+		1.095894605252851,
+		1.230100103343307,
+		1.380740681624299,
+		0.01922031411473915,
+		0.02157407315037966,
+		0.0242160783387514,
+		0.02718162889413514,
+		0.03051034684489617,
+		0.03424670641415157,
+		0.03844062822947832,
+		0.04314814630075934,
+		0.04843215667750282,
+		0.0543632577882703,
+		0.06102069368979234,
+		0.06849341282830317,
+		0.07688125645895665,
+		0.08629629260151868,
+		0.09686431335500566,
+		0.1087265155765406,
+		0.1220413873795847,
+		0.1369868256566063,
+		0.1537625129179133,
+		0.1725925852030374,
+		0.1937286267100114,
+		0.1537625129179132,
+		0.1725925852030373,
+		0.1937286267100112,
+		0.2174530311530811,
+		0.2440827747591693,
+		0.2739736513132126,
+		0.3075250258358265,
+		0.3451851704060747,
+		0.3874572534200226,
+		0.4349060623061624,
+		0.4881655495183387,
+		0.5479473026264253,
+		0.6150500516716532,
+		0.6903703408121494,
+		0.7749145068400453,
+		0.8698121246123249,
+		0.9763310990366779,
+		1.095894605252851,
+		1.230100103343307,
+		1.380740681624299,
+		1.549829013680091,
+		0.02157407315037966,
+		0.0242160783387514,
+		0.02718162889413513,
+		0.03051034684489616,
+		0.03424670641415156,
+		0.0384406282294783,
+		0.04314814630075932,
+		0.0484321566775028,
+		0.05436325778827028,
+		0.06102069368979234,
+		0.06849341282830314,
+		0.07688125645895663,
+		0.08629629260151868,
+		0.09686431335500564,
+		0.1087265155765406,
+		0.1220413873795847,
+		0.1369868256566063,
+		0.1537625129179133,
+		0.1725925852030374,
+		0.1937286267100113,
+		0.2174530311530812,
+		0.1725925852030372,
+		0.1937286267100112,
+		0.217453031153081,
+		0.2440827747591693,
+		0.2739736513132124,
+		0.3075250258358264,
+		0.3451851704060745,
+		0.3874572534200224,
+		0.4349060623061622,
+		0.4881655495183387,
+		0.5479473026264251,
+		0.6150500516716531,
+		0.6903703408121494,
+		0.7749145068400451,
+		0.8698121246123248,
+		0.9763310990366775,
+		1.095894605252851,
+		1.230100103343306,
+		1.380740681624299,
+		1.549829013680091,
+		1.73962424922465,
+		0.02285693429783502,
+		0.02565604129002066,
+		0.02879793265790644,
+		0.03232458647826905,
+		0.03628312154915134,
+		0.04072642693311836,
+		0.04571386859567006,
+		0.05131208258004134,
+		0.0575958653158129,
+		0.06464917295653812,
+		0.07256624309830269,
+		0.08145285386623674,
+		0.09142773719134013,
+		0.1026241651600827,
+		0.1151917306316258,
+		0.1292983459130762,
+		0.1451324861966054,
+		0.1629057077324735,
+		0.1828554743826803,
+		0.2052483303201654,
+		0.2303834612632517
+	},
+	.c_maxq96000 = {
+		0.00719948316447661,
+		0.008081146619567261,
+		0.009070780387287834,
+		0.01018160673327959,
+		0.01142846714891751,
+		0.01282802064501033,
+		0.01439896632895322,
+		0.01616229323913453,
+		0.01814156077457567,
+		0.02036321346655919,
+		0.02285693429783503,
+		0.02565604129002067,
+		0.02879793265790645,
+		0.03232458647826906,
+		0.03628312154915135,
+		0.04072642693311838,
+		0.04571386859567008,
+		0.05131208258004135,
+		0.05759586531581291,
+		0.06464917295653813,
+		0.07256624309830272,
+		0.05759586531581288,
+		0.06464917295653809,
+		0.07256624309830267,
+		0.08145285386623673,
+		0.09142773719134012,
+		0.1026241651600827,
+		0.1151917306316258,
+		0.1292983459130762,
+		0.1451324861966054,
+		0.1629057077324735,
+		0.1828554743826803,
+		0.2052483303201654,
+		0.2303834612632516,
+		0.2585966918261525,
+		0.2902649723932108,
+		0.325811415464947,
+		0.3657109487653606,
+		0.4104966606403308,
+		0.4607669225265033,
+		0.517193383652305,
+		0.5805299447864217,
+		0.008081146619567261,
+		0.009070780387287834,
+		0.01018160673327959,
+		0.01142846714891751,
+		0.01282802064501033,
+		0.01439896632895322,
+		0.01616229323913453,
+		0.01814156077457567,
+		0.02036321346655919,
+		0.02285693429783503,
+		0.02565604129002067,
+		0.02879793265790645,
+		0.03232458647826906,
+		0.03628312154915135,
+		0.04072642693311838,
+		0.04571386859567008,
+		0.05131208258004135,
+		0.05759586531581291,
+		0.06464917295653813,
+		0.07256624309830272,
+		0.08145285386623677,
+		0.06464917295653809,
+		0.07256624309830267,
+		0.08145285386623673,
+		0.09142773719134012,
+		0.1026241651600827,
+		0.1151917306316258,
+		0.1292983459130762,
+		0.1451324861966054,
+		0.1629057077324735,
+		0.1828554743826803,
+		0.2052483303201654,
+		0.2303834612632516,
+		0.2585966918261525,
+		0.2902649723932108,
+		0.325811415464947,
+		0.3657109487653606,
+		0.4104966606403308,
+		0.4607669225265033,
+		0.517193383652305,
+		0.5805299447864217,
+		0.6516228309298941,
+		0.008561676603537889,
+		0.009610157057369575,
+		0.01078703657518983,
+		0.0121080391693757,
+		0.01359081444706757,
+		0.01525517342244808,
+		0.01712335320707578,
+		0.01922031411473916,
+		0.02157407315037967,
+		0.02421607833875141,
+		0.02718162889413515,
+		0.03051034684489617,
+		0.03424670641415158,
+		0.03844062822947832,
+		0.04314814630075934,
+		0.04843215667750283,
+		0.05436325778827031,
+		0.06102069368979237,
+		0.06849341282830317,
+		0.07688125645895666,
+		0.08629629260151871,
+		0.06849341282830311,
+		0.0768812564589566,
+		0.08629629260151864,
+		0.0968643133550056,
+		0.1087265155765406,
+		0.1220413873795847,
+		0.1369868256566063,
+		0.1537625129179133,
+		0.1725925852030374,
+		0.1937286267100113,
+		0.2174530311530812,
+		0.2440827747591694,
+		0.2739736513132127,
+		0.3075250258358266,
+		0.3451851704060747,
+		0.3874572534200226,
+		0.4349060623061625,
+		0.488165549518339,
+		0.5479473026264253,
+		0.6150500516716533,
+		0.6903703408121497,
+		0.009610157057369575,
+		0.01078703657518983,
+		0.0121080391693757,
+		0.01359081444706757,
+		0.01525517342244808,
+		0.01712335320707578,
+		0.01922031411473916,
+		0.02157407315037967,
+		0.02421607833875141,
+		0.02718162889413515,
+		0.03051034684489617,
+		0.03424670641415158,
+		0.03844062822947832,
+		0.04314814630075934,
+		0.04843215667750283,
+		0.05436325778827031,
+		0.06102069368979237,
+		0.06849341282830317,
+		0.07688125645895666,
+		0.08629629260151871,
+		0.09686431335500569,
+		0.0768812564589566,
+		0.08629629260151864,
+		0.0968643133550056,
+		0.1087265155765406,
+		0.1220413873795847,
+		0.1369868256566063,
+		0.1537625129179133,
+		0.1725925852030374,
+		0.1937286267100113,
+		0.2174530311530812,
+		0.2440827747591694,
+		0.2739736513132127,
+		0.3075250258358266,
+		0.3451851704060747,
+		0.3874572534200226,
+		0.4349060623061625,
+		0.488165549518339,
+		0.5479473026264253,
+		0.6150500516716533,
+		0.6903703408121497,
+		0.7749145068400455,
+		0.01078703657518983,
+		0.0121080391693757,
+		0.01359081444706756,
+		0.01525517342244808,
+		0.01712335320707578,
+		0.01922031411473915,
+		0.02157407315037966,
+		0.0242160783387514,
+		0.02718162889413514,
+		0.03051034684489617,
+		0.03424670641415157,
+		0.03844062822947832,
+		0.04314814630075934,
+		0.04843215667750282,
+		0.0543632577882703,
+		0.06102069368979234,
+		0.06849341282830317,
+		0.07688125645895665,
+		0.08629629260151868,
+		0.09686431335500566,
+		0.1087265155765406,
+		0.08629629260151862,
+		0.09686431335500559,
+		0.1087265155765405,
+		0.1220413873795846,
+		0.1369868256566062,
+		0.1537625129179132,
+		0.1725925852030373,
+		0.1937286267100112,
+		0.2174530311530811,
+		0.2440827747591693,
+		0.2739736513132126,
+		0.3075250258358265,
+		0.3451851704060747,
+		0.3874572534200226,
+		0.4349060623061624,
+		0.4881655495183387,
+		0.5479473026264253,
+		0.6150500516716532,
+		0.6903703408121494,
+		0.7749145068400453,
+		0.8698121246123249,
+		0.01142846714891751,
+		0.01282802064501033,
+		0.01439896632895322,
+		0.01616229323913453,
+		0.01814156077457567,
+		0.02036321346655918,
+		0.02285693429783503,
+		0.02565604129002067,
+		0.02879793265790645,
+		0.03232458647826906,
+		0.03628312154915134,
+		0.04072642693311837,
+		0.04571386859567007,
+		0.05131208258004134,
+		0.05759586531581291,
+		0.06464917295653812,
+		0.0725662430983027,
+		0.08145285386623675,
+		0.09142773719134016,
+		0.1026241651600827,
+		0.1151917306316258
+	},
+	.c_bpre4800022 = {
+		{ 0.007173628968382158, 0.9928263710316179, -1.992619788024624 },
+		{ 0.008048593274544517, 0.9919514067255844, -1.991691243155729 },
+		{ 0.009029744504671285, 0.9909702554957032, -1.990642635663237 },
+		{ 0.01012991777617711, 0.989870082224633, -1.989457538864665 },
+		{ 0.01136340279995648, 0.9886365972000836, -1.988117149403563 },
+		{ 0.01274611051097515, 0.9872538894892359, -1.986599885979389 },
+		{ 0.01429579698418818, 0.9857042030158116, -1.98488086689542 },
+		{ 0.01603240669539132, 0.9839675933048655, -1.982931177691716 },
+		{ 0.01797801699622542, 0.9820219830040292, -1.980717491454658 },
+		{ 0.02015728444715757, 0.9798427155528432, -1.97820101732274 },
+		{ 0.02259767867671926, 0.9774023213233605, -1.975336537903339 },
+		{ 0.02532969389660617, 0.9746703061036448, -1.972071298045083 },
+		{ 0.02838722415696359, 0.9716127758430366, -1.968343480294637 },
+		{ 0.03180771195789072, 0.9681922880422043, -1.964080680251197 },
+		{ 0.03563276177921154, 0.9643672382208521, -1.959197471233227 },
+		{ 0.0399082527780305, 0.9600917472219703, -1.953593160270272 },
+		{ 0.04468470227186334, 0.9553152977282937, -1.947148728928402 },
+		{ 0.05001785657602622, 0.9499821434239846, -1.939722816583335 },
+		{ 0.05596861381858927, 0.9440313861814109, -1.931147834504842 },
+		{ 0.06260375472812524, 0.9373962452719558, -1.921224026261177 },
+		{ 0.06999582984641191, 0.9300041701537132, -1.909713580549767 },
+		{ 0.05596861381858907, 0.9440313861814109, -1.931147834504842 },
+		{ 0.06260375472812528, 0.9373962452719558, -1.921224026261177 },
+		{ 0.06999582984641195, 0.9300041701537132, -1.909713580549767 },
+		{ 0.07822395757819939, 0.9217760424235261, -1.896331997427839 },
+		{ 0.08737256246672773, 0.9126274375363427, -1.880741141441922 },
+		{ 0.09753380904399866, 0.9024661909569682, -1.862534279738735 },
+		{ 0.108804741904404, 0.891195258095596, -1.84122780449662 },
+		{ 0.1212880493063801, 0.8787119506961812, -1.816244584825735 },
+		{ 0.1350922434969452, 0.864907756503297, -1.786895143515801 },
+		{ 0.1503289276173476, 0.8496710723859783, -1.752362003179018 },
+		{ 0.1671117053831054, 0.8328882946198586, -1.711678582026151 },
+		{ 0.1855547741814697, 0.8144452258203794, -1.663706411638779 },
+		{ 0.2057710119479236, 0.7942289880520762, -1.607112005154733 },
+		{ 0.2278658130660429, 0.772134186935479, -1.54035689744841 },
+		{ 0.2519345727408897, 0.7480654272595667, -1.461683819799863 },
+		{ 0.2780585962413486, 0.7219414037589278, -1.36911694221468 },
+		{ 0.306296634657814, 0.6937033653424187, -1.260497365967171 },
+		{ 0.3366794082814893, 0.6633205917191545, -1.133543532973203 },
+		{ 0.369200314537775, 0.630799685462225, -0.9859800463694947 },
+		{ 0.4038084071595592, 0.5961915928408708, -0.8157392198398624 },
+		{ 0.4403981165397933, 0.5596018834610379, -0.6212956366451821 },
+		{ 0.008048593274544517, 0.9919514067255844, -1.991691243155729 },
+		{ 0.009029744504671285, 0.9909702554957032, -1.990642635663237 },
+		{ 0.01012991777617711, 0.989870082224633, -1.989457538864665 },
+		{ 0.01136340279995648, 0.9886365972000836, -1.988117149403563 },
+		{ 0.01274611051097515, 0.9872538894892359, -1.986599885979389 },
+		{ 0.01429579698418818, 0.9857042030158116, -1.98488086689542 },
+		{ 0.01603240669539132, 0.9839675933048655, -1.982931177691716 },
+		{ 0.01797801699622542, 0.9820219830040292, -1.980717491454658 },
+		{ 0.02015728444715757, 0.9798427155528432, -1.97820101732274 },
+		{ 0.02259767867671926, 0.9774023213233605, -1.975336537903339 },
+		{ 0.02532969389660617, 0.9746703061036448, -1.972071298045083 },
+		{ 0.02838722415696359, 0.9716127758430366, -1.968343480294637 },
+		{ 0.03180771195789072, 0.9681922880422043, -1.964080680251197 },
+		{ 0.03563276177921154, 0.9643672382208521, -1.959197471233227 },
+		{ 0.0399082527780305, 0.9600917472219703, -1.953593160270272 },
+		{ 0.04468470227186334, 0.9553152977282937, -1.947148728928402 },
+		{ 0.05001785657602622, 0.9499821434239846, -1.939722816583335 },
+		{ 0.05596861381858927, 0.9440313861814109, -1.931147834504842 },
+		{ 0.06260375472812524, 0.9373962452719558, -1.921224026261177 },
+		{ 0.06999582984641191, 0.9300041701537132, -1.909713580549767 },
+		{ 0.07822395757819936, 0.9217760424235261, -1.896331997427839 },
+		{ 0.06260375472812528, 0.9373962452719558, -1.921224026261177 },
+		{ 0.06999582984641195, 0.9300041701537132, -1.909713580549767 },
+		{ 0.07822395757819939, 0.9217760424235261, -1.896331997427839 },
+		{ 0.08737256246672773, 0.9126274375363427, -1.880741141441922 },
+		{ 0.09753380904399866, 0.9024661909569682, -1.862534279738735 },
+		{ 0.108804741904404, 0.891195258095596, -1.84122780449662 },
+		{ 0.1212880493063801, 0.8787119506961812, -1.816244584825735 },
+		{ 0.1350922434969452, 0.864907756503297, -1.786895143515801 },
+		{ 0.1503289276173476, 0.8496710723859783, -1.752362003179018 },
+		{ 0.1671117053831054, 0.8328882946198586, -1.711678582026151 },
+		{ 0.1855547741814697, 0.8144452258203794, -1.663706411638779 },
+		{ 0.2057710119479236, 0.7942289880520762, -1.607112005154733 },
+		{ 0.2278658130660429, 0.772134186935479, -1.54035689744841 },
+		{ 0.2519345727408897, 0.7480654272595667, -1.461683819799863 },
+		{ 0.2780585962413486, 0.7219414037589278, -1.36911694221468 },
+		{ 0.306296634657814, 0.6937033653424187, -1.260497365967171 },
+		{ 0.3366794082814893, 0.6633205917191545, -1.133543532973203 },
+		{ 0.369200314537775, 0.630799685462225, -0.9859800463694947 },
+		{ 0.4038084071595592, 0.5961915928408708, -0.8157392198398624 },
+		{ 0.4403981165397933, 0.5596018834610379, -0.6212956366451821 },
+		{ 0.4788006095390898, 0.5211993904614113, -0.4021602134949892 },
+		{ 0.008525143929762899, 0.9914748560704251, -1.991182902834333 },
+		{ 0.009564102178687455, 0.9904358978218357, -1.990068257175529 },
+		{ 0.01072907947466965, 0.9892709205254852, -1.988807993479254 },
+		{ 0.01203501815220637, 0.9879649818479194, -1.987382121992113 },
+		{ 0.01349885378464802, 0.9865011462156569, -1.98576733966659 },
+		{ 0.0151394103989386, 0.9848605896010932, -1.983936825550939 },
+		{ 0.01697760978050481, 0.9830223902198703, -1.98185961909105 },
+		{ 0.01903679650984311, 0.9809632034902522, -1.979499764664712 },
+		{ 0.02134304580296827, 0.9786569541973403, -1.976815340305844 },
+		{ 0.02392519464248999, 0.9760748053577598, -1.973757650197085 },
+		{ 0.02681555221008421, 0.9731844477900297, -1.970269422622682 },
+		{ 0.03004961905065031, 0.969950380949413, -1.966283935281568 },
+		{ 0.03366691708007947, 0.9663330829199375, -1.961722512131246 },
+		{ 0.03771119339833016, 0.9622888066018583, -1.956492376078495 },
+		{ 0.0422305033153297, 0.9577694966846801, -1.950484218257796 },
+		{ 0.04727803670133684, 0.9527219632986798, -1.943568222565742 },
+		{ 0.05291196859294593, 0.9470880314071498, -1.935590668385107 },
+		{ 0.05919625849621265, 0.9408037415039114, -1.926368394147137 },
+		{ 0.06620025062283046, 0.9337997493796442, -1.915683929838771 },
+		{ 0.07400025268914172, 0.9259997473112286, -1.903276415136619 },
+		{ 0.08267759122039446, 0.9173224087796253, -1.88883644405978 },
+		{ 0.06620025062283011, 0.9337997493796442, -1.915683929838771 },
+		{ 0.07400025268914177, 0.9259997473112286, -1.903276415136619 },
+		{ 0.08267759122039452, 0.9173224087796253, -1.88883644405978 },
+		{ 0.09232097946502393, 0.9076790205367768, -1.871992389610808 },
+		{ 0.1030243781796103, 0.8969756218208279, -1.852301984921573 },
+		{ 0.1148885517004108, 0.8851114483060925, -1.829235310265093 },
+		{ 0.1280180280633104, 0.8719819719414862, -1.802163694945135 },
+		{ 0.1425244679802554, 0.8574755320204597, -1.770333165268908 },
+		{ 0.1585195983507836, 0.8414804016492542, -1.732856688975128 },
+		{ 0.1761187956808483, 0.823881204322603, -1.688681565563275 },
+		{ 0.1954347338599747, 0.8045652661408609, -1.636577367339129 },
+		{ 0.2165772113286436, 0.7834227886713574, -1.57510958880094 },
+		{ 0.2396479382585619, 0.7603520617415391, -1.502628737008348 },
+		{ 0.2647357119875736, 0.7352642880137701, -1.417267194837147 },
+		{ 0.2919107336402809, 0.7080892663597902, -1.316954421651064 },
+		{ 0.3212193169032085, 0.6787806830968353, -1.199456770773543 },
+		{ 0.3526747325212292, 0.6473252674803143, -1.062474801875927 },
+		{ 0.3862487341903958, 0.6137512658096063, -0.9038069316600397 },
+		{ 0.4218647422055752, 0.5781352577946095, -0.7216036473971494 },
+		{ 0.4593860729410244, 0.5406139270592686, -0.5147864327225303 },
+		{ 0.4986102471969354, 0.5013897528158646, -0.2836293424370332 },
+		{ 0.009564102178687455, 0.9904358978218357, -1.990068257175529 },
+		{ 0.01072907947466965, 0.9892709205254852, -1.988807993479254 },
+		{ 0.01203501815220637, 0.9879649818479194, -1.987382121992113 },
+		{ 0.01349885378464802, 0.9865011462156569, -1.98576733966659 },
+		{ 0.0151394103989386, 0.9848605896010932, -1.983936825550939 },
+		{ 0.01697760978050481, 0.9830223902198703, -1.98185961909105 },
+		{ 0.01903679650984311, 0.9809632034902522, -1.979499764664712 },
+		{ 0.02134304580296827, 0.9786569541973403, -1.976815340305844 },
+		{ 0.02392519464248999, 0.9760748053577598, -1.973757650197085 },
+		{ 0.02681555221008421, 0.9731844477900297, -1.970269422622682 },
+		{ 0.03004961905065031, 0.969950380949413, -1.966283935281568 },
+		{ 0.03366691708007947, 0.9663330829199375, -1.961722512131246 },
+		{ 0.03771119339833016, 0.9622888066018583, -1.956492376078495 },
+		{ 0.0422305033153297, 0.9577694966846801, -1.950484218257796 },
+		{ 0.04727803670133684, 0.9527219632986798, -1.943568222565742 },
+		{ 0.05291196859294593, 0.9470880314071498, -1.935590668385107 },
+		{ 0.05919625849621265, 0.9408037415039114, -1.926368394147137 },
+		{ 0.06620025062283046, 0.9337997493796442, -1.915683929838771 },
+		{ 0.07400025268914172, 0.9259997473112286, -1.903276415136619 },
+		{ 0.08267759122039446, 0.9173224087796253, -1.88883644405978 },
+		{ 0.09232097946502374, 0.9076790205367768, -1.871992389610808 },
+		{ 0.07400025268914177, 0.9259997473112286, -1.903276415136619 },
+		{ 0.08267759122039452, 0.9173224087796253, -1.88883644405978 },
+		{ 0.09232097946502393, 0.9076790205367768, -1.871992389610808 },
+		{ 0.1030243781796103, 0.8969756218208279, -1.852301984921573 },
+		{ 0.1148885517004108, 0.8851114483060925, -1.829235310265093 },
+		{ 0.1280180280633104, 0.8719819719414862, -1.802163694945135 },
+		{ 0.1425244679802554, 0.8574755320204597, -1.770333165268908 },
+		{ 0.1585195983507836, 0.8414804016492542, -1.732856688975128 },
+		{ 0.1761187956808483, 0.823881204322603, -1.688681565563275 },
+		{ 0.1954347338599747, 0.8045652661408609, -1.636577367339129 },
+		{ 0.2165772113286436, 0.7834227886713574, -1.57510958880094 },
+		{ 0.2396479382585619, 0.7603520617415391, -1.502628737008348 },
+		{ 0.2647357119875736, 0.7352642880137701, -1.417267194837147 },
+		{ 0.2919107336402809, 0.7080892663597902, -1.316954421651064 },
+		{ 0.3212193169032085, 0.6787806830968353, -1.199456770773543 },
+		{ 0.3526747325212292, 0.6473252674803143, -1.062474801875927 },
+		{ 0.3862487341903958, 0.6137512658096063, -0.9038069316600397 },
+		{ 0.4218647422055752, 0.5781352577946095, -0.7216036473971494 },
+		{ 0.4593860729410244, 0.5406139270592686, -0.5147864327225303 },
+		{ 0.4986102471969354, 0.5013897528158646, -0.2836293424370332 },
+		{ 0.5392561811584493, 0.4607438188572602, -0.03062974421794533 },
+		{ 0.01072907947466966, 0.9892709205254852, -1.988807993479254 },
+		{ 0.01203501815220637, 0.9879649818479194, -1.987382121992113 },
+		{ 0.01349885378464802, 0.9865011462156569, -1.98576733966659 },
+		{ 0.01513941039893861, 0.9848605896010932, -1.983936825550939 },
+		{ 0.01697760978050481, 0.9830223902198703, -1.98185961909105 },
+		{ 0.01903679650984312, 0.9809632034902522, -1.979499764664712 },
+		{ 0.02134304580296828, 0.9786569541973403, -1.976815340305844 },
+		{ 0.02392519464249, 0.9760748053577598, -1.973757650197085 },
+		{ 0.02681555221008421, 0.9731844477900297, -1.970269422622682 },
+		{ 0.03004961905065009, 0.969950380949413, -1.966283935281568 },
+		{ 0.03366691708007947, 0.9663330829199375, -1.961722512131246 },
+		{ 0.03771119339833016, 0.9622888066018583, -1.956492376078495 },
+		{ 0.0422305033153297, 0.9577694966846801, -1.950484218257796 },
+		{ 0.04727803670133685, 0.9527219632986798, -1.943568222565742 },
+		{ 0.05291196859294595, 0.9470880314071498, -1.935590668385107 },
+		{ 0.05919625849621267, 0.9408037415039114, -1.926368394147137 },
+		{ 0.06620025062283008, 0.9337997493796442, -1.915683929838771 },
+		{ 0.07400025268914173, 0.9259997473112286, -1.903276415136619 },
+		{ 0.08267759122039448, 0.9173224087796253, -1.88883644405978 },
+		{ 0.09232097946502388, 0.9076790205367768, -1.871992389610808 },
+		{ 0.1030243781796101, 0.8969756218208279, -1.852301984921573 },
+		{ 0.08267759122039423, 0.9173224087796253, -1.88883644405978 },
+		{ 0.09232097946502393, 0.9076790205367768, -1.871992389610808 },
+		{ 0.1030243781796103, 0.8969756218208279, -1.852301984921573 },
+		{ 0.1148885517004108, 0.8851114483060925, -1.829235310265093 },
+		{ 0.1280180280633102, 0.8719819719414862, -1.802163694945135 },
+		{ 0.1425244679802553, 0.8574755320204597, -1.770333165268908 },
+		{ 0.158519598350784, 0.8414804016492542, -1.732856688975128 },
+		{ 0.1761187956808483, 0.823881204322603, -1.688681565563275 },
+		{ 0.1954347338599744, 0.8045652661408609, -1.636577367339129 },
+		{ 0.2165772113286435, 0.7834227886713574, -1.57510958880094 },
+		{ 0.2396479382585621, 0.7603520617415391, -1.502628737008348 },
+		{ 0.2647357119875733, 0.7352642880137701, -1.417267194837147 },
+		{ 0.2919107336402808, 0.7080892663597902, -1.316954421651064 },
+		{ 0.3212193169032084, 0.6787806830968353, -1.199456770773543 },
+		{ 0.3526747325212291, 0.6473252674803143, -1.062474801875927 },
+		{ 0.3862487341903958, 0.6137512658096063, -0.9038069316600397 },
+		{ 0.421864742205575, 0.5781352577946095, -0.7216036473971494 },
+		{ 0.4593860729410246, 0.5406139270592686, -0.5147864327225303 },
+		{ 0.4986102471969354, 0.5013897528158646, -0.2836293424370332 },
+		{ 0.5392561811584493, 0.4607438188572602, -0.03062974421794533 },
+		{ 0.5809710951713639, 0.4190289049019166, 0.2384443389904471 },
+		{ 0.01136340279995649, 0.9886365972000836, -1.988117149403563 },
+		{ 0.01274611051097516, 0.9872538894892359, -1.986599885979389 },
+		{ 0.01429579698418818, 0.9857042030158116, -1.98488086689542 },
+		{ 0.01603240669539133, 0.9839675933048655, -1.982931177691716 },
+		{ 0.01797801699622542, 0.9820219830040292, -1.980717491454658 },
+		{ 0.02015728444715757, 0.9798427155528432, -1.97820101732274 },
+		{ 0.02259767867671927, 0.9774023213233605, -1.975336537903339 },
+		{ 0.02532969389660617, 0.9746703061036448, -1.972071298045083 },
+		{ 0.0283872241569636, 0.9716127758430366, -1.968343480294637 },
+		{ 0.03180771195789073, 0.9681922880422043, -1.964080680251197 },
+		{ 0.03563276177921156, 0.9643672382208521, -1.959197471233227 },
+		{ 0.03990825277803051, 0.9600917472219703, -1.953593160270272 },
+		{ 0.04468470227186334, 0.9553152977282937, -1.947148728928402 },
+		{ 0.05001785657602622, 0.9499821434239846, -1.939722816583335 },
+		{ 0.05596861381858927, 0.9440313861814109, -1.931147834504842 },
+		{ 0.06260375472812524, 0.9373962452719558, -1.921224026261177 },
+		{ 0.06999582984641191, 0.9300041701537132, -1.909713580549767 },
+		{ 0.07822395757819939, 0.9217760424235261, -1.896331997427839 },
+		{ 0.08737256246672789, 0.9126274375363427, -1.880741141441922 },
+		{ 0.09753380904399866, 0.9024661909569682, -1.862534279738735 },
+		{ 0.1088047419044039, 0.891195258095596, -1.84122780449662 }
+	},
+	.c_bpre9600022 = {
+		{ 0.003593270279843708, 0.9964067297201568, -1.996354990509996 },
+		{ 0.004032426870504835, 0.9959675731295595, -1.995902400037819 },
+		{ 0.004525110565148678, 0.995474889435039, -1.995392797475744 },
+		{ 0.005077851174361971, 0.9949221488260438, -1.994818748455509 },
+		{ 0.005697934629499152, 0.9943020653705209, -1.994171829202509 },
+		{ 0.006393493635923259, 0.9936065063641825, -1.993442476078507 },
+		{ 0.007173628968382154, 0.9928263710316179, -1.992619788024624 },
+		{ 0.008048593274544512, 0.9919514067255844, -1.991691243155729 },
+		{ 0.00902977693384955, 0.9909702230662784, -1.990642600875287 },
+		{ 0.01012995016878969, 0.9898700498312105, -1.989457503826128 },
+		{ 0.01136340279995648, 0.9886365972000836, -1.988117149403563 },
+		{ 0.01274607820308212, 0.9872539217970443, -1.986599921613149 },
+		{ 0.01429579698418817, 0.9857042030158116, -1.98488086689542 },
+		{ 0.01603237449491753, 0.9839676255051303, -1.982931214071721 },
+		{ 0.01797798485940809, 0.9820220151406239, -1.980717528275909 },
+		{ 0.02015728444715756, 0.9798427155528432, -1.97820101732274 },
+		{ 0.02259767867671926, 0.9774023213233605, -1.975336537903339 },
+		{ 0.02532972579237129, 0.9746702742076341, -1.972071259562314 },
+		{ 0.02838722415696359, 0.9716127758430366, -1.968343480294637 },
+		{ 0.03180774364185554, 0.9681922563581861, -1.964080640311271 },
+		{ 0.03563276177921154, 0.9643672382208521, -1.959197471233227 },
+		{ 0.02838722415696337, 0.9716127758430366, -1.968343480294637 },
+		{ 0.03180774364185535, 0.9681922563581861, -1.964080640311271 },
+		{ 0.03563276177921157, 0.9643672382208521, -1.959197471233227 },
+		{ 0.03990831561676508, 0.9600916843841145, -1.953593076765058 },
+		{ 0.04468463974803277, 0.9553153602535356, -1.94714881456053 },
+		{ 0.05001779440032292, 0.9499822056001724, -1.939722904581009 },
+		{ 0.05596861381858928, 0.9440313861814109, -1.931147834504842 },
+		{ 0.06260363202447353, 0.9373963679768456, -1.921224213340504 },
+		{ 0.06999582984641195, 0.9300041701537132, -1.909713580549767 },
+		{ 0.07822395757819939, 0.9217760424235261, -1.896331997427839 },
+		{ 0.08737286112178222, 0.912627138879761, -1.880740620136492 },
+		{ 0.09753380904399866, 0.9024661909569682, -1.862534279738735 },
+		{ 0.1088047419044039, 0.891195258095596, -1.84122780449662 },
+		{ 0.1212883368623886, 0.8787116631384149, -1.816243992388378 },
+		{ 0.1350922434969452, 0.864907756503297, -1.786895143515801 },
+		{ 0.150328649559915, 0.8496713504402321, -1.752362654093637 },
+		{ 0.1671114328181648, 0.8328885671819604, -1.711679265563538 },
+		{ 0.1855550407065019, 0.8144449592938457, -1.66370569333951 },
+		{ 0.2057710119479236, 0.7942289880520762, -1.607112005154733 },
+		{ 0.2278655603843924, 0.7721344396158423, -1.540357690571506 },
+		{ 0.2519345727408897, 0.7480654272595667, -1.461683819799863 },
+		{ 0.004032426870504835, 0.9959675731295595, -1.995902400037819 },
+		{ 0.004525110565148678, 0.995474889435039, -1.995392797475744 },
+		{ 0.005077851174361971, 0.9949221488260438, -1.994818748455509 },
+		{ 0.005697934629499152, 0.9943020653705209, -1.994171829202509 },
+		{ 0.006393493635923259, 0.9936065063641825, -1.993442476078507 },
+		{ 0.007173628968382154, 0.9928263710316179, -1.992619788024624 },
+		{ 0.008048593274544512, 0.9919514067255844, -1.991691243155729 },
+		{ 0.00902977693384955, 0.9909702230662784, -1.990642600875287 },
+		{ 0.01012995016878969, 0.9898700498312105, -1.989457503826128 },
+		{ 0.01136340279995648, 0.9886365972000836, -1.988117149403563 },
+		{ 0.01274607820308212, 0.9872539217970443, -1.986599921613149 },
+		{ 0.01429579698418817, 0.9857042030158116, -1.98488086689542 },
+		{ 0.01603237449491753, 0.9839676255051303, -1.982931214071721 },
+		{ 0.01797798485940809, 0.9820220151406239, -1.980717528275909 },
+		{ 0.02015728444715756, 0.9798427155528432, -1.97820101732274 },
+		{ 0.02259767867671926, 0.9774023213233605, -1.975336537903339 },
+		{ 0.02532972579237129, 0.9746702742076341, -1.972071259562314 },
+		{ 0.02838722415696359, 0.9716127758430366, -1.968343480294637 },
+		{ 0.03180774364185554, 0.9681922563581861, -1.964080640311271 },
+		{ 0.03563276177921154, 0.9643672382208521, -1.959197471233227 },
+		{ 0.03990831561676505, 0.9600916843841145, -1.953593076765058 },
+		{ 0.03180774364185535, 0.9681922563581861, -1.964080640311271 },
+		{ 0.03563276177921157, 0.9643672382208521, -1.959197471233227 },
+		{ 0.03990831561676508, 0.9600916843841145, -1.953593076765058 },
+		{ 0.04468463974803277, 0.9553153602535356, -1.94714881456053 },
+		{ 0.05001779440032292, 0.9499822056001724, -1.939722904581009 },
+		{ 0.05596861381858928, 0.9440313861814109, -1.931147834504842 },
+		{ 0.06260363202447353, 0.9373963679768456, -1.921224213340504 },
+		{ 0.06999582984641195, 0.9300041701537132, -1.909713580549767 },
+		{ 0.07822395757819939, 0.9217760424235261, -1.896331997427839 },
+		{ 0.08737286112178222, 0.912627138879761, -1.880740620136492 },
+		{ 0.09753380904399866, 0.9024661909569682, -1.862534279738735 },
+		{ 0.1088047419044039, 0.891195258095596, -1.84122780449662 },
+		{ 0.1212883368623886, 0.8787116631384149, -1.816243992388378 },
+		{ 0.1350922434969452, 0.864907756503297, -1.786895143515801 },
+		{ 0.150328649559915, 0.8496713504402321, -1.752362654093637 },
+		{ 0.1671114328181648, 0.8328885671819604, -1.711679265563538 },
+		{ 0.1855550407065019, 0.8144449592938457, -1.66370569333951 },
+		{ 0.2057710119479236, 0.7942289880520762, -1.607112005154733 },
+		{ 0.2278655603843924, 0.7721344396158423, -1.540357690571506 },
+		{ 0.2519345727408897, 0.7480654272595667, -1.461683819799863 },
+		{ 0.2780585962413485, 0.7219414037589278, -1.36911694221468 },
+		{ 0.004271695656773346, 0.995728304343321, -1.995655158803373 },
+		{ 0.004793540102701143, 0.9952064598975611, -1.995114327323801 },
+		{ 0.005379006593300036, 0.9946209934067776, -1.994504947013024 },
+		{ 0.006035724058558791, 0.9939642759415045, -1.993818115881097 },
+		{ 0.006772359317687169, 0.9932276406824655, -1.993043559359074 },
+		{ 0.007598574365664682, 0.9924014256343514, -1.992169593748362 },
+		{ 0.008525143929762894, 0.9914748560704251, -1.991182902834333 },
+		{ 0.009564134590150007, 0.9904358654098977, -1.990068222265821 },
+		{ 0.01072907947466965, 0.9892709205254852, -1.988807993479254 },
+		{ 0.01203501815220637, 0.9879649818479194, -1.987382121992113 },
+		{ 0.01349888606757407, 0.9865011139324832, -1.985767303861751 },
+		{ 0.0151394103989386, 0.9848605896010932, -1.983936825550939 },
+		{ 0.01697757761080472, 0.9830224223892035, -1.981859655685487 },
+		{ 0.01903679650984311, 0.9809632034902522, -1.979499764664712 },
+		{ 0.02134301377619051, 0.9786569862238147, -1.976815377888588 },
+		{ 0.02392522658422122, 0.9760747734157871, -1.973757612031066 },
+		{ 0.026815520362632, 0.9731844796374167, -1.970269461440493 },
+		{ 0.0300496190506503, 0.969950380949413, -1.966283935281568 },
+		{ 0.03366685383496585, 0.9663331461662921, -1.961722592845494 },
+		{ 0.03771119339833015, 0.9622888066018583, -1.956492376078495 },
+		{ 0.0422305033153297, 0.9577694966846801, -1.950484218257796 },
+		{ 0.03366685383496548, 0.9663331461662921, -1.961722592845494 },
+		{ 0.03771119339833018, 0.9622888066018583, -1.956492376078495 },
+		{ 0.04223050331532972, 0.9577694966846801, -1.950484218257796 },
+		{ 0.04727809905774646, 0.9527219009431749, -1.943568135781725 },
+		{ 0.05291203057983948, 0.9470879694203849, -1.935590579107296 },
+		{ 0.05919638165034691, 0.9408036183529976, -1.926368210056912 },
+		{ 0.06620025062283008, 0.9337997493796442, -1.915683929838771 },
+		{ 0.07400025268914175, 0.9259997473112286, -1.903276415136619 },
+		{ 0.08267759122039449, 0.9173224087796253, -1.88883644405978 },
+		{ 0.0923209794650236, 0.9076790205367768, -1.871992389610808 },
+		{ 0.10302437817961, 0.8969756218208279, -1.852301984921573 },
+		{ 0.1148882620418166, 0.8851117379581842, -1.82923588949804 },
+		{ 0.1280183134139534, 0.8719816865860999, -1.802163088738755 },
+		{ 0.1425244679802553, 0.8574755320204597, -1.770333165268908 },
+		{ 0.1585195983507839, 0.8414804016492542, -1.732856688975128 },
+		{ 0.1761185260628832, 0.8238814739371405, -1.688682266214865 },
+		{ 0.1954347338599747, 0.8045652661408609, -1.636577367339129 },
+		{ 0.2165772113286437, 0.7834227886713574, -1.57510958880094 },
+		{ 0.2396479382585619, 0.7603520617415391, -1.502628737008348 },
+		{ 0.2647354713716761, 0.7352645286284852, -1.417268046675904 },
+		{ 0.2919111970904739, 0.7080888029166006, -1.316952640465122 },
+		{ 0.004793540102701143, 0.9952064598975611, -1.995114327323801 },
+		{ 0.005379006593300036, 0.9946209934067776, -1.994504947013024 },
+		{ 0.006035724058558791, 0.9939642759415045, -1.993818115881097 },
+		{ 0.006772359317687169, 0.9932276406824655, -1.993043559359074 },
+		{ 0.007598574365664682, 0.9924014256343514, -1.992169593748362 },
+		{ 0.008525143929762894, 0.9914748560704251, -1.991182902834333 },
+		{ 0.009564134590150007, 0.9904358654098977, -1.990068222265821 },
+		{ 0.01072907947466965, 0.9892709205254852, -1.988807993479254 },
+		{ 0.01203501815220637, 0.9879649818479194, -1.987382121992113 },
+		{ 0.01349888606757407, 0.9865011139324832, -1.985767303861751 },
+		{ 0.0151394103989386, 0.9848605896010932, -1.983936825550939 },
+		{ 0.01697757761080472, 0.9830224223892035, -1.981859655685487 },
+		{ 0.01903679650984311, 0.9809632034902522, -1.979499764664712 },
+		{ 0.02134301377619051, 0.9786569862238147, -1.976815377888588 },
+		{ 0.02392522658422122, 0.9760747734157871, -1.973757612031066 },
+		{ 0.026815520362632, 0.9731844796374167, -1.970269461440493 },
+		{ 0.0300496190506503, 0.969950380949413, -1.966283935281568 },
+		{ 0.03366685383496585, 0.9663331461662921, -1.961722592845494 },
+		{ 0.03771119339833015, 0.9622888066018583, -1.956492376078495 },
+		{ 0.0422305033153297, 0.9577694966846801, -1.950484218257796 },
+		{ 0.04727809905774642, 0.9527219009431749, -1.943568135781725 },
+		{ 0.03771119339833018, 0.9622888066018583, -1.956492376078495 },
+		{ 0.04223050331532972, 0.9577694966846801, -1.950484218257796 },
+		{ 0.04727809905774646, 0.9527219009431749, -1.943568135781725 },
+		{ 0.05291203057983948, 0.9470879694203849, -1.935590579107296 },
+		{ 0.05919638165034691, 0.9408036183529976, -1.926368210056912 },
+		{ 0.06620025062283008, 0.9337997493796442, -1.915683929838771 },
+		{ 0.07400025268914175, 0.9259997473112286, -1.903276415136619 },
+		{ 0.08267759122039449, 0.9173224087796253, -1.88883644405978 },
+		{ 0.0923209794650236, 0.9076790205367768, -1.871992389610808 },
+		{ 0.10302437817961, 0.8969756218208279, -1.852301984921573 },
+		{ 0.1148882620418166, 0.8851117379581842, -1.82923588949804 },
+		{ 0.1280183134139534, 0.8719816865860999, -1.802163088738755 },
+		{ 0.1425244679802553, 0.8574755320204597, -1.770333165268908 },
+		{ 0.1585195983507839, 0.8414804016492542, -1.732856688975128 },
+		{ 0.1761185260628832, 0.8238814739371405, -1.688682266214865 },
+		{ 0.1954347338599747, 0.8045652661408609, -1.636577367339129 },
+		{ 0.2165772113286437, 0.7834227886713574, -1.57510958880094 },
+		{ 0.2396479382585619, 0.7603520617415391, -1.502628737008348 },
+		{ 0.2647354713716761, 0.7352645286284852, -1.417268046675904 },
+		{ 0.2919111970904739, 0.7080888029166006, -1.316952640465122 },
+		{ 0.3212188726508093, 0.6787811273578988, -1.199458625704261 },
+		{ 0.005379006593300037, 0.9946209934067776, -1.994504947013024 },
+		{ 0.006035724058558791, 0.9939642759415045, -1.993818115881097 },
+		{ 0.006772359317687172, 0.9932276406824655, -1.993043559359074 },
+		{ 0.007598574365664684, 0.9924014256343514, -1.992169593748362 },
+		{ 0.008525143929762899, 0.9914748560704251, -1.991182902834333 },
+		{ 0.009564134590150012, 0.9904358654098977, -1.990068222265821 },
+		{ 0.01072907947466965, 0.9892709205254852, -1.988807993479254 },
+		{ 0.01203501815220637, 0.9879649818479194, -1.987382121992113 },
+		{ 0.01349888606757407, 0.9865011139324832, -1.985767303861751 },
+		{ 0.0151394103989386, 0.9848605896010932, -1.983936825550939 },
+		{ 0.01697757761080472, 0.9830224223892035, -1.981859655685487 },
+		{ 0.01903679650984311, 0.9809632034902522, -1.979499764664712 },
+		{ 0.02134301377619051, 0.9786569862238147, -1.976815377888588 },
+		{ 0.02392522658422123, 0.9760747734157871, -1.973757612031066 },
+		{ 0.02681552036263201, 0.9731844796374167, -1.970269461440493 },
+		{ 0.03004961905065031, 0.969950380949413, -1.966283935281568 },
+		{ 0.03366685383496545, 0.9663331461662921, -1.961722592845494 },
+		{ 0.03771119339833016, 0.9622888066018583, -1.956492376078495 },
+		{ 0.0422305033153297, 0.9577694966846801, -1.950484218257796 },
+		{ 0.04727809905774643, 0.9527219009431749, -1.943568135781725 },
+		{ 0.05291203057983969, 0.9470879694203849, -1.935590579107296 },
+		{ 0.04223050331532973, 0.9577694966846801, -1.950484218257796 },
+		{ 0.04727809905774646, 0.9527219009431749, -1.943568135781725 },
+		{ 0.0529120305798396, 0.9470879694203849, -1.935590579107296 },
+		{ 0.05919638165034691, 0.9408036183529976, -1.926368210056912 },
+		{ 0.06620025062283011, 0.9337997493796442, -1.915683929838771 },
+		{ 0.07400025268914177, 0.9259997473112286, -1.903276415136619 },
+		{ 0.08267759122039452, 0.9173224087796253, -1.88883644405978 },
+		{ 0.09232097946502393, 0.9076790205367768, -1.871992389610808 },
+		{ 0.1030243781796103, 0.8969756218208279, -1.852301984921573 },
+		{ 0.1148882620418162, 0.8851117379581842, -1.82923588949804 },
+		{ 0.1280183134139536, 0.8719816865860999, -1.802163088738755 },
+		{ 0.1425244679802554, 0.8574755320204597, -1.770333165268908 },
+		{ 0.1585195983507836, 0.8414804016492542, -1.732856688975128 },
+		{ 0.1761185260628829, 0.8238814739371405, -1.688682266214865 },
+		{ 0.1954347338599747, 0.8045652661408609, -1.636577367339129 },
+		{ 0.2165772113286436, 0.7834227886713574, -1.57510958880094 },
+		{ 0.2396479382585619, 0.7603520617415391, -1.502628737008348 },
+		{ 0.2647354713716761, 0.7352645286284852, -1.417268046675904 },
+		{ 0.291911197090474, 0.7080888029166006, -1.316952640465122 },
+		{ 0.3212188726508093, 0.6787811273578988, -1.199458625704261 },
+		{ 0.3526755799065961, 0.6473244201340752, -1.062470959585245 },
+		{ 0.005697934629499153, 0.9943020653705209, -1.994171829202509 },
+		{ 0.006393493635923263, 0.9936065063641825, -1.993442476078507 },
+		{ 0.007173628968382154, 0.9928263710316179, -1.992619788024624 },
+		{ 0.008048593274544517, 0.9919514067255844, -1.991691243155729 },
+		{ 0.00902977693384955, 0.9909702230662784, -1.990642600875287 },
+		{ 0.01012995016878969, 0.9898700498312105, -1.989457503826128 },
+		{ 0.01136340279995648, 0.9886365972000836, -1.988117149403563 },
+		{ 0.01274607820308212, 0.9872539217970443, -1.986599921613149 },
+		{ 0.01429579698418818, 0.9857042030158116, -1.98488086689542 },
+		{ 0.01603237449491754, 0.9839676255051303, -1.982931214071721 },
+		{ 0.01797798485940809, 0.9820220151406239, -1.980717528275909 },
+		{ 0.02015728444715757, 0.9798427155528432, -1.97820101732274 },
+		{ 0.02259767867671926, 0.9774023213233605, -1.975336537903339 },
+		{ 0.0253297257923713, 0.9746702742076341, -1.972071259562314 },
+		{ 0.02838722415696359, 0.9716127758430366, -1.968343480294637 },
+		{ 0.03180774364185554, 0.9681922563581861, -1.964080640311271 },
+		{ 0.03563276177921154, 0.9643672382208521, -1.959197471233227 },
+		{ 0.03990831561676506, 0.9600916843841145, -1.953593076765058 },
+		{ 0.04468463974803305, 0.9553153602535356, -1.94714881456053 },
+		{ 0.05001779440032292, 0.9499822056001724, -1.939722904581009 },
+		{ 0.05596861381858927, 0.9440313861814109, -1.931147834504842 }
+	},
+	.c_bpre4800080040 = {
+		{ 0.0003599709187077813, 0.9999820014540647, -1.999774676670639 },
+		{ 0.0004040548563145437, 0.9999797973089454, -1.999718585171967 },
+		{ 0.0004535358527901037, 0.9999773233577725, -1.999648221386612 },
+		{ 0.0005090787622234936, 0.9999745463875961, -1.999559908152373 },
+		{ 0.0005714151369485631, 0.999971429259213, -1.999449020713854 },
+		{ 0.0006413933699626553, 0.9999679304164839, -1.999309742726944 },
+		{ 0.0007199353584600716, 0.9999640032320768, -1.999134754544961 },
+		{ 0.0008081015496520691, 0.9999595950260391, -1.998914825264178 },
+		{ 0.0009070607347291103, 0.9999546470661576, -1.998638352918822 },
+		{ 0.001018134814320826, 0.9999490932594624, -1.998290722692466 },
+		{ 0.001142813948150686, 0.9999428593347134, -1.997853527914739 },
+		{ 0.001282761530290751, 0.99993586202504, -1.997303600119783 },
+		{ 0.001439844801581977, 0.999928007759921, -1.996611760364314 },
+		{ 0.001616163804652781, 0.999919191848252, -1.995741305683054 },
+		{ 0.001814073462184045, 0.999909296352814, -1.994645990766496 },
+		{ 0.002036217798719733, 0.9998981891104207, -1.993267625875558 },
+		{ 0.002285562595138269, 0.9998857219344829, -1.991533000325126 },
+		{ 0.002565440084446018, 0.9998717280001567, -1.989349920009726 },
+		{ 0.002879585945502867, 0.9998560207027247, -1.986602506088068 },
+		{ 0.00323219941269311, 0.9998383900628629, -1.98314494157025 },
+		{ 0.00362798238130948, 0.9998186009327792, -1.978794035731978 },
+		{ 0.002879585945502869, 0.9998560207027247, -1.986602506088068 },
+		{ 0.003232199412693112, 0.9998383900628629, -1.98314494157025 },
+		{ 0.003627982381309482, 0.9998186009327792, -1.978794035731978 },
+		{ 0.004072249170363886, 0.9997963882591158, -1.973319364839386 },
+		{ 0.004570880552454797, 0.9997714572556161, -1.966432342927127 },
+		{ 0.005130552499898453, 0.9997434727811843, -1.957769755091089 },
+		{ 0.005758757290257833, 0.9997120621354871, -1.946877475516094 },
+		{ 0.006463883821212595, 0.9996768068977846, -1.933187347098545 },
+		{ 0.007255306649990355, 0.9996372347711799, -1.915988633294648 },
+		{ 0.00814366918297646, 0.9995928179759731, -1.894396538041369 },
+		{ 0.009140723647191535, 0.9995429651075202, -1.867312305528995 },
+		{ 0.01025978887345511, 0.9994870113685824, -1.833375465653553 },
+		{ 0.01151585641623706, 0.999424207179188, -1.790907776077773 },
+		{ 0.01292568137551132, 0.9993537166141615, -1.737858402905473 },
+		{ 0.01450798132700966, 0.9992746011409711, -1.671737962592194 },
+		{ 0.01628393486402132, 0.999185803384061, -1.589554178814092 },
+		{ 0.0182771875592896, 0.9990861407306839, -1.487771038503012 },
+		{ 0.02051432090670643, 0.9989742842599332, -1.362289617375435 },
+		{ 0.02302508208503078, 0.9988487458957483, -1.208502182512338 },
+		{ 0.0258429533196032, 0.9987078525446702, -1.021446542884322 },
+		{ 0.02900543858092533, 0.9985497284854464, -0.7961584549994699 },
+		{ 0.0004040548563145437, 0.9999797973089454, -1.999718585171967 },
+		{ 0.0004535358527901037, 0.9999773233577725, -1.999648221386612 },
+		{ 0.0005090787622234936, 0.9999745463875961, -1.999559908152373 },
+		{ 0.0005714151369485631, 0.999971429259213, -1.999449020713854 },
+		{ 0.0006413933699626553, 0.9999679304164839, -1.999309742726944 },
+		{ 0.0007199353584600716, 0.9999640032320768, -1.999134754544961 },
+		{ 0.0008081015496520691, 0.9999595950260391, -1.998914825264178 },
+		{ 0.0009070607347291103, 0.9999546470661576, -1.998638352918822 },
+		{ 0.001018134814320826, 0.9999490932594624, -1.998290722692466 },
+		{ 0.001142813948150686, 0.9999428593347134, -1.997853527914739 },
+		{ 0.001282761530290751, 0.99993586202504, -1.997303600119783 },
+		{ 0.001439844801581977, 0.999928007759921, -1.996611760364314 },
+		{ 0.001616163804652781, 0.999919191848252, -1.995741305683054 },
+		{ 0.001814073462184045, 0.999909296352814, -1.994645990766496 },
+		{ 0.002036217798719733, 0.9998981891104207, -1.993267625875558 },
+		{ 0.002285562595138269, 0.9998857219344829, -1.991533000325126 },
+		{ 0.002565440084446018, 0.9998717280001567, -1.989349920009726 },
+		{ 0.002879585945502867, 0.9998560207027247, -1.986602506088068 },
+		{ 0.00323219941269311, 0.9998383900628629, -1.98314494157025 },
+		{ 0.00362798238130948, 0.9998186009327792, -1.978794035731978 },
+		{ 0.004072249170363884, 0.9997963882591158, -1.973319364839386 },
+		{ 0.003232199412693112, 0.9998383900628629, -1.98314494157025 },
+		{ 0.003627982381309482, 0.9998186009327792, -1.978794035731978 },
+		{ 0.004072249170363886, 0.9997963882591158, -1.973319364839386 },
+		{ 0.004570880552454797, 0.9997714572556161, -1.966432342927127 },
+		{ 0.005130552499898453, 0.9997434727811843, -1.957769755091089 },
+		{ 0.005758757290257833, 0.9997120621354871, -1.946877475516094 },
+		{ 0.006463883821212595, 0.9996768068977846, -1.933187347098545 },
+		{ 0.007255306649990355, 0.9996372347711799, -1.915988633294648 },
+		{ 0.00814366918297646, 0.9995928179759731, -1.894396538041369 },
+		{ 0.009140723647191535, 0.9995429651075202, -1.867312305528995 },
+		{ 0.01025978887345511, 0.9994870113685824, -1.833375465653553 },
+		{ 0.01151585641623706, 0.999424207179188, -1.790907776077773 },
+		{ 0.01292568137551132, 0.9993537166141615, -1.737858402905473 },
+		{ 0.01450798132700966, 0.9992746011409711, -1.671737962592194 },
+		{ 0.01628393486402132, 0.999185803384061, -1.589554178814092 },
+		{ 0.0182771875592896, 0.9990861407306839, -1.487771038503012 },
+		{ 0.02051432090670643, 0.9989742842599332, -1.362289617375435 },
+		{ 0.02302508208503078, 0.9988487458957483, -1.208502182512338 },
+		{ 0.0258429533196032, 0.9987078525446702, -1.021446542884322 },
+		{ 0.02900543858092533, 0.9985497284854464, -0.7961584549994699 },
+		{ 0.03255461140340363, 0.9983722696842509, -0.5283106367870398 },
+		{ 0.0004280814727634833, 0.9999785960019963, -1.999685396104728 },
+		{ 0.0004805050298573803, 0.9999759749587874, -1.999606572226021 },
+		{ 0.0005393465286912326, 0.9999730327359353, -1.999507615180677 },
+		{ 0.0006053931155918866, 0.9999697303947933, -1.999383350816027 },
+		{ 0.0006795304907018601, 0.999966023598164, -1.999227243170693 },
+		{ 0.0007627447720074376, 0.9999618627741754, -1.999031070515955 },
+		{ 0.0008561537828800876, 0.9999571924621234, -1.998784491390396 },
+		{ 0.0009609941450497057, 0.9999519503311609, -1.998474483547209 },
+		{ 0.001078678512694528, 0.999946066199104, -1.998084637693308 },
+		{ 0.001210767906161514, 0.9999394617058355, -1.9975943227302 },
+		{ 0.001359037180215036, 0.9999320481871105, -1.996977508250568 },
+		{ 0.001525460455043486, 0.9999237270027994, -1.996201495338461 },
+		{ 0.001712261729676577, 0.9999143869203432, -1.99522507617636 },
+		{ 0.001921942114637869, 0.9999039029710927, -1.993996360723552 },
+		{ 0.00215729066892253, 0.9998921354706697, -1.99245010970846 },
+		{ 0.002421461876222305, 0.9998789269129513, -1.990504129302991 },
+		{ 0.002717977681977486, 0.9998641011552721, -1.988055100639989 },
+		{ 0.003050804558647555, 0.9998474598231686, -1.984972955964274 },
+		{ 0.003424390514337296, 0.9998287814974788, -1.98109440254788 },
+		{ 0.003843699536351088, 0.9998078151768245, -1.976213680582106 },
+		{ 0.004314348642706457, 0.9997842825760958, -1.970073168649486 },
+		{ 0.0034243905143373, 0.9998287814974788, -1.98109440254788 },
+		{ 0.003843699536351091, 0.9998078151768245, -1.976213680582106 },
+		{ 0.004314348642712828, 0.9997842825760958, -1.970073168649486 },
+		{ 0.004842651941370079, 0.9997578681574255, -1.962348733697547 },
+		{ 0.005435594651706546, 0.9997282204518797, -1.952634767385599 },
+		{ 0.006101209910639276, 0.9996949422605439, -1.940422462249227 },
+		{ 0.00684819470968147, 0.9996575923107331, -1.925077468264887 },
+		{ 0.007686660371983654, 0.9996156672886553, -1.905804880099845 },
+		{ 0.008627766605248026, 0.9995686116861983, -1.881619723307976 },
+		{ 0.009684131322500514, 0.9995157949426802, -1.85129681415655 },
+		{ 0.01086971201996042, 0.9994565147678818, -1.813326090461238 },
+		{ 0.01220041567833781, 0.9993899792165599, -1.765850670972606 },
+		{ 0.01369399632535968, 0.9993153002293662, -1.70660670088199 },
+		{ 0.01537036650894976, 0.9992314822889434, -1.632860892900521 },
+		{ 0.01725181129280591, 0.9991374094682743, -1.541355538462134 },
+		{ 0.01936348092095246, 0.9990318259745596, -1.428270102724889 },
+		{ 0.02173351651195803, 0.9989133249119611, -1.289238428377847 },
+		{ 0.02439338884954122, 0.9987803305584761, -1.119448551885984 },
+		{ 0.0273786163745825, 0.998631069272508, -0.9138757038124511 },
+		{ 0.03072886632770725, 0.9984635568310913, -0.6677740005200434 },
+		{ 0.03448893647756628, 0.9982755597321242, -0.3774966373698755 },
+		{ 0.0004805050298573803, 0.9999759749587874, -1.999606572226021 },
+		{ 0.0005393465286912326, 0.9999730327359353, -1.999507615180677 },
+		{ 0.0006053931155918866, 0.9999697303947933, -1.999383350816027 },
+		{ 0.0006795304907018601, 0.999966023598164, -1.999227243170693 },
+		{ 0.0007627447720074376, 0.9999618627741754, -1.999031070515955 },
+		{ 0.0008561537828800876, 0.9999571924621234, -1.998784491390396 },
+		{ 0.0009609941450497057, 0.9999519503311609, -1.998474483547209 },
+		{ 0.001078678512694528, 0.999946066199104, -1.998084637693308 },
+		{ 0.001210767906161514, 0.9999394617058355, -1.9975943227302 },
+		{ 0.001359037180215036, 0.9999320481871105, -1.996977508250568 },
+		{ 0.001525460455043486, 0.9999237270027994, -1.996201495338461 },
+		{ 0.001712261729676577, 0.9999143869203432, -1.99522507617636 },
+		{ 0.001921942114637869, 0.9999039029710927, -1.993996360723552 },
+		{ 0.00215729066892253, 0.9998921354706697, -1.99245010970846 },
+		{ 0.002421461876222305, 0.9998789269129513, -1.990504129302991 },
+		{ 0.002717977681977486, 0.9998641011552721, -1.988055100639989 },
+		{ 0.003050804558647555, 0.9998474598231686, -1.984972955964274 },
+		{ 0.003424390514337296, 0.9998287814974788, -1.98109440254788 },
+		{ 0.003843699536351088, 0.9998078151768245, -1.976213680582106 },
+		{ 0.004314348642706457, 0.9997842825760958, -1.970073168649486 },
+		{ 0.004842651941373482, 0.9997578681574255, -1.962348733697547 },
+		{ 0.003843699536351091, 0.9998078151768245, -1.976213680582106 },
+		{ 0.004314348642712828, 0.9997842825760958, -1.970073168649486 },
+		{ 0.004842651941370079, 0.9997578681574255, -1.962348733697547 },
+		{ 0.005435594651706546, 0.9997282204518797, -1.952634767385599 },
+		{ 0.006101209910639276, 0.9996949422605439, -1.940422462249227 },
+		{ 0.00684819470968147, 0.9996575923107331, -1.925077468264887 },
+		{ 0.007686660371983654, 0.9996156672886553, -1.905804880099845 },
+		{ 0.008627766605248026, 0.9995686116861983, -1.881619723307976 },
+		{ 0.009684131322500514, 0.9995157949426802, -1.85129681415655 },
+		{ 0.01086971201996042, 0.9994565147678818, -1.813326090461238 },
+		{ 0.01220041567833781, 0.9993899792165599, -1.765850670972606 },
+		{ 0.01369399632535968, 0.9993153002293662, -1.70660670088199 },
+		{ 0.01537036650894976, 0.9992314822889434, -1.632860892900521 },
+		{ 0.01725181129280591, 0.9991374094682743, -1.541355538462134 },
+		{ 0.01936348092095246, 0.9990318259745596, -1.428270102724889 },
+		{ 0.02173351651195803, 0.9989133249119611, -1.289238428377847 },
+		{ 0.02439338884954122, 0.9987803305584761, -1.119448551885984 },
+		{ 0.0273786163745825, 0.998631069272508, -0.9138757038124511 },
+		{ 0.03072886632770725, 0.9984635568310913, -0.6677740005200434 },
+		{ 0.03448893647756628, 0.9982755597321242, -0.3774966373698755 },
+		{ 0.03870831226308096, 0.9980645925762218, -0.04189660537394978 },
+		{ 0.0005393465286912327, 0.9999730327359353, -1.999507615180677 },
+		{ 0.0006053931155918866, 0.9999697303947933, -1.999383350816027 },
+		{ 0.0006795304907018604, 0.999966023598164, -1.999227243170693 },
+		{ 0.0007627447720074377, 0.9999618627741754, -1.999031070515955 },
+		{ 0.0008561537828800881, 0.9999571924621234, -1.998784491390396 },
+		{ 0.000960994145049706, 0.9999519503311609, -1.998474483547209 },
+		{ 0.001078678512694529, 0.999946066199104, -1.998084637693308 },
+		{ 0.001210767906161514, 0.9999394617058355, -1.9975943227302 },
+		{ 0.001359037180215036, 0.9999320481871105, -1.996977508250568 },
+		{ 0.001525460455043487, 0.9999237270027994, -1.996201495338461 },
+		{ 0.001712261729676577, 0.9999143869203432, -1.99522507617636 },
+		{ 0.00192194211463787, 0.9999039029710927, -1.993996360723552 },
+		{ 0.002157290668922531, 0.9998921354706697, -1.99245010970846 },
+		{ 0.002421461876222306, 0.9998789269129513, -1.990504129302991 },
+		{ 0.002717977681977487, 0.9998641011552721, -1.988055100639989 },
+		{ 0.003050804558647557, 0.9998474598231686, -1.984972955964274 },
+		{ 0.003424390514337297, 0.9998287814974788, -1.98109440254788 },
+		{ 0.003843699536351089, 0.9998078151768245, -1.976213680582106 },
+		{ 0.004314348642712827, 0.9997842825760958, -1.970073168649486 },
+		{ 0.004842651941375732, 0.9997578681574255, -1.962348733697547 },
+		{ 0.00543559465170431, 0.9997282204518797, -1.952634767385599 },
+		{ 0.00431434864271283, 0.9997842825760958, -1.970073168649486 },
+		{ 0.004842651941370079, 0.9997578681574255, -1.962348733697547 },
+		{ 0.005435594651706547, 0.9997282204518797, -1.952634767385599 },
+		{ 0.006101209910639276, 0.9996949422605439, -1.940422462249227 },
+		{ 0.006848194709681473, 0.9996575923107331, -1.925077468264887 },
+		{ 0.00768666037197667, 0.9996156672886553, -1.905804880099845 },
+		{ 0.008627766605250246, 0.9995686116861983, -1.881619723307976 },
+		{ 0.009684131322499553, 0.9995157949426802, -1.85129681415655 },
+		{ 0.01086971201995564, 0.9994565147678818, -1.813326090461238 },
+		{ 0.01220041567833586, 0.9993899792165599, -1.765850670972606 },
+		{ 0.0136939963253619, 0.9993153002293662, -1.70660670088199 },
+		{ 0.0153703665089444, 0.9992314822889434, -1.632860892900521 },
+		{ 0.01725181129281099, 0.9991374094682743, -1.541355538462134 },
+		{ 0.01936348092094897, 0.9990318259745596, -1.428270102724889 },
+		{ 0.02173351651195798, 0.9989133249119611, -1.289238428377847 },
+		{ 0.02439338884953849, 0.9987803305584761, -1.119448551885984 },
+		{ 0.02737861637458118, 0.998631069272508, -0.9138757038124511 },
+		{ 0.03072886632770854, 0.9984635568310913, -0.6677740005200434 },
+		{ 0.03448893647756258, 0.9982755597321242, -0.3774966373698755 },
+		{ 0.03870831226308076, 0.9980645925762218, -0.04189660537394978 },
+		{ 0.04344429386667969, 0.9978278241559015, 0.335701925031113 },
+		{ 0.0005714151369485633, 0.999971429259213, -1.999449020713854 },
+		{ 0.0006413933699626556, 0.9999679304164839, -1.999309742726944 },
+		{ 0.0007199353584600716, 0.9999640032320768, -1.999134754544961 },
+		{ 0.0008081015496520695, 0.9999595950260391, -1.998914825264178 },
+		{ 0.0009070607347291105, 0.9999546470661576, -1.998638352918822 },
+		{ 0.001018134814320826, 0.9999490932594624, -1.998290722692466 },
+		{ 0.001142813948150686, 0.9999428593347134, -1.997853527914739 },
+		{ 0.001282761530290751, 0.99993586202504, -1.997303600119783 },
+		{ 0.001439844801581977, 0.999928007759921, -1.996611760364314 },
+		{ 0.001616163804652781, 0.999919191848252, -1.995741305683054 },
+		{ 0.001814073462184046, 0.999909296352814, -1.994645990766496 },
+		{ 0.002036217798719733, 0.9998981891104207, -1.993267625875558 },
+		{ 0.002285562595138269, 0.9998857219344829, -1.991533000325126 },
+		{ 0.002565440084446018, 0.9998717280001567, -1.989349920009726 },
+		{ 0.002879585945502867, 0.9998560207027247, -1.986602506088068 },
+		{ 0.00323219941269311, 0.9998383900628629, -1.98314494157025 },
+		{ 0.00362798238130948, 0.9998186009327792, -1.978794035731978 },
+		{ 0.004072249170363884, 0.9997963882591158, -1.973319364839386 },
+		{ 0.004570880552452615, 0.9997714572556161, -1.966432342927127 },
+		{ 0.005130552499898452, 0.9997434727811843, -1.957769755091089 },
+		{ 0.005758757290255611, 0.9997120621354871, -1.946877475516094 }
+	},
+	.c_bpre9600080040 = {
+		{ 0.0001799862692379033, 0.9999910006865385, -1.999939168585815 },
+		{ 0.0002020284485491571, 0.9999898986034534, -1.99992459417321 },
+		{ 0.0002267692119973054, 0.9999886616146065, -1.999906383962968 },
+		{ 0.0002545410008714388, 0.9999872731128111, -1.999883610207857 },
+		{ 0.0002857096092226996, 0.9999857145275692, -1.999855107193774 },
+		{ 0.0003206992561748758, 0.9999839650796827, -1.999819410068407 },
+		{ 0.0003599709187077813, 0.9999820014540647, -1.999774676670639 },
+		{ 0.0004040548563145435, 0.9999797973089454, -1.999718585171967 },
+		{ 0.0004535355097153632, 0.9999773232759618, -1.999648218930248 },
+		{ 0.0005090738860599828, 0.9999745463057859, -1.999559905405264 },
+		{ 0.0005714151369485631, 0.999971429259213, -1.999449020713854 },
+		{ 0.0006413910496939771, 0.9999679304982937, -1.999309746166673 },
+		{ 0.0007199353584600715, 0.9999640032320768, -1.999134754544961 },
+		{ 0.0008080982278907821, 0.9999595951078482, -1.998914829576402 },
+		{ 0.0009070572999136617, 0.9999546471479662, -1.998638357748879 },
+		{ 0.001018134814320826, 0.9999490932594624, -1.998290722692466 },
+		{ 0.001142813948150686, 0.9999428593347134, -1.997853527914739 },
+		{ 0.001282761179125893, 0.9999358619432331, -1.997303593324514 },
+		{ 0.001439844801581977, 0.999928007759921, -1.996611760364314 },
+		{ 0.001616165006075818, 0.9999191917664461, -1.995741297145098 },
+		{ 0.001814073462184045, 0.999909296352814, -1.994645990766496 },
+		{ 0.001439844801581978, 0.999928007759921, -1.996611760364314 },
+		{ 0.001616165006075819, 0.9999191917664461, -1.995741297145098 },
+		{ 0.001814073462184046, 0.999909296352814, -1.994645990766496 },
+		{ 0.002036228240448031, 0.9998981889468129, -1.993267604412823 },
+		{ 0.002285570871343191, 0.9998857220980886, -1.991533024389042 },
+		{ 0.00256544078685357, 0.9998717281637601, -1.989349946990546 },
+		{ 0.002879585945502868, 0.9998560207027247, -1.986602506088068 },
+		{ 0.00323220308813901, 0.9998383903900593, -1.983145009401197 },
+		{ 0.003627982381309482, 0.9998186009327792, -1.978794035731978 },
+		{ 0.004072249170363885, 0.9997963882591158, -1.973319364839386 },
+		{ 0.004570884146658478, 0.9997714564376801, -1.966432104124481 },
+		{ 0.005130552499898453, 0.9997434727811843, -1.957769755091089 },
+		{ 0.005758757290255611, 0.9997120621354871, -1.946877475516094 },
+		{ 0.006463885231962104, 0.9996768060799256, -1.93318701161995 },
+		{ 0.007255306649988137, 0.9996372347711799, -1.915988633294648 },
+		{ 0.008143625397614932, 0.9995928187937629, -1.894396957711739 },
+		{ 0.009140682581346378, 0.9995429659252693, -1.867312774300711 },
+		{ 0.01025979203588614, 0.999487010550879, -1.833374942663341 },
+		{ 0.01151585641623706, 0.999424207179188, -1.790907776077773 },
+		{ 0.01292565347206802, 0.9993537174317561, -1.737859050630892 },
+		{ 0.01450798132700966, 0.9992746011409711, -1.671737962592194 },
+		{ 0.0002020284485491571, 0.9999898986034534, -1.99992459417321 },
+		{ 0.0002267692119973054, 0.9999886616146065, -1.999906383962968 },
+		{ 0.0002545410008714388, 0.9999872731128111, -1.999883610207857 },
+		{ 0.0002857096092226996, 0.9999857145275692, -1.999855107193774 },
+		{ 0.0003206992561748758, 0.9999839650796827, -1.999819410068407 },
+		{ 0.0003599709187077813, 0.9999820014540647, -1.999774676670639 },
+		{ 0.0004040548563145435, 0.9999797973089454, -1.999718585171967 },
+		{ 0.0004535355097153632, 0.9999773232759618, -1.999648218930248 },
+		{ 0.0005090738860599828, 0.9999745463057859, -1.999559905405264 },
+		{ 0.0005714151369485631, 0.999971429259213, -1.999449020713854 },
+		{ 0.0006413910496939771, 0.9999679304982937, -1.999309746166673 },
+		{ 0.0007199353584600715, 0.9999640032320768, -1.999134754544961 },
+		{ 0.0008080982278907821, 0.9999595951078482, -1.998914829576402 },
+		{ 0.0009070572999136617, 0.9999546471479662, -1.998638357748879 },
+		{ 0.001018134814320826, 0.9999490932594624, -1.998290722692466 },
+		{ 0.001142813948150686, 0.9999428593347134, -1.997853527914739 },
+		{ 0.001282761179125893, 0.9999358619432331, -1.997303593324514 },
+		{ 0.001439844801581977, 0.999928007759921, -1.996611760364314 },
+		{ 0.001616165006075818, 0.9999191917664461, -1.995741297145098 },
+		{ 0.001814073462184045, 0.999909296352814, -1.994645990766496 },
+		{ 0.00203622824044803, 0.9998981889468129, -1.993267604412823 },
+		{ 0.001616165006075819, 0.9999191917664461, -1.995741297145098 },
+		{ 0.001814073462184046, 0.999909296352814, -1.994645990766496 },
+		{ 0.002036228240448031, 0.9998981889468129, -1.993267604412823 },
+		{ 0.002285570871343191, 0.9998857220980886, -1.991533024389042 },
+		{ 0.00256544078685357, 0.9998717281637601, -1.989349946990546 },
+		{ 0.002879585945502868, 0.9998560207027247, -1.986602506088068 },
+		{ 0.00323220308813901, 0.9998383903900593, -1.983145009401197 },
+		{ 0.003627982381309482, 0.9998186009327792, -1.978794035731978 },
+		{ 0.004072249170363885, 0.9997963882591158, -1.973319364839386 },
+		{ 0.004570884146658478, 0.9997714564376801, -1.966432104124481 },
+		{ 0.005130552499898453, 0.9997434727811843, -1.957769755091089 },
+		{ 0.005758757290255611, 0.9997120621354871, -1.946877475516094 },
+		{ 0.006463885231962104, 0.9996768060799256, -1.93318701161995 },
+		{ 0.007255306649988137, 0.9996372347711799, -1.915988633294648 },
+		{ 0.008143625397614932, 0.9995928187937629, -1.894396957711739 },
+		{ 0.009140682581346378, 0.9995429659252693, -1.867312774300711 },
+		{ 0.01025979203588614, 0.999487010550879, -1.833374942663341 },
+		{ 0.01151585641623706, 0.999424207179188, -1.790907776077773 },
+		{ 0.01292565347206802, 0.9993537174317561, -1.737859050630892 },
+		{ 0.01450798132700966, 0.9992746011409711, -1.671737962592194 },
+		{ 0.01628393486402201, 0.999185803384061, -1.589554178814092 },
+		{ 0.0002140418817224206, 0.999989297943731, -1.999915996233891 },
+		{ 0.0002402539579671924, 0.9999879874072427, -1.999895634037066 },
+		{ 0.0002696750824575389, 0.9999865162770624, -1.999870157718951 },
+		{ 0.0003026988484489674, 0.9999848650828639, -1.99983826370579 },
+		{ 0.0003397681314033845, 0.99998301165478, -1.999798306450004 },
+		{ 0.0003813760221932179, 0.9999809312052784, -1.999748217383028 },
+		{ 0.0004280814727634832, 0.9999785960019963, -1.999685396104728 },
+		{ 0.0004805028445858336, 0.9999759748769773, -1.99960656962848 },
+		{ 0.0005393465286912324, 0.9999730327359353, -1.999507615180677 },
+		{ 0.0006053931155918862, 0.9999697303947933, -1.999383350816027 },
+		{ 0.0006795301341335683, 0.9999660235163544, -1.999227239531347 },
+		{ 0.0007627447720074372, 0.9999618627741754, -1.999031070515955 },
+		{ 0.0008561491896146901, 0.9999571925439324, -1.998784495954072 },
+		{ 0.0009609941450497056, 0.9999519503311609, -1.998474483547209 },
+		{ 0.001078674422920263, 0.9999460662809119, -1.998084643421218 },
+		{ 0.001210767587062396, 0.999939461624028, -1.997594316311407 },
+		{ 0.001359035015382196, 0.9999320482689169, -1.996977515444642 },
+		{ 0.001525460455043486, 0.9999237270027994, -1.996201495338461 },
+		{ 0.001712268553324449, 0.9999143870839539, -1.995225094256315 },
+		{ 0.001921942114637869, 0.9999039029710927, -1.993996360723552 },
+		{ 0.00215729066892253, 0.9998921354706697, -1.99245010970846 },
+		{ 0.00171226855332445, 0.9999143870839539, -1.995225094256315 },
+		{ 0.00192194211463787, 0.9999039029710927, -1.993996360723552 },
+		{ 0.002157290668922532, 0.9998921354706697, -1.99245010970846 },
+		{ 0.00242147255846222, 0.9998789267493468, -1.990504103822282 },
+		{ 0.002717982011378645, 0.9998641009916696, -1.988055072070793 },
+		{ 0.003050837643482305, 0.9998474594959691, -1.984972891902056 },
+		{ 0.003424390514337298, 0.9998287814974788, -1.98109440254788 },
+		{ 0.00384369953635109, 0.9998078151768245, -1.976213680582106 },
+		{ 0.004314348642712827, 0.9997842825760958, -1.970073168649486 },
+		{ 0.004842651941370076, 0.9997578681574255, -1.962348733697547 },
+		{ 0.005435594651706544, 0.9997282204518797, -1.952634767385599 },
+		{ 0.006101138436417939, 0.9996949430784174, -1.94042277933557 },
+		{ 0.006848170598615005, 0.9996575914928905, -1.925077113377608 },
+		{ 0.007686660371981425, 0.9996156672886553, -1.905804880099845 },
+		{ 0.008627766605248024, 0.9995686116861983, -1.881619723307976 },
+		{ 0.009684084997986944, 0.9995157957604071, -1.851297309379625 },
+		{ 0.01086971201995819, 0.9994565147678818, -1.813326090461238 },
+		{ 0.01220041567833558, 0.9993899792165599, -1.765850670972606 },
+		{ 0.01369399632535745, 0.9993153002293662, -1.70660670088199 },
+		{ 0.01537033934658356, 0.9992314831064377, -1.632861648568635 },
+		{ 0.01725190891956688, 0.9991374078334393, -1.541353870721555 },
+		{ 0.0002402539579671924, 0.9999879874072427, -1.999895634037066 },
+		{ 0.0002696750824575389, 0.9999865162770624, -1.999870157718951 },
+		{ 0.0003026988484489674, 0.9999848650828639, -1.99983826370579 },
+		{ 0.0003397681314033845, 0.99998301165478, -1.999798306450004 },
+		{ 0.0003813760221932179, 0.9999809312052784, -1.999748217383028 },
+		{ 0.0004280814727634832, 0.9999785960019963, -1.999685396104728 },
+		{ 0.0004805028445858336, 0.9999759748769773, -1.99960656962848 },
+		{ 0.0005393465286912324, 0.9999730327359353, -1.999507615180677 },
+		{ 0.0006053931155918862, 0.9999697303947933, -1.999383350816027 },
+		{ 0.0006795301341335683, 0.9999660235163544, -1.999227239531347 },
+		{ 0.0007627447720074372, 0.9999618627741754, -1.999031070515955 },
+		{ 0.0008561491896146901, 0.9999571925439324, -1.998784495954072 },
+		{ 0.0009609941450497056, 0.9999519503311609, -1.998474483547209 },
+		{ 0.001078674422920263, 0.9999460662809119, -1.998084643421218 },
+		{ 0.001210767587062396, 0.999939461624028, -1.997594316311407 },
+		{ 0.001359035015382196, 0.9999320482689169, -1.996977515444642 },
+		{ 0.001525460455043486, 0.9999237270027994, -1.996201495338461 },
+		{ 0.001712268553324449, 0.9999143870839539, -1.995225094256315 },
+		{ 0.001921942114637869, 0.9999039029710927, -1.993996360723552 },
+		{ 0.00215729066892253, 0.9998921354706697, -1.99245010970846 },
+		{ 0.002421472558462218, 0.9998789267493468, -1.990504103822282 },
+		{ 0.00192194211463787, 0.9999039029710927, -1.993996360723552 },
+		{ 0.002157290668922532, 0.9998921354706697, -1.99245010970846 },
+		{ 0.00242147255846222, 0.9998789267493468, -1.990504103822282 },
+		{ 0.002717982011378645, 0.9998641009916696, -1.988055072070793 },
+		{ 0.003050837643482305, 0.9998474594959691, -1.984972891902056 },
+		{ 0.003424390514337298, 0.9998287814974788, -1.98109440254788 },
+		{ 0.00384369953635109, 0.9998078151768245, -1.976213680582106 },
+		{ 0.004314348642712827, 0.9997842825760958, -1.970073168649486 },
+		{ 0.004842651941370076, 0.9997578681574255, -1.962348733697547 },
+		{ 0.005435594651706544, 0.9997282204518797, -1.952634767385599 },
+		{ 0.006101138436417939, 0.9996949430784174, -1.94042277933557 },
+		{ 0.006848170598615005, 0.9996575914928905, -1.925077113377608 },
+		{ 0.007686660371981425, 0.9996156672886553, -1.905804880099845 },
+		{ 0.008627766605248024, 0.9995686116861983, -1.881619723307976 },
+		{ 0.009684084997986944, 0.9995157957604071, -1.851297309379625 },
+		{ 0.01086971201995819, 0.9994565147678818, -1.813326090461238 },
+		{ 0.01220041567833558, 0.9993899792165599, -1.765850670972606 },
+		{ 0.01369399632535745, 0.9993153002293662, -1.70660670088199 },
+		{ 0.01537033934658356, 0.9992314831064377, -1.632861648568635 },
+		{ 0.01725190891956688, 0.9991374078334393, -1.541353870721555 },
+		{ 0.01936352974883234, 0.999031827609222, -1.428271934697207 },
+		{ 0.0002696750824575389, 0.9999865162770624, -1.999870157718951 },
+		{ 0.0003026988484489674, 0.9999848650828639, -1.99983826370579 },
+		{ 0.0003397681314033846, 0.99998301165478, -1.999798306450004 },
+		{ 0.0003813760221932179, 0.9999809312052784, -1.999748217383028 },
+		{ 0.0004280814727634833, 0.9999785960019963, -1.999685396104728 },
+		{ 0.0004805028445858338, 0.9999759748769773, -1.99960656962848 },
+		{ 0.0005393465286912326, 0.9999730327359353, -1.999507615180677 },
+		{ 0.0006053931155918866, 0.9999697303947933, -1.999383350816027 },
+		{ 0.0006795301341335684, 0.9999660235163544, -1.999227239531347 },
+		{ 0.0007627447720074376, 0.9999618627741754, -1.999031070515955 },
+		{ 0.0008561491896146904, 0.9999571925439324, -1.998784495954072 },
+		{ 0.0009609941450497057, 0.9999519503311609, -1.998474483547209 },
+		{ 0.001078674422920263, 0.9999460662809119, -1.998084643421218 },
+		{ 0.001210767587062396, 0.999939461624028, -1.997594316311407 },
+		{ 0.001359035015382196, 0.9999320482689169, -1.996977515444642 },
+		{ 0.001525460455043486, 0.9999237270027994, -1.996201495338461 },
+		{ 0.001712268553324449, 0.9999143870839539, -1.995225094256315 },
+		{ 0.001921942114637869, 0.9999039029710927, -1.993996360723552 },
+		{ 0.00215729066892253, 0.9998921354706697, -1.99245010970846 },
+		{ 0.002421472558462218, 0.9998789267493468, -1.990504103822282 },
+		{ 0.002717982011378644, 0.9998641009916696, -1.988055072070793 },
+		{ 0.002157290668922532, 0.9998921354706697, -1.99245010970846 },
+		{ 0.00242147255846222, 0.9998789267493468, -1.990504103822282 },
+		{ 0.00271798201138089, 0.9998641009916696, -1.988055072070793 },
+		{ 0.003050837643482305, 0.9998474594959691, -1.984972891902056 },
+		{ 0.0034243905143373, 0.9998287814974788, -1.98109440254788 },
+		{ 0.003843699536351091, 0.9998078151768245, -1.976213680582106 },
+		{ 0.004314348642712828, 0.9997842825760958, -1.970073168649486 },
+		{ 0.004842651941370079, 0.9997578681574255, -1.962348733697547 },
+		{ 0.005435594651706546, 0.9997282204518797, -1.952634767385599 },
+		{ 0.006101138436413485, 0.9996949430784174, -1.94042277933557 },
+		{ 0.006848170598617232, 0.9996575914928905, -1.925077113377608 },
+		{ 0.007686660371983654, 0.9996156672886553, -1.905804880099845 },
+		{ 0.008627766605248026, 0.9995686116861983, -1.881619723307976 },
+		{ 0.009684084997981507, 0.9995157957604071, -1.851297309379625 },
+		{ 0.01086971201996042, 0.9994565147678818, -1.813326090461238 },
+		{ 0.01220041567833781, 0.9993899792165599, -1.765850670972606 },
+		{ 0.01369399632535968, 0.9993153002293662, -1.70660670088199 },
+		{ 0.01537033934657949, 0.9992314831064377, -1.632861648568635 },
+		{ 0.01725190891956644, 0.9991374078334393, -1.541353870721555 },
+		{ 0.0193635297488289, 0.999031827609222, -1.428271934697207 },
+		{ 0.02173395584433298, 0.9989133216430249, -1.289234427054485 },
+		{ 0.0002857096092226997, 0.9999857145275692, -1.999855107193774 },
+		{ 0.0003206992561748759, 0.9999839650796827, -1.999819410068407 },
+		{ 0.0003599709187077813, 0.9999820014540647, -1.999774676670639 },
+		{ 0.0004040548563145437, 0.9999797973089454, -1.999718585171967 },
+		{ 0.0004535355097153633, 0.9999773232759618, -1.999648218930248 },
+		{ 0.0005090738860599829, 0.9999745463057859, -1.999559905405264 },
+		{ 0.0005714151369485631, 0.999971429259213, -1.999449020713854 },
+		{ 0.0006413910496939771, 0.9999679304982937, -1.999309746166673 },
+		{ 0.0007199353584600716, 0.9999640032320768, -1.999134754544961 },
+		{ 0.0008080982278907822, 0.9999595951078482, -1.998914829576402 },
+		{ 0.0009070572999136621, 0.9999546471479662, -1.998638357748879 },
+		{ 0.001018134814320826, 0.9999490932594624, -1.998290722692466 },
+		{ 0.001142813948150686, 0.9999428593347134, -1.997853527914739 },
+		{ 0.001282761179125893, 0.9999358619432331, -1.997303593324514 },
+		{ 0.001439844801581977, 0.999928007759921, -1.996611760364314 },
+		{ 0.001616165006075818, 0.9999191917664461, -1.995741297145098 },
+		{ 0.001814073462184045, 0.999909296352814, -1.994645990766496 },
+		{ 0.00203622824044803, 0.9998981889468129, -1.993267604412823 },
+		{ 0.00228557087134319, 0.9998857220980886, -1.991533024389042 },
+		{ 0.00256544078685357, 0.9998717281637601, -1.989349946990546 },
+		{ 0.002879585945502867, 0.9998560207027247, -1.986602506088068 }
+	}
+};
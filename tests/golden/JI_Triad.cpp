@@ -0,0 +1,1647 @@
+#include "Scales.hpp"
+Scale ji_triads = {
+	.name = "Triads (JI)",
+	.description = "Western triads in G, Just Intonation. G1 is defined as a perfect fifth above C1=32.7Hz",
+	.scalename = {
+		"Unison, M2, P5; G1-D8",
+		"Unison, M3, d5; G1-C#8",
+		"Unison, m3, M7; G1-D8",
+		"Unison, M3, d5; G1-D8",
+		"Unison, P4, P5; G1-D8",
+		"Unison, M3, M6; G1-E8",
+		"Unison, m3, m6; G1-D#8",
+		"Unison, m3, M6; G1-E8",
+		"Unison, m3, m7; G1-F8",
+		"Unison, m3, m7; G1-F8",
+		"Unison, P5, M7; G1-F#8"},
+	.notedesc = {
+		"Oct",
+		"M2",
+		"P5",
+		"Oct",
+		"M2",
+		"P5",
+		"Oct",
+		"M2",
+		"P5",
+		"Oct",
+		"M2",
+		"P5",
+		"Oct",
+		"M2",
+		"P5",
+		"Oct",
+		"M2",
+		"P5",
+		"Oct",
+		"M2",
+		"P5",
+		"Oct",
+		"M3",
+		"d5",
+		"Oct",
+		"M3",
+		"d5",
+		"Oct",
+		"M3",
+		"d5",
+		"Oct",
+		"M3",
+		"d5",
+		"Oct",
+		"M3",
+		"d5",
+		"Oct",
+		"M3",
+		"d5",
+		"Oct",
+		"M3",
+		"d5",
+		"Oct",
+		"m3",
+		"M7",
+		"Oct",
+		"m3",
+		"M7",
+		"Oct",
+		"m3",
+		"M7",
+		"Oct",
+		"m3",
+		"M7",
+		"Oct",
+		"m3",
+		"M7",
+		"Oct",
+		"m3",
+		"M7",
+		"Oct",
+		"m3",
+		"M7",
+		"Oct",
+		"M3",
+		"P5",
+		"Oct",
+		"M3",
+		"P5",
+		"Oct",
+		"M3",
+		"P5",
+		"Oct",
+		"M3",
+		"P5",
+		"Oct",
+		"M3",
+		"P5",
+		"Oct",
+		"M3",
+		"P5",
+		"Oct",
+		"M3",
+		"P5",
+		"Oct",
+		"m3",
+		"d5",
+		"Oct",
+		"m3",
+		"d5",
+		"Oct",
+		"m3",
+		"d5",
+		"Oct",
+		"m3",
+		"d5",
+		"Oct",
+		"m3",
+		"d5",
+		"Oct",
+		"m3",
+		"d5",
+		"Oct",
+		"m3",
+		"d5",
+		"Oct",
+		"P4",
+		"P5",
+		"Oct",
+		"P4",
+		"P5",
+		"Oct",
+		"P4",
+		"P5",
+		"Oct",
+		"P4",
+		"P5",
+		"Oct",
+		"P4",
+		"P5",
+		"Oct",
+		"P4",
+		"P5",
+		"Oct",
+		"P4",
+		"P5",
+		"Oct",
+		"M3",
+		"M6",
+		"Oct",
+		"M3",
+		"M6",
+		"Oct",
+		"M3",
+		"M6",
+		"Oct",
+		"M3",
+		"M6",
+		"Oct",
+		"M3",
+		"M6",
+		"Oct",
+		"M3",
+		"M6",
+		"Oct",
+		"M3",
+		"M6",
+		"Oct",
+		"m3",
+		"m6",
+		"Oct",
+		"m3",
+		"m6",
+		"Oct",
+		"m3",
+		"m6",
+		"Oct",
+		"m3",
+		"m6",
+		"Oct",
+		"m3",
+		"m6",
+		"Oct",
+		"m3",
+		"m6",
+		"Oct",
+		"m3",
+		"m6",
+		"Oct",
+		"M3",
+		"m6",
+		"Oct",
+		"M3",
+		"m6",
+		"Oct",
+		"M3",
+		"m6",
+		"Oct",
+		"M3",
+		"m6",
+		"Oct",
+		"M3",
+		"m6",
+		"Oct",
+		"M3",
+		"m6",
+		"Oct",
+		"M3",
+		"m6",
+		"Oct",
+		"m3",
+		"m7",
+		"Oct",
+		"m3",
+		"m7",
+		"Oct",
+		"m3",
+		"m7",
+		"Oct",
+		"m3",
+		"m7",
+		"Oct",
+		"m3",
+		"m7",
+		"Oct",
+		"m3",
+		"m7",
+		"Oct",
+		"m3",
+		"m7",
+		"Oct",
+		"P5",
+		"M7",
+		"Oct",
+		"P5",
+		"M7",
+		"Oct",
+		"P5",
+		"M7",
+		"Oct",
+		"P5",
+		"M7",
+		"Oct",
+		"P5",
+		"M7",
+		"Oct",
+		"P5",
+		"M7",
+		"Oct",
+		"P5",
+		"M7"},
+	.c_maxq48000 = {
+		0.00642062998577414,
+		0.007223208733995908,
+		0.00963094497866121,
+		0.01284125997154828,
+		0.01444641746799182,
+		0.01926188995732242,
+		0.02568251994309656,
+		0.02889283493598363,
+		0.03852377991464484,
+		0.05136503988619312,
+		0.05778566987196727,
+		0.07704755982928968,
+		0.1027300797723862,
+		0.1155713397439345,
+		0.1540951196585794,
+		0.2054601595447725,
+		0.2311426794878691,
+		0.3081902393171587,
+		0.410920319089545,
+		0.4622853589757381,
+		0.6163804786343174,
+		0.00642062998577414,
+		0.008025787482217675,
+		0.009172328551105915,
+		0.01284125997154828,
+		0.01605157496443535,
+		0.01834465710221183,
+		0.02568251994309656,
+		0.0321031499288707,
+		0.03668931420442366,
+		0.05136503988619312,
+		0.0642062998577414,
+		0.07337862840884732,
+		0.1027300797723862,
+		0.1284125997154828,
+		0.1467572568176946,
+		0.2054601595447725,
+		0.2568251994309656,
+		0.2935145136353893,
+		0.410920319089545,
+		0.5136503988619312,
+		0.5870290272707785,
+		0.00642062998577414,
+		0.007704755982928969,
+		0.01203868122332651,
+		0.01284125997154828,
+		0.01540951196585794,
+		0.02407736244665303,
+		0.02568251994309656,
+		0.03081902393171588,
+		0.04815472489330605,
+		0.05136503988619312,
+		0.06163804786343175,
+		0.0963094497866121,
+		0.1027300797723862,
+		0.1232760957268635,
+		0.1926188995732242,
+		0.2054601595447725,
+		0.246552191453727,
+		0.3852377991464484,
+		0.410920319089545,
+		0.493104382907454,
+		0.7704755982928968,
+		0.00642062998577414,
+		0.008025787482217675,
+		0.00963094497866121,
+		0.01284125997154828,
+		0.01605157496443535,
+		0.01926188995732242,
+		0.02568251994309656,
+		0.0321031499288707,
+		0.03852377991464484,
+		0.05136503988619312,
+		0.0642062998577414,
+		0.07704755982928968,
+		0.1027300797723862,
+		0.1284125997154828,
+		0.1540951196585794,
+		0.2054601595447725,
+		0.2568251994309656,
+		0.3081902393171587,
+		0.410920319089545,
+		0.5136503988619312,
+		0.6163804786343174,
+		0.00642062998577414,
+		0.007704755982928969,
+		0.009172328551105915,
+		0.01284125997154828,
+		0.01540951196585794,
+		0.01834465710221183,
+		0.02568251994309656,
+		0.03081902393171588,
+		0.03668931420442366,
+		0.05136503988619312,
+		0.06163804786343175,
+		0.07337862840884732,
+		0.1027300797723862,
+		0.1232760957268635,
+		0.1467572568176946,
+		0.2054601595447725,
+		0.246552191453727,
+		0.2935145136353893,
+		0.410920319089545,
+		0.493104382907454,
+		0.5870290272707785,
+		0.00642062998577414,
+		0.008560839981032187,
+		0.00963094497866121,
+		0.01284125997154828,
+		0.01712167996206437,
+		0.01926188995732242,
+		0.02568251994309656,
+		0.03424335992412875,
+		0.03852377991464484,
+		0.05136503988619312,
+		0.06848671984825749,
+		0.07704755982928968,
+		0.1027300797723862,
+		0.136973439696515,
+		0.1540951196585794,
+		0.2054601595447725,
+		0.27394687939303,
+		0.3081902393171587,
+		0.410920319089545,
+		0.5478937587860599,
+		0.6163804786343174,
+		0.00642062998577414,
+		0.008025787482217675,
+		0.01070104997629023,
+		0.01284125997154828,
+		0.01605157496443535,
+		0.02140209995258047,
+		0.02568251994309656,
+		0.0321031499288707,
+		0.04280419990516093,
+		0.05136503988619312,
+		0.0642062998577414,
+		0.08560839981032187,
+		0.1027300797723862,
+		0.1284125997154828,
+		0.1712167996206437,
+		0.2054601595447725,
+		0.2568251994309656,
+		0.3424335992412875,
+		0.410920319089545,
+		0.5136503988619312,
+		0.6848671984825749,
+		0.00642062998577414,
+		0.007704755982928969,
+		0.01027300797723862,
+		0.01284125997154828,
+		0.01540951196585794,
+		0.02054601595447725,
+		0.02568251994309656,
+		0.03081902393171588,
+		0.0410920319089545,
+		0.05136503988619312,
+		0.06163804786343175,
+		0.08218406381790899,
+		0.1027300797723862,
+		0.1232760957268635,
+		0.164368127635818,
+		0.2054601595447725,
+		0.246552191453727,
+		0.328736255271636,
+		0.410920319089545,
+		0.493104382907454,
+		0.6574725105432719,
+		0.00642062998577414,
+		0.008025787482217675,
+		0.01027300797723862,
+		0.01284125997154828,
+		0.01605157496443535,
+		0.02054601595447725,
+		0.02568251994309656,
+		0.0321031499288707,
+		0.0410920319089545,
+		0.05136503988619312,
+		0.0642062998577414,
+		0.08218406381790899,
+		0.1027300797723862,
+		0.1284125997154828,
+		0.164368127635818,
+		0.2054601595447725,
+		0.2568251994309656,
+		0.328736255271636,
+		0.410920319089545,
+		0.5136503988619312,
+		0.6574725105432719,
+		0.00642062998577414,
+		0.007704755982928969,
+		0.01141445330804292,
+		0.01284125997154828,
+		0.01540951196585794,
+		0.02282890661608583,
+		0.02568251994309656,
+		0.03081902393171588,
+		0.04565781323217166,
+		0.05136503988619312,
+		0.06163804786343175,
+		0.09131562646434332,
+		0.1027300797723862,
+		0.1232760957268635,
+		0.1826312529286866,
+		0.2054601595447725,
+		0.246552191453727,
+		0.3652625058573733,
+		0.410920319089545,
+		0.493104382907454,
+		0.7305250117147466,
+		0.00642062998577414,
+		0.00963094497866121,
+		0.01203868122332651,
+		0.01284125997154828,
+		0.01926188995732242,
+		0.02407736244665303,
+		0.02568251994309656,
+		0.03852377991464484,
+		0.04815472489330605,
+		0.05136503988619312,
+		0.07704755982928968,
+		0.0963094497866121,
+		0.1027300797723862,
+		0.1540951196585794,
+		0.1926188995732242,
+		0.2054601595447725,
+		0.3081902393171587,
+		0.3852377991464484,
+		0.410920319089545,
+		0.6163804786343174,
+		0.7704755982928968
+	},
+	.c_maxq96000 = {
+		0.00321031499288707,
+		0.003611604366997954,
+		0.004815472489330605,
+		0.00642062998577414,
+		0.007223208733995908,
+		0.00963094497866121,
+		0.01284125997154828,
+		0.01444641746799182,
+		0.01926188995732242,
+		0.02568251994309656,
+		0.02889283493598363,
+		0.03852377991464484,
+		0.05136503988619312,
+		0.05778566987196727,
+		0.07704755982928968,
+		0.1027300797723862,
+		0.1155713397439345,
+		0.1540951196585794,
+		0.2054601595447725,
+		0.2311426794878691,
+		0.3081902393171587,
+		0.00321031499288707,
+		0.004012893741108838,
+		0.004586164275552957,
+		0.00642062998577414,
+		0.008025787482217675,
+		0.009172328551105915,
+		0.01284125997154828,
+		0.01605157496443535,
+		0.01834465710221183,
+		0.02568251994309656,
+		0.0321031499288707,
+		0.03668931420442366,
+		0.05136503988619312,
+		0.0642062998577414,
+		0.07337862840884732,
+		0.1027300797723862,
+		0.1284125997154828,
+		0.1467572568176946,
+		0.2054601595447725,
+		0.2568251994309656,
+		0.2935145136353893,
+		0.00321031499288707,
+		0.003852377991464484,
+		0.006019340611663256,
+		0.00642062998577414,
+		0.007704755982928969,
+		0.01203868122332651,
+		0.01284125997154828,
+		0.01540951196585794,
+		0.02407736244665303,
+		0.02568251994309656,
+		0.03081902393171588,
+		0.04815472489330605,
+		0.05136503988619312,
+		0.06163804786343175,
+		0.0963094497866121,
+		0.1027300797723862,
+		0.1232760957268635,
+		0.1926188995732242,
+		0.2054601595447725,
+		0.246552191453727,
+		0.3852377991464484,
+		0.00321031499288707,
+		0.004012893741108838,
+		0.004815472489330605,
+		0.00642062998577414,
+		0.008025787482217675,
+		0.00963094497866121,
+		0.01284125997154828,
+		0.01605157496443535,
+		0.01926188995732242,
+		0.02568251994309656,
+		0.0321031499288707,
+		0.03852377991464484,
+		0.05136503988619312,
+		0.0642062998577414,
+		0.07704755982928968,
+		0.1027300797723862,
+		0.1284125997154828,
+		0.1540951196585794,
+		0.2054601595447725,
+		0.2568251994309656,
+		0.3081902393171587,
+		0.00321031499288707,
+		0.003852377991464484,
+		0.004586164275552957,
+		0.00642062998577414,
+		0.007704755982928969,
+		0.009172328551105915,
+		0.01284125997154828,
+		0.01540951196585794,
+		0.01834465710221183,
+		0.02568251994309656,
+		0.03081902393171588,
+		0.03668931420442366,
+		0.05136503988619312,
+		0.06163804786343175,
+		0.07337862840884732,
+		0.1027300797723862,
+		0.1232760957268635,
+		0.1467572568176946,
+		0.2054601595447725,
+		0.246552191453727,
+		0.2935145136353893,
+		0.00321031499288707,
+		0.004280419990516093,
+		0.004815472489330605,
+		0.00642062998577414,
+		0.008560839981032187,
+		0.00963094497866121,
+		0.01284125997154828,
+		0.01712167996206437,
+		0.01926188995732242,
+		0.02568251994309656,
+		0.03424335992412875,
+		0.03852377991464484,
+		0.05136503988619312,
+		0.06848671984825749,
+		0.07704755982928968,
+		0.1027300797723862,
+		0.136973439696515,
+		0.1540951196585794,
+		0.2054601595447725,
+		0.27394687939303,
+		0.3081902393171587,
+		0.00321031499288707,
+		0.004012893741108838,
+		0.005350524988145117,
+		0.00642062998577414,
+		0.008025787482217675,
+		0.01070104997629023,
+		0.01284125997154828,
+		0.01605157496443535,
+		0.02140209995258047,
+		0.02568251994309656,
+		0.0321031499288707,
+		0.04280419990516093,
+		0.05136503988619312,
+		0.0642062998577414,
+		0.08560839981032187,
+		0.1027300797723862,
+		0.1284125997154828,
+		0.1712167996206437,
+		0.2054601595447725,
+		0.2568251994309656,
+		0.3424335992412875,
+		0.00321031499288707,
+		0.003852377991464484,
+		0.005136503988619312,
+		0.00642062998577414,
+		0.007704755982928969,
+		0.01027300797723862,
+		0.01284125997154828,
+		0.01540951196585794,
+		0.02054601595447725,
+		0.02568251994309656,
+		0.03081902393171588,
+		0.0410920319089545,
+		0.05136503988619312,
+		0.06163804786343175,
+		0.08218406381790899,
+		0.1027300797723862,
+		0.1232760957268635,
+		0.164368127635818,
+		0.2054601595447725,
+		0.246552191453727,
+		0.328736255271636,
+		0.00321031499288707,
+		0.004012893741108838,
+		0.005136503988619312,
+		0.00642062998577414,
+		0.008025787482217675,
+		0.01027300797723862,
+		0.01284125997154828,
+		0.01605157496443535,
+		0.02054601595447725,
+		0.02568251994309656,
+		0.0321031499288707,
+		0.0410920319089545,
+		0.05136503988619312,
+		0.0642062998577414,
+		0.08218406381790899,
+		0.1027300797723862,
+		0.1284125997154828,
+		0.164368127635818,
+		0.2054601595447725,
+		0.2568251994309656,
+		0.328736255271636,
+		0.00321031499288707,
+		0.003852377991464484,
+		0.005707226654021458,
+		0.00642062998577414,
+		0.007704755982928969,
+		0.01141445330804292,
+		0.01284125997154828,
+		0.01540951196585794,
+		0.02282890661608583,
+		0.02568251994309656,
+		0.03081902393171588,
+		0.04565781323217166,
+		0.05136503988619312,
+		0.06163804786343175,
+		0.09131562646434332,
+		0.1027300797723862,
+		0.1232760957268635,
+		0.1826312529286866,
+		0.2054601595447725,
+		0.246552191453727,
+		0.3652625058573733,
+		0.00321031499288707,
+		0.004815472489330605,
+		0.006019340611663256,
+		0.00642062998577414,
+		0.00963094497866121,
+		0.01203868122332651,
+		0.01284125997154828,
+		0.01926188995732242,
+		0.02407736244665303,
+		0.02568251994309656,
+		0.03852377991464484,
+		0.04815472489330605,
+		0.05136503988619312,
+		0.07704755982928968,
+		0.0963094497866121,
+		0.1027300797723862,
+		0.1540951196585794,
+		0.1926188995732242,
+		0.2054601595447725,
+		0.3081902393171587,
+		0.3852377991464484
+	},
+	.c_bpre4800022 = {
+		{ 0.003205167441604101, 0.9967948325583961, -1.996753674276071 },
+		{ 0.003605093629019515, 0.9963949063710044, -1.99634282580607 },
+		{ 0.004803896690117656, 0.9951961033098822, -1.995103571716893 },
+		{ 0.006400061784879453, 0.9935999382151207, -1.9934355701947 },
+		{ 0.007197216550615991, 0.9928027834505658, -1.992594837231135 },
+		{ 0.009584715956826209, 0.9904152840431738, -1.990046053117277 },
+		{ 0.01275916277890811, 0.9872408372210918, -1.986585489333262 },
+		{ 0.01434256866168309, 0.985657431338317, -1.98482867964211 },
+		{ 0.01907756513367893, 0.9809224348663208, -1.979452691360997 },
+		{ 0.02535552932299793, 0.9746444706770022, -1.972040124631779 },
+		{ 0.02847942804755089, 0.971520571952449, -1.968229853175743 },
+		{ 0.03779117677592855, 0.9622088232240715, -1.95638754773454 },
+		{ 0.05006815577874564, 0.949931844221254, -1.939651617081105 },
+		{ 0.05614777827318607, 0.9438522217268136, -1.930884905703334 },
+		{ 0.07415418050974729, 0.9258458194902526, -1.903026129142182 },
+		{ 0.09762949133440732, 0.9023705086655925, -1.86235834448687 },
+		{ 0.109142983541358, 0.8908570164586421, -1.8405701546808 },
+		{ 0.1428095185324228, 0.8571904814675775, -1.769687267746072 },
+		{ 0.1857274650905998, 0.8142725349094003, -1.663240853622769 },
+		{ 0.2063737762264066, 0.7936262237735933, -1.605359283257672 },
+		{ 0.2652244784813826, 0.7347755215186174, -1.415535520506665 },
+		{ 0.003205167441604101, 0.9967948325583961, -1.996753674276071 },
+		{ 0.004004852842373051, 0.9959951471576267, -1.9959308632208 },
+		{ 0.004575662021047643, 0.9954243379789586, -1.995340399503766 },
+		{ 0.006400061784879453, 0.9935999382151207, -1.9934355701947 },
+		{ 0.007993666838457588, 0.9920063331615423, -1.991749715409004 },
+		{ 0.009130400329680471, 0.9908695996703951, -1.990534618248171 },
+		{ 0.01275916277890811, 0.9872408372210918, -1.986585489333262 },
+		{ 0.01592343496739134, 0.9840765650326088, -1.98305424604643 },
+		{ 0.01817743644918183, 0.9818225635509692, -1.980488839052397 },
+		{ 0.02535552932299793, 0.9746444706770022, -1.972040124631779 },
+		{ 0.03159331415362125, 0.9684066858463785, -1.964350751469719 },
+		{ 0.03602439061031748, 0.9639756093898509, -1.958690551698585 },
+		{ 0.05006815577874564, 0.949931844221254, -1.939651617081105 },
+		{ 0.06218849080803343, 0.9378115091919667, -1.921856393986694 },
+		{ 0.07075090286673077, 0.9292490971369485, -1.908510677593372 },
+		{ 0.09762949133440732, 0.9023705086655925, -1.86235834448687 },
+		{ 0.1205095732270861, 0.8794904267729141, -1.817845557713384 },
+		{ 0.1364966806359552, 0.8635033193680484, -1.783806526790264 },
+		{ 0.1857274650905998, 0.8142725349094003, -1.663240853622769 },
+		{ 0.226496589214798, 0.7735034107852021, -1.544644598471812 },
+		{ 0.254361529421494, 0.7456384705787155, -1.453401215300405 },
+		{ 0.003205167441604101, 0.9967948325583961, -1.996753674276071 },
+		{ 0.003844967102938827, 0.9961550328970612, -1.996095784050304 },
+		{ 0.006001263928451553, 0.9939987360715625, -1.993854242695116 },
+		{ 0.006400061784879453, 0.9935999382151207, -1.9934355701947 },
+		{ 0.007675150433855265, 0.992324849566145, -1.992088312431685 },
+		{ 0.0119665385554992, 0.988033461445208, -1.987457235385533 },
+		{ 0.01275916277890811, 0.9872408372210918, -1.986585489333262 },
+		{ 0.01529139293352764, 0.9847086070664723, -1.983766131407876 },
+		{ 0.02378981517179514, 0.9762101848282044, -1.973919332867571 },
+		{ 0.02535552932299793, 0.9746444706770022, -1.972040124631779 },
+		{ 0.03034895916920792, 0.969651040830792, -1.965910627966757 },
+		{ 0.04701367503768289, 0.9529863249623171, -1.943935851645509 },
+		{ 0.05006815577874564, 0.949931844221254, -1.939651617081105 },
+		{ 0.05977685901576171, 0.9402231409842382, -1.925499020587546 },
+		{ 0.09181706443481732, 0.9081829355651827, -1.872893507169822 },
+		{ 0.09762949133440732, 0.9023705086655925, -1.86235834448687 },
+		{ 0.1159804451577331, 0.8840195548422668, -1.827046167826311 },
+		{ 0.1752037555482067, 0.824796244451793, -1.69105528324206 },
+		{ 0.1857274650905998, 0.8142725349094003, -1.663240853622769 },
+		{ 0.2185094266564803, 0.7814905733435195, -1.569257337158561 },
+		{ 0.3197111551382181, 0.6802888448617819, -1.205740842065577 },
+		{ 0.003205167441604101, 0.9967948325583961, -1.996753674276071 },
+		{ 0.004004852842373051, 0.9959951471576267, -1.9959308632208 },
+		{ 0.004803896690117656, 0.9951961033098822, -1.995103571716893 },
+		{ 0.006400061784879453, 0.9935999382151207, -1.9934355701947 },
+		{ 0.007993666838457588, 0.9920063331615423, -1.991749715409004 },
+		{ 0.009584715956826209, 0.9904152840431738, -1.990046053117277 },
+		{ 0.01275916277890811, 0.9872408372210918, -1.986585489333262 },
+		{ 0.01592343496739134, 0.9840765650326088, -1.98305424604643 },
+		{ 0.01907756513367893, 0.9809224348663208, -1.979452691360997 },
+		{ 0.02535552932299793, 0.9746444706770022, -1.972040124631779 },
+		{ 0.03159331415362125, 0.9684066858463785, -1.964350751469719 },
+		{ 0.03779117677592855, 0.9622088232240715, -1.95638754773454 },
+		{ 0.05006815577874564, 0.949931844221254, -1.939651617081105 },
+		{ 0.06218849080803343, 0.9378115091919667, -1.921856393986694 },
+		{ 0.07415418050974729, 0.9258458194902526, -1.903026129142182 },
+		{ 0.09762949133440732, 0.9023705086655925, -1.86235834448687 },
+		{ 0.1205095732270861, 0.8794904267729141, -1.817845557713384 },
+		{ 0.1428095185324228, 0.8571904814675775, -1.769687267746072 },
+		{ 0.1857274650905998, 0.8142725349094003, -1.663240853622769 },
+		{ 0.226496589214798, 0.7735034107852021, -1.544644598471812 },
+		{ 0.2652244784813826, 0.7347755215186174, -1.415535520506665 },
+		{ 0.003205167441604101, 0.9967948325583961, -1.996753674276071 },
+		{ 0.003844967102938827, 0.9961550328970612, -1.996095784050304 },
+		{ 0.004575662021047643, 0.9954243379789586, -1.995340399503766 },
+		{ 0.006400061784879453, 0.9935999382151207, -1.9934355701947 },
+		{ 0.007675150433855265, 0.992324849566145, -1.992088312431685 },
+		{ 0.009130400329680471, 0.9908695996703951, -1.990534618248171 },
+		{ 0.01275916277890811, 0.9872408372210918, -1.986585489333262 },
+		{ 0.01529139293352764, 0.9847086070664723, -1.983766131407876 },
+		{ 0.01817743644918183, 0.9818225635509692, -1.980488839052397 },
+		{ 0.02535552932299793, 0.9746444706770022, -1.972040124631779 },
+		{ 0.03034895916920792, 0.969651040830792, -1.965910627966757 },
+		{ 0.03602439061031748, 0.9639756093898509, -1.958690551698585 },
+		{ 0.05006815577874564, 0.949931844221254, -1.939651617081105 },
+		{ 0.05977685901576171, 0.9402231409842382, -1.925499020587546 },
+		{ 0.07075090286673077, 0.9292490971369485, -1.908510677593372 },
+		{ 0.09762949133440732, 0.9023705086655925, -1.86235834448687 },
+		{ 0.1159804451577331, 0.8840195548422668, -1.827046167826311 },
+		{ 0.1364966806359552, 0.8635033193680484, -1.783806526790264 },
+		{ 0.1857274650905998, 0.8142725349094003, -1.663240853622769 },
+		{ 0.2185094266564803, 0.7814905733435195, -1.569257337158561 },
+		{ 0.254361529421494, 0.7456384705787155, -1.453401215300405 },
+		{ 0.003205167441604101, 0.9967948325583961, -1.996753674276071 },
+		{ 0.004271272049865176, 0.9957287279501347, -1.995655596932044 },
+		{ 0.004803896690117656, 0.9951961033098822, -1.995103571716893 },
+		{ 0.006400061784879453, 0.9935999382151207, -1.9934355701947 },
+		{ 0.008524300334807507, 0.9914756996651926, -1.991183804328913 },
+		{ 0.009584715956826209, 0.9904152840431738, -1.990046053117277 },
+		{ 0.01275916277890811, 0.9872408372210918, -1.986585489333262 },
+		{ 0.0169759369734164, 0.9830240630265834, -1.981861521991906 },
+		{ 0.01907756513367893, 0.9809224348663208, -1.979452691360997 },
+		{ 0.02535552932299793, 0.9746444706770022, -1.972040124631779 },
+		{ 0.03366369151070796, 0.9663363084892923, -1.961726628506107 },
+		{ 0.03779117677592855, 0.9622088232240715, -1.95638754773454 },
+		{ 0.05006815577874564, 0.949931844221254, -1.939651617081105 },
+		{ 0.06619413889528776, 0.9338058611047124, -1.915693440912805 },
+		{ 0.07415418050974729, 0.9258458194902526, -1.903026129142182 },
+		{ 0.09762949133440732, 0.9023705086655925, -1.86235834448687 },
+		{ 0.1280066137664863, 0.8719933862335137, -1.80218794261495 },
+		{ 0.1428095185324228, 0.8571904814675775, -1.769687267746072 },
+		{ 0.1857274650905998, 0.8142725349094003, -1.663240853622769 },
+		{ 0.2396275343650102, 0.7603724656349897, -1.502695368135347 },
+		{ 0.2652244784813826, 0.7347755215186174, -1.415535520506665 },
+		{ 0.003205167441604101, 0.9967948325583961, -1.996753674276071 },
+		{ 0.004004852842373051, 0.9959951471576267, -1.9959308632208 },
+		{ 0.005336236424451628, 0.9946637635755483, -1.994549557727603 },
+		{ 0.006400061784879453, 0.9935999382151207, -1.9934355701947 },
+		{ 0.007993666838457588, 0.9920063331615423, -1.991749715409004 },
+		{ 0.01064399742972557, 0.9893560025702742, -1.98890040781962 },
+		{ 0.01275916277890811, 0.9872408372210918, -1.986585489333262 },
+		{ 0.01592343496739134, 0.9840765650326088, -1.98305424604643 },
+		{ 0.02117470017816778, 0.9788252998218326, -1.977012775197733 },
+		{ 0.02535552932299793, 0.9746444706770022, -1.972040124631779 },
+		{ 0.03159331415362125, 0.9684066858463785, -1.964350751469719 },
+		{ 0.04190103242869928, 0.9580989675713006, -1.950928092653622 },
+		{ 0.05006815577874564, 0.949931844221254, -1.939651617081105 },
+		{ 0.06218849080803343, 0.9378115091919667, -1.921856393986694 },
+		{ 0.08204636833880795, 0.9179536316611919, -1.889909651819493 },
+		{ 0.09762949133440732, 0.9023705086655925, -1.86235834448687 },
+		{ 0.1205095732270861, 0.8794904267729141, -1.817845557713384 },
+		{ 0.157361130120029, 0.8426388698799712, -1.735655811188261 },
+		{ 0.1857274650905998, 0.8142725349094003, -1.663240853622769 },
+		{ 0.226496589214798, 0.7735034107852021, -1.544644598471812 },
+		{ 0.289959734967405, 0.7100402650325952, -1.324431418345154 },
+		{ 0.003205167441604101, 0.9967948325583961, -1.996753674276071 },
+		{ 0.003844967102938827, 0.9961550328970612, -1.996095784050304 },
+		{ 0.005123334709672874, 0.9948766652903268, -1.994771401867953 },
+		{ 0.006400061784879453, 0.9935999382151207, -1.9934355701947 },
+		{ 0.007675150433855265, 0.992324849566145, -1.992088312431685 },
+		{ 0.01022042086079856, 0.9897795791392016, -1.989359612359545 },
+		{ 0.01275916277890811, 0.9872408372210918, -1.986585489333262 },
+		{ 0.01529139293352764, 0.9847086070664723, -1.983766131407876 },
+		{ 0.02033638471902489, 0.979663615280975, -1.977992464919858 },
+		{ 0.02535552932299793, 0.9746444706770022, -1.972040124631779 },
+		{ 0.03034895916920792, 0.969651040830792, -1.965910627966757 },
+		{ 0.04025920089461027, 0.9597407991053898, -1.953126262777045 },
+		{ 0.05006815577874564, 0.949931844221254, -1.939651617081105 },
+		{ 0.05977685901576171, 0.9402231409842382, -1.925499020587546 },
+		{ 0.07889759853254717, 0.9211024014674527, -1.895209677501597 },
+		{ 0.09762949133440732, 0.9023705086655925, -1.86235834448687 },
+		{ 0.1159804451577331, 0.8840195548422668, -1.827046167826311 },
+		{ 0.1515703660108917, 0.8484296339891083, -1.749448252316623 },
+		{ 0.1857274650905998, 0.8142725349094003, -1.663240853622769 },
+		{ 0.2185094266564803, 0.7814905733435195, -1.569257337158561 },
+		{ 0.280167156169108, 0.7198328438308923, -1.361315376332216 },
+		{ 0.003205167441604101, 0.9967948325583961, -1.996753674276071 },
+		{ 0.004004852842373051, 0.9959951471576267, -1.9959308632208 },
+		{ 0.005123334709672874, 0.9948766652903268, -1.994771401867953 },
+		{ 0.006400061784879453, 0.9935999382151207, -1.9934355701947 },
+		{ 0.007993666838457588, 0.9920063331615423, -1.991749715409004 },
+		{ 0.01022042086079856, 0.9897795791392016, -1.989359612359545 },
+		{ 0.01275916277890811, 0.9872408372210918, -1.986585489333262 },
+		{ 0.01592343496739134, 0.9840765650326088, -1.98305424604643 },
+		{ 0.02033638471902489, 0.979663615280975, -1.977992464919858 },
+		{ 0.02535552932299793, 0.9746444706770022, -1.972040124631779 },
+		{ 0.03159331415362125, 0.9684066858463785, -1.964350751469719 },
+		{ 0.04025920089461027, 0.9597407991053898, -1.953126262777045 },
+		{ 0.05006815577874564, 0.949931844221254, -1.939651617081105 },
+		{ 0.06218849080803343, 0.9378115091919667, -1.921856393986694 },
+		{ 0.07889759853254717, 0.9211024014674527, -1.895209677501597 },
+		{ 0.09762949133440732, 0.9023705086655925, -1.86235834448687 },
+		{ 0.1205095732270861, 0.8794904267729141, -1.817845557713384 },
+		{ 0.1515703660108917, 0.8484296339891083, -1.749448252316623 },
+		{ 0.1857274650905998, 0.8142725349094003, -1.663240853622769 },
+		{ 0.226496589214798, 0.7735034107852021, -1.544644598471812 },
+		{ 0.280167156169108, 0.7198328438308923, -1.361315376332216 },
+		{ 0.003205167441604101, 0.9967948325583961, -1.996753674276071 },
+		{ 0.003844967102938827, 0.9961550328970612, -1.996095784050304 },
+		{ 0.005690971374870558, 0.9943090286251293, -1.994179111028996 },
+		{ 0.006400061784879453, 0.9935999382151207, -1.9934355701947 },
+		{ 0.007675150433855265, 0.992324849566145, -1.992088312431685 },
+		{ 0.01134955559455193, 0.9886504444054481, -1.988132265394634 },
+		{ 0.01275916277890811, 0.9872408372210918, -1.986585489333262 },
+		{ 0.01529139293352764, 0.9847086070664723, -1.983766131407876 },
+		{ 0.02257029877691013, 0.97742970122309, -1.975368948772113 },
+		{ 0.02535552932299793, 0.9746444706770022, -1.972040124631779 },
+		{ 0.03034895916920792, 0.969651040830792, -1.965910627966757 },
+		{ 0.04463117916694101, 0.955368820833059, -1.947222020112726 },
+		{ 0.05006815577874564, 0.949931844221254, -1.939651617081105 },
+		{ 0.05977685901576171, 0.9402231409842382, -1.925499020587546 },
+		{ 0.08727041618005063, 0.9127295838199495, -1.88091939016434 },
+		{ 0.09762949133440732, 0.9023705086655925, -1.86235834448687 },
+		{ 0.1159804451577331, 0.8840195548422668, -1.827046167826311 },
+		{ 0.166924706819862, 0.8330752931801381, -1.712147366860138 },
+		{ 0.1857274650905998, 0.8142725349094003, -1.663240853622769 },
+		{ 0.2185094266564803, 0.7814905733435195, -1.569257337158561 },
+		{ 0.3059855558928267, 0.6940144441071732, -1.261742928207247 },
+		{ 0.003205167441604101, 0.9967948325583961, -1.996753674276071 },
+		{ 0.004803896690117656, 0.9951961033098822, -1.995103571716893 },
+		{ 0.006001263928451553, 0.9939987360715625, -1.993854242695116 },
+		{ 0.006400061784879453, 0.9935999382151207, -1.9934355701947 },
+		{ 0.009584715956826209, 0.9904152840431738, -1.990046053117277 },
+		{ 0.0119665385554992, 0.988033461445208, -1.987457235385533 },
+		{ 0.01275916277890811, 0.9872408372210918, -1.986585489333262 },
+		{ 0.01907756513367893, 0.9809224348663208, -1.979452691360997 },
+		{ 0.02378981517179514, 0.9762101848282044, -1.973919332867571 },
+		{ 0.02535552932299793, 0.9746444706770022, -1.972040124631779 },
+		{ 0.03779117677592855, 0.9622088232240715, -1.95638754773454 },
+		{ 0.04701367503768289, 0.9529863249623171, -1.943935851645509 },
+		{ 0.05006815577874564, 0.949931844221254, -1.939651617081105 },
+		{ 0.07415418050974729, 0.9258458194902526, -1.903026129142182 },
+		{ 0.09181706443481732, 0.9081829355651827, -1.872893507169822 },
+		{ 0.09762949133440732, 0.9023705086655925, -1.86235834448687 },
+		{ 0.1428095185324228, 0.8571904814675775, -1.769687267746072 },
+		{ 0.1752037555482067, 0.824796244451793, -1.69105528324206 },
+		{ 0.1857274650905998, 0.8142725349094003, -1.663240853622769 },
+		{ 0.2652244784813826, 0.7347755215186174, -1.415535520506665 },
+		{ 0.3197111551382181, 0.6802888448617819, -1.205740842065577 }
+	},
+	.c_bpre9600022 = {
+		{ 0.001603869920162069, 0.9983961300798377, -1.998385832231168 },
+		{ 0.001804174337028881, 0.9981958256629829, -1.99818279373397 },
+		{ 0.002404839972706142, 0.9975951600272939, -1.997571999179401 },
+		{ 0.003205167441604101, 0.9967948325583961, -1.996753674276071 },
+		{ 0.003605106672366379, 0.9963948933282256, -1.99634281238611 },
+		{ 0.004803896690117656, 0.9951961033098822, -1.995103571716893 },
+		{ 0.006400061784879453, 0.9935999382151207, -1.9934355701947 },
+		{ 0.007197184060038485, 0.9928028159399616, -1.992594871601304 },
+		{ 0.009584715956826209, 0.9904152840431738, -1.990046053117277 },
+		{ 0.01275916277890811, 0.9872408372210918, -1.986585489333262 },
+		{ 0.01434256866168309, 0.985657431338317, -1.98482867964211 },
+		{ 0.01907756513367893, 0.9809224348663208, -1.979452691360997 },
+		{ 0.02535552932299793, 0.9746444706770022, -1.972040124631779 },
+		{ 0.02847942804755089, 0.971520571952449, -1.968229853175743 },
+		{ 0.03779117677592855, 0.9622088232240715, -1.95638754773454 },
+		{ 0.05006815577874564, 0.949931844221254, -1.939651617081105 },
+		{ 0.05614777827318607, 0.9438522217268136, -1.930884905703334 },
+		{ 0.07415418050974729, 0.9258458194902526, -1.903026129142182 },
+		{ 0.09762949133440732, 0.9023705086655925, -1.86235834448687 },
+		{ 0.109142983541358, 0.8908570164586421, -1.8405701546808 },
+		{ 0.1428095185324228, 0.8571904814675775, -1.769687267746072 },
+		{ 0.001603869920162069, 0.9983961300798377, -1.998385832231168 },
+		{ 0.002004435301626584, 0.9979955646983741, -1.997979477542813 },
+		{ 0.002290454100517092, 0.997709545899486, -1.997688537138129 },
+		{ 0.003205167441604101, 0.9967948325583961, -1.996753674276071 },
+		{ 0.004004852842373051, 0.9959951471576267, -1.9959308632208 },
+		{ 0.004575668536116855, 0.9954243314639216, -1.995340392749422 },
+		{ 0.006400061784879453, 0.9935999382151207, -1.9934355701947 },
+		{ 0.007993666838457588, 0.9920063331615423, -1.991749715409004 },
+		{ 0.009130400329680471, 0.9908695996703951, -1.990534618248171 },
+		{ 0.01275916277890811, 0.9872408372210918, -1.986585489333262 },
+		{ 0.01592343496739134, 0.9840765650326088, -1.98305424604643 },
+		{ 0.01817740431904717, 0.9818225956810377, -1.980488875918723 },
+		{ 0.02535552932299793, 0.9746444706770022, -1.972040124631779 },
+		{ 0.03159331415362125, 0.9684066858463785, -1.964350751469719 },
+		{ 0.03602432751996325, 0.9639756724819091, -1.958690633468286 },
+		{ 0.05006815577874564, 0.949931844221254, -1.939651617081105 },
+		{ 0.06218849080803343, 0.9378115091919667, -1.921856393986694 },
+		{ 0.07075120696112713, 0.9292487930409422, -1.908510192122349 },
+		{ 0.09762949133440732, 0.9023705086655925, -1.86235834448687 },
+		{ 0.1205095732270861, 0.8794904267729141, -1.817845557713384 },
+		{ 0.1364963980512159, 0.8635036019488951, -1.783807150160064 },
+		{ 0.001603869920162069, 0.9983961300798377, -1.998385832231168 },
+		{ 0.001924335084227494, 0.9980756649157725, -1.998060838397271 },
+		{ 0.003005147419732666, 0.9969948525802743, -1.996958674630715 },
+		{ 0.003205167441604101, 0.9967948325583961, -1.996753674276071 },
+		{ 0.003844967102938827, 0.9961550328970612, -1.996095784050304 },
+		{ 0.006001276940205033, 0.9939987230601497, -1.993854229056204 },
+		{ 0.006400061784879453, 0.9935999382151207, -1.9934355701947 },
+		{ 0.007675150433855265, 0.992324849566145, -1.992088312431685 },
+		{ 0.01196650622147186, 0.9880334937785281, -1.987457270842072 },
+		{ 0.01275916277890811, 0.9872408372210918, -1.986585489333262 },
+		{ 0.01529139293352764, 0.9847086070664723, -1.983766131407876 },
+		{ 0.02378981517179514, 0.9762101848282044, -1.973919332867571 },
+		{ 0.02535552932299793, 0.9746444706770022, -1.972040124631779 },
+		{ 0.03034895916920792, 0.969651040830792, -1.965910627966757 },
+		{ 0.04701367503768289, 0.9529863249623171, -1.943935851645509 },
+		{ 0.05006815577874564, 0.949931844221254, -1.939651617081105 },
+		{ 0.05977685901576171, 0.9402231409842382, -1.925499020587546 },
+		{ 0.09181706443481732, 0.9081829355651827, -1.872893507169822 },
+		{ 0.09762949133440732, 0.9023705086655925, -1.86235834448687 },
+		{ 0.1159804451577331, 0.8840195548422668, -1.827046167826311 },
+		{ 0.1752037555482067, 0.824796244451793, -1.69105528324206 },
+		{ 0.001603869920162069, 0.9983961300798377, -1.998385832231168 },
+		{ 0.002004435301626584, 0.9979955646983741, -1.997979477542813 },
+		{ 0.002404839972706142, 0.9975951600272939, -1.997571999179401 },
+		{ 0.003205167441604101, 0.9967948325583961, -1.996753674276071 },
+		{ 0.004004852842373051, 0.9959951471576267, -1.9959308632208 },
+		{ 0.004803896690117656, 0.9951961033098822, -1.995103571716893 },
+		{ 0.006400061784879453, 0.9935999382151207, -1.9934355701947 },
+		{ 0.007993666838457588, 0.9920063331615423, -1.991749715409004 },
+		{ 0.009584715956826209, 0.9904152840431738, -1.990046053117277 },
+		{ 0.01275916277890811, 0.9872408372210918, -1.986585489333262 },
+		{ 0.01592343496739134, 0.9840765650326088, -1.98305424604643 },
+		{ 0.01907756513367893, 0.9809224348663208, -1.979452691360997 },
+		{ 0.02535552932299793, 0.9746444706770022, -1.972040124631779 },
+		{ 0.03159331415362125, 0.9684066858463785, -1.964350751469719 },
+		{ 0.03779117677592855, 0.9622088232240715, -1.95638754773454 },
+		{ 0.05006815577874564, 0.949931844221254, -1.939651617081105 },
+		{ 0.06218849080803343, 0.9378115091919667, -1.921856393986694 },
+		{ 0.07415418050974729, 0.9258458194902526, -1.903026129142182 },
+		{ 0.09762949133440732, 0.9023705086655925, -1.86235834448687 },
+		{ 0.1205095732270861, 0.8794904267729141, -1.817845557713384 },
+		{ 0.1428095185324228, 0.8571904814675775, -1.769687267746072 },
+		{ 0.001603869920162069, 0.9983961300798377, -1.998385832231168 },
+		{ 0.001924335084227494, 0.9980756649157725, -1.998060838397271 },
+		{ 0.002290454100517092, 0.997709545899486, -1.997688537138129 },
+		{ 0.003205167441604101, 0.9967948325583961, -1.996753674276071 },
+		{ 0.003844967102938827, 0.9961550328970612, -1.996095784050304 },
+		{ 0.004575668536116855, 0.9954243314639216, -1.995340392749422 },
+		{ 0.006400061784879453, 0.9935999382151207, -1.9934355701947 },
+		{ 0.007675150433855265, 0.992324849566145, -1.992088312431685 },
+		{ 0.009130400329680471, 0.9908695996703951, -1.990534618248171 },
+		{ 0.01275916277890811, 0.9872408372210918, -1.986585489333262 },
+		{ 0.01529139293352764, 0.9847086070664723, -1.983766131407876 },
+		{ 0.01817740431904717, 0.9818225956810377, -1.980488875918723 },
+		{ 0.02535552932299793, 0.9746444706770022, -1.972040124631779 },
+		{ 0.03034895916920792, 0.969651040830792, -1.965910627966757 },
+		{ 0.03602432751996325, 0.9639756724819091, -1.958690633468286 },
+		{ 0.05006815577874564, 0.949931844221254, -1.939651617081105 },
+		{ 0.05977685901576171, 0.9402231409842382, -1.925499020587546 },
+		{ 0.07075120696112713, 0.9292487930409422, -1.908510192122349 },
+		{ 0.09762949133440732, 0.9023705086655925, -1.86235834448687 },
+		{ 0.1159804451577331, 0.8840195548422668, -1.827046167826311 },
+		{ 0.1364963980512159, 0.8635036019488951, -1.783807150160064 },
+		{ 0.001603869920162069, 0.9983961300798377, -1.998385832231168 },
+		{ 0.002137921378843723, 0.9978620786211562, -1.997843776239298 },
+		{ 0.002404839972706142, 0.9975951600272939, -1.997571999179401 },
+		{ 0.003205167441604101, 0.9967948325583961, -1.996753674276071 },
+		{ 0.004271272049865176, 0.9957287279501347, -1.995655596932044 },
+		{ 0.004803896690117656, 0.9951961033098822, -1.995103571716893 },
+		{ 0.006400061784879453, 0.9935999382151207, -1.9934355701947 },
+		{ 0.008524300334807507, 0.9914756996651926, -1.991183804328913 },
+		{ 0.009584715956826209, 0.9904152840431738, -1.990046053117277 },
+		{ 0.01275916277890811, 0.9872408372210918, -1.986585489333262 },
+		{ 0.0169759369734164, 0.9830240630265834, -1.981861521991906 },
+		{ 0.01907756513367893, 0.9809224348663208, -1.979452691360997 },
+		{ 0.02535552932299793, 0.9746444706770022, -1.972040124631779 },
+		{ 0.03366369151070796, 0.9663363084892923, -1.961726628506107 },
+		{ 0.03779117677592855, 0.9622088232240715, -1.95638754773454 },
+		{ 0.05006815577874564, 0.949931844221254, -1.939651617081105 },
+		{ 0.06619413889528776, 0.9338058611047124, -1.915693440912805 },
+		{ 0.07415418050974729, 0.9258458194902526, -1.903026129142182 },
+		{ 0.09762949133440732, 0.9023705086655925, -1.86235834448687 },
+		{ 0.1280066137664863, 0.8719933862335137, -1.80218794261495 },
+		{ 0.1428095185324228, 0.8571904814675775, -1.769687267746072 },
+		{ 0.001603869920162069, 0.9983961300798377, -1.998385832231168 },
+		{ 0.002004435301626584, 0.9979955646983741, -1.997979477542813 },
+		{ 0.002671687168388755, 0.9973283128316114, -1.997299723024857 },
+		{ 0.003205167441604101, 0.9967948325583961, -1.996753674276071 },
+		{ 0.004004852842373051, 0.9959951471576267, -1.9959308632208 },
+		{ 0.005336236424451628, 0.9946637635755483, -1.994549557727603 },
+		{ 0.006400061784879453, 0.9935999382151207, -1.9934355701947 },
+		{ 0.007993666838457588, 0.9920063331615423, -1.991749715409004 },
+		{ 0.01064399742972557, 0.9893560025702742, -1.98890040781962 },
+		{ 0.01275916277890811, 0.9872408372210918, -1.986585489333262 },
+		{ 0.01592343496739134, 0.9840765650326088, -1.98305424604643 },
+		{ 0.02117470017816778, 0.9788252998218326, -1.977012775197733 },
+		{ 0.02535552932299793, 0.9746444706770022, -1.972040124631779 },
+		{ 0.03159331415362125, 0.9684066858463785, -1.964350751469719 },
+		{ 0.04190103242869928, 0.9580989675713006, -1.950928092653622 },
+		{ 0.05006815577874564, 0.949931844221254, -1.939651617081105 },
+		{ 0.06218849080803343, 0.9378115091919667, -1.921856393986694 },
+		{ 0.08204636833880795, 0.9179536316611919, -1.889909651819493 },
+		{ 0.09762949133440732, 0.9023705086655925, -1.86235834448687 },
+		{ 0.1205095732270861, 0.8794904267729141, -1.817845557713384 },
+		{ 0.157361130120029, 0.8426388698799712, -1.735655811188261 },
+		{ 0.001603869920162069, 0.9983961300798377, -1.998385832231168 },
+		{ 0.001924335084227494, 0.9980756649157725, -1.998060838397271 },
+		{ 0.002564956856675194, 0.997435043143325, -1.997408693364525 },
+		{ 0.003205167441604101, 0.9967948325583961, -1.996753674276071 },
+		{ 0.003844967102938827, 0.9961550328970612, -1.996095784050304 },
+		{ 0.005123334709672874, 0.9948766652903268, -1.994771401867953 },
+		{ 0.006400061784879453, 0.9935999382151207, -1.9934355701947 },
+		{ 0.007675150433855265, 0.992324849566145, -1.992088312431685 },
+		{ 0.01022042086079856, 0.9897795791392016, -1.989359612359545 },
+		{ 0.01275916277890811, 0.9872408372210918, -1.986585489333262 },
+		{ 0.01529139293352764, 0.9847086070664723, -1.983766131407876 },
+		{ 0.02033638471902489, 0.979663615280975, -1.977992464919858 },
+		{ 0.02535552932299793, 0.9746444706770022, -1.972040124631779 },
+		{ 0.03034895916920792, 0.969651040830792, -1.965910627966757 },
+		{ 0.04025920089461027, 0.9597407991053898, -1.953126262777045 },
+		{ 0.05006815577874564, 0.949931844221254, -1.939651617081105 },
+		{ 0.05977685901576171, 0.9402231409842382, -1.925499020587546 },
+		{ 0.07889759853254717, 0.9211024014674527, -1.895209677501597 },
+		{ 0.09762949133440732, 0.9023705086655925, -1.86235834448687 },
+		{ 0.1159804451577331, 0.8840195548422668, -1.827046167826311 },
+		{ 0.1515703660108917, 0.8484296339891083, -1.749448252316623 },
+		{ 0.001603869920162069, 0.9983961300798377, -1.998385832231168 },
+		{ 0.002004435301626584, 0.9979955646983741, -1.997979477542813 },
+		{ 0.002564956856675194, 0.997435043143325, -1.997408693364525 },
+		{ 0.003205167441604101, 0.9967948325583961, -1.996753674276071 },
+		{ 0.004004852842373051, 0.9959951471576267, -1.9959308632208 },
+		{ 0.005123334709672874, 0.9948766652903268, -1.994771401867953 },
+		{ 0.006400061784879453, 0.9935999382151207, -1.9934355701947 },
+		{ 0.007993666838457588, 0.9920063331615423, -1.991749715409004 },
+		{ 0.01022042086079856, 0.9897795791392016, -1.989359612359545 },
+		{ 0.01275916277890811, 0.9872408372210918, -1.986585489333262 },
+		{ 0.01592343496739134, 0.9840765650326088, -1.98305424604643 },
+		{ 0.02033638471902489, 0.979663615280975, -1.977992464919858 },
+		{ 0.02535552932299793, 0.9746444706770022, -1.972040124631779 },
+		{ 0.03159331415362125, 0.9684066858463785, -1.964350751469719 },
+		{ 0.04025920089461027, 0.9597407991053898, -1.953126262777045 },
+		{ 0.05006815577874564, 0.949931844221254, -1.939651617081105 },
+		{ 0.06218849080803343, 0.9378115091919667, -1.921856393986694 },
+		{ 0.07889759853254717, 0.9211024014674527, -1.895209677501597 },
+		{ 0.09762949133440732, 0.9023705086655925, -1.86235834448687 },
+		{ 0.1205095732270861, 0.8794904267729141, -1.817845557713384 },
+		{ 0.1515703660108917, 0.8484296339891083, -1.749448252316623 },
+		{ 0.001603869920162069, 0.9983961300798377, -1.998385832231168 },
+		{ 0.001924335084227494, 0.9980756649157725, -1.998060838397271 },
+		{ 0.002849545642620057, 0.9971504543573798, -1.997117928417908 },
+		{ 0.003205167441604101, 0.9967948325583961, -1.996753674276071 },
+		{ 0.003844967102938827, 0.9961550328970612, -1.996095784050304 },
+		{ 0.005690971374870558, 0.9943090286251293, -1.994179111028996 },
+		{ 0.006400061784879453, 0.9935999382151207, -1.9934355701947 },
+		{ 0.007675150433855265, 0.992324849566145, -1.992088312431685 },
+		{ 0.01134955559455193, 0.9886504444054481, -1.988132265394634 },
+		{ 0.01275916277890811, 0.9872408372210918, -1.986585489333262 },
+		{ 0.01529139293352764, 0.9847086070664723, -1.983766131407876 },
+		{ 0.02257029877691013, 0.97742970122309, -1.975368948772113 },
+		{ 0.02535552932299793, 0.9746444706770022, -1.972040124631779 },
+		{ 0.03034895916920792, 0.969651040830792, -1.965910627966757 },
+		{ 0.04463117916694101, 0.955368820833059, -1.947222020112726 },
+		{ 0.05006815577874564, 0.949931844221254, -1.939651617081105 },
+		{ 0.05977685901576171, 0.9402231409842382, -1.925499020587546 },
+		{ 0.08727041618005063, 0.9127295838199495, -1.88091939016434 },
+		{ 0.09762949133440732, 0.9023705086655925, -1.86235834448687 },
+		{ 0.1159804451577331, 0.8840195548422668, -1.827046167826311 },
+		{ 0.166924706819862, 0.8330752931801381, -1.712147366860138 },
+		{ 0.001603869920162069, 0.9983961300798377, -1.998385832231168 },
+		{ 0.002404839972706142, 0.9975951600272939, -1.997571999179401 },
+		{ 0.003005147419732666, 0.9969948525802743, -1.996958674630715 },
+		{ 0.003205167441604101, 0.9967948325583961, -1.996753674276071 },
+		{ 0.004803896690117656, 0.9951961033098822, -1.995103571716893 },
+		{ 0.006001276940205033, 0.9939987230601497, -1.993854229056204 },
+		{ 0.006400061784879453, 0.9935999382151207, -1.9934355701947 },
+		{ 0.009584715956826209, 0.9904152840431738, -1.990046053117277 },
+		{ 0.01196650622147186, 0.9880334937785281, -1.987457270842072 },
+		{ 0.01275916277890811, 0.9872408372210918, -1.986585489333262 },
+		{ 0.01907756513367893, 0.9809224348663208, -1.979452691360997 },
+		{ 0.02378981517179514, 0.9762101848282044, -1.973919332867571 },
+		{ 0.02535552932299793, 0.9746444706770022, -1.972040124631779 },
+		{ 0.03779117677592855, 0.9622088232240715, -1.95638754773454 },
+		{ 0.04701367503768289, 0.9529863249623171, -1.943935851645509 },
+		{ 0.05006815577874564, 0.949931844221254, -1.939651617081105 },
+		{ 0.07415418050974729, 0.9258458194902526, -1.903026129142182 },
+		{ 0.09181706443481732, 0.9081829355651827, -1.872893507169822 },
+		{ 0.09762949133440732, 0.9023705086655925, -1.86235834448687 },
+		{ 0.1428095185324228, 0.8571904814675775, -1.769687267746072 },
+		{ 0.1752037555482067, 0.824796244451793, -1.69105528324206 }
+	},
+	.c_bpre4800080040 = {
+		{ 0.000160515105518452, 0.9999919742447245, -1.99995075006236 },
+		{ 0.000180579756521434, 0.9999909710216628, -1.999938796645089 },
+		{ 0.0002407721751676501, 0.9999879613912414, -1.999895207565333 },
+		{ 0.0003210289227771608, 0.9999839485538613, -1.999819054185544 },
+		{ 0.0003611683005083742, 0.9999819420593991, -1.999773246704671 },
+		{ 0.0004815414517781462, 0.999975922927411, -1.999604918460291 },
+		{ 0.0006420526925623915, 0.9999678973653718, -1.999308352375798 },
+		{ 0.0007223078298650065, 0.9999638846085064, -1.999129161843379 },
+		{ 0.0009630713094709097, 0.9999518464345267, -1.998467984075548 },
+		{ 0.001284084773554474, 0.9999357957613225, -1.997298093148206 },
+		{ 0.001444589573309723, 0.9999277705213345, -1.996589636514509 },
+		{ 0.00192609624361769, 0.9999036951878195, -1.993970590502492 },
+		{ 0.002568087103406579, 0.9998715956448294, -1.989328081359947 },
+		{ 0.002889074804663506, 0.9998555462597666, -1.986514635577068 },
+		{ 0.00385200699488317, 0.9998073996502558, -1.976111325358272 },
+		{ 0.005135844453260684, 0.9997432077773373, -1.957683023824199 },
+		{ 0.005777732271672879, 0.9997111133864161, -1.946529304564882 },
+		{ 0.007703272091866058, 0.9996148363954068, -1.905401170034838 },
+		{ 0.01027037006159377, 0.9994864814969205, -1.833036403470064 },
+		{ 0.01155379543384769, 0.9994223102283075, -1.789554102377072 },
+		{ 0.01540357716369001, 0.9992298211418156, -1.631323932329217 },
+		{ 0.000160515105518452, 0.9999919742447245, -1.99995075006236 },
+		{ 0.000200643680609847, 0.9999899678159698, -1.999925555220116 },
+		{ 0.000229306854524482, 0.9999885346597136, -1.999904404189409 },
+		{ 0.0003210289227771608, 0.9999839485538613, -1.999819054185544 },
+		{ 0.0004012853483083204, 0.9999799357325845, -1.999722290790544 },
+		{ 0.0004586122468437012, 0.9999770694181572, -1.99964055558358 },
+		{ 0.0006420526925623915, 0.9999678973653718, -1.999308352375798 },
+		{ 0.0008025626451184721, 0.9999598718677439, -1.998929368819309 },
+		{ 0.0009172139774329328, 0.9999541393621258, -1.998608212698119 },
+		{ 0.001284084773554474, 0.9999357957613225, -1.997298093148206 },
+		{ 0.001605093084889711, 0.9999197453457549, -1.995798877791213 },
+		{ 0.001834381551226246, 0.9999082809910593, -1.994526528492822 },
+		{ 0.002568087103406579, 0.9998715956448294, -1.989328081359947 },
+		{ 0.003210057353613643, 0.9998394971323192, -1.983373669874642 },
+		{ 0.003668616062811128, 0.9998165707216843, -1.978319587717208 },
+		{ 0.005135844453260684, 0.9997432077773373, -1.957683023824199 },
+		{ 0.006419599483818156, 0.9996790200258093, -1.934092119664897 },
+		{ 0.007336565225001504, 0.9996331734540229, -1.914114490122893 },
+		{ 0.01027037006159377, 0.9994864814969205, -1.833036403470064 },
+		{ 0.01283713840475552, 0.9993581430797622, -1.74135428065068 },
+		{ 0.01467033980937633, 0.9992664831048067, -1.664569374037593 },
+		{ 0.000160515105518452, 0.9999919742447245, -1.99995075006236 },
+		{ 0.0001926179720259889, 0.9999903691013987, -1.999931006416168 },
+		{ 0.0003009650435510142, 0.9999849517535156, -1.999840024591174 },
+		{ 0.0003210289227771608, 0.9999839485538613, -1.999819054185544 },
+		{ 0.0003852340889616003, 0.9999807382955517, -1.999743292221982 },
+		{ 0.000601932332450078, 0.9999699036680332, -1.999390217863238 },
+		{ 0.0006420526925623915, 0.9999678973653718, -1.999308352375798 },
+		{ 0.0007704607576676204, 0.9999614769621166, -1.999011758195618 },
+		{ 0.001203831890598181, 0.9999398084054701, -1.997621448715685 },
+		{ 0.001284084773554474, 0.9999357957613225, -1.997298093148206 },
+		{ 0.001540891834838643, 0.9999229554082579, -1.996125055478694 },
+		{ 0.002407591320626529, 0.9998796204339684, -1.990611835549616 },
+		{ 0.002568087103406579, 0.9998715956448294, -1.989328081359947 },
+		{ 0.003081664952311393, 0.9998459167523845, -1.984669326270782 },
+		{ 0.004814892816473392, 0.9997592553591764, -1.962776238828276 },
+		{ 0.005135844453260684, 0.9997432077773373, -1.957683023824199 },
+		{ 0.006162855071668779, 0.9996918572464164, -1.939220500776368 },
+		{ 0.009628626473296351, 0.999518568676335, -1.852972050866648 },
+		{ 0.01027037006159377, 0.9994864814969205, -1.833036403470064 },
+		{ 0.01232381110421254, 0.9993838094447891, -1.761192430482578 },
+		{ 0.01925261742421833, 0.999037369128789, -1.434468251211083 },
+		{ 0.000160515105518452, 0.9999919742447245, -1.99995075006236 },
+		{ 0.000200643680609847, 0.9999899678159698, -1.999925555220116 },
+		{ 0.0002407721751676501, 0.9999879613912414, -1.999895207565333 },
+		{ 0.0003210289227771608, 0.9999839485538613, -1.999819054185544 },
+		{ 0.0004012853483083204, 0.9999799357325845, -1.999722290790544 },
+		{ 0.0004815414517781462, 0.999975922927411, -1.999604918460291 },
+		{ 0.0006420526925623915, 0.9999678973653718, -1.999308352375798 },
+		{ 0.0008025626451184721, 0.9999598718677439, -1.998929368819309 },
+		{ 0.0009630713094709097, 0.9999518464345267, -1.998467984075548 },
+		{ 0.001284084773554474, 0.9999357957613225, -1.997298093148206 },
+		{ 0.001605093084889711, 0.9999197453457549, -1.995798877791213 },
+		{ 0.00192609624361769, 0.9999036951878195, -1.993970590502492 },
+		{ 0.002568087103406579, 0.9998715956448294, -1.989328081359947 },
+		{ 0.003210057353613643, 0.9998394971323192, -1.983373669874642 },
+		{ 0.00385200699488317, 0.9998073996502558, -1.976111325358272 },
+		{ 0.005135844453260684, 0.9997432077773373, -1.957683023824199 },
+		{ 0.006419599483818156, 0.9996790200258093, -1.934092119664897 },
+		{ 0.007703272091866058, 0.9996148363954068, -1.905401170034838 },
+		{ 0.01027037006159377, 0.9994864814969205, -1.833036403470064 },
+		{ 0.01283713840475552, 0.9993581430797622, -1.74135428065068 },
+		{ 0.01540357716369001, 0.9992298211418156, -1.631323932329217 },
+		{ 0.000160515105518452, 0.9999919742447245, -1.99995075006236 },
+		{ 0.0001926179720259889, 0.9999903691013987, -1.999931006416168 },
+		{ 0.000229306854524482, 0.9999885346597136, -1.999904404189409 },
+		{ 0.0003210289227771608, 0.9999839485538613, -1.999819054185544 },
+		{ 0.0003852340889616003, 0.9999807382955517, -1.999743292221982 },
+		{ 0.0004586122468437012, 0.9999770694181572, -1.99964055558358 },
+		{ 0.0006420526925623915, 0.9999678973653718, -1.999308352375798 },
+		{ 0.0007704607576676204, 0.9999614769621166, -1.999011758195618 },
+		{ 0.0009172139774329328, 0.9999541393621258, -1.998608212698119 },
+		{ 0.001284084773554474, 0.9999357957613225, -1.997298093148206 },
+		{ 0.001540891834838643, 0.9999229554082579, -1.996125055478694 },
+		{ 0.001834381551226246, 0.9999082809910593, -1.994526528492822 },
+		{ 0.002568087103406579, 0.9998715956448294, -1.989328081359947 },
+		{ 0.003081664952311393, 0.9998459167523845, -1.984669326270782 },
+		{ 0.003668616062811128, 0.9998165707216843, -1.978319587717208 },
+		{ 0.005135844453260684, 0.9997432077773373, -1.957683023824199 },
+		{ 0.006162855071668779, 0.9996918572464164, -1.939220500776368 },
+		{ 0.007336565225001504, 0.9996331734540229, -1.914114490122893 },
+		{ 0.01027037006159377, 0.9994864814969205, -1.833036403470064 },
+		{ 0.01232381110421254, 0.9993838094447891, -1.761192430482578 },
+		{ 0.01467033980937633, 0.9992664831048067, -1.664569374037593 },
+		{ 0.000160515105518452, 0.9999919742447245, -1.99995075006236 },
+		{ 0.0002140198543980546, 0.9999892990072798, -1.999916011865817 },
+		{ 0.0002407721751676501, 0.9999879613912414, -1.999895207565333 },
+		{ 0.0003210289227771608, 0.9999839485538613, -1.999819054185544 },
+		{ 0.0004280374185897884, 0.9999785981290706, -1.999685456502705 },
+		{ 0.0004815414517781462, 0.999975922927411, -1.999604918460291 },
+		{ 0.0006420526925623915, 0.9999678973653718, -1.999308352375798 },
+		{ 0.0008560656763660545, 0.9999571967161814, -1.998784728690155 },
+		{ 0.0009630713094709097, 0.9999518464345267, -1.998467984075548 },
+		{ 0.001284084773554474, 0.9999357957613225, -1.997298093148206 },
+		{ 0.001712094710316203, 0.9999143952644842, -1.995225998210467 },
+		{ 0.00192609624361769, 0.9999036951878195, -1.993970590502492 },
+		{ 0.002568087103406579, 0.9998715956448294, -1.989328081359947 },
+		{ 0.003424042857226423, 0.9998287978571391, -1.981097993371668 },
+		{ 0.00385200699488317, 0.9998073996502558, -1.976111325358272 },
+		{ 0.005135844453260684, 0.9997432077773373, -1.957683023824199 },
+		{ 0.006847499510961472, 0.9996576250244518, -1.925091663080493 },
+		{ 0.007703272091866058, 0.9996148363954068, -1.905401170034838 },
+		{ 0.01027037006159377, 0.9994864814969205, -1.833036403470064 },
+		{ 0.01369265460944374, 0.9993153672695279, -1.706662652633935 },
+		{ 0.01540357716369001, 0.9992298211418156, -1.631323932329217 },
+		{ 0.000160515105518452, 0.9999919742447245, -1.99995075006236 },
+		{ 0.000200643680609847, 0.9999899678159698, -1.999925555220116 },
+		{ 0.0002675244601628479, 0.9999866237769921, -1.999872113165017 },
+		{ 0.0003210289227771608, 0.9999839485538613, -1.999819054185544 },
+		{ 0.0004012853483083204, 0.9999799357325845, -1.999722290790544 },
+		{ 0.0005350453418509497, 0.9999732477329074, -1.999515221461104 },
+		{ 0.0006420526925623915, 0.9999678973653718, -1.999308352375798 },
+		{ 0.0008025626451184721, 0.9999598718677439, -1.998929368819309 },
+		{ 0.001070076370020479, 0.9999464961814989, -1.998114625388505 },
+		{ 0.001284084773554474, 0.9999357957613225, -1.997298093148206 },
+		{ 0.001605093084889711, 0.9999197453457549, -1.995798877791213 },
+		{ 0.002140095486879026, 0.9998929952256563, -1.992569063823208 },
+		{ 0.002568087103406579, 0.9998715956448294, -1.989328081359947 },
+		{ 0.003210057353613643, 0.9998394971323192, -1.983373669874642 },
+		{ 0.004279961973306256, 0.9997860019013346, -1.970545483570273 },
+		{ 0.005135844453260684, 0.9997432077773373, -1.957683023824199 },
+		{ 0.006419599483818156, 0.9996790200258093, -1.934092119664897 },
+		{ 0.008559008042891437, 0.9995720495978553, -1.883477497687099 },
+		{ 0.01027037006159377, 0.9994864814969205, -1.833036403470064 },
+		{ 0.01283713840475552, 0.9993581430797622, -1.74135428065068 },
+		{ 0.01711435325486028, 0.9991442823372572, -1.548343364449012 },
+		{ 0.000160515105518452, 0.9999919742447245, -1.99995075006236 },
+		{ 0.0001926179720259889, 0.9999903691013987, -1.999931006416168 },
+		{ 0.0002568235504583163, 0.999987158822477, -1.999881625735293 },
+		{ 0.0003210289227771608, 0.9999839485538613, -1.999819054185544 },
+		{ 0.0003852340889616003, 0.9999807382955517, -1.999743292221982 },
+		{ 0.0005136438029978885, 0.99997431780985, -1.999552199308668 },
+		{ 0.0006420526925623915, 0.9999678973653718, -1.999308352375798 },
+		{ 0.0007704607576676204, 0.9999614769621166, -1.999011758195618 },
+		{ 0.001027274414498329, 0.999948636279275, -1.998260362140153 },
+		{ 0.001284084773554474, 0.9999357957613225, -1.997298093148206 },
+		{ 0.001540891834838643, 0.9999229554082579, -1.996125055478694 },
+		{ 0.002054496064359018, 0.9998972751967815, -1.993147202337492 },
+		{ 0.002568087103406579, 0.9998715956448294, -1.989328081359947 },
+		{ 0.003081664952311393, 0.9998459167523845, -1.984669326270782 },
+		{ 0.004108781081039808, 0.9997945609459484, -1.972841219721101 },
+		{ 0.005135844453260684, 0.9997432077773373, -1.957683023824199 },
+		{ 0.006162855071668779, 0.9996918572464164, -1.939220500776368 },
+		{ 0.008216718057965235, 0.9995891640971015, -1.892513355208706 },
+		{ 0.01027037006159377, 0.9994864814969205, -1.833036403470064 },
+		{ 0.01232381110421254, 0.9993838094447891, -1.761192430482578 },
+		{ 0.01643006039315219, 0.9991784969803423, -1.582428453856498 },
+		{ 0.000160515105518452, 0.9999919742447245, -1.99995075006236 },
+		{ 0.000200643680609847, 0.9999899678159698, -1.999925555220116 },
+		{ 0.0002568235504583163, 0.999987158822477, -1.999881625735293 },
+		{ 0.0003210289227771608, 0.9999839485538613, -1.999819054185544 },
+		{ 0.0004012853483083204, 0.9999799357325845, -1.999722290790544 },
+		{ 0.0005136438029978885, 0.99997431780985, -1.999552199308668 },
+		{ 0.0006420526925623915, 0.9999678973653718, -1.999308352375798 },
+		{ 0.0008025626451184721, 0.9999598718677439, -1.998929368819309 },
+		{ 0.001027274414498329, 0.999948636279275, -1.998260362140153 },
+		{ 0.001284084773554474, 0.9999357957613225, -1.997298093148206 },
+		{ 0.001605093084889711, 0.9999197453457549, -1.995798877791213 },
+		{ 0.002054496064359018, 0.9998972751967815, -1.993147202337492 },
+		{ 0.002568087103406579, 0.9998715956448294, -1.989328081359947 },
+		{ 0.003210057353613643, 0.9998394971323192, -1.983373669874642 },
+		{ 0.004108781081039808, 0.9997945609459484, -1.972841219721101 },
+		{ 0.005135844453260684, 0.9997432077773373, -1.957683023824199 },
+		{ 0.006419599483818156, 0.9996790200258093, -1.934092119664897 },
+		{ 0.008216718057965235, 0.9995891640971015, -1.892513355208706 },
+		{ 0.01027037006159377, 0.9994864814969205, -1.833036403470064 },
+		{ 0.01283713840475552, 0.9993581430797622, -1.74135428065068 },
+		{ 0.01643006039315219, 0.9991784969803423, -1.582428453856498 },
+		{ 0.000160515105518452, 0.9999919742447245, -1.99995075006236 },
+		{ 0.0001926179720259889, 0.9999903691013987, -1.999931006416168 },
+		{ 0.0002853592969265684, 0.9999857320351535, -1.999855444634919 },
+		{ 0.0003210289227771608, 0.9999839485538613, -1.999819054185544 },
+		{ 0.0003852340889616003, 0.9999807382955517, -1.999743292221982 },
+		{ 0.0005707145223784451, 0.9999714642738813, -1.999450335365594 },
+		{ 0.0006420526925623915, 0.9999678973653718, -1.999308352375798 },
+		{ 0.0007704607576676204, 0.9999614769621166, -1.999011758195618 },
+		{ 0.001141412758990282, 0.9999429293620506, -1.9978587150454 },
+		{ 0.001284084773554474, 0.9999357957613225, -1.997298093148206 },
+		{ 0.001540891834838643, 0.9999229554082579, -1.996125055478694 },
+		{ 0.00228276037682159, 0.9998858619811591, -1.991553586551972 },
+		{ 0.002568087103406579, 0.9998715956448294, -1.989328081359947 },
+		{ 0.003081664952311393, 0.9998459167523845, -1.984669326270782 },
+		{ 0.004565260203900548, 0.9997717369898051, -1.966513964037374 },
+		{ 0.005135844453260684, 0.9997432077773373, -1.957683023824199 },
+		{ 0.006162855071668779, 0.9996918572464164, -1.939220500776368 },
+		{ 0.009129478327757375, 0.9995435260836122, -1.867633695055731 },
+		{ 0.01027037006159377, 0.9994864814969205, -1.833036403470064 },
+		{ 0.01232381110421254, 0.9993838094447891, -1.761192430482578 },
+		{ 0.0182547892867828, 0.9990872605356607, -1.488968540154917 },
+		{ 0.000160515105518452, 0.9999919742447245, -1.99995075006236 },
+		{ 0.0002407721751676501, 0.9999879613912414, -1.999895207565333 },
+		{ 0.0003009650435510142, 0.9999849517535156, -1.999840024591174 },
+		{ 0.0003210289227771608, 0.9999839485538613, -1.999819054185544 },
+		{ 0.0004815414517781462, 0.999975922927411, -1.999604918460291 },
+		{ 0.000601932332450078, 0.9999699036680332, -1.999390217863238 },
+		{ 0.0006420526925623915, 0.9999678973653718, -1.999308352375798 },
+		{ 0.0009630713094709097, 0.9999518464345267, -1.998467984075548 },
+		{ 0.001203831890598181, 0.9999398084054701, -1.997621448715685 },
+		{ 0.001284084773554474, 0.9999357957613225, -1.997298093148206 },
+		{ 0.00192609624361769, 0.9999036951878195, -1.993970590502492 },
+		{ 0.002407591320626529, 0.9998796204339684, -1.990611835549616 },
+		{ 0.002568087103406579, 0.9998715956448294, -1.989328081359947 },
+		{ 0.00385200699488317, 0.9998073996502558, -1.976111325358272 },
+		{ 0.004814892816473392, 0.9997592553591764, -1.962776238828276 },
+		{ 0.005135844453260684, 0.9997432077773373, -1.957683023824199 },
+		{ 0.007703272091866058, 0.9996148363954068, -1.905401170034838 },
+		{ 0.009628626473296351, 0.999518568676335, -1.852972050866648 },
+		{ 0.01027037006159377, 0.9994864814969205, -1.833036403470064 },
+		{ 0.01540357716369001, 0.9992298211418156, -1.631323932329217 },
+		{ 0.01925261742421833, 0.999037369128789, -1.434468251211083 }
+	},
+	.c_bpre9600080040 = {
+		{ 8.025771378687207e-05, 0.9999959871143105, -1.999985681021487 },
+		{ 9.029008206525988e-05, 0.9999954855006411, -1.99998244183452 },
+		{ 0.0001203864499048847, 0.9999939806775047, -1.999970792016809 },
+		{ 0.000160515105518452, 0.9999919742447245, -1.99995075006236 },
+		{ 0.0001805849655170737, 0.9999909709889381, -1.999938796234163 },
+		{ 0.0002407721751676501, 0.9999879613912414, -1.999895207565333 },
+		{ 0.0003210289227771608, 0.9999839485538613, -1.999819054185544 },
+		{ 0.0003611571757909857, 0.9999819421412102, -1.999773248677426 },
+		{ 0.0004815414517781462, 0.999975922927411, -1.999604918460291 },
+		{ 0.0006420526925623915, 0.9999678973653718, -1.999308352375798 },
+		{ 0.0007223078298650065, 0.9999638846085064, -1.999129161843379 },
+		{ 0.0009630713094709097, 0.9999518464345267, -1.998467984075548 },
+		{ 0.001284084773554474, 0.9999357957613225, -1.997298093148206 },
+		{ 0.001444589573309723, 0.9999277705213345, -1.996589636514509 },
+		{ 0.00192609624361769, 0.9999036951878195, -1.993970590502492 },
+		{ 0.002568087103406579, 0.9998715956448294, -1.989328081359947 },
+		{ 0.002889074804663506, 0.9998555462597666, -1.986514635577068 },
+		{ 0.00385200699488317, 0.9998073996502558, -1.976111325358272 },
+		{ 0.005135844453260684, 0.9997432077773373, -1.957683023824199 },
+		{ 0.005777732271672879, 0.9997111133864161, -1.946529304564882 },
+		{ 0.007703272091866058, 0.9996148363954068, -1.905401170034838 },
+		{ 8.025771378687207e-05, 0.9999959871143105, -1.999985681021487 },
+		{ 0.0001003220919228108, 0.9999949838954042, -1.999978880641224 },
+		{ 0.0001146537559085465, 0.9999942673134248, -1.999973234524967 },
+		{ 0.000160515105518452, 0.9999919742447245, -1.99995075006236 },
+		{ 0.000200643680609847, 0.9999899678159698, -1.999925555220116 },
+		{ 0.0002293074379707122, 0.9999885346433514, -1.999904403932921 },
+		{ 0.0003210289227771608, 0.9999839485538613, -1.999819054185544 },
+		{ 0.0004012853483083204, 0.9999799357325845, -1.999722290790544 },
+		{ 0.0004586122468437012, 0.9999770694181572, -1.99964055558358 },
+		{ 0.0006420526925623915, 0.9999678973653718, -1.999308352375798 },
+		{ 0.0008025626451184721, 0.9999598718677439, -1.998929368819309 },
+		{ 0.0009172118075279503, 0.9999541394439344, -1.998608217581305 },
+		{ 0.001284084773554474, 0.9999357957613225, -1.997298093148206 },
+		{ 0.001605093084889711, 0.9999197453457549, -1.995798877791213 },
+		{ 0.001834392155575175, 0.9999082811546688, -1.994526547848325 },
+		{ 0.002568087103406579, 0.9998715956448294, -1.989328081359947 },
+		{ 0.003210057353613643, 0.9998394971323192, -1.983373669874642 },
+		{ 0.003668619080076629, 0.9998165699037116, -1.978319395509681 },
+		{ 0.005135844453260684, 0.9997432077773373, -1.957683023824199 },
+		{ 0.006419599483818156, 0.9996790200258093, -1.934092119664897 },
+		{ 0.007336515516002964, 0.9996331742718461, -1.914114869553216 },
+		{ 8.025771378687207e-05, 0.9999959871143105, -1.999985681021487 },
+		{ 9.630921788727128e-05, 0.9999951845391053, -1.999980343777003 },
+		{ 0.0001504830879035197, 0.9999924758484513, -1.999956243593364 },
+		{ 0.000160515105518452, 0.9999919742447245, -1.99995075006236 },
+		{ 0.0001926179720259889, 0.9999903691013987, -1.999931006416168 },
+		{ 0.000300968430756167, 0.9999849517207913, -1.999840023928128 },
+		{ 0.0003210289227771608, 0.9999839485538613, -1.999819054185544 },
+		{ 0.0003852340889616003, 0.9999807382955517, -1.999743292221982 },
+		{ 0.0006019250031452654, 0.9999699037498426, -1.999390221096396 },
+		{ 0.0006420526925623915, 0.9999678973653718, -1.999308352375798 },
+		{ 0.0007704607576676204, 0.9999614769621166, -1.999011758195618 },
+		{ 0.001203831890598181, 0.9999398084054701, -1.997621448715685 },
+		{ 0.001284084773554474, 0.9999357957613225, -1.997298093148206 },
+		{ 0.001540891834838643, 0.9999229554082579, -1.996125055478694 },
+		{ 0.002407591320626529, 0.9998796204339684, -1.990611835549616 },
+		{ 0.002568087103406579, 0.9998715956448294, -1.989328081359947 },
+		{ 0.003081664952311393, 0.9998459167523845, -1.984669326270782 },
+		{ 0.004814892816473392, 0.9997592553591764, -1.962776238828276 },
+		{ 0.005135844453260684, 0.9997432077773373, -1.957683023824199 },
+		{ 0.006162855071668779, 0.9996918572464164, -1.939220500776368 },
+		{ 0.009628626473296351, 0.999518568676335, -1.852972050866648 },
+		{ 8.025771378687207e-05, 0.9999959871143105, -1.999985681021487 },
+		{ 0.0001003220919228108, 0.9999949838954042, -1.999978880641224 },
+		{ 0.0001203864499048847, 0.9999939806775047, -1.999970792016809 },
+		{ 0.000160515105518452, 0.9999919742447245, -1.99995075006236 },
+		{ 0.000200643680609847, 0.9999899678159698, -1.999925555220116 },
+		{ 0.0002407721751676501, 0.9999879613912414, -1.999895207565333 },
+		{ 0.0003210289227771608, 0.9999839485538613, -1.999819054185544 },
+		{ 0.0004012853483083204, 0.9999799357325845, -1.999722290790544 },
+		{ 0.0004815414517781462, 0.999975922927411, -1.999604918460291 },
+		{ 0.0006420526925623915, 0.9999678973653718, -1.999308352375798 },
+		{ 0.0008025626451184721, 0.9999598718677439, -1.998929368819309 },
+		{ 0.0009630713094709097, 0.9999518464345267, -1.998467984075548 },
+		{ 0.001284084773554474, 0.9999357957613225, -1.997298093148206 },
+		{ 0.001605093084889711, 0.9999197453457549, -1.995798877791213 },
+		{ 0.00192609624361769, 0.9999036951878195, -1.993970590502492 },
+		{ 0.002568087103406579, 0.9998715956448294, -1.989328081359947 },
+		{ 0.003210057353613643, 0.9998394971323192, -1.983373669874642 },
+		{ 0.00385200699488317, 0.9998073996502558, -1.976111325358272 },
+		{ 0.005135844453260684, 0.9997432077773373, -1.957683023824199 },
+		{ 0.006419599483818156, 0.9996790200258093, -1.934092119664897 },
+		{ 0.007703272091866058, 0.9996148363954068, -1.905401170034838 },
+		{ 8.025771378687207e-05, 0.9999959871143105, -1.999985681021487 },
+		{ 9.630921788727128e-05, 0.9999951845391053, -1.999980343777003 },
+		{ 0.0001146537559085465, 0.9999942673134248, -1.999973234524967 },
+		{ 0.000160515105518452, 0.9999919742447245, -1.99995075006236 },
+		{ 0.0001926179720259889, 0.9999903691013987, -1.999931006416168 },
+		{ 0.0002293074379707122, 0.9999885346433514, -1.999904403932921 },
+		{ 0.0003210289227771608, 0.9999839485538613, -1.999819054185544 },
+		{ 0.0003852340889616003, 0.9999807382955517, -1.999743292221982 },
+		{ 0.0004586122468437012, 0.9999770694181572, -1.99964055558358 },
+		{ 0.0006420526925623915, 0.9999678973653718, -1.999308352375798 },
+		{ 0.0007704607576676204, 0.9999614769621166, -1.999011758195618 },
+		{ 0.0009172118075279503, 0.9999541394439344, -1.998608217581305 },
+		{ 0.001284084773554474, 0.9999357957613225, -1.997298093148206 },
+		{ 0.001540891834838643, 0.9999229554082579, -1.996125055478694 },
+		{ 0.001834392155575175, 0.9999082811546688, -1.994526547848325 },
+		{ 0.002568087103406579, 0.9998715956448294, -1.989328081359947 },
+		{ 0.003081664952311393, 0.9998459167523845, -1.984669326270782 },
+		{ 0.003668619080076629, 0.9998165699037116, -1.978319395509681 },
+		{ 0.005135844453260684, 0.9997432077773373, -1.957683023824199 },
+		{ 0.006162855071668779, 0.9996918572464164, -1.939220500776368 },
+		{ 0.007336515516002964, 0.9996331742718461, -1.914114869553216 },
+		{ 8.025771378687207e-05, 0.9999959871143105, -1.999985681021487 },
+		{ 0.0001070102134811192, 0.9999946494893258, -1.999976327571021 },
+		{ 0.0001203864499048847, 0.9999939806775047, -1.999970792016809 },
+		{ 0.000160515105518452, 0.9999919742447245, -1.99995075006236 },
+		{ 0.0002140198543980546, 0.9999892990072798, -1.999916011865817 },
+		{ 0.0002407721751676501, 0.9999879613912414, -1.999895207565333 },
+		{ 0.0003210289227771608, 0.9999839485538613, -1.999819054185544 },
+		{ 0.0004280374185897884, 0.9999785981290706, -1.999685456502705 },
+		{ 0.0004815414517781462, 0.999975922927411, -1.999604918460291 },
+		{ 0.0006420526925623915, 0.9999678973653718, -1.999308352375798 },
+		{ 0.0008560656763660545, 0.9999571967161814, -1.998784728690155 },
+		{ 0.0009630713094709097, 0.9999518464345267, -1.998467984075548 },
+		{ 0.001284084773554474, 0.9999357957613225, -1.997298093148206 },
+		{ 0.001712094710316203, 0.9999143952644842, -1.995225998210467 },
+		{ 0.00192609624361769, 0.9999036951878195, -1.993970590502492 },
+		{ 0.002568087103406579, 0.9998715956448294, -1.989328081359947 },
+		{ 0.003424042857226423, 0.9998287978571391, -1.981097993371668 },
+		{ 0.00385200699488317, 0.9998073996502558, -1.976111325358272 },
+		{ 0.005135844453260684, 0.9997432077773373, -1.957683023824199 },
+		{ 0.006847499510961472, 0.9996576250244518, -1.925091663080493 },
+		{ 0.007703272091866058, 0.9996148363954068, -1.905401170034838 },
+		{ 8.025771378687207e-05, 0.9999959871143105, -1.999985681021487 },
+		{ 0.0001003220919228108, 0.9999949838954042, -1.999978880641224 },
+		{ 0.0001337626773889666, 0.9999933118661306, -1.999964683912513 },
+		{ 0.000160515105518452, 0.9999919742447245, -1.99995075006236 },
+		{ 0.000200643680609847, 0.9999899678159698, -1.999925555220116 },
+		{ 0.0002675244601628479, 0.9999866237769921, -1.999872113165017 },
+		{ 0.0003210289227771608, 0.9999839485538613, -1.999819054185544 },
+		{ 0.0004012853483083204, 0.9999799357325845, -1.999722290790544 },
+		{ 0.0005350453418509497, 0.9999732477329074, -1.999515221461104 },
+		{ 0.0006420526925623915, 0.9999678973653718, -1.999308352375798 },
+		{ 0.0008025626451184721, 0.9999598718677439, -1.998929368819309 },
+		{ 0.001070076370020479, 0.9999464961814989, -1.998114625388505 },
+		{ 0.001284084773554474, 0.9999357957613225, -1.997298093148206 },
+		{ 0.001605093084889711, 0.9999197453457549, -1.995798877791213 },
+		{ 0.002140095486879026, 0.9998929952256563, -1.992569063823208 },
+		{ 0.002568087103406579, 0.9998715956448294, -1.989328081359947 },
+		{ 0.003210057353613643, 0.9998394971323192, -1.983373669874642 },
+		{ 0.004279961973306256, 0.9997860019013346, -1.970545483570273 },
+		{ 0.005135844453260684, 0.9997432077773373, -1.957683023824199 },
+		{ 0.006419599483818156, 0.9996790200258093, -1.934092119664897 },
+		{ 0.008559008042891437, 0.9995720495978553, -1.883477497687099 },
+		{ 8.025771378687207e-05, 0.9999959871143105, -1.999985681021487 },
+		{ 9.630921788727128e-05, 0.9999951845391053, -1.999980343777003 },
+		{ 0.0001284121874815812, 0.9999935793906264, -1.999967195860109 },
+		{ 0.000160515105518452, 0.9999919742447245, -1.99995075006236 },
+		{ 0.0001926179720259889, 0.9999903691013987, -1.999931006416168 },
+		{ 0.0002568235504583163, 0.999987158822477, -1.999881625735293 },
+		{ 0.0003210289227771608, 0.9999839485538613, -1.999819054185544 },
+		{ 0.0003852340889616003, 0.9999807382955517, -1.999743292221982 },
+		{ 0.0005136438029978885, 0.99997431780985, -1.999552199308668 },
+		{ 0.0006420526925623915, 0.9999678973653718, -1.999308352375798 },
+		{ 0.0007704607576676204, 0.9999614769621166, -1.999011758195618 },
+		{ 0.001027274414498329, 0.999948636279275, -1.998260362140153 },
+		{ 0.001284084773554474, 0.9999357957613225, -1.997298093148206 },
+		{ 0.001540891834838643, 0.9999229554082579, -1.996125055478694 },
+		{ 0.002054496064359018, 0.9998972751967815, -1.993147202337492 },
+		{ 0.002568087103406579, 0.9998715956448294, -1.989328081359947 },
+		{ 0.003081664952311393, 0.9998459167523845, -1.984669326270782 },
+		{ 0.004108781081039808, 0.9997945609459484, -1.972841219721101 },
+		{ 0.005135844453260684, 0.9997432077773373, -1.957683023824199 },
+		{ 0.006162855071668779, 0.9996918572464164, -1.939220500776368 },
+		{ 0.008216718057965235, 0.9995891640971015, -1.892513355208706 },
+		{ 8.025771378687207e-05, 0.9999959871143105, -1.999985681021487 },
+		{ 0.0001003220919228108, 0.9999949838954042, -1.999978880641224 },
+		{ 0.0001284121874815812, 0.9999935793906264, -1.999967195860109 },
+		{ 0.000160515105518452, 0.9999919742447245, -1.99995075006236 },
+		{ 0.000200643680609847, 0.9999899678159698, -1.999925555220116 },
+		{ 0.0002568235504583163, 0.999987158822477, -1.999881625735293 },
+		{ 0.0003210289227771608, 0.9999839485538613, -1.999819054185544 },
+		{ 0.0004012853483083204, 0.9999799357325845, -1.999722290790544 },
+		{ 0.0005136438029978885, 0.99997431780985, -1.999552199308668 },
+		{ 0.0006420526925623915, 0.9999678973653718, -1.999308352375798 },
+		{ 0.0008025626451184721, 0.9999598718677439, -1.998929368819309 },
+		{ 0.001027274414498329, 0.999948636279275, -1.998260362140153 },
+		{ 0.001284084773554474, 0.9999357957613225, -1.997298093148206 },
+		{ 0.001605093084889711, 0.9999197453457549, -1.995798877791213 },
+		{ 0.002054496064359018, 0.9998972751967815, -1.993147202337492 },
+		{ 0.002568087103406579, 0.9998715956448294, -1.989328081359947 },
+		{ 0.003210057353613643, 0.9998394971323192, -1.983373669874642 },
+		{ 0.004108781081039808, 0.9997945609459484, -1.972841219721101 },
+		{ 0.005135844453260684, 0.9997432077773373, -1.957683023824199 },
+		{ 0.006419599483818156, 0.9996790200258093, -1.934092119664897 },
+		{ 0.008216718057965235, 0.9995891640971015, -1.892513355208706 },
+		{ 8.025771378687207e-05, 0.9999959871143105, -1.999985681021487 },
+		{ 9.630921788727128e-05, 0.9999951845391053, -1.999980343777003 },
+		{ 0.0001426801574067358, 0.9999928659921298, -1.999960293760649 },
+		{ 0.000160515105518452, 0.9999919742447245, -1.99995075006236 },
+		{ 0.0001926179720259889, 0.9999903691013987, -1.999931006416168 },
+		{ 0.0002853592969265684, 0.9999857320351535, -1.999855444634919 },
+		{ 0.0003210289227771608, 0.9999839485538613, -1.999819054185544 },
+		{ 0.0003852340889616003, 0.9999807382955517, -1.999743292221982 },
+		{ 0.0005707145223784451, 0.9999714642738813, -1.999450335365594 },
+		{ 0.0006420526925623915, 0.9999678973653718, -1.999308352375798 },
+		{ 0.0007704607576676204, 0.9999614769621166, -1.999011758195618 },
+		{ 0.001141412758990282, 0.9999429293620506, -1.9978587150454 },
+		{ 0.001284084773554474, 0.9999357957613225, -1.997298093148206 },
+		{ 0.001540891834838643, 0.9999229554082579, -1.996125055478694 },
+		{ 0.00228276037682159, 0.9998858619811591, -1.991553586551972 },
+		{ 0.002568087103406579, 0.9998715956448294, -1.989328081359947 },
+		{ 0.003081664952311393, 0.9998459167523845, -1.984669326270782 },
+		{ 0.004565260203900548, 0.9997717369898051, -1.966513964037374 },
+		{ 0.005135844453260684, 0.9997432077773373, -1.957683023824199 },
+		{ 0.006162855071668779, 0.9996918572464164, -1.939220500776368 },
+		{ 0.009129478327757375, 0.9995435260836122, -1.867633695055731 },
+		{ 8.025771378687207e-05, 0.9999959871143105, -1.999985681021487 },
+		{ 0.0001203864499048847, 0.9999939806775047, -1.999970792016809 },
+		{ 0.0001504830879035197, 0.9999924758484513, -1.999956243593364 },
+		{ 0.000160515105518452, 0.9999919742447245, -1.99995075006236 },
+		{ 0.0002407721751676501, 0.9999879613912414, -1.999895207565333 },
+		{ 0.000300968430756167, 0.9999849517207913, -1.999840023928128 },
+		{ 0.0003210289227771608, 0.9999839485538613, -1.999819054185544 },
+		{ 0.0004815414517781462, 0.999975922927411, -1.999604918460291 },
+		{ 0.0006019250031452654, 0.9999699037498426, -1.999390221096396 },
+		{ 0.0006420526925623915, 0.9999678973653718, -1.999308352375798 },
+		{ 0.0009630713094709097, 0.9999518464345267, -1.998467984075548 },
+		{ 0.001203831890598181, 0.9999398084054701, -1.997621448715685 },
+		{ 0.001284084773554474, 0.9999357957613225, -1.997298093148206 },
+		{ 0.00192609624361769, 0.9999036951878195, -1.993970590502492 },
+		{ 0.002407591320626529, 0.9998796204339684, -1.990611835549616 },
+		{ 0.002568087103406579, 0.9998715956448294, -1.989328081359947 },
+		{ 0.00385200699488317, 0.9998073996502558, -1.976111325358272 },
+		{ 0.004814892816473392, 0.9997592553591764, -1.962776238828276 },
+		{ 0.005135844453260684, 0.9997432077773373, -1.957683023824199 },
+		{ 0.007703272091866058, 0.9996148363954068, -1.905401170034838 },
+		{ 0.009628626473296351, 0.999518568676335, -1.852972050866648 }
+	}
+};
@@ -0,0 +1,1647 @@
+#include "Scales.hpp"
+Scale ji_wholestep = {
+	.name = "Whole Step (JI)",
+	.description = "Whole Step scales, Just Intonation",
+	.scalename = {
+		"A2-B5",
+		"A5-B8",
+		"B2-C#5",
+		"B5-C#8",
+		"C2-D5",
+		"C5-D8",
+		"D2-E5",
+		"D5-E8",
+		"E2-F#5",
+		"E5-F#8",
+		"F4-G7"},
+	.notedesc = {
+		"1",
+		"9/8",
+		"5/4",
+		"45/32",
+		"8/5",
+		"9/5",
+		"1",
+		"9/8",
+		"5/4",
+		"45/32",
+		"8/5",
+		"9/5",
+		"1",
+		"9/8",
+		"5/4",
+		"45/32",
+		"8/5",
+		"9/5",
+		"1",
+		"9/8",
+		"5/4",
+		"1",
+		"9/8",
+		"5/4",
+		"45/32",
+		"8/5",
+		"9/5",
+		"1",
+		"9/8",
+		"5/4",
+		"45/32",
+		"8/5",
+		"9/5",
+		"1",
+		"9/8",
+		"5/4",
+		"45/32",
+		"8/5",
+		"9/5",
+		"1",
+		"9/8",
+		"5/4",
+		"1",
+		"9/8",
+		"5/4",
+		"45/32",
+		"8/5",
+		"9/5",
+		"1",
+		"9/8",
+		"5/4",
+		"45/32",
+		"8/5",
+		"9/5",
+		"1",
+		"9/8",
+		"5/4",
+		"45/32",
+		"8/5",
+		"9/5",
+		"1",
+		"9/8",
+		"5/4",
+		"1",
+		"9/8",
+		"5/4",
+		"45/32",
+		"8/5",
+		"9/5",
+		"1",
+		"9/8",
+		"5/4",
+		"45/32",
+		"8/5",
+		"9/5",
+		"1",
+		"9/8",
+		"5/4",
+		"45/32",
+		"8/5",
+		"9/5",
+		"1",
+		"9/8",
+		"5/4",
+		"1",
+		"9/8",
+		"5/4",
+		"45/32",
+		"8/5",
+		"9/5",
+		"1",
+		"9/8",
+		"5/4",
+		"45/32",
+		"8/5",
+		"9/5",
+		"1",
+		"9/8",
+		"5/4",
+		"45/32",
+		"8/5",
+		"9/5",
+		"1",
+		"9/8",
+		"5/4",
+		"1",
+		"9/8",
+		"5/4",
+		"45/32",
+		"8/5",
+		"9/5",
+		"1",
+		"9/8",
+		"5/4",
+		"45/32",
+		"8/5",
+		"9/5",
+		"1",
+		"9/8",
+		"5/4",
+		"45/32",
+		"8/5",
+		"9/5",
+		"1",
+		"9/8",
+		"5/4",
+		"1",
+		"9/8",
+		"5/4",
+		"45/32",
+		"8/5",
+		"9/5",
+		"1",
+		"9/8",
+		"5/4",
+		"45/32",
+		"8/5",
+		"9/5",
+		"1",
+		"9/8",
+		"5/4",
+		"45/32",
+		"8/5",
+		"9/5",
+		"1",
+		"9/8",
+		"5/4",
+		"1",
+		"9/8",
+		"5/4",
+		"45/32",
+		"8/5",
+		"9/5",
+		"1",
+		"9/8",
+		"5/4",
+		"45/32",
+		"8/5",
+		"9/5",
+		"1",
+		"9/8",
+		"5/4",
+		"45/32",
+		"8/5",
+		"9/5",
+		"1",
+		"9/8",
+		"5/4",
+		"1",
+		"9/8",
+		"5/4",
+		"45/32",
+		"8/5",
+		"9/5",
+		"1",
+		"9/8",
+		"5/4",
+		"45/32",
+		"8/5",
+		"9/5",
+		"1",
+		"9/8",
+		"5/4",
+		"45/32",
+		"8/5",
+		"9/5",
+		"1",
+		"9/8",
+		"5/4",
+		"1",
+		"9/8",
+		"5/4",
+		"45/32",
+		"8/5",
+		"9/5",
+		"1",
+		"9/8",
+		"5/4",
+		"45/32",
+		"8/5",
+		"9/5",
+		"1",
+		"9/8",
+		"5/4",
+		"45/32",
+		"8/5",
+		"9/5",
+		"1",
+		"9/8",
+		"5/4",
+		"1",
+		"9/8",
+		"5/4",
+		"45/32",
+		"8/5",
+		"9/5",
+		"1",
+		"9/8",
+		"5/4",
+		"45/32",
+		"8/5",
+		"9/5",
+		"1",
+		"9/8",
+		"5/4",
+		"45/32",
+		"8/5",
+		"9/5",
+		"1",
+		"9/8",
+		"5/4"},
+	.c_maxq48000 = {
+		0.01439896632895322,
+		0.01619883712007237,
+		0.01799870791119152,
+		0.02024854640009046,
+		0.02303834612632515,
+		0.02591813939211579,
+		0.02879793265790644,
+		0.03239767424014475,
+		0.03599741582238305,
+		0.04049709280018093,
+		0.04607669225265029,
+		0.05183627878423159,
+		0.05759586531581288,
+		0.06479534848028949,
+		0.0719948316447661,
+		0.08099418560036185,
+		0.09215338450530058,
+		0.1036725575684632,
+		0.1151917306316258,
+		0.129590696960579,
+		0.1439896632895322,
+		0.1151917306316258,
+		0.129590696960579,
+		0.1439896632895322,
+		0.1619883712007237,
+		0.1843067690106012,
+		0.2073451151369264,
+		0.2303834612632515,
+		0.259181393921158,
+		0.2879793265790644,
+		0.3239767424014474,
+		0.3686135380212023,
+		0.4146902302738527,
+		0.460766922526503,
+		0.5183627878423159,
+		0.5759586531581288,
+		0.6479534848028948,
+		0.7372270760424047,
+		0.8293804605477054,
+		0.9215338450530061,
+		1.036725575684632,
+		1.151917306316258,
+		0.01616229323913452,
+		0.01818257989402634,
+		0.02020286654891815,
+		0.02272822486753292,
+		0.02585966918261523,
+		0.02909212783044214,
+		0.03232458647826904,
+		0.03636515978805268,
+		0.0404057330978363,
+		0.04545644973506584,
+		0.05171933836523047,
+		0.05818425566088428,
+		0.06464917295653809,
+		0.07273031957610536,
+		0.0808114661956726,
+		0.09091289947013168,
+		0.1034386767304609,
+		0.1163685113217686,
+		0.1292983459130762,
+		0.1454606391522107,
+		0.1616229323913452,
+		0.1292983459130762,
+		0.1454606391522107,
+		0.1616229323913452,
+		0.1818257989402634,
+		0.2068773534609219,
+		0.2327370226435371,
+		0.2585966918261524,
+		0.2909212783044214,
+		0.3232458647826904,
+		0.3636515978805267,
+		0.4137547069218437,
+		0.4654740452870743,
+		0.5171933836523047,
+		0.5818425566088429,
+		0.6464917295653808,
+		0.7273031957610534,
+		0.8275094138436875,
+		0.9309480905741485,
+		1.034386767304609,
+		1.163685113217686,
+		1.292983459130762,
+		0.01712335320707578,
+		0.01926377235796025,
+		0.02140419150884472,
+		0.02407971544745031,
+		0.02739736513132125,
+		0.0308220357727364,
+		0.03424670641415156,
+		0.0385275447159205,
+		0.04280838301768945,
+		0.04815943089490062,
+		0.05479473026264249,
+		0.0616440715454728,
+		0.06849341282830311,
+		0.077055089431841,
+		0.08561676603537889,
+		0.09631886178980124,
+		0.109589460525285,
+		0.1232881430909456,
+		0.1369868256566062,
+		0.154110178863682,
+		0.1712335320707578,
+		0.1369868256566062,
+		0.154110178863682,
+		0.1712335320707578,
+		0.1926377235796025,
+		0.21917892105057,
+		0.2465762861818912,
+		0.2739736513132124,
+		0.308220357727364,
+		0.3424670641415156,
+		0.385275447159205,
+		0.4383578421011399,
+		0.4931525723637824,
+		0.5479473026264249,
+		0.616440715454728,
+		0.6849341282830311,
+		0.77055089431841,
+		0.8767156842022799,
+		0.9863051447275648,
+		1.09589460525285,
+		1.232881430909456,
+		1.369868256566062,
+		0.01922031411473915,
+		0.02162285337908154,
+		0.02402539264342394,
+		0.02702856672385193,
+		0.03075250258358264,
+		0.03459656540653047,
+		0.0384406282294783,
+		0.04324570675816308,
+		0.04805078528684788,
+		0.05405713344770386,
+		0.06150500516716528,
+		0.06919313081306094,
+		0.0768812564589566,
+		0.08649141351632617,
+		0.09610157057369575,
+		0.1081142668954077,
+		0.1230100103343306,
+		0.1383862616261219,
+		0.1537625129179132,
+		0.1729828270326523,
+		0.1922031411473915,
+		0.1537625129179132,
+		0.1729828270326523,
+		0.1922031411473915,
+		0.2162285337908154,
+		0.2460200206686611,
+		0.2767725232522438,
+		0.3075250258358264,
+		0.3459656540653047,
+		0.384406282294783,
+		0.4324570675816309,
+		0.4920400413373222,
+		0.5535450465044875,
+		0.6150500516716528,
+		0.6919313081306093,
+		0.768812564589566,
+		0.8649141351632618,
+		0.9840800826746444,
+		1.107090093008975,
+		1.230100103343306,
+		1.383862616261219,
+		1.537625129179132,
+		0.02157407315037966,
+		0.02427083229417711,
+		0.02696759143797457,
+		0.03033854036772139,
+		0.03451851704060745,
+		0.03883333167068338,
+		0.04314814630075931,
+		0.04854166458835422,
+		0.05393518287594914,
+		0.06067708073544278,
+		0.06903703408121491,
+		0.07766666334136677,
+		0.08629629260151862,
+		0.09708332917670845,
+		0.1078703657518983,
+		0.1213541614708856,
+		0.1380740681624298,
+		0.1553333266827335,
+		0.1725925852030372,
+		0.1941666583534169,
+		0.2157407315037966,
+		0.1725925852030372,
+		0.1941666583534169,
+		0.2157407315037966,
+		0.2427083229417711,
+		0.2761481363248596,
+		0.3106666533654671,
+		0.3451851704060745,
+		0.3883333167068338,
+		0.4314814630075932,
+		0.4854166458835423,
+		0.5522962726497193,
+		0.6213333067309341,
+		0.690370340812149,
+		0.7766666334136676,
+		0.8629629260151863,
+		0.9708332917670845,
+		1.104592545299439,
+		1.242666613461868,
+		1.380740681624298,
+		1.553333266827335,
+		1.725925852030373,
+		0.02285693429783502,
+		0.0257140510850644,
+		0.02857116787229378,
+		0.0321425638563305,
+		0.03657109487653604,
+		0.04114248173610304,
+		0.04571386859567004,
+		0.0514281021701288,
+		0.05714233574458756,
+		0.064285127712661,
+		0.07314218975307207,
+		0.08228496347220608,
+		0.09142773719134008,
+		0.1028562043402576,
+		0.1142846714891751,
+		0.128570255425322,
+		0.1462843795061441,
+		0.1645699269444122,
+		0.1828554743826802,
+		0.2057124086805152,
+		0.2285693429783502
+	},
+	.c_maxq96000 = {
+		0.00719948316447661,
+		0.008099418560036186,
+		0.008999353955595762,
+		0.01012427320004523,
+		0.01151917306316257,
+		0.0129590696960579,
+		0.01439896632895322,
+		0.01619883712007237,
+		0.01799870791119152,
+		0.02024854640009046,
+		0.02303834612632515,
+		0.02591813939211579,
+		0.02879793265790644,
+		0.03239767424014475,
+		0.03599741582238305,
+		0.04049709280018093,
+		0.04607669225265029,
+		0.05183627878423159,
+		0.05759586531581288,
+		0.06479534848028949,
+		0.0719948316447661,
+		0.05759586531581288,
+		0.06479534848028949,
+		0.0719948316447661,
+		0.08099418560036185,
+		0.09215338450530058,
+		0.1036725575684632,
+		0.1151917306316258,
+		0.129590696960579,
+		0.1439896632895322,
+		0.1619883712007237,
+		0.1843067690106012,
+		0.2073451151369264,
+		0.2303834612632515,
+		0.259181393921158,
+		0.2879793265790644,
+		0.3239767424014474,
+		0.3686135380212023,
+		0.4146902302738527,
+		0.460766922526503,
+		0.5183627878423159,
+		0.5759586531581288,
+		0.008081146619567261,
+		0.00909128994701317,
+		0.01010143327445908,
+		0.01136411243376646,
+		0.01292983459130762,
+		0.01454606391522107,
+		0.01616229323913452,
+		0.01818257989402634,
+		0.02020286654891815,
+		0.02272822486753292,
+		0.02585966918261523,
+		0.02909212783044214,
+		0.03232458647826904,
+		0.03636515978805268,
+		0.0404057330978363,
+		0.04545644973506584,
+		0.05171933836523047,
+		0.05818425566088428,
+		0.06464917295653809,
+		0.07273031957610536,
+		0.0808114661956726,
+		0.06464917295653809,
+		0.07273031957610536,
+		0.0808114661956726,
+		0.09091289947013168,
+		0.1034386767304609,
+		0.1163685113217686,
+		0.1292983459130762,
+		0.1454606391522107,
+		0.1616229323913452,
+		0.1818257989402634,
+		0.2068773534609219,
+		0.2327370226435371,
+		0.2585966918261524,
+		0.2909212783044214,
+		0.3232458647826904,
+		0.3636515978805267,
+		0.4137547069218437,
+		0.4654740452870743,
+		0.5171933836523047,
+		0.5818425566088429,
+		0.6464917295653808,
+		0.008561676603537889,
+		0.009631886178980125,
+		0.01070209575442236,
+		0.01203985772372516,
+		0.01369868256566062,
+		0.0154110178863682,
+		0.01712335320707578,
+		0.01926377235796025,
+		0.02140419150884472,
+		0.02407971544745031,
+		0.02739736513132125,
+		0.0308220357727364,
+		0.03424670641415156,
+		0.0385275447159205,
+		0.04280838301768945,
+		0.04815943089490062,
+		0.05479473026264249,
+		0.0616440715454728,
+		0.06849341282830311,
+		0.077055089431841,
+		0.08561676603537889,
+		0.06849341282830311,
+		0.077055089431841,
+		0.08561676603537889,
+		0.09631886178980124,
+		0.109589460525285,
+		0.1232881430909456,
+		0.1369868256566062,
+		0.154110178863682,
+		0.1712335320707578,
+		0.1926377235796025,
+		0.21917892105057,
+		0.2465762861818912,
+		0.2739736513132124,
+		0.308220357727364,
+		0.3424670641415156,
+		0.385275447159205,
+		0.4383578421011399,
+		0.4931525723637824,
+		0.5479473026264249,
+		0.616440715454728,
+		0.6849341282830311,
+		0.009610157057369575,
+		0.01081142668954077,
+		0.01201269632171197,
+		0.01351428336192597,
+		0.01537625129179132,
+		0.01729828270326524,
+		0.01922031411473915,
+		0.02162285337908154,
+		0.02402539264342394,
+		0.02702856672385193,
+		0.03075250258358264,
+		0.03459656540653047,
+		0.0384406282294783,
+		0.04324570675816308,
+		0.04805078528684788,
+		0.05405713344770386,
+		0.06150500516716528,
+		0.06919313081306094,
+		0.0768812564589566,
+		0.08649141351632617,
+		0.09610157057369575,
+		0.0768812564589566,
+		0.08649141351632617,
+		0.09610157057369575,
+		0.1081142668954077,
+		0.1230100103343306,
+		0.1383862616261219,
+		0.1537625129179132,
+		0.1729828270326523,
+		0.1922031411473915,
+		0.2162285337908154,
+		0.2460200206686611,
+		0.2767725232522438,
+		0.3075250258358264,
+		0.3459656540653047,
+		0.384406282294783,
+		0.4324570675816309,
+		0.4920400413373222,
+		0.5535450465044875,
+		0.6150500516716528,
+		0.6919313081306093,
+		0.768812564589566,
+		0.01078703657518983,
+		0.01213541614708856,
+		0.01348379571898729,
+		0.0151692701838607,
+		0.01725925852030373,
+		0.01941666583534169,
+		0.02157407315037966,
+		0.02427083229417711,
+		0.02696759143797457,
+		0.03033854036772139,
+		0.03451851704060745,
+		0.03883333167068338,
+		0.04314814630075931,
+		0.04854166458835422,
+		0.05393518287594914,
+		0.06067708073544278,
+		0.06903703408121491,
+		0.07766666334136677,
+		0.08629629260151862,
+		0.09708332917670845,
+		0.1078703657518983,
+		0.08629629260151862,
+		0.09708332917670845,
+		0.1078703657518983,
+		0.1213541614708856,
+		0.1380740681624298,
+		0.1553333266827335,
+		0.1725925852030372,
+		0.1941666583534169,
+		0.2157407315037966,
+		0.2427083229417711,
+		0.2761481363248596,
+		0.3106666533654671,
+		0.3451851704060745,
+		0.3883333167068338,
+		0.4314814630075932,
+		0.4854166458835423,
+		0.5522962726497193,
+		0.6213333067309341,
+		0.690370340812149,
+		0.7766666334136676,
+		0.8629629260151863,
+		0.01142846714891751,
+		0.0128570255425322,
+		0.01428558393614689,
+		0.01607128192816525,
+		0.01828554743826802,
+		0.02057124086805152,
+		0.02285693429783502,
+		0.0257140510850644,
+		0.02857116787229378,
+		0.0321425638563305,
+		0.03657109487653604,
+		0.04114248173610304,
+		0.04571386859567004,
+		0.0514281021701288,
+		0.05714233574458756,
+		0.064285127712661,
+		0.07314218975307207,
+		0.08228496347220608,
+		0.09142773719134008,
+		0.1028562043402576,
+		0.1142846714891751
+	},
+	.c_bpre4800022 = {
+		{ 0.007173628968382158, 0.9928263710316179, -1.992619788024624 },
+		{ 0.008066706644938713, 0.9919332933550614, -1.991671955107035 },
+		{ 0.008958980970818363, 0.9910410190291816, -1.990718525395477 },
+		{ 0.01007322766323346, 0.9899267723376084, -1.98951884503708 },
+		{ 0.01145308140629559, 0.9885469185937045, -1.988019215992222 },
+		{ 0.01287546249921253, 0.9871245375007875, -1.986457149457952 },
+		{ 0.01429579698418819, 0.9857042030158116, -1.98488086689542 },
+		{ 0.01606834153378098, 0.9839316584662189, -1.982890572976223 },
+		{ 0.01783769860160167, 0.9821623013983984, -1.980878183295633 },
+		{ 0.02004492127133694, 0.9799550787286629, -1.978331723063247 },
+		{ 0.02277498973889161, 0.9772250102611083, -1.975126496357155 },
+		{ 0.02558514746385576, 0.9744148525361441, -1.971762820294948 },
+		{ 0.02838722415696337, 0.9716127758430366, -1.968343480294637 },
+		{ 0.03187849146791616, 0.9681215085320839, -1.963991436560069 },
+		{ 0.03535721371180078, 0.9646427862881989, -1.959553362131389 },
+		{ 0.03968804367389913, 0.9603119563261003, -1.953885590425088 },
+		{ 0.04503127932017706, 0.9549687206798227, -1.946673555636917 },
+		{ 0.05051569515696485, 0.949484304843035, -1.939017157090135 },
+		{ 0.05596861381858907, 0.9440313861814109, -1.931147834504842 },
+		{ 0.06274074471756194, 0.9372592552824381, -1.921015085172948 },
+		{ 0.0694642948621403, 0.9305357051378597, -1.910557337895528 },
+		{ 0.05596861381858907, 0.9440313861814109, -1.931147834504842 },
+		{ 0.06274074471756194, 0.9372592552824381, -1.921015085172948 },
+		{ 0.0694642948621403, 0.9305357051378597, -1.910557337895528 },
+		{ 0.07780094653713784, 0.9221990534628621, -1.897034677377655 },
+		{ 0.08803474252314278, 0.9119652574768572, -1.87958331883406 },
+		{ 0.09847955485673862, 0.9015204451432617, -1.860791596801607 },
+		{ 0.108804741904404, 0.891195258095596, -1.84122780449662 },
+		{ 0.12154508838741, 0.8784549116125902, -1.815714709197418 },
+		{ 0.1341033014635866, 0.8658966985364135, -1.789058577782907 },
+		{ 0.1495489057922005, 0.8504510942077993, -1.754185012866849 },
+		{ 0.168319369155169, 0.8316806308448309, -1.708642641377184 },
+		{ 0.1872608869886954, 0.8127391130113046, -1.659093471445009 },
+		{ 0.2057710119479237, 0.7942289880520762, -1.607112005154733 },
+		{ 0.2283169682637166, 0.7716830317362834, -1.538939714958749 },
+		{ 0.2502229074637394, 0.7497770925362606, -1.467486547981327 },
+		{ 0.2767329363607569, 0.7232670636392432, -1.373996421795472 },
+		{ 0.3083073282775445, 0.6916926717224556, -1.252420083046553 },
+		{ 0.3394551341815976, 0.6605448658184023, -1.121420427225598 },
+		{ 0.369200314537775, 0.630799685462225, -0.9859800463694947 },
+		{ 0.4045052985302982, 0.5954947014697018, -0.8121728816634225 },
+		{ 0.4378343115078716, 0.5621656884921283, -0.635390028074991 },
+		{ 0.008048593274544517, 0.9919514067255844, -1.991691243155729 },
+		{ 0.009050109974803794, 0.990949890025584, -1.990620787368833 },
+		{ 0.01005061550092586, 0.9899493844998146, -1.989543291139686 },
+		{ 0.01129979464378428, 0.988700205356285, -1.988186572943144 },
+		{ 0.01284658268102471, 0.9871534173192458, -1.986489029409643 },
+		{ 0.01444074970887289, 0.9855592502916787, -1.984719072298906 },
+		{ 0.01603240669539133, 0.9839675933048655, -1.982931177691716 },
+		{ 0.018018251187968, 0.9819817488122703, -1.980671385639063 },
+		{ 0.02000015198760729, 0.9799998480123996, -1.978383771652818 },
+		{ 0.02247190392857709, 0.9775280960715602, -1.975485372171333 },
+		{ 0.0255281944541356, 0.974471805546033, -1.971831641934025 },
+		{ 0.02867302773770862, 0.9713269722622919, -1.967991040448562 },
+		{ 0.03180771195789074, 0.9681922880422043, -1.964080680251197 },
+		{ 0.03571190811218079, 0.964288091887895, -1.959095129490195 },
+		{ 0.03960029789568682, 0.9603997021043265, -1.954001999211236 },
+		{ 0.04443875884948869, 0.9555612411506248, -1.947485306311606 },
+		{ 0.05040463804503716, 0.9495953619550142, -1.939174759563692 },
+		{ 0.05652391295577023, 0.9434760870442314, -1.930332010613478 },
+		{ 0.06260375472812528, 0.9373962452719558, -1.921224026261177 },
+		{ 0.0701485975634842, 0.9298514024395254, -1.909470614664124 },
+		{ 0.07763253293679226, 0.9223674670644522, -1.897313989827179 },
+		{ 0.06260375472812528, 0.9373962452719558, -1.921224026261177 },
+		{ 0.0701485975634842, 0.9298514024395254, -1.909470614664124 },
+		{ 0.07763253293679226, 0.9223674670644522, -1.897313989827179 },
+		{ 0.0869029534626863, 0.9130970465410435, -1.88155984264024 },
+		{ 0.0982688846299328, 0.9017311153737896, -1.86118050188736 },
+		{ 0.1098528731757094, 0.8901471268242941, -1.839186427175118 },
+		{ 0.1212880493063797, 0.8787119506961812, -1.816244584825735 },
+		{ 0.1353758034914073, 0.8646241965137803, -1.786273078646834 },
+		{ 0.1492382557035073, 0.8507617442988931, -1.754909375303007 },
+		{ 0.1662532379144303, 0.8337467620877779, -1.713827772514097 },
+		{ 0.1868804633828985, 0.8131195366185764, -1.660124639211667 },
+		{ 0.2076380926064609, 0.7923619073935461, -1.601670514652036 },
+		{ 0.2278658130660425, 0.772134186935479, -1.54035689744841 },
+		{ 0.2524254880894425, 0.7475745119105662, -1.460013650684596 },
+		{ 0.2762039807151093, 0.7237960192857271, -1.375937930506969 },
+		{ 0.304866791672577, 0.6951332083280838, -1.26621341242273 },
+		{ 0.3388370519004486, 0.6611629481005293, -1.124127548540203 },
+		{ 0.3721626077116748, 0.6278373922883381, -0.9719388246670579 },
+		{ 0.4038084071595591, 0.5961915928408708, -0.8157392198398624 },
+		{ 0.4411323491416942, 0.5588676508583215, -0.6172464803401182 },
+		{ 0.4761196653457847, 0.5238803346548755, -0.4179280424967831 },
+		{ 0.008525143929762899, 0.9914748560704251, -1.991182902834333 },
+		{ 0.009585623472325668, 0.9904143765281869, -1.990045075511484 },
+		{ 0.01064503348036745, 0.9893549665196336, -1.988899282836953 },
+		{ 0.01196763788768098, 0.9880323621129593, -1.987456029859763 },
+		{ 0.01360525338975681, 0.9863947466107515, -1.985649287005155 },
+		{ 0.01529287526004767, 0.9847071247399526, -1.983764465651186 },
+		{ 0.01697760978050481, 0.9830223902198703, -1.98185961909105 },
+		{ 0.01907942696748656, 0.980920573032614, -1.979450541276753 },
+		{ 0.02117675022293765, 0.9788232497770653, -1.977010372323061 },
+		{ 0.02379211531014814, 0.9762078846898554, -1.973916587098443 },
+		{ 0.02702546753975817, 0.972974532460253, -1.970013381127019 },
+		{ 0.03035187848637574, 0.9696481215136245, -1.965906983592711 },
+		{ 0.03366691708007948, 0.9663330829199375, -1.961722512131246 },
+		{ 0.03779482940156752, 0.9622051705986322, -1.956382759213956 },
+		{ 0.04190504569587076, 0.9580949543041354, -1.950922691401318 },
+		{ 0.0470181658693645, 0.9529818341306421, -1.943929611565316 },
+		{ 0.05332055918377449, 0.9466794408162477, -1.935001466165577 },
+		{ 0.05978252044509966, 0.9402174795549011, -1.925490528852913 },
+		{ 0.06620025062283011, 0.9337997493796442, -1.915683929838771 },
+		{ 0.07416145206777851, 0.9258385479427459, -1.903014300417245 },
+		{ 0.08205417869760591, 0.9179458213042083, -1.889896394547758 },
+		{ 0.06620025062283011, 0.9337997493796442, -1.915683929838771 },
+		{ 0.07416145206777851, 0.9258385479427459, -1.903014300417245 },
+		{ 0.08205417869760591, 0.9179458213042083, -1.889896394547758 },
+		{ 0.09182538606238867, 0.9081746139425293, -1.872878644988852 },
+		{ 0.1037978017145652, 0.8962021982893195, -1.850838228784563 },
+		{ 0.1159908597107512, 0.8840091402935922, -1.827025233579297 },
+		{ 0.1280180280633102, 0.8719819719414862, -1.802163694945135 },
+		{ 0.1428224221220404, 0.8571775778779611, -1.769658010693557 },
+		{ 0.1573754691536353, 0.8426245308498574, -1.735621246300642 },
+		{ 0.1752194104090781, 0.8247805895918523, -1.691014744150961 },
+		{ 0.196822145461321, 0.8031778545397602, -1.63268693628976 },
+		{ 0.2185283513499804, 0.78147164865045, -1.569199822561555 },
+		{ 0.239647938258562, 0.7603520617415391, -1.502628737008348 },
+		{ 0.2652465999832747, 0.7347534000167282, -1.415457082705361 },
+		{ 0.2899834353056022, 0.7100165646945451, -1.324340846003185 },
+		{ 0.3197369790342458, 0.6802630209674833, -1.205633459365805 },
+		{ 0.3549049117646044, 0.6450950882367019, -1.052333608543035 },
+		{ 0.3893020623563368, 0.6106979376444528, -0.8887423668000664 },
+		{ 0.4218647422055749, 0.5781352577946095, -0.7216036473971494 },
+		{ 0.460137441163863, 0.5398625588361424, -0.5104962677098522 },
+		{ 0.4958758179827635, 0.5041241820372223, -0.3001956854520381 },
+		{ 0.009564102178687455, 0.9904358978218357, -1.990068257175529 },
+		{ 0.01075316530037546, 0.9892468347002125, -1.98878182127171 },
+		{ 0.01194080089797066, 0.9880591991026826, -1.98748545644192 },
+		{ 0.01342337283480475, 0.9865766271651994, -1.985851031380029 },
+		{ 0.01525865228328556, 0.9847413477167908, -1.983802918958107 },
+		{ 0.01714950766178436, 0.9828504923383823, -1.981663954285344 },
+		{ 0.01903679650984312, 0.9809632034902522, -1.979499764664712 },
+		{ 0.02139076408546618, 0.9786092359145629, -1.976759333979217 },
+		{ 0.02373908296469734, 0.9762609170353048, -1.973979882829423 },
+		{ 0.02666655873134723, 0.9733334412686607, -1.970450932900213 },
+		{ 0.03028447809706987, 0.9697155219030812, -1.965991105714481 },
+		{ 0.0340049729345985, 0.9659950270655716, -1.961290610291277 },
+		{ 0.03771119339833018, 0.9622888066018583, -1.956492376078495 },
+		{ 0.04232396338277346, 0.9576760366172842, -1.950358137443555 },
+		{ 0.04691462186938953, 0.9530853781306147, -1.944073443590945 },
+		{ 0.05262201210812233, 0.9473779878918931, -1.936007920480982 },
+		{ 0.05965174503462313, 0.9403482549654125, -1.925686611100865 },
+		{ 0.06685336339219521, 0.9331466366126004, -1.914665658107077 },
+		{ 0.07400025268914177, 0.9259997473112286, -1.903276415136619 },
+		{ 0.0828564888360183, 0.917143511164787, -1.888531628652119 },
+		{ 0.09162802418744742, 0.9083719758175728, -1.873230957422091 },
+		{ 0.07400025268914177, 0.9259997473112286, -1.903276415136619 },
+		{ 0.0828564888360183, 0.917143511164787, -1.888531628652119 },
+		{ 0.09162802418744742, 0.9083719758175728, -1.873230957422091 },
+		{ 0.1024747130919844, 0.8975252869136322, -1.853338894082812 },
+		{ 0.1157449278914538, 0.8842550721139026, -1.827519307356609 },
+		{ 0.1292379244943503, 0.8707620755087764, -1.799565045373521 },
+		{ 0.1425244679802553, 0.8574755320204597, -1.770333165268908 },
+		{ 0.1588477799298759, 0.8411522200716739, -1.732061303672978 },
+		{ 0.1748608936026178, 0.8251391063982615, -1.691942519545564 },
+		{ 0.1944488865830116, 0.8055511134172545, -1.639329644967373 },
+		{ 0.2180934791977429, 0.7819065208023745, -1.570520495077 },
+		{ 0.2417729115981155, 0.7582270884026584, -1.495664710026815 },
+		{ 0.2647357119875735, 0.7352642880137701, -1.417267194837147 },
+		{ 0.2924634057517546, 0.707536594249736, -1.314828584143444 },
+		{ 0.3191454550939122, 0.6808545449077219, -1.20809127136704 },
+		{ 0.3510874036727132, 0.6489125963277783, -1.069658164830968 },
+		{ 0.3886221927269417, 0.6113778072732741, -0.8921058228384764 },
+		{ 0.4250920586900147, 0.5749079413110821, -0.7044019594153654 },
+		{ 0.4593860729410246, 0.5406139270592686, -0.5147864327225303 },
+		{ 0.4993906572456916, 0.5006093427929948, -0.278889706158877 },
+		{ 0.5364370886814468, 0.4635629113215011, -0.04853745440470898 },
+		{ 0.01072907947466966, 0.9892709205254852, -1.988807993479254 },
+		{ 0.01206211122500688, 0.9879378887756927, -1.987352393798842 },
+		{ 0.01339328215525998, 0.9866067178448656, -1.985884382338201 },
+		{ 0.015054772128567, 0.9849452278717498, -1.984031802278118 },
+		{ 0.0171111677749217, 0.9828888322250823, -1.981707616126922 },
+		{ 0.01922938927604276, 0.9807706107240263, -1.979277267980516 },
+		{ 0.02134304580296828, 0.9786569541973403, -1.976815340305844 },
+		{ 0.02397866404098213, 0.9760213359590177, -1.973693750252121 },
+		{ 0.02660718430363098, 0.9733928156966185, -1.970523213902598 },
+		{ 0.02988296158674888, 0.9701170384133195, -1.966491449145213 },
+		{ 0.0339295434872225, 0.9660704565127857, -1.961387062633919 },
+		{ 0.03808900914015727, 0.9619109908599796, -1.955996724753108 },
+		{ 0.04223050331532973, 0.9577694966846801, -1.950484218257796 },
+		{ 0.04738235175277414, 0.9526176482472259, -1.943422994117022 },
+		{ 0.05250648836352331, 0.9474935116364839, -1.936173958630653 },
+		{ 0.0588729317803053, 0.9411270682198296, -1.926851259030487 },
+		{ 0.06670799522240956, 0.9332920047791766, -1.914892627673966 },
+		{ 0.07472724566304056, 0.9252727543372278, -1.902092471876096 },
+		{ 0.08267759122039423, 0.9173224087796253, -1.88883644405978 },
+		{ 0.09251937867549215, 0.9074806213299151, -1.871636969452478 },
+		{ 0.1022561629226461, 0.8977438370788348, -1.853750398190039 },
+		{ 0.08267759122039423, 0.9173224087796253, -1.88883644405978 },
+		{ 0.09251937867549215, 0.9074806213299151, -1.871636969452478 },
+		{ 0.1022561629226461, 0.8977438370788348, -1.853750398190039 },
+		{ 0.1142800733515571, 0.885719926655087, -1.830450382103676 },
+		{ 0.1289660338183396, 0.8710339661847347, -1.800145467448109 },
+		{ 0.1438703300817191, 0.8561296699188, -1.767276605782113 },
+		{ 0.1585195983507837, 0.8414804016492542, -1.732856688975128 },
+		{ 0.1764794609044175, 0.8235205390962201, -1.68774362522255 },
+		{ 0.1940560029897977, 0.8059439970130292, -1.640423687596002 },
+		{ 0.2154996980720283, 0.7845003019279717, -1.578355950332716 },
+		{ 0.2412993331850453, 0.7587006668157723, -1.49722097442153 },
+		{ 0.2670419882857015, 0.7329580117152734, -1.409072999531746 },
+		{ 0.2919107336402809, 0.7080892663597902, -1.316954421651064 },
+		{ 0.3218139216878558, 0.6781860783133293, -1.196972106492821 },
+		{ 0.3504538485519257, 0.6495461514481606, -1.072517239991206 },
+		{ 0.3845592762749213, 0.6154407237250787, -0.9120971658829601 },
+		{ 0.424373674921009, 0.5756263250800253, -0.7082407415214553 },
+		{ 0.4627722014483157, 0.5372277985522637, -0.4954078494200846 },
+		{ 0.4986102471969354, 0.5013897528158646, -0.2836293424370332 },
+		{ 0.5400636431841246, 0.459936356818013, -0.02549214112903716 },
+		{ 0.5780897971390385, 0.4219102028611167, 0.2196961830905914 },
+		{ 0.01136340279995649, 0.9886365972000836, -1.988117149403563 },
+		{ 0.01277473481370322, 0.9872252651863348, -1.986568311568434 },
+		{ 0.01418405207521755, 0.9858159479250834, -1.985005478091148 },
+		{ 0.01594282148228152, 0.9840571785177398, -1.983032358798316 },
+		{ 0.01811940783131227, 0.9818805921690074, -1.980555407815204 },
+		{ 0.02036107015925261, 0.9796389298410225, -1.977963699346136 },
+		{ 0.02259767867671927, 0.9774023213233605, -1.975336537903339 },
+		{ 0.02538627577784638, 0.974613724222229, -1.972003018272966 },
+		{ 0.02816685321033961, 0.971833146789759, -1.968614766257665 },
+		{ 0.03163146940774782, 0.9683685305922943, -1.964302716498417 },
+		{ 0.03591043962235453, 0.9640895603776723, -1.958838181900579 },
+		{ 0.04030762995168424, 0.9596923700483434, -1.953061751213887 },
+		{ 0.04468470227186336, 0.9553152977282937, -1.947148728928402 },
+		{ 0.05012808855782609, 0.9498719114423231, -1.939566752625148 },
+		{ 0.05554039661555669, 0.9444596033845466, -1.931775126179851 },
+		{ 0.0622623889586038, 0.9377376110414792, -1.921743971704901 },
+		{ 0.07053131957083905, 0.9294686804292135, -1.908861015554499 },
+		{ 0.07899043431219854, 0.9210095656888688, -1.895054689501654 },
+		{ 0.08737256246672775, 0.9126274375363427, -1.880741141441922 },
+		{ 0.09774346996079515, 0.9022565300419814, -1.862148657067213 },
+		{ 0.1079959408120347, 0.8920040591883457, -1.842796042690108 }
+	},
+	.c_bpre9600022 = {
+		{ 0.003593270279843708, 0.9964067297201568, -1.996354990509996 },
+		{ 0.004041520265497645, 0.9959584797345027, -1.995893012074424 },
+		{ 0.004489568598509601, 0.9955104314014903, -1.995429625376659 },
+		{ 0.005049361859208405, 0.9949506381412137, -1.994848396227848 },
+		{ 0.005743031910912743, 0.9942569680890873, -1.994124659229387 },
+		{ 0.006458587928621774, 0.9935414120713779, -1.993374019246152 },
+		{ 0.007173628968382158, 0.9928263710316179, -1.992619788024624 },
+		{ 0.008066706644938713, 0.9919332933550614, -1.991671955107035 },
+		{ 0.008958980970818363, 0.9910410190291816, -1.990718525395477 },
+		{ 0.01007319526711257, 0.9899268047328871, -1.989518880062729 },
+		{ 0.01145308140629559, 0.9885469185937045, -1.988019215992222 },
+		{ 0.01287546249921253, 0.9871245375007875, -1.986457149457952 },
+		{ 0.01429579698418819, 0.9857042030158116, -1.98488086689542 },
+		{ 0.01606834153378098, 0.9839316584662189, -1.982890572976223 },
+		{ 0.01783769860160167, 0.9821623013983984, -1.980878183295633 },
+		{ 0.02004492127133694, 0.9799550787286629, -1.978331723063247 },
+		{ 0.02277498973889161, 0.9772250102611083, -1.975126496357155 },
+		{ 0.02558514746385576, 0.9744148525361441, -1.971762820294948 },
+		{ 0.02838722415696337, 0.9716127758430366, -1.968343480294637 },
+		{ 0.03187849146791616, 0.9681215085320839, -1.963991436560069 },
+		{ 0.03535721371180078, 0.9646427862881989, -1.959553362131389 },
+		{ 0.02838722415696337, 0.9716127758430366, -1.968343480294637 },
+		{ 0.03187849146791616, 0.9681215085320839, -1.963991436560069 },
+		{ 0.03535721371180078, 0.9646427862881989, -1.959553362131389 },
+		{ 0.03968804367389913, 0.9603119563261003, -1.953885590425088 },
+		{ 0.04503127932017706, 0.9549687206798227, -1.946673555636917 },
+		{ 0.05051569515696485, 0.949484304843035, -1.939017157090135 },
+		{ 0.05596861381858907, 0.9440313861814109, -1.931147834504842 },
+		{ 0.06274074471756194, 0.9372592552824381, -1.921015085172948 },
+		{ 0.0694642948621403, 0.9305357051378597, -1.910557337895528 },
+		{ 0.07780094653713784, 0.9221990534628621, -1.897034677377655 },
+		{ 0.08803474252314278, 0.9119652574768572, -1.87958331883406 },
+		{ 0.09847955485673862, 0.9015204451432617, -1.860791596801607 },
+		{ 0.108804741904404, 0.891195258095596, -1.84122780449662 },
+		{ 0.12154508838741, 0.8784549116125902, -1.815714709197418 },
+		{ 0.1341033014635866, 0.8658966985364135, -1.789058577782907 },
+		{ 0.1495489057922005, 0.8504510942077993, -1.754185012866849 },
+		{ 0.168319369155169, 0.8316806308448309, -1.708642641377184 },
+		{ 0.1872608869886954, 0.8127391130113046, -1.659093471445009 },
+		{ 0.2057710119479237, 0.7942289880520762, -1.607112005154733 },
+		{ 0.2283169682637166, 0.7716830317362834, -1.538939714958749 },
+		{ 0.2502229074637394, 0.7497770925362606, -1.467486547981327 },
+		{ 0.004032426870504835, 0.9959675731295595, -1.995902400037819 },
+		{ 0.004535339640227451, 0.9954646603599669, -1.995382196419728 },
+		{ 0.005037998464726997, 0.9949620015356441, -1.994860219865239 },
+		{ 0.005665948809850102, 0.9943340511901848, -1.994205275158309 },
+		{ 0.006444054258152906, 0.9935559457419827, -1.993389306642204 },
+		{ 0.007246631689859468, 0.9927533683104171, -1.992542551623466 },
+		{ 0.008048593274544517, 0.9919514067255844, -1.991691243155729 },
+		{ 0.009050077545775243, 0.9909499224543441, -1.990620822161416 },
+		{ 0.01005058310417049, 0.9899494168958332, -1.989543326160159 },
+		{ 0.01129979464378428, 0.988700205356285, -1.988186572943144 },
+		{ 0.01284661498535863, 0.9871533850147265, -1.986488993753036 },
+		{ 0.01444078196067245, 0.9855592180393282, -1.984719036280045 },
+		{ 0.01603237449491755, 0.9839676255051303, -1.982931214071721 },
+		{ 0.01801828332304482, 0.9819817166769933, -1.980671348808789 },
+		{ 0.02000015198760729, 0.9799998480123996, -1.978383771652818 },
+		{ 0.02247187193896442, 0.9775281280610931, -1.97548541000914 },
+		{ 0.02552816256447722, 0.9744718374355487, -1.971831680461528 },
+		{ 0.02867302773770862, 0.9713269722622919, -1.967991040448562 },
+		{ 0.03180774364185535, 0.9681922563581861, -1.964080640311271 },
+		{ 0.03571197122614239, 0.9642880287753891, -1.959095047860256 },
+		{ 0.03960036075431934, 0.9603996392463151, -1.954001915843372 },
+		{ 0.03180774364185535, 0.9681922563581861, -1.964080640311271 },
+		{ 0.03571197122614239, 0.9642880287753891, -1.959095047860256 },
+		{ 0.03960036075431934, 0.9603996392463151, -1.954001915843372 },
+		{ 0.04443888393394677, 0.9555611160679589, -1.947485135265313 },
+		{ 0.05040476234862693, 0.94959523765328, -1.939174583225083 },
+		{ 0.05652391295577023, 0.9434760870442314, -1.930332010613478 },
+		{ 0.06260363202447335, 0.9373963679768456, -1.921224213340504 },
+		{ 0.07014829326994576, 0.9298517067327351, -1.909471098825761 },
+		{ 0.07763253293679226, 0.9223674670644522, -1.897313989827179 },
+		{ 0.08690265464974707, 0.9130973453514021, -1.881560362939713 },
+		{ 0.0982685895361162, 0.9017314104646554, -1.861181046348584 },
+		{ 0.1098528731757094, 0.8901471268242941, -1.839186427175118 },
+		{ 0.1212883368623883, 0.8787116631384149, -1.816243992388378 },
+		{ 0.1353760864337844, 0.8646239135662198, -1.78627245754047 },
+		{ 0.1492379772903778, 0.8507620227100686, -1.754910024067354 },
+		{ 0.1662535107555218, 0.8337464892448325, -1.713827090630893 },
+		{ 0.1868807294746541, 0.8131192705258741, -1.660123918470171 },
+		{ 0.2076380926064609, 0.7923619073935461, -1.601670514652036 },
+		{ 0.2278655603843924, 0.7721344396158423, -1.540357690571506 },
+		{ 0.2524254880894425, 0.7475745119105662, -1.460013650684596 },
+		{ 0.2762042175762915, 0.7237957824240726, -1.375937061804025 },
+		{ 0.004271695656773346, 0.995728304343321, -1.995655158803373 },
+		{ 0.004804352638298498, 0.9951956473619583, -1.995103098182323 },
+		{ 0.005336757229044596, 0.994663242770956, -1.994549014599737 },
+		{ 0.006001829925064197, 0.9939981700752569, -1.993853649401502 },
+		{ 0.006825923309390174, 0.9931740766908648, -1.992987066975018 },
+		{ 0.007675897329933623, 0.9923241026700667, -1.992087519408595 },
+		{ 0.008525143929762899, 0.9914748560704251, -1.991182902834333 },
+		{ 0.00958565588309768, 0.9904143441169532, -1.9900450405969 },
+		{ 0.01064503348036745, 0.9893549665196336, -1.988899282836953 },
+		{ 0.01196767022032531, 0.9880323297796766, -1.987455994402967 },
+		{ 0.01360528566894614, 0.9863947143310596, -1.985649251176066 },
+		{ 0.01529287526004767, 0.9847071247399526, -1.983764465651186 },
+		{ 0.01697757761080473, 0.9830224223892035, -1.981859655685487 },
+		{ 0.01907942696748656, 0.980920573032614, -1.979450541276753 },
+		{ 0.02117675022293765, 0.9788232497770653, -1.977010372323061 },
+		{ 0.02379211531014814, 0.9762078846898554, -1.973916587098443 },
+		{ 0.02702546753975817, 0.972974532460253, -1.970013381127019 },
+		{ 0.03035187848637574, 0.9696481215136245, -1.965906983592711 },
+		{ 0.03366685383496548, 0.9663331461662921, -1.961722592845494 },
+		{ 0.0377949553590815, 0.9622050446462781, -1.956382594090897 },
+		{ 0.04190510840395665, 0.9580948915969693, -1.950922607005879 },
+		{ 0.03366685383496548, 0.9663331461662921, -1.961722592845494 },
+		{ 0.0377949553590815, 0.9622050446462781, -1.956382594090897 },
+		{ 0.04190510840395665, 0.9580948915969693, -1.950922607005879 },
+		{ 0.04701804112683459, 0.9529819588756806, -1.943929784902842 },
+		{ 0.05332043526568767, 0.9466795647363048, -1.935001645081576 },
+		{ 0.05978239737314523, 0.9402176026290892, -1.925490713458613 },
+		{ 0.06620025062283011, 0.9337997493796442, -1.915683929838771 },
+		{ 0.07416114907724916, 0.9258388509227515, -1.903014793289067 },
+		{ 0.08205417869760591, 0.9179458213042083, -1.889896394547758 },
+		{ 0.09182568325735468, 0.9081743167431304, -1.872878114190059 },
+		{ 0.1037980949926826, 0.896201905007884, -1.850837672677801 },
+		{ 0.1159911489979021, 0.8840088510023246, -1.827024652060433 },
+		{ 0.1280183134139537, 0.8719816865860999, -1.802163088738755 },
+		{ 0.1428224221220404, 0.8571775778779611, -1.769658010693557 },
+		{ 0.1573751934019432, 0.8426248065981354, -1.735621911030412 },
+		{ 0.1752194104090781, 0.8247805895918523, -1.691014744150961 },
+		{ 0.1968218826215657, 0.8031781173791415, -1.632687675193852 },
+		{ 0.2185283513499804, 0.78147164865045, -1.569199822561555 },
+		{ 0.239647938258562, 0.7603520617415391, -1.502628737008348 },
+		{ 0.2652465999832747, 0.7347534000167282, -1.415457082705361 },
+		{ 0.2899829706115911, 0.7100170293994521, -1.324342621948745 },
+		{ 0.004793540102701143, 0.9952064598975611, -1.995114327323801 },
+		{ 0.005391114709090213, 0.9946088852912047, -1.994492315164731 },
+		{ 0.005988330500073551, 0.9940116695002541, -1.993867799182514 },
+		{ 0.006734362234756579, 0.9932656377652453, -1.993083619719148 },
+		{ 0.007658653629350196, 0.9923413463706883, -1.9921058268993 },
+		{ 0.008611835687849128, 0.9913881643122345, -1.991090230275768 },
+		{ 0.009564134590150012, 0.9904358654098977, -1.990068222265821 },
+		{ 0.01075319767282865, 0.9892468023271861, -1.988781786091262 },
+		{ 0.01194083323147963, 0.9880591667685215, -1.98748542099126 },
+		{ 0.01342337283480475, 0.9865766271651994, -1.985851031380029 },
+		{ 0.01525865228328556, 0.9847413477167908, -1.983802918958107 },
+		{ 0.01714953982541065, 0.9828504601746755, -1.981663917651933 },
+		{ 0.01903679650984312, 0.9809632034902522, -1.979499764664712 },
+		{ 0.02139076408546618, 0.9786092359145629, -1.976759333979217 },
+		{ 0.02373908296469734, 0.9762609170353048, -1.973979882829423 },
+		{ 0.02666655873134723, 0.9733334412686607, -1.970450932900213 },
+		{ 0.03028444636307001, 0.9697155536369481, -1.965991145312454 },
+		{ 0.03400484648840463, 0.9659951535140333, -1.961290772022302 },
+		{ 0.03771119339833018, 0.9622888066018583, -1.956492376078495 },
+		{ 0.04232390070337487, 0.9576760992970362, -1.950358222025455 },
+		{ 0.04691449711336025, 0.953085502889207, -1.944073616836645 },
+		{ 0.03771119339833018, 0.9622888066018583, -1.956492376078495 },
+		{ 0.04232390070337487, 0.9576760992970362, -1.950358222025455 },
+		{ 0.04691449711336025, 0.953085502889207, -1.944073616836645 },
+		{ 0.05262188809948989, 0.9473781119033899, -1.936008098780643 },
+		{ 0.05965162194603586, 0.9403483780567193, -1.925686795591872 },
+		{ 0.06685366876048571, 0.9331463312411277, -1.914665181122123 },
+		{ 0.07400025268914177, 0.9259997473112286, -1.903276415136619 },
+		{ 0.0828564888360183, 0.917143511164787, -1.888531628652119 },
+		{ 0.09162832144687127, 0.9083716785535874, -1.873230427042003 },
+		{ 0.1024750068009224, 0.897524993199217, -1.853338340753976 },
+		{ 0.1157452172579077, 0.8842547827421543, -1.827518726349013 },
+		{ 0.129237639535364, 0.870762360465046, -1.799565654061793 },
+		{ 0.1425244679802553, 0.8574755320204597, -1.770333165268908 },
+		{ 0.1588480551954991, 0.8411519448052988, -1.732060636088142 },
+		{ 0.1748608936026178, 0.8251391063982615, -1.691942519545564 },
+		{ 0.1944488865830116, 0.8055511134172545, -1.639329644967373 },
+		{ 0.2180934791977429, 0.7819065208023745, -1.570520495077 },
+		{ 0.241773159727136, 0.7582268402734648, -1.495663893985977 },
+		{ 0.264735471371676, 0.7352645286284852, -1.417268046675904 },
+		{ 0.2924624796078046, 0.7075375204135785, -1.314832149494616 },
+		{ 0.3191454550939122, 0.6808545449077219, -1.20809127136704 },
+		{ 0.005379006593300037, 0.9946209934067776, -1.994504947013024 },
+		{ 0.006049352948047361, 0.9939506470523033, -1.9938038251775 },
+		{ 0.006719215002756533, 0.9932807849973068, -1.993099586207553 },
+		{ 0.007555932119379312, 0.9924440678807797, -1.992214835597787 },
+		{ 0.00859249941052031, 0.9914075005894813, -1.991110905825322 },
+		{ 0.009661365630948536, 0.9903386343690862, -1.989963459942139 },
+		{ 0.01072907947466966, 0.9892709205254852, -1.988807993479254 },
+		{ 0.01206207889411486, 0.987937921105885, -1.987352429277083 },
+		{ 0.01339328215525998, 0.9866067178448656, -1.985884382338201 },
+		{ 0.01505480436054125, 0.9849451956394931, -1.984031766119855 },
+		{ 0.0171111677749217, 0.9828888322250823, -1.981707616126922 },
+		{ 0.01922938927604276, 0.9807706107240263, -1.979277267980516 },
+		{ 0.02134301377619052, 0.9786569862238147, -1.976815377888588 },
+		{ 0.02397866404098213, 0.9760213359590177, -1.973693750252121 },
+		{ 0.02660721615759007, 0.9733927838424136, -1.970523175131998 },
+		{ 0.02988296158674888, 0.9701170384133195, -1.966491449145213 },
+		{ 0.0339296067171822, 0.9660703932836243, -1.961386981802345 },
+		{ 0.03808900914015727, 0.9619109908599796, -1.955996724753108 },
+		{ 0.04223050331532973, 0.9577694966846801, -1.950484218257796 },
+		{ 0.04738222705817339, 0.9526177729445925, -1.943423167777977 },
+		{ 0.05250655037757881, 0.9474934496231806, -1.936173869532924 },
+		{ 0.04223050331532973, 0.9577694966846801, -1.950484218257796 },
+		{ 0.04738222705817339, 0.9526177729445925, -1.943423167777977 },
+		{ 0.05250655037757881, 0.9474934496231806, -1.936173869532924 },
+		{ 0.05887305497682373, 0.9411269450265926, -1.926851075224001 },
+		{ 0.06670799522240956, 0.9332920047791766, -1.914892627673966 },
+		{ 0.07472724566304056, 0.9252727543372278, -1.902092471876096 },
+		{ 0.08267759122039423, 0.9173224087796253, -1.88883644405978 },
+		{ 0.09251967564270769, 0.907480324357625, -1.871636437174008 },
+		{ 0.1022561629226461, 0.8977438370788348, -1.853750398190039 },
+		{ 0.1142797834936975, 0.8857202165063025, -1.830450960082037 },
+		{ 0.1289657487704527, 0.8710342512299801, -1.800146075581593 },
+		{ 0.1438703300817191, 0.8561296699188, -1.767276605782113 },
+		{ 0.1585195983507837, 0.8414804016492542, -1.732856688975128 },
+		{ 0.1764794609044175, 0.8235205390962201, -1.68774362522255 },
+		{ 0.1940557392424182, 0.8059442607576286, -1.640424421493851 },
+		{ 0.2154996980720283, 0.7845003019279717, -1.578355950332716 },
+		{ 0.2412995814689663, 0.7587004185316003, -1.497220159159445 },
+		{ 0.267041748425058, 0.7329582515752612, -1.409073854822807 },
+		{ 0.2919111970904739, 0.7080888029166006, -1.316952640465122 },
+		{ 0.3218139216878558, 0.6781860783133293, -1.196972106492821 },
+		{ 0.3504538485519257, 0.6495461514481606, -1.072517239991206 },
+		{ 0.005697934629499153, 0.9943020653705209, -1.994171829202509 },
+		{ 0.006407897985145753, 0.9935921020148736, -1.993427330600575 },
+		{ 0.007117354404467873, 0.9928826455956832, -1.992679296730846 },
+		{ 0.008003438253075911, 0.9919965617469345, -1.991739314979557 },
+		{ 0.009101119100092528, 0.9908988809000681, -1.990566049471257 },
+		{ 0.01023289110985848, 0.9897671088902797, -1.989346114036466 },
+		{ 0.01136340279995649, 0.9886365972000836, -1.988117149403563 },
+		{ 0.01277473481370322, 0.9872252651863348, -1.986568311568434 },
+		{ 0.01418401981421487, 0.9858159801858351, -1.985005514051629 },
+		{ 0.01594282148228152, 0.9840571785177398, -1.983032358798316 },
+		{ 0.01811937569903859, 0.9818806243009751, -1.980555444668386 },
+		{ 0.02036110221759958, 0.9796388977824142, -1.977963661985535 },
+		{ 0.02259767867671927, 0.9774023213233605, -1.975336537903339 },
+		{ 0.02538627577784638, 0.974613724222229, -1.972003018272966 },
+		{ 0.02816688501345827, 0.9718331149865941, -1.968614727136015 },
+		{ 0.03163146940774782, 0.9683685305922943, -1.964302716498417 },
+		{ 0.03591043962235453, 0.9640895603776723, -1.958838181900579 },
+		{ 0.04030756714047978, 0.9596924328600643, -1.953061834897148 },
+		{ 0.04468463974803309, 0.9553153602535356, -1.94714881456053 },
+		{ 0.05012815072806782, 0.9498718492733542, -1.939566664578143 },
+		{ 0.05554033480091029, 0.9444596651992848, -1.931775216617113 }
+	},
+	.c_bpre4800080040 = {
+		{ 0.0003599709187077813, 0.9999820014540647, -1.999774676670639 },
+		{ 0.0004049668279871995, 0.9999797516586004, -1.99971735772897 },
+		{ 0.0004499626360502857, 0.9999775018681976, -1.999653560771195 },
+		{ 0.0005062156595894488, 0.9999746895555023, -1.999564702470767 },
+		{ 0.0005759503600308993, 0.9999712024819987, -1.999440468207364 },
+		{ 0.0006479429888238144, 0.9999676028505586, -1.99929590138495 },
+		{ 0.0007199353584600718, 0.9999640032320768, -1.999134754544961 },
+		{ 0.0008099254560797723, 0.999959503727196, -1.998910007485226 },
+		{ 0.0008999151487685276, 0.9999550042425613, -1.99865935936836 },
+		{ 0.00101240169520651, 0.9999493799152396, -1.998309631018189 },
+		{ 0.00115188413411016, 0.9999424057932942, -1.997819780940844 },
+		{ 0.00129586498613732, 0.9999352067506931, -1.997248895592837 },
+		{ 0.001439844801581978, 0.999928007759921, -1.996611760364314 },
+		{ 0.001619818113198847, 0.9999190090943402, -1.995722210568475 },
+		{ 0.001799789805177958, 0.999910010509741, -1.994729226302999 },
+		{ 0.002024752142561548, 0.9998987623928719, -1.99334262158537 },
+		{ 0.002303701926374191, 0.999884814903681, -1.991399065524897 },
+		{ 0.002591646008979945, 0.9998704176995511, -1.989132737434149 },
+		{ 0.002879585945502869, 0.9998560207027247, -1.986602506088068 },
+		{ 0.003239505035861777, 0.9998380247482073, -1.983069123540141 },
+		{ 0.00359941764818659, 0.9998200291175907, -1.979124665205974 },
+		{ 0.002879585945502869, 0.9998560207027247, -1.986602506088068 },
+		{ 0.003239505035861777, 0.9998380247482073, -1.983069123540141 },
+		{ 0.00359941764818659, 0.9998200291175907, -1.979124665205974 },
+		{ 0.004049299304058159, 0.9997975350347971, -1.973617282176004 },
+		{ 0.004607138500625572, 0.9997696430749686, -1.965900608253717 },
+		{ 0.005182956186506639, 0.9997408521906748, -1.956908211553338 },
+		{ 0.005758757290257835, 0.9997120621354871, -1.946877475516094 },
+		{ 0.006478485352071997, 0.9996760757323964, -1.932887098803703 },
+		{ 0.007198187505998055, 0.9996400906246999, -1.917294381524592 },
+		{ 0.0080977787668697, 0.9995951110616563, -1.89557010536794 },
+		{ 0.009213215714997001, 0.99953933921425, -1.865225913600167 },
+		{ 0.01036456922126219, 0.9994817715389368, -1.830008041217441 },
+		{ 0.01151585641623928, 0.999424207179188, -1.790907776077773 },
+		{ 0.01295487216551932, 0.999352256391724, -1.736700378364954 },
+		{ 0.01439378431684129, 0.999280310784158, -1.676737553727488 },
+		{ 0.01619227883270328, 0.9991903860583649, -1.593995785628167 },
+		{ 0.01842218726281002, 0.9990788906368593, -1.479989002785687 },
+		{ 0.02072376722777462, 0.9989638116386111, -1.349965844246231 },
+		{ 0.02302508208503236, 0.9988487458957483, -1.208502182512338 },
+		{ 0.02590135289540901, 0.9987049323552297, -1.01742358843336 },
+		{ 0.02877720958232656, 0.9985611395208835, -0.8128880488705263 },
+		{ 0.0004040548563145437, 0.9999797973089454, -1.999718585171967 },
+		{ 0.0004545635011716284, 0.999977271980809, -1.999646677103983 },
+		{ 0.0005050727723461689, 0.99997474665905, -1.999566607401146 },
+		{ 0.0005681986040558751, 0.9999715900976296, -1.999455046562658 },
+		{ 0.0006464824100833218, 0.9999676759883961, -1.999299003739977 },
+		{ 0.0007272928263477207, 0.999963635580864, -1.999117362455186 },
+		{ 0.0008081015496520695, 0.9999595950260391, -1.998914825264178 },
+		{ 0.0009091090851909124, 0.999954544641798, -1.998632298972788 },
+		{ 0.001010117665392489, 0.9999494941194477, -1.998317134853919 },
+		{ 0.00113638106565365, 0.9999431810023817, -1.997877303029206 },
+		{ 0.001292944205883544, 0.9999353528580196, -1.997261140681166 },
+		{ 0.001454553598135542, 0.9999272723204859, -1.996542942320158 },
+		{ 0.001616163804652782, 0.999919191848252, -1.995741305683054 },
+		{ 0.001818176893491146, 0.999909091186176, -1.994621958024647 },
+		{ 0.00202018431390756, 0.9998989907897393, -1.99337238320772 },
+		{ 0.002272692993216774, 0.9998863653967678, -1.991627379877577 },
+		{ 0.002585799243626071, 0.9998707100588956, -1.98918138554073 },
+		{ 0.002909001409951852, 0.9998545499302874, -1.986329175869578 },
+		{ 0.003232199412693112, 0.9998383900628629, -1.98314494157025 },
+		{ 0.003636218745357014, 0.9998181903095741, -1.978698496806435 },
+		{ 0.004040181248202913, 0.999797991455156, -1.973735391917183 },
+		{ 0.003232199412693112, 0.9998383900628629, -1.98314494157025 },
+		{ 0.003636218745357014, 0.9998181903095741, -1.978698496806435 },
+		{ 0.004040181248202913, 0.999797991455156, -1.973735391917183 },
+		{ 0.004545170130150069, 0.9997727430520091, -1.966806699395746 },
+		{ 0.005171307699567516, 0.999741436179351, -1.957100948573524 },
+		{ 0.005817579705464471, 0.9997091210162975, -1.945794494764949 },
+		{ 0.006463883821208399, 0.9996768068977846, -1.933187347098545 },
+		{ 0.007271738237755872, 0.9996364153095629, -1.915612112312922 },
+		{ 0.008079546345273943, 0.999596023717764, -1.896035413339421 },
+		{ 0.00908923150278112, 0.9995455393852414, -1.868784037505333 },
+		{ 0.01034119597629633, 0.9994829408493512, -1.830762301518353 },
+		{ 0.01163346719924029, 0.9994183266431786, -1.786697969324062 },
+		{ 0.01292568137550575, 0.9993537166141615, -1.737858402905473 },
+		{ 0.01454077652058615, 0.9992729611778963, -1.670295483747285 },
+		{ 0.01615576234836174, 0.9991922122672892, -1.595759802456632 },
+		{ 0.01817433276403723, 0.9990912836701737, -1.493260932911722 },
+		{ 0.02067706099662939, 0.9989661474143128, -1.352722752143665 },
+		{ 0.0232601675205653, 0.9988369916302513, -1.193452912136608 },
+		{ 0.02584295331959977, 0.9987078525446702, -1.021446542884322 },
+		{ 0.02907098133213487, 0.9985464509412417, -0.7913409210269862 },
+		{ 0.03229849825477762, 0.9983850754219957, -0.548062169791063 },
+		{ 0.0004280814727634833, 0.9999785960019963, -1.999685396104728 },
+		{ 0.0004815913860342611, 0.9999759206367215, -1.99960484557337 },
+		{ 0.0005350977123757505, 0.9999732451149836, -1.999515129198531 },
+		{ 0.0006019874205991226, 0.9999699008864983, -1.999390107930775 },
+		{ 0.0006849250132058151, 0.9999657539539929, -1.999215201383949 },
+		{ 0.0007705360234658756, 0.9999614731988953, -1.999011568884837 },
+		{ 0.0008561537828800881, 0.9999571924621234, -1.998784491390396 },
+		{ 0.0009631670203228341, 0.9999518416896416, -1.998467686919606 },
+		{ 0.001070181108269049, 0.9999464909457915, -1.998114261663522 },
+		{ 0.001203949720335304, 0.9999398025153384, -1.997620989151649 },
+		{ 0.001369821748016015, 0.9999315089171638, -1.996929899034883 },
+		{ 0.001541042360627947, 0.9999229478821053, -1.996124306136216 },
+		{ 0.001712261729676578, 0.9999143869203432, -1.99522507617636 },
+		{ 0.001926287656164234, 0.9999036856985055, -1.993969412279075 },
+		{ 0.002140304952168915, 0.9998929847548015, -1.992567620766334 },
+		{ 0.002407826965931395, 0.9998796086544139, -1.990610011260134 },
+		{ 0.002739549675468866, 0.9998630225253557, -1.987866003811073 },
+		{ 0.003081965980688695, 0.9998459017012391, -1.984666349761049 },
+		{ 0.0034243905143373, 0.9998287814974788, -1.98109440254788 },
+		{ 0.003852487003460697, 0.9998073800190838, -1.97610648427529 },
+		{ 0.00428040243175574, 0.9997859806346864, -1.970539664199966 },
+		{ 0.0034243905143373, 0.9998287814974788, -1.98109440254788 },
+		{ 0.003852487003460697, 0.9998073800190838, -1.97610648427529 },
+		{ 0.00428040243175574, 0.9997859806346864, -1.970539664199966 },
+		{ 0.00481539205527336, 0.9997592324572451, -1.962769200588452 },
+		{ 0.005478743383396808, 0.9997260644678598, -1.951885432130258 },
+		{ 0.006163480771306745, 0.9996918278030612, -1.939208972312558 },
+		{ 0.006848194709681473, 0.9996575923107331, -1.925077468264887 },
+		{ 0.007704024488875933, 0.9996147987762403, -1.905382871892993 },
+		{ 0.008559888774496748, 0.9995720070736617, -1.883454605585992 },
+		{ 0.009629583168998335, 0.9995185212480414, -1.852943482581711 },
+		{ 0.01095596273348909, 0.9994522023410451, -1.810403495287652 },
+		{ 0.01232502502426115, 0.9993837489409875, -1.761146536603933 },
+		{ 0.01369399632535796, 0.9993153002293662, -1.70660670088199 },
+		{ 0.01540508137807923, 0.9992297459324639, -1.631254277295424 },
+		{ 0.01711602216257133, 0.9991441989601142, -1.548258873257762 },
+		{ 0.01925452989829402, 0.9990372743178714, -1.434362474404255 },
+		{ 0.02190588452261026, 0.998904706398819, -1.278658369248598 },
+		{ 0.02464245473880039, 0.9987678776473425, -1.102869540399949 },
+		{ 0.02737861637457866, 0.998631069272508, -0.9138757038124511 },
+		{ 0.03079829692957065, 0.9984600851562562, -0.6625308270281016 },
+		{ 0.03421753283119394, 0.998289133582542, -0.3988219744993046 },
+		{ 0.0004805050298573803, 0.9999759749587874, -1.999606572226021 },
+		{ 0.0005405673468839754, 0.9999729718692207, -1.999505451060651 },
+		{ 0.0006006294835326495, 0.9999699687886728, -1.999392788747002 },
+		{ 0.0006757026551419541, 0.9999662148688611, -1.9992357285457 },
+		{ 0.0007687990101493399, 0.9999615600802234, -1.999015934875017 },
+		{ 0.0008648958240754355, 0.9999567552759572, -1.998759980832475 },
+		{ 0.000960994145049706, 0.9999519503311609, -1.998474483547209 },
+		{ 0.001081114127908703, 0.9999459443053459, -1.998076093601158 },
+		{ 0.001201233706265463, 0.9999399383156045, -1.997631573377789 },
+		{ 0.001351382481582801, 0.9999324308791573, -1.9970110685551 },
+		{ 0.001537568467707883, 0.9999231216380747, -1.996141587722393 },
+		{ 0.00172975621465057, 0.9999135122584101, -1.995127932160582 },
+		{ 0.00192194211463787, 0.9999039029710927, -1.993996360723552 },
+		{ 0.002162169815431582, 0.9998918915327101, -1.99241618720431 },
+		{ 0.00240239526438706, 0.9998798802386157, -1.990652026316289 },
+		{ 0.002702673651431226, 0.9998648663239005, -1.988188346159939 },
+		{ 0.003075013294524002, 0.9998462493500314, -1.984735027219092 },
+		{ 0.003459386647223994, 0.9998270326513348, -1.980708586225912 },
+		{ 0.003843699536351091, 0.9998078151768245, -1.976213680582106 },
+		{ 0.004324105114715458, 0.9997837950800389, -1.969938570316213 },
+		{ 0.004804530844941095, 0.9997597755603292, -1.962935929922787 },
+		{ 0.003843699536351091, 0.9998078151768245, -1.976213680582106 },
+		{ 0.004324105114715458, 0.9997837950800389, -1.969938570316213 },
+		{ 0.004804530844941095, 0.9997597755603292, -1.962935929922787 },
+		{ 0.005405016042593713, 0.999729751563233, -1.953163392227821 },
+		{ 0.006149585546880503, 0.9996925229936223, -1.939480884849989 },
+		{ 0.00691815499903514, 0.9996540935846934, -1.923551720854633 },
+		{ 0.00768666037197667, 0.9996156672886553, -1.905804880099845 },
+		{ 0.008647275336636241, 0.9995676369046452, -1.881090379274586 },
+		{ 0.009607863821397115, 0.9995196071929797, -1.853596928705247 },
+		{ 0.01080851184123944, 0.9994595745253216, -1.815386631854521 },
+		{ 0.01229722316732168, 0.999385138894114, -1.762199813238234 },
+		{ 0.01383383788081914, 0.999308308455749, -1.700744403910595 },
+		{ 0.01537036650894683, 0.9992314822889434, -1.632860892900521 },
+		{ 0.01729083157703147, 0.9991354591123049, -1.539364048810274 },
+		{ 0.01921111209412615, 0.9990394451632085, -1.43678232726486 },
+		{ 0.02161118248733801, 0.998919441110337, -1.296709422765997 },
+		{ 0.02458688525040957, 0.9987706558424077, -1.106577819612393 },
+		{ 0.02765813656445033, 0.9986170937147072, -0.8939124376496563 },
+		{ 0.03072886632770732, 0.9984635568310913, -0.6677740005200434 },
+		{ 0.03456695264706629, 0.9982716721892295, -0.3713807341426328 },
+		{ 0.03840377086160552, 0.9980798129920113, -0.06626411958124775 },
+		{ 0.0005393465286912327, 0.9999730327359353, -1.999507615180677 },
+		{ 0.000606768867362569, 0.9999696618381563, -1.99938062321804 },
+		{ 0.000674178704535489, 0.9999662911153596, -1.999239098032174 },
+		{ 0.0007584504518691873, 0.999962077605128, -1.999041741606747 },
+		{ 0.0008629441925939485, 0.9999568527920167, -1.998765469194585 },
+		{ 0.0009708109375714517, 0.9999514594810158, -1.998443655910417 },
+		{ 0.001078678512694529, 0.999946066199104, -1.998084637693308 },
+		{ 0.001213504793403251, 0.9999393247603313, -1.997583565689144 },
+		{ 0.001348334683250399, 0.9999325833670082, -1.997024388868957 },
+		{ 0.00151687086113411, 0.9999241564847517, -1.99624371343638 },
+		{ 0.001725851151559775, 0.9999137074457147, -1.995149695258397 },
+		{ 0.001941574751488512, 0.9999029213182133, -1.993874126883009 },
+		{ 0.002157290668922532, 0.9998921354706697, -1.99245010970846 },
+		{ 0.002426935957109859, 0.999878653202147, -1.990461452382025 },
+		{ 0.00269657775065154, 0.9998651711154161, -1.988241214643809 },
+		{ 0.003033626677460299, 0.9998483187217421, -1.985140650443612 },
+		{ 0.003451572909359442, 0.999827422010642, -1.980794819178975 },
+		{ 0.003882961017458944, 0.9998058520606974, -1.975728191160321 },
+		{ 0.00431434864271283, 0.9997842825760958, -1.970073168649486 },
+		{ 0.004853609641533598, 0.9997573217836794, -1.96217968954901 },
+		{ 0.005392810822530561, 0.9997303600824994, -1.953372672774855 },
+		{ 0.00431434864271283, 0.9997842825760958, -1.970073168649486 },
+		{ 0.004853609641533598, 0.9997573217836794, -1.96217968954901 },
+		{ 0.005392810822530561, 0.9997303600824994, -1.953372672774855 },
+		{ 0.006066860369376662, 0.9996966597963945, -1.941086511990143 },
+		{ 0.006902550153202714, 0.9996548738044464, -1.92389327110079 },
+		{ 0.007765168166046332, 0.999611741814817, -1.903890180322062 },
+		{ 0.008627766605244069, 0.9995686116861983, -1.881619723307976 },
+		{ 0.00970598908523668, 0.9995147008246232, -1.850633495752709 },
+		{ 0.0107841675280138, 0.9994607928706833, -1.816204075246747 },
+		{ 0.01213173513382018, 0.9993934132433222, -1.768424744695373 },
+		{ 0.01380264026635549, 0.9993098683561004, -1.70205693655542 },
+		{ 0.01552732144198111, 0.9992236343740524, -1.625574321010249 },
+		{ 0.01725181129280895, 0.9991374094682743, -1.541355538462134 },
+		{ 0.01940726786198554, 0.999029637164536, -1.42581490018609 },
+		{ 0.02156243841923999, 0.998921878120177, -1.299677595419436 },
+		{ 0.02425611131777515, 0.9987871944341374, -1.128539171064326 },
+		{ 0.02759578304006819, 0.9986202113598982, -0.8983756097420392 },
+		{ 0.03104254333084349, 0.9984478731253963, -0.6440468770504572 },
+		{ 0.03448893647756474, 0.9982755597321242, -0.3774966373698755 },
+		{ 0.03879570363249705, 0.9980602159331041, -0.03488839268243363 },
+		{ 0.04310162990182968, 0.9978449185871419, 0.3086825751745327 },
+		{ 0.0005714151369485633, 0.999971429259213, -1.999449020713854 },
+		{ 0.0006428416440116036, 0.9999678579331058, -1.999306691761858 },
+		{ 0.0007142700282837055, 0.9999642866197528, -1.999148042433064 },
+		{ 0.000803547797125026, 0.9999598226187117, -1.998926788749302 },
+		{ 0.0009142604124888275, 0.9999542871083903, -1.998617017779409 },
+		{ 0.001028536480886939, 0.9999485732870348, -1.998256156155992 },
+		{ 0.001142813948150686, 0.9999428593347134, -1.997853527914739 },
+		{ 0.001285662625767593, 0.9999357168993236, -1.997291531856849 },
+		{ 0.001428507231732949, 0.9999285746785641, -1.996664337437914 },
+		{ 0.00160706330980498, 0.9999196468516451, -1.995788661540507 },
+		{ 0.001828470816221373, 0.9999085764700585, -1.994561428831704 },
+		{ 0.002057019120792454, 0.9998971490551689, -1.993130497356987 },
+		{ 0.00228556259513827, 0.9998857219344829, -1.991533000325126 },
+		{ 0.002571242605160085, 0.9998714379309644, -1.989302029417512 },
+		{ 0.002856914949909822, 0.9998571542951037, -1.986811297007649 },
+		{ 0.003213997487002453, 0.9998393001599192, -1.983333087803712 },
+		{ 0.003656774467182173, 0.9998171612983786, -1.978458140398417 },
+		{ 0.00411382856890576, 0.9997943090158362, -1.972774967406788 },
+		{ 0.004570880552454798, 0.9997714572556161, -1.966432342927127 },
+		{ 0.005142182068108916, 0.9997428920629698, -1.957579580949121 },
+		{ 0.005713416766548677, 0.9997143293222586, -1.947704940002618 }
+	},
+	.c_bpre9600080040 = {
+		{ 0.0001799862692379033, 0.9999910006865385, -1.999939168585815 },
+		{ 0.0002024844389986781, 0.9999898757780502, -1.999924275887734 },
+		{ 0.0002249825834467239, 0.9999887508708273, -1.999907763501322 },
+		{ 0.0002531094313804791, 0.9999873446976728, -1.999884844651344 },
+		{ 0.0002879772532829525, 0.9999856011373356, -1.999852912211811 },
+		{ 0.0003239741183900358, 0.9999838012940804, -1.999815867517096 },
+		{ 0.0003599709187077813, 0.9999820014540647, -1.999774676670639 },
+		{ 0.0004049668279871995, 0.9999797516586004, -1.99971735772897 },
+		{ 0.0004499626360502857, 0.9999775018681976, -1.999653560771195 },
+		{ 0.0005062072537473199, 0.9999746896373124, -1.999564705202879 },
+		{ 0.0005759503600308993, 0.9999712024819987, -1.999440468207364 },
+		{ 0.0006479429888238144, 0.9999676028505586, -1.99929590138495 },
+		{ 0.0007199353584600718, 0.9999640032320768, -1.999134754544961 },
+		{ 0.0008099254560797723, 0.999959503727196, -1.998910007485226 },
+		{ 0.0008999151487685276, 0.9999550042425613, -1.99865935936836 },
+		{ 0.00101240169520651, 0.9999493799152396, -1.998309631018189 },
+		{ 0.00115188413411016, 0.9999424057932942, -1.997819780940844 },
+		{ 0.00129586498613732, 0.9999352067506931, -1.997248895592837 },
+		{ 0.001439844801581978, 0.999928007759921, -1.996611760364314 },
+		{ 0.001619818113198847, 0.9999190090943402, -1.995722210568475 },
+		{ 0.001799789805177958, 0.999910010509741, -1.994729226302999 },
+		{ 0.001439844801581978, 0.999928007759921, -1.996611760364314 },
+		{ 0.001619818113198847, 0.9999190090943402, -1.995722210568475 },
+		{ 0.001799789805177958, 0.999910010509741, -1.994729226302999 },
+		{ 0.002024752142561548, 0.9998987623928719, -1.99334262158537 },
+		{ 0.002303701926374191, 0.999884814903681, -1.991399065524897 },
+		{ 0.002591646008979945, 0.9998704176995511, -1.989132737434149 },
+		{ 0.002879585945502869, 0.9998560207027247, -1.986602506088068 },
+		{ 0.003239505035861777, 0.9998380247482073, -1.983069123540141 },
+		{ 0.00359941764818659, 0.9998200291175907, -1.979124665205974 },
+		{ 0.004049299304058159, 0.9997975350347971, -1.973617282176004 },
+		{ 0.004607138500625572, 0.9997696430749686, -1.965900608253717 },
+		{ 0.005182956186506639, 0.9997408521906748, -1.956908211553338 },
+		{ 0.005758757290257835, 0.9997120621354871, -1.946877475516094 },
+		{ 0.006478485352071997, 0.9996760757323964, -1.932887098803703 },
+		{ 0.007198187505998055, 0.9996400906246999, -1.917294381524592 },
+		{ 0.0080977787668697, 0.9995951110616563, -1.89557010536794 },
+		{ 0.009213215714997001, 0.99953933921425, -1.865225913600167 },
+		{ 0.01036456922126219, 0.9994817715389368, -1.830008041217441 },
+		{ 0.01151585641623928, 0.999424207179188, -1.790907776077773 },
+		{ 0.01295487216551932, 0.999352256391724, -1.736700378364954 },
+		{ 0.01439378431684129, 0.999280310784158, -1.676737553727488 },
+		{ 0.0002020284485491571, 0.9999898986034534, -1.99992459417321 },
+		{ 0.0002272830420237624, 0.9999886359258333, -1.999905985029211 },
+		{ 0.0002525379805288575, 0.9999873732498077, -1.99988533518819 },
+		{ 0.0002841013198674264, 0.9999857949479232, -1.999856653977612 },
+		{ 0.0003232438171958309, 0.9999838378635907, -1.999816661463546 },
+		{ 0.0003636497191834662, 0.9999818176251325, -1.999770236228533 },
+		{ 0.0004040548563145437, 0.9999797973089454, -1.999718585171967 },
+		{ 0.0004545597081983589, 0.9999772720626194, -1.999646679565717 },
+		{ 0.0005050652099651876, 0.9999747467408602, -1.99956661012728 },
+		{ 0.0005681986040558751, 0.9999715900976296, -1.999455046562658 },
+		{ 0.0006464825514292319, 0.9999676759065862, -1.999299000273605 },
+		{ 0.0007272900228476999, 0.9999636354990543, -1.999117358565871 },
+		{ 0.0008080982278907826, 0.9999595951078482, -1.998914829576402 },
+		{ 0.0009091091087194153, 0.9999545445599893, -1.998632294132004 },
+		{ 0.001010117665392489, 0.9999494941194477, -1.998317134853919 },
+		{ 0.001136378780512138, 0.9999431810841892, -1.997877309058948 },
+		{ 0.001292941414243058, 0.9999353529398266, -1.997261147529674 },
+		{ 0.001454553598135542, 0.9999272723204859, -1.996542942320158 },
+		{ 0.001616165006075819, 0.9999191917664461, -1.995741297145098 },
+		{ 0.001818192017675328, 0.9999090910225659, -1.994621938838337 },
+		{ 0.002020192653293099, 0.9998989906261313, -1.993372361912327 },
+		{ 0.001616165006075819, 0.9999191917664461, -1.995741297145098 },
+		{ 0.001818192017675328, 0.9999090910225659, -1.994621938838337 },
+		{ 0.002020192653293099, 0.9998989906261313, -1.993372361912327 },
+		{ 0.002272714194943299, 0.9998863650695557, -1.991627332018038 },
+		{ 0.002585821010525359, 0.9998707097316888, -1.989181331154883 },
+		{ 0.002909001409951852, 0.9998545499302874, -1.986329175869578 },
+		{ 0.003232203088139012, 0.9998383903900593, -1.983145009401197 },
+		{ 0.003636199665562319, 0.9998181911275486, -1.978698687335314 },
+		{ 0.004040181248202913, 0.999797991455156, -1.973735391917183 },
+		{ 0.004545132205963061, 0.9997727438699464, -1.966806936873544 },
+		{ 0.005171266537251831, 0.9997414369972621, -1.957101218213698 },
+		{ 0.005817579705464471, 0.9997091210162975, -1.945794494764949 },
+		{ 0.006463885231962107, 0.9996768060799256, -1.93318701161995 },
+		{ 0.007271710204511689, 0.9996364144917373, -1.915611736132079 },
+		{ 0.008079513136726554, 0.9995960245355566, -1.896035829828676 },
+		{ 0.009089231734645915, 0.9995455385674903, -1.868783571250684 },
+		{ 0.01034120400962718, 0.9994829400316508, -1.83076177462354 },
+		{ 0.01163346719924029, 0.9994183266431786, -1.786697969324062 },
+		{ 0.01292565347205853, 0.9993537174317561, -1.737859050630892 },
+		{ 0.01454077652058615, 0.9992729611778963, -1.670295483747285 },
+		{ 0.01615577435216413, 0.9991922114498268, -1.595759013596344 },
+		{ 0.0002140418817224206, 0.999989297943731, -1.999915996233891 },
+		{ 0.0002407971425879096, 0.9999879602458827, -1.999895188769939 },
+		{ 0.0002675506457664295, 0.9999866224680127, -1.999872089443367 },
+		{ 0.0003009959752444396, 0.999984950330003, -1.999839995747363 },
+		{ 0.0003424654386543167, 0.999982876830395, -1.999795228278334 },
+		{ 0.0003852717225886733, 0.9999807364139048, -1.999743243947266 },
+		{ 0.0004280814727634833, 0.9999785960019963, -1.999685396104728 },
+		{ 0.0004815893083658165, 0.9999759205549109, -1.999604842970141 },
+		{ 0.0005350977123757505, 0.9999732451149836, -1.999515129198531 },
+		{ 0.0006019839197882585, 0.9999699008046884, -1.999390104697317 },
+		{ 0.0006849226019935833, 0.9999657538721831, -1.999215197716376 },
+		{ 0.0007705360234658756, 0.9999614731988953, -1.999011568884837 },
+		{ 0.0008561491896146907, 0.9999571925439324, -1.998784495954072 },
+		{ 0.0009631670203228341, 0.9999518416896416, -1.998467686919606 },
+		{ 0.001070181108269049, 0.9999464909457915, -1.998114261663522 },
+		{ 0.001203949720335304, 0.9999398025153384, -1.997620989151649 },
+		{ 0.001369821748016015, 0.9999315089171638, -1.996929899034883 },
+		{ 0.001541042360627947, 0.9999229478821053, -1.996124306136216 },
+		{ 0.00171226855332445, 0.9999143870839539, -1.995225094256315 },
+		{ 0.001926336268914154, 0.9999036853712879, -1.993969371648631 },
+		{ 0.002140315739257915, 0.9998929845911944, -1.992567598217461 },
+		{ 0.00171226855332445, 0.9999143870839539, -1.995225094256315 },
+		{ 0.001926336268914154, 0.9999036853712879, -1.993969371648631 },
+		{ 0.002140315739257915, 0.9998929845911944, -1.992567598217461 },
+		{ 0.002407840968847496, 0.999879608981624, -1.990610061937231 },
+		{ 0.002739559320203516, 0.9998630228525605, -1.987866061398457 },
+		{ 0.003081977848928538, 0.9998459020284381, -1.984666414470842 },
+		{ 0.0034243905143373, 0.9998287814974788, -1.98109440254788 },
+		{ 0.003852383265850455, 0.9998073808370493, -1.976106685996817 },
+		{ 0.00428040243175574, 0.9997859806346864, -1.970539664199966 },
+		{ 0.004815371279017329, 0.9997592316393189, -1.962768949210551 },
+		{ 0.005478731778636677, 0.9997260636499606, -1.951885146758174 },
+		{ 0.006163462218498013, 0.9996918269851901, -1.939208652062085 },
+		{ 0.006848170598617235, 0.9996575914928905, -1.925077113377608 },
+		{ 0.007704024488875933, 0.9996147987762403, -1.905382871892993 },
+		{ 0.008559842853881698, 0.9995720078914345, -1.883455045839285 },
+		{ 0.009629583168998335, 0.9995185212480414, -1.852943482581711 },
+		{ 0.0109559430768004, 0.9994522031587202, -1.810404051483756 },
+		{ 0.01232502502426115, 0.9993837489409875, -1.761146536603933 },
+		{ 0.01369399632535796, 0.9993153002293662, -1.70660670088199 },
+		{ 0.01540508137807923, 0.9992297459324639, -1.631254277295424 },
+		{ 0.01711609038540378, 0.9991442005949602, -1.548260530013976 },
+		{ 0.0002402539579671924, 0.9999879874072427, -1.999895634037066 },
+		{ 0.0002702854997804297, 0.9999864858432942, -1.999869601435869 },
+		{ 0.0003003169965073356, 0.9999849842816004, -1.999840682982081 },
+		{ 0.0003378541812032705, 0.9999831072917489, -1.999800475829839 },
+		{ 0.0003844031992191376, 0.9999807798554048, -1.999744357308182 },
+		{ 0.0004324525874096772, 0.9999783774042103, -1.99967915817539 },
+		{ 0.0004805028445858338, 0.9999759748769773, -1.99960656962848 },
+		{ 0.0005405643691911385, 0.9999729717874107, -1.999505448148697 },
+		{ 0.0006006258719117831, 0.9999699687068629, -1.999392785520653 },
+		{ 0.0006757026551419541, 0.9999662148688611, -1.9992357285457 },
+		{ 0.0007687990101493399, 0.9999615600802234, -1.999015934875017 },
+		{ 0.0008648968084733558, 0.9999567551941484, -1.998759976223037 },
+		{ 0.000960994145049706, 0.9999519503311609, -1.998474483547209 },
+		{ 0.001081114127908703, 0.9999459443053459, -1.998076093601158 },
+		{ 0.001201233706265463, 0.9999399383156045, -1.997631573377789 },
+		{ 0.001351382481582801, 0.9999324308791573, -1.9970110685551 },
+		{ 0.001537565749972588, 0.9999231217198806, -1.996141595849649 },
+		{ 0.001729768125203926, 0.9999135125856309, -1.995127968685951 },
+		{ 0.00192194211463787, 0.9999039029710927, -1.993996360723552 },
+		{ 0.002162169431589636, 0.999891891696317, -1.992416209981253 },
+		{ 0.002402409710511933, 0.9998798805658257, -1.990652076880157 },
+		{ 0.00192194211463787, 0.9999039029710927, -1.993996360723552 },
+		{ 0.002162169431589636, 0.999891891696317, -1.992416209981253 },
+		{ 0.002402409710511933, 0.9998798805658257, -1.990652076880157 },
+		{ 0.00270269063310742, 0.9998648666511055, -1.98818840297962 },
+		{ 0.003075029166802802, 0.9998462496772303, -1.984735091784376 },
+		{ 0.003459376680532096, 0.9998270318333533, -1.980708404861918 },
+		{ 0.003843699536351091, 0.9998078151768245, -1.976213680582106 },
+		{ 0.004324105114715458, 0.9997837950800389, -1.969938570316213 },
+		{ 0.004804508992908217, 0.9997597747424025, -1.962935679103057 },
+		{ 0.005404986267375458, 0.999729750745331, -1.953163110625183 },
+		{ 0.00614955700986948, 0.9996925221757506, -1.939480565305435 },
+		{ 0.006918115447832571, 0.9996540944025336, -1.923552079266276 },
+		{ 0.00768666037197667, 0.9996156672886553, -1.905804880099845 },
+		{ 0.008647285175545007, 0.9995676360868759, -1.881089934713519 },
+		{ 0.009607863821397115, 0.9995196071929797, -1.853596928705247 },
+		{ 0.01080851184123944, 0.9994595745253216, -1.815386631854521 },
+		{ 0.01229722316732168, 0.999385138894114, -1.762199813238234 },
+		{ 0.01383385266733604, 0.9993083076381919, -1.70074371530537 },
+		{ 0.01537033934657654, 0.9992314831064377, -1.632861648568635 },
+		{ 0.01729095066176932, 0.9991354623819679, -1.539367390574534 },
+		{ 0.01921111209412615, 0.9990394451632085, -1.43678232726486 },
+		{ 0.0002696750824575389, 0.9999865162770624, -1.999870157718951 },
+		{ 0.0003033867347471211, 0.999984830804026, -1.999837564610218 },
+		{ 0.0003370921930432182, 0.9999831454156414, -1.999801337349165 },
+		{ 0.0003792288212825789, 0.9999810386227971, -1.999750939205286 },
+		{ 0.0004314767505996307, 0.999978426163293, -1.999680554869029 },
+		{ 0.0004854113593870477, 0.9999757294459781, -1.999598738447941 },
+		{ 0.0005393465286912327, 0.9999730327359353, -1.999507615180677 },
+		{ 0.0006067616006885998, 0.9999696619199661, -1.999380626476514 },
+		{ 0.000674178704535489, 0.9999662911153596, -1.999239098032174 },
+		{ 0.0007584498117093002, 0.9999620775233189, -1.999041737554357 },
+		{ 0.0008629441925939485, 0.9999568527920167, -1.998765469194585 },
+		{ 0.0009708109375714517, 0.9999514594810158, -1.998443655910417 },
+		{ 0.001078674422920264, 0.9999460662809119, -1.998084643421218 },
+		{ 0.001213504793403251, 0.9999393247603313, -1.997583565689144 },
+		{ 0.0013483343254617, 0.9999325832852012, -1.997024381730834 },
+		{ 0.00151687086113411, 0.9999241564847517, -1.99624371343638 },
+		{ 0.001725860919292228, 0.9999137072821044, -1.995149677036442 },
+		{ 0.001941574751488512, 0.9999029213182133, -1.993874126883009 },
+		{ 0.002157290668922532, 0.9998921354706697, -1.99245010970846 },
+		{ 0.002426952071802799, 0.9998786535293566, -1.990461503457444 },
+		{ 0.002696587200413316, 0.9998651709518135, -1.988241186297376 },
+		{ 0.002157290668922532, 0.9998921354706697, -1.99245010970846 },
+		{ 0.002426952071802799, 0.9998786535293566, -1.990461503457444 },
+		{ 0.002696587200413316, 0.9998651709518135, -1.988241186297376 },
+		{ 0.003033660259918326, 0.9998483183945426, -1.98514058673848 },
+		{ 0.003451572909359442, 0.999827422010642, -1.980794819178975 },
+		{ 0.003882961017458944, 0.9998058520606974, -1.975728191160321 },
+		{ 0.00431434864271283, 0.9997842825760958, -1.970073168649486 },
+		{ 0.00485358347408988, 0.9997573209657549, -1.962179436207806 },
+		{ 0.005392810822530561, 0.9997303600824994, -1.953372672774855 },
+		{ 0.006066787714740484, 0.9996966606142695, -1.94108682733119 },
+		{ 0.006902511249071625, 0.9996548746222872, -1.923893628726545 },
+		{ 0.007765168166046332, 0.999611741814817, -1.903890180322062 },
+		{ 0.008627766605244069, 0.9995686116861983, -1.881619723307976 },
+		{ 0.00970598908523668, 0.9995147008246232, -1.850633495752709 },
+		{ 0.01078412664418958, 0.9994607936883653, -1.816204623286904 },
+		{ 0.01213173513382018, 0.9993934132433222, -1.768424744695373 },
+		{ 0.01380265434994024, 0.9993098675385422, -1.702056249339721 },
+		{ 0.01552729908971751, 0.9992236351915401, -1.625575083372316 },
+		{ 0.01725190891956686, 0.9991374078334393, -1.541353870721555 },
+		{ 0.01940726786198554, 0.999029637164536, -1.42581490018609 },
+		{ 0.02156243841923999, 0.998921878120177, -1.299677595419436 },
+		{ 0.0002857096092226997, 0.9999857145275692, -1.999855107193774 },
+		{ 0.0003214234048328191, 0.9999839288374116, -1.999818629135333 },
+		{ 0.0003571382028178816, 0.999982143150443, -1.999778069870258 },
+		{ 0.0004017779341954361, 0.9999799111075741, -1.999721633369143 },
+		{ 0.0004571354305495622, 0.9999771432929805, -1.999642794192389 },
+		{ 0.00051427485240039, 0.9999742863129205, -1.999551131824868 },
+		{ 0.0005714151369485633, 0.999971429259213, -1.999449020713854 },
+		{ 0.0006428416440116036, 0.9999678579331058, -1.999306691761858 },
+		{ 0.0007142663702805582, 0.999964286701562, -1.999148046254223 },
+		{ 0.000803547797125026, 0.9999598226187117, -1.998926788749302 },
+		{ 0.0009142563047238777, 0.9999542871901987, -1.998617022647134 },
+		{ 0.001028536007560149, 0.9999485732052266, -1.998256150690374 },
+		{ 0.001142813948150686, 0.9999428593347134, -1.997853527914739 },
+		{ 0.001285662625767593, 0.9999357168993236, -1.997291531856849 },
+		{ 0.001428508490853678, 0.9999285745967577, -1.996664329880665 },
+		{ 0.00160706330980498, 0.9999196468516451, -1.995788661540507 },
+		{ 0.001828470816221373, 0.9999085764700585, -1.994561428831704 },
+		{ 0.002057020067514197, 0.9998971492187767, -1.993130519036774 },
+		{ 0.002285570871343191, 0.9998857220980886, -1.991533024389042 },
+		{ 0.00257125631728005, 0.999871437767361, -1.989302002376231 },
+		{ 0.002856912431873664, 0.9998571544587052, -1.986811327022618 }
+	}
+};
@@ -0,0 +1,1647 @@
+#include "Scales.hpp"
+Scale seventeen = {
+	.name = "17 TET",
+	.description = "17 notes per octave, Equal temperament. Scales are arranged consecutively from 13.75Hz to 20kHz",
+	.scalename = {
+		"13.75Hz; A-1-",
+		"27.5Hz; A0-",
+		"55Hz; A1-",
+		"110Hz; A2-",
+		"220Hz; A3-",
+		"440Hz; A4-",
+		"880Hz; A5-",
+		"1760Hz; A6-",
+		"3520Hz; A7-",
+		"7040Hz; A8-",
+		"14080Hz; A9-"},
+	.notedesc = {
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		""},
+	.c_maxq48000 = {
+		0.001799870791119152,
+		0.001874774233132042,
+		0.001952794857585505,
+		0.002034062389177188,
+		0.002118711951229139,
+		0.002206884290357009,
+		0.002298726010489113,
+		0.002394389816624402,
+		0.002494034768734693,
+		0.002597826546233282,
+		0.002705937723449696,
+		0.002818548056568595,
+		0.002935844782509935,
+		0.00305802293024733,
+		0.003185285645082233,
+		0.003317844526413127,
+		0.003455919979561317,
+		0.003599741582238305,
+		0.003749548466264084,
+		0.003905589715171011,
+		0.004068124778354378,
+		0.003599741582238305,
+		0.003749548466264083,
+		0.003905589715171009,
+		0.004068124778354377,
+		0.004237423902458277,
+		0.004413768580714019,
+		0.004597452020978226,
+		0.004788779633248804,
+		0.004988069537469385,
+		0.005195653092466564,
+		0.005411875446899392,
+		0.005637096113137189,
+		0.005871689565019871,
+		0.00611604586049466,
+		0.006370571290164466,
+		0.006635689052826253,
+		0.006911839959122633,
+		0.007199483164476611,
+		0.007499096932528169,
+		0.007811179430342021,
+		0.008136249556708755,
+		0.00719948316447661,
+		0.007499096932528167,
+		0.007811179430342019,
+		0.008136249556708754,
+		0.008474847804916554,
+		0.008827537161428037,
+		0.009194904041956452,
+		0.009577559266497608,
+		0.009976139074938771,
+		0.01039130618493313,
+		0.01082375089379878,
+		0.01127419222627438,
+		0.01174337913003974,
+		0.01223209172098932,
+		0.01274114258032893,
+		0.01327137810565251,
+		0.01382367991824527,
+		0.01439896632895322,
+		0.01499819386505634,
+		0.01562235886068404,
+		0.01627249911341751,
+		0.01439896632895322,
+		0.01499819386505633,
+		0.01562235886068404,
+		0.01627249911341751,
+		0.01694969560983311,
+		0.01765507432285607,
+		0.0183898080839129,
+		0.01915511853299522,
+		0.01995227814987754,
+		0.02078261236986625,
+		0.02164750178759757,
+		0.02254838445254876,
+		0.02348675826007948,
+		0.02446418344197864,
+		0.02548228516065786,
+		0.02654275621130501,
+		0.02764735983649053,
+		0.02879793265790644,
+		0.02999638773011267,
+		0.03124471772136809,
+		0.03254499822683502,
+		0.02879793265790644,
+		0.02999638773011267,
+		0.03124471772136807,
+		0.03254499822683501,
+		0.03389939121966622,
+		0.03531014864571215,
+		0.03677961616782581,
+		0.03831023706599043,
+		0.03990455629975508,
+		0.04156522473973251,
+		0.04329500357519513,
+		0.04509676890509751,
+		0.04697351652015896,
+		0.04892836688395728,
+		0.05096457032131572,
+		0.05308551242261002,
+		0.05529471967298107,
+		0.05759586531581289,
+		0.05999277546022535,
+		0.06248943544273617,
+		0.06508999645367004,
+		0.05759586531581288,
+		0.05999277546022534,
+		0.06248943544273615,
+		0.06508999645367003,
+		0.06779878243933243,
+		0.0706202972914243,
+		0.07355923233565162,
+		0.07662047413198086,
+		0.07980911259951017,
+		0.08313044947946502,
+		0.08659000715039027,
+		0.09019353781019503,
+		0.09394703304031793,
+		0.09785673376791457,
+		0.1019291406426314,
+		0.10617102484522,
+		0.1105894393459621,
+		0.1151917306316258,
+		0.1199855509204507,
+		0.1249788708854723,
+		0.1301799929073401,
+		0.1151917306316258,
+		0.1199855509204507,
+		0.1249788708854723,
+		0.1301799929073401,
+		0.1355975648786649,
+		0.1412405945828486,
+		0.1471184646713032,
+		0.1532409482639617,
+		0.1596182251990203,
+		0.16626089895893,
+		0.1731800143007805,
+		0.1803870756203901,
+		0.1878940660806359,
+		0.1957134675358291,
+		0.2038582812852629,
+		0.2123420496904401,
+		0.2211788786919243,
+		0.2303834612632515,
+		0.2399711018409014,
+		0.2499577417709447,
+		0.2603599858146802,
+		0.2303834612632515,
+		0.2399711018409013,
+		0.2499577417709446,
+		0.2603599858146801,
+		0.2711951297573297,
+		0.2824811891656972,
+		0.2942369293426065,
+		0.3064818965279235,
+		0.3192364503980407,
+		0.3325217979178601,
+		0.3463600286015611,
+		0.3607741512407801,
+		0.3757881321612717,
+		0.3914269350716583,
+		0.4077165625705258,
+		0.4246840993808802,
+		0.4423577573838485,
+		0.4607669225265031,
+		0.4799422036818028,
+		0.4999154835418894,
+		0.5207199716293603,
+		0.460766922526503,
+		0.4799422036818027,
+		0.4999154835418892,
+		0.5207199716293602,
+		0.5423902595146595,
+		0.5649623783313944,
+		0.588473858685213,
+		0.6129637930558469,
+		0.6384729007960813,
+		0.6650435958357201,
+		0.6927200572031221,
+		0.7215483024815602,
+		0.7515762643225434,
+		0.7828538701433165,
+		0.8154331251410516,
+		0.8493681987617604,
+		0.8847155147676971,
+		0.9215338450530062,
+		0.9598844073636056,
+		0.9998309670837787,
+		1.041439943258721,
+		0.9215338450530061,
+		0.9598844073636054,
+		0.9998309670837784,
+		1.04143994325872,
+		1.084780519029319,
+		1.129924756662789,
+		1.176947717370426,
+		1.225927586111694,
+		1.276945801592163,
+		1.33008719167144,
+		1.385440114406244,
+		1.44309660496312,
+		1.503152528645087,
+		1.565707740286633,
+		1.630866250282103,
+		1.698736397523521,
+		1.769431029535394,
+		1.843067690106012,
+		1.919768814727211,
+		1.999661934167557,
+		2.082879886517441,
+		1.843067690106012,
+		1.919768814727211,
+		1.999661934167557,
+		2.082879886517441,
+		2.169561038058638,
+		2.259849513325578,
+		2.353895434740852,
+		2.451855172223388,
+		2.553891603184325,
+		2.553891603184325,
+		2.553891603184325,
+		2.553891603184325,
+		2.553891603184325,
+		2.553891603184325,
+		2.553891603184325,
+		2.553891603184325,
+		2.553891603184325,
+		2.553891603184325,
+		2.553891603184325,
+		2.553891603184325,
+		2.553891603184325
+	},
+	.c_maxq96000 = {
+		0.0008999353955595762,
+		0.0009373871165660209,
+		0.0009763974287927523,
+		0.001017031194588594,
+		0.001059355975614569,
+		0.001103442145178505,
+		0.001149363005244557,
+		0.001197194908312201,
+		0.001247017384367346,
+		0.001298913273116641,
+		0.001352968861724848,
+		0.001409274028284297,
+		0.001467922391254968,
+		0.001529011465123665,
+		0.001592642822541116,
+		0.001658922263206563,
+		0.001727959989780658,
+		0.001799870791119153,
+		0.001874774233132042,
+		0.001952794857585505,
+		0.002034062389177189,
+		0.001799870791119152,
+		0.001874774233132042,
+		0.001952794857585505,
+		0.002034062389177188,
+		0.002118711951229139,
+		0.002206884290357009,
+		0.002298726010489113,
+		0.002394389816624402,
+		0.002494034768734693,
+		0.002597826546233282,
+		0.002705937723449696,
+		0.002818548056568595,
+		0.002935844782509935,
+		0.00305802293024733,
+		0.003185285645082233,
+		0.003317844526413127,
+		0.003455919979561317,
+		0.003599741582238305,
+		0.003749548466264084,
+		0.003905589715171011,
+		0.004068124778354378,
+		0.003599741582238305,
+		0.003749548466264083,
+		0.003905589715171009,
+		0.004068124778354377,
+		0.004237423902458277,
+		0.004413768580714019,
+		0.004597452020978226,
+		0.004788779633248804,
+		0.004988069537469385,
+		0.005195653092466564,
+		0.005411875446899392,
+		0.005637096113137189,
+		0.005871689565019871,
+		0.00611604586049466,
+		0.006370571290164466,
+		0.006635689052826253,
+		0.006911839959122633,
+		0.007199483164476611,
+		0.007499096932528169,
+		0.007811179430342021,
+		0.008136249556708755,
+		0.00719948316447661,
+		0.007499096932528167,
+		0.007811179430342019,
+		0.008136249556708754,
+		0.008474847804916554,
+		0.008827537161428037,
+		0.009194904041956452,
+		0.009577559266497608,
+		0.009976139074938771,
+		0.01039130618493313,
+		0.01082375089379878,
+		0.01127419222627438,
+		0.01174337913003974,
+		0.01223209172098932,
+		0.01274114258032893,
+		0.01327137810565251,
+		0.01382367991824527,
+		0.01439896632895322,
+		0.01499819386505634,
+		0.01562235886068404,
+		0.01627249911341751,
+		0.01439896632895322,
+		0.01499819386505633,
+		0.01562235886068404,
+		0.01627249911341751,
+		0.01694969560983311,
+		0.01765507432285607,
+		0.0183898080839129,
+		0.01915511853299522,
+		0.01995227814987754,
+		0.02078261236986625,
+		0.02164750178759757,
+		0.02254838445254876,
+		0.02348675826007948,
+		0.02446418344197864,
+		0.02548228516065786,
+		0.02654275621130501,
+		0.02764735983649053,
+		0.02879793265790644,
+		0.02999638773011267,
+		0.03124471772136809,
+		0.03254499822683502,
+		0.02879793265790644,
+		0.02999638773011267,
+		0.03124471772136807,
+		0.03254499822683501,
+		0.03389939121966622,
+		0.03531014864571215,
+		0.03677961616782581,
+		0.03831023706599043,
+		0.03990455629975508,
+		0.04156522473973251,
+		0.04329500357519513,
+		0.04509676890509751,
+		0.04697351652015896,
+		0.04892836688395728,
+		0.05096457032131572,
+		0.05308551242261002,
+		0.05529471967298107,
+		0.05759586531581289,
+		0.05999277546022535,
+		0.06248943544273617,
+		0.06508999645367004,
+		0.05759586531581288,
+		0.05999277546022534,
+		0.06248943544273615,
+		0.06508999645367003,
+		0.06779878243933243,
+		0.0706202972914243,
+		0.07355923233565162,
+		0.07662047413198086,
+		0.07980911259951017,
+		0.08313044947946502,
+		0.08659000715039027,
+		0.09019353781019503,
+		0.09394703304031793,
+		0.09785673376791457,
+		0.1019291406426314,
+		0.10617102484522,
+		0.1105894393459621,
+		0.1151917306316258,
+		0.1199855509204507,
+		0.1249788708854723,
+		0.1301799929073401,
+		0.1151917306316258,
+		0.1199855509204507,
+		0.1249788708854723,
+		0.1301799929073401,
+		0.1355975648786649,
+		0.1412405945828486,
+		0.1471184646713032,
+		0.1532409482639617,
+		0.1596182251990203,
+		0.16626089895893,
+		0.1731800143007805,
+		0.1803870756203901,
+		0.1878940660806359,
+		0.1957134675358291,
+		0.2038582812852629,
+		0.2123420496904401,
+		0.2211788786919243,
+		0.2303834612632515,
+		0.2399711018409014,
+		0.2499577417709447,
+		0.2603599858146802,
+		0.2303834612632515,
+		0.2399711018409013,
+		0.2499577417709446,
+		0.2603599858146801,
+		0.2711951297573297,
+		0.2824811891656972,
+		0.2942369293426065,
+		0.3064818965279235,
+		0.3192364503980407,
+		0.3325217979178601,
+		0.3463600286015611,
+		0.3607741512407801,
+		0.3757881321612717,
+		0.3914269350716583,
+		0.4077165625705258,
+		0.4246840993808802,
+		0.4423577573838485,
+		0.4607669225265031,
+		0.4799422036818028,
+		0.4999154835418894,
+		0.5207199716293603,
+		0.460766922526503,
+		0.4799422036818027,
+		0.4999154835418892,
+		0.5207199716293602,
+		0.5423902595146595,
+		0.5649623783313944,
+		0.588473858685213,
+		0.6129637930558469,
+		0.6384729007960813,
+		0.6650435958357201,
+		0.6927200572031221,
+		0.7215483024815602,
+		0.7515762643225434,
+		0.7828538701433165,
+		0.8154331251410516,
+		0.8493681987617604,
+		0.8847155147676971,
+		0.9215338450530062,
+		0.9598844073636056,
+		0.9998309670837787,
+		1.041439943258721,
+		0.9215338450530061,
+		0.9598844073636054,
+		0.9998309670837784,
+		1.04143994325872,
+		1.084780519029319,
+		1.129924756662789,
+		1.176947717370426,
+		1.225927586111694,
+		1.276945801592163,
+		1.276945801592163,
+		1.276945801592163,
+		1.276945801592163,
+		1.276945801592163,
+		1.276945801592163,
+		1.276945801592163,
+		1.276945801592163,
+		1.276945801592163,
+		1.276945801592163,
+		1.276945801592163,
+		1.276945801592163,
+		1.276945801592163
+	},
+	.c_bpre4800022 = {
+		{ 0.0008995305751479957, 0.9991004694248521, -1.999097231347892 },
+		{ 0.000936946589178597, 0.9990630534108362, -1.999059540289903 },
+		{ 0.0009759239280101074, 0.9990240760720649, -1.999020264502717 },
+		{ 0.001016514715266994, 0.9989834852847351, -1.998979349974981 },
+		{ 0.001058797211058034, 0.9989412027889769, -1.99893671620849 },
+		{ 0.001102836577993728, 0.9988971634220717, -1.998892295744862 },
+		{ 0.001148704495614554, 0.9988512955044067, -1.998846014384273 },
+		{ 0.001196479157793343, 0.998803520842209, -1.998797791166358 },
+		{ 0.00124623873267244, 0.9987537612673409, -1.998747544951529 },
+		{ 0.001298067897692951, 0.998701932102336, -1.998695187805886 },
+		{ 0.001352051300155678, 0.9986479486998878, -1.998640631584689 },
+		{ 0.001408280091134744, 0.9985917199088761, -1.998583781310357 },
+		{ 0.001466845386468042, 0.9985331546135322, -1.998524541758208 },
+		{ 0.001527844799466663, 0.9984721552005483, -1.998462810826886 },
+		{ 0.001591375902098215, 0.9984086240979039, -1.998398486126478 },
+		{ 0.00165754929100008, 0.9983424507090248, -1.998331451719774 },
+		{ 0.001726468979129127, 0.9982735310208759, -1.998261597945224 },
+		{ 0.001798251995040575, 0.9982017480049598, -1.998188801530481 },
+		{ 0.001873015309446514, 0.998126984690583, -1.998112938799321 },
+		{ 0.001950888896142439, 0.9980491111038586, -1.998033872379065 },
+		{ 0.002031996128367665, 0.9979680038716366, -1.99795147105265 },
+		{ 0.001798251995040575, 0.9982017480049598, -1.998188801530481 },
+		{ 0.001873015309446515, 0.998126984690583, -1.998112938799321 },
+		{ 0.001950888896142439, 0.9980491111038586, -1.998033872379065 },
+		{ 0.002031996128367666, 0.9979680038716366, -1.99795147105265 },
+		{ 0.00211646683939791, 0.9978835331606207, -1.997865596465287 },
+		{ 0.002204450376783931, 0.9977955496232174, -1.997776089784016 },
+		{ 0.002296082939243565, 0.9977039170607881, -1.997682804854216 },
+		{ 0.002391526753212004, 0.9976084732467931, -1.997585568278887 },
+		{ 0.002490924354366275, 0.9975090756456609, -1.997484225905423 },
+		{ 0.002594457343080303, 0.9974055426569352, -1.997378582878603 },
+		{ 0.002702281084807908, 0.9972977189151958, -1.99726847013939 },
+		{ 0.002814576929453697, 0.9971854230705678, -1.997153691083297 },
+		{ 0.00293153913754799, 0.9970684608624524, -1.997034034764247 },
+		{ 0.003053348764197754, 0.9969466512358285, -1.996909302519921 },
+		{ 0.003180219326934557, 0.9968197806730698, -1.996779261131095 },
+		{ 0.003312344589002135, 0.9966876554110075, -1.996643696180762 },
+		{ 0.003449957263122795, 0.9965500427368876, -1.996502351745247 },
+		{ 0.003593270279843707, 0.9964067297201568, -1.996354990509996 },
+		{ 0.003742528952977893, 0.9962574710470257, -1.996201340050508 },
+		{ 0.003897971824799342, 0.9961020281752024, -1.996041132908309 },
+		{ 0.004059863248469488, 0.9959401367515391, -1.995874072869844 },
+		{ 0.003593270279843708, 0.9964067297201568, -1.996354990509996 },
+		{ 0.003742528952977894, 0.9962574710470257, -1.996201340050508 },
+		{ 0.003897971824799342, 0.9961020281752024, -1.996041132908309 },
+		{ 0.004059863248469489, 0.9959401367515391, -1.995874072869844 },
+		{ 0.004228460764194265, 0.9957715392358137, -1.995699868399449 },
+		{ 0.004404041152104466, 0.995595958847898, -1.995518205571611 },
+		{ 0.004586900396523728, 0.9954130996034766, -1.995328747822349 },
+		{ 0.004777334106212604, 0.9952226658937975, -1.995131155971336 },
+		{ 0.00497565051695906, 0.9950243494830419, -1.994925074522673 },
+		{ 0.005182176966163581, 0.9948178230338428, -1.994710124628603 },
+		{ 0.005397259846554576, 0.9946027401534527, -1.994485903768676 },
+		{ 0.005621238523768734, 0.9943787614762329, -1.994252012612664 },
+		{ 0.005854484353380799, 0.9941455156466195, -1.994008013985576 },
+		{ 0.006097381094744865, 0.9939026189052553, -1.993753452846373 },
+		{ 0.006350324858901704, 0.9936496751411069, -1.993487855926646 },
+		{ 0.006613730554805089, 0.9933862694452953, -1.993210724498435 },
+		{ 0.006887999321392209, 0.9931120006786986, -1.992921568201773 },
+		{ 0.007173628968382154, 0.9928263710316179, -1.992619788024624 },
+		{ 0.007471064375417557, 0.9925289356248421, -1.992304833364674 },
+		{ 0.00778074946525167, 0.9922192505347522, -1.991976146984428 },
+		{ 0.00810325699151584, 0.9918967430087761, -1.991633026329162 },
+		{ 0.007173628968382158, 0.9928263710316179, -1.992619788024624 },
+		{ 0.007471064375417557, 0.9925289356248421, -1.992304833364674 },
+		{ 0.007780749465251671, 0.9922192505347522, -1.991976146984428 },
+		{ 0.008103256991515843, 0.9918967430087761, -1.991633026329162 },
+		{ 0.008439028668510392, 0.9915609713315646, -1.991274898835128 },
+		{ 0.008788699700768043, 0.9912113002993399, -1.990900975667367 },
+		{ 0.009152774108130134, 0.9908472258920404, -1.990510596974171 },
+		{ 0.0095318193612253, 0.9904681806391537, -1.990103023568315 },
+		{ 0.009926530975925789, 0.9900734690241816, -1.989677365526276 },
+		{ 0.01033747306560615, 0.989662526935098, -1.989232860397162 },
+		{ 0.01076540222852019, 0.9892345977717061, -1.988768522539147 },
+		{ 0.01121087872499539, 0.9887891212750074, -1.988283562840984 },
+		{ 0.01167471959443971, 0.9883252804059874, -1.987776895506818 },
+		{ 0.01215760999538567, 0.9878423900050715, -1.987247558963848 },
+		{ 0.01266029724375205, 0.9873397027565198, -1.986694503390106 },
+		{ 0.01318371967775932, 0.9868162803224406, -1.986116445661256 },
+		{ 0.01372855410813354, 0.9862714458920473, -1.985512366580672 },
+		{ 0.01429579698418818, 0.9857042030158116, -1.98488086689542 },
+		{ 0.01488631194793535, 0.9851136880525818, -1.984220665243689 },
+		{ 0.01550095886826282, 0.9844990411317455, -1.983530454311394 },
+		{ 0.01614078681561511, 0.9838592131848509, -1.982808680971217 },
+		{ 0.01429579698418819, 0.9857042030158116, -1.98488086689542 },
+		{ 0.01488631194793535, 0.9851136880525818, -1.984220665243689 },
+		{ 0.01550095886826282, 0.9844990411317455, -1.983530454311394 },
+		{ 0.01614078681561511, 0.9838592131848509, -1.982808680971217 },
+		{ 0.01680684013215305, 0.9831931598679958, -1.982053759609596 },
+		{ 0.0175001581591071, 0.9824998418411081, -1.981264070240801 },
+		{ 0.01822177494238871, 0.9817782250579523, -1.98043795655464 },
+		{ 0.01897284734965794, 0.981027152650556, -1.979573575712098 },
+		{ 0.01975452593463602, 0.9802454740655775, -1.978669041617926 },
+		{ 0.02056814688411143, 0.979431853115897, -1.9777221980495 },
+		{ 0.02141484652354152, 0.9785851534767955, -1.976731061595853 },
+		{ 0.02229607364820514, 0.9777039263518009, -1.975693219823106 },
+		{ 0.0232130761799521, 0.9767869238201261, -1.974606426336418 },
+		{ 0.02416734864102299, 0.9758326513590272, -1.973468068594102 },
+		{ 0.02516037516394745, 0.9748396248362265, -1.972275463341662 },
+		{ 0.02619356515535091, 0.9738064348448978, -1.971025930012044 },
+		{ 0.02726869868338374, 0.9727313013168727, -1.969716244194001 },
+		{ 0.02838722415696336, 0.9716127758430366, -1.968343480294637 },
+		{ 0.02955095809570377, 0.9704490419042983, -1.966904151806321 },
+		{ 0.03076163801069006, 0.9692383619893261, -1.965394746424608 },
+		{ 0.03202111198536121, 0.9679788880146419, -1.963811483145857 },
+		{ 0.02838722415696337, 0.9716127758430366, -1.968343480294637 },
+		{ 0.02955095809570378, 0.9704490419042983, -1.966904151806321 },
+		{ 0.03076163801069007, 0.9692383619893261, -1.965394746424608 },
+		{ 0.03202111198536122, 0.9679788880146419, -1.963811483145857 },
+		{ 0.03333127365731364, 0.9666687263428921, -1.962150381202561 },
+		{ 0.03469399760317399, 0.9653060023969304, -1.960407331835349 },
+		{ 0.03611145371571874, 0.963888546284299, -1.958577682501845 },
+		{ 0.03758566277255563, 0.9624143372275261, -1.95665679076443 },
+		{ 0.03911887346354807, 0.9608811265365238, -1.954639523894589 },
+		{ 0.04071324510197728, 0.9592867548980401, -1.952520655958879 },
+		{ 0.04237116007146376, 0.9576288399285402, -1.950294439242548 },
+		{ 0.0440950323962841, 0.9559049676037278, -1.947954835844621 },
+		{ 0.04588730545416957, 0.9541126945459848, -1.945495503192185 },
+		{ 0.04775063654170923, 0.9522493634583886, -1.942909517926148 },
+		{ 0.04968764365141843, 0.9503123563486313, -1.940189698637297 },
+		{ 0.05170108952069895, 0.9482989104793094, -1.937328326680328 },
+		{ 0.05379375350933564, 0.9462062464906683, -1.934317298479534 },
+		{ 0.05596861381858929, 0.9440313861814109, -1.931147834504842 },
+		{ 0.0582286570670332, 0.941771342932971, -1.927810719377508 },
+		{ 0.06057699764827985, 0.9394230023517521, -1.924296094954655 },
+		{ 0.06301687235794362, 0.9369831276420629, -1.920593427320807 },
+		{ 0.05596861381858907, 0.9440313861814109, -1.931147834504842 },
+		{ 0.0582286570670332, 0.941771342932971, -1.927810719377508 },
+		{ 0.06057699764827986, 0.9394230023517521, -1.924296094954655 },
+		{ 0.0630168723579432, 0.9369831276420629, -1.920593427320807 },
+		{ 0.06555157351101504, 0.9344484264893895, -1.916691566792619 },
+		{ 0.06818444371167574, 0.9318155562891636, -1.912578716953224 },
+		{ 0.07091874872783806, 0.9290812512745028, -1.908242596787696 },
+		{ 0.07375840101861356, 0.9262415989905504, -1.903669238785097 },
+		{ 0.07670721895327545, 0.9232927810515522, -1.898844087518889 },
+		{ 0.07976892187722157, 0.9202310781228121, -1.893751973596757 },
+		{ 0.0829471249808124, 0.9170528750209334, -1.888377087794027 },
+		{ 0.08624593213738026, 0.9137540678691967, -1.882701917784639 },
+		{ 0.08966872779053919, 0.9103312722179383, -1.876709254935716 },
+		{ 0.09322114979328594, 0.9067788502069059, -1.870376903235397 },
+		{ 0.09690630715851639, 0.9030936928435681, -1.863686008997014 },
+		{ 0.1007289409595295, 0.8992710590448268, -1.856613646306116 },
+		{ 0.1046936219081004, 0.8953063780932825, -1.849135894605458 },
+		{ 0.108804741904404, 0.891195258095596, -1.84122780449662 },
+		{ 0.1130665054363244, 0.8869334945683867, -1.832863365506763 },
+		{ 0.1174846536976151, 0.8825153463055724, -1.824011968816291 },
+		{ 0.1220623886741331, 0.8779376113294015, -1.814646414294974 },
+		{ 0.108804741904404, 0.891195258095596, -1.84122780449662 },
+		{ 0.1130665054363244, 0.8869334945683867, -1.832863365506763 },
+		{ 0.1174846536976152, 0.8825153463055724, -1.824011968816291 },
+		{ 0.1220623886741329, 0.8779376113294015, -1.814646414294974 },
+		{ 0.1268061382322884, 0.8731938617684958, -1.804731184334108 },
+		{ 0.1317197690591421, 0.8682802309424833, -1.794234105991737 },
+		{ 0.1368080285347321, 0.8631919714697956, -1.783119232143488 },
+		{ 0.1420770618089881, 0.8579229381911376, -1.771345348039089 },
+		{ 0.1475309983999238, 0.8524690016020705, -1.758873373132283 },
+		{ 0.1531747628569917, 0.8468252371430733, -1.745660103276102 },
+		{ 0.1590140244192004, 0.8409859755841593, -1.731657982621227 },
+		{ 0.1650529569815036, 0.8349470430188874, -1.716820306614263 },
+		{ 0.1712975172067573, 0.8287024827932459, -1.701093164217308 },
+		{ 0.1777521168178093, 0.8222478831825584, -1.684423421754474 },
+		{ 0.1844223157443595, 0.8155776842593123, -1.666751833611736 },
+		{ 0.1913120916504563, 0.8086879083504329, -1.648020003678405 },
+		{ 0.1984264893481252, 0.8015735106545115, -1.628163287543272 },
+		{ 0.2057710119479239, 0.7942289880520762, -1.607112005154733 },
+		{ 0.2133494910747775, 0.7866505089255681, -1.58479743435177 },
+		{ 0.2211661537908476, 0.7788338462102381, -1.561145967728438 },
+		{ 0.2292260550844565, 0.7707739449162427, -1.536077436434516 },
+		{ 0.2057710119479237, 0.7942289880520762, -1.607112005154733 },
+		{ 0.2133494910747776, 0.7866505089255681, -1.58479743435177 },
+		{ 0.2211661537908474, 0.7788338462102381, -1.561145967728438 },
+		{ 0.2292260550844563, 0.7707739449162427, -1.536077436434516 },
+		{ 0.2375324797713032, 0.7624675202301793, -1.509513014389912 },
+		{ 0.2460889471233131, 0.753911052879001, -1.481369181177151 },
+		{ 0.2549001080570635, 0.7450998919430143, -1.451554428495523 },
+		{ 0.2639682321257222, 0.7360317678745144, -1.41998100894763 },
+		{ 0.2732961256824122, 0.7267038743188488, -1.386555445657577 },
+		{ 0.2828870177376995, 0.7171129822624225, -1.351178671864113 },
+		{ 0.2927421259718872, 0.7072578740282851, -1.313755191211295 },
+		{ 0.3028634353547456, 0.6971365646459843, -1.274183250566904 },
+		{ 0.3132521950123157, 0.6867478049876903, -1.232360705255298 },
+		{ 0.3239084186024848, 0.676091581398198, -1.188187787429394 },
+		{ 0.3348326055873214, 0.6651673944126816, -1.141560756718462 },
+		{ 0.3460238668894467, 0.6539761331121982, -1.092380428661221 },
+		{ 0.357480327545395, 0.6425196724547184, -1.040551831391004 },
+		{ 0.3692003145377752, 0.630799685462225, -0.9859800463694947 },
+		{ 0.3811809768077802, 0.6188190231928554, -0.9285777772985855 },
+		{ 0.3934182370052536, 0.6065817629956674, -0.8682676166858876 },
+		{ 0.4059075258395327, 0.5940924741617473, -0.8049806216386769 },
+		{ 0.369200314537775, 0.630799685462225, -0.9859800463694947 },
+		{ 0.3811809768077802, 0.6188190231928554, -0.9285777772985855 },
+		{ 0.3934182370052536, 0.6065817629956674, -0.8682676166858876 },
+		{ 0.4059075258395327, 0.5940924741617473, -0.8049806216386769 },
+		{ 0.4186429000972142, 0.581357099903166, -0.7386631192807608 },
+		{ 0.4316184963518462, 0.5683815036481779, -0.6692719485521235 },
+		{ 0.4448261510266505, 0.5551738489734913, -0.5967901785796024 },
+		{ 0.4582572366799468, 0.5417427633204831, -0.5212212408356107 },
+		{ 0.4719018246898338, 0.5280981753104647, -0.4425976003987792 },
+		{ 0.4857482975298472, 0.5142517024827693, -0.3609879477207224 },
+		{ 0.4997869544141209, 0.5002130455972356, -0.2764809359651593 },
+		{ 0.5139993379663381, 0.4860006621114971, -0.1892554157347474 },
+		{ 0.5283762176926744, 0.4716237823619693, -0.09947790573747185 },
+		{ 0.5428995752425775, 0.4571004247801815, -0.007419520559819773 },
+		{ 0.5575523374102497, 0.4424476625897558, 0.08659554259106524 },
+		{ 0.5723152173225803, 0.4276847826803836, 0.1821620151328361 },
+		{ 0.5871695513506595, 0.4128304487023168, 0.2788030678429608 },
+		{ 0.6020917568207583, 0.3979082431792417, 0.3759252339653893 },
+		{ 0.6170640191175952, 0.3829359809399938, 0.472878554857637 },
+		{ 0.6320585648027305, 0.367941435198932, 0.5688452782835196 },
+		{ 0.6470532081551925, 0.3529467918669572, 0.6629319566391624 },
+		{ 0.6020917568207582, 0.3979082431792417, 0.3759252339653893 },
+		{ 0.617064019117595, 0.3829359809399938, 0.472878554857637 },
+		{ 0.6320585648027306, 0.367941435198932, 0.5688452782835196 },
+		{ 0.6470532081551927, 0.3529467918669572, 0.6629319566391624 },
+		{ 0.6620234799972453, 0.3379765200177605, 0.7541100093510735 },
+		{ 0.6769428892018348, 0.3230571108083177, 0.8412113986213084 },
+		{ 0.6917811905303122, 0.308218809497941, 0.9229167753147318 },
+		{ 0.7065147783906723, 0.2934852216101129, 0.99781210354276 },
+		{ 0.7212608851831207, 0.2788876827662423, 1.056196350620929 },
+		{ 0.7212608851831207, 0.2788876827662423, 1.056196350620929 },
+		{ 0.7212608851831207, 0.2788876827662423, 1.056196350620929 },
+		{ 0.7212608851831207, 0.2788876827662423, 1.056196350620929 },
+		{ 0.7212608851831207, 0.2788876827662423, 1.056196350620929 },
+		{ 0.7212608851831207, 0.2788876827662423, 1.056196350620929 },
+		{ 0.7212608851831207, 0.2788876827662423, 1.056196350620929 },
+		{ 0.7212608851831207, 0.2788876827662423, 1.056196350620929 },
+		{ 0.7212608851831207, 0.2788876827662423, 1.056196350620929 },
+		{ 0.7212608851831207, 0.2788876827662423, 1.056196350620929 },
+		{ 0.7212608851831207, 0.2788876827662423, 1.056196350620929 },
+		{ 0.7212608851831207, 0.2788876827662423, 1.056196350620929 },
+		{ 0.7212608851831207, 0.2788876827662423, 1.056196350620929 }
+	},
+	.c_bpre9600022 = {
+		{ 0.000449866477498041, 0.9995501335225021, -1.99954932382101 },
+		{ 0.0004685830796407516, 0.9995314169203667, -1.999530538434167 },
+		{ 0.0004880810755732001, 0.9995119189244643, -1.999510965799356 },
+		{ 0.0005083865860938951, 0.9994916134139072, -1.999490579323409 },
+		{ 0.0005295388112049212, 0.9994704611888123, -1.999469339246398 },
+		{ 0.0005515704039519241, 0.9994484295960806, -1.999447212340799 },
+		{ 0.0005745172828613222, 0.9994254827171491, -1.999424162057418 },
+		{ 0.0005984186313259485, 0.9994015813686753, -1.999400148520606 },
+		{ 0.0006233136262743911, 0.9993766863737324, -1.999375131809836 },
+		{ 0.0006492447081918503, 0.9993507552918224, -1.999349068669661 },
+		{ 0.0006762543100237277, 0.9993237456899982, -1.999321915791832 },
+		{ 0.0007043881268840418, 0.9992956118731214, -1.999293626523524 },
+		{ 0.0007336918450952471, 0.9992663081549046, -1.999264154150016 },
+		{ 0.0007642144115664648, 0.9992357855884407, -1.999233448601021 },
+		{ 0.0007960047628399543, 0.999203995237161, -1.999201459733963 },
+		{ 0.0008291183641307669, 0.9991708816358814, -1.999168130746743 },
+		{ 0.0008636073984339201, 0.9991363926015686, -1.999133408042241 },
+		{ 0.0008995305751479957, 0.9991004694248521, -1.999097231347892 },
+		{ 0.0009369465891785968, 0.9990630534108362, -1.999059540289903 },
+		{ 0.0009759206586367797, 0.9990240793413636, -1.999020267797559 },
+		{ 0.001016514715266993, 0.9989834852847351, -1.998979349974981 },
+		{ 0.0008995305751479957, 0.9991004694248521, -1.999097231347892 },
+		{ 0.000936946589178597, 0.9990630534108362, -1.999059540289903 },
+		{ 0.0009759206586367799, 0.9990240793413636, -1.999020267797559 },
+		{ 0.001016514715266994, 0.9989834852847351, -1.998979349974981 },
+		{ 0.001058793942004759, 0.9989412060580045, -1.998936719505229 },
+		{ 0.001102833309046016, 0.9988971666909547, -1.998892299042609 },
+		{ 0.001148701226876106, 0.9988512987731399, -1.99884601768307 },
+		{ 0.001196479157793343, 0.998803520842209, -1.998797791166358 },
+		{ 0.00124623873267244, 0.9987537612673409, -1.998747544951529 },
+		{ 0.001298071165916174, 0.9987019288340918, -1.99869518450367 },
+		{ 0.001352054568181282, 0.9986479454318203, -1.998640628281236 },
+		{ 0.001408280091134744, 0.9985917199088761, -1.998583781310357 },
+		{ 0.001466845386468042, 0.9985331546135322, -1.998524541758208 },
+		{ 0.001527841531972331, 0.9984721584680409, -1.998462814134361 },
+		{ 0.001591375902098215, 0.9984086240979039, -1.998398486126478 },
+		{ 0.001657546023911705, 0.998342453976093, -1.998331455030219 },
+		{ 0.001726468979129127, 0.9982735310208759, -1.998261597945224 },
+		{ 0.001798251995040575, 0.9982017480049598, -1.998188801530481 },
+		{ 0.00187301857578162, 0.9981269814242201, -1.998112935483946 },
+		{ 0.001950888896142439, 0.9980491111038586, -1.998033872379065 },
+		{ 0.002031996128367665, 0.9979680038716366, -1.99795147105265 },
+		{ 0.001798251995040575, 0.9982017480049598, -1.998188801530481 },
+		{ 0.00187301857578162, 0.9981269814242201, -1.998112935483946 },
+		{ 0.001950888896142439, 0.9980491111038586, -1.998033872379065 },
+		{ 0.002031996128367666, 0.9979680038716366, -1.99795147105265 },
+		{ 0.002116470104949421, 0.9978835298950544, -1.997865593144341 },
+		{ 0.002204450376783931, 0.9977955496232174, -1.997776089784016 },
+		{ 0.002296086204190738, 0.9977039137958097, -1.997682801529161 },
+		{ 0.002391526753212004, 0.9976084732467931, -1.997585568278887 },
+		{ 0.002490927618680479, 0.9975090723813202, -1.99748422257591 },
+		{ 0.002594454079066154, 0.9974055459209373, -1.997378586210484 },
+		{ 0.002702281084807908, 0.9972977189151958, -1.99726847013939 },
+		{ 0.002814580192714809, 0.9971854198072861, -1.997153687746383 },
+		{ 0.00293153913754799, 0.9970684608624524, -1.997034034764247 },
+		{ 0.003053352026671727, 0.996946647973328, -1.996909299177545 },
+		{ 0.003180219326934557, 0.9968197806730698, -1.996779261131095 },
+		{ 0.003312351112348141, 0.9966876488877021, -1.996643689484166 },
+		{ 0.003449950740753052, 0.9965500492592926, -1.996502358448131 },
+		{ 0.003593270279843707, 0.9964067297201568, -1.996354990509996 },
+		{ 0.003742535473594668, 0.9962574645265356, -1.996201333334248 },
+		{ 0.003897971824799342, 0.9961020281752024, -1.996041132908309 },
+		{ 0.004059869767020171, 0.9959401302331262, -1.995874066139078 },
+		{ 0.003593270279843708, 0.9964067297201568, -1.996354990509996 },
+		{ 0.003742535473594669, 0.9962574645265356, -1.996201333334248 },
+		{ 0.003897971824799342, 0.9961020281752024, -1.996041132908309 },
+		{ 0.004059869767020172, 0.9959401302331262, -1.995874066139078 },
+		{ 0.004228454246913706, 0.9957715457531237, -1.99569987513792 },
+		{ 0.004404047668316701, 0.9955959523317377, -1.99551819882511 },
+		{ 0.004586906911572386, 0.995413093088513, -1.995328741067492 },
+		{ 0.004777321078958096, 0.9952226789212322, -1.995131169498445 },
+		{ 0.0049756440045931, 0.9950243559954609, -1.994925081295283 },
+		{ 0.005182163944375644, 0.9948178360559777, -1.994710138192706 },
+		{ 0.005397266356320597, 0.9946027336437929, -1.9944858969768 },
+		{ 0.005621238523768734, 0.9943787614762329, -1.994252012612664 },
+		{ 0.005854497366929071, 0.9941455026332852, -1.994008000360075 },
+		{ 0.006097394105129091, 0.9939026058951003, -1.993753439198684 },
+		{ 0.00635031185218561, 0.9936496881479507, -1.993487869597426 },
+		{ 0.006613730554805089, 0.9933862694452953, -1.993210724498435 },
+		{ 0.006887999321392209, 0.9931120006786986, -1.992921568201773 },
+		{ 0.007173628968382154, 0.9928263710316179, -1.992619788024624 },
+		{ 0.007471064375417557, 0.9925289356248421, -1.992304833364674 },
+		{ 0.00778074946525167, 0.9922192505347522, -1.991976146984428 },
+		{ 0.008103224531711684, 0.991896775468522, -1.991633060905968 },
+		{ 0.007173628968382158, 0.9928263710316179, -1.992619788024624 },
+		{ 0.007471064375417557, 0.9925289356248421, -1.992304833364674 },
+		{ 0.007780749465251671, 0.9922192505347522, -1.991976146984428 },
+		{ 0.008103224531711686, 0.991896775468522, -1.991633060905968 },
+		{ 0.008439028668510392, 0.9915609713315646, -1.991274898835128 },
+		{ 0.008788699700768043, 0.9912113002993399, -1.990900975667367 },
+		{ 0.009152774108130134, 0.9908472258920404, -1.990510596974171 },
+		{ 0.009531851773948476, 0.9904681482261588, -1.990102988665986 },
+		{ 0.009926530975925789, 0.9900734690241816, -1.989677365526276 },
+		{ 0.01033750545153603, 0.9896624945484682, -1.98923282531137 },
+		{ 0.01076536985583658, 0.989234630144333, -1.988768557722373 },
+		{ 0.01121087872499539, 0.9887891212750074, -1.988283562840984 },
+		{ 0.01167468725118217, 0.9883253127488572, -1.987776930896949 },
+		{ 0.01215757766788677, 0.9878424223321385, -1.98724759446384 },
+		{ 0.01266032955418352, 0.9873396704459042, -1.98669446777581 },
+		{ 0.01318368738419706, 0.9868163126159284, -1.986116481394479 },
+		{ 0.0137285863837388, 0.9862714136163903, -1.985512330723571 },
+		{ 0.01429579698418818, 0.9857042030158116, -1.98488086689542 },
+		{ 0.01488627970964883, 0.9851137202903523, -1.984220701363705 },
+		{ 0.01550095886826282, 0.9844990411317455, -1.983530454311394 },
+		{ 0.01614081901186786, 0.9838591809881342, -1.982808644566532 },
+		{ 0.01429579698418819, 0.9857042030158116, -1.98488086689542 },
+		{ 0.01488627970964883, 0.9851137202903523, -1.984220701363705 },
+		{ 0.01550095886826282, 0.9844990411317455, -1.983530454311394 },
+		{ 0.01614081901186787, 0.9838591809881342, -1.982808644566532 },
+		{ 0.01680687230702828, 0.9831931276930754, -1.982053723053868 },
+		{ 0.01750012600671179, 0.9824998739933408, -1.981264106953678 },
+		{ 0.01822174281343975, 0.98177825718657, -1.98043799343101 },
+		{ 0.01897281524544698, 0.9810271847545949, -1.979573612758656 },
+		{ 0.01975455801291628, 0.9802454419871196, -1.978669004394543 },
+		{ 0.02056814688411143, 0.979431853115897, -1.9777221980495 },
+		{ 0.02141487854733045, 0.9785851214526716, -1.976731023996873 },
+		{ 0.02229607364820514, 0.9777039263518009, -1.975693219823106 },
+		{ 0.0232130761799521, 0.9767869238201261, -1.974606426336418 },
+		{ 0.02416734864102299, 0.9758326513590272, -1.973468068594102 },
+		{ 0.02516034326224591, 0.9748396567377793, -1.972275501786255 },
+		{ 0.02619359702284694, 0.9738064029771571, -1.971025891334608 },
+		{ 0.02726866685057158, 0.9727313331494305, -1.969716283113535 },
+		{ 0.02838722415696336, 0.9716127758430366, -1.968343480294637 },
+		{ 0.02955095809570377, 0.9704490419042983, -1.966904151806321 },
+		{ 0.03076163801069006, 0.9692383619893261, -1.965394746424608 },
+		{ 0.03202111198536121, 0.9679788880146419, -1.963811483145857 },
+		{ 0.02838722415696337, 0.9716127758430366, -1.968343480294637 },
+		{ 0.02955095809570378, 0.9704490419042983, -1.966904151806321 },
+		{ 0.03076163801069007, 0.9692383619893261, -1.965394746424608 },
+		{ 0.03202111198536122, 0.9679788880146419, -1.963811483145857 },
+		{ 0.03333127365731364, 0.9666687263428921, -1.962150381202561 },
+		{ 0.03469406078262421, 0.9653059392178024, -1.960407250661008 },
+		{ 0.03611139063053191, 0.9638886093706588, -1.958577764310488 },
+		{ 0.03758553679738992, 0.9624144632072765, -1.956656955700495 },
+		{ 0.03911874768688291, 0.9608812523155773, -1.954639690200659 },
+		{ 0.04071324510197728, 0.9592867548980401, -1.952520655958879 },
+		{ 0.0423712227490095, 0.9576287772518814, -1.950294354639613 },
+		{ 0.04409515752729104, 0.9559048424760682, -1.94795466510432 },
+		{ 0.04588718056528106, 0.9541128194390526, -1.945495675526398 },
+		{ 0.04775063654170923, 0.9522493634583886, -1.942909517926148 },
+		{ 0.04968758145463611, 0.9503124185464314, -1.940189786489457 },
+		{ 0.05170096539087798, 0.9482990346113545, -1.937328504165722 },
+		{ 0.05379369158098473, 0.9462063084197243, -1.934317388146192 },
+		{ 0.05596861381858929, 0.9440313861814109, -1.931147834504842 },
+		{ 0.05822853379186219, 0.9417714662105595, -1.927810902618242 },
+		{ 0.06057712062006344, 0.9394228793815768, -1.924295909651035 },
+		{ 0.06301674970894545, 0.9369832502928757, -1.920593614762799 },
+		{ 0.05596861381858907, 0.9440313861814109, -1.931147834504842 },
+		{ 0.05822853379186219, 0.9417714662105595, -1.927810902618242 },
+		{ 0.06057712062006346, 0.9394228793815768, -1.924295909651035 },
+		{ 0.06301674970894504, 0.9369832502928757, -1.920593614762799 },
+		{ 0.06555157351101504, 0.9344484264893895, -1.916691566792619 },
+		{ 0.06818444371167574, 0.9318155562891636, -1.912578716953224 },
+		{ 0.07091874872783806, 0.9290812512745028, -1.908242596787696 },
+		{ 0.07375870412131955, 0.9262412958787454, -1.903668746787548 },
+		{ 0.07670752109628774, 0.923292478904746, -1.898843589139039 },
+		{ 0.07976892187722157, 0.9202310781228121, -1.893751973596757 },
+		{ 0.0829471249808124, 0.9170528750209334, -1.888377087794027 },
+		{ 0.08624563310563844, 0.9137543668945651, -1.882702436680172 },
+		{ 0.08966902568722657, 0.9103309743127749, -1.876708728729417 },
+		{ 0.09322114979328594, 0.9067788502069059, -1.870376903235397 },
+		{ 0.09690660269502287, 0.9030933973068966, -1.863685467414657 },
+		{ 0.1007292352413565, 0.8992707647591091, -1.856613096651077 },
+		{ 0.1046936219081004, 0.8953063780932825, -1.849135894605458 },
+		{ 0.108804741904404, 0.891195258095596, -1.84122780449662 },
+		{ 0.1130667956800551, 0.8869332043201269, -1.832862790048035 },
+		{ 0.1174843648924807, 0.8825156351080915, -1.824012553420859 },
+		{ 0.1220626759753323, 0.8779373240250368, -1.814645820266008 },
+		{ 0.108804741904404, 0.891195258095596, -1.84122780449662 },
+		{ 0.1130667956800549, 0.8869332043201269, -1.832862790048035 },
+		{ 0.1174843648924807, 0.8825156351080915, -1.824012553420859 },
+		{ 0.1220626759753323, 0.8779373240250368, -1.814645820266008 },
+		{ 0.1268061382322884, 0.8731938617684958, -1.804731184334108 },
+		{ 0.131719484914655, 0.8682805150865709, -1.794234719716502 },
+		{ 0.1368083110091111, 0.86319168899093, -1.783118608157518 },
+		{ 0.1420770618089881, 0.8579229381911376, -1.771345348039089 },
+		{ 0.1475307194287278, 0.8524692805719446, -1.758874018521028 },
+		{ 0.1531747628569917, 0.8468252371430733, -1.745660103276102 },
+		{ 0.1590137492038707, 0.8409862507962215, -1.731658650531943 },
+		{ 0.1650529569815036, 0.8349470430188874, -1.716820306614263 },
+		{ 0.1712975172067573, 0.8287024827932459, -1.701093164217308 },
+		{ 0.1777521168178093, 0.8222478831825584, -1.684423421754474 },
+		{ 0.1844220488434724, 0.8155779511565291, -1.666752549806137 },
+		{ 0.1913120916504563, 0.8086879083504329, -1.648020003678405 },
+		{ 0.198426751659825, 0.8015732483402365, -1.628162545731018 },
+		{ 0.2057710119479239, 0.7942289880520762, -1.607112005154733 },
+		{ 0.2133494910747775, 0.7866505089255681, -1.58479743435177 },
+		{ 0.2211664086630026, 0.7788335913374995, -1.561145185955997 },
+		{ 0.2292260550844565, 0.7707739449162427, -1.536077436434516 },
+		{ 0.2057710119479237, 0.7942289880520762, -1.607112005154733 },
+		{ 0.2133494910747776, 0.7866505089255681, -1.58479743435177 },
+		{ 0.2211664086630027, 0.7788335913374995, -1.561145185955997 },
+		{ 0.2292260550844563, 0.7707739449162427, -1.536077436434516 },
+		{ 0.2375322302530757, 0.7624677697471323, -1.509513823536844 },
+		{ 0.2460891938377869, 0.7539108061622264, -1.48136835819877 },
+		{ 0.2549001080570635, 0.7450998919430143, -1.451554428495523 },
+		{ 0.2639682321257222, 0.7360317678745144, -1.41998100894763 },
+		{ 0.2732963634945635, 0.726703636505601, -1.386554581176235 },
+		{ 0.2828865483950386, 0.7171134516119255, -1.351180428247727 },
+		{ 0.2927425888770371, 0.7072574111292403, -1.313753407777827 },
+		{ 0.3028625228468643, 0.6971374771962104, -1.274186870571892 },
+		{ 0.3132512960912185, 0.6867487039390532, -1.232364377183032 },
+		{ 0.3239079761133699, 0.6760920238992482, -1.188189648570492 },
+		{ 0.3348326055873214, 0.6651673944126816, -1.141560756718462 },
+		{ 0.3460238668894467, 0.6539761331121982, -1.092380428661221 },
+		{ 0.3574811686304177, 0.6425188313989846, -1.04054797138508 },
+		{ 0.3692003145377752, 0.630799685462225, -0.9859800463694947 },
+		{ 0.3811817868707558, 0.6188182131611785, -0.9285738411574956 },
+		{ 0.3934182370052536, 0.6065817629956674, -0.8682676166858876 },
+		{ 0.4059067481847682, 0.5940932518274863, -0.8049846165043452 },
+		{ 0.369200314537775, 0.630799685462225, -0.9859800463694947 },
+		{ 0.381181786870756, 0.6188182131611785, -0.9285738411574956 },
+		{ 0.3934182370052536, 0.6065817629956674, -0.8682676166858876 },
+		{ 0.4059067481847681, 0.5940932518274863, -0.8049846165043452 },
+		{ 0.418642519607664, 0.5813574804006226, -0.7386651272684353 },
+		{ 0.431618868362118, 0.5683811316434754, -0.6692699330956701 },
+		{ 0.4448254243206872, 0.555174575694836, -0.5967942171449162 },
+		{ 0.4582572366799468, 0.5417427633204831, -0.5212212408356107 },
+		{ 0.4719018246898338, 0.5280981753104647, -0.4425976003987792 },
+		{ 0.4719018246898338, 0.5280981753104647, -0.4425976003987792 },
+		{ 0.4719018246898338, 0.5280981753104647, -0.4425976003987792 },
+		{ 0.4719018246898338, 0.5280981753104647, -0.4425976003987792 },
+		{ 0.4719018246898338, 0.5280981753104647, -0.4425976003987792 },
+		{ 0.4719018246898338, 0.5280981753104647, -0.4425976003987792 },
+		{ 0.4719018246898338, 0.5280981753104647, -0.4425976003987792 },
+		{ 0.4719018246898338, 0.5280981753104647, -0.4425976003987792 },
+		{ 0.4719018246898338, 0.5280981753104647, -0.4425976003987792 },
+		{ 0.4719018246898338, 0.5280981753104647, -0.4425976003987792 },
+		{ 0.4719018246898338, 0.5280981753104647, -0.4425976003987792 },
+		{ 0.4719018246898338, 0.5280981753104647, -0.4425976003987792 },
+		{ 0.4719018246898338, 0.5280981753104647, -0.4425976003987792 }
+	},
+	.c_bpre4800080040 = {
+		{ 4.499671915625447e-05, 0.999997750164042, -1.999994510633696 },
+		{ 4.686935368716234e-05, 0.9999976565382509, -1.999994141774862 },
+		{ 4.882056198055387e-05, 0.9999975590018497, -1.999993745576347 },
+		{ 5.085153835617516e-05, 0.9999974574239404, -1.999993320016575 },
+		{ 5.296811760752003e-05, 0.999997351608175, -1.999992862657185 },
+		{ 5.517270494235848e-05, 0.9999972413909308, -1.999992371034832 },
+		{ 5.746832745655984e-05, 0.9999971265922224, -1.999991842444714 },
+		{ 5.985970532064574e-05, 0.9999970070157029, -1.999991273918661 },
+		{ 6.235080747487387e-05, 0.9999968824650247, -1.999990662282987 },
+		{ 6.494567936864695e-05, 0.9999967527274786, -1.999990004061866 },
+		{ 6.76485417180004e-05, 0.9999966175903551, -1.999989295537635 },
+		{ 7.046359467484106e-05, 0.9999964768245827, -1.999988532646234 },
+		{ 7.339597896995367e-05, 0.9999963302010904, -1.999987711040082 },
+		{ 7.645062915424242e-05, 0.9999961774744447, -1.999986825974821 },
+		{ 7.963203342467056e-05, 0.9999960183992123, -1.999985872374899 },
+		{ 8.294625627246813e-05, 0.9999958526972359, -1.999984844607568 },
+		{ 8.639790678595357e-05, 0.9999956801067199, -1.999983736746922 },
+		{ 8.999333708739175e-05, 0.9999955003331457, -1.999982542236833 },
+		{ 9.373859753946576e-05, 0.9999953130819936, -1.999981254057264 },
+		{ 9.763948775199811e-05, 0.9999951180260205, -1.999979864459417 },
+		{ 0.0001017029473911201, 0.9999949148543459, -1.999978365263043 },
+		{ 8.999333708739178e-05, 0.9999955003331457, -1.999982542236833 },
+		{ 9.373859753946579e-05, 0.9999953130819936, -1.999981254057264 },
+		{ 9.763948775199812e-05, 0.9999951180260205, -1.999979864459417 },
+		{ 0.0001017029473911201, 0.9999949148543459, -1.999978365263043 },
+		{ 0.0001059353557761301, 0.9999947032397266, -1.999976747590628 },
+		{ 0.0001103438916420705, 0.9999944828058341, -1.999975001547581 },
+		{ 0.000114936074481406, 0.9999942532090639, -1.999973116797679 },
+		{ 0.0001197192314890594, 0.9999940140403637, -1.999971081719381 },
+		{ 0.0001247014205741901, 0.9999937649397687, -1.999968884289091 },
+		{ 0.0001298911401604373, 0.9999935054491392, -1.999966510740042 },
+		{ 0.0001352965135768067, 0.9999932351757883, -1.999963946926372 },
+		{ 0.0001409269411048847, 0.9999929536615779, -1.999961177067269 },
+		{ 0.0001467916885982812, 0.9999926604156483, -1.999958183909166 },
+		{ 0.00015290061520003, 0.9999923549798632, -1.999954949300428 },
+		{ 0.000159263749789898, 0.999992036814278, -1.999951452900762 },
+		{ 0.0001658915149440341, 0.9999917054280338, -1.999947673455566 },
+		{ 0.0001727954403348496, 0.9999913602321018, -1.999943587038741 },
+		{ 0.0001799862692379033, 0.9999910006865385, -1.999939168585815 },
+		{ 0.0001874766357148346, 0.9999906261695923, -1.999934390203793 },
+		{ 0.0001952784988263437, 0.9999902360758749, -1.999929222191067 },
+		{ 0.0002034053776208592, 0.99998982973455, -1.999923631811542 },
+		{ 0.0001799862692379033, 0.9999910006865385, -1.999939168585815 },
+		{ 0.0001874766357148346, 0.9999906261695923, -1.999934390203793 },
+		{ 0.0001952784988263437, 0.9999902360758749, -1.999929222191067 },
+		{ 0.0002034053776208592, 0.99998982973455, -1.999923631811542 },
+		{ 0.0002118702426395709, 0.9999894064911465, -1.999917584185503 },
+		{ 0.000220687174514657, 0.9999889656421075, -1.999911041203579 },
+		{ 0.000229871307419087, 0.9999885064347913, -1.999903961238216 },
+		{ 0.0002394377463538371, 0.9999880281165592, -1.999896299633064 },
+		{ 0.0002494019660830216, 0.9999875299020503, -1.999888007967483 },
+		{ 0.0002597809167399866, 0.9999870109568201, -1.999879033471817 },
+		{ 0.0002705921119028918, 0.9999864703973395, -1.999869318653735 },
+		{ 0.0002818528831591431, 0.9999859073564445, -1.999858802141629 },
+		{ 0.0002935822998114913, 0.9999853208851655, -1.999847416553949 },
+		{ 0.0003057999641030258, 0.9999847100018108, -1.999835088934965 },
+		{ 0.0003185262313331256, 0.9999840736919678, -1.999821740331312 },
+		{ 0.0003317829610873913, 0.9999834108921437, -1.999807284976678 },
+		{ 0.0003455892973605579, 0.9999827205715733, -1.999791631629679 },
+		{ 0.0003599709187077813, 0.9999820014540647, -1.999774676670639 },
+		{ 0.0003749541986551714, 0.9999812523943289, -1.999756311962639 },
+		{ 0.0003905550909689904, 0.9999804722470838, -1.999736421622012 },
+		{ 0.0004068115490601398, 0.9999796595398104, -1.99971487272446 },
+		{ 0.0003599709187077813, 0.9999820014540647, -1.999774676670639 },
+		{ 0.0003749541986551715, 0.9999812523943289, -1.999756311962639 },
+		{ 0.0003905550909689905, 0.9999804722470838, -1.999736421622012 },
+		{ 0.0004068115490601399, 0.9999796595398104, -1.99971487272446 },
+		{ 0.0004237380564409135, 0.9999788131272397, -1.999691531472231 },
+		{ 0.0004413734036862649, 0.9999779313732476, -1.999666240486679 },
+		{ 0.0004597419960136752, 0.99997701296896, -1.999638840311172 },
+		{ 0.000478874211725266, 0.9999760564418928, -1.999609155124097 },
+		{ 0.0004988010171748789, 0.9999750599923286, -1.999576985685363 },
+		{ 0.0005195627111254864, 0.9999740221478034, -1.999542128848105 },
+		{ 0.0005411829201435282, 0.9999729409450047, -1.999504349731778 },
+		{ 0.0005637017942441619, 0.9999718149114918, -1.999463413790437 },
+		{ 0.0005871650286238691, 0.9999706419203596, -1.999419045202445 },
+		{ 0.0006116002419875165, 0.9999694201719577, -1.999370960304841 },
+		{ 0.0006370481281532397, 0.9999681477030309, -1.999318848451374 },
+		{ 0.0006635604181922894, 0.9999668220594856, -1.999262355261456 },
+		{ 0.0006911726231413597, 0.9999654414417252, -1.999201128792889 },
+		{ 0.0007199353584600716, 0.9999640032320768, -1.999134754544961 },
+		{ 0.000749901367816997, 0.9999625051401307, -1.999062802445679 },
+		{ 0.0007811025552878788, 0.9999609448755009, -1.998984811467349 },
+		{ 0.0008136106195169078, 0.9999593196569728, -1.99890026179779 },
+		{ 0.0007199353584600718, 0.9999640032320768, -1.999134754544961 },
+		{ 0.000749901367816997, 0.9999625051401307, -1.999062802445679 },
+		{ 0.0007811025552878789, 0.9999609448755009, -1.998984811467349 },
+		{ 0.000813610619516908, 0.9999593196569728, -1.99890026179779 },
+		{ 0.0008474671352060378, 0.9999576267033626, -1.998808594787146 },
+		{ 0.0008827370668849757, 0.9999558632335189, -1.998709210595482 },
+		{ 0.0009194734239327942, 0.9999540264663239, -1.99860146574291 },
+		{ 0.000957735856001129, 0.9999521132934627, -1.998484650181713 },
+		{ 0.0009975895942539717, 0.999950120606661, -1.998358001697659 },
+		{ 0.001039103933596543, 0.99994804480684, -1.998220669700717 },
+		{ 0.001082347008419428, 0.9999458827858174, -1.998071774200171 },
+		{ 0.001127387700501486, 0.9999436306173833, -1.997910313263122 },
+		{ 0.001174303307601742, 0.9999412848662315, -1.997735246933261 },
+		{ 0.001223171549119158, 0.9999388414426555, -1.997545409533172 },
+		{ 0.001274076270405958, 0.9999362962570164, -1.997339548866515 },
+		{ 0.001327094350712418, 0.9999336453833612, -1.997116335099989 },
+		{ 0.001382323795404625, 0.9999308839141307, -1.996874255850787 },
+		{ 0.001439844801581977, 0.999928007759921, -1.996611760364314 },
+		{ 0.001499763023479209, 0.9999250118497384, -1.996327093699842 },
+		{ 0.001562174604513887, 0.9999218912763045, -1.99601838672466 },
+		{ 0.001627183921257191, 0.9999186408052249, -1.995683600108529 },
+		{ 0.001439844801581978, 0.999928007759921, -1.996611760364314 },
+		{ 0.001499763023479209, 0.9999250118497384, -1.996327093699842 },
+		{ 0.001562174604513887, 0.9999218912763045, -1.99601838672466 },
+		{ 0.001627183921257191, 0.9999186408052249, -1.995683600108529 },
+		{ 0.001694900899627918, 0.9999152550386111, -1.995320527287612 },
+		{ 0.001765429276745449, 0.9999117285787024, -1.994926800685129 },
+		{ 0.001838895951590787, 0.9999080552098232, -1.994499785336898 },
+		{ 0.001915419794907561, 0.9999042290436707, -1.994036690623382 },
+		{ 0.001995129827803556, 0.9999002435376675, -1.993534440697936 },
+		{ 0.002078153880367763, 0.9998960923130215, -1.992989755200841 },
+		{ 0.002164633299084153, 0.9998917683367007, -1.992399026475649 },
+		{ 0.002254711850854597, 0.9998872644122738, -1.991758358601923 },
+		{ 0.00234853766582068, 0.9998825731799299, -1.991063547099435 },
+		{ 0.002446268290822035, 0.9998776866256802, -1.990309980252789 },
+		{ 0.002548065692977258, 0.9998725967358033, -1.989492707741597 },
+		{ 0.002654099948361495, 0.9998672950060543, -1.988606337239949 },
+		{ 0.002764544657398641, 0.9998617727688968, -1.987645054890669 },
+		{ 0.002879585945502868, 0.9998560207027247, -1.986602506088068 },
+		{ 0.002999413582508283, 0.9998500293226995, -1.985471841320368 },
+		{ 0.003124227189556841, 0.9998437886535817, -1.984245617566512 },
+		{ 0.003254235456146544, 0.9998372882297679, -1.98291575010368 },
+		{ 0.002879585945502869, 0.9998560207027247, -1.986602506088068 },
+		{ 0.002999413582508284, 0.9998500293226995, -1.985471841320368 },
+		{ 0.003124227189556842, 0.9998437886535817, -1.984245617566512 },
+		{ 0.003254235456138064, 0.9998372882297679, -1.98291575010368 },
+		{ 0.003389658164956216, 0.9998305172589307, -1.981473496505128 },
+		{ 0.003530714507457886, 0.9998234646220567, -1.979909408870388 },
+		{ 0.003677635391018463, 0.9998161192006798, -1.97821336031361 },
+		{ 0.003830717798340062, 0.9998084679137906, -1.976374025888429 },
+		{ 0.003990086513640891, 0.9998004976810547, -1.974379246182437 },
+		{ 0.004156091824553682, 0.9997921954228509, -1.972215979635027 },
+		{ 0.004329053354214209, 0.9997835480603157, -1.969870253403232 },
+		{ 0.004509237352376205, 0.9997745408795091, -1.967326641631998 },
+		{ 0.004696854879048645, 0.9997651608032626, -1.964569098332933 },
+		{ 0.004892237370315301, 0.9997553882119217, -1.961578444099699 },
+		{ 0.005095816900949486, 0.9997452100303644, -1.958336146826276 },
+		{ 0.005307871116851473, 0.9997346082770491, -1.954820795607911 },
+		{ 0.005528712225319319, 0.9997235649717198, -1.951009433631121 },
+		{ 0.005758757290257834, 0.9997120621354871, -1.946877475516094 },
+		{ 0.00599840407459865, 0.9997000817909053, -1.942398623198602 },
+		{ 0.006248005954810736, 0.9996876010548541, -1.937542833513939 },
+		{ 0.006507958288666067, 0.9996746035889418, -1.932280565270122 },
+		{ 0.005758757290257835, 0.9997120621354871, -1.946877475516094 },
+		{ 0.005998404074598651, 0.9997000817909053, -1.942398623198602 },
+		{ 0.006248005954810737, 0.9996876010548541, -1.937542833513939 },
+		{ 0.006507958288661897, 0.9996746035889418, -1.932280565270122 },
+		{ 0.006778741841354946, 0.9996610632422608, -1.926576182309485 },
+		{ 0.007060805718871754, 0.9996469604088535, -1.920394337471791 },
+		{ 0.007354594535503339, 0.9996322722135079, -1.913695859795342 },
+		{ 0.007660583551433226, 0.999616970876502, -1.906436562252011 },
+		{ 0.007979346630575585, 0.999601033527691, -1.898571588364312 },
+		{ 0.00831131999421033, 0.999584434028444, -1.890051478299322 },
+		{ 0.008657169676425217, 0.9995671429720734, -1.880821717731157 },
+		{ 0.009017318875893417, 0.999549134226342, -1.870825956951137 },
+		{ 0.009392497617914877, 0.999530375120496, -1.860000456480908 },
+		{ 0.009783278041699633, 0.9995108362587707, -1.848279213669953 },
+		{ 0.01019036537612634, 0.9994904833432451, -1.835589001936597 },
+		{ 0.01061430080614358, 0.9994692853514866, -1.821854043355935 },
+		{ 0.01105589612091595, 0.9994472063597648, -1.806990676496434 },
+		{ 0.01151585641624153, 0.999424207179188, -1.790907776077773 },
+		{ 0.01199496513167562, 0.9994002518974776, -1.773511032852925 },
+		{ 0.01249398295043063, 0.9993753013380333, -1.754698279602624 },
+		{ 0.0130137777684661, 0.9993493114255263, -1.734357665267466 },
+		{ 0.01151585641623928, 0.999424207179188, -1.790907776077773 },
+		{ 0.01199496513167562, 0.9994002518974776, -1.773511032852925 },
+		{ 0.01249398295042656, 0.9993753013380333, -1.754698279602624 },
+		{ 0.01301377776846833, 0.9993493114255263, -1.734357665267466 },
+		{ 0.01355518611792147, 0.9993222413626475, -1.712373651513881 },
+		{ 0.01411907916722377, 0.9992940470897509, -1.68862188341075 },
+		{ 0.01470644039503845, 0.9992646780156977, -1.662965833945175 },
+		{ 0.01531823287628394, 0.9992340884643134, -1.635266410783617 },
+		{ 0.01595545429114809, 0.9992022278645689, -1.605373554346886 },
+		{ 0.01661918608665999, 0.9991690407519644, -1.573125704162999 },
+		{ 0.01731050271522907, 0.9991344749441833, -1.538357698824008 },
+		{ 0.01803057215135357, 0.9990984717326297, -1.500891467419215 },
+		{ 0.01878058428527886, 0.9990609707885193, -1.46054091816194 },
+		{ 0.01956177045850921, 0.9990219117987069, -1.417114344340026 },
+		{ 0.02037544146268551, 0.998981227928293, -1.370407882637247 },
+		{ 0.02122296844736804, 0.9989388523610117, -1.320213536771923 },
+		{ 0.02210566776870077, 0.9988947166659007, -1.266318810681261 },
+		{ 0.02302508208503631, 0.9988487458957483, -1.208502182512338 },
+		{ 0.02398273630577163, 0.9988008634927419, -1.146540803171145 },
+		{ 0.02498018317482285, 0.9987509912902826, -1.080213157859834 },
+		{ 0.02601908762042738, 0.9986990462466736, -1.009297783425636 },
+		{ 0.02302508208503236, 0.9988487458957483, -1.208502182512338 },
+		{ 0.02398273630577297, 0.9988008634927419, -1.146540803171145 },
+		{ 0.02498018317482285, 0.9987509912902826, -1.080213157859834 },
+		{ 0.02601908762042664, 0.9986990462466736, -1.009297783425636 },
+		{ 0.02710112942923977, 0.9986449437160945, -0.9335812313071329 },
+		{ 0.02822818193842893, 0.9985885909150765, -0.8528532614165121 },
+		{ 0.02940206682115862, 0.998529896729816, -0.7669258422335631 },
+		{ 0.03062473334130196, 0.9984687635491072, -0.6756278631583817 },
+		{ 0.03189819230351135, 0.9984050905358817, -0.5788170629664604 },
+		{ 0.03322462320804359, 0.9983387752642569, -0.4763912182352628 },
+		{ 0.03460620129271939, 0.9982696957551591, -0.3682700116581712 },
+		{ 0.03604554772705865, 0.9981977627516653, -0.2544882770582875 },
+		{ 0.0375439693782614, 0.9981228298855975, -0.1350678596205327 },
+		{ 0.03910456724308132, 0.9980447835200371, -0.01017399626087403 },
+		{ 0.04073012499466135, 0.9979634937531203, 0.1199452411649807 },
+		{ 0.04242341619187515, 0.997878830756335, 0.2549145569002364 },
+		{ 0.04418759397561111, 0.9977906484525256, 0.3942370878355403 },
+		{ 0.04602365644981978, 0.997698817177509, 0.5372208075587583 },
+		{ 0.04793745098861595, 0.997603158384549, 0.6830567051848644 },
+		{ 0.04992916588328087, 0.9975035426033223, 0.8306426205385871 },
+		{ 0.05200441022785206, 0.9973997915019822, 0.9787082241320342 },
+		{ 0.04602365644981905, 0.997698817177509, 0.5372208075587583 },
+		{ 0.04793745098861536, 0.997603158384549, 0.6830567051848644 },
+		{ 0.04992916588328493, 0.9975035426033223, 0.8306426205385871 },
+		{ 0.05200441022785282, 0.9973997915019822, 0.9787082241320342 },
+		{ 0.05416562600815365, 0.9972917268733514, 1.12571309012118 },
+		{ 0.05641669818012116, 0.9971791706424973, 1.269824159255335 },
+		{ 0.05876108626838765, 0.9970619611890126, 1.408878982599491 },
+		{ 0.06120257297461763, 0.9969398717832831, 1.540466594325911 },
+		{ 0.06374550987822711, 0.996812724807962, 1.661783319030018 },
+		{ 0.06374550987822711, 0.996812724807962, 1.661783319030018 },
+		{ 0.06374550987822711, 0.996812724807962, 1.661783319030018 },
+		{ 0.06374550987822711, 0.996812724807962, 1.661783319030018 },
+		{ 0.06374550987822711, 0.996812724807962, 1.661783319030018 },
+		{ 0.06374550987822711, 0.996812724807962, 1.661783319030018 },
+		{ 0.06374550987822711, 0.996812724807962, 1.661783319030018 },
+		{ 0.06374550987822711, 0.996812724807962, 1.661783319030018 },
+		{ 0.06374550987822711, 0.996812724807962, 1.661783319030018 },
+		{ 0.06374550987822711, 0.996812724807962, 1.661783319030018 },
+		{ 0.06374550987822711, 0.996812724807962, 1.661783319030018 },
+		{ 0.06374550987822711, 0.996812724807962, 1.661783319030018 },
+		{ 0.06374550987822711, 0.996812724807962, 1.661783319030018 }
+	},
+	.c_bpre9600080040 = {
+		{ 2.249837222979395e-05, 0.9999988750813886, -1.999998065198183 },
+		{ 2.343469057952056e-05, 0.9999988282684389, -1.999997949576884 },
+		{ 2.441029589297938e-05, 0.99999877950018, -1.999997826142995 },
+		{ 2.542578533180206e-05, 0.9999987287111621, -1.999997694358396 },
+		{ 2.648407634028509e-05, 0.9999986758032107, -1.999997553564405 },
+		{ 2.758637149721998e-05, 0.9999986206945142, -1.999997403104279 },
+		{ 2.873418437253289e-05, 0.9999985632950792, -1.999997242256817 },
+		{ 2.992987504660822e-05, 0.9999985035067317, -1.999997070230885 },
+		{ 3.117542803610932e-05, 0.9999984412312974, -1.999996886183971 },
+		{ 3.247286603809363e-05, 0.9999983763624212, -1.999996689193937 },
+		{ 3.382429946956905e-05, 0.9999983087937474, -1.999996478278182 },
+		{ 3.523182837478338e-05, 0.9999982384107398, -1.999996252363417 },
+		{ 3.669802315705788e-05, 0.9999981650988616, -1.999996010305472 },
+		{ 3.822535111346011e-05, 0.999998088735396, -1.99999575085689 },
+		{ 3.981605633916915e-05, 0.9999980091976245, -1.999995472687413 },
+		{ 4.147317113681064e-05, 0.9999979263464677, -1.999995174319304 },
+		{ 4.319900005173533e-05, 0.9999978400510272, -1.999994854205624 },
+		{ 4.499671915625446e-05, 0.999997750164042, -1.999994510633696 },
+		{ 4.686935368716232e-05, 0.9999976565382509, -1.999994141774862 },
+		{ 4.881980346249815e-05, 0.9999975590100311, -1.99999374561009 },
+		{ 5.085153835617516e-05, 0.9999974574239404, -1.999993320016575 },
+		{ 4.499671915625447e-05, 0.999997750164042, -1.999994510633696 },
+		{ 4.686935368716234e-05, 0.9999976565382509, -1.999994141774862 },
+		{ 4.881980346249815e-05, 0.9999975590100311, -1.99999374561009 },
+		{ 5.085153835617516e-05, 0.9999974574239404, -1.999993320016575 },
+		{ 5.296774802757162e-05, 0.9999973516163563, -1.9999928626931 },
+		{ 5.517202192183139e-05, 0.9999972413991121, -1.999992371071901 },
+		{ 5.746811980089937e-05, 0.9999971266004037, -1.999991842482985 },
+		{ 5.985970532064574e-05, 0.9999970070157029, -1.999991273918661 },
+		{ 6.235080747487387e-05, 0.9999968824650247, -1.999990662282987 },
+		{ 6.494567552710306e-05, 0.9999967527192972, -1.999990004019679 },
+		{ 6.764837119641584e-05, 0.9999966175821737, -1.999989295494033 },
+		{ 7.046359467484106e-05, 0.9999964768245827, -1.999988532646234 },
+		{ 7.339597896995367e-05, 0.9999963302010904, -1.999987711040082 },
+		{ 7.645045371986217e-05, 0.9999961774826258, -1.999986826023032 },
+		{ 7.963203342467056e-05, 0.9999960183992123, -1.999985872374899 },
+		{ 8.294592946823392e-05, 0.999995852705417, -1.999984844659179 },
+		{ 8.639790678595357e-05, 0.9999956801067199, -1.999983736746922 },
+		{ 8.999333708739175e-05, 0.9999955003331457, -1.999982542236833 },
+		{ 9.373853752766959e-05, 0.9999953130738126, -1.999981254000001 },
+		{ 9.763948775199811e-05, 0.9999951180260205, -1.999979864459417 },
+		{ 0.0001017029473911201, 0.9999949148543459, -1.999978365263043 },
+		{ 8.999333708739178e-05, 0.9999955003331457, -1.999982542236833 },
+		{ 9.373853752766961e-05, 0.9999953130738126, -1.999981254000001 },
+		{ 9.763948775199812e-05, 0.9999951180260205, -1.999979864459417 },
+		{ 0.0001017029473911201, 0.9999949148543459, -1.999978365263043 },
+		{ 0.0001059354018788903, 0.9999947032315452, -1.999976747526979 },
+		{ 0.0001103438916420705, 0.9999944828058341, -1.999975001547581 },
+		{ 0.0001149359839683642, 0.9999942532008828, -1.999973116729318 },
+		{ 0.0001197192314890594, 0.9999940140403637, -1.999971081719381 },
+		{ 0.0001247013718044642, 0.9999937649315872, -1.999968884215616 },
+		{ 0.0001298908801728584, 0.9999935054573205, -1.999966510816233 },
+		{ 0.0001352965135768067, 0.9999932351757883, -1.999963946926372 },
+		{ 0.0001409269380855939, 0.9999929536533967, -1.999961176985299 },
+		{ 0.0001467916885982812, 0.9999926604156483, -1.999958183909166 },
+		{ 0.0001529005665104481, 0.999992354971682, -1.999954949212189 },
+		{ 0.000159263749789898, 0.999992036814278, -1.999951452900762 },
+		{ 0.0001658921685440353, 0.9999917054116716, -1.999947673265484 },
+		{ 0.0001727953951409747, 0.9999913602484639, -1.999943587236052 },
+		{ 0.0001799862692379033, 0.9999910006865385, -1.999939168585815 },
+		{ 0.0001874779780324805, 0.9999906261532298, -1.999934389991108 },
+		{ 0.0001952784988263437, 0.9999902360758749, -1.999929222191067 },
+		{ 0.000203406808880292, 0.9999898297181881, -1.999923631582177 },
+		{ 0.0001799862692379033, 0.9999910006865385, -1.999939168585815 },
+		{ 0.0001874779780324805, 0.9999906261532298, -1.999934389991108 },
+		{ 0.0001952784988263437, 0.9999902360758749, -1.999929222191067 },
+		{ 0.0002034068088802921, 0.9999898297181881, -1.999923631582177 },
+		{ 0.0002118701504423012, 0.9999894065075086, -1.999917584423732 },
+		{ 0.0002206879194301173, 0.9999889656257448, -1.999911040956116 },
+		{ 0.0002298723190304334, 0.9999885064184287, -1.999903960981137 },
+		{ 0.0002394385391350098, 0.9999880281492839, -1.999896300167256 },
+		{ 0.000249402063627384, 0.9999875299184128, -1.999888008245013 },
+		{ 0.0002597830427248894, 0.9999870109895445, -1.999879034048613 },
+		{ 0.0002705932905894983, 0.999986470380977, -1.999869318354015 },
+		{ 0.0002818528831591431, 0.9999859073564445, -1.999858802141629 },
+		{ 0.0002935846690945491, 0.9999853208524412, -1.999847415906363 },
+		{ 0.0003058024588594119, 0.9999847099690864, -1.999835088261792 },
+		{ 0.0003185266005518662, 0.9999840737246922, -1.999821741031135 },
+		{ 0.0003317829610873913, 0.9999834108921437, -1.999807284976678 },
+		{ 0.0003455892973605579, 0.9999827205715733, -1.999791631629679 },
+		{ 0.0003599709187077813, 0.9999820014540647, -1.999774676670639 },
+		{ 0.0003749541986551714, 0.9999812523943289, -1.999756311962639 },
+		{ 0.0003905550909689904, 0.9999804722470838, -1.999736421622012 },
+		{ 0.0004068094470843135, 0.9999796596216209, -1.99971487493621 },
+		{ 0.0003599709187077813, 0.9999820014540647, -1.999774676670639 },
+		{ 0.0003749541986551715, 0.9999812523943289, -1.999756311962639 },
+		{ 0.0003905550909689905, 0.9999804722470838, -1.999736421622012 },
+		{ 0.0004068094470843136, 0.9999796596216209, -1.99971487493621 },
+		{ 0.0004237380564409135, 0.9999788131272397, -1.999691531472231 },
+		{ 0.0004413734036862649, 0.9999779313732476, -1.999666240486679 },
+		{ 0.0004597419960136752, 0.99997701296896, -1.999638840311172 },
+		{ 0.0004788736609898295, 0.9999760563600822, -1.999609152535087 },
+		{ 0.0004988010171748789, 0.9999750599923286, -1.999576985685363 },
+		{ 0.0005195587153288447, 0.9999740220659933, -1.999542126046109 },
+		{ 0.0005411808261003594, 0.9999729410268147, -1.999504352646961 },
+		{ 0.0005637017942441619, 0.9999718149114918, -1.999463413790437 },
+		{ 0.0005871602727206251, 0.9999706420021699, -1.999419048358317 },
+		{ 0.0006115951257697395, 0.9999694202537674, -1.999370963588615 },
+		{ 0.0006370482809605812, 0.9999681476212213, -1.999318845034382 },
+		{ 0.0006635581830799407, 0.9999668221412954, -1.99926235881721 },
+		{ 0.0006911738407115387, 0.9999654413599156, -1.999201125092603 },
+		{ 0.0007199353584600716, 0.9999640032320768, -1.999134754544961 },
+		{ 0.0007498955703247088, 0.9999625052219399, -1.999062806453311 },
+		{ 0.0007811025552878788, 0.9999609448755009, -1.998984811467349 },
+		{ 0.000813608509600322, 0.999959319575164, -1.998900257456737 },
+		{ 0.0007199353584600718, 0.9999640032320768, -1.999134754544961 },
+		{ 0.000749895570324709, 0.9999625052219399, -1.999062806453311 },
+		{ 0.0007811025552878789, 0.9999609448755009, -1.998984811467349 },
+		{ 0.0008136085096003222, 0.999959319575164, -1.998900257456737 },
+		{ 0.0008474684048716788, 0.9999576266215539, -1.998808590268909 },
+		{ 0.0008827341188541127, 0.9999558633153277, -1.998709215298266 },
+		{ 0.000919469111387989, 0.9999540265481326, -1.998601470637911 },
+		{ 0.0009577328287511275, 0.9999521133752711, -1.998484655276915 },
+		{ 0.0009975897935297223, 0.9999501205248527, -1.99835799639394 },
+		{ 0.001039103933596543, 0.99994804480684, -1.998220669700717 },
+		{ 0.001082345936360347, 0.9999458827040095, -1.998071768453064 },
+		{ 0.001127387700501486, 0.9999436306173833, -1.997910313263122 },
+		{ 0.001174303307601742, 0.9999412848662315, -1.997735246933261 },
+		{ 0.001223171549119158, 0.9999388414426555, -1.997545409533172 },
+		{ 0.001274073428058094, 0.9999362963388234, -1.997339555616364 },
+		{ 0.001327094003646902, 0.999933645301554, -1.997116328072918 },
+		{ 0.001382320098926278, 0.9999308839959374, -1.996874263166596 },
+		{ 0.001439844801581977, 0.999928007759921, -1.996611760364314 },
+		{ 0.001499763023479209, 0.9999250118497384, -1.996327093699842 },
+		{ 0.001562174604513887, 0.9999218912763045, -1.99601838672466 },
+		{ 0.001627183921257191, 0.9999186408052249, -1.995683600108529 },
+		{ 0.001439844801581978, 0.999928007759921, -1.996611760364314 },
+		{ 0.001499763023479209, 0.9999250118497384, -1.996327093699842 },
+		{ 0.001562174604513887, 0.9999218912763045, -1.99601838672466 },
+		{ 0.001627183921257191, 0.9999186408052249, -1.995683600108529 },
+		{ 0.001694900899627918, 0.9999152550386111, -1.995320527287612 },
+		{ 0.00176543517260569, 0.9999117284150919, -1.994926782049748 },
+		{ 0.001838902234102751, 0.9999080553734327, -1.994499804739558 },
+		{ 0.001915450621122455, 0.9999042293708885, -1.994036731026774 },
+		{ 0.001995142770695815, 0.9999002438648841, -1.993534482765587 },
+		{ 0.002078153880367763, 0.9998960923130215, -1.992989755200841 },
+		{ 0.002164643818785887, 0.9998917681730934, -1.992399003672967 },
+		{ 0.002254745771603515, 0.9998872640850612, -1.991758311117397 },
+		{ 0.00234856533141611, 0.9998825735071406, -1.991063596540442 },
+		{ 0.002446268290822035, 0.9998776866256802, -1.990309980252789 },
+		{ 0.002548070766526764, 0.9998725968994073, -1.989492734541432 },
+		{ 0.002654111664927492, 0.9998672953332601, -1.988606393048207 },
+		{ 0.002764547180277843, 0.9998617729324989, -1.987645083944524 },
+		{ 0.002879585945502868, 0.9998560207027247, -1.986602506088068 },
+		{ 0.002999426949854144, 0.9998500296498994, -1.985471904314097 },
+		{ 0.003124246999331507, 0.9998437883263837, -1.984245551978353 },
+		{ 0.003254243895698513, 0.9998372885569642, -1.982915818392245 },
+		{ 0.002879585945502869, 0.9998560207027247, -1.986602506088068 },
+		{ 0.002999426949854144, 0.9998500296498994, -1.985471904314097 },
+		{ 0.003124246999331508, 0.9998437883263837, -1.984245551978353 },
+		{ 0.00325424389569003, 0.9998372885569642, -1.982915818392245 },
+		{ 0.003389658164956216, 0.9998305172589307, -1.981473496505128 },
+		{ 0.003530714507457886, 0.9998234646220567, -1.979909408870388 },
+		{ 0.003677635391018463, 0.9998161192006798, -1.97821336031361 },
+		{ 0.003830658624312898, 0.9998084670958243, -1.976373825291763 },
+		{ 0.003990071331158019, 0.9998004968630947, -1.974379037342116 },
+		{ 0.004156091824553682, 0.9997921954228509, -1.972215979635027 },
+		{ 0.004329053354214209, 0.9997835480603157, -1.969870253403232 },
+		{ 0.00450916775260186, 0.9997745416974479, -1.967326877258122 },
+		{ 0.004696800307285219, 0.9997651599853317, -1.964568853050405 },
+		{ 0.004892237370315301, 0.9997553882119217, -1.961578444099699 },
+		{ 0.005095831873565652, 0.99974520921245, -1.958335881053669 },
+		{ 0.005307854735592871, 0.9997346074591432, -1.954820518974196 },
+		{ 0.005528712225319319, 0.9997235649717198, -1.951009433631121 },
+		{ 0.005758757290257834, 0.9997120621354871, -1.946877475516094 },
+		{ 0.005998382080297502, 0.9997000809730274, -1.942398311335835 },
+		{ 0.006247967401874891, 0.9996876018727217, -1.937543158053412 },
+		{ 0.006507947718310493, 0.9996746027710849, -1.932280227561847 },
+		{ 0.005758757290257835, 0.9997120621354871, -1.946877475516094 },
+		{ 0.005998382080297503, 0.9997000809730274, -1.942398311335835 },
+		{ 0.006247967401874892, 0.9996876018727217, -1.937543158053412 },
+		{ 0.006507947718306328, 0.9996746027710849, -1.932280227561847 },
+		{ 0.006778741841354946, 0.9996610632422608, -1.926576182309485 },
+		{ 0.007060785949208019, 0.9996469612266877, -1.9203947030618 },
+		{ 0.007354572440850088, 0.9996322713956853, -1.913695479461061 },
+		{ 0.007660583551433226, 0.999616970876502, -1.906436562252011 },
+		{ 0.007979318882664968, 0.999601034345488, -1.898571999876733 },
+		{ 0.00831131999421033, 0.999584434028444, -1.890051478299322 },
+		{ 0.00865712500277434, 0.9995671437898423, -1.880822162777837 },
+		{ 0.009017318875893417, 0.999549134226342, -1.870825956951137 },
+		{ 0.009392497617914877, 0.999530375120496, -1.860000456480908 },
+		{ 0.009783278041699633, 0.9995108362587707, -1.848279213669953 },
+		{ 0.0101903167952465, 0.9994904841609515, -1.835589521591182 },
+		{ 0.01061430080614358, 0.9994692853514866, -1.821854043355935 },
+		{ 0.01105588970163358, 0.999447205542094, -1.806990115568385 },
+		{ 0.01151585641624153, 0.999424207179188, -1.790907776077773 },
+		{ 0.01199496513167562, 0.9994002518974776, -1.773511032852925 },
+		{ 0.01249399408321126, 0.9993753005204216, -1.754697651611612 },
+		{ 0.0130137777684661, 0.9993493114255263, -1.734357665267466 },
+		{ 0.01151585641623928, 0.999424207179188, -1.790907776077773 },
+		{ 0.01199496513167562, 0.9994002518974776, -1.773511032852925 },
+		{ 0.0124939940832072, 0.9993753005204216, -1.754697651611612 },
+		{ 0.01301377776846833, 0.9993493114255263, -1.734357665267466 },
+		{ 0.01355515827187345, 0.9993222421802161, -1.712374327669403 },
+		{ 0.01411907467591776, 0.9992940462722053, -1.688621182151861 },
+		{ 0.01470644039503845, 0.9992646780156977, -1.662965833945175 },
+		{ 0.01531823287628394, 0.9992340884643134, -1.635266410783617 },
+		{ 0.01595546056920448, 0.9992022270470986, -1.605372773879137 },
+		{ 0.01661921653619924, 0.999169042386851, -1.573127320324115 },
+		{ 0.01731059203612167, 0.9991344733093532, -1.538356026352165 },
+		{ 0.01803090151652032, 0.9990984750021721, -1.500894926928912 },
+		{ 0.01878080251871108, 0.9990609740579386, -1.460544493953721 },
+		{ 0.01956185021273523, 0.9990219134333527, -1.417116191079102 },
+		{ 0.02037544146268551, 0.998981227928293, -1.370407882637247 },
+		{ 0.02122296844736804, 0.9989388523610117, -1.320213536771923 },
+		{ 0.02210601372901829, 0.9988947133970254, -1.266314759578515 },
+		{ 0.02302508208503631, 0.9988487458957483, -1.208502182512338 },
+		{ 0.02398310504304197, 0.9988008602241736, -1.146536514932702 },
+		{ 0.02498018317482285, 0.9987509912902826, -1.080213157859834 },
+		{ 0.02601912991326262, 0.9986990495149086, -1.009302301484565 },
+		{ 0.02302508208503236, 0.9988487458957483, -1.208502182512338 },
+		{ 0.02398310504304334, 0.9988008602241736, -1.146536514932702 },
+		{ 0.02498018317482285, 0.9987509912902826, -1.080213157859834 },
+		{ 0.02601912991326183, 0.9986990495149086, -1.009302301484565 },
+		{ 0.02710117479020728, 0.9986449453501234, -0.9335835453333717 },
+		{ 0.0282282699315548, 0.99858858928114, -0.8528508947276944 },
+		{ 0.0294021551873294, 0.9985298999974976, -0.7669306750465569 },
+		{ 0.03062473334130196, 0.9984687635491072, -0.6756278631583817 },
+		{ 0.03189819230351135, 0.9984050905358817, -0.5788170629664604 },
+		{ 0.03189819230351135, 0.9984050905358817, -0.5788170629664604 },
+		{ 0.03189819230351135, 0.9984050905358817, -0.5788170629664604 },
+		{ 0.03189819230351135, 0.9984050905358817, -0.5788170629664604 },
+		{ 0.03189819230351135, 0.9984050905358817, -0.5788170629664604 },
+		{ 0.03189819230351135, 0.9984050905358817, -0.5788170629664604 },
+		{ 0.03189819230351135, 0.9984050905358817, -0.5788170629664604 },
+		{ 0.03189819230351135, 0.9984050905358817, -0.5788170629664604 },
+		{ 0.03189819230351135, 0.9984050905358817, -0.5788170629664604 },
+		{ 0.03189819230351135, 0.9984050905358817, -0.5788170629664604 },
+		{ 0.03189819230351135, 0.9984050905358817, -0.5788170629664604 },
+		{ 0.03189819230351135, 0.9984050905358817, -0.5788170629664604 },
+		{ 0.03189819230351135, 0.9984050905358817, -0.5788170629664604 }
+	}
+};
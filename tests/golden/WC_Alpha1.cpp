@@ -0,0 +1,1647 @@
+#include "Scales.hpp"
+Scale wc_alpha1 = {
+	.name = "Alpha Spread 1",
+	.description = "Omitting the octave, Wendy Carlos' Alpha scale is a based on a fixed interval size whose multiples approximate justly intonated intervals. Here the step size is 78 cents - 9 divisions of the perfect fifth, or the minor third in four steps. This scale is constructed from ascending pairs of intervals.",
+	.scalename = {
+		"4/10; E0-",
+		"5/10; E0-",
+		"4/12; E0-",
+		"5/11; E0-",
+		"6/10; E0-",
+		"7/8; E0-",
+		"8/7; E0-",
+		"9/7; E0-",
+		"10/5; E0-",
+		"11/5; E0-",
+		"12/4; E0-"},
+	.notedesc = {
+		"0",
+		"+4",
+		"+10",
+		"+4",
+		"+10",
+		"+4",
+		"+10",
+		"+4",
+		"+10",
+		"+4",
+		"+10",
+		"+4",
+		"+10",
+		"+4",
+		"+10",
+		"+4",
+		"+10",
+		"+4",
+		"+10",
+		"+4",
+		"+10",
+		"0",
+		"+5",
+		"+10",
+		"+5",
+		"+10",
+		"+5",
+		"+10",
+		"+5",
+		"+10",
+		"+5",
+		"+10",
+		"+5",
+		"+10",
+		"+5",
+		"+10",
+		"+5",
+		"+10",
+		"+5",
+		"+10",
+		"+5",
+		"+10",
+		"0",
+		"+4",
+		"+12",
+		"+4",
+		"+12",
+		"+4",
+		"+12",
+		"+4",
+		"+12",
+		"+4",
+		"+12",
+		"+4",
+		"+12",
+		"+4",
+		"+12",
+		"+4",
+		"+12",
+		"+4",
+		"+12",
+		"+4",
+		"+12",
+		"0",
+		"+5",
+		"+11",
+		"+5",
+		"+11",
+		"+5",
+		"+11",
+		"+5",
+		"+11",
+		"+5",
+		"+11",
+		"+5",
+		"+11",
+		"+5",
+		"+11",
+		"+5",
+		"+11",
+		"+5",
+		"+11",
+		"+5",
+		"+11",
+		"0",
+		"+6",
+		"+10",
+		"+6",
+		"+10",
+		"+6",
+		"+10",
+		"+6",
+		"+10",
+		"+6",
+		"+10",
+		"+6",
+		"+10",
+		"+6",
+		"+10",
+		"+6",
+		"+10",
+		"+6",
+		"+10",
+		"+6",
+		"+10",
+		"0",
+		"+7",
+		"+8",
+		"+7",
+		"+8",
+		"+7",
+		"+8",
+		"+7",
+		"+8",
+		"+7",
+		"+8",
+		"+7",
+		"+8",
+		"+7",
+		"+8",
+		"+7",
+		"+8",
+		"+7",
+		"+8",
+		"+7",
+		"+8",
+		"0",
+		"+8",
+		"+7",
+		"+8",
+		"+7",
+		"+8",
+		"+7",
+		"+8",
+		"+7",
+		"+8",
+		"+7",
+		"+8",
+		"+7",
+		"+8",
+		"+7",
+		"+8",
+		"+7",
+		"+8",
+		"+7",
+		"+8",
+		"+7",
+		"0",
+		"+9",
+		"+7",
+		"+9",
+		"+7",
+		"+9",
+		"+7",
+		"+9",
+		"+7",
+		"+9",
+		"+7",
+		"+9",
+		"+7",
+		"+9",
+		"+7",
+		"+9",
+		"+7",
+		"+9",
+		"+7",
+		"+9",
+		"+7",
+		"0",
+		"+10",
+		"+5",
+		"+10",
+		"+5",
+		"+10",
+		"+5",
+		"+10",
+		"+5",
+		"+10",
+		"+5",
+		"+10",
+		"+5",
+		"+10",
+		"+5",
+		"+10",
+		"+5",
+		"+10",
+		"+5",
+		"+10",
+		"+5",
+		"0",
+		"+11",
+		"+5",
+		"+11",
+		"+5",
+		"+11",
+		"+5",
+		"+11",
+		"+5",
+		"+11",
+		"+5",
+		"+11",
+		"+5",
+		"+11",
+		"+5",
+		"+11",
+		"+5",
+		"+11",
+		"+5",
+		"+11",
+		"+5",
+		"0",
+		"+12",
+		"+4",
+		"+12",
+		"+4",
+		"+12",
+		"+4",
+		"+12",
+		"+4",
+		"+12",
+		"+4",
+		"+12",
+		"+4",
+		"+12",
+		"+4",
+		"+12",
+		"+4",
+		"+12",
+		"+4",
+		"+12",
+		"+4"},
+	.c_maxq48000 = {
+		0.002696759197496541,
+		0.00322931171048734,
+		0.005067333230400245,
+		0.006068023632612137,
+		0.009521749695618314,
+		0.0114020924912147,
+		0.01789180090271,
+		0.02142505056827695,
+		0.03361950794500768,
+		0.04025864482391357,
+		0.06317258506343185,
+		0.07564782532918744,
+		0.118704161587503,
+		0.1421457056506791,
+		0.2230505204756702,
+		0.2670982483237834,
+		0.4191220764218358,
+		0.5018897611508155,
+		0.7875494509922566,
+		0.9430736963975558,
+		1.479841250676461,
+		0.002696759197496541,
+		0.003378134346236459,
+		0.005300860977231924,
+		0.006640200040268774,
+		0.01041959071689649,
+		0.01305225075607432,
+		0.0204811767699535,
+		0.02565604180089533,
+		0.04025864482391359,
+		0.05043057271811587,
+		0.07913405080491885,
+		0.09912841132759689,
+		0.1555491503548013,
+		0.1948508891076573,
+		0.3057538181098222,
+		0.3830069349197241,
+		0.6010023010443825,
+		0.7528542100495704,
+		1.181354882479026,
+		1.479841250676462,
+		2.322119825384783,
+		0.002696759197496541,
+		0.00322931171048734,
+		0.005545150836216224,
+		0.006640200040268772,
+		0.0114020924912147,
+		0.01365376294632499,
+		0.02344529788605829,
+		0.02807524494200198,
+		0.04820886985345354,
+		0.05772909502325606,
+		0.0991284113275968,
+		0.1187041615875029,
+		0.2038305806007042,
+		0.2440827796194554,
+		0.4191220764218356,
+		0.5018897611508153,
+		0.8618104036521793,
+		1.031999605792528,
+		1.772078383901703,
+		2.122026127637816,
+		2.122026127637816,
+		0.002696759197496541,
+		0.003378134346236459,
+		0.005545150836216224,
+		0.00694621325933491,
+		0.0114020924912147,
+		0.01428299578964785,
+		0.02344529788605829,
+		0.02936909091481466,
+		0.04820886985345355,
+		0.06038953689168004,
+		0.09912841132759682,
+		0.1241746357273857,
+		0.2038305806007043,
+		0.2553313198226113,
+		0.4191220764218358,
+		0.5250193205759378,
+		0.8618104036521798,
+		1.079559245491391,
+		1.772078383901704,
+		2.219819573968179,
+		2.219819573968179,
+		0.002696759197496541,
+		0.003533815464193841,
+		0.005545150836216225,
+		0.00726632907917743,
+		0.0114020924912147,
+		0.01494122679067072,
+		0.0234452978860583,
+		0.03072256370138523,
+		0.04820886985345357,
+		0.06317258506343186,
+		0.09912841132759689,
+		0.1298972163386416,
+		0.2038305806007044,
+		0.2670982483237835,
+		0.4191220764218361,
+		0.5492148043545949,
+		0.8618104036521805,
+		1.129310668322331,
+		1.772078383901706,
+		2.322119825384783,
+		2.322119825384783,
+		0.002696759197496541,
+		0.003696671137099124,
+		0.005300860977231924,
+		0.00726632907917743,
+		0.01041959071689649,
+		0.01428299578964785,
+		0.02048117676995349,
+		0.028075244942002,
+		0.04025864482391357,
+		0.05518585807640588,
+		0.07913405080491884,
+		0.108475596131773,
+		0.1555491503548013,
+		0.2132241006355641,
+		0.3057538181098221,
+		0.419122076421836,
+		0.6010023010443823,
+		0.8238436200248747,
+		1.181354882479026,
+		1.619380959481068,
+		2.322119825384783,
+		0.002696759197496541,
+		0.003867032003885117,
+		0.005300860977231924,
+		0.007601197417304025,
+		0.01041959071689649,
+		0.01494122679067072,
+		0.0204811767699535,
+		0.02936909091481467,
+		0.04025864482391359,
+		0.0577290950232561,
+		0.07913405080491885,
+		0.1134746874484645,
+		0.1555491503548013,
+		0.2230505204756703,
+		0.3057538181098222,
+		0.4384372920794562,
+		0.6010023010443825,
+		0.8618104036521804,
+		1.181354882479026,
+		1.69401003349992,
+		2.322119825384783,
+		0.002696759197496541,
+		0.004045243940959946,
+		0.005545150836216225,
+		0.008317942455795195,
+		0.0114020924912147,
+		0.01710358329626512,
+		0.0234452978860583,
+		0.03516886094450782,
+		0.04820886985345357,
+		0.07231518440958604,
+		0.09912841132759688,
+		0.1486964819373572,
+		0.2038305806007044,
+		0.3057538181098221,
+		0.419122076421836,
+		0.6286994559031843,
+		0.8618104036521804,
+		1.29274920685042,
+		1.772078383901705,
+		1.772078383901705,
+		1.772078383901705,
+		0.002696759197496541,
+		0.004231668764425179,
+		0.005300860977231924,
+		0.008317942455795195,
+		0.01041959071689649,
+		0.01635009036613918,
+		0.0204811767699535,
+		0.03213841119983571,
+		0.04025864482391359,
+		0.06317258506343186,
+		0.07913405080491885,
+		0.1241746357273858,
+		0.1555491503548013,
+		0.2440827796194557,
+		0.3057538181098222,
+		0.4797791671203641,
+		0.6010023010443826,
+		0.9430736963975568,
+		1.181354882479027,
+		1.853744509531458,
+		2.322119825384783,
+		0.002696759197496541,
+		0.00442668496465564,
+		0.005545150836216225,
+		0.009102272036825971,
+		0.0114020924912147,
+		0.01871634347009131,
+		0.02344529788605829,
+		0.03848506301208972,
+		0.04820886985345357,
+		0.07913405080491881,
+		0.09912841132759684,
+		0.1627176235836813,
+		0.2038305806007043,
+		0.3345844772939999,
+		0.4191220764218357,
+		0.687981854580908,
+		0.8618104036521796,
+		1.41464731436623,
+		1.772078383901703,
+		1.772078383901703,
+		1.772078383901703,
+		0.002696759197496541,
+		0.00463068847473229,
+		0.005545150836216224,
+		0.009521749695618314,
+		0.0114020924912147,
+		0.01957888503204676,
+		0.02344529788605829,
+		0.04025864482391356,
+		0.04820886985345354,
+		0.08278093877180241,
+		0.0991284113275968,
+		0.1702164554697186,
+		0.2038305806007042,
+		0.3500037827856086,
+		0.4191220764218355,
+		0.7196874569276215,
+		0.8618104036521792,
+		1.47984125067646,
+		1.772078383901702,
+		1.772078383901702,
+		1.772078383901702
+	},
+	.c_maxq96000 = {
+		0.001348379598748271,
+		0.00161465585524367,
+		0.002533666615200123,
+		0.003034011816306068,
+		0.004760874847809157,
+		0.005701046245607349,
+		0.008945900451355,
+		0.01071252528413847,
+		0.01680975397250384,
+		0.02012932241195679,
+		0.03158629253171592,
+		0.03782391266459372,
+		0.0593520807937515,
+		0.07107285282533954,
+		0.1115252602378351,
+		0.1335491241618917,
+		0.2095610382109179,
+		0.2509448805754078,
+		0.3937747254961283,
+		0.4715368481987779,
+		0.7399206253382306,
+		0.001348379598748271,
+		0.001689067173118229,
+		0.002650430488615962,
+		0.003320100020134387,
+		0.005209795358448245,
+		0.006526125378037158,
+		0.01024058838497675,
+		0.01282802090044766,
+		0.02012932241195679,
+		0.02521528635905793,
+		0.03956702540245943,
+		0.04956420566379845,
+		0.07777457517740065,
+		0.09742544455382864,
+		0.1528769090549111,
+		0.191503467459862,
+		0.3005011505221912,
+		0.3764271050247852,
+		0.5906774412395132,
+		0.7399206253382311,
+		1.161059912692392,
+		0.001348379598748271,
+		0.00161465585524367,
+		0.002772575418108112,
+		0.003320100020134386,
+		0.005701046245607349,
+		0.006826881473162494,
+		0.01172264894302914,
+		0.01403762247100099,
+		0.02410443492672677,
+		0.02886454751162803,
+		0.0495642056637984,
+		0.05935208079375147,
+		0.1019152903003521,
+		0.1220413898097277,
+		0.2095610382109178,
+		0.2509448805754076,
+		0.4309052018260897,
+		0.5159998028962639,
+		0.8860391919508516,
+		1.061013063818908,
+		1.061013063818908,
+		0.001348379598748271,
+		0.001689067173118229,
+		0.002772575418108112,
+		0.003473106629667455,
+		0.00570104624560735,
+		0.007141497894823923,
+		0.01172264894302915,
+		0.01468454545740733,
+		0.02410443492672678,
+		0.03019476844584002,
+		0.04956420566379841,
+		0.06208731786369286,
+		0.1019152903003522,
+		0.1276656599113057,
+		0.2095610382109179,
+		0.2625096602879689,
+		0.4309052018260899,
+		0.5397796227456955,
+		0.8860391919508519,
+		1.10990978698409,
+		1.10990978698409,
+		0.001348379598748271,
+		0.001766907732096921,
+		0.002772575418108113,
+		0.003633164539588715,
+		0.00570104624560735,
+		0.007470613395335358,
+		0.01172264894302915,
+		0.01536128185069261,
+		0.02410443492672679,
+		0.03158629253171593,
+		0.04956420566379845,
+		0.06494860816932081,
+		0.1019152903003522,
+		0.1335491241618918,
+		0.209561038210918,
+		0.2746074021772975,
+		0.4309052018260903,
+		0.5646553341611655,
+		0.8860391919508528,
+		1.161059912692392,
+		1.161059912692392,
+		0.001348379598748271,
+		0.001848335568549562,
+		0.002650430488615962,
+		0.003633164539588715,
+		0.005209795358448244,
+		0.007141497894823923,
+		0.01024058838497675,
+		0.014037622471001,
+		0.02012932241195679,
+		0.02759292903820294,
+		0.03956702540245942,
+		0.0542377980658865,
+		0.07777457517740065,
+		0.1066120503177821,
+		0.1528769090549111,
+		0.209561038210918,
+		0.3005011505221912,
+		0.4119218100124373,
+		0.5906774412395132,
+		0.8096904797405338,
+		1.161059912692391,
+		0.001348379598748271,
+		0.001933516001942558,
+		0.002650430488615962,
+		0.003800598708652013,
+		0.005209795358448245,
+		0.007470613395335358,
+		0.01024058838497675,
+		0.01468454545740734,
+		0.02012932241195679,
+		0.02886454751162805,
+		0.03956702540245943,
+		0.05673734372423225,
+		0.07777457517740065,
+		0.1115252602378352,
+		0.1528769090549111,
+		0.2192186460397281,
+		0.3005011505221912,
+		0.4309052018260902,
+		0.5906774412395132,
+		0.8470050167499602,
+		1.161059912692391,
+		0.001348379598748271,
+		0.002022621970479973,
+		0.002772575418108113,
+		0.004158971227897598,
+		0.00570104624560735,
+		0.008551791648132559,
+		0.01172264894302915,
+		0.01758443047225391,
+		0.02410443492672678,
+		0.03615759220479302,
+		0.04956420566379844,
+		0.07434824096867862,
+		0.1019152903003522,
+		0.1528769090549111,
+		0.209561038210918,
+		0.3143497279515922,
+		0.4309052018260902,
+		0.6463746034252099,
+		0.8860391919508526,
+		0.8860391919508526,
+		0.8860391919508526,
+		0.001348379598748271,
+		0.00211583438221259,
+		0.002650430488615962,
+		0.004158971227897598,
+		0.005209795358448245,
+		0.008175045183069591,
+		0.01024058838497675,
+		0.01606920559991785,
+		0.02012932241195679,
+		0.03158629253171593,
+		0.03956702540245943,
+		0.0620873178636929,
+		0.07777457517740065,
+		0.1220413898097278,
+		0.1528769090549111,
+		0.2398895835601821,
+		0.3005011505221913,
+		0.4715368481987784,
+		0.5906774412395134,
+		0.9268722547657292,
+		1.161059912692392,
+		0.001348379598748271,
+		0.00221334248232782,
+		0.002772575418108113,
+		0.004551136018412985,
+		0.00570104624560735,
+		0.009358171735045656,
+		0.01172264894302915,
+		0.01924253150604486,
+		0.02410443492672678,
+		0.0395670254024594,
+		0.04956420566379842,
+		0.08135881179184065,
+		0.1019152903003522,
+		0.167292238647,
+		0.2095610382109179,
+		0.343990927290454,
+		0.4309052018260898,
+		0.7073236571831149,
+		0.8860391919508516,
+		0.8860391919508516,
+		0.8860391919508516,
+		0.001348379598748271,
+		0.002315344237366145,
+		0.002772575418108112,
+		0.004760874847809157,
+		0.005701046245607349,
+		0.009789442516023381,
+		0.01172264894302914,
+		0.02012932241195678,
+		0.02410443492672677,
+		0.04139046938590121,
+		0.0495642056637984,
+		0.08510822773485932,
+		0.1019152903003521,
+		0.1750018913928043,
+		0.2095610382109178,
+		0.3598437284638107,
+		0.4309052018260896,
+		0.7399206253382299,
+		0.8860391919508512,
+		0.8860391919508512,
+		0.8860391919508512
+	},
+	.c_bpre4800022 = {
+		{ 0.001347469458600696, 0.9986525305414123, -1.998645262951418 },
+		{ 0.001613351416357432, 0.9983866485836552, -1.998376228571438 },
+		{ 0.002530461266762438, 0.9974695387332464, -1.997443893376469 },
+		{ 0.003029414774778058, 0.9969705852252245, -1.996933820177744 },
+		{ 0.004749559228852367, 0.9952504407711482, -1.995159993067181 },
+		{ 0.005684828051816138, 0.994315171948189, -1.994185535086893 },
+		{ 0.008905986088643427, 0.9910940139116784, -1.990775332705413 },
+		{ 0.01065532917499228, 0.9893446708253538, -1.988888102911507 },
+		{ 0.01666925054383737, 0.9833307494561927, -1.982210005161859 },
+		{ 0.01992805503173133, 0.9800719449685272, -1.978467556565124 },
+		{ 0.03109265657862537, 0.9689073434213745, -1.964979916218773 },
+		{ 0.03711753421597976, 0.9628824657840503, -1.957268750863979 },
+		{ 0.05762508161791295, 0.9423749183820871, -1.928706289850931 },
+		{ 0.06860576988638302, 0.9313942301183908, -1.911914879074219 },
+		{ 0.1055311765137178, 0.8944688234863436, -1.847537543316886 },
+		{ 0.1250154970574204, 0.8749845029426033, -1.808499121684198 },
+		{ 0.1890600296930273, 0.8109399703084841, -1.654196598308615 },
+		{ 0.2219349801193393, 0.7780650198833042, -1.558784622482731 },
+		{ 0.3254938076245832, 0.6745061923769966, -1.181505422291749 },
+		{ 0.3759574319075724, 0.6240425680927574, -0.953805563990354 },
+		{ 0.5228496363035631, 0.4771503637707759, -0.1341603716929406 },
+		{ 0.001347469458600696, 0.9986525305414123, -1.998645262951418 },
+		{ 0.001687638534132213, 0.9983123614659097, -1.998300959354718 },
+		{ 0.002646921531430786, 0.9973530784685697, -1.997325016588208 },
+		{ 0.003314595126832436, 0.996685404873168, -1.996641385837846 },
+		{ 0.005196247283362061, 0.9948037527166385, -1.994695467924613 },
+		{ 0.006504879666411491, 0.9934951203336011, -1.993325315416864 },
+		{ 0.01018835378535097, 0.9898116462150227, -1.989394317313586 },
+		{ 0.01274611051096949, 0.9872538894892359, -1.986599885979389 },
+		{ 0.01992805503173132, 0.9800719449685272, -1.978467556565124 },
+		{ 0.02490002373852798, 0.9750999762615239, -1.972588931812808 },
+		{ 0.0387944974557937, 0.9612055025443308, -1.955067970054853 },
+		{ 0.04835592733269153, 0.9516440726673614, -1.942063070625092 },
+		{ 0.07482716255354938, 0.9251728374481889, -1.901929384243898 },
+		{ 0.09282995857778933, 0.9071700414226501, -1.871079862364603 },
+		{ 0.1417648058559006, 0.8582351941458386, -1.772050620081118 },
+		{ 0.174283375703865, 0.8257166242971977, -1.693434290872537 },
+		{ 0.2595529779350259, 0.7404470220650129, -1.435467119912717 },
+		{ 0.3136907429057714, 0.6863092570947178, -1.230568287905765 },
+		{ 0.4460482385604103, 0.5539517614401526, -0.5899909176988574 },
+		{ 0.5228496363035632, 0.4771503637707759, -0.1341603716929406 },
+		{ 0.6868461419472982, 0.3131538580554312, 0.8963688421595599 },
+		{ 0.001347469458600696, 0.9986525305414123, -1.998645262951418 },
+		{ 0.001613351416357432, 0.9983866485836552, -1.998376228571438 },
+		{ 0.002768733294847577, 0.9972312667051649, -1.997200560699849 },
+		{ 0.003314595126832437, 0.996685404873168, -1.996641385837846 },
+		{ 0.005684828051816138, 0.994315171948189, -1.994185535086893 },
+		{ 0.006803626998568717, 0.9931963730014529, -1.993010585062444 },
+		{ 0.01165421400227952, 0.9883457859977609, -1.987799331375289 },
+		{ 0.01393954978465106, 0.9860604502153616, -1.985277776489677 },
+		{ 0.02381626643578984, 0.9761837335643951, -1.973887754265122 },
+		{ 0.02845195856223387, 0.9715480414378128, -1.968263712512127 },
+		{ 0.04835592733269158, 0.9516440726673614, -1.942063070625092 },
+		{ 0.05762508161791297, 0.9423749183820871, -1.928706289850931 },
+		{ 0.09689389452917346, 0.9031061054711058, -1.863708754876248 },
+		{ 0.1148885517003137, 0.8851114483060925, -1.829235310265093 },
+		{ 0.1890600296930275, 0.8109399703084841, -1.654196598308615 },
+		{ 0.2219349801193393, 0.7780650198833042, -1.558784622482731 },
+		{ 0.3500796290689659, 0.6499203709318427, -1.074203843157931 },
+		{ 0.4030966361970856, 0.5969033638036766, -0.819376123034856 },
+		{ 0.5877149884020189, 0.4122850116077734, 0.2823553492118576 },
+		{ 0.6538953226211645, 0.3461046773838381, 0.7050046739715251 },
+		{ 0.6538953226211645, 0.3461046773838381, 0.7050046739715251 },
+		{ 0.001347469458600696, 0.9986525305414123, -1.998645262951418 },
+		{ 0.001687638534132213, 0.9983123614659097, -1.998300959354718 },
+		{ 0.002768733294847577, 0.9972312667051649, -1.997200560699849 },
+		{ 0.003467084950885449, 0.9965329150491303, -1.996484748935567 },
+		{ 0.005684828051816136, 0.994315171948189, -1.994185535086893 },
+		{ 0.007116054723134286, 0.9928839452768776, -1.992680670803174 },
+		{ 0.01165421400227951, 0.9883457859977609, -1.987799331375289 },
+		{ 0.01457723220711919, 0.9854227677931298, -1.984566575085883 },
+		{ 0.02381626643578983, 0.9761837335643951, -1.973887754265122 },
+		{ 0.02974345521320871, 0.9702565447867983, -1.966664977198744 },
+		{ 0.04835592733269155, 0.9516440726673614, -1.942063070625092 },
+		{ 0.06019915728052893, 0.9398008427195328, -1.924864835661438 },
+		{ 0.09689389452917341, 0.9031061054711058, -1.863708754876248 },
+		{ 0.119852539645646, 0.8801474603558088, -1.819192307594272 },
+		{ 0.1890600296930273, 0.8109399703084841, -1.654196598308615 },
+		{ 0.2308809566329955, 0.7691190433675483, -1.530844183061636 },
+		{ 0.3500796290689659, 0.6499203709318427, -1.074203843157931 },
+		{ 0.417123494669822, 0.5828765053313968, -0.7466689389871856 },
+		{ 0.5877149884020187, 0.4122850116077734, 0.2823553492118576 },
+		{ 0.6704119028438946, 0.329588097173336, 0.8036182299967832 },
+		{ 0.6704119028438946, 0.329588097173336, 0.8036182299967832 },
+		{ 0.001347469458600696, 0.9986525305414123, -1.998645262951418 },
+		{ 0.00176535018127956, 0.998234649818749, -1.99822217296718 },
+		{ 0.002768733294847577, 0.9972312667051649, -1.997200560699849 },
+		{ 0.003626574854171817, 0.9963734251458395, -1.996320721514053 },
+		{ 0.005684828051816136, 0.994315171948189, -1.994185535086893 },
+		{ 0.007442805996643361, 0.9925571940042222, -1.9923347869547 },
+		{ 0.01165421400227951, 0.9883457859977609, -1.987799331375289 },
+		{ 0.01524389285458085, 0.9847561071454405, -1.983819499853445 },
+		{ 0.02381626643578982, 0.9761837335643951, -1.973887754265122 },
+		{ 0.03109265657862535, 0.9689073434213745, -1.964979916218773 },
+		{ 0.04835592733269153, 0.9516440726673614, -1.942063070625092 },
+		{ 0.06288440012535, 0.937115599874718, -1.920795801095511 },
+		{ 0.09689389452917355, 0.9031061054711058, -1.863708754876248 },
+		{ 0.1250154970574202, 0.8749845029426033, -1.808499121684198 },
+		{ 0.1890600296930278, 0.8109399703084841, -1.654196598308615 },
+		{ 0.2401295101761296, 0.7598704898243323, -1.501054803046466 },
+		{ 0.3500796290689661, 0.6499203709318427, -1.074203843157931 },
+		{ 0.4314439993090358, 0.5685560006911582, -0.6702171734671794 },
+		{ 0.5877149884020186, 0.4122850116077734, 0.2823553492118576 },
+		{ 0.6868461419472979, 0.3131538580554312, 0.8963688421595599 },
+		{ 0.6868461419472979, 0.3131538580554312, 0.8963688421595599 },
+		{ 0.001347469458600696, 0.9986525305414123, -1.998645262951418 },
+		{ 0.001846629281000457, 0.9981533707190028, -1.998139717962173 },
+		{ 0.002646921531430786, 0.9973530784685697, -1.997325016588208 },
+		{ 0.003626574854171817, 0.9963734251458395, -1.996320721514053 },
+		{ 0.005196247283362063, 0.9948037527166385, -1.994695467924613 },
+		{ 0.007116054723134285, 0.9928839452768776, -1.992680670803174 },
+		{ 0.01018835378535097, 0.9898116462150227, -1.989394317313586 },
+		{ 0.01393954978465105, 0.9860604502153616, -1.985277776489677 },
+		{ 0.01992805503173133, 0.9800719449685272, -1.978467556565124 },
+		{ 0.02721572786540016, 0.9727842721346122, -1.969780996570709 },
+		{ 0.03879449745579382, 0.9612055025443308, -1.955067970054853 },
+		{ 0.05279319450089983, 0.9472068054992469, -1.935761674097223 },
+		{ 0.07482716255354938, 0.9251728374481889, -1.901929384243898 },
+		{ 0.1011255506839656, 0.8988744493174344, -1.855872151680936 },
+		{ 0.1417648058559006, 0.8582351941458386, -1.772050620081118 },
+		{ 0.1890600296930276, 0.8109399703084841, -1.654196598308615 },
+		{ 0.2595529779350262, 0.7404470220650129, -1.435467119912717 },
+		{ 0.337623863084635, 0.662376136915557, -1.129428466282379 },
+		{ 0.4460482385604103, 0.5539517614401526, -0.5899909176988574 },
+		{ 0.5550054066680118, 0.4449945933855006, 0.0701846135840009 },
+		{ 0.6868461419472979, 0.3131538580554312, 0.8963688421595599 },
+		{ 0.001347469458600696, 0.9986525305414123, -1.998645262951418 },
+		{ 0.001931644801856851, 0.9980683551981846, -1.99805341577209 },
+		{ 0.002646921531430786, 0.9973530784685697, -1.997325016588208 },
+		{ 0.003793387476006387, 0.9962066125240011, -1.996148944129116 },
+		{ 0.005196247283362061, 0.9948037527166385, -1.994695467924613 },
+		{ 0.007442805996643361, 0.9925571940042222, -1.9923347869547 },
+		{ 0.01018835378535097, 0.9898116462150227, -1.989394317313586 },
+		{ 0.01457723220711918, 0.9854227677931298, -1.984566575085883 },
+		{ 0.01992805503173132, 0.9800719449685272, -1.978467556565124 },
+		{ 0.02845195856223385, 0.9715480414378128, -1.968263712512127 },
+		{ 0.0387944974557937, 0.9612055025443308, -1.955067970054853 },
+		{ 0.05515780955672855, 0.9448421904433061, -1.932334228830562 },
+		{ 0.07482716255354938, 0.9251728374481889, -1.901929384243898 },
+		{ 0.1055311765137182, 0.8944688234863436, -1.847537543316886 },
+		{ 0.1417648058559006, 0.8582351941458386, -1.772050620081118 },
+		{ 0.1968536855640221, 0.803146314438461, -1.632598262690103 },
+		{ 0.2595529779350259, 0.7404470220650129, -1.435467119912717 },
+		{ 0.3500796290689661, 0.6499203709318427, -1.074203843157931 },
+		{ 0.4460482385604103, 0.5539517614401526, -0.5899909176988574 },
+		{ 0.5713035148852275, 0.4286964851232248, 0.1755929958024817 },
+		{ 0.6868461419472979, 0.3131538580554312, 0.8963688421595599 },
+		{ 0.001347469458600696, 0.9986525305414123, -1.998645262951418 },
+		{ 0.002020578677130739, 0.9979794213228725, -1.997963073865584 },
+		{ 0.002768733294847577, 0.9972312667051649, -1.997200560699849 },
+		{ 0.004150334710762922, 0.9958496652892376, -1.995780621096767 },
+		{ 0.005684828051816136, 0.994315171948189, -1.994185535086893 },
+		{ 0.008515345207886018, 0.9914846547923605, -1.991193373732296 },
+		{ 0.01165421400227951, 0.9883457859977609, -1.987799331375289 },
+		{ 0.01743070688307307, 0.9825692931171086, -1.981343353079144 },
+		{ 0.02381626643578983, 0.9761837335643951, -1.973887754265122 },
+		{ 0.03551169445457634, 0.9644883055455156, -1.959353917557134 },
+		{ 0.04835592733269153, 0.9516440726673614, -1.942063070625092 },
+		{ 0.07165180658177632, 0.9283481934211244, -1.907068839507493 },
+		{ 0.09689389452917326, 0.9031061054711058, -1.863708754876248 },
+		{ 0.1417648058559006, 0.8582351941458386, -1.772050620081118 },
+		{ 0.1890600296930276, 0.8109399703084841, -1.654196598308615 },
+		{ 0.2697364075106758, 0.7302635924893244, -1.399425146891565 },
+		{ 0.3500796290689661, 0.6499203709318427, -1.074203843157931 },
+		{ 0.476058286431261, 0.52394171356926, -0.4182882487103079 },
+		{ 0.5877149884020186, 0.4122850116077734, 0.2823553492118576 },
+		{ 0.5877149884020186, 0.4122850116077734, 0.2823553492118576 },
+		{ 0.5877149884020186, 0.4122850116077734, 0.2823553492118576 },
+		{ 0.001347469458600696, 0.9986525305414123, -1.998645262951418 },
+		{ 0.002113599668130014, 0.9978864003318861, -1.997868512226844 },
+		{ 0.002646921531430786, 0.9973530784685697, -1.997325016588208 },
+		{ 0.004150334710762922, 0.9958496652892376, -1.995780621096767 },
+		{ 0.005196247283362061, 0.9948037527166385, -1.994695467924613 },
+		{ 0.008141688585770721, 0.9918583114152306, -1.991592082218943 },
+		{ 0.01018835378535097, 0.9898116462150227, -1.989394317313586 },
+		{ 0.01594076047586626, 0.9840592395244329, -1.983034685807653 },
+		{ 0.01992805503173132, 0.9800719449685272, -1.978467556565124 },
+		{ 0.03109265657862535, 0.9689073434213745, -1.964979916218773 },
+		{ 0.0387944974557937, 0.9612055025443308, -1.955067970054853 },
+		{ 0.06019915728052933, 0.9398008427195328, -1.924864835661438 },
+		{ 0.07482716255354938, 0.9251728374481889, -1.901929384243898 },
+		{ 0.1148885517003139, 0.8851114483060925, -1.829235310265093 },
+		{ 0.1417648058559006, 0.8582351941458386, -1.772050620081118 },
+		{ 0.2132851307485106, 0.7867148692525309, -1.584989488574272 },
+		{ 0.2595529779350257, 0.7404470220650129, -1.435467119912717 },
+		{ 0.3759574319075726, 0.6240425680927574, -0.953805563990354 },
+		{ 0.4460482385604103, 0.5539517614401526, -0.5899909176988574 },
+		{ 0.6042112036873014, 0.3957887963467473, 0.3896933773671528 },
+		{ 0.6868461419472979, 0.3131538580554312, 0.8963688421595599 },
+		{ 0.001347469458600696, 0.9986525305414123, -1.998645262951418 },
+		{ 0.002210896015333815, 0.9977891039846712, -1.997769530117981 },
+		{ 0.002768733294847577, 0.9972312667051649, -1.997200560699849 },
+		{ 0.004540792932014889, 0.995459207067995, -1.995376544474045 },
+		{ 0.005684828051816136, 0.994315171948189, -1.994185535086893 },
+		{ 0.009314498802103074, 0.9906855011982982, -1.990336842923394 },
+		{ 0.01165421400227951, 0.9883457859977609, -1.987799331375289 },
+		{ 0.01905856138761069, 0.9809414386124782, -1.979474635651014 },
+		{ 0.02381626643578983, 0.9761837335643951, -1.973887754265122 },
+		{ 0.03879449745579383, 0.9612055025443308, -1.955067970054853 },
+		{ 0.04835592733269155, 0.9516440726673614, -1.942063070625092 },
+		{ 0.07813707813761747, 0.9218629218628531, -1.896476446972718 },
+		{ 0.09689389452917341, 0.9031061054711058, -1.863708754876248 },
+		{ 0.154047803929606, 0.84595219607196, -1.743588083929804 },
+		{ 0.1890600296930273, 0.8109399703084841, -1.654196598308615 },
+		{ 0.2910644442155418, 0.708935555785989, -1.320202991791037 },
+		{ 0.350079629068966, 0.6499203709318427, -1.074203843157931 },
+		{ 0.5070379280078837, 0.4929620719954549, -0.2321801645821096 },
+		{ 0.5877149884020189, 0.4122850116077734, 0.2823553492118576 },
+		{ 0.5877149884020189, 0.4122850116077734, 0.2823553492118576 },
+		{ 0.5877149884020189, 0.4122850116077734, 0.2823553492118576 },
+		{ 0.001347469458600696, 0.9986525305414123, -1.998645262951418 },
+		{ 0.002312668891820591, 0.9976873311082102, -1.997665912610766 },
+		{ 0.002768733294847577, 0.9972312667051649, -1.997200560699849 },
+		{ 0.004749559228852367, 0.9952504407711482, -1.995159993067181 },
+		{ 0.005684828051816138, 0.994315171948189, -1.994185535086893 },
+		{ 0.009741703678731091, 0.9902582963216624, -1.989876841211253 },
+		{ 0.01165421400227952, 0.9883457859977609, -1.987799331375289 },
+		{ 0.01992805503173134, 0.9800719449685272, -1.978467556565124 },
+		{ 0.02381626643578984, 0.9761837335643951, -1.973887754265122 },
+		{ 0.04054559404647843, 0.9594544059535577, -1.952744473782394 },
+		{ 0.04835592733269158, 0.9516440726673614, -1.942063070625092 },
+		{ 0.08158724293551645, 0.9184127570661336, -1.890688004686162 },
+		{ 0.09689389452917346, 0.9031061054711058, -1.863708754876248 },
+		{ 0.1605444602587953, 0.8394555397418859, -1.727932114911089 },
+		{ 0.1890600296930273, 0.8109399703084841, -1.654196598308615 },
+		{ 0.3022147672454895, 0.6977852327551602, -1.276754079360691 },
+		{ 0.3500796290689661, 0.6499203709318427, -1.074203843157931 },
+		{ 0.5228496363035631, 0.4771503637707759, -0.1341603716929406 },
+		{ 0.5877149884020189, 0.4122850116077734, 0.2823553492118576 },
+		{ 0.5877149884020189, 0.4122850116077734, 0.2823553492118576 },
+		{ 0.5877149884020189, 0.4122850116077734, 0.2823553492118576 }
+	},
+	.c_bpre9600022 = {
+		{ 0.0006739618415824315, 0.9993260381584242, -1.99932422064784 },
+		{ 0.0008070013337549778, 0.9991929986662511, -1.999190392610378 },
+		{ 0.001266032051959781, 0.9987339679480448, -1.998727552540077 },
+		{ 0.001515856297546144, 0.998484143702455, -1.998474945453109 },
+		{ 0.002377606119857277, 0.9976223938801434, -1.997599754944818 },
+		{ 0.002846465207998219, 0.9971535347920044, -1.997121079187299 },
+		{ 0.004462952014664288, 0.9955370479854971, -1.995457198305786 },
+		{ 0.005341932710034785, 0.9946580672901387, -1.994543617163187 },
+		{ 0.008369650799168538, 0.9916303492008468, -1.99134897076224 },
+		{ 0.01001416930934346, 0.9899858306907866, -1.989582684528314 },
+		{ 0.01566908845583056, 0.984330911544169, -1.983341116444685 },
+		{ 0.0187342532300332, 0.9812657467699821, -1.979848667520517 },
+		{ 0.02924003050080029, 0.9707599694991998, -1.967289820317366 },
+		{ 0.0349123199865696, 0.965087680015858, -1.960126624901996 },
+		{ 0.05423638075559072, 0.9457636192444407, -1.933675571920098 },
+		{ 0.06459393686881583, 0.935406063131196, -1.918172365152727 },
+		{ 0.09947794568536003, 0.9005220543154311, -1.858942970657693 },
+		{ 0.1179200603795335, 0.8820799396218602, -1.823129707266651 },
+		{ 0.1787167404752494, 0.8212832595256014, -1.681895867953608 },
+		{ 0.2100363501448476, 0.7899636498553317, -1.594627221802233 },
+		{ 0.3092392862112799, 0.6907607138298875, -1.248660713310478 },
+		{ 0.0006739618415824315, 0.9993260381584242, -1.99932422064784 },
+		{ 0.0008441755832737631, 0.9991558244167472, -1.999152972683743 },
+		{ 0.00132433770088824, 0.998675662299112, -1.998668642171271 },
+		{ 0.001658673161745086, 0.9983413268382553, -1.998330312922436 },
+		{ 0.002601507562479646, 0.9973984924375205, -1.99737138584274 },
+		{ 0.003257746288646294, 0.99674225371136, -1.996699732882132 },
+		{ 0.005107218734275032, 0.9948927812659123, -1.994788179877933 },
+		{ 0.006393493635920583, 0.9936065063641825, -1.993442476078507 },
+		{ 0.01001416930934345, 0.9899858306907866, -1.989582684528314 },
+		{ 0.01252849344324265, 0.9874715065567837, -1.986839712886788 },
+		{ 0.01958911544995194, 0.9804108845501109, -1.978860869186078 },
+		{ 0.02447753861466145, 0.9755224613853652, -1.973096415299451 },
+		{ 0.03814094720354911, 0.9618590527973361, -1.955928493490129 },
+		{ 0.04754525492167242, 0.9524547450785524, -1.943196012038479 },
+		{ 0.073590158653218, 0.9264098413476823, -1.903942196585743 },
+		{ 0.09131049070863041, 0.908689509291924, -1.873797043478298 },
+		{ 0.1395076862255089, 0.8604923137745116, -1.777120410332234 },
+		{ 0.1715621585814166, 0.8284378414188464, -1.700417984251331 },
+		{ 0.2557206428768214, 0.744279357123488, -1.448734697319551 },
+		{ 0.3092392862112798, 0.6907607138298875, -1.248660713310478 },
+		{ 0.4403984827989195, 0.5596015172025816, -0.621293618214293 },
+		{ 0.0006739618415824315, 0.9993260381584242, -1.99932422064784 },
+		{ 0.0008070013337549778, 0.9991929986662511, -1.999190392610378 },
+		{ 0.001385326211780449, 0.9986146737882261, -1.99860699195491 },
+		{ 0.001658673161745086, 0.9983413268382553, -1.998330312922436 },
+		{ 0.002846465207998219, 0.9971535347920044, -1.997121079187299 },
+		{ 0.003407619434388825, 0.9965923805656218, -1.996545853902403 },
+		{ 0.005844184245889152, 0.9941558157541308, -1.994018798200474 },
+		{ 0.006994234550801256, 0.9930057654492052, -1.992809403085812 },
+		{ 0.01197989212556437, 0.9880201078745287, -1.987442591217542 },
+		{ 0.01432863415955607, 0.9856713658404674, -1.984844229455283 },
+		{ 0.02447753861466148, 0.9755224613853652, -1.973096415299451 },
+		{ 0.0292400305008003, 0.9707599694991998, -1.967289820317366 },
+		{ 0.04968105066202441, 0.9503189493381186, -1.940199010790061 },
+		{ 0.05919638165029738, 0.9408036183529976, -1.926368210056912 },
+		{ 0.09947794568536006, 0.9005220543154311, -1.858942970657693 },
+		{ 0.1179200603795335, 0.8820799396218602, -1.823129707266651 },
+		{ 0.1938236105348056, 0.8061763894656321, -1.641070066680018 },
+		{ 0.2274047865777102, 0.772595213422706, -1.541802835407836 },
+		{ 0.3579057611216289, 0.6420942388838056, -1.038598304869627 },
+		{ 0.4116933814917733, 0.5883066185109922, -0.7750733790794447 },
+		{ 0.4116933814917733, 0.5883066185109922, -0.7750733790794447 },
+		{ 0.0006739618415824315, 0.9993260381584242, -1.99932422064784 },
+		{ 0.0008441755832737631, 0.9991558244167472, -1.999152972683743 },
+		{ 0.001385326211780449, 0.9986146737882261, -1.99860699195491 },
+		{ 0.001735047670652658, 0.9982649523293553, -1.998252900318324 },
+		{ 0.002846465207998218, 0.9971535347920044, -1.997121079187299 },
+		{ 0.003564379763115078, 0.996435620236891, -1.996384710401506 },
+		{ 0.005844184245889151, 0.9941558157541308, -1.994018798200474 },
+		{ 0.007315373447900292, 0.9926846265522246, -1.992469783893646 },
+		{ 0.01197989212556436, 0.9880201078745287, -1.987442591217542 },
+		{ 0.01498398754802389, 0.9850160124519795, -1.984111188099227 },
+		{ 0.02447753861466146, 0.9755224613853652, -1.973096415299451 },
+		{ 0.03056674148269884, 0.9694332585173324, -1.965638560300262 },
+		{ 0.04968105066202438, 0.9503189493381186, -1.940199010790061 },
+		{ 0.0618382546946379, 0.9381617453061113, -1.922388562580863 },
+		{ 0.09947794568536003, 0.9005220543154311, -1.858942970657693 },
+		{ 0.1230056765479927, 0.8769943234522948, -1.812691852810057 },
+		{ 0.1938236105348055, 0.8061763894656321, -1.641070066680018 },
+		{ 0.2365365068777822, 0.7634634931228845, -1.512737429165033 },
+		{ 0.3579057611216288, 0.6420942388838056, -1.038598304869627 },
+		{ 0.4259023626921781, 0.5740976373173259, -0.7000652845620547 },
+		{ 0.4259023626921781, 0.5740976373173259, -0.7000652845620547 },
+		{ 0.0006739618415824315, 0.9993260381584242, -1.99932422064784 },
+		{ 0.000883064992529723, 0.9991169350074842, -1.999113814414923 },
+		{ 0.001385326211780448, 0.9986146737882261, -1.99860699195491 },
+		{ 0.001814934420561305, 0.9981850655794444, -1.998171877671293 },
+		{ 0.002846465207998218, 0.9971535347920044, -1.997121079187299 },
+		{ 0.003728353307513991, 0.9962716466929197, -1.996215940502512 },
+		{ 0.005844184245889149, 0.9941558157541308, -1.994018798200474 },
+		{ 0.007651216987989233, 0.9923487830120217, -1.992113721575719 },
+		{ 0.01197989212556436, 0.9880201078745287, -1.987442591217542 },
+		{ 0.01566908845583055, 0.984330911544169, -1.983341116444685 },
+		{ 0.02447753861466145, 0.9755224613853652, -1.973096415299451 },
+		{ 0.03195268717141144, 0.9680473128286229, -1.963897840393269 },
+		{ 0.04968105066202423, 0.9503189493381186, -1.940199010790061 },
+		{ 0.06459393686881601, 0.935406063131196, -1.918172365152727 },
+		{ 0.09947794568535985, 0.9005220543154311, -1.858942970657693 },
+		{ 0.1282944936368101, 0.8717055063634347, -1.801576011117223 },
+		{ 0.1938236105348056, 0.8061763894656321, -1.641070066680018 },
+		{ 0.2459734748094084, 0.7540265251906979, -1.481754284845684 },
+		{ 0.3579057611216288, 0.6420942388838056, -1.038598304869627 },
+		{ 0.4403984827989194, 0.5596015172025816, -0.621293618214293 },
+		{ 0.4403984827989194, 0.5596015172025816, -0.621293618214293 },
+		{ 0.0006739618415824315, 0.9993260381584242, -1.99932422064784 },
+		{ 0.0009237412894850947, 0.9990762587105163, -1.999072843941941 },
+		{ 0.00132433770088824, 0.998675662299112, -1.998668642171271 },
+		{ 0.001814934420561305, 0.9981850655794444, -1.998171877671293 },
+		{ 0.002601507562479646, 0.9973984924375205, -1.99737138584274 },
+		{ 0.003564379763115077, 0.996435620236891, -1.996384710401506 },
+		{ 0.005107218734275033, 0.9948927812659123, -1.994788179877933 },
+		{ 0.006994234550801252, 0.9930057654492052, -1.992809403085812 },
+		{ 0.01001416930934345, 0.9899858306907866, -1.989582684528314 },
+		{ 0.01370173267180451, 0.9862982673282013, -1.985542161256839 },
+		{ 0.01958911544995194, 0.9804108845501109, -1.978860869186078 },
+		{ 0.02675449885493824, 0.9732455011451359, -1.970343822796267 },
+		{ 0.03814094720354911, 0.9618590527973361, -1.955928493490129 },
+		{ 0.05191010483389601, 0.9480898951668215, -1.937029285765091 },
+		{ 0.07359015865321801, 0.9264098413476823, -1.903942196585743 },
+		{ 0.09947794568535996, 0.9005220543154311, -1.858942970657693 },
+		{ 0.1395076862255089, 0.8604923137745116, -1.777120410332234 },
+		{ 0.1861350622398161, 0.8138649377602877, -1.662140797893033 },
+		{ 0.2557206428768215, 0.744279357123488, -1.448734697319551 },
+		{ 0.3329208492645749, 0.6670791507651102, -1.149818916275162 },
+		{ 0.4403984827989194, 0.5596015172025816, -0.621293618214293 },
+		{ 0.0006739618415824315, 0.9993260381584242, -1.99932422064784 },
+		{ 0.0009662892583938861, 0.9990337107416269, -1.999029974077136 },
+		{ 0.00132433770088824, 0.998675662299112, -1.998668642171271 },
+		{ 0.001898495881308982, 0.9981015041186949, -1.998087073282485 },
+		{ 0.002601507562479646, 0.9973984924375205, -1.99737138584274 },
+		{ 0.003728353307513991, 0.9962716466929197, -1.996215940502512 },
+		{ 0.005107218734275032, 0.9948927812659123, -1.994788179877933 },
+		{ 0.007315373447900291, 0.9926846265522246, -1.992469783893646 },
+		{ 0.01001416930934345, 0.9899858306907866, -1.989582684528314 },
+		{ 0.01432863415955606, 0.9856713658404674, -1.984844229455283 },
+		{ 0.01958911544995194, 0.9804108845501109, -1.978860869186078 },
+		{ 0.02797006710530113, 0.9720299328947163, -1.968856675921944 },
+		{ 0.03814094720354911, 0.9618590527973361, -1.955928493490129 },
+		{ 0.05423638075559069, 0.9457636192444407, -1.933675571920098 },
+		{ 0.073590158653218, 0.9264098413476823, -1.903942196585743 },
+		{ 0.1038156917039176, 0.896184308297384, -1.850804305149844 },
+		{ 0.1395076862255089, 0.8604923137745116, -1.777120410332234 },
+		{ 0.1938236105348055, 0.8061763894656321, -1.641070066680018 },
+		{ 0.2557206428768215, 0.744279357123488, -1.448734697319551 },
+		{ 0.3452508227442491, 0.6547491772604412, -1.09582362073213 },
+		{ 0.4403984827989194, 0.5596015172025816, -0.621293618214293 },
+		{ 0.0006739618415824315, 0.9993260381584242, -1.99932422064784 },
+		{ 0.001010800197084352, 0.998989199802917, -1.998985110868912 },
+		{ 0.001385326211780448, 0.9986146737882261, -1.99860699195491 },
+		{ 0.002077324994948111, 0.9979226750050516, -1.997905395953851 },
+		{ 0.002846465207998218, 0.9971535347920044, -1.997121079187299 },
+		{ 0.004266775289628613, 0.9957332247104946, -1.995660247758789 },
+		{ 0.005844184245889149, 0.9941558157541308, -1.994018798200474 },
+		{ 0.008753666782606985, 0.9912463332174847, -1.990938483028931 },
+		{ 0.01197989212556436, 0.9880201078745287, -1.987442591217542 },
+		{ 0.01791634493520643, 0.98208365506484, -1.98078813787939 },
+		{ 0.02447753861466145, 0.9755224613853652, -1.973096415299451 },
+		{ 0.03649172633636424, 0.9635082736651118, -1.9580839446271 },
+		{ 0.04968105066202437, 0.9503189493381186, -1.940199010790061 },
+		{ 0.07359015865321801, 0.9264098413476823, -1.903942196585743 },
+		{ 0.09947794568535996, 0.9005220543154311, -1.858942970657693 },
+		{ 0.14544538355391, 0.8545546164460902, -1.763677070838084 },
+		{ 0.1938236105348056, 0.8061763894656321, -1.641070066680018 },
+		{ 0.2761618181051482, 0.7238381818951389, -1.376092552361302 },
+		{ 0.3579057611216288, 0.6420942388838056, -1.038598304869627 },
+		{ 0.3579057611216288, 0.6420942388838056, -1.038598304869627 },
+		{ 0.3579057611216288, 0.6420942388838056, -1.038598304869627 },
+		{ 0.0006739618415824315, 0.9993260381584242, -1.99932422064784 },
+		{ 0.001057358837921616, 0.998942641162087, -1.998938166766552 },
+		{ 0.00132433770088824, 0.998675662299112, -1.998668642171271 },
+		{ 0.002077324994948111, 0.9979226750050516, -1.997905395953851 },
+		{ 0.002601507562479646, 0.9973984924375205, -1.99737138584274 },
+		{ 0.004079164082690896, 0.9959208359178106, -1.995854141756496 },
+		{ 0.005107218734275032, 0.9948927812659123, -1.994788179877933 },
+		{ 0.008002399436301721, 0.9919976005638487, -1.991740420704924 },
+		{ 0.01001416930934345, 0.9899858306907866, -1.989582684528314 },
+		{ 0.01566908845583055, 0.984330911544169, -1.983341116444685 },
+		{ 0.01958911544995194, 0.9804108845501109, -1.978860869186078 },
+		{ 0.03056674148269883, 0.9694332585173324, -1.965638560300262 },
+		{ 0.03814094720354911, 0.9618590527973361, -1.955928493490129 },
+		{ 0.05919638165029696, 0.9408036183529976, -1.926368210056912 },
+		{ 0.073590158653218, 0.9264098413476823, -1.903942196585743 },
+		{ 0.1130305139118038, 0.8869694860887443, -1.832934717602701 },
+		{ 0.1395076862255089, 0.8604923137745116, -1.777120410332234 },
+		{ 0.2100363501448475, 0.7899636498553317, -1.594627221802233 },
+		{ 0.2557206428768212, 0.744279357123488, -1.448734697319551 },
+		{ 0.3708825258165394, 0.6291174742023522, -0.9780186487409102 },
+		{ 0.4403984827989194, 0.5596015172025816, -0.621293618214293 },
+		{ 0.0006739618415824315, 0.9993260381584242, -1.99932422064784 },
+		{ 0.001106059691687388, 0.9988939403083149, -1.998889044129414 },
+		{ 0.001385326211780448, 0.9986146737882261, -1.99860699195491 },
+		{ 0.002272979684330214, 0.9977270203156746, -1.997706331073815 },
+		{ 0.002846465207998218, 0.9971535347920044, -1.997121079187299 },
+		{ 0.004668145190812603, 0.9953318548093886, -1.995244484881616 },
+		{ 0.005844184245889149, 0.9941558157541308, -1.994018798200474 },
+		{ 0.009575122176149201, 0.9904248778238953, -1.990056387452975 },
+		{ 0.01197989212556436, 0.9880201078745287, -1.987442591217542 },
+		{ 0.01958911544995194, 0.9804108845501109, -1.978860869186078 },
+		{ 0.02447753861466146, 0.9755224613853652, -1.973096415299451 },
+		{ 0.03986307129535308, 0.9601369287048868, -1.953653193277103 },
+		{ 0.04968105066202438, 0.9503189493381186, -1.940199010790061 },
+		{ 0.08024340389945284, 0.9197565961013601, -1.892955310641957 },
+		{ 0.09947794568536003, 0.9005220543154311, -1.858942970657693 },
+		{ 0.1580168910336679, 0.841983108967151, -1.734072981341956 },
+		{ 0.1938236105348055, 0.8061763894656321, -1.641070066680018 },
+		{ 0.2978874221374024, 0.7021125778644441, -1.293782730292474 },
+		{ 0.3579057611216289, 0.6420942388838056, -1.038598304869627 },
+		{ 0.3579057611216289, 0.6420942388838056, -1.038598304869627 },
+		{ 0.3579057611216289, 0.6420942388838056, -1.038598304869627 },
+		{ 0.0006739618415824315, 0.9993260381584242, -1.99932422064784 },
+		{ 0.001157003774777891, 0.9988429962252376, -1.998837638496038 },
+		{ 0.001385326211780449, 0.9986146737882261, -1.99860699195491 },
+		{ 0.002377606119857277, 0.9976223938801434, -1.997599754944818 },
+		{ 0.002846465207998219, 0.9971535347920044, -1.997121079187299 },
+		{ 0.004882772573366886, 0.9951172274268303, -1.99502162854182 },
+		{ 0.005844184245889152, 0.9941558157541308, -1.994018798200474 },
+		{ 0.01001416930934346, 0.9899858306907866, -1.989582684528314 },
+		{ 0.01197989212556437, 0.9880201078745287, -1.987442591217542 },
+		{ 0.02048256475266252, 0.9795174352473556, -1.977822050287383 },
+		{ 0.02447753861466148, 0.9755224613853652, -1.973096415299451 },
+		{ 0.04166146009642285, 0.9583385399044191, -1.95125027262803 },
+		{ 0.04968105066202441, 0.9503189493381186, -1.940199010790061 },
+		{ 0.08378193657773969, 0.9162180634226144, -1.886950192767103 },
+		{ 0.09947794568535992, 0.9005220543154311, -1.858942970657693 },
+		{ 0.164664598646401, 0.8353354013539473, -1.717785468271019 },
+		{ 0.1938236105348055, 0.8061763894656321, -1.641070066680018 },
+		{ 0.3092392862112799, 0.6907607138298875, -1.248660713310478 },
+		{ 0.3579057611216289, 0.6420942388838056, -1.038598304869627 },
+		{ 0.3579057611216289, 0.6420942388838056, -1.038598304869627 },
+		{ 0.3579057611216289, 0.6420942388838056, -1.038598304869627 }
+	},
+	.c_bpre4800080040 = {
+		{ 6.741889689625945e-05, 0.9999966290604018, -1.999989356582936 },
+		{ 8.073265022476917e-05, 0.9999959633724741, -1.999985534968948 },
+		{ 0.000126683084834192, 0.999993665849323, -1.999967988085473 },
+		{ 0.0001517000796932476, 0.9999924149969159, -1.999955594316311 },
+		{ 0.0002380422999144316, 0.9999880978852631, -1.999897435416172 },
+		{ 0.0002850504204344938, 0.9999857474810969, -1.999855742014264 },
+		{ 0.0004472916579980912, 0.9999776355465115, -1.999657532487119 },
+		{ 0.0005356207960447165, 0.999973219099366, -1.999514211862563 },
+		{ 0.000840469881863953, 0.9999579765180323, -1.99882783647877 },
+		{ 0.001006441604091751, 0.9999496780242458, -1.998329183335156 },
+		{ 0.001579252270151247, 0.9999210373864926, -1.99593174641692 },
+		{ 0.001891107067428956, 0.9999054446588853, -1.99418584645104 },
+		{ 0.002967383897070245, 0.9998516308051503, -1.985778534616887 },
+		{ 0.003553356004069515, 0.999822334176189, -1.979652841761614 },
+		{ 0.005575484732718686, 0.9997212257892397, -1.950182549859126 },
+		{ 0.006676340799588683, 0.9996661829700472, -1.928759693684841 },
+		{ 0.01047533138623081, 0.9994762340958885, -1.826414369921015 },
+		{ 0.01254334789508191, 0.9993728337880443, -1.752799584409567 },
+		{ 0.01967904806585285, 0.9990160483414987, -1.410474509506661 },
+		{ 0.02356294671291753, 0.9988218528238625, -1.173914675708188 },
+		{ 0.03696275330548521, 0.998151900817915, -0.181479697867091 },
+		{ 6.741889689625945e-05, 0.9999966290604018, -1.999989356582936 },
+		{ 8.445336658416939e-05, 0.9999957773484147, -1.999984365631871 },
+		{ 0.000132521104748214, 0.999993373944897, -1.999965274969615 },
+		{ 0.0001660043451150738, 0.9999916997830316, -1.999947607856951 },
+		{ 0.0002604880448881229, 0.9999869755980004, -1.999878409442855 },
+		{ 0.0003263038692508841, 0.9999836848116092, -1.999813327202194 },
+		{ 0.0005120269631062544, 0.9999743988019587, -1.999554938437305 },
+		{ 0.0006413933232399437, 0.9999679304164839, -1.999309742726944 },
+		{ 0.00100644160409175, 0.9999496780242458, -1.998329183335156 },
+		{ 0.00126072435761641, 0.99993696380315, -1.99739434283656 },
+		{ 0.001978255696775942, 0.9999010872659995, -1.993642458130385 },
+		{ 0.002478056268846963, 0.9998760972082165, -1.990058314734627 },
+		{ 0.003888371784247832, 0.9998055821325315, -1.975661055179027 },
+		{ 0.004870678983144652, 0.9997564662349701, -1.961914235405325 },
+		{ 0.007642409317148279, 0.9996178802813261, -1.906876005704742 },
+		{ 0.00957289925931424, 0.9995213555013907, -1.854645996904491 },
+		{ 0.01501941752151716, 0.9992490291416227, -1.648919047516781 },
+		{ 0.01881249832331369, 0.9990593753131353, -1.45879473919637 },
+		{ 0.02951209356316264, 0.9985243956032556, -0.7587823968840098 },
+		{ 0.03696275330548451, 0.998151900817915, -0.181479697867091 },
+		{ 0.0579688900098096, 0.9971015569953523, 1.363236759619275 },
+		{ 6.741889689625945e-05, 0.9999966290604018, -1.999989356582936 },
+		{ 8.073265022476917e-05, 0.9999959633724741, -1.999985534968948 },
+		{ 0.000138628286856644, 0.999993068590706, -1.999962320124658 },
+		{ 0.0001660043451150739, 0.9999916997830316, -1.999947607856951 },
+		{ 0.0002850504204344938, 0.9999857474810969, -1.999855742014264 },
+		{ 0.0003413411187357995, 0.999982932952679, -1.999796512431249 },
+		{ 0.0005861245663716513, 0.999970693787842, -1.999421044306281 },
+		{ 0.000701868673158078, 0.9999649065714789, -1.999176753328486 },
+		{ 0.001205188119268829, 0.9999397406689581, -1.997616161051174 },
+		{ 0.00144317633861813, 0.9999278412020659, -1.996596235418048 },
+		{ 0.002478056268846965, 0.9998760972082165, -1.990058314734627 },
+		{ 0.002967383897070246, 0.9998516308051503, -1.985778534616887 },
+		{ 0.005095114690175997, 0.9997452443827801, -1.958347308518655 },
+		{ 0.006101209087463454, 0.9996949422605439, -1.940422462249227 },
+		{ 0.01047533138623028, 0.9994762340958885, -1.826414369921015 },
+		{ 0.01254334789507787, 0.9993728337880443, -1.752799584409567 },
+		{ 0.02153367840950972, 0.9989233164654616, -1.301427115272649 },
+		{ 0.02578337603738818, 0.998710831571571, -1.02554479457153 },
+		{ 0.04425309322707129, 0.9977873505430915, 0.3994136737757781 },
+		{ 0.05298045781652565, 0.9973509798278837, 1.046086385367869 },
+		{ 0.05298045781652565, 0.9973509798278837, 1.046086385367869 },
+		{ 6.741889689625945e-05, 0.9999966290604018, -1.999989356582936 },
+		{ 8.445336658416939e-05, 0.9999957773484147, -1.999984365631871 },
+		{ 0.000138628286856644, 0.999993068590706, -1.999962320124658 },
+		{ 0.0001736548305020554, 0.9999913172646491, -1.999943067717553 },
+		{ 0.0002850504204344937, 0.9999857474810969, -1.999855742014264 },
+		{ 0.0003570716397482796, 0.9999821464228769, -1.999778147931558 },
+		{ 0.0005861245663716512, 0.999970693787842, -1.999421044306281 },
+		{ 0.0007342147280528201, 0.9999632893638239, -1.999100826209455 },
+		{ 0.001205188119268829, 0.9999397406689581, -1.997616161051174 },
+		{ 0.001509681239586751, 0.9999245159408361, -1.996278866804797 },
+		{ 0.002478056268846964, 0.9998760972082165, -1.990058314734627 },
+		{ 0.003104124376394773, 0.9998447938066956, -1.98444646254675 },
+		{ 0.005095114690175996, 0.9997452443827801, -1.958347308518655 },
+		{ 0.006382284659140421, 0.9996808863851797, -1.934850410866064 },
+		{ 0.01047533138623081, 0.9994762340958885, -1.826414369921015 },
+		{ 0.01312117481113567, 0.9993439415039505, -1.730061102606879 },
+		{ 0.02153367840951224, 0.9989233164654616, -1.301427115272649 },
+		{ 0.02697080712302051, 0.9986514602448808, -0.9427968386892102 },
+		{ 0.04425309322707269, 0.9977873505430915, 0.3994136737757781 },
+		{ 0.05541884504390879, 0.9972290671546324, 1.207148056826166 },
+		{ 0.05541884504390879, 0.9972290671546324, 1.207148056826166 },
+		{ 6.741889689625945e-05, 0.9999966290604018, -1.999989356582936 },
+		{ 8.834554659019296e-05, 0.9999955827341356, -1.999983094887412 },
+		{ 0.0001386282868566439, 0.999993068590706, -1.999962320124658 },
+		{ 0.0001816576074935088, 0.9999909171242019, -1.999938117991762 },
+		{ 0.0002850504204344937, 0.9999857474810969, -1.999855742014264 },
+		{ 0.0003735355569250444, 0.9999813235697056, -1.999758087846978 },
+		{ 0.0005861245663716511, 0.999970693787842, -1.999421044306281 },
+		{ 0.0007680491954008905, 0.9999615975488214, -1.999017814779128 },
+		{ 0.001205188119268828, 0.9999397406689581, -1.997616161051174 },
+		{ 0.001579252270151246, 0.9999210373864926, -1.99593174641692 },
+		{ 0.002478056268846963, 0.9998760972082165, -1.990058314734627 },
+		{ 0.003247168530652421, 0.999837641601497, -1.982989422576603 },
+		{ 0.005095114690179152, 0.9997452443827801, -1.958347308518655 },
+		{ 0.006676340799586462, 0.9996661829700472, -1.928759693684841 },
+		{ 0.01047533138623132, 0.9994762340958885, -1.826414369921015 },
+		{ 0.01372565559648845, 0.9993137174288103, -1.70528426704646 },
+		{ 0.021533678409513, 0.9989233164654616, -1.301427115272649 },
+		{ 0.02821285729257164, 0.9985893572317115, -0.8539630777259793 },
+		{ 0.04425309322706739, 0.9977873505430915, 0.3994136737757781 },
+		{ 0.0579688900098056, 0.9971015569953523, 1.363236759619275 },
+		{ 0.0579688900098056, 0.9971015569953523, 1.363236759619275 },
+		{ 6.741889689625945e-05, 0.9999966290604018, -1.999989356582936 },
+		{ 9.24166307190218e-05, 0.9999953791696691, -1.999981713826972 },
+		{ 0.000132521104748214, 0.999993373944897, -1.999965274969615 },
+		{ 0.0001816576074935088, 0.9999909171242019, -1.999938117991762 },
+		{ 0.0002604880448881229, 0.9999869755980004, -1.999878409442855 },
+		{ 0.0003570716397482796, 0.9999821464228769, -1.999778147931558 },
+		{ 0.0005120269631062546, 0.9999743988019587, -1.999554938437305 },
+		{ 0.0007018686731580776, 0.9999649065714789, -1.999176753328486 },
+		{ 0.00100644160409175, 0.9999496780242458, -1.998329183335156 },
+		{ 0.00137959928936812, 0.9999310200404126, -1.996886417522704 },
+		{ 0.001978255696778191, 0.9999010872659995, -1.993642458130385 },
+		{ 0.002711708854983485, 0.9998644146174829, -1.988109776667777 },
+		{ 0.003888371784247832, 0.9998055821325315, -1.975661055179027 },
+		{ 0.005329896976728668, 0.9997335057404179, -1.954447133364943 },
+		{ 0.007642409317148282, 0.9996178802813261, -1.906876005704742 },
+		{ 0.01047533138623853, 0.9994762340958885, -1.826414369921015 },
+		{ 0.01501941752151614, 0.9992490291416227, -1.648919047516781 },
+		{ 0.02058548557895818, 0.998970725812061, -1.358112878798575 },
+		{ 0.02951209356316515, 0.9985243956032556, -0.7587823968840098 },
+		{ 0.04044427135738462, 0.9979778145111964, 0.09704347794198756 },
+		{ 0.05796889000980469, 0.9971015569953523, 1.363236759619275 },
+		{ 6.741889689625945e-05, 0.9999966290604018, -1.999989356582936 },
+		{ 9.667574029221383e-05, 0.9999951662295987, -1.999980212396864 },
+		{ 0.000132521104748214, 0.999993373944897, -1.999965274969615 },
+		{ 0.0001900291894522144, 0.9999904985435951, -1.99993272083606 },
+		{ 0.0002604880448881229, 0.9999869755980004, -1.999878409442855 },
+		{ 0.0003735355569250444, 0.9999813235697056, -1.999758087846978 },
+		{ 0.0005120269631062544, 0.9999743988019587, -1.999554938437305 },
+		{ 0.0007342147280528199, 0.9999632893638239, -1.999100826209455 },
+		{ 0.00100644160409175, 0.9999496780242458, -1.998329183335156 },
+		{ 0.001443176338618129, 0.9999278412020659, -1.996596235418048 },
+		{ 0.001978255696775942, 0.9999010872659995, -1.993642458130385 },
+		{ 0.00283666708459843, 0.9998581666601158, -1.986996378026679 },
+		{ 0.003888371784247832, 0.9998055821325315, -1.975661055179027 },
+		{ 0.00557548473272358, 0.9997212257892397, -1.950182549859126 },
+		{ 0.007642409317148279, 0.9996178802813261, -1.906876005704742 },
+		{ 0.01095793753774879, 0.9994521042200593, -1.810336746129521 },
+		{ 0.01501941752151716, 0.9992490291416227, -1.648919047516781 },
+		{ 0.02153367840951286, 0.9989233164654616, -1.301427115272649 },
+		{ 0.02951209356316515, 0.9985243956032556, -0.7587823968840098 },
+		{ 0.04230558742046548, 0.997884725093005, 0.2455486996393272 },
+		{ 0.05796889000980469, 0.9971015569953523, 1.363236759619275 },
+		{ 6.741889689625945e-05, 0.9999966290604018, -1.999989356582936 },
+		{ 0.0001011309061177414, 0.9999949434557837, -1.999978579507503 },
+		{ 0.0001386282868566439, 0.999993068590706, -1.999962320124658 },
+		{ 0.0002079474816827354, 0.9999896026259167, -1.999920415216935 },
+		{ 0.0002850504204344937, 0.9999857474810969, -1.999855742014264 },
+		{ 0.0004275878014514078, 0.9999786207087851, -1.999686097293468 },
+		{ 0.0005861245663716511, 0.999970693787842, -1.999421044306281 },
+		{ 0.0008792026628214402, 0.9999560399403216, -1.998719348646852 },
+		{ 0.001205188119268828, 0.9999397406689581, -1.997616161051174 },
+		{ 0.00180779762332654, 0.9999096101564134, -1.994682645021763 },
+		{ 0.002478056268846963, 0.9998760972082165, -1.990058314734627 },
+		{ 0.003717099002615991, 0.9998141462525952, -1.97774616437809 },
+		{ 0.005095114690173781, 0.9997452443827801, -1.958347308518655 },
+		{ 0.007642409317148282, 0.9996178802813261, -1.906876005704742 },
+		{ 0.01047533138623853, 0.9994762340958885, -1.826414369921015 },
+		{ 0.01571131185642977, 0.999214434407306, -1.616950715297619 },
+		{ 0.021533678409513, 0.9989233164654616, -1.301427115272649 },
+		{ 0.03229264854015451, 0.9983853678371111, -0.5485125240232555 },
+		{ 0.04425309322706739, 0.9977873505430915, 0.3994136737757781 },
+		{ 0.04425309322706739, 0.9977873505430915, 0.3994136737757781 },
+		{ 0.04425309322706739, 0.9977873505430915, 0.3994136737757781 },
+		{ 6.741889689625945e-05, 0.9999966290604018, -1.999989356582936 },
+		{ 0.0001057916759553427, 0.999994710422809, -1.999976803440982 },
+		{ 0.000132521104748214, 0.999993373944897, -1.999965274969615 },
+		{ 0.0002079474816827354, 0.9999896026259167, -1.999920415216935 },
+		{ 0.0002604880448881229, 0.9999869755980004, -1.999878409442855 },
+		{ 0.0004087545211709416, 0.9999795626760117, -1.999712248003817 },
+		{ 0.0005120269631062544, 0.9999743988019587, -1.999554938437305 },
+		{ 0.0008034453256003849, 0.999959827854489, -1.99892706318987 },
+		{ 0.00100644160409175, 0.9999496780242458, -1.998329183335156 },
+		{ 0.001579252270151246, 0.9999210373864926, -1.99593174641692 },
+		{ 0.001978255696775942, 0.9999010872659995, -1.993642458130385 },
+		{ 0.003104124376399218, 0.9998447938066956, -1.98444646254675 },
+		{ 0.003888371784247832, 0.9998055821325315, -1.975661055179027 },
+		{ 0.00610120908746564, 0.9996949422605439, -1.940422462249227 },
+		{ 0.007642409317148279, 0.9996178802813261, -1.906876005704742 },
+		{ 0.01199088316726739, 0.9994004563056031, -1.773662245297506 },
+		{ 0.01501941752151039, 0.9992490291416227, -1.648919047516781 },
+		{ 0.02356294671292021, 0.9988218528238625, -1.173914675708188 },
+		{ 0.02951209356316849, 0.9985243956032556, -0.7587823968840098 },
+		{ 0.04629043969754005, 0.9976854962225216, 0.557738255260581 },
+		{ 0.0579688900098056, 0.9971015569953523, 1.363236759619275 },
+		{ 6.741889689625945e-05, 0.9999966290604018, -1.999989356582936 },
+		{ 0.0001106669162424702, 0.9999944666561735, -1.99997487118186 },
+		{ 0.0001386282868566439, 0.999993068590706, -1.999962320124658 },
+		{ 0.0002275554668833712, 0.9999886222306086, -1.999905772004054 },
+		{ 0.0002850504204344937, 0.9999857474810969, -1.999855742014264 },
+		{ 0.0004679052532599113, 0.9999766048986283, -1.999626319334943 },
+		{ 0.0005861245663716512, 0.999970693787842, -1.999421044306281 },
+		{ 0.0009621034173811624, 0.9999518948650825, -1.998471015468496 },
+		{ 0.001205188119268829, 0.9999397406689581, -1.997616161051174 },
+		{ 0.001978255696778192, 0.9999010872659995, -1.993642458130385 },
+		{ 0.002478056268846964, 0.9998760972082165, -1.990058314734627 },
+		{ 0.004067527301909694, 0.9997966238306177, -1.973380698846329 },
+		{ 0.005095114690175996, 0.9997452443827801, -1.958347308518655 },
+		{ 0.008362885951610957, 0.9995818563794274, -1.888698474986008 },
+		{ 0.01047533138623081, 0.9994762340958885, -1.826414369921015 },
+		{ 0.01719215326265927, 0.9991403930461717, -1.544394766071381 },
+		{ 0.02153367840951256, 0.9989233164654616, -1.301427115272649 },
+		{ 0.03533493568099329, 0.998233254932311, -0.3107581462572799 },
+		{ 0.04425309322707129, 0.9977873505430915, 0.3994136737757781 },
+		{ 0.04425309322707129, 0.9977873505430915, 0.3994136737757781 },
+		{ 0.04425309322707129, 0.9977873505430915, 0.3994136737757781 },
+		{ 6.741889689625945e-05, 0.9999966290604018, -1.999989356582936 },
+		{ 0.0001157672763119403, 0.9999942116486508, -1.999972768417649 },
+		{ 0.000138628286856644, 0.999993068590706, -1.999962320124658 },
+		{ 0.0002380422999144316, 0.9999880978852631, -1.999897435416172 },
+		{ 0.0002850504204344938, 0.9999857474810969, -1.999855742014264 },
+		{ 0.0004894703977031585, 0.9999755266382079, -1.999592209112674 },
+		{ 0.0005861245663716516, 0.999970693787842, -1.999421044306281 },
+		{ 0.001006441604091751, 0.9999496780242458, -1.998329183335156 },
+		{ 0.001205188119268829, 0.9999397406689581, -1.997616161051174 },
+		{ 0.002069417386511601, 0.9998965291454506, -1.99304810745245 },
+		{ 0.002478056268846965, 0.9998760972082165, -1.990058314734627 },
+		{ 0.00425497921965891, 0.9997872517266753, -1.970886481461078 },
+		{ 0.005095114690175997, 0.9997452443827801, -1.958347308518655 },
+		{ 0.008748180300184339, 0.9995625912804248, -1.878332116539841 },
+		{ 0.01047533138623029, 0.9994762340958885, -1.826414369921015 },
+		{ 0.0179841111558494, 0.9991007947449947, -1.503346857711736 },
+		{ 0.0215336784095156, 0.9989233164654616, -1.301427115272649 },
+		{ 0.0369627533054837, 0.998151900817915, -0.181479697867091 },
+		{ 0.0442530932270721, 0.9977873505430915, 0.3994136737757781 },
+		{ 0.0442530932270721, 0.9977873505430915, 0.3994136737757781 },
+		{ 0.0442530932270721, 0.9977873505430915, 0.3994136737757781 }
+	},
+	.c_bpre9600080040 = {
+		{ 3.370947685371451e-05, 0.9999983145287805, -1.999996496407056 },
+		{ 4.036636584998917e-05, 0.9999979816842002, -1.999995374578988 },
+		{ 6.334164271553992e-05, 0.9999968329196461, -1.999990413458216 },
+		{ 7.58501836777028e-05, 0.9999962074912662, -1.999987002282476 },
+		{ 0.0001190215041131668, 0.9999940489249238, -1.999971383111774 },
+		{ 0.000142525718058577, 0.9999928737151564, -1.999960371968549 },
+		{ 0.000223647079437758, 0.999988817710734, -1.999908789897328 },
+		{ 0.0002678121910981743, 0.9999866094600297, -1.999871853590285 },
+		{ 0.0004202393559585336, 0.9999789880382649, -1.999696430100185 },
+		{ 0.0005032271329688473, 0.9999748386955772, -1.999569668885425 },
+		{ 0.0007896417234203252, 0.9999605179138288, -1.998962926681266 },
+		{ 0.000945575886559576, 0.9999527212118006, -1.998522276302628 },
+		{ 0.001483746986161664, 0.9999258126506939, -1.996404307733691 },
+		{ 0.001776756922785601, 0.9999111631421008, -1.994862192755583 },
+		{ 0.002787936681119242, 0.9998606031788829, -1.98743647859688 },
+		{ 0.003338449030837597, 0.9998330775534719, -1.982025693396982 },
+		{ 0.005238351700460807, 0.9997380827476208, -1.955988378898264 },
+		{ 0.006272657601527946, 0.9996863677114157, -1.937052484032867 },
+		{ 0.009841945628438264, 0.9995079030910652, -1.846480530993076 },
+		{ 0.0117849454794902, 0.9994107528058033, -1.781217632117549 },
+		{ 0.01848992340734568, 0.9990755230801699, -1.476357386456465 },
+		{ 3.370947685371451e-05, 0.9999983145287805, -1.999996496407056 },
+		{ 4.222672787632358e-05, 0.9999978886719785, -1.999995035737796 },
+		{ 6.626066213929632e-05, 0.9999966869669604, -1.999989662199166 },
+		{ 8.300234478761131e-05, 0.999995849882904, -1.999984826848134 },
+		{ 0.0001302444465351708, 0.9999934877777954, -1.999966345966463 },
+		{ 0.0001631526000962151, 0.9999918423725309, -1.999949252342983 },
+		{ 0.0002560151201309824, 0.9999871993190506, -1.999882330807346 },
+		{ 0.0003206992328114592, 0.9999839650796827, -1.999819410068407 },
+		{ 0.0005032271329688471, 0.9999748386955772, -1.999569668885425 },
+		{ 0.0006303721130294112, 0.9999684814048643, -1.999332715094444 },
+		{ 0.0009891523089381423, 0.9999505424099731, -1.998385233871127 },
+		{ 0.001239066516566684, 0.9999380466850015, -1.997482016968877 },
+		{ 0.001944280397438856, 0.9999027863410178, -1.993857223553911 },
+		{ 0.002435487781479335, 0.9998782257029953, -1.990394605838656 },
+		{ 0.003821569767744482, 0.9998089218852402, -1.976485226436542 },
+		{ 0.004787022518721486, 0.9997606491062702, -1.963203325484268 },
+		{ 0.007511119183508685, 0.9996244440496755, -1.910017787344838 },
+		{ 0.009408462140121287, 0.9995295770076715, -1.859530565254467 },
+		{ 0.0147614943234047, 0.9992619254245886, -1.660513901386123 },
+		{ 0.01848992340734862, 0.9990755230801699, -1.476357386456465 },
+		{ 0.02900547793781804, 0.9985497268515736, -0.7961560547980405 },
+		{ 3.370947685371451e-05, 0.9999983145287805, -1.999996496407056 },
+		{ 4.036636584998917e-05, 0.9999979816842002, -1.999995374578988 },
+		{ 6.931426354669676e-05, 0.9999965342893474, -1.999988847144742 },
+		{ 8.300234478761133e-05, 0.999995849882904, -1.999984826848134 },
+		{ 0.000142525718058577, 0.9999928737151564, -1.999960371968549 },
+		{ 0.0001706712875818294, 0.9999914664399288, -1.999944860567688 },
+		{ 0.000293064430353237, 0.9999853467865627, -1.999847928688438 },
+		{ 0.0003509374155053667, 0.9999824531317931, -1.999785403385106 },
+		{ 0.0006026031378838629, 0.9999698698805671, -1.999388881836857 },
+		{ 0.0007216011870093746, 0.999963919950148, -1.99913082996572 },
+		{ 0.001239066516566685, 0.9999380466850015, -1.997482016968877 },
+		{ 0.001483746986161664, 0.9999258126506939, -1.996404307733691 },
+		{ 0.002547719616901389, 0.9998726140778034, -1.989495548334356 },
+		{ 0.00305083723186455, 0.9998474594959691, -1.984972891902056 },
+		{ 0.005238351700460809, 0.9997380827476208, -1.955988378898264 },
+		{ 0.006272657601523619, 0.9996863677114157, -1.937052484032867 },
+		{ 0.01076973888561295, 0.99946151324874, -1.816686597176374 },
+		{ 0.01289584558832025, 0.9993552079073642, -1.739038617053001 },
+		{ 0.02213879974611852, 0.9988930626163601, -1.264267846066997 },
+		{ 0.02650779547077156, 0.9986746115867189, -0.9753277275588422 },
+		{ 0.02650779547077156, 0.9986746115867189, -0.9753277275588422 },
+		{ 3.370947685371451e-05, 0.9999983145287805, -1.999996496407056 },
+		{ 4.222672787632358e-05, 0.9999978886719785, -1.999995035737796 },
+		{ 6.931426354669676e-05, 0.9999965342893474, -1.999988847144742 },
+		{ 8.682760372040933e-05, 0.999995658622901, -1.999983596173567 },
+		{ 0.0001425257180585769, 0.9999928737151564, -1.999960371968549 },
+		{ 0.0001785366167585994, 0.9999910731715942, -1.999940072670866 },
+		{ 0.000293064430353237, 0.9999853467865627, -1.999847928688438 },
+		{ 0.0003671107332756833, 0.9999816445134498, -1.999766015121876 },
+		{ 0.0006026031378838628, 0.9999698698805671, -1.999388881836857 },
+		{ 0.0007548548649402933, 0.9999622572581607, -1.999050620000008 },
+		{ 0.001239066516566684, 0.9999380466850015, -1.997482016968877 },
+		{ 0.001552122415288063, 0.9999223938919937, -1.996068949298577 },
+		{ 0.002547719616901388, 0.9998726140778034, -1.989495548334356 },
+		{ 0.003191396954437549, 0.9998404304613712, -1.983565293153106 },
+		{ 0.005238351700460807, 0.9997380827476208, -1.955988378898264 },
+		{ 0.006561663790963103, 0.9996719169327256, -1.931166731207066 },
+		{ 0.01076973888561072, 0.99946151324874, -1.816686597176374 },
+		{ 0.01348995303030462, 0.9993255026491019, -1.715065002895795 },
+		{ 0.02213879974611838, 0.9988930626163601, -1.264267846066997 },
+		{ 0.02772864439995512, 0.9986135724866914, -0.8888647985673224 },
+		{ 0.02772864439995512, 0.9986135724866914, -0.8888647985673224 },
+		{ 3.370947685371451e-05, 0.9999983145287805, -1.999996496407056 },
+		{ 4.417282207512097e-05, 0.999997791364629, -1.999994669397064 },
+		{ 6.931426354669676e-05, 0.9999965342893474, -1.999988847144742 },
+		{ 9.082900998594829e-05, 0.9999954585517887, -1.999982258695147 },
+		{ 0.0001425257180585769, 0.9999928737151564, -1.999960371968549 },
+		{ 0.0001867686505032965, 0.9999906617412514, -1.999934851771299 },
+		{ 0.0002930644303532369, 0.9999853467865627, -1.999847928688438 },
+		{ 0.0003840282846436198, 0.9999807985900636, -1.99974483671276 },
+		{ 0.0006026031378838624, 0.9999698698805671, -1.999388881836857 },
+		{ 0.0007896417234203248, 0.9999605179138288, -1.998962926681266 },
+		{ 0.001239066516566684, 0.9999380466850015, -1.997482016968877 },
+		{ 0.001623650171310986, 0.9999188175054498, -1.995702146517677 },
+		{ 0.002547719616899187, 0.9998726140778034, -1.989495548334356 },
+		{ 0.003338449030837595, 0.9998330775534719, -1.982025693396982 },
+		{ 0.005238351700458567, 0.9997380827476208, -1.955988378898264 },
+		{ 0.006864005662224337, 0.9996567998212238, -1.924733195887175 },
+		{ 0.01076973888561369, 0.99946151324874, -1.816686597176374 },
+		{ 0.01411140694108285, 0.9992944297011327, -1.688949993246071 },
+		{ 0.02213879974612046, 0.9988930626163601, -1.264267846066997 },
+		{ 0.0290054779378187, 0.9985497268515736, -0.7961560547980405 },
+		{ 0.0290054779378187, 0.9985497268515736, -0.7961560547980405 },
+		{ 3.370947685371451e-05, 0.9999983145287805, -1.999996496407056 },
+		{ 4.620836872844748e-05, 0.9999976895821657, -1.999994273239627 },
+		{ 6.626066213929632e-05, 0.9999966869669604, -1.999989662199166 },
+		{ 9.082900998594829e-05, 0.9999954585517887, -1.999982258695147 },
+		{ 0.0001302444465351708, 0.9999934877777954, -1.999966345966463 },
+		{ 0.0001785366167585993, 0.9999910731715942, -1.999940072670866 },
+		{ 0.0002560151201309825, 0.9999871993190506, -1.999882330807346 },
+		{ 0.0003509374155053664, 0.9999824531317931, -1.999785403385106 },
+		{ 0.0005032271329688472, 0.9999748386955772, -1.999569668885425 },
+		{ 0.0006898115406785021, 0.9999655094254063, -1.999204200769502 },
+		{ 0.0009891523089381423, 0.9999505424099731, -1.998385233871127 },
+		{ 0.00135590038911566, 0.9999322050106612, -1.99699128358203 },
+		{ 0.001944280397438856, 0.9999027863410178, -1.993857223553911 },
+		{ 0.002665126060398137, 0.999866743991627, -1.988512162786355 },
+		{ 0.003821569767744483, 0.9998089218852402, -1.976485226436542 },
+		{ 0.005238351700460804, 0.9997380827476208, -1.955988378898264 },
+		{ 0.007511119183508688, 0.9996244440496755, -1.910017787344838 },
+		{ 0.01029539266700132, 0.9994852304121663, -1.832234532503876 },
+		{ 0.01476149432340584, 0.9992619254245886, -1.660513901386123 },
+		{ 0.02023236925637939, 0.9989883955838508, -1.378743576503561 },
+		{ 0.02900547793781515, 0.9985497268515736, -0.7961560547980405 },
+		{ 3.370947685371451e-05, 0.9999983145287805, -1.999996496407056 },
+		{ 4.833792855623686e-05, 0.9999975831118788, -1.999993844645684 },
+		{ 6.626066213929632e-05, 0.9999966869669604, -1.999989662199166 },
+		{ 9.501482041889118e-05, 0.999995249260513, -1.999980804747157 },
+		{ 0.0001302444465351708, 0.9999934877777954, -1.999966345966463 },
+		{ 0.0001867686505032965, 0.9999906617412514, -1.999934851771299 },
+		{ 0.0002560151201309824, 0.9999871993190506, -1.999882330807346 },
+		{ 0.0003671107332756832, 0.9999816445134498, -1.999766015121876 },
+		{ 0.0005032271329688471, 0.9999748386955772, -1.999569668885425 },
+		{ 0.0007216011870093741, 0.999963919950148, -1.99913082996572 },
+		{ 0.0009891523089381423, 0.9999505424099731, -1.998385233871127 },
+		{ 0.001418383837607683, 0.9999290808152926, -1.99671093042369 },
+		{ 0.001944280397438856, 0.9999027863410178, -1.993857223553911 },
+		{ 0.00278793668111924, 0.9998606031788829, -1.98743647859688 },
+		{ 0.003821569767744482, 0.9998089218852402, -1.976485226436542 },
+		{ 0.005479719450502323, 0.9997260145760233, -1.951868022903101 },
+		{ 0.007511119183508685, 0.9996244440496755, -1.910017787344838 },
+		{ 0.01076973888561109, 0.99946151324874, -1.816686597176374 },
+		{ 0.01476149432340584, 0.9992619254245886, -1.660513901386123 },
+		{ 0.02116399155008896, 0.9989418026556927, -1.323758110221013 },
+		{ 0.02900547793781515, 0.9985497268515736, -0.7961560547980405 },
+		{ 3.370947685371451e-05, 0.9999983145287805, -1.999996496407056 },
+		{ 5.056551697476315e-05, 0.9999974717246959, -1.99999338072827 },
+		{ 6.931426354669676e-05, 0.9999965342893474, -1.999988847144742 },
+		{ 0.0001039740111014005, 0.9999948012994452, -1.999977504327443 },
+		{ 0.0001425257180585769, 0.9999928737151564, -1.999960371968549 },
+		{ 0.0002137950434199383, 0.9999893102972576, -1.999916177715454 },
+		{ 0.0002930644303532369, 0.9999853467865627, -1.999847928688438 },
+		{ 0.000439606162745277, 0.9999780197285948, -1.999668819605934 },
+		{ 0.0006026031378838625, 0.9999698698805671, -1.999388881836857 },
+		{ 0.0009039192384053092, 0.9999548040568701, -1.998647606042189 },
+		{ 0.001239066516566684, 0.9999380466850015, -1.997482016968877 },
+		{ 0.001858635863923898, 0.9999070688081945, -1.994382185550736 },
+		{ 0.002547719616901387, 0.9998726140778034, -1.989495548334356 },
+		{ 0.003821569767744483, 0.9998089218852402, -1.976485226436542 },
+		{ 0.005238351700460804, 0.9997380827476208, -1.955988378898264 },
+		{ 0.007857199317749471, 0.9996071400341765, -1.901621679020659 },
+		{ 0.01076973888561369, 0.99946151324874, -1.816686597176374 },
+		{ 0.01615284713076398, 0.9991923577755744, -1.595900208721791 },
+		{ 0.02213879974612046, 0.9988930626163601, -1.264267846066997 },
+		{ 0.02213879974612046, 0.9988930626163601, -1.264267846066997 },
+		{ 0.02213879974612046, 0.9988930626163601, -1.264267846066997 },
+		{ 3.370947685371451e-05, 0.9999983145287805, -1.999996496407056 },
+		{ 5.289590792066007e-05, 0.9999973552079073, -1.99999287845152 },
+		{ 6.626066213929632e-05, 0.9999966869669604, -1.999989662199166 },
+		{ 0.0001039740111014005, 0.9999948012994452, -1.999977504327443 },
+		{ 0.0001302444465351708, 0.9999934877777954, -1.999966345966463 },
+		{ 0.0002043783048229122, 0.9999897812857949, -1.999922951159723 },
+		{ 0.0002560151201309824, 0.9999871993190506, -1.999882330807346 },
+		{ 0.0004017266973978766, 0.9999799137255154, -1.999721703297988 },
+		{ 0.0005032271329688471, 0.9999748386955772, -1.999569668885425 },
+		{ 0.0007896417234203248, 0.9999605179138288, -1.998962926681266 },
+		{ 0.0009891523089381423, 0.9999505424099731, -1.998385233871127 },
+		{ 0.001552122415288062, 0.9999223938919937, -1.996068949298577 },
+		{ 0.001944280397438856, 0.9999027863410178, -1.993857223553911 },
+		{ 0.003050837231862249, 0.9998474594959691, -1.984972891902056 },
+		{ 0.003821569767744482, 0.9998089218852402, -1.976485226436542 },
+		{ 0.005996340485422959, 0.999700183207747, -1.942437287736057 },
+		{ 0.007511119183508682, 0.9996244440496755, -1.910017787344838 },
+		{ 0.01178494547948788, 0.9994107528058033, -1.781217632117549 },
+		{ 0.01476149432340136, 0.9992619254245886, -1.660513901386123 },
+		{ 0.02315862779475344, 0.9988420777192566, -1.199977815519291 },
+		{ 0.0290054779378187, 0.9985497268515736, -0.7961560547980405 },
+		{ 3.370947685371451e-05, 0.9999983145287805, -1.999996496407056 },
+		{ 5.533353466570009e-05, 0.9999972333242595, -1.999992334442904 },
+		{ 6.931426354669676e-05, 0.9999965342893474, -1.999988847144742 },
+		{ 0.0001137780570708806, 0.9999943110991227, -1.999973598376314 },
+		{ 0.0001425257180585769, 0.9999928737151564, -1.999960371968549 },
+		{ 0.0002339539949823842, 0.999988302380897, -1.999900728560483 },
+		{ 0.0002930644303532369, 0.9999853467865627, -1.999847928688438 },
+		{ 0.0004810574940823437, 0.9999759471432715, -1.999605688568437 },
+		{ 0.0006026031378838627, 0.9999698698805671, -1.999388881836857 },
+		{ 0.0009891523089381427, 0.9999505424099731, -1.998385233871127 },
+		{ 0.001239066516566684, 0.9999380466850015, -1.997482016968877 },
+		{ 0.002033867066229202, 0.9998983067445499, -1.993283048742384 },
+		{ 0.002547719616901388, 0.9998726140778034, -1.989495548334356 },
+		{ 0.004181880178142384, 0.9997909063296323, -1.971872280057074 },
+		{ 0.005238351700460807, 0.9997380827476208, -1.955988378898264 },
+		{ 0.008597924737542978, 0.9995701041178513, -1.882427952227278 },
+		{ 0.01076973888561072, 0.99946151324874, -1.816686597176374 },
+		{ 0.01767527821939132, 0.9991162369475892, -1.51953642599935 },
+		{ 0.02213879974611852, 0.9988930626163601, -1.264267846066997 },
+		{ 0.02213879974611852, 0.9988930626163601, -1.264267846066997 },
+		{ 0.02213879974611852, 0.9988930626163601, -1.264267846066997 },
+		{ 3.370947685371451e-05, 0.9999983145287805, -1.999996496407056 },
+		{ 5.788372191709437e-05, 0.9999971058201372, -1.999991744997445 },
+		{ 6.931426354669676e-05, 0.9999965342893474, -1.999988847144742 },
+		{ 0.0001190215041131668, 0.9999940489249238, -1.999971383111774 },
+		{ 0.000142525718058577, 0.9999928737151564, -1.999960371968549 },
+		{ 0.0002447366962406714, 0.9999877632442348, -1.999891930980561 },
+		{ 0.0002930644303532371, 0.9999853467865627, -1.999847928688438 },
+		{ 0.0005032271329688474, 0.9999748386955772, -1.999569668885425 },
+		{ 0.0006026031378838629, 0.9999698698805671, -1.999388881836857 },
+		{ 0.001034735460176965, 0.9999482632343791, -1.998235380010521 },
+		{ 0.001239066516566685, 0.9999380466850015, -1.997482016968877 },
+		{ 0.002127602776803877, 0.9998936202050073, -1.992654943022718 },
+		{ 0.002547719616901389, 0.9998726140778034, -1.989495548334356 },
+		{ 0.004374568571026591, 0.9997812717191819, -1.969237075983618 },
+		{ 0.005238351700463048, 0.9997380827476208, -1.955988378898264 },
+		{ 0.008994077913180432, 0.9995502962557685, -1.871482694362677 },
+		{ 0.01076973888561517, 0.99946151324874, -1.816686597176374 },
+		{ 0.01848992340735297, 0.9990755230801699, -1.476357386456465 },
+		{ 0.02213879974612089, 0.9988930626163601, -1.264267846066997 },
+		{ 0.02213879974612089, 0.9988930626163601, -1.264267846066997 },
+		{ 0.02213879974612089, 0.9988930626163601, -1.264267846066997 }
+	}
+};
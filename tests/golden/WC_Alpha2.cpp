@@ -0,0 +1,1647 @@
+#include "Scales.hpp"
+Scale wc_alpha2 = {
+	.name = "Alpha Spread 2",
+	.description = "Omitting the octave, Wendy Carlos' Alpha scale is a based on a fixed interval size whose multiples approximate justly intonated intervals. Here the step size is 78 cents - 9 divisions of the perfect fifth, or the minor third in four steps. This scale is constructed from ascending pairs of intervals.",
+	.scalename = {
+		"1/11; E2-",
+		"10/2; E2-",
+		"3/9; E2-",
+		"4/8; E2-",
+		"5/7; E2-",
+		"6/6; E2-",
+		"7/5; E2-",
+		"8/4; E2-",
+		"9/3; E2-",
+		"10/2; E2-",
+		"11/1; E2-"},
+	.notedesc = {
+		"0",
+		"+1",
+		"+11",
+		"+1",
+		"+11",
+		"+1",
+		"+11",
+		"+1",
+		"+11",
+		"+1",
+		"+11",
+		"+1",
+		"+11",
+		"+1",
+		"+11",
+		"+1",
+		"+11",
+		"+1",
+		"+11",
+		"+1",
+		"+11",
+		"0",
+		"+2",
+		"+10",
+		"+2",
+		"+10",
+		"+2",
+		"+10",
+		"+2",
+		"+10",
+		"+2",
+		"+10",
+		"+2",
+		"+10",
+		"+2",
+		"+10",
+		"+2",
+		"+10",
+		"+2",
+		"+10",
+		"+2",
+		"+10",
+		"0",
+		"+3",
+		"+9",
+		"+3",
+		"+9",
+		"+3",
+		"+9",
+		"+3",
+		"+9",
+		"+3",
+		"+9",
+		"+3",
+		"+9",
+		"+3",
+		"+9",
+		"+3",
+		"+9",
+		"+3",
+		"+9",
+		"+3",
+		"+9",
+		"0",
+		"+4",
+		"+8",
+		"+4",
+		"+8",
+		"+4",
+		"+8",
+		"+4",
+		"+8",
+		"+4",
+		"+8",
+		"+4",
+		"+8",
+		"+4",
+		"+8",
+		"+4",
+		"+8",
+		"+4",
+		"+8",
+		"+4",
+		"+8",
+		"0",
+		"+5",
+		"+7",
+		"+5",
+		"+7",
+		"+5",
+		"+7",
+		"+5",
+		"+7",
+		"+5",
+		"+7",
+		"+5",
+		"+7",
+		"+5",
+		"+7",
+		"+5",
+		"+7",
+		"+5",
+		"+7",
+		"+5",
+		"+7",
+		"0",
+		"+6",
+		"+6",
+		"+6",
+		"+6",
+		"+6",
+		"+6",
+		"+6",
+		"+6",
+		"+6",
+		"+6",
+		"+6",
+		"+6",
+		"+6",
+		"+6",
+		"+6",
+		"+6",
+		"+6",
+		"+6",
+		"+6",
+		"+6",
+		"0",
+		"+7",
+		"+5",
+		"+7",
+		"+5",
+		"+7",
+		"+5",
+		"+7",
+		"+5",
+		"+7",
+		"+5",
+		"+7",
+		"+5",
+		"+7",
+		"+5",
+		"+7",
+		"+5",
+		"+7",
+		"+5",
+		"+7",
+		"+5",
+		"0",
+		"+8",
+		"+4",
+		"+8",
+		"+4",
+		"+8",
+		"+4",
+		"+8",
+		"+4",
+		"+8",
+		"+4",
+		"+8",
+		"+4",
+		"+8",
+		"+4",
+		"+8",
+		"+4",
+		"+8",
+		"+4",
+		"+8",
+		"+4",
+		"0",
+		"+9",
+		"+3",
+		"+9",
+		"+3",
+		"+9",
+		"+3",
+		"+9",
+		"+3",
+		"+9",
+		"+3",
+		"+9",
+		"+3",
+		"+9",
+		"+3",
+		"+9",
+		"+3",
+		"+9",
+		"+3",
+		"+9",
+		"+3",
+		"0",
+		"+10",
+		"+2",
+		"+10",
+		"+2",
+		"+10",
+		"+2",
+		"+10",
+		"+2",
+		"+10",
+		"+2",
+		"+10",
+		"+2",
+		"+10",
+		"+2",
+		"+10",
+		"+2",
+		"+10",
+		"+2",
+		"+10",
+		"+2",
+		"0",
+		"+11",
+		"+1",
+		"+11",
+		"+1",
+		"+11",
+		"+1",
+		"+11",
+		"+1",
+		"+11",
+		"+1",
+		"+11",
+		"+1",
+		"+11",
+		"+1",
+		"+11",
+		"+1",
+		"+11",
+		"+1",
+		"+11",
+		"+1"},
+	.c_maxq48000 = {
+		0.01078703678998616,
+		0.01128415673099248,
+		0.01852275389892916,
+		0.01937637389715314,
+		0.03180599257052643,
+		0.03327176982318077,
+		0.05461505178529995,
+		0.05713198315859135,
+		0.09378119154423312,
+		0.09810309211022075,
+		0.1610345792956542,
+		0.1684558481870096,
+		0.2765174477090867,
+		0.2892607376383438,
+		0.4748166463500115,
+		0.4966985429095425,
+		0.8153223224028164,
+		0.8528964025422553,
+		1.400015131142434,
+		1.464534744169763,
+		2.404009204177526,
+		0.01078703678998616,
+		0.01180418641454973,
+		0.01852275389892916,
+		0.02026933292160098,
+		0.03180599257052643,
+		0.03480509733227295,
+		0.05461505178529995,
+		0.05976490716268285,
+		0.09378119154423316,
+		0.1026241672035813,
+		0.1610345792956542,
+		0.1762191258084075,
+		0.2765174477090869,
+		0.3025913013167497,
+		0.474816646350012,
+		0.5195888653545662,
+		0.8153223224028172,
+		0.8922020819026807,
+		1.400015131142435,
+		1.532027739678895,
+		2.404009204177528,
+		0.01078703678998616,
+		0.01234818163476404,
+		0.01852275389892916,
+		0.02120344390892769,
+		0.03180599257052643,
+		0.03640908814730387,
+		0.05461505178529995,
+		0.06251916931098118,
+		0.09378119154423316,
+		0.1073535957704168,
+		0.1610345792956542,
+		0.1843401736115801,
+		0.2765174477090869,
+		0.3165362032196752,
+		0.4748166463500119,
+		0.5435340869312998,
+		0.815322322402817,
+		0.9333191611299348,
+		1.400015131142435,
+		1.602631145822481,
+		2.404009204177528,
+		0.01078703678998616,
+		0.01291724684194936,
+		0.01852275389892916,
+		0.02218060334486489,
+		0.03180599257052643,
+		0.03808699878247326,
+		0.05461505178529995,
+		0.06540036146455667,
+		0.09378119154423312,
+		0.1123009797680079,
+		0.1610345792956542,
+		0.1928354794138141,
+		0.2765174477090868,
+		0.3311237550872095,
+		0.4748166463500116,
+		0.5685828226027158,
+		0.8153223224028164,
+		0.9763311184778212,
+		1.400015131142434,
+		1.676488305687341,
+		2.404009204177526,
+		0.01078703678998616,
+		0.01351253738494584,
+		0.01852275389892916,
+		0.02320279511457497,
+		0.03180599257052644,
+		0.03984223582824169,
+		0.05461505178529998,
+		0.06841433318506047,
+		0.0937811915442332,
+		0.1174763636592587,
+		0.1610345792956543,
+		0.2017222908724635,
+		0.2765174477090871,
+		0.3463835734042802,
+		0.4748166463500123,
+		0.5947859277494292,
+		0.8153223224028177,
+		1.021325279290446,
+		1.400015131142436,
+		1.753749168317825,
+		2.40400920417753,
+		0.01078703678998616,
+		0.01413526185677537,
+		0.01852275389892916,
+		0.02427209453044855,
+		0.03180599257052644,
+		0.04167836286758596,
+		0.05461505178529998,
+		0.07156720361084003,
+		0.09378119154423321,
+		0.1228902548055409,
+		0.1610345792956543,
+		0.211018650502132,
+		0.2765174477090871,
+		0.3623466395297377,
+		0.4748166463500124,
+		0.6221966014192054,
+		0.8153223224028181,
+		1.068392993295135,
+		1.400015131142437,
+		1.834570593150951,
+		2.404009204177531,
+		0.01078703678998616,
+		0.01478668454839649,
+		0.01852275389892916,
+		0.02539067254552285,
+		0.03180599257052644,
+		0.04359910771098985,
+		0.05461505178529998,
+		0.07486537388036527,
+		0.0937811915442332,
+		0.1285536447993428,
+		0.1610345792956543,
+		0.2207434323056235,
+		0.2765174477090871,
+		0.3790453625964909,
+		0.4748166463500123,
+		0.6508704943347257,
+		0.8153223224028178,
+		1.117629820065901,
+		1.400015131142437,
+		1.919116668481457,
+		2.40400920417753,
+		0.01078703678998616,
+		0.01546812801554047,
+		0.01852275389892916,
+		0.02656080016107509,
+		0.03180599257052643,
+		0.04560836996485879,
+		0.05461505178529995,
+		0.07831554012818705,
+		0.09378119154423314,
+		0.1344780317800306,
+		0.1610345792956542,
+		0.2309163800930242,
+		0.2765174477090868,
+		0.396513645310387,
+		0.4748166463500116,
+		0.6808658218788743,
+		0.8153223224028165,
+		1.169135723033971,
+		1.400015131142434,
+		2.00755904460326,
+		2.404009204177526,
+		0.01078703678998616,
+		0.01618097576383978,
+		0.01852275389892916,
+		0.02778485303733964,
+		0.03180599257052643,
+		0.04771022894872472,
+		0.05461505178529995,
+		0.08192470707981397,
+		0.09378119154423317,
+		0.1406754437780312,
+		0.1610345792956543,
+		0.2415581475667202,
+		0.2765174477090869,
+		0.4147869527814328,
+		0.474816646350012,
+		0.7122434822869537,
+		0.8153223224028172,
+		1.223015272439288,
+		1.400015131142435,
+		2.100077282303751,
+		2.404009204177528,
+		0.01078703678998616,
+		0.01692667505770072,
+		0.01852275389892916,
+		0.02906531631670971,
+		0.03180599257052643,
+		0.04990895197731447,
+		0.05461505178529995,
+		0.08570020227310779,
+		0.09378119154423316,
+		0.1471584631348291,
+		0.1610345792956542,
+		0.2526903402537273,
+		0.2765174477090868,
+		0.4339023845270917,
+		0.4748166463500118,
+		0.745067180285769,
+		0.8153223224028169,
+		1.279377857634996,
+		1.400015131142435,
+		2.196859217418377,
+		2.404009204177528,
+		0.01078703678998616,
+		0.01770673985862256,
+		0.01852275389892916,
+		0.03040478966921609,
+		0.03180599257052643,
+		0.05220900302429723,
+		0.05461505178529995,
+		0.0896496909350715,
+		0.09378119154423312,
+		0.1539402520483588,
+		0.1610345792956542,
+		0.2643355593704739,
+		0.2765174477090867,
+		0.4538987497938573,
+		0.4748166463500115,
+		0.7794035564306276,
+		0.8153223224028162,
+		1.338337909175998,
+		1.400015131142433,
+		2.298101342185763,
+		2.404009204177525
+	},
+	.c_maxq96000 = {
+		0.005393518394993082,
+		0.005642078365496238,
+		0.009261376949464578,
+		0.009688186948576571,
+		0.01590299628526321,
+		0.01663588491159038,
+		0.02730752589264997,
+		0.02856599157929567,
+		0.04689059577211656,
+		0.04905154605511038,
+		0.08051728964782708,
+		0.08422792409350482,
+		0.1382587238545434,
+		0.1446303688191719,
+		0.2374083231750058,
+		0.2483492714547712,
+		0.4076611612014082,
+		0.4264482012711276,
+		0.700007565571217,
+		0.7322673720848815,
+		1.202004602088763,
+		0.005393518394993082,
+		0.005902093207274863,
+		0.009261376949464578,
+		0.01013466646080049,
+		0.01590299628526321,
+		0.01740254866613648,
+		0.02730752589264998,
+		0.02988245358134142,
+		0.04689059577211658,
+		0.05131208360179063,
+		0.08051728964782712,
+		0.08810956290420377,
+		0.1382587238545435,
+		0.1512956506583749,
+		0.237408323175006,
+		0.2597944326772831,
+		0.4076611612014086,
+		0.4461010409513403,
+		0.7000075655712177,
+		0.7660138698394475,
+		1.202004602088764,
+		0.005393518394993082,
+		0.006174090817382022,
+		0.009261376949464578,
+		0.01060172195446385,
+		0.01590299628526321,
+		0.01820454407365193,
+		0.02730752589264998,
+		0.03125958465549059,
+		0.04689059577211658,
+		0.05367679788520838,
+		0.08051728964782712,
+		0.09217008680579007,
+		0.1382587238545434,
+		0.1582681016098376,
+		0.237408323175006,
+		0.2717670434656499,
+		0.4076611612014085,
+		0.4666595805649674,
+		0.7000075655712175,
+		0.8013155729112406,
+		1.202004602088764,
+		0.005393518394993082,
+		0.00645862342097468,
+		0.009261376949464578,
+		0.01109030167243245,
+		0.01590299628526321,
+		0.01904349939123663,
+		0.02730752589264997,
+		0.03270018073227834,
+		0.04689059577211656,
+		0.05615048988400394,
+		0.08051728964782709,
+		0.09641773970690705,
+		0.1382587238545434,
+		0.1655618775436048,
+		0.2374083231750058,
+		0.2842914113013579,
+		0.4076611612014082,
+		0.4881655592389106,
+		0.7000075655712171,
+		0.8382441528436707,
+		1.202004602088763,
+		0.005393518394993082,
+		0.006756268692472918,
+		0.00926137694946458,
+		0.01160139755728749,
+		0.01590299628526322,
+		0.01992111791412084,
+		0.02730752589264999,
+		0.03420716659253024,
+		0.0468905957721166,
+		0.05873818182962934,
+		0.08051728964782717,
+		0.1008611454362317,
+		0.1382587238545435,
+		0.1731917867021401,
+		0.2374083231750062,
+		0.2973929638747146,
+		0.4076611612014088,
+		0.510662639645223,
+		0.7000075655712182,
+		0.8768745841589124,
+		1.202004602088765,
+		0.005393518394993082,
+		0.007067630928387683,
+		0.00926137694946458,
+		0.01213604726522428,
+		0.01590299628526322,
+		0.02083918143379298,
+		0.02730752589264999,
+		0.03578360180542001,
+		0.04689059577211661,
+		0.06144512740277046,
+		0.08051728964782717,
+		0.105509325251066,
+		0.1382587238545435,
+		0.1811733197648689,
+		0.2374083231750062,
+		0.3110983007096027,
+		0.4076611612014091,
+		0.5341964966475673,
+		0.7000075655712185,
+		0.9172852965754755,
+		1.202004602088766,
+		0.005393518394993082,
+		0.007393342274198247,
+		0.00926137694946458,
+		0.01269533627276143,
+		0.01590299628526322,
+		0.02179955385549492,
+		0.02730752589264999,
+		0.03743268694018263,
+		0.0468905957721166,
+		0.06427682239967142,
+		0.08051728964782717,
+		0.1103717161528118,
+		0.1382587238545435,
+		0.1895226812982454,
+		0.2374083231750062,
+		0.3254352471673628,
+		0.4076611612014089,
+		0.5588149100329504,
+		0.7000075655712183,
+		0.9595583342407283,
+		1.202004602088765,
+		0.005393518394993082,
+		0.007734064007770234,
+		0.009261376949464578,
+		0.01328040008053754,
+		0.01590299628526321,
+		0.0228041849824294,
+		0.02730752589264998,
+		0.03915777006409352,
+		0.04689059577211657,
+		0.06723901589001532,
+		0.08051728964782709,
+		0.1154581900465121,
+		0.1382587238545434,
+		0.1982568226551935,
+		0.2374083231750058,
+		0.3404329109394372,
+		0.4076611612014083,
+		0.5845678615169856,
+		0.7000075655712171,
+		1.00377952230163,
+		1.202004602088763,
+		0.005393518394993082,
+		0.008090487881919892,
+		0.009261376949464578,
+		0.01389242651866982,
+		0.01590299628526321,
+		0.02385511447436236,
+		0.02730752589264998,
+		0.04096235353990699,
+		0.04689059577211659,
+		0.07033772188901562,
+		0.08051728964782714,
+		0.1207790737833601,
+		0.1382587238545435,
+		0.2073934763907164,
+		0.237408323175006,
+		0.3561217411434768,
+		0.4076611612014086,
+		0.6115076362196439,
+		0.7000075655712177,
+		1.050038641151875,
+		1.202004602088764,
+		0.005393518394993082,
+		0.008463337528850359,
+		0.009261376949464578,
+		0.01453265815835486,
+		0.01590299628526321,
+		0.02495447598865724,
+		0.02730752589264998,
+		0.04285010113655389,
+		0.04689059577211658,
+		0.07357923156741455,
+		0.08051728964782712,
+		0.1263451701268636,
+		0.1382587238545434,
+		0.2169511922635458,
+		0.2374083231750059,
+		0.3725335901428845,
+		0.4076611612014084,
+		0.6396889288174978,
+		0.7000075655712175,
+		1.098429608709188,
+		1.202004602088764,
+		0.005393518394993082,
+		0.008853369929311281,
+		0.009261376949464578,
+		0.01520239483460805,
+		0.01590299628526321,
+		0.02610450151214862,
+		0.02730752589264997,
+		0.04482484546753575,
+		0.04689059577211656,
+		0.07697012602417939,
+		0.08051728964782708,
+		0.132167779685237,
+		0.1382587238545434,
+		0.2269493748969287,
+		0.2374083231750057,
+		0.3897017782153138,
+		0.4076611612014081,
+		0.6691689545879991,
+		0.7000075655712167,
+		1.149050671092882,
+		1.202004602088762
+	},
+	.c_bpre4800022 = {
+		{ 0.005379000083443899, 0.9946209999165567, -1.994504953804058 },
+		{ 0.005626191246895946, 0.9943738087531044, -1.994246836126944 },
+		{ 0.009218595483538981, 0.9907814045170997, -1.990439905294249 },
+		{ 0.00964143404597312, 0.99035856595461, -1.989984941632433 },
+		{ 0.01577721871644, 0.9842227812835883, -1.98321922406034 },
+		{ 0.01649829858809573, 0.983501701412234, -1.982403920449014 },
+		{ 0.02693802955118118, 0.9730619704489037, -1.970120077058763 },
+		{ 0.02816182829717179, 0.9718381717028763, -1.968620947414538 },
+		{ 0.04580824487199221, 0.9541917551281658, -1.945604568104729 },
+		{ 0.04786792416836756, 0.9521320758317516, -1.942745746887318 },
+		{ 0.07736083328866365, 0.9226391667165433, -1.897764066179471 },
+		{ 0.08077840782339256, 0.9192215921783554, -1.892054604811962 },
+		{ 0.1291267844734484, 0.8708732155277853, -1.799802388565307 },
+		{ 0.1346579505225221, 0.8653420494775994, -1.787846376192201 },
+		{ 0.2113307072464941, 0.7886692927540164, -1.590800757318742 },
+		{ 0.2199127013788623, 0.7800872986219982, -1.56498228734397 },
+		{ 0.3347955997204201, 0.6652044002805702, -1.141721006094126 },
+		{ 0.347176381233719, 0.6528236187664199, -1.087234365384648 },
+		{ 0.5034175506428556, 0.496582449386537, -0.2543528883499066 },
+		{ 0.5191817686398702, 0.4808182313765552, -0.1570622345970419 },
+		{ 0.6994094003841088, 0.3005905996263732, 0.9625642827310784 },
+		{ 0.005379000083443899, 0.9946209999165567, -1.994504953804058 },
+		{ 0.005884707363048441, 0.9941152926369616, -1.99397636554554 },
+		{ 0.009218595483538981, 0.9907814045170997, -1.990439905294249 },
+		{ 0.01008346451756585, 0.9899165354827316, -1.989507776565261 },
+		{ 0.01577721871644, 0.9842227812835883, -1.98321922406034 },
+		{ 0.01725197589100069, 0.9827480241092492, -1.981547203246419 },
+		{ 0.02693802955118117, 0.9730619704489037, -1.970120077058763 },
+		{ 0.02944037088974845, 0.9705596291103273, -1.967041414580127 },
+		{ 0.0458082448719922, 0.9541917551281658, -1.945604568104729 },
+		{ 0.05001785657602351, 0.9499821434239846, -1.939722816583335 },
+		{ 0.07736083328866393, 0.9226391667165433, -1.897764066179471 },
+		{ 0.08433915413211027, 0.9156608458770499, -1.885994273001052 },
+		{ 0.1291267844734482, 0.8708732155277853, -1.799802388565307 },
+		{ 0.1404066322118473, 0.8595933677897319, -1.775107194819243 },
+		{ 0.2113307072464939, 0.7886692927540164, -1.590800757318742 },
+		{ 0.2287900694274124, 0.7712099305739922, -1.537451251986674 },
+		{ 0.3347955997204202, 0.6652044002805702, -1.141721006094126 },
+		{ 0.3598808325510424, 0.6401191674491733, -1.029502003173252 },
+		{ 0.5034175506428554, 0.496582449386537, -0.2543528883499066 },
+		{ 0.5351367110112368, 0.4648632890192927, -0.05678216691720155 },
+		{ 0.6994094003841087, 0.3005905996263732, 0.9625642827310784 },
+		{ 0.005379000083443899, 0.9946209999165567, -1.994504953804058 },
+		{ 0.00615507295202291, 0.9938449270479865, -1.993692920512917 },
+		{ 0.009218595483538981, 0.9907814045170997, -1.990439905294249 },
+		{ 0.01054569719106292, 0.9894543028094004, -1.989007106225797 },
+		{ 0.01577721871644, 0.9842227812835883, -1.98321922406034 },
+		{ 0.01803984585682462, 0.9819601541431809, -1.980646634040758 },
+		{ 0.02693802955118117, 0.9730619704489037, -1.970120077058763 },
+		{ 0.0307760379898387, 0.9692239620102413, -1.965376719559224 },
+		{ 0.0458082448719922, 0.9541917551281658, -1.945604568104729 },
+		{ 0.05226162820002475, 0.9477383717999777, -1.936525506229947 },
+		{ 0.07736083328866393, 0.9226391667165433, -1.897764066179471 },
+		{ 0.08805026127581893, 0.9119497387324023, -1.87955613656456 },
+		{ 0.129126784473448, 0.8708732155277853, -1.799802388565307 },
+		{ 0.1463791914589858, 0.8536208085414865, -1.761531543417727 },
+		{ 0.2113307072464939, 0.7886692927540164, -1.590800757318742 },
+		{ 0.2379680118630047, 0.76203198813932, -1.508099631366453 },
+		{ 0.33479559972042, 0.6652044002805702, -1.141721006094126 },
+		{ 0.3729063404601666, 0.6270936595404496, -0.9683978591098288 },
+		{ 0.5034175506428556, 0.496582449386537, -0.2543528883499066 },
+		{ 0.5512617692101139, 0.4487382307898864, 0.04611251013355543 },
+		{ 0.6994094003841088, 0.3005905996263732, 0.9625642827310784 },
+		{ 0.005379000083443899, 0.9946209999165567, -1.994504953804058 },
+		{ 0.006437811542284812, 0.9935621884577152, -1.993395872585341 },
+		{ 0.009218595483538981, 0.9907814045170997, -1.990439905294249 },
+		{ 0.01102900977011101, 0.9889709902302193, -1.988481746038727 },
+		{ 0.01577721871644, 0.9842227812835883, -1.98321922406034 },
+		{ 0.01886330225454393, 0.9811366977455572, -1.979699936051441 },
+		{ 0.02693802955118118, 0.9730619704489037, -1.970120077058763 },
+		{ 0.03217131283099472, 0.9678286871690076, -1.963621780686172 },
+		{ 0.04580824487199221, 0.9541917551281658, -1.945604568104729 },
+		{ 0.05460312952674991, 0.9453968704733003, -1.933142569557627 },
+		{ 0.07736083328866365, 0.9226391667165433, -1.897764066179471 },
+		{ 0.09191513586258812, 0.9080848641444318, -1.872718314260232 },
+		{ 0.1291267844734482, 0.8708732155277853, -1.799802388565307 },
+		{ 0.1525826213889243, 0.8474173786112127, -1.747061168699502 },
+		{ 0.2113307072464939, 0.7886692927540164, -1.590800757318742 },
+		{ 0.2474525498764906, 0.752547450124346, -1.476810539929985 },
+		{ 0.3347955997204201, 0.6652044002805702, -1.141721006094126 },
+		{ 0.3862487341904003, 0.6137512658096063, -0.9038069316600397 },
+		{ 0.5034175506428556, 0.496582449386537, -0.2543528883499066 },
+		{ 0.5675300219262313, 0.4324699780967577, 0.1511137868792643 },
+		{ 0.6994094003841088, 0.3005905996263732, 0.9625642827310784 },
+		{ 0.005379000083443899, 0.9946209999165567, -1.994504953804058 },
+		{ 0.006733484611900285, 0.9932665153882666, -1.993084544860087 },
+		{ 0.009218595483538978, 0.9907814045170997, -1.990439905294249 },
+		{ 0.01153434157363681, 0.9884656584266235, -1.987930419407229 },
+		{ 0.01577721871644, 0.9842227812835883, -1.98321922406034 },
+		{ 0.01972398676669538, 0.9802760132334208, -1.978704475045968 },
+		{ 0.02693802955118117, 0.9730619704489037, -1.970120077058763 },
+		{ 0.03362871552814422, 0.9663712844718559, -1.961771258187696 },
+		{ 0.04580824487199217, 0.9541917551281658, -1.945604568104729 },
+		{ 0.0570463615929872, 0.9429536384070676, -1.92956200319943 },
+		{ 0.0773608332886639, 0.9226391667165433, -1.897764066179471 },
+		{ 0.09594115994499336, 0.9040588400624249, -1.865450398135463 },
+		{ 0.1291267844734481, 0.8708732155277853, -1.799802388565307 },
+		{ 0.1590239319936572, 0.8409760680099099, -1.731633937455617 },
+		{ 0.2113307072464942, 0.7886692927540164, -1.590800757318742 },
+		{ 0.2572479302696035, 0.7427520697304012, -1.443466561342023 },
+		{ 0.33479559972042, 0.6652044002805702, -1.141721006094126 },
+		{ 0.3999021857774664, 0.6000978142225424, -0.8356290912373318 },
+		{ 0.5034175506428556, 0.496582449386537, -0.2543528883499066 },
+		{ 0.5839198689739242, 0.4160801310810957, 0.2576408959402607 },
+		{ 0.6994094003841088, 0.3005905996263732, 0.9625642827310784 },
+		{ 0.005379000083443899, 0.9946209999165567, -1.994504953804058 },
+		{ 0.007042684961918142, 0.9929573150390442, -1.992758217955885 },
+		{ 0.009218595483538978, 0.9907814045170997, -1.990439905294249 },
+		{ 0.01206269316764592, 0.9879373068324115, -1.987351755189107 },
+		{ 0.01577721871644, 0.9842227812835883, -1.98321922406034 },
+		{ 0.02062353088469525, 0.9793764691153976, -1.977657547030635 },
+		{ 0.02693802955118116, 0.9730619704489037, -1.970120077058763 },
+		{ 0.03515092725190852, 0.9648490727481163, -1.95981937758477 },
+		{ 0.04580824487199216, 0.9541917551281658, -1.945604568104729 },
+		{ 0.05959542907923106, 0.9404045709208523, -1.925771004229737 },
+		{ 0.07736083328866387, 0.9226391667165433, -1.897764066179471 },
+		{ 0.1001336982271111, 0.8998663017772156, -1.857723775586026 },
+		{ 0.1291267844734481, 0.8708732155277853, -1.799802388565307 },
+		{ 0.1657090114497375, 0.8342909885536643, -1.715186424776034 },
+		{ 0.2113307072464942, 0.7886692927540164, -1.590800757318742 },
+		{ 0.2673580555300242, 0.7326419444703249, -1.407945427751183 },
+		{ 0.33479559972042, 0.6652044002805702, -1.141721006094126 },
+		{ 0.4138598855428581, 0.5861401144572234, -0.7637794723229543 },
+		{ 0.5034175506428556, 0.496582449386537, -0.2543528883499066 },
+		{ 0.6003979691437712, 0.3996020308609814, 0.3649151208059169 },
+		{ 0.6994094003841088, 0.3005905996263732, 0.9625642827310784 },
+		{ 0.005379000083443899, 0.9946209999165567, -1.994504953804058 },
+		{ 0.007366082062479619, 0.9926339179375324, -1.992416080952444 },
+		{ 0.009218595483538978, 0.9907814045170997, -1.990439905294249 },
+		{ 0.01261506134508956, 0.9873849386554538, -1.986744356170097 },
+		{ 0.01577721871644, 0.9842227812835883, -1.98321922406034 },
+		{ 0.02156368333323124, 0.9784363166669607, -1.976556223362306 },
+		{ 0.02693802955118116, 0.9730619704489037, -1.970120077058763 },
+		{ 0.03674072389672674, 0.9632592761033694, -1.957759990105584 },
+		{ 0.04580824487199217, 0.9541917551281658, -1.945604568104729 },
+		{ 0.06225465570408695, 0.9377453442960395, -1.921755738653899 },
+		{ 0.0773608332886639, 0.9226391667165433, -1.897764066179471 },
+		{ 0.1044990565250883, 0.8955009434806055, -1.849506261849586 },
+		{ 0.1291267844734481, 0.8708732155277853, -1.799802388565307 },
+		{ 0.172645871738146, 0.8273541282636252, -1.697645727758532 },
+		{ 0.2113307072464942, 0.7886692927540164, -1.590800757318742 },
+		{ 0.2777868521246476, 0.7222131478770528, -1.370118772785161 },
+		{ 0.3347955997204199, 0.6652044002805702, -1.141721006094126 },
+		{ 0.4281134922131394, 0.5718865077872762, -0.6881954312857252 },
+		{ 0.5034175506428556, 0.496582449386537, -0.2543528883499066 },
+		{ 0.6169386830680756, 0.3830613169536528, 0.4720706631548435 },
+		{ 0.6994094003841087, 0.3005905996263732, 0.9625642827310784 },
+		{ 0.005379000083443899, 0.9946209999165567, -1.994504953804058 },
+		{ 0.007704246491738833, 0.9922957535084488, -1.992057416114368 },
+		{ 0.009218595483538981, 0.9907814045170997, -1.990439905294249 },
+		{ 0.0131926326402724, 0.9868073673602088, -1.986106583005493 },
+		{ 0.01577721871644, 0.9842227812835883, -1.98321922406034 },
+		{ 0.02254611682589365, 0.977453883174224, -1.975397568922086 },
+		{ 0.02693802955118118, 0.9730619704489037, -1.970120077058763 },
+		{ 0.03840103600897215, 0.9615989639911295, -1.955586470235373 },
+		{ 0.0458082448719922, 0.9541917551281658, -1.945604568104729 },
+		{ 0.06502851339857725, 0.9349714866075074, -1.917501376806364 },
+		{ 0.07736083328866365, 0.9226391667165433, -1.897764066179471 },
+		{ 0.1090421076630613, 0.8909578923373431, -1.840766401414811 },
+		{ 0.1291267844734482, 0.8708732155277853, -1.799802388565307 },
+		{ 0.1798407492841283, 0.8201592507160694, -1.678938738252793 },
+		{ 0.2113307072464939, 0.7886692927540164, -1.590800757318742 },
+		{ 0.288537662944482, 0.7114623370557795, -1.329854409314709 },
+		{ 0.3347955997204199, 0.6652044002805702, -1.141721006094126 },
+		{ 0.4426533752342088, 0.5573466247658369, -0.608840307467209 },
+		{ 0.5034175506428556, 0.496582449386537, -0.2543528883499066 },
+		{ 0.6335078302277696, 0.3664921697837775, 0.5780340662990445 },
+		{ 0.6994094003841088, 0.3005905996263732, 0.9625642827310784 },
+		{ 0.005379000083443899, 0.9946209999165567, -1.994504953804058 },
+		{ 0.008057877230515929, 0.9919421227703414, -1.991681357454463 },
+		{ 0.009218595483538981, 0.9907814045170997, -1.990439905294249 },
+		{ 0.01379639520717975, 0.9862036047931347, -1.985436978863844 },
+		{ 0.01577721871644, 0.9842227812835883, -1.98321922406034 },
+		{ 0.02357281108311014, 0.9764271889170186, -1.974178182340334 },
+		{ 0.02693802955118117, 0.9730619704489037, -1.970120077058763 },
+		{ 0.04013475653344472, 0.9598652434666499, -1.953291941790517 },
+		{ 0.04580824487199219, 0.9541917551281658, -1.945604568104729 },
+		{ 0.06792094182004686, 0.9320790581806629, -1.912993091228645 },
+		{ 0.07736083328866393, 0.9226391667165433, -1.897764066179471 },
+		{ 0.1137703683883467, 0.8862296316124137, -1.831465533400661 },
+		{ 0.1291267844734482, 0.8708732155277853, -1.799802388565307 },
+		{ 0.1873002493370634, 0.8126997506631164, -1.658986691859637 },
+		{ 0.2113307072464939, 0.7886692927540164, -1.590800757318742 },
+		{ 0.2996126782892928, 0.7003873217107368, -1.28701898104315 },
+		{ 0.3347955997204202, 0.6652044002805702, -1.141721006094126 },
+		{ 0.457467744140264, 0.5425322558598429, -0.5257140547125931 },
+		{ 0.5034175506428554, 0.496582449386537, -0.2543528883499066 },
+		{ 0.650075574360802, 0.349924425640998, 0.681592819865666 },
+		{ 0.6994094003841087, 0.3005905996263732, 0.9625642827310784 },
+		{ 0.005379000083443899, 0.9946209999165567, -1.994504953804058 },
+		{ 0.008427606640516718, 0.9915723933597821, -1.991287096351122 },
+		{ 0.009218595483538981, 0.9907814045170997, -1.990439905294249 },
+		{ 0.0144275906615163, 0.9855724093387532, -1.984733767366456 },
+		{ 0.01577721871644, 0.9842227812835883, -1.98321922406034 },
+		{ 0.02464566729505762, 0.9753543327050707, -1.972894638813077 },
+		{ 0.02693802955118117, 0.9730619704489037, -1.970120077058763 },
+		{ 0.04194498932937676, 0.9580550106707029, -1.950868925825531 },
+		{ 0.0458082448719922, 0.9541917551281658, -1.945604568104729 },
+		{ 0.07093759908631396, 0.9290624009157681, -1.908212473685783 },
+		{ 0.07736083328866362, 0.9226391667165433, -1.897764066179471 },
+		{ 0.1186892922941614, 0.8813107077068634, -1.821566639900685 },
+		{ 0.1291267844734481, 0.8708732155277853, -1.799802388565307 },
+		{ 0.1950307404392338, 0.8049692595607665, -1.637706449626237 },
+		{ 0.2113307072464939, 0.7886692927540164, -1.590800757318742 },
+		{ 0.3110133123079719, 0.6889866876932756, -1.241477348724856 },
+		{ 0.3347955997204198, 0.6652044002805702, -1.141721006094126 },
+		{ 0.4725436324664906, 0.5274563675339197, -0.4388546894140108 },
+		{ 0.5034175506428556, 0.496582449386537, -0.2543528883499066 },
+		{ 0.6666064621605078, 0.3333935378626297, 0.7813183211959367 },
+		{ 0.6994094003841088, 0.3005905996263732, 0.9625642827310784 },
+		{ 0.005379000083443899, 0.9946209999165567, -1.994504953804058 },
+		{ 0.0088143248482967, 0.9911856751525603, -1.990873534266742 },
+		{ 0.009218595483538981, 0.9907814045170997, -1.990439905294249 },
+		{ 0.01508739063294212, 0.9849126093675807, -1.983995206407012 },
+		{ 0.01577721871644, 0.9842227812835883, -1.98321922406034 },
+		{ 0.02576669883632816, 0.9742333011638828, -1.971543254908138 },
+		{ 0.02693802955118118, 0.9730619704489037, -1.970120077058763 },
+		{ 0.04383504431723157, 0.9561649556827956, -1.9483093090313 },
+		{ 0.04580824487199221, 0.9541917551281658, -1.945604568104729 },
+		{ 0.07408267392137419, 0.9259173260827515, -1.903142424808193 },
+		{ 0.07736083328866365, 0.9226391667165433, -1.897764066179471 },
+		{ 0.1238057424552585, 0.8761942575506468, -1.811027425619177 },
+		{ 0.1291267844734484, 0.8708732155277853, -1.799802388565307 },
+		{ 0.2030388190134386, 0.7969611809867045, -1.615008978497414 },
+		{ 0.211330707246494, 0.7886692927540164, -1.590800757318742 },
+		{ 0.3227409794398026, 0.6772590205617612, -1.193090192439451 },
+		{ 0.3347955997204201, 0.6652044002805702, -1.141721006094126 },
+		{ 0.4878643667758227, 0.5121356333186333, -0.348360800241066 },
+		{ 0.5034175506428555, 0.496582449386537, -0.2543528883499066 },
+		{ 0.6830624738821406, 0.316937526117883, 0.8755776092233734 },
+		{ 0.6994094003841088, 0.3005905996263732, 0.9625642827310784 }
+	},
+	.c_bpre9600022 = {
+		{ 0.002693126506912854, 0.9973068734930874, -1.997277822687978 },
+		{ 0.002817063546962192, 0.9971829364530382, -1.997151148332455 },
+		{ 0.004619969802255383, 0.9953800301980645, -1.995294456344996 },
+		{ 0.004832393034204496, 0.9951676069660879, -1.995073973003611 },
+		{ 0.007919972339146285, 0.9920800276608678, -1.991828128941975 },
+		{ 0.008283457125017895, 0.9917165428751474, -1.99144094192801 },
+		{ 0.01356096465680172, 0.986439035343241, -1.98569843753907 },
+		{ 0.01418147121144635, 0.9858185287885778, -1.985008354909215 },
+		{ 0.02317260730054819, 0.976827392699532, -1.974654535175824 },
+		{ 0.02422744667026335, 0.975772553329797, -1.973396124626973 },
+		{ 0.0394589198209979, 0.9605410801816564, -1.95418942245008 },
+		{ 0.04123955433244642, 0.9587604456684451, -1.951816470122136 },
+		{ 0.06679411943205317, 0.9332058805685834, -1.914758180731801 },
+		{ 0.06976236934991567, 0.9302376306501471, -1.9100844831844 },
+		{ 0.1119294550805438, 0.8880705449197244, -1.83511165951098 },
+		{ 0.1167744916380658, 0.8832255083623877, -1.825447124785262 },
+		{ 0.1843993622613462, 0.8156006377391881, -1.666813424517732 },
+		{ 0.1920249887736017, 0.8079750112264734, -1.646053881930104 },
+		{ 0.2953139355971123, 0.7046860644191402, -1.303809505642585 },
+		{ 0.3065894207874067, 0.6934105792216867, -1.259324046290885 },
+		{ 0.4517385663571905, 0.5482614336485589, -0.5581285639001926 },
+		{ 0.002693126506912854, 0.9973068734930874, -1.997277822687978 },
+		{ 0.002946695187788882, 0.9970533048122161, -1.997018521564696 },
+		{ 0.004619969802255383, 0.9953800301980645, -1.995294456344996 },
+		{ 0.005054506275628144, 0.9949454937245211, -1.994843043108473 },
+		{ 0.007919972339146283, 0.9920800276608678, -1.991828128941975 },
+		{ 0.00866351620199095, 0.9913364837981347, -1.991034955386547 },
+		{ 0.01356096465680171, 0.986439035343241, -1.98569843753907 },
+		{ 0.01483015215128967, 0.9851698478487489, -1.984283575150227 },
+		{ 0.02317260730054818, 0.976827392699532, -1.974654535175824 },
+		{ 0.02532972579237016, 0.9746702742076341, -1.972071259562314 },
+		{ 0.03945891982099776, 0.9605410801816564, -1.95418942245008 },
+		{ 0.04309830919362458, 0.9569016908110518, -1.949310656946115 },
+		{ 0.06679411943205311, 0.9332058805685834, -1.914758180731801 },
+		{ 0.07285741776778674, 0.9271425822330308, -1.905128064472144 },
+		{ 0.1119294550805442, 0.8880705449197244, -1.83511165951098 },
+		{ 0.1218144099493036, 0.878185590051438, -1.815158840915404 },
+		{ 0.1843993622613463, 0.8156006377391881, -1.666813424517732 },
+		{ 0.1999255238110731, 0.8000744761890439, -1.623912380887305 },
+		{ 0.2953139355971122, 0.7046860644191402, -1.303809505642585 },
+		{ 0.3181911638910648, 0.681808836125855, -1.212048005222125 },
+		{ 0.4517385663571904, 0.5482614336485589, -0.5581285639001926 },
+		{ 0.002693126506912854, 0.9973068734930874, -1.997277822687978 },
+		{ 0.003082286721728964, 0.9969177132782757, -1.996879652716111 },
+		{ 0.004619969802255383, 0.9953800301980645, -1.995294456344996 },
+		{ 0.005286823848734956, 0.9947131761514975, -1.994601078328744 },
+		{ 0.007919972339146283, 0.9920800276608678, -1.991828128941975 },
+		{ 0.009060973549242018, 0.9909390264507605, -1.990609131433932 },
+		{ 0.01356096465680171, 0.986439035343241, -1.98569843753907 },
+		{ 0.01550827224899349, 0.9844917277510468, -1.983522223217624 },
+		{ 0.02317260730054818, 0.976827392699532, -1.974654535175824 },
+		{ 0.02648144763441966, 0.9735185523655817, -1.970676185858698 },
+		{ 0.03945891982099776, 0.9605410801816564, -1.95418942245008 },
+		{ 0.04503940462217004, 0.9549605953820305, -1.946662403159716 },
+		{ 0.06679411943205313, 0.9332058805685834, -1.914758180731801 },
+		{ 0.07608398187874543, 0.923916018121499, -1.899870357400572 },
+		{ 0.1119294550805443, 0.8880705449197244, -1.83511165951098 },
+		{ 0.1270555641180974, 0.8729444358831323, -1.804203902706079 },
+		{ 0.1843993622613462, 0.8156006377391881, -1.666813424517732 },
+		{ 0.2081075454710281, 0.7918924545293065, -1.600296566861078 },
+		{ 0.2953139355971124, 0.7046860644191402, -1.303809505642585 },
+		{ 0.3301207341692934, 0.6698792658307067, -1.16183916779556 },
+		{ 0.4517385663571904, 0.5482614336485589, -0.5581285639001926 },
+		{ 0.002693126506912854, 0.9973068734930874, -1.997277822687978 },
+		{ 0.0032241031918383, 0.9967758968081617, -1.996734250378669 },
+		{ 0.004619969802255383, 0.9953800301980645, -1.995294456344996 },
+		{ 0.005529794196985336, 0.9944702058031802, -1.994347552811678 },
+		{ 0.007919972339146285, 0.9920800276608678, -1.991828128941975 },
+		{ 0.009476553661924575, 0.9905234463381256, -1.990162521326335 },
+		{ 0.01356096465680172, 0.986439035343241, -1.98569843753907 },
+		{ 0.01621715446496756, 0.9837828455350334, -1.982722308564224 },
+		{ 0.02317260730054819, 0.976827392699532, -1.974654535175824 },
+		{ 0.02768478852110376, 0.9723152114789217, -1.969206796273801 },
+		{ 0.03945891982099777, 0.9605410801816564, -1.95418942245008 },
+		{ 0.04706513121956262, 0.9529348687840274, -1.943864342136214 },
+		{ 0.06679411943205316, 0.9332058805685834, -1.914758180731801 },
+		{ 0.07944724289637697, 0.9205527571036941, -1.894290928244749 },
+		{ 0.111929455080544, 0.8880705449197244, -1.83511165951098 },
+		{ 0.1325050719897111, 0.8674949280107324, -1.792534966821074 },
+		{ 0.1843993622613464, 0.8156006377391881, -1.666813424517732 },
+		{ 0.2165772113286461, 0.7834227886713574, -1.57510958880094 },
+		{ 0.2953139355971123, 0.7046860644191402, -1.303809505642585 },
+		{ 0.3423755037409426, 0.6576244962718144, -1.108570531256563 },
+		{ 0.4517385663571905, 0.5482614336485589, -0.5581285639001926 },
+		{ 0.002693126506912854, 0.9973068734930874, -1.997277822687978 },
+		{ 0.003372428944442714, 0.9966275710556409, -1.996582001193667 },
+		{ 0.004619969802255381, 0.9953800301980645, -1.995294456344996 },
+		{ 0.005783897522090633, 0.9942161024780396, -1.9940819012432 },
+		{ 0.007919972339146283, 0.9920800276608678, -1.991828128941975 },
+		{ 0.009911108418387791, 0.9900888915816705, -1.989694020995894 },
+		{ 0.01356096465680171, 0.986439035343241, -1.98569843753907 },
+		{ 0.01695814714130531, 0.9830418528586952, -1.981881757390778 },
+		{ 0.02317260730054817, 0.976827392699532, -1.974654535175824 },
+		{ 0.02894200049275454, 0.9710579995072733, -1.967658732832229 },
+		{ 0.03945891982099774, 0.9605410801816564, -1.95418942245008 },
+		{ 0.04917991183652276, 0.9508200881672749, -1.940905741140643 },
+		{ 0.06679411943205346, 0.9332058805685834, -1.914758180731801 },
+		{ 0.0829525268523388, 0.9170474731495148, -1.888367874894747 },
+		{ 0.1119294550805441, 0.8880705449197244, -1.83511165951098 },
+		{ 0.1381693497383629, 0.86183065026164, -1.780103116539315 },
+		{ 0.184399362261346, 0.8156006377391881, -1.666813424517732 },
+		{ 0.2253401945224375, 0.7746598054775674, -1.548250204087158 },
+		{ 0.2953139355971123, 0.7046860644191402, -1.303809505642585 },
+		{ 0.3549572641741469, 0.6450427358563893, -1.052094866198735 },
+		{ 0.4517385663571906, 0.5482614336485589, -0.5581285639001926 },
+		{ 0.002693126506912854, 0.9973068734930874, -1.997277822687978 },
+		{ 0.003527564336030462, 0.9964724356644515, -1.99642257298057 },
+		{ 0.004619969802255381, 0.9953800301980645, -1.995294456344996 },
+		{ 0.006049645690312002, 0.9939503543097168, -1.993803518202981 },
+		{ 0.007919972339146283, 0.9920800276608678, -1.991828128941975 },
+		{ 0.01036548710379724, 0.9896345128962495, -1.98920250841283 },
+		{ 0.01356096465680171, 0.986439035343241, -1.98569843753907 },
+		{ 0.0177326877330738, 0.982267312266939, -1.980998335331727 },
+		{ 0.02317260730054816, 0.976827392699532, -1.974654535175824 },
+		{ 0.03025540943979993, 0.9697445905602424, -1.96602737444272 },
+		{ 0.03945891982099772, 0.9605410801816564, -1.95418942245008 },
+		{ 0.05138716971937984, 0.9486128302828375, -1.937776747535311 },
+		{ 0.06679411943205346, 0.9332058805685834, -1.914758180731801 },
+		{ 0.08660469206896532, 0.9133953079328051, -1.882078783822976 },
+		{ 0.1119294550805441, 0.8880705449197244, -1.83511165951098 },
+		{ 0.1440549407409341, 0.8559450592592522, -1.766855961551893 },
+		{ 0.1843993622613461, 0.8156006377391881, -1.666813424517732 },
+		{ 0.23440211961033, 0.7655978803897143, -1.51961134462474 },
+		{ 0.2953139355971121, 0.7046860644191402, -1.303809505642585 },
+		{ 0.3678591684935646, 0.6321408315090725, -0.9923041948970662 },
+		{ 0.4517385663571904, 0.5482614336485589, -0.5581285639001926 },
+		{ 0.002693126506912854, 0.9973068734930874, -1.997277822687978 },
+		{ 0.00368984852229849, 0.9963101514777074, -1.996255591013349 },
+		{ 0.004619969802255381, 0.9953800301980645, -1.995294456344996 },
+		{ 0.006327549614606555, 0.9936724503856659, -1.99351179163657 },
+		{ 0.007919972339146281, 0.9920800276608678, -1.991828128941975 },
+		{ 0.01084060098143454, 0.9891593990186622, -1.988686772027765 },
+		{ 0.01356096465680171, 0.986439035343241, -1.98569843753907 },
+		{ 0.01854226983365484, 0.9814577301663937, -1.980069678564193 },
+		{ 0.02317260730054817, 0.976827392699532, -1.974654535175824 },
+		{ 0.03162747648649424, 0.9683725235135699, -1.964307743897223 },
+		{ 0.03945891982099774, 0.9605410801816564, -1.95418942245008 },
+		{ 0.05369088376203557, 0.9463091162408853, -1.934466197453316 },
+		{ 0.06679411943205346, 0.9332058805685834, -1.914758180731801 },
+		{ 0.09040991195926885, 0.9095900880416548, -1.875397558833255 },
+		{ 0.1119294550805441, 0.8880705449197244, -1.83511165951098 },
+		{ 0.1501687532953904, 0.8498312467055167, -1.75273683923993 },
+		{ 0.1843993622613463, 0.8156006377391881, -1.666813424517732 },
+		{ 0.2437682182115512, 0.7562317817886767, -1.489081038758874 },
+		{ 0.2953139355971121, 0.7046860644191402, -1.303809505642585 },
+		{ 0.3810805246732517, 0.6189194753387979, -0.9290658420273172 },
+		{ 0.4517385663571904, 0.5482614336485589, -0.5581285639001926 },
+		{ 0.002693126506912854, 0.9973068734930874, -1.997277822687978 },
+		{ 0.003859571391532677, 0.9961404286085616, -1.996080728383126 },
+		{ 0.004619969802255383, 0.9953800301980645, -1.995294456344996 },
+		{ 0.006618216716387716, 0.9933817832838535, -1.993205999714487 },
+		{ 0.007919972339146285, 0.9920800276608678, -1.991828128941975 },
+		{ 0.01133732589213857, 0.9886626741079203, -1.988145614377443 },
+		{ 0.01356096465680172, 0.986439035343241, -1.98569843753907 },
+		{ 0.01938847447573383, 0.9806115255243176, -1.979093251312045 },
+		{ 0.02317260730054818, 0.976827392699532, -1.974654535175824 },
+		{ 0.03306076374907205, 0.9669392362540199, -1.962494530824345 },
+		{ 0.03945891982099777, 0.9605410801816564, -1.95418942245008 },
+		{ 0.05609434140007876, 0.9439056586001288, -1.930963354965057 },
+		{ 0.06679411943205316, 0.9332058805685834, -1.914758180731801 },
+		{ 0.09437355895718097, 0.9056264410429222, -1.868297923005763 },
+		{ 0.111929455080544, 0.8880705449197244, -1.83511165951098 },
+		{ 0.1565177316294414, 0.8434822683706987, -1.737685272427497 },
+		{ 0.184399362261346, 0.8156006377391881, -1.666813424517732 },
+		{ 0.2534434885651326, 0.7465565114348927, -1.456541848955825 },
+		{ 0.2953139355971123, 0.7046860644191402, -1.303809505642585 },
+		{ 0.3946140323925304, 0.6053859676138664, -0.8622837495970445 },
+		{ 0.4517385663571905, 0.5482614336485589, -0.5581285639001926 },
+		{ 0.002693126506912854, 0.9973068734930874, -1.997277822687978 },
+		{ 0.004037087653618207, 0.9959629123468108, -1.995897588358402 },
+		{ 0.004619969802255383, 0.9953800301980645, -1.995294456344996 },
+		{ 0.006922155723519769, 0.993077844276638, -1.99288551519257 },
+		{ 0.007919972339146283, 0.9920800276608678, -1.991828128941975 },
+		{ 0.01185669616351126, 0.9881433038365532, -1.987577638734679 },
+		{ 0.01356096465680171, 0.986439035343241, -1.98569843753907 },
+		{ 0.02027287295565974, 0.9797271270443879, -1.978066451133386 },
+		{ 0.02317260730054817, 0.976827392699532, -1.974654535175824 },
+		{ 0.0345575842237063, 0.9654424157766547, -1.960582520921263 },
+		{ 0.03945891982099776, 0.9605410801816564, -1.95418942245008 },
+		{ 0.05860229891311221, 0.9413977010872788, -1.927254728791726 },
+		{ 0.06679411943205311, 0.9332058805685834, -1.914758180731801 },
+		{ 0.09850138621130056, 0.9014986137887937, -1.860751271941929 },
+		{ 0.1119294550805442, 0.8880705449197244, -1.83511165951098 },
+		{ 0.1631085364811571, 0.8368914635188585, -1.721637506846299 },
+		{ 0.1843993622613463, 0.8156006377391881, -1.666813424517732 },
+		{ 0.2634321104882753, 0.7365678895117834, -1.421872878873177 },
+		{ 0.2953139355971122, 0.7046860644191402, -1.303809505642585 },
+		{ 0.408455897130383, 0.5915441028706125, -0.791853702957464 },
+		{ 0.4517385663571904, 0.5482614336485589, -0.5581285639001926 },
+		{ 0.002693126506912854, 0.9973068734930874, -1.997277822687978 },
+		{ 0.004222718998126996, 0.995777281002023, -1.995705804880159 },
+		{ 0.004619969802255383, 0.9953800301980645, -1.995294456344996 },
+		{ 0.007240004160882, 0.9927599958392531, -1.992549565284307 },
+		{ 0.007919972339146283, 0.9920800276608678, -1.991828128941975 },
+		{ 0.01239971005221802, 0.9876002899478467, -1.986981457999684 },
+		{ 0.01356096465680171, 0.986439035343241, -1.98569843753907 },
+		{ 0.02119715434076066, 0.9788028456592794, -1.976986454593934 },
+		{ 0.02317260730054818, 0.976827392699532, -1.974654535175824 },
+		{ 0.03612116896690517, 0.9638788310341545, -1.9585650836193 },
+		{ 0.03945891982099777, 0.9605410801816564, -1.95418942245008 },
+		{ 0.06121849842155858, 0.938781501578969, -1.923327624268269 },
+		{ 0.06679411943205316, 0.9332058805685834, -1.914758180731801 },
+		{ 0.1027992088942599, 0.8972007911057404, -1.852727091170046 },
+		{ 0.111929455080544, 0.8880705449197244, -1.83511165951098 },
+		{ 0.169947780141416, 0.8300522198592543, -1.704525760898405 },
+		{ 0.1843993622613463, 0.8156006377391881, -1.666813424517732 },
+		{ 0.2737380861331145, 0.7262619138671116, -1.384947769262632 },
+		{ 0.2953139355971124, 0.7046860644191402, -1.303809505642585 },
+		{ 0.4225975945253747, 0.5774024054873946, -0.7177074489464962 },
+		{ 0.4517385663571904, 0.5482614336485589, -0.5581285639001926 },
+		{ 0.002693126506912854, 0.9973068734930874, -1.997277822687978 },
+		{ 0.004416917002048913, 0.9955830829983806, -1.995504873908516 },
+		{ 0.004619969802255383, 0.9953800301980645, -1.995294456344996 },
+		{ 0.007572365677446375, 0.9924276343228159, -1.992197401941817 },
+		{ 0.007919972339146285, 0.9920800276608678, -1.991828128941975 },
+		{ 0.0129674264930904, 0.9870325735070158, -1.986355586616831 },
+		{ 0.01356096465680172, 0.986439035343241, -1.98569843753907 },
+		{ 0.02216312419567194, 0.9778368758043418, -1.975850208628947 },
+		{ 0.02317260730054819, 0.976827392699532, -1.974654535175824 },
+		{ 0.03775401997269523, 0.9622459800294056, -1.956436253162065 },
+		{ 0.0394589198209979, 0.9605410801816564, -1.95418942245008 },
+		{ 0.06394751346681948, 0.9360524865362236, -1.919167375794206 },
+		{ 0.06679411943205317, 0.9332058805685834, -1.914758180731801 },
+		{ 0.1072731767295384, 0.8927268232705369, -1.844192296268932 },
+		{ 0.1119294550805438, 0.8880705449197244, -1.83511165951098 },
+		{ 0.1770425159460696, 0.8229574840547725, -1.686276712958143 },
+		{ 0.1843993622613462, 0.8156006377391881, -1.666813424517732 },
+		{ 0.2843634768655318, 0.7156365231866197, -1.345641375932664 },
+		{ 0.2953139355971122, 0.7046860644191402, -1.303809505642585 },
+		{ 0.4370279526318659, 0.562972047368147, -0.6398085968848092 },
+		{ 0.4517385663571905, 0.5482614336485589, -0.5581285639001926 }
+	},
+	.c_bpre4800080040 = {
+		{ 0.0002696741357496785, 0.9999865162934245, -1.999870158017709 },
+		{ 0.0002821019069755066, 0.9999858949047868, -1.999858564982859 },
+		{ 0.0004630672576827666, 0.9999768468938052, -1.999633770282096 },
+		{ 0.0004844095037292055, 0.9999757797593279, -1.999600350121742 },
+		{ 0.0007951346121869933, 0.9999602432807896, -1.998948726546257 },
+		{ 0.0008317809212369303, 0.9999584110868478, -1.998851522058526 },
+		{ 0.001365329521230285, 0.9999317335584016, -1.996949776561647 },
+		{ 0.001428248309400118, 0.9999285876039858, -1.996665531375921 },
+		{ 0.002344395204945641, 0.999882780304392, -1.991094815963527 },
+		{ 0.002452426539302698, 0.9998773787218631, -1.990261478671898 },
+		{ 0.00402549095836483, 0.999798727617464, -1.973925336883307 },
+		{ 0.00421097432241566, 0.999789452011994, -1.971482009557496 },
+		{ 0.006911759682250128, 0.9996544125423804, -1.923691438911356 },
+		{ 0.007230214689263746, 0.9996384893175116, -1.91656346771346 },
+		{ 0.01186689224121636, 0.9994066556150999, -1.778225653472667 },
+		{ 0.01241362586201692, 0.9993793190915093, -1.757775150958645 },
+		{ 0.02037267202881892, 0.9989813668675358, -1.370569893377347 },
+		{ 0.02131105399335591, 0.9989344473666109, -1.314907531963037 },
+		{ 0.03496998150339906, 0.9982515160120824, -0.33961446297498 },
+		{ 0.0365799757724521, 0.9981710097008993, -0.2119349946328825 },
+		{ 0.0600102081417342, 0.9969994953534547, 1.477974996503273 },
+		{ 0.0002696741357496785, 0.9999865162934245, -1.999870158017709 },
+		{ 0.0002951024274681398, 0.9999852448826495, -1.999845908840254 },
+		{ 0.0004630672576827666, 0.9999768468938052, -1.999633770282096 },
+		{ 0.0005067283220392329, 0.9999746637034675, -1.999563838694496 },
+		{ 0.0007951346121869932, 0.9999602432807896, -1.998948726546257 },
+		{ 0.000870109350579578, 0.9999564946332477, -1.998745251724739 },
+		{ 0.001365329521230285, 0.9999317335584016, -1.996949776561647 },
+		{ 0.001494066638469205, 0.9999252966988759, -1.996354653043005 },
+		{ 0.00234439520494564, 0.999882780304392, -1.991094815963527 },
+		{ 0.002565440064394175, 0.9998717280001567, -1.989349920009726 },
+		{ 0.004025490958364826, 0.999798727617464, -1.973925336883307 },
+		{ 0.004405053206686423, 0.9997797511621814, -1.968810484419555 },
+		{ 0.006911759682247888, 0.9996544125423804, -1.923691438911356 },
+		{ 0.007563374571996866, 0.9996218319493085, -1.908773800923458 },
+		{ 0.0118668922412097, 0.9994066556150999, -1.778225653472667 },
+		{ 0.01298552814632224, 0.9993507242233299, -1.735482746045464 },
+		{ 0.02037267202882111, 0.9989813668675358, -1.370569893377347 },
+		{ 0.0222926148558264, 0.9988853693606687, -1.254699373479123 },
+		{ 0.03496998150339854, 0.9982515160120824, -0.33961446297498 },
+		{ 0.03826426369751224, 0.9980868027027836, -0.07745139031785429 },
+		{ 0.0600102081417346, 0.9969994953534547, 1.477974996503273 },
+		{ 0.0002696741357496785, 0.9999865162934245, -1.999870158017709 },
+		{ 0.0003087023673929083, 0.9999845648853667, -1.999832090277252 },
+		{ 0.0004630672576827666, 0.9999768468938052, -1.999633770282096 },
+		{ 0.000530081557272285, 0.9999734961084626, -1.999523934983326 },
+		{ 0.0007951346121869932, 0.9999602432807896, -1.998948726546257 },
+		{ 0.0009102067171700825, 0.9999544896664272, -1.998629044035991 },
+		{ 0.001365329521230285, 0.9999317335584016, -1.996949776561647 },
+		{ 0.001562917920593603, 0.9999218541364181, -1.996014637687517 },
+		{ 0.00234439520494564, 0.999882780304392, -1.991094815963527 },
+		{ 0.002683659648333954, 0.999865817018516, -1.988352860818171 },
+		{ 0.004025490958364826, 0.999798727617464, -1.973925336883307 },
+		{ 0.00460805789412318, 0.9997696005423689, -1.965888092281163 },
+		{ 0.006911759682247888, 0.9996544125423804, -1.923691438911356 },
+		{ 0.007911848816457706, 0.9996044077625009, -1.900262568485986 },
+		{ 0.01186689224121192, 0.9994066556150999, -1.778225653472667 },
+		{ 0.01358374319455006, 0.9993208138888969, -1.711191966265624 },
+		{ 0.02037267202882247, 0.9989813668675358, -1.370569893377347 },
+		{ 0.02331936916627891, 0.9988340318390909, -1.189646696586934 },
+		{ 0.03496998150340024, 0.9982515160120824, -0.33961446297498 },
+		{ 0.04002567343263796, 0.9979987163285491, 0.06359515756277426 },
+		{ 0.06001020814173395, 0.9969994953534547, 1.477974996503273 },
+		{ 0.0002696741357496785, 0.9999865162934245, -1.999870158017709 },
+		{ 0.0003229285743921283, 0.9999838535713004, -1.999817001962025 },
+		{ 0.0004630672576827666, 0.9999768468938052, -1.999633770282096 },
+		{ 0.0005545089804176666, 0.9999722746838133, -1.999480324412364 },
+		{ 0.0007951346121869933, 0.9999602432807896, -1.998948726546257 },
+		{ 0.0009521523404084399, 0.9999523924237316, -1.998501985195046 },
+		{ 0.001365329521230285, 0.9999317335584016, -1.996949776561647 },
+		{ 0.001634942356356507, 0.9999182528828959, -1.995642743984165 },
+		{ 0.002344395204945641, 0.999882780304392, -1.991094815963527 },
+		{ 0.002807326910221287, 0.9998596336750352, -1.987262264926654 },
+		{ 0.004025490958364829, 0.999798727617464, -1.973925336883307 },
+		{ 0.004820349937549955, 0.9997589854435904, -1.962693246258838 },
+		{ 0.006911759682250127, 0.9996544125423804, -1.923691438911356 },
+		{ 0.008276384888375898, 0.9995861808146778, -1.890963791086687 },
+		{ 0.01186689224121414, 0.9994066556150999, -1.778225653472667 },
+		{ 0.01420951882351549, 0.9992895244381107, -1.68473147010778 },
+		{ 0.0203726720288199, 0.9989813668675358, -1.370569893377347 },
+		{ 0.02439338889264468, 0.9987803305584761, -1.119448551885984 },
+		{ 0.03496998150339997, 0.9982515160120824, -0.33961446297498 },
+		{ 0.04186847598464146, 0.997906588324506, 0.2107626931146759 },
+		{ 0.0600102081417342, 0.9969994953534547, 1.477974996503273 },
+		{ 0.0002696741357496785, 0.9999865162934245, -1.999870158017709 },
+		{ 0.0003378113266284563, 0.9999831095006437, -1.999800525796963 },
+		{ 0.0004630672576827665, 0.9999768468938052, -1.999633770282096 },
+		{ 0.000580062586338595, 0.9999709969754184, -1.999432661042537 },
+		{ 0.0007951346121869932, 0.9999602432807896, -1.998948726546257 },
+		{ 0.0009960311772703673, 0.9999501984880971, -1.998363046955226 },
+		{ 0.001365329521230285, 0.9999317335584016, -1.996949776561647 },
+		{ 0.001710285177243923, 0.9999144857411557, -1.99523599024379 },
+		{ 0.002344395204945639, 0.999882780304392, -1.991094815963527 },
+		{ 0.002936692900079218, 0.9998531653775221, -1.98606935523844 },
+		{ 0.004025490958364825, 0.999798727617464, -1.973925336883307 },
+		{ 0.005042468126824931, 0.9997478797073054, -1.959199159124346 },
+		{ 0.006911759682247883, 0.9996544125423804, -1.923691438911356 },
+		{ 0.008657760273137629, 0.9995671135323915, -1.88080569551377 },
+		{ 0.01186689224121823, 0.9994066556150999, -1.778225653472667 },
+		{ 0.01486412265480575, 0.9992567938694259, -1.655921332467685 },
+		{ 0.02037267202882281, 0.9989813668675358, -1.370569893377347 },
+		{ 0.02551683916865451, 0.9987241580458976, -1.043806220491331 },
+		{ 0.03496998150340037, 0.9982515160120824, -0.33961446297498 },
+		{ 0.04379643272403867, 0.9978102075651724, 0.3634805690317176 },
+		{ 0.06001020814173118, 0.9969994953534547, 1.477974996503273 },
+		{ 0.0002696741357496785, 0.9999865162934245, -1.999870158017709 },
+		{ 0.0003533846879623858, 0.9999823311517887, -1.99978253226724 },
+		{ 0.0004630672576827665, 0.9999768468938052, -1.999633770282096 },
+		{ 0.000606793153842588, 0.9999696603655791, -1.999380564564035 },
+		{ 0.0007951346121869932, 0.9999602432807896, -1.998948726546257 },
+		{ 0.001041931898286701, 0.9999479034425253, -1.9982111167962 },
+		{ 0.001365329521230284, 0.9999317335584016, -1.996949776561647 },
+		{ 0.001789099734129143, 0.9999105450234039, -1.994791098173851 },
+		{ 0.002344395204945639, 0.999882780304392, -1.991094815963527 },
+		{ 0.003072019816297798, 0.9998463990435487, -1.98476455163403 },
+		{ 0.004025490958364824, 0.999798727617464, -1.973925336883307 },
+		{ 0.005274794712838732, 0.9997362620842756, -1.95537843662942 },
+		{ 0.006911759682247883, 0.9996544125423804, -1.923691438911356 },
+		{ 0.009056629931824652, 0.9995471699826279, -1.86971215748057 },
+		{ 0.01186689224121823, 0.9994066556150999, -1.778225653472667 },
+		{ 0.01554886468639852, 0.999222556925549, -1.624568923241852 },
+		{ 0.02037267202882145, 0.9989813668675358, -1.370569893377347 },
+		{ 0.02669199411645435, 0.9986654003342637, -0.9624241836572732 },
+		{ 0.0349699815033998, 0.9982515160120824, -0.33961446297498 },
+		{ 0.04581181006418859, 0.997709412034624, 0.5208583263706871 },
+		{ 0.06001020814173508, 0.9969994953534547, 1.477974996503273 },
+		{ 0.0002696741357496785, 0.9999865162934245, -1.999870158017709 },
+		{ 0.0003696639606199351, 0.9999815168067885, -1.999762876573908 },
+		{ 0.0004630672576827665, 0.9999768468938052, -1.999633770282096 },
+		{ 0.0006347596426948237, 0.9999682622366215, -1.999323623840149 },
+		{ 0.0007951346121869931, 0.9999602432807896, -1.998948726546257 },
+		{ 0.001089950698239068, 0.9999455025428576, -1.998044969218952 },
+		{ 0.001365329521230284, 0.9999317335584016, -1.996949776561647 },
+		{ 0.001871546487975035, 0.9999064227148371, -1.994304484386456 },
+		{ 0.002344395204945639, 0.999882780304392, -1.991094815963527 },
+		{ 0.003213585578549901, 0.9998393207733081, -1.983337337072247 },
+		{ 0.004025490958364825, 0.999798727617464, -1.973925336883307 },
+		{ 0.005517886896753511, 0.9997241080554281, -1.951200432024594 },
+		{ 0.006911759682247883, 0.9996544125423804, -1.923691438911356 },
+		{ 0.00947389425627672, 0.999526306060132, -1.857596860139183 },
+		{ 0.01186689224121823, 0.9994066556150999, -1.778225653472667 },
+		{ 0.01626514645184525, 0.999186743460023, -1.590467063217226 },
+		{ 0.02037267202881714, 0.9989813668675358, -1.370569893377347 },
+		{ 0.0279212321019455, 0.9986039386010139, -0.8750187069644575 },
+		{ 0.03496998150339973, 0.9982515160120824, -0.33961446297498 },
+		{ 0.04792074248329704, 0.9976039745470584, 0.6818282178887479 },
+		{ 0.06001020814173599, 0.9969994953534547, 1.477974996503273 },
+		{ 0.0002696741357496785, 0.9999865162934245, -1.999870158017709 },
+		{ 0.0003867016468183099, 0.999980664993138, -1.999741408256743 },
+		{ 0.0004630672576827666, 0.9999768468938052, -1.999633770282096 },
+		{ 0.0006640142762388531, 0.9999667994800381, -1.99926137354589 },
+		{ 0.0007951346121869933, 0.9999602432807896, -1.998948726546257 },
+		{ 0.001140176778454745, 0.9999429912086281, -1.99786329098834 },
+		{ 0.001365329521230285, 0.9999317335584016, -1.996949776561647 },
+		{ 0.001957794627641285, 0.9999021103100532, -1.993772213643468 },
+		{ 0.002344395204945641, 0.999882780304392, -1.991094815963527 },
+		{ 0.003361730026904107, 0.9998319160132829, -1.981776206459001 },
+		{ 0.004025490958364829, 0.999798727617464, -1.973925336883307 },
+		{ 0.005772075913237283, 0.9997113963752687, -1.946633272951817 },
+		{ 0.006911759682250127, 0.9996544125423804, -1.923691438911356 },
+		{ 0.009910382999014205, 0.9995044809366689, -1.844369128159439 },
+		{ 0.01186689224121414, 0.9994066556150999, -1.778225653472667 },
+		{ 0.01701440094148948, 0.9991492800740061, -1.553395261715742 },
+		{ 0.02037267202881644, 0.9989813668675358, -1.370569893377347 },
+		{ 0.02920704967808585, 0.998539647538859, -0.7813234858410665 },
+		{ 0.03496998150339997, 0.9982515160120824, -0.33961446297498 },
+		{ 0.05012611035681942, 0.9974937007189055, 0.8449513518289002 },
+		{ 0.0600102081417342, 0.9969994953534547, 1.477974996503273 },
+		{ 0.0002696741357496785, 0.9999865162934245, -1.999870158017709 },
+		{ 0.0004045286615559941, 0.9999797739110978, -1.99971795638562 },
+		{ 0.0004630672576827666, 0.9999768468938052, -1.999633770282096 },
+		{ 0.0006946129679153212, 0.9999652694782101, -1.999193331883538 },
+		{ 0.0007951346121869932, 0.9999602432807896, -1.998948726546257 },
+		{ 0.001192720214436242, 0.9999403640413784, -1.99766460146482 },
+		{ 0.001365329521230285, 0.9999317335584016, -1.996949776561647 },
+		{ 0.002048014693438945, 0.999897599303904, -1.993190030869778 },
+		{ 0.00234439520494564, 0.999882780304392, -1.991094815963527 },
+		{ 0.003516578759297068, 0.9998241713558683, -1.980068986968883 },
+		{ 0.004025490958364826, 0.999798727617464, -1.973925336883307 },
+		{ 0.006038054013028218, 0.9996980976215331, -1.941639597647926 },
+		{ 0.006911759682247888, 0.9996544125423804, -1.923691438911356 },
+		{ 0.01036699119355248, 0.9994816505194751, -1.829929886413095 },
+		{ 0.0118668922412097, 0.9994066556150999, -1.778225653472667 },
+		{ 0.0177981652177278, 0.9991100917528373, -1.513121510854 },
+		{ 0.02037267202882111, 0.9989813668675358, -1.370569893377347 },
+		{ 0.03055202849798526, 0.9984723986287686, -0.6811040896200495 },
+		{ 0.03496998150339854, 0.9982515160120824, -0.33961446297498 },
+		{ 0.05243307228169742, 0.9973783473629845, 1.008499968073577 },
+		{ 0.0600102081417346, 0.9969994953534547, 1.477974996503273 },
+		{ 0.0002696741357496785, 0.9999865162934245, -1.999870158017709 },
+		{ 0.0004231639099936309, 0.9999788419245625, -1.999692340674163 },
+		{ 0.0004630672576827666, 0.9999768468938052, -1.999633770282096 },
+		{ 0.0007266229904576341, 0.9999636689590726, -1.999118948581192 },
+		{ 0.0007951346121869932, 0.9999602432807896, -1.998948726546257 },
+		{ 0.001247684913345847, 0.9999376158063609, -1.997447311025824 },
+		{ 0.001365329521230285, 0.9999317335584016, -1.996949776561647 },
+		{ 0.002142389910067666, 0.9998928805370797, -1.992553250218873 },
+		{ 0.00234439520494564, 0.999882780304392, -1.991094815963527 },
+		{ 0.003678647532158048, 0.9998160684863768, -1.978201412848057 },
+		{ 0.004025490958364829, 0.999798727617464, -1.973925336883307 },
+		{ 0.006316263067410321, 0.9996841872817128, -1.936180977956935 },
+		{ 0.006911759682247891, 0.9996544125423804, -1.923691438911356 },
+		{ 0.01084461825461851, 0.9994577690874097, -1.814172106719645 },
+		{ 0.01186689224121625, 0.9994066556150999, -1.778225653472667 },
+		{ 0.01861800702076587, 0.9990691002328864, -1.469401164958048 },
+		{ 0.02037267202881951, 0.9989813668675358, -1.370569893377347 },
+		{ 0.03195889927536982, 0.9984020552438613, -0.5741624650816696 },
+		{ 0.03496998150340024, 0.9982515160120824, -0.33961446297498 },
+		{ 0.0548464964170462, 0.9972576877981187, 1.170317673935105 },
+		{ 0.06001020814173395, 0.9969994953534547, 1.477974996503273 },
+		{ 0.0002696741357496785, 0.9999865162934245, -1.999870158017709 },
+		{ 0.0004426720285696003, 0.9999778667429521, -1.999664347581621 },
+		{ 0.0004630672576827666, 0.9999768468938052, -1.999633770282096 },
+		{ 0.0007601079285571203, 0.9999619948142147, -1.999037636206988 },
+		{ 0.0007951346121869933, 0.9999602432807896, -1.998948726546257 },
+		{ 0.001305182875432087, 0.9999347409416992, -1.997209674477541 },
+		{ 0.001365329521230285, 0.9999317335584016, -1.996949776561647 },
+		{ 0.002241116297939427, 0.9998879441961457, -1.99185671299247 },
+		{ 0.002344395204945641, 0.999882780304392, -1.991094815963527 },
+		{ 0.003848180453929394, 0.9998075926901364, -1.976158903375059 },
+		{ 0.00402549095836483, 0.999798727617464, -1.973925336883307 },
+		{ 0.00660733150398053, 0.9996696359386407, -1.930214069404579 },
+		{ 0.006911759682250128, 0.9996544125423804, -1.923691438911356 },
+		{ 0.0113442481435952, 0.9994327876562925, -1.796979221438311 },
+		{ 0.01186689224121426, 0.9994066556150999, -1.778225653472667 },
+		{ 0.01947560003926662, 0.9990262207342773, -1.4219739164672 },
+		{ 0.02037267202881892, 0.9989813668675358, -1.370569893377347 },
+		{ 0.03343128111616042, 0.9983284840908925, -0.4603682993537568 },
+		{ 0.03496998150339971, 0.9982515160120824, -0.33961446297498 },
+		{ 0.05737008953771398, 0.997131495536001, 1.327810610285592 },
+		{ 0.06001020814173717, 0.9969994953534547, 1.477974996503273 }
+	},
+	.c_bpre9600080040 = {
+		{ 0.0001348375224075977, 0.9999932581239859, -1.999964168245442 },
+		{ 0.0001410514508751875, 0.999992947427524, -1.999961114581458 },
+		{ 0.0002315349690366185, 0.9999884233798936, -1.99990265189131 },
+		{ 0.0002422062184523509, 0.9999878898063356, -1.999894029626177 },
+		{ 0.0003975712576726449, 0.9999801214428163, -1.999727223756278 },
+		{ 0.0004158947848114358, 0.9999792053272147, -1.999702461045912 },
+		{ 0.0006826764117831854, 0.9999658661966427, -1.999220225226776 },
+		{ 0.0007141369044829928, 0.9999642931645039, -1.999148348098752 },
+		{ 0.001172231955649061, 0.9999413884345383, -1.997743124838664 },
+		{ 0.001226250861902876, 0.9999386874813193, -1.997533192125621 },
+		{ 0.00201284676690448, 0.9998993587444008, -1.993420190134942 },
+		{ 0.002105597999393295, 0.9998947204641065, -1.99280492034824 },
+		{ 0.003456178469917976, 0.9998271913397736, -1.980743754794676 },
+		{ 0.003615434128690229, 0.9998192283195556, -1.978939596104788 },
+		{ 0.005934326526048856, 0.9997032837872946, -1.943613188347138 },
+		{ 0.006207776342580132, 0.9996896113752057, -1.938338045731446 },
+		{ 0.01018893137127962, 0.9994905536659843, -1.835633689357426 },
+		{ 0.0106583670161837, 0.999467081682339, -1.820396040404364 },
+		{ 0.01749264049720334, 0.9991253755220524, -1.529008022051489 },
+		{ 0.01829835859541148, 0.9990850863169258, -1.486642371725175 },
+		{ 0.03002764551512668, 0.9984986206066859, -0.7204333459260333 },
+		{ 0.0001348375224075977, 0.9999932581239859, -1.999964168245442 },
+		{ 0.0001475517580190969, 0.9999926224141102, -1.999957787971655 },
+		{ 0.0002315349690366185, 0.9999884233798936, -1.99990265189131 },
+		{ 0.00025336576586526, 0.9999873317714917, -1.999884622231366 },
+		{ 0.0003975712576726447, 0.9999801214428163, -1.999727223756278 },
+		{ 0.0004350594072029862, 0.9999782470800289, -1.999675410131589 },
+		{ 0.0006826764117831852, 0.9999658661966427, -1.999220225226776 },
+		{ 0.0007470472712294406, 0.9999626476518388, -1.99906977075537 },
+		{ 0.001172231955649061, 0.9999413884345383, -1.997743124838664 },
+		{ 0.001282761169102133, 0.9999358619432331, -1.997303593324514 },
+		{ 0.002012846766902385, 0.9998993587444008, -1.993420190134942 },
+		{ 0.002202647892685786, 0.9998898695167293, -1.992132079844841 },
+		{ 0.003456178469909996, 0.9998271913397736, -1.980743754794676 },
+		{ 0.003782044881950727, 0.999810898094889, -1.976966261200618 },
+		{ 0.005934326526051227, 0.9997032837872946, -1.943613188347138 },
+		{ 0.006493818314044586, 0.999675309399672, -1.932571699006693 },
+		{ 0.01018893137127296, 0.9994905536659843, -1.835633689357426 },
+		{ 0.01114941516408681, 0.99944252929354, -1.803769522393797 },
+		{ 0.01749264049720152, 0.9991253755220524, -1.529008022051489 },
+		{ 0.01914129149832807, 0.9990429433726981, -1.44067266139451 },
+		{ 0.03002764551512425, 0.9984986206066859, -0.7204333459260333 },
+		{ 0.0001348375224075977, 0.9999932581239859, -1.999964168245442 },
+		{ 0.0001543517793037688, 0.9999922824129031, -1.999954163250513 },
+		{ 0.0002315349690366185, 0.9999884233798936, -1.99990265189131 },
+		{ 0.0002650425348094359, 0.9999867479664233, -1.999874353782305 },
+		{ 0.0003975712576726447, 0.9999801214428163, -1.999727223756278 },
+		{ 0.0004551085366797794, 0.9999772445743088, -1.999645851940983 },
+		{ 0.0006826764117831852, 0.9999658661966427, -1.999220225226776 },
+		{ 0.0007814742278383628, 0.9999609263048321, -1.9989838644418 },
+		{ 0.001172231955649061, 0.9999413884345383, -1.997743124838664 },
+		{ 0.001341874839863153, 0.9999329062584731, -1.99705249639264 },
+		{ 0.002012846766902385, 0.9998993587444008, -1.993420190134942 },
+		{ 0.002304161674105364, 0.9998847936349311, -1.991395912334727 },
+		{ 0.003456178469917974, 0.9998271913397736, -1.980743754794676 },
+		{ 0.00395631571888044, 0.9998021843157279, -1.974808076267026 },
+		{ 0.005934326526053441, 0.9997032837872946, -1.943613188347138 },
+		{ 0.006793025225274854, 0.999660349263137, -1.926269107135483 },
+		{ 0.01018893137128032, 0.9994905536659843, -1.835633689357426 },
+		{ 0.01166308527122347, 0.9994168458851844, -1.785631668959815 },
+		{ 0.01749264049720441, 0.9991253755220524, -1.529008022051489 },
+		{ 0.02002285958896852, 0.9989988570206421, -1.390828197001127 },
+		{ 0.03002764551512632, 0.9984986206066859, -0.7204333459260333 },
+		{ 0.0001348375224075977, 0.9999932581239859, -1.999964168245442 },
+		{ 0.0001614649389754468, 0.9999919267530615, -1.999950213247357 },
+		{ 0.0002315349690366185, 0.9999884233798936, -1.99990265189131 },
+		{ 0.0002772564119762887, 0.9999861372458189, -1.999863145043687 },
+		{ 0.0003975712576726449, 0.9999801214428163, -1.999727223756278 },
+		{ 0.0004760818365426959, 0.9999761959285487, -1.999613556928525 },
+		{ 0.0006826764117831854, 0.9999658661966427, -1.999220225226776 },
+		{ 0.0008174878853325223, 0.9999591256060899, -1.998889940741643 },
+		{ 0.001172231955649061, 0.9999413884345383, -1.997743124838664 },
+		{ 0.0014037127153377, 0.9999298143745067, -1.996777877905097 },
+		{ 0.002012846766902387, 0.9998993587444008, -1.993420190134942 },
+		{ 0.002410320208090808, 0.9998794854599178, -1.99059092163942 },
+		{ 0.003456178469917975, 0.9998271913397736, -1.980743754794676 },
+		{ 0.004138620648644962, 0.9997930689971188, -1.972447700255693 },
+		{ 0.005934326526048856, 0.9997032837872946, -1.943613188347138 },
+		{ 0.007106021799725347, 0.9996446990996906, -1.919380337045796 },
+		{ 0.01018893137127961, 0.9994905536659843, -1.835633689357426 },
+		{ 0.01220041569989561, 0.9993899792165599, -1.765850670972606 },
+		{ 0.01749264049719825, 0.9991253755220524, -1.529008022051489 },
+		{ 0.02094520546931004, 0.9989527457915643, -1.33684082997485 },
+		{ 0.03002764551512668, 0.9984986206066859, -0.7204333459260333 },
+		{ 0.0001348375224075977, 0.9999932581239859, -1.999964168245442 },
+		{ 0.0001689063765425863, 0.9999915547146606, -1.999945908075088 },
+		{ 0.0002315349690366183, 0.9999884233798936, -1.99990265189131 },
+		{ 0.0002900333961461996, 0.9999854983825608, -1.999850908894882 },
+		{ 0.0003975712576726447, 0.9999801214428163, -1.999727223756278 },
+		{ 0.0004980217892739889, 0.9999750989340169, -1.999578266741141 },
+		{ 0.0006826764117831851, 0.9999658661966427, -1.999220225226776 },
+		{ 0.0008551608711299789, 0.9999572419564527, -1.998787250849583 },
+		{ 0.00117223195564906, 0.9999413884345383, -1.997743124838664 },
+		{ 0.001468400355027583, 0.9999265799935123, -1.996477526856749 },
+		{ 0.002012846766902384, 0.9998993587444008, -1.993420190134942 },
+		{ 0.00252139299701723, 0.9998739319070705, -1.989710286222498 },
+		{ 0.003456178469909994, 0.9998271913397736, -1.980743754794676 },
+		{ 0.004329348716400112, 0.9997835333372878, -1.969866179104526 },
+		{ 0.005934326526051224, 0.9997032837872946, -1.943613188347138 },
+		{ 0.007433442729162303, 0.999628327864625, -1.911851981733533 },
+		{ 0.01018893137127588, 0.9994905536659843, -1.835633689357426 },
+		{ 0.01276249161412214, 0.9993618754214599, -1.744284973451218 },
+		{ 0.0174926404971995, 0.9991253755220524, -1.529008022051489 },
+		{ 0.02191021764373728, 0.9989045037265434, -1.278408834313661 },
+		{ 0.03002764551512954, 0.9984986206066859, -0.7204333459260333 },
+		{ 0.0001348375224075977, 0.9999932581239859, -1.999964168245442 },
+		{ 0.0001766931244715037, 0.9999911655368707, -1.999941214971326 },
+		{ 0.0002315349690366183, 0.9999884233798936, -1.99990265189131 },
+		{ 0.0003033988781842875, 0.9999848300677262, -1.999837549577345 },
+		{ 0.0003975712576726447, 0.9999801214428163, -1.999727223756278 },
+		{ 0.0005209727344488205, 0.9999739513819976, -1.999539701921542 },
+		{ 0.000682676411783185, 0.9999658661966427, -1.999220225226776 },
+		{ 0.0008945698734470427, 0.9999552715113831, -1.99867497137458 },
+		{ 0.00117223195564906, 0.9999413884345383, -1.997743124838664 },
+		{ 0.001536068895820739, 0.9999231965723911, -1.996149028705285 },
+		{ 0.002012846766902384, 0.9998993587444008, -1.993420190134942 },
+		{ 0.002637571274773765, 0.9998681223462799, -1.988747012949329 },
+		{ 0.003456178469909994, 0.9998271913397736, -1.980743754794676 },
+		{ 0.00452882772124203, 0.999773559353631, -1.967043283167035 },
+		{ 0.005934326526051224, 0.9997032837872946, -1.943613188347138 },
+		{ 0.007775943975510543, 0.9996112028811749, -1.903625841169474 },
+		{ 0.01018893137127659, 0.9994905536659843, -1.835633689357426 },
+		{ 0.01335045292292835, 0.9993324773739035, -1.720781582280568 },
+		{ 0.01749264049719639, 0.9991253755220524, -1.529008022051489 },
+		{ 0.0229190370740677, 0.9988540494159415, -1.215257421395436 },
+		{ 0.03002764551512474, 0.9984986206066859, -0.7204333459260333 },
+		{ 0.0001348375224075977, 0.9999932581239859, -1.999964168245442 },
+		{ 0.000184832834388174, 0.9999907583606903, -1.999936097302935 },
+		{ 0.0002315349690366183, 0.9999884233798936, -1.99990265189131 },
+		{ 0.000317382339623434, 0.9999841309923978, -1.999822963620776 },
+		{ 0.0003975712576726446, 0.9999801214428163, -1.999727223756278 },
+		{ 0.0005449827742602369, 0.9999727509001722, -1.999497554642078 },
+		{ 0.000682676411783185, 0.9999658661966427, -1.999220225226776 },
+		{ 0.0009357951367895657, 0.9999532102627785, -1.998552202199152 },
+		{ 0.00117223195564906, 0.9999413884345383, -1.997743124838664 },
+		{ 0.001606857339006709, 0.999919657159168, -1.995789731263596 },
+		{ 0.002012846766902384, 0.9998993587444008, -1.993420190134942 },
+		{ 0.002759133767194535, 0.9998620445118559, -1.987693266396809 },
+		{ 0.003456178469909994, 0.9998271913397736, -1.980743754794676 },
+		{ 0.004737508226828167, 0.9997631249751773, -1.96395598527078 },
+		{ 0.005934326526051224, 0.9997032837872946, -1.943613188347138 },
+		{ 0.008134227365705401, 0.999593289023102, -1.894638133832487 },
+		{ 0.01018893137127881, 0.9994905536659843, -1.835633689357426 },
+		{ 0.01396549192437089, 0.999301725506873, -1.69517618406919 },
+		{ 0.01749264049719884, 0.9991253755220524, -1.529008022051489 },
+		{ 0.02397474087688482, 0.9988012687952788, -1.147072483940381 },
+		{ 0.03002764551512439, 0.9984986206066859, -0.7204333459260333 },
+		{ 0.0001348375224075977, 0.9999932581239859, -1.999964168245442 },
+		{ 0.0001933517580361104, 0.999990332449838, -1.999930517082137 },
+		{ 0.0002315349690366185, 0.9999884233798936, -1.99990265189131 },
+		{ 0.0003320098938671487, 0.9999833996022324, -1.99980703387862 },
+		{ 0.0003975712576726449, 0.9999801214428163, -1.999727223756278 },
+		{ 0.000570096514467191, 0.9999714951980521, -1.999451495131819 },
+		{ 0.0006826764117831854, 0.9999658661966427, -1.999220225226776 },
+		{ 0.0009789212709837016, 0.9999510539571691, -1.998417954673516 },
+		{ 0.001172231955649061, 0.9999413884345383, -1.997743124838664 },
+		{ 0.001680935651019869, 0.9999159544748163, -1.995396731339541 },
+		{ 0.002012846766902387, 0.9998993587444008, -1.993420190134942 },
+		{ 0.002886246216927892, 0.9998556877746252, -1.986540875184163 },
+		{ 0.003456178469917975, 0.9998271913397736, -1.980743754794676 },
+		{ 0.004955805499604594, 0.9997522097683349, -1.960579901477626 },
+		{ 0.005934326526048856, 0.9997032837872946, -1.943613188347138 },
+		{ 0.00850901055199332, 0.9995745495329533, -1.884819455799823 },
+		{ 0.0101889313712774, 0.9994905536659843, -1.835633689357426 },
+		{ 0.01460886030895193, 0.9992695569959384, -1.667292044697701 },
+		{ 0.01749264049719825, 0.9991253755220524, -1.529008022051489 },
+		{ 0.02507877876771754, 0.9987460641819348, -1.073565040074592 },
+		{ 0.03002764551512668, 0.9984986206066859, -0.7204333459260333 },
+		{ 0.0001348375224075977, 0.9999932581239859, -1.999964168245442 },
+		{ 0.0002022653535329713, 0.9999898869044116, -1.999924431120949 },
+		{ 0.0002315349690366185, 0.9999884233798936, -1.99990265189131 },
+		{ 0.0003473094995530433, 0.9999826345883261, -1.999789639202146 },
+		{ 0.0003975712576726447, 0.9999801214428163, -1.999727223756278 },
+		{ 0.0005963689986055784, 0.9999701815761202, -1.99940115149951 },
+		{ 0.0006826764117831852, 0.9999658661966427, -1.999220225226776 },
+		{ 0.001024033562827508, 0.9999487983411471, -1.998271159666893 },
+		{ 0.001172231955649061, 0.9999413884345383, -1.997743124838664 },
+		{ 0.001758366675849678, 0.9999120818131305, -1.994966954772264 },
+		{ 0.002012846766902385, 0.9998993587444008, -1.993420190134942 },
+		{ 0.003019254903774685, 0.9998490374159157, -1.985280250445916 },
+		{ 0.003456178469909996, 0.9998271913397736, -1.980743754794676 },
+		{ 0.005184167486490039, 0.9997407916652572, -1.956888211572737 },
+		{ 0.005934326526051227, 0.9997032837872946, -1.943613188347138 },
+		{ 0.008901063332041383, 0.9995549468402609, -1.874094829140305 },
+		{ 0.01018893137127296, 0.9994905536659843, -1.835633689357426 },
+		{ 0.01528185262427687, 0.9992359073956303, -1.636941079220717 },
+		{ 0.01749264049720152, 0.9991253755220524, -1.529008022051489 },
+		{ 0.02623374136406687, 0.9986883134206509, -0.994423427612295 },
+		{ 0.03002764551512425, 0.9984986206066859, -0.7204333459260333 },
+		{ 0.0001348375224075977, 0.9999932581239859, -1.999964168245442 },
+		{ 0.0002115830741708806, 0.9999894209063229, -1.999917793932245 },
+		{ 0.0002315349690366185, 0.9999884233798936, -1.99990265189131 },
+		{ 0.0003633147951610696, 0.9999818343145402, -1.999770641151215 },
+		{ 0.0003975712576726447, 0.9999801214428163, -1.999727223756278 },
+		{ 0.0006238521864576207, 0.9999688074166916, -1.999346124576686 },
+		{ 0.0006826764117831852, 0.9999658661966427, -1.999220225226776 },
+		{ 0.001071223643022179, 0.9999464388341408, -1.998110639552379 },
+		{ 0.001172231955649061, 0.9999413884345383, -1.997743124838664 },
+		{ 0.001839408351252887, 0.9999080300139496, -1.994496796919381 },
+		{ 0.002012846766902386, 0.9998993587444008, -1.993420190134942 },
+		{ 0.003158380917609207, 0.9998420811716783, -1.983901494705893 },
+		{ 0.003456178469917974, 0.9998271913397736, -1.980743754794676 },
+		{ 0.005423044362562894, 0.9997288477819423, -1.952851711136862 },
+		{ 0.005934326526048853, 0.9997032837872946, -1.943613188347138 },
+		{ 0.009311170956639339, 0.9995344417441984, -1.862382902939283 },
+		{ 0.01018893137128254, 0.9994905536659843, -1.835633689357426 },
+		{ 0.01598583831251586, 0.9992007081882304, -1.603921478475542 },
+		{ 0.01749264049720441, 0.9991253755220524, -1.529008022051489 },
+		{ 0.02744207480904157, 0.9986279025733855, -0.9093622073290746 },
+		{ 0.03002764551512632, 0.9984986206066859, -0.7204333459260333 },
+		{ 0.0001348375224075977, 0.9999932581239859, -1.999964168245442 },
+		{ 0.0002213372390099526, 0.9999889333102403, -1.999910551550272 },
+		{ 0.0002315349690366185, 0.9999884233798936, -1.99990265189131 },
+		{ 0.0003800575753512307, 0.9999809972265546, -1.999749892026546 },
+		{ 0.0003975712576726449, 0.9999801214428163, -1.999727223756278 },
+		{ 0.0006526020849334115, 0.9999673699384893, -1.99928597613129 },
+		{ 0.0006826764117831854, 0.9999658661966427, -1.999220225226776 },
+		{ 0.001120589541994424, 0.9999439705284221, -1.997935097558381 },
+		{ 0.001172231955649061, 0.9999413884345383, -1.997743124838664 },
+		{ 0.001924182788121008, 0.9999037917170515, -1.99398256934806 },
+		{ 0.00201284676690448, 0.9998993587444008, -1.993420190134942 },
+		{ 0.003303938650170818, 0.9998348043245148, -1.982393421732311 },
+		{ 0.003456178469917976, 0.9998271913397736, -1.980743754794676 },
+		{ 0.005672928624685573, 0.9997163536005063, -1.94843833177049 },
+		{ 0.005934326526048857, 0.9997032837872946, -1.943613188347138 },
+		{ 0.00974017179150131, 0.9995129917786348, -1.849594532392693 },
+		{ 0.01018893137127962, 0.9994905536659843, -1.835633689357426 },
+		{ 0.01672263151545966, 0.9991638925075768, -1.568023071699342 },
+		{ 0.0174926404972007, 0.9991253755220524, -1.529008022051489 },
+		{ 0.02870564512031119, 0.9985647177504324, -0.8181201256840513 },
+		{ 0.03002764551512703, 0.9984986206066859, -0.7204333459260333 }
+	}
+};
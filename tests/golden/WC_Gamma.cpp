@@ -0,0 +1,1647 @@
+#include "Scales.hpp"
+Scale wc_gamma = {
+	.name = "Gamma Spread",
+	.description = "Like the Alpha scale, Wendy Carlos' Gamma scale is based on a fixed interval size whose multiples approximate justly intonated intervals. Here the step size is 35 cents; 20 divisions of the perfect fifth. This scale consists of ascending pairs of intervals.",
+	.scalename = {
+		"3/30; E0-",
+		"5/29; E0-",
+		"9/25; E0-",
+		"11/23; E0-",
+		"13/21; E0-",
+		"15/19; E0-",
+		"18/16; E0-",
+		"20/14; E0-",
+		"24/10; E0-",
+		"29/5; E0-",
+		"31/3; E0-"},
+	.notedesc = {
+		"0",
+		"+3",
+		"+30",
+		"+3",
+		"+30",
+		"+3",
+		"+30",
+		"+3",
+		"+30",
+		"+3",
+		"+30",
+		"+3",
+		"+30",
+		"+3",
+		"+30",
+		"+3",
+		"+30",
+		"+3",
+		"+30",
+		"+3",
+		"+30",
+		"0",
+		"+5",
+		"+29",
+		"+5",
+		"+29",
+		"+5",
+		"+29",
+		"+5",
+		"+29",
+		"+5",
+		"+29",
+		"+5",
+		"+29",
+		"+5",
+		"+29",
+		"+5",
+		"+29",
+		"+5",
+		"+29",
+		"+5",
+		"+29",
+		"0",
+		"+8",
+		"+25",
+		"+8",
+		"+25",
+		"+8",
+		"+25",
+		"+8",
+		"+25",
+		"+8",
+		"+25",
+		"+8",
+		"+25",
+		"+8",
+		"+25",
+		"+8",
+		"+25",
+		"+8",
+		"+25",
+		"+8",
+		"+25",
+		"0",
+		"+11",
+		"+23",
+		"+11",
+		"+23",
+		"+11",
+		"+23",
+		"+11",
+		"+23",
+		"+11",
+		"+23",
+		"+11",
+		"+23",
+		"+11",
+		"+23",
+		"+11",
+		"+23",
+		"+11",
+		"+23",
+		"+11",
+		"+23",
+		"0",
+		"+13",
+		"+21",
+		"+13",
+		"+21",
+		"+13",
+		"+21",
+		"+13",
+		"+21",
+		"+13",
+		"+21",
+		"+13",
+		"+21",
+		"+13",
+		"+21",
+		"+13",
+		"+21",
+		"+13",
+		"+21",
+		"+13",
+		"+21",
+		"0",
+		"+15",
+		"+19",
+		"+15",
+		"+19",
+		"+15",
+		"+19",
+		"+15",
+		"+19",
+		"+15",
+		"+19",
+		"+15",
+		"+19",
+		"+15",
+		"+19",
+		"+15",
+		"+19",
+		"+15",
+		"+19",
+		"+15",
+		"+19",
+		"0",
+		"+18",
+		"+16",
+		"+18",
+		"+16",
+		"+18",
+		"+16",
+		"+18",
+		"+16",
+		"+18",
+		"+16",
+		"+18",
+		"+16",
+		"+18",
+		"+16",
+		"+18",
+		"+16",
+		"+18",
+		"+16",
+		"+18",
+		"+16",
+		"0",
+		"+20",
+		"+14",
+		"+20",
+		"+14",
+		"+20",
+		"+14",
+		"+20",
+		"+14",
+		"+20",
+		"+14",
+		"+20",
+		"+14",
+		"+20",
+		"+14",
+		"+20",
+		"+14",
+		"+20",
+		"+14",
+		"+20",
+		"+14",
+		"0",
+		"+24",
+		"+10",
+		"+24",
+		"+10",
+		"+24",
+		"+10",
+		"+24",
+		"+10",
+		"+24",
+		"+10",
+		"+24",
+		"+10",
+		"+24",
+		"+10",
+		"+24",
+		"+10",
+		"+24",
+		"+10",
+		"+24",
+		"+10",
+		"0",
+		"+29",
+		"+5",
+		"+29",
+		"+5",
+		"+29",
+		"+5",
+		"+29",
+		"+5",
+		"+29",
+		"+5",
+		"+29",
+		"+5",
+		"+29",
+		"+5",
+		"+29",
+		"+5",
+		"+29",
+		"+5",
+		"+29",
+		"+5",
+		"0",
+		"+31",
+		"+3",
+		"+31",
+		"+3",
+		"+31",
+		"+3",
+		"+31",
+		"+3",
+		"+31",
+		"+3",
+		"+31",
+		"+3",
+		"+31",
+		"+3",
+		"+31",
+		"+3",
+		"+31",
+		"+3",
+		"+31",
+		"+3"},
+	.c_maxq48000 = {
+		0.002696759197496541,
+		0.002865872057947583,
+		0.005265057197981836,
+		0.005595227160511534,
+		0.01027931130215637,
+		0.01092392344972525,
+		0.02006896352182881,
+		0.02132748146092205,
+		0.03918193398384626,
+		0.04163901985942733,
+		0.07649742095772101,
+		0.08129454844589165,
+		0.1493508568412001,
+		0.1587165987415804,
+		0.2915873262123262,
+		0.3098726691724296,
+		0.5692847741613959,
+		0.6049844304966859,
+		1.111451441672061,
+		1.181150187013538,
+		2.169958451839221,
+		0.002696759197496541,
+		0.002984465419605226,
+		0.005372890257612864,
+		0.005946101970122223,
+		0.01070468202987866,
+		0.01184672082538927,
+		0.02132748146092206,
+		0.02360282333197644,
+		0.04249182406318799,
+		0.04702510318691385,
+		0.08465861829607997,
+		0.09369050043873375,
+		0.1686696631602227,
+		0.186664340481513,
+		0.3360491328961403,
+		0.3719008420729185,
+		0.6695277479327992,
+		0.7409569282368847,
+		1.333934122634704,
+		1.476246104854461,
+		1.476246104854461,
+		0.002696759197496541,
+		0.003171620240285988,
+		0.005265057197981837,
+		0.00619215908891103,
+		0.01027931130215637,
+		0.0120893522166847,
+		0.02006896352182883,
+		0.02360282333197646,
+		0.03918193398384629,
+		0.04608131678648912,
+		0.07649742095772109,
+		0.08996753171896688,
+		0.1493508568412003,
+		0.1756494242798307,
+		0.2915873262123267,
+		0.3429317183693685,
+		0.5692847741613969,
+		0.6695277479327998,
+		1.111451441672063,
+		1.307162275287531,
+		2.169958451839225,
+		0.002696759197496541,
+		0.003370511476699347,
+		0.005372890257612864,
+		0.006715241128366817,
+		0.01070468202987866,
+		0.01337911581783696,
+		0.02132748146092207,
+		0.02665589167170072,
+		0.04249182406318801,
+		0.05310788623760625,
+		0.08465861829608,
+		0.1058095379199362,
+		0.1686696631602227,
+		0.2108097141117743,
+		0.3360491328961404,
+		0.4200068957631719,
+		0.6695277479327995,
+		0.8368010612408645,
+		1.333934122634705,
+		1.667201236830828,
+		1.667201236830828,
+		0.002696759197496541,
+		0.003509987447170166,
+		0.005372890257612864,
+		0.006993126185219294,
+		0.01070468202987866,
+		0.01393276032420775,
+		0.02132748146092206,
+		0.02775894572903811,
+		0.04249182406318801,
+		0.05530555683563006,
+		0.08465861829608,
+		0.1101880686232062,
+		0.1686696631602228,
+		0.2195332831201224,
+		0.3360491328961405,
+		0.4373873051746159,
+		0.6695277479327997,
+		0.8714289332758461,
+		1.333934122634705,
+		1.736192104265835,
+		1.736192104265835,
+		0.002696759197496541,
+		0.003655235107330595,
+		0.005372890257612864,
+		0.007282510472456171,
+		0.01070468202987866,
+		0.01450931533106363,
+		0.02132748146092207,
+		0.02890764553960689,
+		0.04249182406318801,
+		0.05759416978514967,
+		0.08465861829608,
+		0.1147477883903013,
+		0.1686696631602228,
+		0.2286178442988931,
+		0.3360491328961405,
+		0.455486937613959,
+		0.6695277479327997,
+		0.9074897498626578,
+		1.333934122634705,
+		1.808037899878846,
+		1.808037899878846,
+		0.002696759197496541,
+		0.003884453669075221,
+		0.005372890257612864,
+		0.007739194249934348,
+		0.01070468202987866,
+		0.01541918960574865,
+		0.02132748146092207,
+		0.03072043424934633,
+		0.04249182406318802,
+		0.06120588076279701,
+		0.08465861829608003,
+		0.1219435835295667,
+		0.1686696631602229,
+		0.242954392269297,
+		0.3360491328961406,
+		0.4840503699699104,
+		0.6695277479327999,
+		0.9643981262470765,
+		1.333934122634706,
+		1.921419347260672,
+		1.921419347260672,
+		0.002696759197496541,
+		0.004045197208739343,
+		0.005372890257612864,
+		0.008059451764597624,
+		0.01070468202987866,
+		0.01605725491097093,
+		0.02132748146092207,
+		0.03199168415009093,
+		0.04249182406318802,
+		0.06373865647856825,
+		0.08465861829608003,
+		0.1269897611714631,
+		0.1686696631602229,
+		0.2530081481684142,
+		0.3360491328961406,
+		0.504080978254451,
+		0.6695277479328,
+		1.004306124041605,
+		1.333934122634706,
+		2.000930077306614,
+		2.000930077306614,
+		0.002696759197496541,
+		0.004386914851255591,
+		0.005372890257612864,
+		0.008740273172024133,
+		0.01070468202987866,
+		0.01741368996476882,
+		0.02132748146092207,
+		0.03469417857095018,
+		0.04249182406318802,
+		0.06912297331285111,
+		0.08465861829608003,
+		0.1377172089501432,
+		0.1686696631602229,
+		0.2743809869864395,
+		0.3360491328961406,
+		0.5466631700828873,
+		0.6695277479327999,
+		1.089144786624159,
+		1.333934122634706,
+		2.169958451839225,
+		2.169958451839225,
+		0.002696759197496541,
+		0.004854936875520458,
+		0.005372890257612864,
+		0.009672737211399744,
+		0.01070468202987866,
+		0.01927148540953321,
+		0.02132748146092206,
+		0.0383955587516791,
+		0.04249182406318801,
+		0.07649742095772107,
+		0.08465861829607998,
+		0.1524096953772517,
+		0.1686696631602227,
+		0.3036535735998839,
+		0.3360491328961403,
+		0.6049844304966866,
+		0.6695277479327995,
+		1.205341194586686,
+		1.333934122634705,
+		2.401462454455043,
+		2.401462454455043,
+		0.002696759197496541,
+		0.005055840221190385,
+		0.005372890257612864,
+		0.01007300714639203,
+		0.01070468202987866,
+		0.02006896352182883,
+		0.02132748146092207,
+		0.03998441488098804,
+		0.04249182406318801,
+		0.07966297968681979,
+		0.08465861829608001,
+		0.1587165987415806,
+		0.1686696631602228,
+		0.316219137360032,
+		0.3360491328961405,
+		0.6300194411016333,
+		0.6695277479327998,
+		1.255219717186487,
+		1.333934122634705,
+		2.500837967251802,
+		2.500837967251802
+	},
+	.c_maxq96000 = {
+		0.001348379598748271,
+		0.001432936028973791,
+		0.002632528598990918,
+		0.002797613580255767,
+		0.005139655651078185,
+		0.005461961724862627,
+		0.01003448176091441,
+		0.01066374073046102,
+		0.01959096699192313,
+		0.02081950992971367,
+		0.03824871047886051,
+		0.04064727422294583,
+		0.07467542842060004,
+		0.0793582993707902,
+		0.1457936631061631,
+		0.1549363345862148,
+		0.2846423870806979,
+		0.302492215248343,
+		0.5557257208360307,
+		0.590575093506769,
+		1.08497922591961,
+		0.001348379598748271,
+		0.001492232709802613,
+		0.002686445128806432,
+		0.002973050985061111,
+		0.005352341014939331,
+		0.005923360412694637,
+		0.01066374073046103,
+		0.01180141166598822,
+		0.021245912031594,
+		0.02351255159345693,
+		0.04232930914803999,
+		0.04684525021936688,
+		0.08433483158011135,
+		0.09333217024075652,
+		0.1680245664480702,
+		0.1859504210364593,
+		0.3347638739663996,
+		0.3704784641184424,
+		0.6669670613173522,
+		0.7381230524272306,
+		0.7381230524272306,
+		0.001348379598748271,
+		0.001585810120142994,
+		0.002632528598990918,
+		0.003096079544455515,
+		0.005139655651078187,
+		0.006044676108342351,
+		0.01003448176091441,
+		0.01180141166598823,
+		0.01959096699192315,
+		0.02304065839324456,
+		0.03824871047886055,
+		0.04498376585948344,
+		0.07467542842060014,
+		0.08782471213991536,
+		0.1457936631061633,
+		0.1714658591846843,
+		0.2846423870806984,
+		0.3347638739663999,
+		0.5557257208360317,
+		0.6535811376437657,
+		1.084979225919612,
+		0.001348379598748271,
+		0.001685255738349674,
+		0.002686445128806432,
+		0.003357620564183409,
+		0.005352341014939331,
+		0.006689557908918482,
+		0.01066374073046103,
+		0.01332794583585036,
+		0.02124591203159401,
+		0.02655394311880312,
+		0.04232930914804,
+		0.05290476895996808,
+		0.08433483158011137,
+		0.1054048570558872,
+		0.1680245664480702,
+		0.210003447881586,
+		0.3347638739663997,
+		0.4184005306204323,
+		0.6669670613173524,
+		0.8336006184154142,
+		0.8336006184154142,
+		0.001348379598748271,
+		0.001754993723585083,
+		0.002686445128806432,
+		0.003496563092609647,
+		0.005352341014939331,
+		0.006966380162103876,
+		0.01066374073046103,
+		0.01387947286451906,
+		0.021245912031594,
+		0.02765277841781503,
+		0.04232930914804,
+		0.05509403431160309,
+		0.0843348315801114,
+		0.1097666415600612,
+		0.1680245664480703,
+		0.2186936525873079,
+		0.3347638739663998,
+		0.4357144666379231,
+		0.6669670613173526,
+		0.8680960521329174,
+		0.8680960521329174,
+		0.001348379598748271,
+		0.001827617553665297,
+		0.002686445128806432,
+		0.003641255236228086,
+		0.005352341014939331,
+		0.007254657665531815,
+		0.01066374073046103,
+		0.01445382276980344,
+		0.02124591203159401,
+		0.02879708489257483,
+		0.04232930914804,
+		0.05737389419515063,
+		0.0843348315801114,
+		0.1143089221494465,
+		0.1680245664480702,
+		0.2277434688069795,
+		0.3347638739663998,
+		0.4537448749313289,
+		0.6669670613173525,
+		0.9040189499394229,
+		0.9040189499394229,
+		0.001348379598748271,
+		0.00194222683453761,
+		0.002686445128806432,
+		0.003869597124967174,
+		0.005352341014939331,
+		0.007709594802874327,
+		0.01066374073046103,
+		0.01536021712467316,
+		0.02124591203159401,
+		0.03060294038139851,
+		0.04232930914804001,
+		0.06097179176478333,
+		0.08433483158011143,
+		0.1214771961346485,
+		0.1680245664480703,
+		0.2420251849849552,
+		0.3347638739663999,
+		0.4821990631235383,
+		0.6669670613173528,
+		0.9607096736303359,
+		0.9607096736303359,
+		0.001348379598748271,
+		0.002022598604369672,
+		0.002686445128806432,
+		0.004029725882298812,
+		0.005352341014939331,
+		0.008028627455485467,
+		0.01066374073046103,
+		0.01599584207504546,
+		0.02124591203159401,
+		0.03186932823928412,
+		0.04232930914804001,
+		0.06349488058573156,
+		0.08433483158011143,
+		0.1265040740842071,
+		0.1680245664480703,
+		0.2520404891272255,
+		0.3347638739664,
+		0.5021530620208027,
+		0.6669670613173529,
+		1.000465038653307,
+		1.000465038653307,
+		0.001348379598748271,
+		0.002193457425627795,
+		0.002686445128806432,
+		0.004370136586012066,
+		0.005352341014939331,
+		0.00870684498238441,
+		0.01066374073046103,
+		0.01734708928547509,
+		0.02124591203159401,
+		0.03456148665642556,
+		0.04232930914804001,
+		0.06885860447507161,
+		0.08433483158011143,
+		0.1371904934932197,
+		0.1680245664480703,
+		0.2733315850414437,
+		0.3347638739663999,
+		0.5445723933120797,
+		0.6669670613173528,
+		1.084979225919613,
+		1.084979225919613,
+		0.001348379598748271,
+		0.002427468437760229,
+		0.002686445128806432,
+		0.004836368605699872,
+		0.005352341014939331,
+		0.009635742704766607,
+		0.01066374073046103,
+		0.01919777937583955,
+		0.021245912031594,
+		0.03824871047886053,
+		0.04232930914803999,
+		0.07620484768862584,
+		0.08433483158011136,
+		0.1518267867999419,
+		0.1680245664480702,
+		0.3024922152483433,
+		0.3347638739663997,
+		0.602670597293343,
+		0.6669670613173524,
+		1.200731227227522,
+		1.200731227227522,
+		0.001348379598748271,
+		0.002527920110595193,
+		0.002686445128806432,
+		0.005036503573196014,
+		0.005352341014939331,
+		0.01003448176091441,
+		0.01066374073046103,
+		0.01999220744049402,
+		0.02124591203159401,
+		0.0398314898434099,
+		0.04232930914804001,
+		0.07935829937079032,
+		0.0843348315801114,
+		0.158109568680016,
+		0.1680245664480703,
+		0.3150097205508167,
+		0.3347638739663999,
+		0.6276098585932437,
+		0.6669670613173527,
+		1.250418983625901,
+		1.250418983625901
+	},
+	.c_bpre4800022 = {
+		{ 0.001347469458600696, 0.9986525305414123, -1.998645262951418 },
+		{ 0.001431906611275792, 0.9985680933887837, -1.998559886089375 },
+		{ 0.002629068219813768, 0.9973709317801952, -1.997343247421278 },
+		{ 0.002793704761462951, 0.9972062952385392, -1.997175032464607 },
+		{ 0.005126473224864589, 0.9948735267751496, -1.994768134180917 },
+		{ 0.00544707051534238, 0.9945529294846625, -1.99443392364939 },
+		{ 0.009984331029217381, 0.9900156689713595, -1.989614927631689 },
+		{ 0.01060708741784581, 0.98939291258216, -1.988940480403842 },
+		{ 0.01940031577549793, 0.980599684224511, -1.979079545938618 },
+		{ 0.02060430068397463, 0.9793956993161919, -1.977679997754127 },
+		{ 0.03752645047228237, 0.9624735495277719, -1.956734298270179 },
+		{ 0.03983227880211473, 0.9601677211980155, -1.953694097591558 },
+		{ 0.07195555811623047, 0.9280444418891858, -1.906581081378752 },
+		{ 0.07629137126291108, 0.9237086287455061, -1.899529239426173 },
+		{ 0.1356637961783194, 0.8643362038237719, -1.78564049430109 },
+		{ 0.1435301388275168, 0.8564698611741162, -1.768050876258391 },
+		{ 0.2477169980029139, 0.752283001999412, -1.475924121142713 },
+		{ 0.261025729764255, 0.7389742702357814, -1.430325462397456 },
+		{ 0.4263440699979653, 0.5736559300026676, -0.6976983163506552 },
+		{ 0.4459913136244877, 0.5540086863758653, -0.5903079724154492 },
+		{ 0.6620920466461712, 0.3379079533882184, 0.7545197627723037 },
+		{ 0.001347469458600696, 0.9986525305414123, -1.998645262951418 },
+		{ 0.001491117508464689, 0.9985088824915657, -1.998499982133431 },
+		{ 0.002682842601032641, 0.9973171573989897, -1.997288328183809 },
+		{ 0.002968637607952515, 0.997031362392056, -1.996996058805219 },
+		{ 0.005338039709204347, 0.9946619602908098, -1.994547677139263 },
+		{ 0.005905853163611545, 0.9940941468363907, -1.993954218046442 },
+		{ 0.0106070874178458, 0.98939291258216, -1.988940480403842 },
+		{ 0.01173202949674552, 0.9882679705034945, -1.987714172632376 },
+		{ 0.02102183161944249, 0.9789781683807826, -1.977191855970123 },
+		{ 0.02323826449379563, 0.9767617355063575, -1.974576475972931 },
+		{ 0.0414459192519171, 0.9585540807481157, -1.951539717536494 },
+		{ 0.04576496485928205, 0.9542350351407821, -1.945664250687262 },
+		{ 0.08087646813893411, 0.9191235318617359, -1.891889236418069 },
+		{ 0.0891090898417755, 0.9108909101583192, -1.877696350915516 },
+		{ 0.154667138780871, 0.8453328612217536, -1.742113625810017 },
+		{ 0.1696850685437989, 0.8303149314578827, -1.705191743490299 },
+		{ 0.2844932071487739, 0.7155067928532428, -1.345153670234231 },
+		{ 0.3095959024291062, 0.6904040975721413, -1.247219574419319 },
+		{ 0.4867368823231317, 0.5132631176783435, -0.3550938048062325 },
+		{ 0.5219900538939273, 0.4780099461100175, -0.1395360253563344 },
+		{ 0.5219900538939273, 0.4780099461100175, -0.1395360253563344 },
+		{ 0.001347469458600696, 0.9986525305414123, -1.998645262951418 },
+		{ 0.001584553788582114, 0.9984154462114188, -1.998405395009458 },
+		{ 0.002629068219813768, 0.9973709317801952, -1.997343247421278 },
+		{ 0.003091290920484506, 0.9969087090795168, -1.996870425649753 },
+		{ 0.005126473224864586, 0.9948735267751496, -1.994768134180917 },
+		{ 0.006026440693807479, 0.9939735593062055, -1.993827849184415 },
+		{ 0.009984331029217374, 0.9900156689713595, -1.989614927631689 },
+		{ 0.01173202949674552, 0.9882679705034945, -1.987714172632376 },
+		{ 0.01940031577549827, 0.980599684224511, -1.979079545938618 },
+		{ 0.02277722830944486, 0.9772227716907144, -1.975123842898126 },
+		{ 0.03752645047228232, 0.9624735495277719, -1.956734298270179 },
+		{ 0.04398697854867512, 0.956013021451399, -1.948102228776518 },
+		{ 0.07195555811623036, 0.9280444418891858, -1.906581081378752 },
+		{ 0.08407842211080388, 0.9159215778920412, -1.886441913895905 },
+		{ 0.1356637961783194, 0.8643362038237719, -1.78564049430109 },
+		{ 0.1575712276566666, 0.8424287723473242, -1.735149157345836 },
+		{ 0.247716998002914, 0.752283001999412, -1.475924121142713 },
+		{ 0.2844932071487739, 0.7155067928532428, -1.345153670234231 },
+		{ 0.426344069997965, 0.5736559300026676, -0.6976983163506552 },
+		{ 0.4798202544652874, 0.5201797455354413, -0.3961455987640758 },
+		{ 0.6620920466461712, 0.3379079533882184, 0.7545197627723037 },
+		{ 0.001347469458600696, 0.9986525305414123, -1.998645262951418 },
+		{ 0.001683835774278781, 0.9983161642257239, -1.998304813463023 },
+		{ 0.00268284260103264, 0.9973171573989897, -1.997288328183809 },
+		{ 0.003351992450923936, 0.9966480075490898, -1.996602988768668 },
+		{ 0.005338039709204346, 0.9946619602908098, -1.994547677139263 },
+		{ 0.006667238087591602, 0.9933327619124442, -1.993154360260604 },
+		{ 0.0106070874178458, 0.98939291258216, -1.988940480403842 },
+		{ 0.0132395212457735, 0.9867604787542269, -1.986054687652671 },
+		{ 0.02102183161944248, 0.9789781683807826, -1.977191855970123 },
+		{ 0.02620446386172637, 0.9737955361384438, -1.971012701890608 },
+		{ 0.04144591925191708, 0.9585540807481157, -1.951539717536494 },
+		{ 0.05152964768199755, 0.9484703523180703, -1.937573329298513 },
+		{ 0.08087646813893408, 0.9191235318617359, -1.891889236418069 },
+		{ 0.1000400485341852, 0.8999599514676156, -1.857898134755804 },
+		{ 0.1546671387808708, 0.8453328612217536, -1.742113625810017 },
+		{ 0.189418743396169, 0.8105812566058253, -1.653216275438384 },
+		{ 0.2844932071487741, 0.7155067928532428, -1.345153670234231 },
+		{ 0.3419014468822207, 0.6580985531178217, -1.110663052744995 },
+		{ 0.4867368823231319, 0.5132631176783435, -0.3550938048062325 },
+		{ 0.565518527306374, 0.4344814727070321, 0.1380808220099734 },
+		{ 0.565518527306374, 0.4344814727070321, 0.1380808220099734 },
+		{ 0.001347469458600696, 0.9986525305414123, -1.998645262951418 },
+		{ 0.001753452733418404, 0.9982465472665981, -1.998234238095183 },
+		{ 0.00268284260103264, 0.9973171573989897, -1.997288328183809 },
+		{ 0.003490454051543217, 0.9965095459484802, -1.996460727771035 },
+		{ 0.005338039709204347, 0.9946619602908098, -1.994547677139263 },
+		{ 0.006942142037048998, 0.9930578579639372, -1.992864414723742 },
+		{ 0.0106070874178458, 0.98939291258216, -1.988940480403842 },
+		{ 0.01378361484299197, 0.9862163851571941, -1.985451183783939 },
+		{ 0.02102183161944249, 0.9789781683807826, -1.977191855970123 },
+		{ 0.02727391920866607, 0.9727260807914685, -1.969709861274755 },
+		{ 0.04144591925191708, 0.9585540807481157, -1.951539717536494 },
+		{ 0.05360385997747789, 0.9463961400225378, -1.934592088651234 },
+		{ 0.08087646813893408, 0.9191235318617359, -1.891889236418069 },
+		{ 0.1039567461786058, 0.8960432538215585, -1.850536728697882 },
+		{ 0.154667138780871, 0.8453328612217536, -1.742113625810017 },
+		{ 0.1964319971557033, 0.8035680028454733, -1.633782966954191 },
+		{ 0.284493207148774, 0.7155067928532428, -1.345153670234231 },
+		{ 0.353197757754912, 0.6468022422458176, -1.060101574624605 },
+		{ 0.4867368823231319, 0.5132631176783435, -0.3550938048062325 },
+		{ 0.5802491865491899, 0.4197508134787994, 0.2337460145929695 },
+		{ 0.5802491865491899, 0.4197508134787994, 0.2337460145929695 },
+		{ 0.001347469458600696, 0.9986525305414123, -1.998645262951418 },
+		{ 0.001825945909971448, 0.9981740540900572, -1.998160705596804 },
+		{ 0.00268284260103264, 0.9973171573989897, -1.997288328183809 },
+		{ 0.003634635085100498, 0.9963653649149025, -1.996312426537022 },
+		{ 0.005338039709204346, 0.9946619602908098, -1.994547677139263 },
+		{ 0.007228405878820682, 0.9927715941211797, -1.992561838448693 },
+		{ 0.0106070874178458, 0.98939291258216, -1.988940480403842 },
+		{ 0.01434985839224236, 0.985650141607807, -1.984820544241524 },
+		{ 0.02102183161944248, 0.9789781683807826, -1.977191855970123 },
+		{ 0.02838639746181706, 0.9716136025381854, -1.968344498748509 },
+		{ 0.04144591925191708, 0.9585540807481157, -1.951539717536494 },
+		{ 0.05575907183392447, 0.944240928166203, -1.931454989599463 },
+		{ 0.08087646813893408, 0.9191235318617359, -1.891889236418069 },
+		{ 0.1080175417166926, 0.8919824582841086, -1.842754238578356 },
+		{ 0.154667138780871, 0.8453328612217536, -1.742113625810017 },
+		{ 0.2036712807005571, 0.7963287193014932, -1.613187895375162 },
+		{ 0.284493207148774, 0.7155067928532428, -1.345153670234231 },
+		{ 0.364755178324402, 0.6352448216756628, -1.006862377524422 },
+		{ 0.4867368823231317, 0.5132631176783435, -0.3550938048062325 },
+		{ 0.5950612532933696, 0.4049387467083974, 0.3301934302872556 },
+		{ 0.5950612532933696, 0.4049387467083974, 0.3301934302872556 },
+		{ 0.001347469458600696, 0.9986525305414123, -1.998645262951418 },
+		{ 0.001940339311320476, 0.9980596606887078, -1.998044586406993 },
+		{ 0.00268284260103264, 0.9973171573989897, -1.997288328183809 },
+		{ 0.003862120600206567, 0.9961378793997944, -1.99607810020935 },
+		{ 0.005338039709204346, 0.9946619602908098, -1.994547677139263 },
+		{ 0.007679956537942293, 0.9923200434620785, -1.992083209432034 },
+		{ 0.0106070874178458, 0.98939291258216, -1.988940480403842 },
+		{ 0.01524286161989903, 0.9847571383801644, -1.983820658286598 },
+		{ 0.02102183161944248, 0.9789781683807826, -1.977191855970123 },
+		{ 0.03013938000630193, 0.969860619993959, -1.966172073004145 },
+		{ 0.04144591925191708, 0.9585540807481157, -1.951539717536494 },
+		{ 0.05915019892396314, 0.9408498010761061, -1.926437236444265 },
+		{ 0.08087646813893426, 0.9191235318617359, -1.891889236418069 },
+		{ 0.1143884710544559, 0.885611528951779, -1.83023417741725 },
+		{ 0.154667138780871, 0.8453328612217536, -1.742113625810017 },
+		{ 0.2149634686580331, 0.7850365313427206, -1.579966936365417 },
+		{ 0.2844932071487741, 0.7155067928532428, -1.345153670234231 },
+		{ 0.3825758977737851, 0.6174241022262749, -0.9217884892727639 },
+		{ 0.4867368823231318, 0.5132631176783435, -0.3550938048062325 },
+		{ 0.6173796839968361, 0.38262031604033, 0.4749129213620603 },
+		{ 0.6173796839968361, 0.38262031604033, 0.4749129213620603 },
+		{ 0.001347469458600696, 0.9986525305414123, -1.998645262951418 },
+		{ 0.002020552550102573, 0.9979794474499128, -1.997963100415596 },
+		{ 0.00268284260103264, 0.9973171573989897, -1.997288328183809 },
+		{ 0.004021618985401816, 0.9959783810146033, -1.995913557164227 },
+		{ 0.005338039709204346, 0.9946619602908098, -1.994547677139263 },
+		{ 0.007996458681676073, 0.9920035413189757, -1.991746743926153 },
+		{ 0.0106070874178458, 0.98939291258216, -1.988940480403842 },
+		{ 0.01586855811100273, 0.9841314418894553, -1.983116184965453 },
+		{ 0.02102183161944248, 0.9789781683807826, -1.977191855970123 },
+		{ 0.03136682353833672, 0.9686331764618951, -1.964635637144267 },
+		{ 0.04144591925191708, 0.9585540807481157, -1.951539717536494 },
+		{ 0.06152105695009806, 0.9384789430499537, -1.922869604082712 },
+		{ 0.08087646813893426, 0.9191235318617359, -1.891889236418069 },
+		{ 0.1188294475592497, 0.8811705524407539, -1.821281244036258 },
+		{ 0.154667138780871, 0.8453328612217536, -1.742113625810017 },
+		{ 0.2227869850117225, 0.7772130149912999, -1.556160450317471 },
+		{ 0.2844932071487741, 0.7155067928532428, -1.345153670234231 },
+		{ 0.3947736896783832, 0.6052263103223547, -0.8614835949522599 },
+		{ 0.4867368823231319, 0.5132631176783435, -0.3550938048062325 },
+		{ 0.6322920832704048, 0.3677079167399337, 0.5703270566209341 },
+		{ 0.6322920832704048, 0.3677079167399337, 0.5703270566209341 },
+		{ 0.001347469458600696, 0.9986525305414123, -1.998645262951418 },
+		{ 0.002191056115317917, 0.9978089438847063, -1.997789719932123 },
+		{ 0.00268284260103264, 0.9973171573989897, -1.997288328183809 },
+		{ 0.004360603479901964, 0.995639396520106, -1.995563171116992 },
+		{ 0.005338039709204347, 0.9946619602908098, -1.994547677139263 },
+		{ 0.008669063667720597, 0.9913309363324487, -1.991029020808703 },
+		{ 0.0106070874178458, 0.98939291258216, -1.988940480403842 },
+		{ 0.01719749474117639, 0.9828025052588242, -1.981609289126471 },
+		{ 0.02102183161944248, 0.9789781683807826, -1.977191855970123 },
+		{ 0.03397108415464768, 0.9660289158454944, -1.961333950113515 },
+		{ 0.04144591925191708, 0.9585540807481157, -1.951539717536494 },
+		{ 0.06654122149822556, 0.9334587785036589, -1.915152789223586 },
+		{ 0.08087646813893426, 0.9191235318617359, -1.891889236418069 },
+		{ 0.1281960716726815, 0.8718039283304586, -1.801785310910772 },
+		{ 0.154667138780871, 0.8453328612217536, -1.742113625810017 },
+		{ 0.2391595875746611, 0.7608404124254512, -1.504222261748242 },
+		{ 0.2844932071487741, 0.7155067928532428, -1.345153670234231 },
+		{ 0.4199100951280388, 0.5800899048725072, -0.7319669034391002 },
+		{ 0.4867368823231318, 0.5132631176783435, -0.3550938048062325 },
+		{ 0.6620920466461713, 0.3379079533882184, 0.7545197627723037 },
+		{ 0.6620920466461713, 0.3379079533882184, 0.7545197627723037 },
+		{ 0.001347469458600696, 0.9986525305414123, -1.998645262951418 },
+		{ 0.002424525452318235, 0.9975754745476846, -1.997551932737241 },
+		{ 0.002682842601032641, 0.9973171573989897, -1.997288328183809 },
+		{ 0.004824694216453066, 0.9951753057835537, -1.995081970291805 },
+		{ 0.005338039709204347, 0.9946619602908098, -1.994547677139263 },
+		{ 0.009589447990447702, 0.990410552009879, -1.990040955537804 },
+		{ 0.0106070874178458, 0.98939291258216, -1.988940480403842 },
+		{ 0.01901464591746645, 0.9809853540829121, -1.97952533500942 },
+		{ 0.02102183161944249, 0.9789781683807826, -1.977191855970123 },
+		{ 0.03752645047228197, 0.9624735495277719, -1.956734298270179 },
+		{ 0.0414459192519171, 0.9585540807481157, -1.951539717536494 },
+		{ 0.07337336895694554, 0.9266266310510941, -1.904293546572804 },
+		{ 0.08087646813893409, 0.9191235318617359, -1.891889236418069 },
+		{ 0.1408627818019583, 0.8591372181992796, -1.774082630246649 },
+		{ 0.1546671387808708, 0.8453328612217536, -1.742113625810017 },
+		{ 0.2610257297642548, 0.7389742702357814, -1.430325462397456 },
+		{ 0.2844932071487741, 0.7155067928532428, -1.345153670234231 },
+		{ 0.4526521192050337, 0.5473478807950763, -0.5529822372549781 },
+		{ 0.4867368823231319, 0.5132631176783435, -0.3550938048062325 },
+		{ 0.6990255200973036, 0.3009744799125306, 0.960612025649985 },
+		{ 0.6990255200973036, 0.3009744799125306, 0.960612025649985 },
+		{ 0.001347469458600696, 0.9986525305414123, -1.998645262951418 },
+		{ 0.002524729295018168, 0.9974752707049912, -1.997449741472895 },
+		{ 0.00268284260103264, 0.9973171573989897, -1.997288328183809 },
+		{ 0.005023841251565531, 0.9949761587484345, -1.994874949020764 },
+		{ 0.005338039709204346, 0.9946619602908098, -1.994547677139263 },
+		{ 0.009984331029217372, 0.9900156689713595, -1.989614927631689 },
+		{ 0.0106070874178458, 0.98939291258216, -1.988940480403842 },
+		{ 0.01979366087242362, 0.9802063391278891, -1.978623623615143 },
+		{ 0.02102183161944248, 0.9789781683807826, -1.977191855970123 },
+		{ 0.03904862329887539, 0.9609513767012199, -1.954732388183289 },
+		{ 0.04144591925191708, 0.9585540807481157, -1.951539717536494 },
+		{ 0.07629137126291122, 0.9237086287455061, -1.899529239426173 },
+		{ 0.08087646813893429, 0.9191235318617359, -1.891889236418069 },
+		{ 0.1462439769233062, 0.853756023079505, -1.761842742449738 },
+		{ 0.154667138780871, 0.8453328612217536, -1.742113625810017 },
+		{ 0.2702180286785272, 0.7297819713229893, -1.397692137045338 },
+		{ 0.2844932071487739, 0.7155067928532428, -1.345153670234231 },
+		{ 0.466133626846006, 0.5338663731542204, -0.4760583489641794 },
+		{ 0.4867368823231318, 0.5132631176783435, -0.3550938048062325 },
+		{ 0.713615316858675, 0.2863846831418687, 1.031224162687616 },
+		{ 0.713615316858675, 0.2863846831418687, 1.031224162687616 }
+	},
+	.c_bpre9600022 = {
+		{ 0.0006739618415824315, 0.9993260381584242, -1.99932422064784 },
+		{ 0.0007162097838652886, 0.9992837902161646, -1.99928173765549 },
+		{ 0.001315399247496495, 0.9986846007525076, -1.998677675098785 },
+		{ 0.001397829344169055, 0.9986021706558318, -1.998594349484548 },
+		{ 0.002566530150940311, 0.9974334698490668, -1.997407087714733 },
+		{ 0.002727254215449313, 0.9972727457845534, -1.997242953533794 },
+		{ 0.005004688970453776, 0.9949953110298357, -1.994894872471542 },
+		{ 0.005317682582949667, 0.9946823174170535, -1.994568905416266 },
+		{ 0.009747666387752832, 0.9902523336122522, -1.989870410259546 },
+		{ 0.01035577134203131, 0.9896442286580528, -1.989213035737469 },
+		{ 0.01894263698409675, 0.9810573630159308, -1.979608433249224 },
+		{ 0.020118516759355, 0.9798814832407107, -1.978246125344864 },
+		{ 0.03664936711295294, 0.9633506328898039, -1.957878909280369 },
+		{ 0.03890238334638345, 0.9610976166579053, -1.954925569885254 },
+		{ 0.07030316563851759, 0.9296968343625635, -1.909224575053191 },
+		{ 0.07454343096363986, 0.9254565690372056, -1.902392267829582 },
+		{ 0.132657505942852, 0.8673424940583807, -1.792204461673023 },
+		{ 0.1403638733535288, 0.8596361266464906, -1.775203132416204 },
+		{ 0.2425992276197875, 0.7574007723805591, -1.492943459097454 },
+		{ 0.2556824022128885, 0.7443175977873056, -1.448866273784812 },
+		{ 0.4187014937520147, 0.5812985062669767, -0.7383538808454273 },
+		{ 0.0006739618415824315, 0.9993260381584242, -1.99932422064784 },
+		{ 0.0007458368905658196, 0.9992541631094493, -1.9992519371889 },
+		{ 0.0013423222149808, 0.9986576777850305, -1.998650465630966 },
+		{ 0.001485422043299324, 0.9985145779567046, -1.998505745485395 },
+		{ 0.00267259122653399, 0.9973274087734728, -1.997298799601809 },
+		{ 0.002957299391651665, 0.9970427006083494, -1.997007666377369 },
+		{ 0.005317682582949664, 0.9946823174170535, -1.994568905416266 },
+		{ 0.005883321484215533, 0.9941166785159046, -1.993977816948991 },
+		{ 0.01056674384748969, 0.9894332561526233, -1.988984268079588 },
+		{ 0.01168743025993789, 0.9883125697401391, -1.987762986614603 },
+		{ 0.02094224851233446, 0.979057751487682, -1.977285008761437 },
+		{ 0.0231504541943427, 0.9768495458056897, -1.974680864736144 },
+		{ 0.04129069480833717, 0.9587093051920046, -1.951747920219101 },
+		{ 0.04559394901424327, 0.9544060509858051, -1.945899922564123 },
+		{ 0.08058014964911288, 0.9194198503522498, -1.892388682311404 },
+		{ 0.08878381738673784, 0.9112161826141384, -1.878268761647976 },
+		{ 0.1541236539236838, 0.8458763460773938, -1.743407710753244 },
+		{ 0.1690944111567018, 0.8309055888439681, -1.706686541350861 },
+		{ 0.2835761605884568, 0.7164238394123577, -1.348597154791252 },
+		{ 0.3086173663542045, 0.6913826336479801, -1.251170532036438 },
+		{ 0.3086173663542045, 0.6913826336479801, -1.251170532036438 },
+		{ 0.0006739618415824315, 0.9993260381584242, -1.99932422064784 },
+		{ 0.0007925909945331786, 0.999207409005467, -1.999204895207585 },
+		{ 0.001315399247496494, 0.9986846007525076, -1.998677675098785 },
+		{ 0.001546841820050311, 0.9984531581799503, -1.998443579897264 },
+		{ 0.00256653015094031, 0.9974334698490668, -1.997407087714733 },
+		{ 0.0030177738263367, 0.9969822261736695, -1.996945743345199 },
+		{ 0.005004688970453772, 0.9949953110298357, -1.994894872471542 },
+		{ 0.005883321484215531, 0.9941166785159046, -1.993977816948991 },
+		{ 0.009747666387752823, 0.9902523336122522, -1.989870410259546 },
+		{ 0.01145421366000599, 0.9885457863400736, -1.988017979097722 },
+		{ 0.01894263698409673, 0.9810573630159308, -1.979608433249224 },
+		{ 0.02224081622757124, 0.9777591837724661, -1.975758486404064 },
+		{ 0.03664936711295289, 0.9633506328898039, -1.957878909280369 },
+		{ 0.04296208126884456, 0.9570379187326077, -1.949495306807833 },
+		{ 0.07030316563851785, 0.9296968343625635, -1.909224575053191 },
+		{ 0.08216081346266446, 0.917839186539409, -1.889715338117417 },
+		{ 0.1326575059428521, 0.8673424940583807, -1.792204461673023 },
+		{ 0.1541236539236835, 0.8458763460773938, -1.743407710753244 },
+		{ 0.2425992276197875, 0.7574007723805591, -1.492943459097454 },
+		{ 0.2787651245711549, 0.7212348754292468, -1.366508350922356 },
+		{ 0.4187014937520148, 0.5812985062669767, -0.7383538808454273 },
+		{ 0.0006739618415824315, 0.9993260381584242, -1.99932422064784 },
+		{ 0.0008422725987043692, 0.9991577274012969, -1.999154888513552 },
+		{ 0.0013423222149808, 0.9986576777850305, -1.998650465630966 },
+		{ 0.001677403065985004, 0.9983225969340219, -1.998311332767853 },
+		{ 0.002672591226533989, 0.9973274087734728, -1.997298799601809 },
+		{ 0.003339194152590304, 0.9966608058474277, -1.996616130470357 },
+		{ 0.005317682582949662, 0.9946823174170535, -1.994568905416266 },
+		{ 0.006641817492689862, 0.9933581825073104, -1.993181140915933 },
+		{ 0.01056674384748969, 0.9894332561526233, -1.988984268079588 },
+		{ 0.01318920955520838, 0.9868107904448774, -1.986110370903191 },
+		{ 0.02094224851233446, 0.979057751487682, -1.977285008761437 },
+		{ 0.02610557434699141, 0.9738944256530429, -1.971132691192488 },
+		{ 0.04129069480833715, 0.9587093051920046, -1.951747920219101 },
+		{ 0.05133780961510635, 0.9486621903858167, -1.937847178960725 },
+		{ 0.08058014964911285, 0.9194198503522498, -1.892388682311404 },
+		{ 0.09967713757566625, 0.9003228624253775, -1.858573046461192 },
+		{ 0.1541236539236837, 0.8458763460773938, -1.743407710753244 },
+		{ 0.1887672632852002, 0.8112327367148229, -1.654995712999296 },
+		{ 0.2835761605884567, 0.7164238394123577, -1.348597154791252 },
+		{ 0.3408479138338217, 0.6591520861736173, -1.115304226759496 },
+		{ 0.3408479138338217, 0.6591520861736173, -1.115304226759496 },
+		{ 0.0006739618415824315, 0.9993260381584242, -1.99932422064784 },
+		{ 0.0008771110285875288, 0.9991228889714208, -1.999119810326633 },
+		{ 0.0013423222149808, 0.9986576777850305, -1.998650465630966 },
+		{ 0.001746752598090935, 0.9982532474019208, -1.99824103216108 },
+		{ 0.00267259122653399, 0.9973274087734728, -1.997298799601809 },
+		{ 0.003477116187012453, 0.9965228838134813, -1.996474438338102 },
+		{ 0.005317682582949663, 0.9946823174170535, -1.994568905416266 },
+		{ 0.006915721020109738, 0.9930842789799836, -1.992892307917497 },
+		{ 0.01056674384748969, 0.9894332561526233, -1.988984268079588 },
+		{ 0.01373123298396264, 0.9862687670161051, -1.985509390420313 },
+		{ 0.02094224851233446, 0.979057751487682, -1.977285008761437 },
+		{ 0.02717106332997957, 0.9728289366700282, -1.969835577053424 },
+		{ 0.04129069480833715, 0.9587093051920046, -1.951747920219101 },
+		{ 0.05340438738530034, 0.9465956126147842, -1.934880404414914 },
+		{ 0.08058014964911248, 0.9194198503522498, -1.892388682311404 },
+		{ 0.1035804537805039, 0.896419546220113, -1.851250134562236 },
+		{ 0.1541236539236832, 0.8458763460773938, -1.743407710753244 },
+		{ 0.1957598354687937, 0.8042401645316015, -1.63566754351742 },
+		{ 0.283576160588457, 0.7164238394123577, -1.348597154791252 },
+		{ 0.3521182102739179, 0.6478817897416158, -1.064996588784182 },
+		{ 0.3521182102739179, 0.6478817897416158, -1.064996588784182 },
+		{ 0.0006739618415824315, 0.9993260381584242, -1.99932422064784 },
+		{ 0.0009133900957194758, 0.9990866099042952, -1.999083271254147 },
+		{ 0.0013423222149808, 0.9986576777850305, -1.998650465630966 },
+		{ 0.001818971871885438, 0.998181028128116, -1.99816778145308 },
+		{ 0.002672591226533989, 0.9973274087734728, -1.997298799601809 },
+		{ 0.003620757883234622, 0.9963792421167653, -1.996326707573732 },
+		{ 0.005317682582949662, 0.9946823174170535, -1.994568905416266 },
+		{ 0.007200855355043174, 0.9927991446449816, -1.992590987725117 },
+		{ 0.01056674384748969, 0.9894332561526233, -1.988984268079588 },
+		{ 0.0142953776418703, 0.9857046223581308, -1.984881334711479 },
+		{ 0.02094224851233446, 0.979057751487682, -1.977285008761437 },
+		{ 0.02827939809527693, 0.9717206019047877, -1.96847626935851 },
+		{ 0.04129069480833715, 0.9587093051920046, -1.951747920219101 },
+		{ 0.05555177045889288, 0.9444482295415184, -1.931758485308336 },
+		{ 0.08058014964911249, 0.9194198503522498, -1.892388682311404 },
+		{ 0.1076274772834095, 0.892372522717667, -1.843508458093659 },
+		{ 0.1541236539236832, 0.8458763460773938, -1.743407710753244 },
+		{ 0.2029775274964908, 0.7970224725035441, -1.615185236415562 },
+		{ 0.2835761605884568, 0.7164238394123577, -1.348597154791252 },
+		{ 0.3636520238838273, 0.6363479761171534, -1.012009877567906 },
+		{ 0.3636520238838273, 0.6363479761171534, -1.012009877567906 },
+		{ 0.0006739618415824315, 0.9993260381584242, -1.99932422064784 },
+		{ 0.0009706407273712483, 0.999029359272643, -1.999025588869696 },
+		{ 0.0013423222149808, 0.9986576777850305, -1.998650465630966 },
+		{ 0.001932928406215612, 0.9980670715937852, -1.99805211229659 },
+		{ 0.002672591226533989, 0.9973274087734728, -1.997298799601809 },
+		{ 0.003847379433222309, 0.9961526205667878, -1.996093297279816 },
+		{ 0.005317682582949662, 0.9946823174170535, -1.994568905416266 },
+		{ 0.007650697395266474, 0.9923493026047654, -1.992114273154325 },
+		{ 0.01056674384748969, 0.9894332561526233, -1.988984268079588 },
+		{ 0.015184981839889, 0.9848150181602425, -1.983885663340421 },
+		{ 0.02094224851233445, 0.979057751487682, -1.977285008761437 },
+		{ 0.03002587607914098, 0.969974123920894, -1.966313513077193 },
+		{ 0.04129069480833714, 0.9587093051920046, -1.951747920219101 },
+		{ 0.05893064604900433, 0.9410693539542019, -1.926765133815961 },
+		{ 0.08058014964911234, 0.9194198503522498, -1.892388682311404 },
+		{ 0.1139771270774002, 0.8860228729229964, -1.831054037890371 },
+		{ 0.1541236539236837, 0.8458763460773938, -1.743407710753244 },
+		{ 0.2142366118059309, 0.7857633881941019, -1.582145765471397 },
+		{ 0.283576160588457, 0.7164238394123577, -1.348597154791252 },
+		{ 0.3814368940723726, 0.6185631059482372, -0.9273338407930423 },
+		{ 0.3814368940723726, 0.6185631059482372, -0.9273338407930423 },
+		{ 0.0006739618415824315, 0.9993260381584242, -1.99932422064784 },
+		{ 0.001010787120352508, 0.9989892128796551, -1.998985124051474 },
+		{ 0.0013423222149808, 0.9986576777850305, -1.998650465630966 },
+		{ 0.002012835245563402, 0.9979871647544387, -1.997970942416053 },
+		{ 0.002672591226533989, 0.9973274087734728, -1.997298799601809 },
+		{ 0.004006254377907792, 0.995993745622419, -1.995929416639158 },
+		{ 0.005317682582949662, 0.9946823174170535, -1.994568905416266 },
+		{ 0.007966007694797494, 0.9920339923054327, -1.991779150862729 },
+		{ 0.01056674384748969, 0.9894332561526233, -1.988984268079588 },
+		{ 0.01580836395462859, 0.9841916360454882, -1.983184097093694 },
+		{ 0.02094224851233445, 0.979057751487682, -1.977285008761437 },
+		{ 0.03124877132986176, 0.9687512286701643, -1.964783955790594 },
+		{ 0.04129069480833714, 0.9587093051920046, -1.951747920219101 },
+		{ 0.06129314882613616, 0.9387068511738655, -1.923214691156947 },
+		{ 0.08058014964911232, 0.9194198503522498, -1.892388682311404 },
+		{ 0.1184031448624096, 0.8815968551391843, -1.822148740424593 },
+		{ 0.1541236539236837, 0.8458763460773938, -1.743407710753244 },
+		{ 0.2220370765121716, 0.7779629234882308, -1.558470573826984 },
+		{ 0.2835761605884568, 0.7164238394123577, -1.348597154791252 },
+		{ 0.3936107547680386, 0.6063892452376887, -0.8673053255372377 },
+		{ 0.3936107547680386, 0.6063892452376887, -0.8673053255372377 },
+		{ 0.0006739618415824315, 0.9993260381584242, -1.99932422064784 },
+		{ 0.001096128806839954, 0.9989038711931726, -1.998899062565254 },
+		{ 0.0013423222149808, 0.9986576777850305, -1.998650465630966 },
+		{ 0.002182683794223009, 0.9978173162057805, -1.997798238966973 },
+		{ 0.00267259122653399, 0.9973274087734728, -1.997298799601809 },
+		{ 0.004343966857891857, 0.9956560331421933, -1.995580388890303 },
+		{ 0.005317682582949662, 0.9946823174170535, -1.994568905416266 },
+		{ 0.008636037946293119, 0.9913639620537072, -1.991064347447036 },
+		{ 0.01056674384748969, 0.9894332561526233, -1.988984268079588 },
+		{ 0.0171322999277303, 0.9828677000723415, -1.981683552114802 },
+		{ 0.02094224851233445, 0.979057751487682, -1.977285008761437 },
+		{ 0.03384329505933262, 0.9661567049416252, -1.961497290664024 },
+		{ 0.04129069480833714, 0.9587093051920046, -1.951747920219101 },
+		{ 0.06629558835387624, 0.9337044116477435, -1.915535522538608 },
+		{ 0.08058014964911234, 0.9194198503522498, -1.892388682311404 },
+		{ 0.127738334887204, 0.8722616651128553, -1.802757495216124 },
+		{ 0.1541236539236837, 0.8458763460773938, -1.743407710753244 },
+		{ 0.2383636662605621, 0.7616363337397365, -1.50681388107517 },
+		{ 0.283576160588457, 0.7164238394123577, -1.348597154791252 },
+		{ 0.4187014937520148, 0.5812985062669767, -0.7383538808454273 },
+		{ 0.4187014937520148, 0.5812985062669767, -0.7383538808454273 },
+		{ 0.0006739618415824315, 0.9993260381584242, -1.99932422064784 },
+		{ 0.001212998408728892, 0.9987870015912726, -1.998781112560467 },
+		{ 0.0013423222149808, 0.9986576777850305, -1.998650465630966 },
+		{ 0.002415263857978283, 0.997584736142025, -1.997561373953828 },
+		{ 0.00267259122653399, 0.9973274087734728, -1.997298799601809 },
+		{ 0.004806274130733514, 0.9951937258694306, -1.995101102556308 },
+		{ 0.005317682582949663, 0.9946823174170535, -1.994568905416266 },
+		{ 0.009552952408592304, 0.9904470475915976, -1.990080265673271 },
+		{ 0.01056674384748969, 0.9894332561526233, -1.988984268079588 },
+		{ 0.01894263698409673, 0.9810573630159308, -1.979608433249224 },
+		{ 0.02094224851233446, 0.979057751487682, -1.977285008761437 },
+		{ 0.03738552314895401, 0.9626144768551396, -1.956918649582728 },
+		{ 0.04129069480833716, 0.9587093051920046, -1.951747920219101 },
+		{ 0.07310344795220407, 0.9268965520484362, -1.904730421766973 },
+		{ 0.08058014964911285, 0.9194198503522498, -1.892388682311404 },
+		{ 0.1403638733535285, 0.8596361266464906, -1.775203132416204 },
+		{ 0.1541236539236837, 0.8458763460773938, -1.743407710753244 },
+		{ 0.2601703704264158, 0.7398296295736446, -1.433314593227167 },
+		{ 0.2835761605884567, 0.7164238394123577, -1.348597154791252 },
+		{ 0.4513885893397666, 0.5486114106656284, -0.5600978320955017 },
+		{ 0.4513885893397666, 0.5486114106656284, -0.5600978320955017 },
+		{ 0.0006739618415824315, 0.9993260381584242, -1.99932422064784 },
+		{ 0.001263162437180819, 0.9987368375628241, -1.998730451213655 },
+		{ 0.0013423222149808, 0.9986576777850305, -1.998650465630966 },
+		{ 0.00251508344815824, 0.9974849165518419, -1.997459582140501 },
+		{ 0.002672591226533989, 0.9973274087734728, -1.997298799601809 },
+		{ 0.005004688970453771, 0.9949953110298357, -1.994894872471542 },
+		{ 0.005317682582949662, 0.9946823174170535, -1.994568905416266 },
+		{ 0.009946294826599629, 0.9900537051735574, -1.989656018888062 },
+		{ 0.01056674384748969, 0.9894332561526233, -1.988984268079588 },
+		{ 0.01971872572147649, 0.9802812742785714, -1.978710578459558 },
+		{ 0.02094224851233445, 0.979057751487682, -1.977285008761437 },
+		{ 0.03890238334638339, 0.9610976166579053, -1.954925569885254 },
+		{ 0.04129069480833715, 0.9587093051920046, -1.951747920219101 },
+		{ 0.07601081008660461, 0.9239891899148522, -1.899990620075379 },
+		{ 0.08058014964911248, 0.9194198503522498, -1.892388682311404 },
+		{ 0.1457272266298026, 0.8542727733710054, -1.763030404385247 },
+		{ 0.1541236539236835, 0.8458763460773938, -1.743407710753244 },
+		{ 0.2693384003835713, 0.7306615996165533, -1.400855348043669 },
+		{ 0.283576160588457, 0.7164238394123577, -1.348597154791252 },
+		{ 0.4648507842278468, 0.5351492157724503, -0.4834559468702635 },
+		{ 0.4648507842278468, 0.5351492157724503, -0.4834559468702635 }
+	},
+	.c_bpre4800080040 = {
+		{ 6.741889689625945e-05, 0.9999966290604018, -1.999989356582936 },
+		{ 7.16469847346692e-05, 0.9999964176744935, -1.999988204509542 },
+		{ 0.0001316261507489629, 0.9999934186959345, -1.999965697988301 },
+		{ 0.0001398802495666194, 0.9999930059883632, -1.999961699593343 },
+		{ 0.0002569813961451144, 0.9999871509358719, -1.999881488180092 },
+		{ 0.0002730961694488009, 0.9999863451934837, -1.999867015171186 },
+		{ 0.0005017237841342638, 0.9999749140428208, -1.999572167150476 },
+		{ 0.0005331801191914795, 0.9999733409964489, -1.999518502593481 },
+		{ 0.0009795246770263452, 0.9999510237699053, -1.998416033057019 },
+		{ 0.001040950800169369, 0.9999479525273544, -1.998214436673391 },
+		{ 0.00191234372110442, 0.9999043828360926, -1.994055665156791 },
+		{ 0.002032262813109155, 0.9998983869124624, -1.993293549342656 },
+		{ 0.003733479284227829, 0.9998133282818943, -1.977551022762412 },
+		{ 0.00396760607411105, 0.9998016231944685, -1.974665809336511 },
+		{ 0.007288362646493816, 0.9996355827634184, -1.915228735625846 },
+		{ 0.007745321419898788, 0.9996127346311189, -1.904376215088442 },
+		{ 0.01422709311594304, 0.9992886463985704, -1.683973613277929 },
+		{ 0.0151188917103958, 0.9992440554310686, -1.64440022313464 },
+		{ 0.02776698765059061, 0.9986116509308393, -0.8861072851315128 },
+		{ 0.02950696123179962, 0.9985246521148687, -0.7591624458265411 },
+		{ 0.05417595443499553, 0.9972912210109001, 1.12638219573278 },
+		{ 6.741889689625945e-05, 0.9999966290604018, -1.999989356582936 },
+		{ 7.461162015318975e-05, 0.9999962694311322, -1.99998736244892 },
+		{ 0.0001343221219735604, 0.9999932839028708, -1.999964416060562 },
+		{ 0.0001486521524596912, 0.9999925673957402, -1.999957211460624 },
+		{ 0.0002676152193880309, 0.9999866192446508, -1.999872031019454 },
+		{ 0.0002961659087525374, 0.9999851917054348, -1.9998448495314 },
+		{ 0.0005331801191914791, 0.9999733409964489, -1.999518502593481 },
+		{ 0.0005900628652199171, 0.9999704969532154, -1.999413439544496 },
+		{ 0.001062270440374353, 0.9999468865690238, -1.998141646874484 },
+		{ 0.001175593199510423, 0.9999412204019194, -1.997730336540972 },
+		{ 0.002116353077888465, 0.9998941823595423, -1.99273176375808 },
+		{ 0.002342126864728192, 0.9998828936829667, -1.991111909176745 },
+		{ 0.004216298383724446, 0.9997891853600582, -1.971410163065374 },
+		{ 0.004666063216531346, 0.9997666968787846, -1.965028254335485 },
+		{ 0.008399498952931609, 0.9995800261872386, -1.887732930315328 },
+		{ 0.009295364630044607, 0.9995352325012217, -1.862843880401132 },
+		{ 0.01673122569841404, 0.9991634396464468, -1.567572946650261 },
+		{ 0.01851534614327386, 0.9990742332762694, -1.474963600742869 },
+		{ 0.03332056096347041, 0.998333972703485, -0.4689178010733113 },
+		{ 0.03687219704469914, 0.9981563921891486, -0.188642032973124 },
+		{ 0.03687219704469914, 0.9981563921891486, -0.188642032973124 },
+		{ 6.741889689625945e-05, 0.9999966290604018, -1.999989356582936 },
+		{ 7.929037542007099e-05, 0.9999960354815545, -1.999985976329884 },
+		{ 0.0001316261507489628, 0.9999934186959345, -1.999965697988301 },
+		{ 0.0001548033529465862, 0.9999922598328801, -1.999953917287297 },
+		{ 0.0002569813961451143, 0.9999871509358719, -1.999881488180092 },
+		{ 0.0003022314690857816, 0.9999848884317436, -1.999838739030562 },
+		{ 0.0005017237841342634, 0.9999749140428208, -1.999572167150476 },
+		{ 0.0005900628652199169, 0.9999704969532154, -1.999413439544496 },
+		{ 0.0009795246770263443, 0.9999510237699053, -1.998416033057019 },
+		{ 0.001151999951363152, 0.9999424000667624, -1.997819353161211 },
+		{ 0.001912343721104418, 0.9999043828360926, -1.994055665156791 },
+		{ 0.002249061400366417, 0.9998875469601709, -1.991799310540884 },
+		{ 0.003733479284220451, 0.9998133282818943, -1.977551022762412 },
+		{ 0.004390768287388679, 0.9997804627727543, -1.969010489308575 },
+		{ 0.0072883626464968, 0.9996355827634184, -1.915228735625846 },
+		{ 0.008571505466189441, 0.9995714264550459, -1.883141822217352 },
+		{ 0.01422709311594378, 0.9992886463985704, -1.683973613277929 },
+		{ 0.01673122569841132, 0.9991634396464468, -1.567572946650261 },
+		{ 0.02776698765058918, 0.9986116509308393, -0.8861072851315128 },
+		{ 0.03265236707015294, 0.9983673820164586, -0.5207571311217989 },
+		{ 0.05417595443499808, 0.9972912210109001, 1.12638219573278 },
+		{ 6.741889689625945e-05, 0.9999966290604018, -1.999989356582936 },
+		{ 8.426259309701013e-05, 0.9999957868713274, -1.999984426568095 },
+		{ 0.0001343221219735604, 0.9999932839028708, -1.999964416060562 },
+		{ 0.0001678805532838923, 0.9999916059778217, -1.999946511808685 },
+		{ 0.0002676152193880308, 0.9999866192446508, -1.999872031019454 },
+		{ 0.0003344756626562326, 0.9999832762313267, -1.999804279363889 },
+		{ 0.000533180119191479, 0.9999733409964489, -1.999518502593481 },
+		{ 0.0006663861527615258, 0.9999666806925167, -1.999256198124691 },
+		{ 0.001062270440374352, 0.9999468865690238, -1.998141646874484 },
+		{ 0.00132765327005239, 0.9999336174054085, -1.99711393134256 },
+		{ 0.002116353077888464, 0.9998941823595423, -1.99273176375808 },
+		{ 0.002645063007708099, 0.9998677468773762, -1.988683278585708 },
+		{ 0.004216298383724443, 0.9997891853600582, -1.971410163065374 },
+		{ 0.005269571571548564, 0.9997365221788362, -1.95546582531252 },
+		{ 0.008399498952929373, 0.9995800261872386, -1.887732930315328 },
+		{ 0.01049744608649445, 0.9994751285734251, -1.825692612707092 },
+		{ 0.01673122569841965, 0.9991634396464468, -1.567572946650261 },
+		{ 0.0209090921333918, 0.9989545454135866, -1.338982507103488 },
+		{ 0.03332056096347196, 0.998333972703485, -0.4689178010733113 },
+		{ 0.04163683945674917, 0.9979181650913902, 0.1923163092501624 },
+		{ 0.04163683945674917, 0.9979181650913902, 0.1923163092501624 },
+		{ 6.741889689625945e-05, 0.9999966290604018, -1.999989356582936 },
+		{ 8.77495296698086e-05, 0.9999956125300472, -1.999983292584414 },
+		{ 0.0001343221219735604, 0.9999932839028708, -1.999964416060562 },
+		{ 0.000174827417540701, 0.9999912586384596, -1.999942355327003 },
+		{ 0.0002676152193880309, 0.9999866192446508, -1.999872031019454 },
+		{ 0.0003483224224143263, 0.9999825842746315, -1.999788468930764 },
+		{ 0.0005331801191914791, 0.9999733409964489, -1.999518502593481 },
+		{ 0.0006939640036341003, 0.9999653018747597, -1.999194803651632 },
+		{ 0.001062270440374352, 0.9999468865690238, -1.998141646874484 },
+		{ 0.001382591136210283, 0.9999308704978397, -1.996873055942349 },
+		{ 0.002116353077888464, 0.9998941823595423, -1.99273176375808 },
+		{ 0.002754512675532856, 0.9998622743727547, -1.98773397400444 },
+		{ 0.004216298383724443, 0.9997891853600582, -1.971410163065374 },
+		{ 0.005487578050744502, 0.9997256211667142, -1.95173063790984 },
+		{ 0.008399498952933486, 0.9995800261872386, -1.887732930315328 },
+		{ 0.01093169496690915, 0.9994534157713644, -1.81122803729056 },
+		{ 0.01673122569841688, 0.9991634396464468, -1.567572946650261 },
+		{ 0.02177388005715577, 0.9989113063458901, -1.286765932823327 },
+		{ 0.03332056096347404, 0.998333972703485, -0.4689178010733113 },
+		{ 0.04335793377818171, 0.9978321181449937, 0.328920604275741 },
+		{ 0.04335793377818171, 0.9978321181449937, 0.328920604275741 },
+		{ 6.741889689625945e-05, 0.9999966290604018, -1.999989356582936 },
+		{ 9.138077202822642e-05, 0.9999954309729848, -1.999982070312305 },
+		{ 0.0001343221219735604, 0.9999932839028708, -1.999964416060562 },
+		{ 0.0001820620169696766, 0.9999908969003832, -1.999937862382896 },
+		{ 0.0002676152193880308, 0.9999866192446508, -1.999872031019454 },
+		{ 0.0003627295806175047, 0.999981863521004, -1.999771348908101 },
+		{ 0.000533180119191479, 0.9999733409964489, -1.999518502593481 },
+		{ 0.0007226780051608246, 0.9999638661195929, -1.999128288531548 },
+		{ 0.001062270440374352, 0.9999468865690238, -1.998141646874484 },
+		{ 0.001439802283366294, 0.9999280098868878, -1.996611958390762 },
+		{ 0.002116353077888464, 0.9998941823595423, -1.99273176375808 },
+		{ 0.002868491569169149, 0.9998565754740689, -1.986704890954634 },
+		{ 0.004216298383724443, 0.9997891853600582, -1.971410163065374 },
+		{ 0.005714630798947407, 0.9997142687984468, -1.947682933654217 },
+		{ 0.008399498952933487, 0.9995800261872386, -1.887732930315328 },
+		{ 0.01138393782905148, 0.9994308040174364, -1.7955831446836 },
+		{ 0.01673122569841688, 0.9991634396464468, -1.567572946650261 },
+		{ 0.0226743781377018, 0.9988662811242699, -1.230753480747776 },
+		{ 0.03332056096346967, 0.998333972703485, -0.4689178010733113 },
+		{ 0.04514995239218108, 0.9977425033220606, 0.4695161633574388 },
+		{ 0.04514995239218108, 0.9977425033220606, 0.4695161633574388 },
+		{ 6.741889689625945e-05, 0.9999966290604018, -1.999989356582936 },
+		{ 9.711120192863031e-05, 0.9999951444512678, -1.999980055567373 },
+		{ 0.0001343221219735604, 0.9999932839028708, -1.999964416060562 },
+		{ 0.0001934789650493947, 0.9999903260521774, -1.999930431490874 },
+		{ 0.0002676152193880308, 0.9999866192446508, -1.999872031019454 },
+		{ 0.0003854764145082468, 0.9999807261875633, -1.999742981505445 },
+		{ 0.000533180119191479, 0.9999733409964489, -1.999518502593481 },
+		{ 0.0007679971796597285, 0.9999616001667146, -1.999017946059007 },
+		{ 0.001062270440374352, 0.9999468865690238, -1.998141646874484 },
+		{ 0.001530089015344939, 0.9999234956552638, -1.996178656190508 },
+		{ 0.002116353077888464, 0.9998941823595423, -1.99273176375808 },
+		{ 0.003048356657523712, 0.9998475821957202, -1.984996905695491 },
+		{ 0.004216298383728763, 0.9997891853600582, -1.971410163065374 },
+		{ 0.006072974609701202, 0.9996963539112222, -1.940968516150531 },
+		{ 0.008399498952933486, 0.9995800261872386, -1.887732930315328 },
+		{ 0.01209759772882236, 0.9993951204495891, -1.769699458575828 },
+		{ 0.01673122569841469, 0.9991634396464468, -1.567572946650261 },
+		{ 0.02409543064098728, 0.9987952284970909, -1.139136254703351 },
+		{ 0.03332056096347363, 0.998333972703485, -0.4689178010733113 },
+		{ 0.04797836616549801, 0.9976011016579873, 0.6861511897991139 },
+		{ 0.04797836616549801, 0.9976011016579873, 0.6861511897991139 },
+		{ 6.741889689625945e-05, 0.9999966290604018, -1.999989356582936 },
+		{ 0.0001011296998919467, 0.9999949435212333, -1.999978579996565 },
+		{ 0.0001343221219735604, 0.9999932839028708, -1.999964416060562 },
+		{ 0.0002014853957979551, 0.9999899257321414, -1.9999249715979 },
+		{ 0.0002676152193880308, 0.9999866192446508, -1.999872031019454 },
+		{ 0.0004014312989352357, 0.9999799286968674, -1.999722103035051 },
+		{ 0.000533180119191479, 0.9999733409964489, -1.999518502593481 },
+		{ 0.0007997782860393361, 0.9999600112703335, -1.99893665505189 },
+		{ 0.001062270440374352, 0.9999468865690238, -1.998141646874484 },
+		{ 0.001593403286706353, 0.9999203299297643, -1.995859258397268 },
+		{ 0.002116353077888464, 0.9998941823595423, -1.99273176375808 },
+		{ 0.003174491465800452, 0.9998412754480213, -1.983737824615066 },
+		{ 0.004216298383728763, 0.9997891853600582, -1.971410163065374 },
+		{ 0.006324204042315538, 0.9996837897995412, -1.936021471117602 },
+		{ 0.008399498952933486, 0.9995800261872386, -1.887732930315328 },
+		{ 0.01259809838822162, 0.9993700964335542, -1.750685282719569 },
+		{ 0.01673122569841469, 0.9991634396464468, -1.567572946650261 },
+		{ 0.02509189516506957, 0.9987454056017981, -1.072675152642955 },
+		{ 0.03332056096347552, 0.998333972703485, -0.4689178010733113 },
+		{ 0.0499609234682997, 0.9975019594080644, 0.8329478824538958 },
+		{ 0.0499609234682997, 0.9975019594080644, 0.8329478824538958 },
+		{ 6.741889689625945e-05, 0.9999966290604018, -1.999989356582936 },
+		{ 0.0001096728908185128, 0.9999945163650584, -1.999975271381765 },
+		{ 0.0001343221219735604, 0.9999932839028708, -1.999964416060562 },
+		{ 0.0002185058002335299, 0.9999890747130796, -1.999912683169741 },
+		{ 0.0002676152193880309, 0.9999866192446508, -1.999872031019454 },
+		{ 0.000435339552398816, 0.9999782330904288, -1.999675006507295 },
+		{ 0.000533180119191479, 0.9999733409964489, -1.999518502593481 },
+		{ 0.0008673356544392503, 0.9999566332172787, -1.998753094028445 },
+		{ 0.001062270440374352, 0.9999468865690238, -1.998141646874484 },
+		{ 0.001728002082398626, 0.9999135999536237, -1.995137716067456 },
+		{ 0.002116353077888464, 0.9998941823595423, -1.99273176375808 },
+		{ 0.003442643007501749, 0.9998278686288574, -1.980893496750188 },
+		{ 0.004216298383728763, 0.9997891853600582, -1.971410163065374 },
+		{ 0.006858387260614588, 0.9996570819768592, -1.924855858368439 },
+		{ 0.008399498952933486, 0.9995800261872386, -1.887732930315328 },
+		{ 0.01366191523114993, 0.999316904289099, -1.707944101287461 },
+		{ 0.01673122569841469, 0.9991634396464468, -1.567572946650261 },
+		{ 0.02721008782396441, 0.9986394958783745, -0.925857420089138 },
+		{ 0.03332056096347363, 0.998333972703485, -0.4689178010733113 },
+		{ 0.05417595443499739, 0.9972912210109001, 1.12638219573278 },
+		{ 0.05417595443499739, 0.9972912210109001, 1.12638219573278 },
+		{ 6.741889689625945e-05, 0.9999966290604018, -1.999989356582936 },
+		{ 0.0001213731234820272, 0.9999939313449805, -1.99997036103256 },
+		{ 0.0001343221219735604, 0.9999932839028708, -1.999964416060562 },
+		{ 0.0002418171233586398, 0.9999879091465312, -1.999894348518325 },
+		{ 0.0002676152193880309, 0.9999866192446508, -1.999872031019454 },
+		{ 0.0004817829648447603, 0.9999759109831013, -1.999604538333277 },
+		{ 0.0005331801191914791, 0.9999733409964489, -1.999518502593481 },
+		{ 0.000959867475364693, 0.9999520067789429, -1.998478008967674 },
+		{ 0.001062270440374352, 0.9999468865690238, -1.998141646874484 },
+		{ 0.001912343721104419, 0.9999043828360926, -1.994055665156791 },
+		{ 0.002116353077888465, 0.9998941823595423, -1.99273176375808 },
+		{ 0.003809932094686734, 0.9998095067316458, -1.976628100466168 },
+		{ 0.004216298383724445, 0.9997891853600582, -1.971410163065374 },
+		{ 0.007589901505481628, 0.999620505456369, -1.908138878128203 },
+		{ 0.008399498952929373, 0.9995800261872386, -1.887732930315328 },
+		{ 0.01511889171038988, 0.9992440554310686, -1.64440022313464 },
+		{ 0.01673122569841965, 0.9991634396464468, -1.567572946650261 },
+		{ 0.03011084670991751, 0.9984944577195969, -0.7142103919268785 },
+		{ 0.03332056096347196, 0.998333972703485, -0.4689178010733113 },
+		{ 0.0599465787824328, 0.9970026764649181, 1.474544517118575 },
+		{ 0.0599465787824328, 0.9970026764649181, 1.474544517118575 },
+		{ 6.741889689625945e-05, 0.9999966290604018, -1.999989356582936 },
+		{ 0.0001263957626738537, 0.9999936802154733, -1.999968118796215 },
+		{ 0.0001343221219735604, 0.9999932839028708, -1.999964416060562 },
+		{ 0.0002518235750754502, 0.999987408821351, -1.999885944861441 },
+		{ 0.0002676152193880308, 0.9999866192446508, -1.999872031019454 },
+		{ 0.0005017237841342633, 0.9999749140428208, -1.999572167150476 },
+		{ 0.000533180119191479, 0.9999733409964489, -1.999518502593481 },
+		{ 0.0009995865134723684, 0.999950020800628, -1.998351524795314 },
+		{ 0.001062270440374352, 0.9999468865690238, -1.998141646874484 },
+		{ 0.001991475013710255, 0.9999004262881495, -1.993557914211482 },
+		{ 0.002116353077888464, 0.9998941823595423, -1.99273176375808 },
+		{ 0.003967606074115671, 0.9998016231944685, -1.974665809336511 },
+		{ 0.004216298383728764, 0.9997891853600582, -1.971410163065374 },
+		{ 0.007903952660888414, 0.9996048035775102, -1.900460021215343 },
+		{ 0.008399498952933486, 0.9995800261872386, -1.887732930315328 },
+		{ 0.01574428654308782, 0.9992127863681836, -1.615396644262809 },
+		{ 0.01673122569841132, 0.9991634396464468, -1.567572946650261 },
+		{ 0.03135588222666415, 0.9984322060028668, -0.6202432970457787 },
+		{ 0.03332056096347175, 0.998333972703485, -0.4689178010733113 },
+		{ 0.06242335225569173, 0.9968788326866874, 1.600788418234177 },
+		{ 0.06242335225569173, 0.9968788326866874, 1.600788418234177 }
+	},
+	.c_bpre9600080040 = {
+		{ 3.370947685371451e-05, 0.9999983145287805, -1.999996496407056 },
+		{ 3.582352444722292e-05, 0.9999982088356427, -1.999996155541512 },
+		{ 6.581318365947676e-05, 0.9999967093425528, -1.999989779142235 },
+		{ 6.994024707813295e-05, 0.9999965029880669, -1.999988676360313 },
+		{ 0.0001284911108196522, 0.9999935754472986, -1.999967159499048 },
+		{ 0.0001365485508703225, 0.999993172573435, -1.999963339743521 },
+		{ 0.0002508634653683648, 0.9999874569427463, -1.999886767053571 },
+		{ 0.0002665918363736342, 0.9999866704093854, -1.999872956818075 },
+		{ 0.0004897683353376867, 0.9999755115851113, -1.999591722384215 },
+		{ 0.0005204821726229852, 0.999973975925051, -1.999540544356075 },
+		{ 0.0009561947182586305, 0.9999521902751615, -1.998489440980476 },
+		{ 0.001016157220933767, 0.9999491921655131, -1.998297258587406 },
+		{ 0.001866826767125623, 0.9999066597847489, -1.994333057034457 },
+		{ 0.001983901431939532, 0.9999008066775765, -1.993606636915494 },
+		{ 0.003644513384378062, 0.9998177747786936, -1.978601598575132 },
+		{ 0.003873035719408169, 0.9998063485651204, -1.975851440040904 },
+		{ 0.007114812069860614, 0.9996442599237843, -1.919182675803664 },
+		{ 0.007560875025950362, 0.9996219562569985, -1.90883319028451 },
+		{ 0.01388831595721038, 0.9993055843588781, -1.698445933216178 },
+		{ 0.01475892626285719, 0.9992620537751189, -1.660628411845805 },
+		{ 0.02710634594094322, 0.9986446920756651, -0.9332248522202125 },
+		{ 3.370947685371451e-05, 0.9999983145287805, -1.999996496407056 },
+		{ 3.730584486571042e-05, 0.9999981347138266, -1.999995907964957 },
+		{ 6.716117374827448e-05, 0.9999966419457973, -1.999989424960081 },
+		{ 7.432621433332337e-05, 0.9999962836909645, -1.999987444671229 },
+		{ 0.0001338080573102886, 0.9999933095999447, -1.999964662242647 },
+		{ 0.0001480835025999489, 0.9999925958253063, -1.99995750984415 },
+		{ 0.0002665918363736341, 0.9999866704093854, -1.999872956818075 },
+		{ 0.0002950336087234428, 0.9999852483678023, -1.999845978139349 },
+		{ 0.000531142272980882, 0.9999734429318731, -1.999522076081819 },
+		{ 0.0005878052376222509, 0.9999706097690669, -1.999417804281932 },
+		{ 0.001058204533860106, 0.9999470897800253, -1.998155635410601 },
+		{ 0.001171097719099686, 0.9999414451271469, -1.997747431343251 },
+		{ 0.002108260310752307, 0.9998945871240918, -1.992786826881491 },
+		{ 0.002333167700028781, 0.9998833416348053, -1.991179283169475 },
+		{ 0.004200190515283827, 0.9997899910417382, -1.971626971217497 },
+		{ 0.00464822246347582, 0.9997675892432307, -1.965293632191857 },
+		{ 0.008367363166414137, 0.9995816323074604, -1.888580480191033 },
+		{ 0.009259816675406204, 0.9995370094580138, -1.863877047382412 },
+		{ 0.01666722538864408, 0.9991666391065532, -1.570748657503407 },
+		{ 0.01844460359798101, 0.9990777708412637, -1.478782593812199 },
+		{ 0.01844460359798101, 0.9990777708412637, -1.478782593812199 },
+		{ 3.370947685371451e-05, 0.9999983145287805, -1.999996496407056 },
+		{ 3.964522700151808e-05, 0.9999980177388125, -1.999995502946821 },
+		{ 6.581318365947676e-05, 0.9999967093425528, -1.999989779142235 },
+		{ 7.740182624988709e-05, 0.9999961299089513, -1.999986544231035 },
+		{ 0.0001284911108196521, 0.9999935754472986, -1.999967159499048 },
+		{ 0.0001511163054345841, 0.9999924441873268, -1.999955906365242 },
+		{ 0.0002508634653683647, 0.9999874569427463, -1.999886767053571 },
+		{ 0.0002950336087234426, 0.9999852483678023, -1.999845978139349 },
+		{ 0.0004897683353376862, 0.9999755115851113, -1.999591722384215 },
+		{ 0.0005760082703135611, 0.9999711996186501, -1.99944035980045 },
+		{ 0.0009561947182586293, 0.9999521902751615, -1.998489440980476 },
+		{ 0.001124562316180496, 0.9999437718992861, -1.997920632644313 },
+		{ 0.001866826767125621, 0.9999066597847489, -1.994333057034457 },
+		{ 0.002195504649056777, 0.9998902253611414, -1.992182456534431 },
+		{ 0.003644513384385619, 0.9998177747786936, -1.978601598575132 },
+		{ 0.004286212021583494, 0.9997856902631914, -1.970460150340747 },
+		{ 0.00711481206986372, 0.9996442599237843, -1.919182675803664 },
+		{ 0.00836736316641605, 0.9995816323074604, -1.888580480191033 },
+		{ 0.01388831595721074, 0.9993055843588781, -1.698445933216178 },
+		{ 0.01633285258539773, 0.9991833575557885, -1.587174877822526 },
+		{ 0.02710634594094454, 0.9986446920756651, -0.9332248522202125 },
+		{ 3.370947685371451e-05, 0.9999983145287805, -1.999996496407056 },
+		{ 4.21313409284483e-05, 0.9999978934334449, -1.999995053352629 },
+		{ 6.716117374827448e-05, 0.9999966419457973, -1.999989424960081 },
+		{ 8.394045279352236e-05, 0.9999958029801032, -1.999984529382388 },
+		{ 0.0001338080573102886, 0.9999933095999447, -1.999964662242647 },
+		{ 0.0001672385305526494, 0.9999916380807023, -1.999946888176108 },
+		{ 0.000266591836373634, 0.9999866704093854, -1.999872956818075 },
+		{ 0.0003331958518663963, 0.9999833402074841, -1.999805710197795 },
+		{ 0.0005311422729808818, 0.9999734429318731, -1.999522076081819 },
+		{ 0.0006638376520274788, 0.999966808151855, -1.999261750658739 },
+		{ 0.001058204533860105, 0.9999470897800253, -1.998155635410601 },
+		{ 0.001322575233967663, 0.9999338712521824, -1.997135704228008 },
+		{ 0.002108260310752307, 0.9998945871240918, -1.992786826881491 },
+		{ 0.002634959360555445, 0.9998682524107044, -1.988769049016519 },
+		{ 0.004200190515283826, 0.9997899910417382, -1.971626971217497 },
+		{ 0.005249411950246552, 0.9997375298414204, -1.955803588140614 },
+		{ 0.008367363166411904, 0.9995816323074604, -1.888580480191033 },
+		{ 0.01045727993423337, 0.9994771360134191, -1.827002141285227 },
+		{ 0.01666722538864749, 0.9991666391065532, -1.570748657503407 },
+		{ 0.02082926614985646, 0.9989585402264649, -1.343726670764771 },
+		{ 0.02082926614985646, 0.9989585402264649, -1.343726670764771 },
+		{ 3.370947685371451e-05, 0.9999983145287805, -1.999996496407056 },
+		{ 4.387481294992384e-05, 0.9999978062626177, -1.999994726270459 },
+		{ 6.716117374827448e-05, 0.9999966419457973, -1.999989424960081 },
+		{ 8.741389980030871e-05, 0.9999956293096783, -1.999983403417728 },
+		{ 0.0001338080573102886, 0.9999933095999447, -1.999964662242647 },
+		{ 0.0001741619694926726, 0.9999912920994021, -1.999942762463359 },
+		{ 0.000266591836373634, 0.9999866704093854, -1.999872956818075 },
+		{ 0.000346985011778311, 0.9999826507868822, -1.999790015282968 },
+		{ 0.0005311422729808819, 0.9999734429318731, -1.999522076081819 },
+		{ 0.0006913075157501805, 0.9999654346515382, -1.999200821640072 },
+		{ 0.001058204533860105, 0.9999470897800253, -1.998155635410601 },
+		{ 0.001377303761906031, 0.9999311348151704, -1.996896653221984 },
+		{ 0.002108260310752307, 0.9998945871240918, -1.992786826881491 },
+		{ 0.002743977260606989, 0.9998628011715976, -1.987827014727118 },
+		{ 0.004200190515283824, 0.9997899910417382, -1.971626971217497 },
+		{ 0.005466594574154297, 0.999726670531183, -1.952096663044491 },
+		{ 0.00836736316640967, 0.9995816323074604, -1.888580480191033 },
+		{ 0.01088990477827811, 0.9994555049355074, -1.812643648240462 },
+		{ 0.01666722538864981, 0.9991666391065532, -1.570748657503407 },
+		{ 0.02169072900128628, 0.9989154709708894, -1.291863391613841 },
+		{ 0.02169072900128628, 0.9989154709708894, -1.291863391613841 },
+		{ 3.370947685371451e-05, 0.9999983145287805, -1.999996496407056 },
+		{ 4.569043821222247e-05, 0.9999977154838828, -1.999994375312108 },
+		{ 6.716117374827448e-05, 0.9999966419457973, -1.999989424960081 },
+		{ 9.103121565409932e-05, 0.9999954484398332, -1.999982189736339 },
+		{ 0.0001338080573102886, 0.9999933095999447, -1.999964662242647 },
+		{ 0.0001813656126391517, 0.9999909317193854, -1.999938302135063 },
+		{ 0.000266591836373634, 0.9999866704093854, -1.999872956818075 },
+		{ 0.0003613422667824409, 0.9999819328965863, -1.999773025701864 },
+		{ 0.0005311422729808818, 0.9999734429318731, -1.999522076081819 },
+		{ 0.0007199140985832385, 0.9999640042955984, -1.99913480460499 },
+		{ 0.001058204533860105, 0.9999470897800253, -1.998155635410601 },
+		{ 0.001434297214779619, 0.9999282851655257, -1.996637538789301 },
+		{ 0.002108260310752307, 0.9998945871240918, -1.992786826881491 },
+		{ 0.002857519534679505, 0.9998571241924752, -1.986805773674101 },
+		{ 0.004200190515283824, 0.9997899910417382, -1.971626971217497 },
+		{ 0.005692779106570418, 0.9997153614991803, -1.948079534262398 },
+		{ 0.00836736316640967, 0.9995816323074604, -1.888580480191033 },
+		{ 0.01134040418793763, 0.9994329798061848, -1.797114215105552 },
+		{ 0.01666722538864639, 0.9991666391065532, -1.570748657503407 },
+		{ 0.02258773133093854, 0.9988706139045541, -1.236214322880798 },
+		{ 0.02258773133093854, 0.9988706139045541, -1.236214322880798 },
+		{ 3.370947685371451e-05, 0.9999983145287805, -1.999996496407056 },
+		{ 4.855565991264033e-05, 0.9999975722226867, -1.999993799993577 },
+		{ 6.716117374827448e-05, 0.9999966419457973, -1.999989424960081 },
+		{ 9.673971649950789e-05, 0.9999951630143903, -1.999980189281797 },
+		{ 0.0001338080573102886, 0.9999933095999447, -1.999964662242647 },
+		{ 0.0001927391359552412, 0.9999903630473463, -1.999930925707221 },
+		{ 0.000266591836373634, 0.9999866704093854, -1.999872956818075 },
+		{ 0.000384002276272566, 0.9999807998990353, -1.999744870191486 },
+		{ 0.0005311422729808817, 0.9999734429318731, -1.999522076081819 },
+		{ 0.0007650591405393957, 0.9999617470959896, -1.999025300085984 },
+		{ 0.001058204533860105, 0.9999470897800253, -1.998155635410601 },
+		{ 0.001524236411162685, 0.9999237881937405, -1.996207524809116 },
+		{ 0.002108260310758873, 0.9998945871240918, -1.992786826881491 },
+		{ 0.003036717844223027, 0.9998481654287427, -1.985110789690726 },
+		{ 0.004200190515281572, 0.9997899910417382, -1.971626971217497 },
+		{ 0.006049713839841216, 0.9996975144760486, -1.941415589919807 },
+		{ 0.008367363166413818, 0.9995816323074604, -1.888580480191033 },
+		{ 0.01205134619403161, 0.999397432704873, -1.771420672283401 },
+		{ 0.0166672253886499, 0.9991666391065532, -1.570748657503407 },
+		{ 0.02400358726846445, 0.9987998306257302, -1.14518532955871 },
+		{ 0.02400358726846445, 0.9987998306257302, -1.14518532955871 },
+		{ 3.370947685371451e-05, 0.9999983145287805, -1.999996496407056 },
+		{ 5.056491386516881e-05, 0.9999974717574208, -1.999993380866898 },
+		{ 6.716117374827448e-05, 0.9999966419457973, -1.999989424960081 },
+		{ 0.0001007429516305733, 0.9999949628533844, -1.999978724213002 },
+		{ 0.0001338080573102886, 0.9999933095999447, -1.999964662242647 },
+		{ 0.0002007166566372486, 0.9999899642980761, -1.999925506520483 },
+		{ 0.000266591836373634, 0.9999866704093854, -1.999872956818075 },
+		{ 0.0003998931408611012, 0.9999800054352753, -1.999724147456979 },
+		{ 0.0005311422729808817, 0.9999734429318731, -1.999522076081819 },
+		{ 0.0007967175123026333, 0.9999601641714357, -1.998944618227766 },
+		{ 0.001058204533860105, 0.9999470897800253, -1.998155635410601 },
+		{ 0.001587308721602884, 0.9999206345745755, -1.995890551555765 },
+		{ 0.002108260310758873, 0.9998945871240918, -1.992786826881491 },
+		{ 0.003162352032917869, 0.9998418823991827, -1.983861193812195 },
+		{ 0.004200190515281571, 0.9997899910417382, -1.971626971217497 },
+		{ 0.006300041455037456, 0.9996849986038373, -1.936505947860272 },
+		{ 0.008367363166413818, 0.9995816323074604, -1.888580480191033 },
+		{ 0.01254988507178824, 0.999372505926493, -1.752546791304846 },
+		{ 0.01666722538864769, 0.9991666391065532, -1.570748657503407 },
+		{ 0.02499608180195734, 0.9987501987023906, -1.079144856646211 },
+		{ 0.02499608180195734, 0.9987501987023906, -1.079144856646211 },
+		{ 3.370947685371451e-05, 0.9999983145287805, -1.999996496407056 },
+		{ 5.48365205854594e-05, 0.9999972581787705, -1.999992446920564 },
+		{ 6.716117374827448e-05, 0.9999966419457973, -1.999989424960081 },
+		{ 0.0001092531985249242, 0.9999945373416194, -1.999975439312438 },
+		{ 0.0001338080573102886, 0.9999933095999447, -1.999964662242647 },
+		{ 0.0002176709607127182, 0.9999891164859891, -1.999913307990945 },
+		{ 0.000266591836373634, 0.9999866704093854, -1.999872956818075 },
+		{ 0.0004336725290105573, 0.9999783163735497, -1.999677405677147 },
+		{ 0.0005311422729808817, 0.9999734429318731, -1.999522076081819 },
+		{ 0.0008640197044416641, 0.9999567990436504, -1.998762445654057 },
+		{ 0.001058204533860105, 0.9999470897800253, -1.998155635410601 },
+		{ 0.001721395583483309, 0.9999139306104586, -1.995174518182853 },
+		{ 0.002108260310758873, 0.9998945871240918, -1.992786826881491 },
+		{ 0.00342948766378969, 0.9998285262868125, -1.981038341752126 },
+		{ 0.004200190515281572, 0.9997899910417382, -1.971626971217497 },
+		{ 0.006832124563640977, 0.9996583937971504, -1.925424861526693 },
+		{ 0.008367363166413818, 0.9995816323074604, -1.888580480191033 },
+		{ 0.01360967449205169, 0.9993195164102295, -1.710115954309578 },
+		{ 0.0166672253886499, 0.9991666391065532, -1.570748657503407 },
+		{ 0.02710634594094581, 0.9986446920756651, -0.9332248522202125 },
+		{ 0.02710634594094581, 0.9986446920756651, -0.9332248522202125 },
+		{ 3.370947685371451e-05, 0.9999983145287805, -1.999996496407056 },
+		{ 6.068665381382045e-05, 0.9999969656678865, -1.999991073072161 },
+		{ 6.716117374827448e-05, 0.9999966419457973, -1.999989424960081 },
+		{ 0.0001209089271585064, 0.999993954554992, -1.999970564190461 },
+		{ 0.0001338080573102886, 0.9999933095999447, -1.999964662242647 },
+		{ 0.0002408929331588382, 0.9999879554190145, -1.999895109542328 },
+		{ 0.000266591836373634, 0.9999866704093854, -1.999872956818075 },
+		{ 0.0004799394962099831, 0.9999760031015461, -1.999607465271867 },
+		{ 0.0005311422729808819, 0.9999734429318731, -1.999522076081819 },
+		{ 0.0009561947182586296, 0.9999521902751615, -1.998489440980476 },
+		{ 0.001058204533860106, 0.9999470897800253, -1.998155635410601 },
+		{ 0.001905056776792526, 0.9999047488294303, -1.994100699106646 },
+		{ 0.002108260310752307, 0.9998945871240918, -1.992786826881491 },
+		{ 0.003795310861840564, 0.9998102347227545, -1.976805339024926 },
+		{ 0.004200190515283826, 0.9997899910417382, -1.971626971217497 },
+		{ 0.007560875025953033, 0.9996219562569985, -1.90883319028451 },
+		{ 0.008367363166411904, 0.9995816323074604, -1.888580480191033 },
+		{ 0.01506109426876975, 0.9992469453141186, -1.647028981156265 },
+		{ 0.01666722538864749, 0.9991666391065532, -1.570748657503407 },
+		{ 0.02999578302539509, 0.9985002135527652, -0.7228124688371422 },
+		{ 0.02999578302539509, 0.9985002135527652, -0.7228124688371422 },
+		{ 3.370947685371451e-05, 0.9999983145287805, -1.999996496407056 },
+		{ 6.319798119197454e-05, 0.9999968401027443, -1.999990449727624 },
+		{ 6.716117374827448e-05, 0.9999966419457973, -1.999989424960081 },
+		{ 0.0001259121838785538, 0.9999937043908582, -1.999968338160172 },
+		{ 0.0001338080573102886, 0.9999933095999447, -1.999964662242647 },
+		{ 0.0002508634653683647, 0.9999874569427463, -1.999886767053571 },
+		{ 0.000266591836373634, 0.9999866704093854, -1.999872956818075 },
+		{ 0.0004997995017113512, 0.999975010088066, -1.999575341159141 },
+		{ 0.0005311422729808818, 0.9999734429318731, -1.999522076081819 },
+		{ 0.0009957622954067991, 0.9999502119046473, -1.998363915312901 },
+		{ 0.001058204533860105, 0.9999470897800253, -1.998155635410601 },
+		{ 0.001983901431939528, 0.9999008066775765, -1.993606636915494 },
+		{ 0.002108260310752306, 0.9998945871240918, -1.992786826881491 },
+		{ 0.003952366859349581, 0.9998023822623698, -1.974858168757502 },
+		{ 0.004200190515283824, 0.9997899910417382, -1.971626971217497 },
+		{ 0.00787369314626651, 0.9996063156904239, -1.901212584252791 },
+		{ 0.00836736316641605, 0.9995816323074604, -1.888580480191033 },
+		{ 0.01568409088055599, 0.9992157955130947, -1.618232090933391 },
+		{ 0.01666722538864981, 0.9991666391065532, -1.570748657503407 },
+		{ 0.03123606842477084, 0.9984381967286143, -0.6293569516071967 },
+		{ 0.03123606842477084, 0.9984381967286143, -0.6293569516071967 }
+	}
+};
@@ -0,0 +1,1647 @@
+#include "Scales.hpp"
+Scale gamma_notused = {
+	.name = "Gamma",
+	.description = "Like the Alpha scale, Wendy Carlos' Gamma scale is based on a fixed interval size whose multiples approximate justly intonated intervals. Here the step size is 35 cents which is 20 divisions of the perfect fifth. The notes are consequetively arranged starting at 120Hz. This scale is not used in SMR",
+	.scalename = {
+		"Gamma 0; 120Hz-",
+		"Gamma 1; 180Hz-",
+		"Gamma 2; 270Hz-",
+		"Gamma 3; 405Hz-",
+		"Gamma 4; 607.5Hz-",
+		"Gamma 5; 911.3Hz-",
+		"Gamma 6; 1367.0HZ-",
+		"Gamma 7; 2050.5Hz-",
+		"Gamma 8; 3075.8Hz-",
+		"Gamma 9; 4613.8Hz-",
+		"Gamma 10; 6920.8Hz-"},
+	.notedesc = {
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		""},
+	.c_maxq48000 = {
+		0.01570796326794896,
+		0.01602967634267187,
+		0.01635797838763122,
+		0.01669300435080455,
+		0.0170348919440241,
+		0.0173837816995831,
+		0.01773981702800127,
+		0.01810314427697346,
+		0.01847391279152563,
+		0.01885227497540287,
+		0.01923838635371465,
+		0.01963240563686319,
+		0.02003449478578104,
+		0.02044481907850492,
+		0.02086354717811284,
+		0.0212908512020529,
+		0.02172690679289174,
+		0.02217189319051222,
+		0.02262599330578954,
+		0.02308939379577655,
+		0.02356228514042872,
+		0.02356228514042872,
+		0.02404486172090064,
+		0.024537321899446,
+		0.0250398681009541,
+		0.02555270689615622,
+		0.02607604908653614,
+		0.02661010979097973,
+		0.02715510853419923,
+		0.02771126933696843,
+		0.02827882080820604,
+		0.028857996238945,
+		0.02944903369822634,
+		0.03005217613095703,
+		0.03066767145777204,
+		0.03129577267694176,
+		0.03193673796836638,
+		0.03259083079970037,
+		0.03325832003465035,
+		0.03393948004349107,
+		0.03463459081584482,
+		0.03534393807577066,
+		0.03534393807577066,
+		0.03606781339921079,
+		0.03680651433384236,
+		0.03756034452138388,
+		0.03832961382240663,
+		0.03911463844370231,
+		0.03991574106825928,
+		0.04073325098790082,
+		0.04156750423863997,
+		0.04241884373880654,
+		0.04328761943000307,
+		0.04417418842094774,
+		0.04507891513426325,
+		0.0460021714562721,
+		0.04694433688985987,
+		0.04790579871046908,
+		0.04888695212528823,
+		0.04988820043570089,
+		0.05090995520306213,
+		0.05195263641787003,
+		0.053016672672402,
+		0.053016672672402,
+		0.05410250133688699,
+		0.05521056873928568,
+		0.05634133034875278,
+		0.0574952509628569,
+		0.05867280489863467,
+		0.05987447618755803,
+		0.06110075877449447,
+		0.06235215672074215,
+		0.06362918441122349,
+		0.06493236676592215,
+		0.06626223945565043,
+		0.0676193491222359,
+		0.06900425360321746,
+		0.07041752216114357,
+		0.07185973571756654,
+		0.07333148709182938,
+		0.07483338124474308,
+		0.07636603552725474,
+		0.07793007993420858,
+		0.07952615736330419,
+		0.07952615736330419,
+		0.08115492387935852,
+		0.08281704898398012,
+		0.0845132158907667,
+		0.08624412180613875,
+		0.08801047821592509,
+		0.08981301117781784,
+		0.09165246161981723,
+		0.0935295856447886,
+		0.09544515484125726,
+		0.09739995660056866,
+		0.09939479444054397,
+		0.1014304883357649,
+		0.1035078750546228,
+		0.1056278085032707,
+		0.10779116007662,
+		0.1099988190165258,
+		0.1122516927773081,
+		0.1145507073987597,
+		0.1168968078867927,
+		0.1192909586018818,
+		0.1192909586018818,
+		0.1217341436554629,
+		0.1242273673144506,
+		0.1267716544140398,
+		0.1293680507789631,
+		0.1320176236533746,
+		0.1347214621395391,
+		0.1374806776455056,
+		0.1402964043419495,
+		0.1431697996283717,
+		0.1461020446088452,
+		0.1490943445775064,
+		0.1521479295139887,
+		0.1552640545890037,
+		0.1584440006802767,
+		0.1616890748990494,
+		0.1650006111273658,
+		0.1683799705663617,
+		0.1718285422957843,
+		0.1753477438449709,
+		0.1789390217755218,
+		0.1789390217755218,
+		0.1826038522759072,
+		0.1863437417682513,
+		0.1901602275275451,
+		0.1940548783135398,
+		0.1980292950155838,
+		0.2020851113106643,
+		0.2062239943349282,
+		0.2104476453689551,
+		0.2147578005370658,
+		0.219156231520953,
+		0.223644746287928,
+		0.2282251898340829,
+		0.2328994449426721,
+		0.2376694329580279,
+		0.2425371145753253,
+		0.2475044906465222,
+		0.2525736030028066,
+		0.2577465352938869,
+		0.2630254138444731,
+		0.2684124085282988,
+		0.2684124085282988,
+		0.2739097336600437,
+		0.2795196489055236,
+		0.2852444602105227,
+		0.2910865207486478,
+		0.2970482318885968,
+		0.3031320441812367,
+		0.3093404583668984,
+		0.3156760264033014,
+		0.3221413525145317,
+		0.3287390942615034,
+		0.3354719636343449,
+		0.3423427281671569,
+		0.3493542120756029,
+		0.3565092974177981,
+		0.3638109252789739,
+		0.3712620969804066,
+		0.3788658753131043,
+		0.3866253857967623,
+		0.3945438179645024,
+		0.4026244266739248,
+		0.4026244266739248,
+		0.4108705334450117,
+		0.4192855278254318,
+		0.4278728687838087,
+		0.436636086131523,
+		0.445578781973636,
+		0.4547046321895274,
+		0.4640173879438604,
+		0.4735208772284902,
+		0.4832190064359541,
+		0.4931157619651869,
+		0.5032152118601232,
+		0.5135215074818597,
+		0.5240388852150649,
+		0.5347716682093377,
+		0.5457242681562301,
+		0.5569011871026656,
+		0.5683070193014971,
+		0.5799464530999675,
+		0.5918242728668452,
+		0.6039453609590321,
+		0.6039453609590321,
+		0.6163146997284458,
+		0.6289373735700083,
+		0.641818571011577,
+		0.6549635868466795,
+		0.66837782431093,
+		0.6820667973030188,
+		0.6960361326511917,
+		0.710291572426147,
+		0.7248389763013041,
+		0.7396843239614115,
+		0.7548337175604859,
+		0.7702933842300921,
+		0.7860696786389938,
+		0.80216908560523,
+		0.8185982227616871,
+		0.8353638432762657,
+		0.8524728386277582,
+		0.8699322414385793,
+		0.8877492283655127,
+		0.9059311230496636,
+		0.9059311230496636,
+		0.9244853991268281,
+		0.9434196832995185,
+		0.9627417584719054,
+		0.982459566948967,
+		1.00258121370116,
+		1.023114969695952,
+		1.044069275297591,
+		1.065452743736499,
+		1.087274164649726,
+		1.109542507693918,
+		1.132266926232272,
+		1.155456761097019,
+		1.179121544428947,
+		1.203271003595577,
+		1.227915065189579,
+		1.253063859109079,
+		1.278727722721537,
+		1.304917205112902,
+		1.3316430714238,
+		1.358916307274519
+	},
+	.c_maxq96000 = {
+		0.007853981633974482,
+		0.008014838171335937,
+		0.008178989193815612,
+		0.008346502175402273,
+		0.008517445972012051,
+		0.00869189084979155,
+		0.008869908514000633,
+		0.009051572138486728,
+		0.009236956395762816,
+		0.009426137487701434,
+		0.009619193176857326,
+		0.009816202818431593,
+		0.01001724739289052,
+		0.01022240953925246,
+		0.01043177358905642,
+		0.01064542560102645,
+		0.01086345339644587,
+		0.01108594659525611,
+		0.01131299665289477,
+		0.01154469689788827,
+		0.01178114257021436,
+		0.01178114257021436,
+		0.01202243086045032,
+		0.012268660949723,
+		0.01251993405047705,
+		0.01277635344807811,
+		0.01303802454326807,
+		0.01330505489548987,
+		0.01357755426709962,
+		0.01385563466848422,
+		0.01413941040410302,
+		0.0144289981194725,
+		0.01472451684911317,
+		0.01502608806547851,
+		0.01533383572888602,
+		0.01564788633847088,
+		0.01596836898418319,
+		0.01629541539985018,
+		0.01662916001732517,
+		0.01696974002174554,
+		0.01731729540792241,
+		0.01767196903788533,
+		0.01767196903788533,
+		0.0180339066996054,
+		0.01840325716692118,
+		0.01878017226069194,
+		0.01916480691120332,
+		0.01955731922185116,
+		0.01995787053412964,
+		0.02036662549395041,
+		0.02078375211931998,
+		0.02120942186940327,
+		0.02164380971500153,
+		0.02208709421047387,
+		0.02253945756713163,
+		0.02300108572813605,
+		0.02347216844492993,
+		0.02395289935523454,
+		0.02444347606264411,
+		0.02494410021785045,
+		0.02545497760153106,
+		0.02597631820893501,
+		0.026508336336201,
+		0.026508336336201,
+		0.0270512506684435,
+		0.02760528436964284,
+		0.02817066517437639,
+		0.02874762548142845,
+		0.02933640244931733,
+		0.02993723809377901,
+		0.03055037938724723,
+		0.03117607836037107,
+		0.03181459220561175,
+		0.03246618338296108,
+		0.03313111972782522,
+		0.03380967456111795,
+		0.03450212680160873,
+		0.03520876108057178,
+		0.03592986785878327,
+		0.03666574354591469,
+		0.03741669062237154,
+		0.03818301776362737,
+		0.03896503996710429,
+		0.0397630786816521,
+		0.0397630786816521,
+		0.04057746193967926,
+		0.04140852449199006,
+		0.04225660794538335,
+		0.04312206090306937,
+		0.04400523910796254,
+		0.04490650558890892,
+		0.04582623080990861,
+		0.0467647928223943,
+		0.04772257742062863,
+		0.04869997830028433,
+		0.04969739722027199,
+		0.05071524416788246,
+		0.05175393752731142,
+		0.05281390425163537,
+		0.05389558003831001,
+		0.05499940950826288,
+		0.05612584638865405,
+		0.05727535369937985,
+		0.05844840394339634,
+		0.05964547930094088,
+		0.05964547930094088,
+		0.06086707182773146,
+		0.06211368365722528,
+		0.06338582720701991,
+		0.06468402538948154,
+		0.06600881182668729,
+		0.06736073106976953,
+		0.06874033882275278,
+		0.07014820217097475,
+		0.07158489981418584,
+		0.07305102230442261,
+		0.07454717228875321,
+		0.07607396475699436,
+		0.07763202729450186,
+		0.07922200034013835,
+		0.08084453744952472,
+		0.0825003055636829,
+		0.08418998528318083,
+		0.08591427114789213,
+		0.08767387192248544,
+		0.08946951088776092,
+		0.08946951088776092,
+		0.09130192613795361,
+		0.09317187088412567,
+		0.09508011376377253,
+		0.09702743915676992,
+		0.09901464750779189,
+		0.1010425556553321,
+		0.1031119971674641,
+		0.1052238226844776,
+		0.1073789002685329,
+		0.1095781157604765,
+		0.111822373143964,
+		0.1141125949170414,
+		0.1164497224713361,
+		0.118834716479014,
+		0.1212685572876626,
+		0.1237522453232611,
+		0.1262868015014033,
+		0.1288732676469434,
+		0.1315127069222366,
+		0.1342062042641494,
+		0.1342062042641494,
+		0.1369548668300219,
+		0.1397598244527618,
+		0.1426222301052613,
+		0.1455432603743239,
+		0.1485241159442984,
+		0.1515660220906184,
+		0.1546702291834492,
+		0.1578380132016507,
+		0.1610706762572658,
+		0.1643695471307517,
+		0.1677359818171724,
+		0.1711713640835784,
+		0.1746771060378015,
+		0.178254648708899,
+		0.181905462639487,
+		0.1856310484902033,
+		0.1894329376565521,
+		0.1933126928983811,
+		0.1972719089822512,
+		0.2013122133369624,
+		0.2013122133369624,
+		0.2054352667225058,
+		0.2096427639127159,
+		0.2139364343919044,
+		0.2183180430657615,
+		0.222789390986818,
+		0.2273523160947637,
+		0.2320086939719302,
+		0.2367604386142451,
+		0.2416095032179771,
+		0.2465578809825934,
+		0.2516076059300616,
+		0.2567607537409298,
+		0.2620194426075325,
+		0.2673858341046689,
+		0.272862134078115,
+		0.2784505935513328,
+		0.2841535096507485,
+		0.2899732265499838,
+		0.2959121364334226,
+		0.301972680479516,
+		0.301972680479516,
+		0.3081573498642229,
+		0.3144686867850042,
+		0.3209092855057885,
+		0.3274817934233398,
+		0.334188912155465,
+		0.3410333986515094,
+		0.3480180663255958,
+		0.3551457862130735,
+		0.3624194881506521,
+		0.3698421619807057,
+		0.3774168587802429,
+		0.385146692115046,
+		0.3930348393194969,
+		0.401084542802615,
+		0.4092991113808436,
+		0.4176819216381328,
+		0.4262364193138791,
+		0.4349661207192896,
+		0.4438746141827564,
+		0.4529655615248318,
+		0.4529655615248318,
+		0.4622426995634141,
+		0.4717098416497593,
+		0.4813708792359527,
+		0.4912297834744835,
+		0.5012906068505799,
+		0.5115574848479761,
+		0.5220346376487955,
+		0.5327263718682493,
+		0.5436370823248631,
+		0.5547712538469588,
+		0.5661334631161362,
+		0.5777283805485095,
+		0.5895607722144736,
+		0.6016355017977887,
+		0.6139575325947897,
+		0.6265319295545395,
+		0.6393638613607683,
+		0.6524586025564511,
+		0.6658215357118999,
+		0.6794581536372596
+	},
+	.c_bpre4800022 = {
+		{ 0.007823219707438548, 0.9921767802925616, -1.991931010387075 },
+		{ 0.007982824026899876, 0.9920171759734662, -1.991761255299925 },
+		{ 0.008145648512581776, 0.9918543514876801, -1.991587862726166 },
+		{ 0.008311756476611641, 0.9916882435234925, -1.991410752329497 },
+		{ 0.008481276049888489, 0.9915187239501126, -1.991229773922869 },
+		{ 0.008654205473685207, 0.9913457945266917, -1.991044915273918 },
+		{ 0.008830672696394776, 0.9911693273037904, -1.990856024937506 },
+		{ 0.009010740678678051, 0.9909892593214247, -1.990663020137649 },
+		{ 0.009194407446730991, 0.9908055925535969, -1.990465887154036 },
+		{ 0.009381865494106939, 0.9906181345060807, -1.990264402787644 },
+		{ 0.009573047833623475, 0.990426952167081, -1.9900586218189 },
+		{ 0.009768211536164672, 0.9902317884645985, -1.989848249522999 },
+		{ 0.00996722463835438, 0.9900327753618867, -1.989633409455005 },
+		{ 0.01017034394138874, 0.9898296560586365, -1.989413805006875 },
+		{ 0.01037756690142417, 0.9896224330987642, -1.989189418513706 },
+		{ 0.01058895567963101, 0.9894110443204166, -1.988960161673867 },
+		{ 0.01080463707390762, 0.9891953629264582, -1.98872587505899 },
+		{ 0.01102473771269635, 0.9889752622874429, -1.988486398079594 },
+		{ 0.01124925462564733, 0.988750745374415, -1.988241710119574 },
+		{ 0.01147831417962135, 0.9885216858203801, -1.987991648775535 },
+		{ 0.01171204256075157, 0.9882879574397131, -1.987736050389226 },
+		{ 0.01171204256075157, 0.9882879574397131, -1.987736050389226 },
+		{ 0.01195043643064309, 0.9880495635694851, -1.987474891818237 },
+		{ 0.01219368634280248, 0.987806313657502, -1.987207936419007 },
+		{ 0.01244191795281557, 0.9875580820478602, -1.986935016872447 },
+		{ 0.01269506285468369, 0.9873049371455582, -1.986656178182727 },
+		{ 0.01295337564731474, 0.9870466243529893, -1.986371108500218 },
+		{ 0.01321691682423959, 0.9867830831759394, -1.986079708005075 },
+		{ 0.01348581129578068, 0.9865141887043785, -1.985781804231478 },
+		{ 0.01376011919656065, 0.9862398808040446, -1.985477294879509 },
+		{ 0.01403990049929503, 0.9859600995008907, -1.985166076547681 },
+		{ 0.01432540855230442, 0.9856745914477473, -1.984847828754187 },
+		{ 0.01461663833400932, 0.9853833616659956, -1.98452251675278 },
+		{ 0.01491377814478728, 0.9850862218553974, -1.984189888361478 },
+		{ 0.0152168870392088, 0.9847831129609272, -1.983849833851633 },
+		{ 0.01552608831906172, 0.9844739116809567, -1.983502169681247 },
+		{ 0.01584156942597528, 0.9841584305742083, -1.983146637754751 },
+		{ 0.01616338865151234, 0.983836611348809, -1.982783123097953 },
+		{ 0.01649166845177324, 0.9835083315482728, -1.982411436359098 },
+		{ 0.01682659533541988, 0.9831734046650248, -1.982031313023184 },
+		{ 0.01716822676100871, 0.982831773239083, -1.981642632407425 },
+		{ 0.01751674857068064, 0.9824832514293983, -1.981245125420448 },
+		{ 0.01751674857068064, 0.9824832514293983, -1.981245125420448 },
+		{ 0.01787228190910162, 0.9821277180909753, -1.980838593706819 },
+		{ 0.01823494758676993, 0.981765052413236, -1.980422836620083 },
+		{ 0.01860493030318483, 0.9813950696968347, -1.979997577235448 },
+		{ 0.01898235009899604, 0.9810176499011853, -1.979562609630005 },
+		{ 0.01936732664963151, 0.9806326733504204, -1.979117725385848 },
+		{ 0.01976004341376024, 0.9802399565863079, -1.978662639078451 },
+		{ 0.02016061923040406, 0.9798393807696182, -1.978197136567362 },
+		{ 0.02056923664598992, 0.9794307633542002, -1.97772092618958 },
+		{ 0.02098607769037268, 0.9790139223096418, -1.977233712754264 },
+		{ 0.02141125981471875, 0.9785887401852859, -1.976735272635878 },
+		{ 0.02184496405604813, 0.978155035943957, -1.976225303863675 },
+		{ 0.02228737089194054, 0.9777126291083718, -1.97570350064556 },
+		{ 0.0227385962609951, 0.9772614037391343, -1.975169629055018 },
+		{ 0.0231988195622888, 0.9768011804378561, -1.974623375951992 },
+		{ 0.02366828348837566, 0.9763317165117917, -1.974064347849869 },
+		{ 0.02414716611345098, 0.9758528338866022, -1.973492222586924 },
+		{ 0.02463558102974064, 0.9753644189703264, -1.972906750268476 },
+		{ 0.02513370510160284, 0.9748662948986199, -1.97230760051917 },
+		{ 0.02564184205880124, 0.9743581579412099, -1.971694284153042 },
+		{ 0.02616010345236566, 0.9738398965478985, -1.971066537418567 },
+		{ 0.02616010345236566, 0.9738398965478985, -1.971066537418567 },
+		{ 0.02668866395055396, 0.9733113360495862, -1.970424015042691 },
+		{ 0.02722776115303644, 0.9727722388470919, -1.969766288938884 },
+		{ 0.02777756812585678, 0.972222431874147, -1.969093002978632 },
+		{ 0.02833832074960433, 0.9716616792505504, -1.968403717436586 },
+		{ 0.02891025395292446, 0.9710897460471275, -1.967697986151067 },
+		{ 0.02949353816704678, 0.970506461833058, -1.966975435182454 },
+		{ 0.03008840645175291, 0.9699115935484365, -1.966235605751561 },
+		{ 0.03069509083533311, 0.9693049091648313, -1.965478032119266 },
+		{ 0.03131382228546262, 0.9686861777145653, -1.964702241398741 },
+		{ 0.03194483067955573, 0.9680551693205133, -1.963907753361905 },
+		{ 0.03258828145668763, 0.9674117185433627, -1.963094160474479 },
+		{ 0.03324452889835609, 0.9667554711016939, -1.962260807072596 },
+		{ 0.03391373606711852, 0.96608626393299, -1.96140726966465 },
+		{ 0.03459612816956877, 0.9654038718304876, -1.960533036681632 },
+		{ 0.03529205544544464, 0.964707944554558, -1.959637425327726 },
+		{ 0.03600167720244888, 0.9639983227976311, -1.958719986994767 },
+		{ 0.03672534075178849, 0.963274659248217, -1.95778001928809 },
+		{ 0.0374632656707684, 0.9625367343294194, -1.956816972990934 },
+		{ 0.03821567013754398, 0.9617843298624575, -1.955830289590049 },
+		{ 0.03898289669516868, 0.961017103304838, -1.954819234870241 },
+		{ 0.03898289669516868, 0.961017103304838, -1.954819234870241 },
+		{ 0.03976522316056386, 0.9602347768394381, -1.953783145529953 },
+		{ 0.04056292562575211, 0.9594370743743471, -1.952721346808577 },
+		{ 0.04137621566874634, 0.9586237843313878, -1.9516332363562 },
+		{ 0.04220555401546574, 0.9577944459846859, -1.950517863138057 },
+		{ 0.04305108570572379, 0.9569489142944464, -1.949374683832751 },
+		{ 0.04391314202841953, 0.9560868579715942, -1.948202889592459 },
+		{ 0.04479205207691019, 0.9552079479231287, -1.947001657063543 },
+		{ 0.04568814268664025, 0.9543118573134755, -1.945770148004769 },
+		{ 0.04660173837319207, 0.9533982616268599, -1.944507508911088 },
+		{ 0.04753316126932904, 0.9524668387306849, -1.943212870621562 },
+		{ 0.04848266878351132, 0.9515173312165481, -1.941885435250294 },
+		{ 0.04945070270446385, 0.9505492972955505, -1.940524126951939 },
+		{ 0.05043751528664708, 0.9495624847133572, -1.939128114147985 },
+		{ 0.05144348055980832, 0.9485565194401916, -1.93769637250693 },
+		{ 0.05246896957100572, 0.947531030429018, -1.936227858246428 },
+		{ 0.05351428835526068, 0.9464857116447433, -1.934721597195683 },
+		{ 0.0545798638341986, 0.945420136165834, -1.933176416610317 },
+		{ 0.05566599580784657, 0.9443340041921554, -1.931591301949643 },
+		{ 0.05677310451681412, 0.9432268954832022, -1.929965037242625 },
+		{ 0.05790154484998232, 0.9420984551500414, -1.928296474145497 },
+		{ 0.05790154484998232, 0.9420984551500414, -1.928296474145497 },
+		{ 0.05905166820422295, 0.9409483317958455, -1.926584441887587 },
+		{ 0.06022394541156522, 0.939776054588452, -1.924827561784069 },
+		{ 0.06141872014766744, 0.9385812798523377, -1.923024613562881 },
+		{ 0.0626363936583117, 0.9373636063416946, -1.921174259347899 },
+		{ 0.06387736299201364, 0.9361226370080494, -1.919275134526673 },
+		{ 0.065142326829684, 0.9348576731775808, -1.917325373901845 },
+		{ 0.06643124450874503, 0.9335687555032484, -1.915324215627854 },
+		{ 0.0677446223460455, 0.9322553776631793, -1.913270022976055 },
+		{ 0.06908296134731007, 0.9309170386577162, -1.91116112552212 },
+		{ 0.07044675704714334, 0.9295532429559067, -1.908995818328981 },
+		{ 0.07183649936002827, 0.9281635006442532, -1.906772361152503 },
+		{ 0.07325206587648805, 0.9267479341325527, -1.904489959416483 },
+		{ 0.07469514885719783, 0.9253048511428019, -1.902144842449532 },
+		{ 0.07616500834613514, 0.9238349916576212, -1.899737129263734 },
+		{ 0.07766271685155973, 0.9223372831535626, -1.897263948754027 },
+		{ 0.07918873394827754, 0.9208112660530414, -1.894723372259958 },
+		{ 0.08074351267129565, 0.9192564873299395, -1.892113430955003 },
+		{ 0.08232689871715047, 0.9176731012871951, -1.88943313603284 },
+		{ 0.08394053379879353, 0.9160594662025745, -1.886678400923628 },
+		{ 0.08558365018530739, 0.9144163498190133, -1.883849180683185 },
+		{ 0.08558365018530739, 0.9144163498190133, -1.883849180683185 },
+		{ 0.08725787111157214, 0.9127421288885911, -1.880941275210427 },
+		{ 0.0889630148377812, 0.9110369851628367, -1.87795353100455 },
+		{ 0.09070008675971564, 0.9092999132431226, -1.874882665058363 },
+		{ 0.09246889196814236, 0.9075311080318593, -1.871727447418954 },
+		{ 0.09427041787124832, 0.9057295821306157, -1.868484487805654 },
+		{ 0.09610563900283105, 0.9038943610010585, -1.86515031792263 },
+		{ 0.09797433590105908, 0.9020256641060247, -1.861723564896218 },
+		{ 0.09987687453440265, 0.9001231254663756, -1.858201742558452 },
+		{ 0.1018147879088691, 0.8981852120916085, -1.854580107428608 },
+		{ 0.1037878300847884, 0.8962121699152351, -1.850857136045031 },
+		{ 0.1057969215577507, 0.8942030784422492, -1.84702904519466 },
+		{ 0.1078423841754343, 0.8921576158257273, -1.843093094609754 },
+		{ 0.1099251126359891, 0.8900748873641472, -1.83904535291433 },
+		{ 0.1120454050524028, 0.8879545949477399, -1.834882946423888 },
+		{ 0.1142041290854746, 0.8857958709168126, -1.830601790948765 },
+		{ 0.1164015579478173, 0.883598442058633, -1.826198875416818 },
+		{ 0.1186379541285955, 0.8813620458714143, -1.821671132472602 },
+		{ 0.1209147199787153, 0.8790852800218572, -1.817013071533802 },
+		{ 0.1232320869445869, 0.8767679130590447, -1.812221454973305 },
+		{ 0.1255902749108156, 0.8744097250891985, -1.807292986746129 },
+		{ 0.1255902749108156, 0.8744097250891985, -1.807292986746129 },
+		{ 0.1279906335099708, 0.8720093664933676, -1.802221887795357 },
+		{ 0.1304327802656186, 0.869567219736211, -1.797005907945553 },
+		{ 0.1329185968322848, 0.8670814031695279, -1.791637848273021 },
+		{ 0.1354476691931886, 0.8645523308085172, -1.78611529857577 },
+		{ 0.1380207053087244, 0.8619792946916582, -1.780433323415645 },
+		{ 0.1406389556605913, 0.8593610443400643, -1.774585622430259 },
+		{ 0.1433025219525381, 0.8566974780492848, -1.768568298273561 },
+		{ 0.1460120508916622, 0.8539879491099184, -1.762376108028136 },
+		{ 0.1487681678888765, 0.8512318321114807, -1.756003705103555 },
+		{ 0.1515714766025091, 0.8484285233980414, -1.749445638879442 },
+		{ 0.1544231119072384, 0.8455768880944381, -1.742695036529451 },
+		{ 0.1573230753603221, 0.8426769246429455, -1.735747534038968 },
+		{ 0.1602719025266391, 0.8397280974733918, -1.728597367472748 },
+		{ 0.1632706530549924, 0.8367293469450381, -1.721237316663129 },
+		{ 0.1663198089440009, 0.8336801910560945, -1.713661375129968 },
+		{ 0.1694198275403909, 0.830580172461685, -1.70586343296847 },
+		{ 0.1725716826355531, 0.8274283173651696, -1.697835889890759 },
+		{ 0.1757757746533234, 0.8242242253467001, -1.689572395973989 },
+		{ 0.1790324778422545, 0.8209675221589432, -1.681066500908287 },
+		{ 0.1823426750042621, 0.8176573249982846, -1.672310231155634 },
+		{ 0.1823426750042621, 0.8176573249982846, -1.672310231155634 },
+		{ 0.1857072131139162, 0.8142927868861007, -1.663295466839593 },
+		{ 0.1891263718518789, 0.8108736281511459, -1.654015392771591 },
+		{ 0.1926004026185543, 0.8073995973820625, -1.644463101357908 },
+		{ 0.1961300543110036, 0.8038699456912582, -1.634630120531327 },
+		{ 0.1997165611670254, 0.8002834388331594, -1.624506352707103 },
+		{ 0.2033600659329492, 0.7966399340678917, -1.614084516486168 },
+		{ 0.2070606809058762, 0.7929393190945203, -1.603357251861626 },
+		{ 0.2108195206358977, 0.7891804793653019, -1.592314069871699 },
+		{ 0.2146371345416452, 0.7853628654585652, -1.580945848013789 },
+		{ 0.2185140300035529, 0.78148596999762, -1.569243347346408 },
+		{ 0.2224501627548117, 0.7775498372453208, -1.557198786330573 },
+		{ 0.2264469744599761, 0.7735530255426057, -1.544799589509859 },
+		{ 0.2305038271621573, 0.769496172838401, -1.53203935683315 },
+		{ 0.2346220632929375, 0.7653779367094834, -1.518905274163088 },
+		{ 0.2388024600961669, 0.7611975399053463, -1.505385961239187 },
+		{ 0.2430442512743153, 0.756955748725993, -1.491474821871029 },
+		{ 0.2473491091265733, 0.7526508908752828, -1.4771570614772 },
+		{ 0.2517161758443755, 0.7482838241577758, -1.462425991901101 },
+		{ 0.2561470027643066, 0.7438529972376684, -1.44726661359627 },
+		{ 0.2606416058864957, 0.7393583941142284, -1.43166881526434 },
+		{ 0.2606416058864957, 0.7393583941142284, -1.43166881526434 },
+		{ 0.2652004326158369, 0.7347995673847775, -1.415620775520345 },
+		{ 0.269823390395928, 0.7301766096046144, -1.399112348144488 },
+		{ 0.2745108108981791, 0.7254891891025037, -1.382131683584677 },
+		{ 0.2792634341094082, 0.7207365658915421, -1.364665179666548 },
+		{ 0.284081454686046, 0.7159185453139731, -1.346700954151547 },
+		{ 0.2889650021812215, 0.711034997819835, -1.328227162389255 },
+		{ 0.2939136782428926, 0.7060863217587292, -1.309233808166669 },
+		{ 0.298928866669337, 0.7010711333310254, -1.289703837515425 },
+		{ 0.3040095670518126, 0.6959904329484765, -1.269629219074848 },
+		{ 0.3091565465806437, 0.6908434534196706, -1.248994870049495 },
+		{ 0.3143695797605009, 0.685630420241308, -1.227789461176283 },
+		{ 0.3196492628501519, 0.6803507371501547, -1.205998176073747 },
+		{ 0.3249947696099149, 0.675005230390085, -1.183611942000587 },
+		{ 0.3304065327752809, 0.6695934672247312, -1.160616401499453 },
+		{ 0.3358844518723583, 0.6641155481276455, -1.136999323857395 },
+		{ 0.3414283414100669, 0.6585716585899402, -1.11274881377441 },
+		{ 0.347037930407625, 0.6529620695928939, -1.087853361252667 },
+		{ 0.3527132856511979, 0.6472867143493138, -1.062299973772308 },
+		{ 0.3584539528273991, 0.6415460471739286, -1.036078043620616 },
+		{ 0.3642598070621886, 0.6357401929388102, -1.009175578410521 },
+		{ 0.3642598070621886, 0.6357401929388102, -1.009175578410521 },
+		{ 0.3701306213536611, 0.6298693786465355, -0.9815811676634302 },
+		{ 0.3760656577727495, 0.6239343422284735, -0.9532860149332234 },
+		{ 0.3820644956395937, 0.6179355043617198, -0.9242801182164682 },
+		{ 0.3881266114280502, 0.6118733885721297, -0.8945542813592351 },
+		{ 0.3942517751354807, 0.6057482248652911, -0.8640982131011166 },
+		{ 0.4004388528232018, 0.5995611471771768, -0.8329065565876799 },
+		{ 0.4066877888934862, 0.5933122111066742, -0.8009690607053289 },
+		{ 0.4129976238778368, 0.5870023761221821, -0.7682806065626763 },
+		{ 0.4193672958256787, 0.5806327041747142, -0.7348373553114602 },
+		{ 0.4257963925245614, 0.574203607475446, -0.7006328310591513 },
+		{ 0.4322836235086528, 0.5677163764915732, -0.66566606429728 },
+		{ 0.4388283321771937, 0.5611716678228209, -0.6299336773681394 },
+		{ 0.4454293647664151, 0.5545706352347144, -0.5934360519752471 },
+		{ 0.4520850926316174, 0.5479149073688918, -0.556177477795455 },
+		{ 0.4587952063618641, 0.5412047936381366, -0.5181561967494211 },
+		{ 0.4655578305087778, 0.5344421694915485, -0.4793807143133799 },
+		{ 0.4723720305232804, 0.5276279694767219, -0.4398558282494979 },
+		{ 0.4792360431548161, 0.5207639568455886, -0.3995928893585465 },
+		{ 0.4861486681557067, 0.5138513318448485, -0.3586019174564369 },
+		{ 0.4931098883932654, 0.5068901116835218, -0.3168878421400529 }
+	},
+	.c_bpre9600022 = {
+		{ 0.003919290271836576, 0.9960807097281631, -1.996019145897885 },
+		{ 0.003999409652233039, 0.9960005903479505, -1.99593648120959 },
+		{ 0.004081152157757395, 0.9959188478423732, -1.995852088589005 },
+		{ 0.004164549976559125, 0.9958354500234932, -1.995765931562283 },
+		{ 0.004249667863418628, 0.9957503321365815, -1.995677939825508 },
+		{ 0.004336505376281341, 0.9956634946239075, -1.995588110292907 },
+		{ 0.004425127223670101, 0.9955748727764229, -1.995496372342205 },
+		{ 0.004515565505254513, 0.9954844344947965, -1.995402688882068 },
+		{ 0.004607819724672541, 0.9953921802754916, -1.995307056449337 },
+		{ 0.004701987088342846, 0.9952980129117511, -1.995209370110185 },
+		{ 0.004798034484266629, 0.995201965516086, -1.995109659888678 },
+		{ 0.004896091624680049, 0.9951039083757026, -1.995007786597392 },
+		{ 0.00499609279076348, 0.9950039072093572, -1.994903813816177 },
+		{ 0.005098167627272179, 0.9949018323727405, -1.99479760188053 },
+		{ 0.005202315493961553, 0.994797684506133, -1.994689146326077 },
+		{ 0.005308568288452069, 0.994691431711572, -1.994578408659456 },
+		{ 0.005416990429610707, 0.9945830095705729, -1.994465316234647 },
+		{ 0.005527646293118747, 0.9944723537069509, -1.994349796111126 },
+		{ 0.005640535131106428, 0.9943594648689249, -1.994231843073704 },
+		{ 0.005755721253384362, 0.9942442787466165, -1.994111383720564 },
+		{ 0.005873268924303615, 0.9941267310759291, -1.993988344331196 },
+		{ 0.005873268924303615, 0.9941267310759291, -1.993988344331196 },
+		{ 0.005993177302410494, 0.9940068226976539, -1.993862719046844 },
+		{ 0.006115543105136514, 0.9938844568950164, -1.993734399522213 },
+		{ 0.006240430462585756, 0.993759569537753, -1.993603311105781 },
+		{ 0.006367805903352832, 0.9936321940967685, -1.993469481330197 },
+		{ 0.00649779851643713, 0.9935022014837155, -1.993332766661013 },
+		{ 0.006630439777944017, 0.9933695602221457, -1.993193125673313 },
+		{ 0.006765793629609302, 0.9932342063704706, -1.993050482403972 },
+		{ 0.006903891456903374, 0.9930961085434001, -1.992904794794832 },
+		{ 0.007044764603808523, 0.9929552353962845, -1.992756020505651 },
+		{ 0.007188541843066661, 0.992811458156959, -1.992604013803537 },
+		{ 0.007335221907218795, 0.9926647780927836, -1.992448765866536 },
+		{ 0.007484900943459973, 0.9925150990566326, -1.99229016438946 },
+		{ 0.007637610063344413, 0.9923623899367241, -1.992128165414978 },
+		{ 0.007793412801074787, 0.9922065871989345, -1.991962690150054 },
+		{ 0.007952405086315648, 0.9920475949137766, -1.991793624778075 },
+		{ 0.008114617837076614, 0.9918853821630849, -1.991620923998251 },
+		{ 0.008280114372901033, 0.9917198856271224, -1.991444507529759 },
+		{ 0.008448990386988976, 0.9915510096132345, -1.991264259912479 },
+		{ 0.008621276585485662, 0.9913787234145602, -1.991080134380349 },
+		{ 0.008797068492369518, 0.9912029315076699, -1.990892014299516 },
+		{ 0.008797068492369518, 0.9912029315076699, -1.990892014299516 },
+		{ 0.008976429094192089, 0.9910235709058465, -1.990699817079634 },
+		{ 0.009159421292592384, 0.9908405787074106, -1.990503459541119 },
+		{ 0.009346140321043165, 0.9906538596789671, -1.990302823039219 },
+		{ 0.009536648885480049, 0.990463351114611, -1.990097823037676 },
+		{ 0.009731009598721141, 0.9902689904013052, -1.98988837435739 },
+		{ 0.009929317378682717, 0.9900706826213512, -1.989674356166485 },
+		{ 0.0101316346252923, 0.989868365374719, -1.989455681811025 },
+		{ 0.01033805602417375, 0.9896619439759216, -1.989232228851393 },
+		{ 0.01054867612922563, 0.9894513238707814, -1.989003873938889 },
+		{ 0.01076355698686393, 0.9892364430131382, -1.988770527970977 },
+		{ 0.01098279289794373, 0.989017207102059, -1.988532065847141 },
+		{ 0.0112064780207846, 0.9887935219793726, -1.988288361479373 },
+		{ 0.01143467401541703, 0.9885653259846482, -1.988039323098668 },
+		{ 0.01166747476483753, 0.9883325252352351, -1.987784822713004 },
+		{ 0.01190500633207064, 0.9880949936680136, -1.987524695817906 },
+		{ 0.01214736226168375, 0.9878526377383431, -1.987258812085072 },
+		{ 0.01239460361424753, 0.9876053963857863, -1.986987075601618 },
+		{ 0.01264682362469743, 0.9873531763754145, -1.98670935390226 },
+		{ 0.01290417995961592, 0.9870958200403898, -1.986425441986116 },
+		{ 0.01316673315719821, 0.9868332668429346, -1.986135240334054 },
+		{ 0.01316673315719821, 0.9868332668429346, -1.986135240334054 },
+		{ 0.0134345758899479, 0.9865654241101227, -1.985838612603386 },
+		{ 0.01370783291817417, 0.9862921670818905, -1.98553538529526 },
+		{ 0.01398659650380836, 0.9860134034961935, -1.985225419234635 },
+		{ 0.01427099096638308, 0.9857290090336949, -1.984908537884857 },
+		{ 0.01456114038106053, 0.9854388596189655, -1.984584563028749 },
+		{ 0.01485713633353951, 0.9851428636665132, -1.984253350831721 },
+		{ 0.01515910241894964, 0.9848408975811455, -1.983914719770848 },
+		{ 0.01546716196732761, 0.984532838032755, -1.983568486498762 },
+		{ 0.01578143803597289, 0.9842185619640413, -1.983214465791828 },
+		{ 0.01610205340165227, 0.9838979465983826, -1.982852470496365 },
+		{ 0.01642909836488493, 0.98357090163514, -1.982482347945183 },
+		{ 0.01676275950224296, 0.9832372404977824, -1.982103834097537 },
+		{ 0.01710312650162411, 0.9828968734984306, -1.981716772078006 },
+		{ 0.01745032093515392, 0.9825496790648744, -1.981320966463476 },
+		{ 0.01780452833738094, 0.9821954716626206, -1.980916146057547 },
+		{ 0.01816583742591691, 0.9818341625741237, -1.980502147331561 },
+		{ 0.01853443297881754, 0.9814655670211856, -1.980078693901882 },
+		{ 0.01891043511347413, 0.981089564886621, -1.979645580370077 },
+		{ 0.01929396358416587, 0.9807060364158353, -1.979202598857484 },
+		{ 0.0196852019351991, 0.9803147980648044, -1.978749464526959 },
+		{ 0.0196852019351991, 0.9803147980648044, -1.978749464526959 },
+		{ 0.02008430115675969, 0.9799156988432416, -1.978285926510171 },
+		{ 0.02049141179147951, 0.9795085882085707, -1.977811730878239 },
+		{ 0.02090665188080528, 0.9790933481192629, -1.977326658041769 },
+		{ 0.02133026715621007, 0.9786697328438668, -1.976830335244736 },
+		{ 0.02176234263126129, 0.9782376573688248, -1.976322573641998 },
+		{ 0.02220305892706936, 0.9777969410729378, -1.975803068426426 },
+		{ 0.02265259609333871, 0.9773474039066811, -1.975271510891075 },
+		{ 0.02311113359125611, 0.9768888664088025, -1.974727588319771 },
+		{ 0.02357885027678333, 0.976421149723243, -1.974170983873672 },
+		{ 0.02405592438364023, 0.9759440756163669, -1.973601376477931 },
+		{ 0.02454250158374915, 0.9754574984162808, -1.973018479011746 },
+		{ 0.02503882267264771, 0.9749611773273593, -1.972421885080299 },
+		{ 0.02554503197256295, 0.974454968027439, -1.97181129839431 },
+		{ 0.02606133692095825, 0.973938663079042, -1.971186341111422 },
+		{ 0.02658794417318044, 0.9734120558268313, -1.970546630081045 },
+		{ 0.02712502774265036, 0.9728749722573516, -1.969891815586431 },
+		{ 0.02767282452571475, 0.9723271754743018, -1.969221464776647 },
+		{ 0.02823150689469587, 0.971768493105305, -1.968535216828271 },
+		{ 0.02880130998688743, 0.971198690013121, -1.96783262699049 },
+		{ 0.0293824362036208, 0.9706175637963912, -1.967113283331322 },
+		{ 0.0293824362036208, 0.9706175637963912, -1.967113283331322 },
+		{ 0.02997508702313309, 0.9700249129769015, -1.96637676769097 },
+		{ 0.03057952642393861, 0.9694204735760702, -1.965622576194153 },
+		{ 0.03119595384188678, 0.9688040461581162, -1.964850276912297 },
+		{ 0.03182459939239927, 0.968175400607604, -1.964059391224186 },
+		{ 0.03246569207702599, 0.9675343079230058, -1.963249433018065 },
+		{ 0.03311961796174452, 0.9668803820419467, -1.962419707322915 },
+		{ 0.03378638206064032, 0.9662136179454561, -1.961569992894936 },
+		{ 0.03446627316591278, 0.9655337268387777, -1.960699699755548 },
+		{ 0.03515957865936071, 0.9648404213431963, -1.959808228422481 },
+		{ 0.03586658446410354, 0.9641334155374486, -1.95889496964721 },
+		{ 0.03658757500224556, 0.9634124249999337, -1.95795930414283 },
+		{ 0.03732251811746889, 0.9626774818871338, -1.957001014065237 },
+		{ 0.03807232540964761, 0.961927674590352, -1.956018637399872 },
+		{ 0.03883664673795313, 0.9611633532639605, -1.955012348335341 },
+		{ 0.03961607513008161, 0.9603839248725288, -1.95398107300911 },
+		{ 0.04041088686263726, 0.9595891131380355, -1.952924137868614 },
+		{ 0.04122135644939819, 0.9587786435512318, -1.951840857630404 },
+		{ 0.04204744309389372, 0.9579525569083236, -1.950730957278789 },
+		{ 0.04289004487402973, 0.9571099551266689, -1.949592884464138 },
+		{ 0.04374880401915607, 0.9562511959830501, -1.948426763461333 },
+		{ 0.04374880401915607, 0.9562511959830501, -1.948426763461333 },
+		{ 0.04462461362643837, 0.9553753863736449, -1.947231008867462 },
+		{ 0.04551742542766474, 0.9544825745726511, -1.946005296430472 },
+		{ 0.04642781435260224, 0.9535721856488488, -1.94474843215621 },
+		{ 0.04735572849470295, 0.9526442715052978, -1.943460068149689 },
+		{ 0.04830173787654766, 0.9516982621244064, -1.942138978137536 },
+		{ 0.04926640903075668, 0.9507335909712344, -1.940783912825174 },
+		{ 0.05024968328558478, 0.9497503167180439, -1.939394480197522 },
+		{ 0.05125181135054645, 0.9487481886498522, -1.937969838804404 },
+		{ 0.05227366181415832, 0.9477263381860868, -1.936508241578509 },
+		{ 0.05331516864628481, 0.9466848313537275, -1.935009248910484 },
+		{ 0.05437688350894809, 0.9456231164910518, -1.933471514515805 },
+		{ 0.05545904491938495, 0.9445409550812115, -1.931894117700322 },
+		{ 0.05656219740567162, 0.9434378025943984, -1.930275665884941 },
+		{ 0.05768657287099979, 0.9423134271290736, -1.928615195723577 },
+		{ 0.05883270832726095, 0.9411672916739151, -1.926911266076316 },
+		{ 0.06000082869590051, 0.9399991713074182, -1.925162868847241 },
+		{ 0.06119115584086843, 0.9388088441591367, -1.923368976650174 },
+		{ 0.06240452218384512, 0.9375954778164498, -1.921527607966495 },
+		{ 0.06364114087838081, 0.9363588591234904, -1.919637679636951 },
+		{ 0.06490122174757115, 0.935098778252436, -1.917698087690199 },
+		{ 0.06490122174757115, 0.935098778252436, -1.917698087690199 },
+		{ 0.06618558241471187, 0.9338144175870106, -1.915706755969802 },
+		{ 0.06749411812340285, 0.9325058818775414, -1.913662999191644 },
+		{ 0.06882794115814196, 0.931172058842794, -1.911564196203843 },
+		{ 0.07018693770904792, 0.9298130622918335, -1.909409605012562 },
+		{ 0.07157159958815872, 0.9284284004120393, -1.907197497602933 },
+		{ 0.07298271626714822, 0.9270172837331914, -1.904925619854798 },
+		{ 0.07442046368367815, 0.9255795363172657, -1.902592655472167 },
+		{ 0.07588531604112829, 0.9241146839596903, -1.900196766514324 },
+		{ 0.07737774137454322, 0.9226222586256418, -1.897736076836201 },
+		{ 0.07889820139274774, 0.921101798607538, -1.895208671283868 },
+		{ 0.08044745223949433, 0.9195525477613761, -1.892612088461808 },
+		{ 0.08202564053246622, 0.9179743594692311, -1.889944832466026 },
+		{ 0.08363320800382383, 0.9163667919961919, -1.88720486619217 },
+		{ 0.08527088876268439, 0.9147291112373314, -1.884389593555583 },
+		{ 0.08693910879065476, 0.9130608912093949, -1.881496881645783 },
+		{ 0.08863828670515585, 0.9113617132959256, -1.878524553509198 },
+		{ 0.09036913126011199, 0.909630868740265, -1.875469859703036 },
+		{ 0.09213204410185424, 0.9078679558981582, -1.87233052172306 },
+		{ 0.09392741893498946, 0.9060725810656358, -1.869104214462748 },
+		{ 0.09575593726257857, 0.9042440627387522, -1.865788026391945 },
+		{ 0.09575593726257857, 0.9042440627387522, -1.865788026391945 },
+		{ 0.09761826986242426, 0.9023817301375847, -1.862378982263251 },
+		{ 0.09951478182687806, 0.9004852181747051, -1.858874588922832 },
+		{ 0.1014458294674257, 0.8985541705328971, -1.85527230323534 },
+		{ 0.1034120535668947, 0.8965879464342906, -1.851568976203655 },
+		{ 0.1054143759074898, 0.8945856240926073, -1.847760831396257 },
+		{ 0.1074531194009451, 0.8925468805994964, -1.843845133746245 },
+		{ 0.1095285972620181, 0.8904714027381904, -1.8398190948702 },
+		{ 0.1116416942673519, 0.8883583057332788, -1.835678727625179 },
+		{ 0.1137929895005519, 0.886207010499559, -1.831420531954182 },
+		{ 0.1159830488070224, 0.8840169511935956, -1.827040934338163 },
+		{ 0.1182121359163546, 0.8817878640837151, -1.822536872945434 },
+		{ 0.1204813671443856, 0.8795186328569768, -1.817903456976804 },
+		{ 0.122790690406284, 0.8772093095940109, -1.813138063995425 },
+		{ 0.1251411904157081, 0.8748588095855718, -1.808235631322271 },
+		{ 0.127533645402902, 0.8724663545978986, -1.803191585180129 },
+		{ 0.1299679610924039, 0.8700320389077593, -1.798003083716588 },
+		{ 0.132445453660938, 0.8675545463400459, -1.792664169592537 },
+		{ 0.1349659982660797, 0.8650340017350622, -1.787171846425844 },
+		{ 0.1375308717201184, 0.8624691282809306, -1.781519950935537 },
+		{ 0.1401404800122485, 0.8598595199881365, -1.775704068704778 },
+		{ 0.1401404800122485, 0.8598595199881365, -1.775704068704778 },
+		{ 0.1427954926715465, 0.8572045073287807, -1.76971906755418 },
+		{ 0.1454962787652, 0.8545037212350889, -1.763560353345688 },
+		{ 0.1482434684125494, 0.8517565315878146, -1.757222603070719 },
+		{ 0.1510379479089299, 0.8489620520915772, -1.750699737535707 },
+		{ 0.1538803008356585, 0.8461196991643518, -1.743986208940015 },
+		{ 0.1567710881267871, 0.8432289118737777, -1.737076364802596 },
+		{ 0.1597105726255567, 0.8402894273753116, -1.729965117335246 },
+		{ 0.1627000935562571, 0.8372999064439368, -1.722644597363878 },
+		{ 0.165739589247927, 0.8342604107522283, -1.715110166554359 },
+		{ 0.1688300694687096, 0.8311699305314593, -1.707354382758577 },
+		{ 0.1719719689287701, 0.8280280310722024, -1.699371039357387 },
+		{ 0.1751662366574205, 0.8248337633427446, -1.691152430287626 },
+		{ 0.1784129806343794, 0.8215870193656206, -1.682692815280785 },
+		{ 0.1817130899099505, 0.8182869100900559, -1.673984246097371 },
+		{ 0.1850671511543771, 0.8149328488456247, -1.665019345251072 },
+		{ 0.1884757190385895, 0.811524280961414, -1.655790615112264 },
+		{ 0.1919393156498455, 0.8080606843504352, -1.646290440010467 },
+		{ 0.19545869319912, 0.8045413068011572, -1.636510352534279 },
+		{ 0.1990343033732491, 0.8009656966274704, -1.626442490005226 },
+		{ 0.202666824383968, 0.797333175616574, -1.616078131169796 },
+		{ 0.202666824383968, 0.797333175616574, -1.616078131169796 },
+		{ 0.2063568946646319, 0.7936431053354749, -1.605408423433492 },
+		{ 0.2101048536499139, 0.7898951463507506, -1.594425149400453 },
+		{ 0.2139112617772749, 0.7860887382234398, -1.583119226277785 },
+		{ 0.2177766376718372, 0.7822233623282608, -1.571481454004178 },
+		{ 0.221701712153601, 0.7782982878468198, -1.559501738383031 },
+		{ 0.2256866608556605, 0.7743133391445459, -1.547171432141344 },
+		{ 0.2297323769581515, 0.7702676230419362, -1.534479428587341 },
+		{ 0.2338391969552566, 0.7661608030447538, -1.521416082972569 },
+		{ 0.2380074119951122, 0.7619925880051028, -1.507971669415808 },
+		{ 0.2422377632294943, 0.7577622367705097, -1.494134757195492 },
+		{ 0.2465304408993111, 0.7534695591008129, -1.479895447086174 },
+		{ 0.2508860782078545, 0.7491139217921536, -1.465242129543519 },
+		{ 0.2553050052311416, 0.744694994769479, -1.450163940690926 },
+		{ 0.2597872553323083, 0.7402127446679716, -1.434650810556543 },
+		{ 0.2643337756576451, 0.7356662243423553, -1.418689256126547 },
+		{ 0.2689444826203105, 0.7310555173798693, -1.402269124923533 },
+		{ 0.27361995520477, 0.7263800447952311, -1.38537769532536 },
+		{ 0.2783602305545611, 0.7216397694456622, -1.368003951737981 },
+		{ 0.2831657570648501, 0.7168342429354563, -1.350135159324791 },
+		{ 0.2880378439670248, 0.7119621560753927, -1.331755047735638 }
+	},
+	.c_bpre4800080040 = {
+		{ 0.0003926952264089372, 0.9999803652386795, -1.999733632624292 },
+		{ 0.0004007417925145703, 0.9999799630573478, -1.999723019379664 },
+		{ 0.000408948197180188, 0.9999795526951142, -1.999711976868768 },
+		{ 0.0004173210688953098, 0.9999791339883675, -1.999700487669259 },
+		{ 0.0004258678068290535, 0.9999787066098761, -1.999688529121312 },
+		{ 0.0004345918338079596, 0.9999782705596515, -1.99967608699653 },
+		{ 0.0004434912777358621, 0.9999778255104619, -1.999663137162933 },
+		{ 0.000452574849948595, 0.9999773712986992, -1.999649659342371 },
+		{ 0.000461844145922522, 0.9999769079243761, -1.999635637557683 },
+		{ 0.0004713035785144207, 0.9999764348966426, -1.999621040213502 },
+		{ 0.0004809580787680276, 0.9999759523791331, -1.999605854979632 },
+		{ 0.000490811787960146, 0.9999754597173791, -1.999590043066184 },
+		{ 0.0005008571654624792, 0.9999749572386371, -1.999573596104063 },
+		{ 0.000511114435078919, 0.999974444288439, -1.999556473094983 },
+		{ 0.0005215841794402264, 0.9999739208668016, -1.999538653419555 },
+		{ 0.0005322641818224836, 0.9999733868101212, -1.999520110300835 },
+		{ 0.0005431671192728065, 0.9999728417911746, -1.999500810234102 },
+		{ 0.0005542914655964603, 0.9999722854827388, -1.999480718349851 },
+		{ 0.0005656428023869508, 0.9999717178848334, -1.999459810540261 },
+		{ 0.0005772266095347335, 0.9999711386702377, -1.999438049793377 },
+		{ 0.0005890535029491753, 0.9999705475117318, -1.999415397619176 },
+		{ 0.0005890535029491753, 0.9999705475117318, -1.999415397619176 },
+		{ 0.0006011128453326269, 0.9999699444093375, -1.99939182691597 },
+		{ 0.000613425009572043, 0.9999693288722171, -1.999367290275292 },
+		{ 0.0006259939769223873, 0.999968700573155, -1.99934174488291 },
+		{ 0.0006388084329938566, 0.9999680596757946, -1.999315166815773 },
+		{ 0.0006518919343271758, 0.9999674055256824, -1.999287497127526 },
+		{ 0.0006652422565035473, 0.9999667379592263, -1.999258695416477 },
+		{ 0.0006788682962891517, 0.9999660566492143, -1.999228712765858 },
+		{ 0.0006927762319534375, 0.9999653614320555, -1.999197505822626 },
+		{ 0.0007069586108390934, 0.9999646521441602, -1.999165029916208 },
+		{ 0.0007214377947279764, 0.9999639281310839, -1.999131215877367 },
+		{ 0.0007362121814840348, 0.9999631893928577, -1.999096022793437 },
+		{ 0.0007512927157040196, 0.9999624354386599, -1.999059384831689 },
+		{ 0.0007666789991053246, 0.9999616661049057, -1.999021249779189 },
+		{ 0.0007823788608262419, 0.9999608810643944, -1.99898155552404 },
+		{ 0.000798404955087294, 0.9999600798263089, -1.998940229184914 },
+		{ 0.0008147580514566138, 0.9999592622270703, -1.998897212271457 },
+		{ 0.0008314415834664187, 0.9999584279394828, -1.998852435721888 },
+		{ 0.0008484741335251148, 0.9999575764727351, -1.998805818978022 },
+		{ 0.0008658474745279584, 0.9999567076632537, -1.998757296692218 },
+		{ 0.0008835802299482183, 0.9999558210202315, -1.998706782816752 },
+		{ 0.0008835802299482183, 0.9999558210202315, -1.998706782816752 },
+		{ 0.0009016762914349071, 0.9999549162164822, -1.99865419748572 },
+		{ 0.0009201415525466607, 0.9999539929248199, -1.998599458071288 },
+		{ 0.000938987069724828, 0.9999530506544457, -1.998542469113159 },
+		{ 0.0009582198983202739, 0.9999520890781789, -1.998483141625726 },
+		{ 0.0009778430442839391, 0.999951107868843, -1.99842138360397 },
+		{ 0.0009978698370192282, 0.999950106535646, -1.998357089332092 },
+		{ 0.001018305151761376, 0.9999490847514152, -1.998290159880528 },
+		{ 0.00103916102681116, 0.9999480420253658, -1.998220481984966 },
+		{ 0.001060442784182738, 0.9999469778667149, -1.998147938112557 },
+		{ 0.001082161069764754, 0.9999458919483, -1.998072417821953 },
+		{ 0.001104324455839094, 0.9999447837793447, -1.997993795339106 },
+		{ 0.001126945144298556, 0.9999436528690772, -1.997911940244167 },
+		{ 0.001150023244111955, 0.9999424988903438, -1.997826729533412 },
+		{ 0.001173574124443126, 0.9999413213523793, -1.997738023810671 },
+		{ 0.001197609338554592, 0.9999401196008082, -1.997645665934396 },
+		{ 0.001222137533364205, 0.9999388931448736, -1.997549505499689 },
+		{ 0.001247167394545075, 0.9999376416574379, -1.997449399943575 },
+		{ 0.001272708847541193, 0.9999363646477518, -1.997345188754562 },
+		{ 0.001298774134712293, 0.9999350612978436, -1.997236678248041 },
+		{ 0.001325376528686721, 0.9999337312805888, -1.997123708805421 },
+		{ 0.001325376528686721, 0.9999337312805888, -1.997123708805421 },
+		{ 0.001352519032072629, 0.9999323741052533, -1.997006101575117 },
+		{ 0.001380218689823165, 0.9999309891174937, -1.996883656914153 },
+		{ 0.001408483501933968, 0.9999295758265865, -1.996756182550906 },
+		{ 0.001437329692308265, 0.999928133578201, -1.996623464446446 },
+		{ 0.00146676606128999, 0.9999266617180114, -1.996485280593665 },
+		{ 0.001496805744592974, 0.9999251597553115, -1.996341416603468 },
+		{ 0.001527460820115532, 0.9999236270357883, -1.996191634761621 },
+		{ 0.001558743233515717, 0.9999220629051361, -1.996035688682482 },
+		{ 0.001590666047125541, 0.9999204667090559, -1.995873323052376 },
+		{ 0.001623244694353219, 0.9999188377932554, -1.995704273367777 },
+		{ 0.001656487065044488, 0.9999171756670616, -1.995528283165591 },
+		{ 0.00169041342824537, 0.9999154793489757, -1.995345034116417 },
+		{ 0.001725033916105167, 0.9999137483483402, -1.995154249674697 },
+		{ 0.001760360242449419, 0.9999119820108938, -1.99495562585639 },
+		{ 0.001796412921369575, 0.9999101793551648, -1.994748810183495 },
+		{ 0.001833202842188622, 0.9999083398905206, -1.994533494265489 },
+		{ 0.001870747334861865, 0.9999064626355083, -1.9943093008148 },
+		{ 0.001909062815365738, 0.9999045469359049, -1.994075878097452 },
+		{ 0.001948157263079099, 0.9999025921374968, -1.993832862456723 },
+		{ 0.001988054879045149, 0.9999005972588632, -1.993579836076851 },
+		{ 0.001988054879045149, 0.9999005972588632, -1.993579836076851 },
+		{ 0.002028770372809472, 0.9998985614822038, -1.993316386567543 },
+		{ 0.002070321014237802, 0.99989648398973, -1.99304208681532 },
+		{ 0.00211271855122628, 0.9998943641272725, -1.992756516823456 },
+		{ 0.002155989515370893, 0.9998922005862448, -1.992459151977986 },
+		{ 0.002200143869812547, 0.9998899928761111, -1.992149562048585 },
+		{ 0.002245199801093831, 0.9998877400155259, -1.991827233070554 },
+		{ 0.002291179856126826, 0.9998854410231597, -1.991491632255702 },
+		{ 0.002338102594676757, 0.9998830949176973, -1.991142207436476 },
+		{ 0.002385986071261993, 0.9998807007178406, -1.990778386499121 },
+		{ 0.002434851266752143, 0.999878257442306, -1.990399576805955 },
+		{ 0.002484715017712171, 0.9998757642734324, -1.990005190746745 },
+		{ 0.002535602061981902, 0.9998732199027615, -1.989594541110277 },
+		{ 0.00258752978203681, 0.9998706235126675, -1.989166995734033 },
+		{ 0.002640520834777899, 0.9998679739583347, -1.988721846131126 },
+		{ 0.002694598293090499, 0.9998652700949673, -1.988258357990935 },
+		{ 0.002749781202052153, 0.9998625109413933, -1.987775799325171 },
+		{ 0.002806096484026997, 0.9998596951892572, -1.987273354170966 },
+		{ 0.002863562866821697, 0.9998568218574305, -1.986750236284674 },
+		{ 0.002922207382317531, 0.9998538896376035, -1.986205571550383 },
+		{ 0.002982052491438614, 0.9998508973850926, -1.985638485019588 },
+		{ 0.002982052491438614, 0.9998508973850926, -1.985638485019588 },
+		{ 0.003043121459225623, 0.9998478439552396, -1.985048071187751 },
+		{ 0.003105442618169315, 0.999844727876211, -1.984433327960257 },
+		{ 0.003169039976319478, 0.9998415480034032, -1.983793282234739 },
+		{ 0.003233939477100997, 0.9998383030286381, -1.983126893712842 },
+		{ 0.003300167645702877, 0.9998349916437698, -1.982433085205114 },
+		{ 0.003367825594445657, 0.999831611722696, -1.981710564989709 },
+		{ 0.003436837149152485, 0.9998281631025149, -1.980958420528087 },
+		{ 0.003507193387332069, 0.9998246441479792, -1.980175388351019 },
+		{ 0.003578977149390855, 0.9998210532238774, -1.979360158102693 },
+		{ 0.003652251377455854, 0.9998173886950382, -1.978511371157508 },
+		{ 0.00372705698359288, 0.9998136489263293, -1.97762761921096 },
+		{ 0.003803396656263792, 0.9998098339185952, -1.976707841212037 },
+		{ 0.003881224701858157, 0.9998059387649116, -1.975749736498074 },
+		{ 0.003960729177422797, 0.999801965102137, -1.974752544138467 },
+		{ 0.004041849416824042, 0.9997979096593773, -1.973714244654099 },
+		{ 0.004124594947170144, 0.9997937708017185, -1.972633159854678 },
+		{ 0.004209072402766861, 0.9997895468942952, -1.97150755292163 },
+		{ 0.004295277468060803, 0.999785237938185, -1.970336076037103 },
+		{ 0.004383230878647176, 0.9997808390268254, -1.969115981066695 },
+		{ 0.004473000136837484, 0.9997763517972841, -1.967846253632329 },
+		{ 0.004473000136837484, 0.9997763517972841, -1.967846253632329 },
+		{ 0.004564574503018484, 0.9997717713431321, -1.966523980891093 },
+		{ 0.004658051856926721, 0.999767097665651, -1.965147567213342 },
+		{ 0.004753473873048267, 0.9997623274944337, -1.963714393978684 },
+		{ 0.004850783396417627, 0.9997574608308619, -1.962222745338831 },
+		{ 0.004950127543555387, 0.9997524944046622, -1.960669840193137 },
+		{ 0.005051533738969285, 0.9997474249456559, -1.959052782445166 },
+		{ 0.005155010420413288, 0.9997422524554108, -1.957369632476333 },
+		{ 0.005260500551086256, 0.9997369752997103, -1.955617866210401 },
+		{ 0.005368232564261549, 0.9997315885727911, -1.953793760873579 },
+		{ 0.005478154671404333, 0.9997260922764248, -1.951895134283953 },
+		{ 0.005590337183398139, 0.9997204831408416, -1.949918599895888 },
+		{ 0.005704819166378695, 0.9997147595321615, -1.947861231883392 },
+		{ 0.005821637535527618, 0.9997089181808105, -1.945719409185455 },
+		{ 0.005940852146247124, 0.9997029574530936, -1.943489988775779 },
+		{ 0.006062537784991876, 0.999696874079646, -1.941169102921928 },
+		{ 0.006186726174548784, 0.9996906664269669, -1.938753380058987 },
+		{ 0.006313342850369602, 0.999684332861642, -1.936239349159937 },
+		{ 0.006442635287458701, 0.9996778684789086, -1.933622100346261 },
+		{ 0.006574597997442857, 0.9996712716455958, -1.930897878292765 },
+		{ 0.006709185548001647, 0.9996645407286293, -1.928062819955183 },
+		{ 0.006709185548001647, 0.9996645407286293, -1.928062819955183 },
+		{ 0.006846612010893922, 0.9996576708236597, -1.925111533606456 },
+		{ 0.006986776960096272, 0.999650661933554, -1.922040574626683 },
+		{ 0.0071298651303098, 0.9996435075185837, -1.918843487510148 },
+		{ 0.007275862970656122, 0.9996362075818745, -1.915516536023548 },
+		{ 0.007424826173550679, 0.9996287588553379, -1.912054385823578 },
+		{ 0.007576876921754062, 0.9996211564354216, -1.90845073651327 },
+		{ 0.007732041871010226, 0.9996133986900193, -1.904700635155667 },
+		{ 0.007890366575724141, 0.9996054823515477, -1.900798184404369 },
+		{ 0.00805192003062641, 0.9995974041526001, -1.896737291082768 },
+		{ 0.008216788234047914, 0.9995891608259536, -1.892511662029424 },
+		{ 0.008385065116639131, 0.9995807474690147, -1.888113936752432 },
+		{ 0.008556779288372795, 0.9995721624505316, -1.88353823922877 },
+		{ 0.008731950189572084, 0.9995634025038648, -1.878777651116968 },
+		{ 0.008910745721307029, 0.9995544627270629, -1.873824123117997 },
+		{ 0.009093203748901327, 0.9995453398539481, -1.868670247653654 },
+		{ 0.009279405716611943, 0.9995360306185616, -1.863308391976691 },
+		{ 0.009469403911740089, 0.9995265301196969, -1.857729725081131 },
+		{ 0.009663298368027337, 0.9995168350918987, -1.851926097089404 },
+		{ 0.00986116508520128, 0.9995069422699503, -1.845889121072709 },
+		{ 0.01006308726619842, 0.999496846753458, -1.839609143044255 },
+		{ 0.01006308726619842, 0.999496846753458, -1.839609143044255 },
+		{ 0.01026912730215776, 0.9994865436423478, -1.833076187081724 },
+		{ 0.01047943317799835, 0.9994760296722638, -1.826281016593332 },
+		{ 0.01069397385461368, 0.9994653015791202, -1.819214143707239 },
+		{ 0.01091293070256479, 0.9994543544637542, -1.811864719100904 },
+		{ 0.01113636579503202, 0.9994431817920246, -1.804220424749846 },
+		{ 0.01136440143741029, 0.9994317803008662, -1.796270814837345 },
+		{ 0.01159706897153514, 0.9994201467275174, -1.788005181004683 },
+		{ 0.01183451989659012, 0.9994082745389747, -1.779410162183357 },
+		{ 0.01207682511828798, 0.9993961588379692, -1.770473172153229 },
+		{ 0.01232411592640197, 0.999383794727648, -1.761181267486672 },
+		{ 0.01257642225014832, 0.9993711789467993, -1.751522409121144 },
+		{ 0.01283395657603415, 0.9993583033289771, -1.741480430399184 },
+		{ 0.01309668003465342, 0.9993451662490536, -1.731043858480653 },
+		{ 0.01336483097213643, 0.9993317595415809, -1.720195710628353 },
+		{ 0.01363848012011921, 0.9993180766768931, -1.708919809671745 },
+		{ 0.0139176821650963, 0.9993041160312317, -1.69720367317106 },
+		{ 0.01420266071147224, 0.9992898678057385, -1.685027612480512 },
+		{ 0.01449341199138672, 0.9992753303776591, -1.672378459210379 },
+		{ 0.01479013899477488, 0.9992604939494052, -1.659235594607163 },
+		{ 0.01509293402375925, 0.999245353629266, -1.64558220810132 },
+		{ 0.01509293402375925, 0.999245353629266, -1.64558220810132 },
+		{ 0.01540194779752944, 0.9992299028911178, -1.631399637619937 },
+		{ 0.01571726808339871, 0.9992141368444853, -1.616670327125313 },
+		{ 0.0160390269846565, 0.9991980489645662, -1.601374834839373 },
+		{ 0.01636738690893004, 0.9991816310923773, -1.585491709694488 },
+		{ 0.01670246608033219, 0.9991648767046752, -1.569000611567485 },
+		{ 0.01704442420272452, 0.9991477792789902, -1.551880812153773 },
+		{ 0.01739333648116904, 0.9991303339284721, -1.534112891449735 },
+		{ 0.01774941881507502, 0.9991125292277969, -1.515670362055833 },
+		{ 0.01811276416532325, 0.999094361926659, -1.496534747061912 },
+		{ 0.01848355820919032, 0.9990758222364455, -1.476680435273849 },
+		{ 0.0188619441801177, 0.9990569036390875, -1.45608489805729 },
+		{ 0.0192480759208762, 0.999037596348094, -1.434721717186779 },
+		{ 0.0196420903580621, 0.999017895482097, -1.412569591086511 },
+		{ 0.02004417497866133, 0.9989977912567571, -1.389601521938975 },
+		{ 0.02045448956360937, 0.9989772755235777, -1.365792064894122 },
+		{ 0.02087319736373059, 0.9989563401352355, -1.341115582633782 },
+		{ 0.0213004660335411, 0.9989349769456155, -1.315546299312046 },
+		{ 0.02173648138288509, 0.9989131761753746, -1.289056359232439 },
+		{ 0.02218141910402806, 0.9988909296810254, -1.261619804944282 },
+		{ 0.02263545588131509, 0.998868227686003, -1.233208677379995 },
+		{ 0.02263545588131509, 0.998868227686003, -1.233208677379995 },
+		{ 0.02309879358963057, 0.9988450604152486, -1.203795036657672 },
+		{ 0.02357161723182031, 0.9988214197295715, -1.173353168444771 },
+		{ 0.02405409559810729, 0.9987972958569422, -1.141855528825048 },
+		{ 0.0245464212070837, 0.9987726790269709, -1.109274878672613 },
+		{ 0.02504885079357704, 0.9987475578367572, -1.075582190568702 },
+		{ 0.02556152063049024, 0.998721924153614, -1.040753333070723 },
+		{ 0.02608470269255029, 0.9986957649441381, -1.004758175024038 },
+		{ 0.02661859128127748, 0.9986690704452479, -0.9675717622216367 },
+		{ 0.02716338596388012, 0.998641830895762, -0.9291701186051172 },
+		{ 0.02771933470305218, 0.9986140332684914, -0.8895257269635016 },
+		{ 0.02828664611554221, 0.9985856678064897, -0.84861692812129 },
+		{ 0.02886557040500903, 0.9985567214871116, -0.8064188012915151 },
+		{ 0.02945635281031987, 0.9985271829240632, -0.7629103846165134 },
+		{ 0.03005915776200482, 0.9984970423672305, -0.7180750305850264 },
+		{ 0.03067432932926658, 0.9984662835338138, -0.6718884427837264 },
+		{ 0.03130206971658321, 0.9984348966788965, -0.6243383865311225 },
+		{ 0.03194265683958218, 0.9984028671590682, -0.5754078649265926 },
+		{ 0.03259633208664546, 0.9983701836011867, -0.5250877442260462 },
+		{ 0.03326337830023936, 0.998336831367828, -0.4733671030553411 },
+		{ 0.03394499884216939, 0.99830278929098, -0.4202282926291052 }
+	},
+	.c_bpre9600080040 = {
+		{ 0.0001963485770216042, 0.999990182571149, -1.999928498163521 },
+		{ 0.0002003718999775591, 0.9999899814784884, -1.999925744205681 },
+		{ 0.0002044751438318441, 0.999989776295295, -1.999922880878001 },
+		{ 0.0002086616229342155, 0.9999895669397594, -1.999919903783345 },
+		{ 0.0002129350369468899, 0.9999893532482612, -1.999916807174199 },
+		{ 0.0002172970973475156, 0.9999891352208039, -1.999913587492756 },
+		{ 0.0002217468681623336, 0.9999889126937666, -1.999910238623343 },
+		{ 0.0002262887051264483, 0.9999886855853416, -1.99990675545463 },
+		{ 0.0002309234060894654, 0.9999884538955319, -1.999903133991434 },
+		{ 0.0002356531775626317, 0.9999882173789061, -1.999899366211042 },
+		{ 0.0002404804851316068, 0.9999879761172797, -1.999895449070827 },
+		{ 0.0002454073995808566, 0.9999877297834103, -1.999891372708283 },
+		{ 0.0002504301506018409, 0.999987478540925, -1.999887135111861 },
+		{ 0.0002555588503019628, 0.9999872220625816, -1.999882725866735 },
+		{ 0.000260793790056811, 0.9999869603483845, -1.999878139816609 },
+		{ 0.000266133861588104, 0.9999866933165267, -1.999873370224702 },
+		{ 0.0002715854035968697, 0.99998642080339, -1.999868408631154 },
+		{ 0.0002771476530598012, 0.9999861426453562, -1.999863246234749 },
+		{ 0.0002828234009177243, 0.9999858588424305, -1.999857877006551 },
+		{ 0.0002886153872438342, 0.9999855692309952, -1.999852291609407 },
+		{ 0.0002945289201364434, 0.9999852736474332, -1.999846480336446 },
+		{ 0.0002945289201364434, 0.9999852736474332, -1.999846480336446 },
+		{ 0.0003005586810505465, 0.9999849720917499, -1.999840436409741 },
+		{ 0.0003067148566267677, 0.9999846643185171, -1.999834147851357 },
+		{ 0.0003129994376497395, 0.9999843501641191, -1.999827603872691 },
+		{ 0.0003194067670050442, 0.9999840297103723, -1.999820798530848 },
+		{ 0.0003259486232193235, 0.9999837026300392, -1.999813716921566 },
+		{ 0.0003326238942153871, 0.9999833688413154, -1.999806348899602 },
+		{ 0.0003394370285806678, 0.9999830281805856, -1.999798682149551 },
+		{ 0.0003463911156210493, 0.9999826805660464, -1.999790705787677 },
+		{ 0.000353482429157394, 0.9999823259158934, -1.99978240860051 },
+		{ 0.000360722150367471, 0.9999819639028914, -1.999773773126155 },
+		{ 0.0003681094783569038, 0.9999815945270482, -1.999764789130864 },
+		{ 0.0003756498856638185, 0.9999812175429396, -1.999755440027017 },
+		{ 0.0003833431733566429, 0.9999808328687633, -1.999745712713694 },
+		{ 0.0003911932562168911, 0.9999804403409071, -1.999735591573533 },
+		{ 0.0003992064616765801, 0.9999800397139479, -1.999725058254987 },
+		{ 0.0004073831747354111, 0.9999796309060852, -1.999714098085958 },
+		{ 0.0004157251124227649, 0.9999792137537075, -1.999702693709598 },
+		{ 0.0004242415662692832, 0.9999787880113932, -1.999690824852916 },
+		{ 0.0004329284229424808, 0.9999783535973432, -1.9996784751272 },
+		{ 0.000441794994536922, 0.9999779102661377, -1.999665622885281 },
+		{ 0.000441794994536922, 0.9999779102661377, -1.999665622885281 },
+		{ 0.0004508432272100616, 0.9999774578541669, -1.999652248065703 },
+		{ 0.0004600760680223721, 0.9999769961978227, -1.999638329915466 },
+		{ 0.0004694990456054312, 0.999976525051686, -1.999623844430928 },
+		{ 0.000479115687948469, 0.9999760442521505, -1.999608769267188 },
+		{ 0.0004889274983919302, 0.9999755536356092, -1.999593081323152 },
+		{ 0.0004989411420585448, 0.9999750529566455, -1.999576754027119 },
+		{ 0.0005091590569537727, 0.999974542051654, -1.999559762543772 },
+		{ 0.0005195872626680509, 0.9999740206752202, -1.999542078410879 },
+		{ 0.0005302284206331136, 0.99997348858193, -1.999523672097115 },
+		{ 0.0005410878542815813, 0.99997294560818, -1.999504515883537 },
+		{ 0.0005521698502103167, 0.999972391508558, -1.999484578174234 },
+		{ 0.0005634805098941936, 0.9999718260376523, -1.999463826209385 },
+		{ 0.0005750198882443766, 0.9999712490318627, -1.999442229122306 },
+		{ 0.0005867956704333064, 0.9999706602457792, -1.999419751903713 },
+		{ 0.0005988136337097341, 0.9999700593521829, -1.999396355063016 },
+		{ 0.0006110781020893084, 0.9999694461056665, -1.999372000832156 },
+		{ 0.0006235934189799882, 0.9999688203426333, -1.99934665344193 },
+		{ 0.0006363645477585225, 0.9999681818176774, -1.999320272590305 },
+		{ 0.0006493976102842602, 0.9999675301217754, -1.999292809593508 },
+		{ 0.0006626992435767691, 0.9999668650913335, -1.999264224405783 },
+		{ 0.0006626992435767691, 0.9999668650913335, -1.999264224405783 },
+		{ 0.0006762709495854443, 0.9999661864809495, -1.999234472126232 },
+		{ 0.0006901212515907141, 0.9999654939634134, -1.999203502608448 },
+		{ 0.0007042541503107278, 0.9999647872933259, -1.999171267585282 },
+		{ 0.0007186777585790297, 0.9999640661434795, -1.999137713299029 },
+		{ 0.0007333964774006558, 0.9999633301866679, -1.999102783992899 },
+		{ 0.0007484168754867645, 0.9999625791774966, -1.999066425849755 },
+		{ 0.0007637449926996461, 0.9999618127887626, -1.99902857917052 },
+		{ 0.0007793868028376066, 0.9999610306932646, -1.998989182079405 },
+		{ 0.00079534883804367, 0.9999602325638035, -1.99894817045905 },
+		{ 0.0008116388161164422, 0.9999594180731812, -1.998905477884303 },
+		{ 0.0008282606829042779, 0.9999585869760116, -1.998861039972388 },
+		{ 0.0008452245742295375, 0.9999577387814828, -1.998814776731807 },
+		{ 0.0008625355572401631, 0.9999568732442116, -1.998766618733997 },
+		{ 0.0008801994899939198, 0.9999559900370087, -1.998716489633487 },
+		{ 0.000898226630963799, 0.9999550886690686, -1.998664300858009 },
+		{ 0.0009166224260052916, 0.9999541688950153, -1.998609974972191 },
+		{ 0.0009353955415512917, 0.9999532302240484, -1.998553417166016 },
+		{ 0.0009545541870073093, 0.9999522723289874, -1.998494539086546 },
+		{ 0.0009741023534295707, 0.9999512948826542, -1.998433249379531 },
+		{ 0.0009940521430121111, 0.999950297394257, -1.998369443038316 },
+		{ 0.0009940521430121111, 0.999950297394257, -1.998369443038316 },
+		{ 0.001014410912146213, 0.9999492794548149, -1.998303016432044 },
+		{ 0.001035187297424583, 0.99994824065535, -1.99823386222199 },
+		{ 0.001056387174448573, 0.9999471806686953, -1.998161874865454 },
+		{ 0.001078023811054961, 0.9999460988404549, -1.998086922449645 },
+		{ 0.001100102190517257, 0.9999449949252762, -1.998008896853313 },
+		{ 0.001122631408084555, 0.9999438684323865, -1.997927668846317 },
+		{ 0.001145622739356151, 0.9999427188710159, -1.997843104451553 },
+		{ 0.001169085466343303, 0.9999415457503993, -1.997755064802675 },
+		{ 0.001193028618553673, 0.9999403485797744, -1.997663405998811 },
+		{ 0.001217462688763546, 0.9999391268683839, -1.997567978956287 },
+		{ 0.001242396097557312, 0.9999378802072818, -1.997468635841583 },
+		{ 0.001267841216524277, 0.9999366079421043, -1.997365203713336 },
+		{ 0.001293806739401154, 0.9999353096639143, -1.997257523473891 },
+		{ 0.001320303997453647, 0.9999339848001642, -1.997145416774552 },
+		{ 0.00134734452997154, 0.9999326327783122, -1.997028698732376 },
+		{ 0.001374937862383299, 0.999931253107629, -1.996907185012541 },
+		{ 0.001403097459068508, 0.9999298451337761, -1.996780670092237 },
+		{ 0.001431832687026583, 0.9999284083660342, -1.996648955884218 },
+		{ 0.001461157065654169, 0.999926942150077, -1.996511822120958 },
+		{ 0.001491081828839285, 0.9999254459133904, -1.996369048263902 },
+		{ 0.001491081828839285, 0.9999254459133904, -1.996369048263902 },
+		{ 0.001521618612683952, 0.9999239190834668, -1.996220406011346 },
+		{ 0.001552781587341179, 0.9999223609241926, -1.996065642666059 },
+		{ 0.001584582760730975, 0.9999207708630732, -1.995904512742549 },
+		{ 0.001617035108610752, 0.9999191482458158, -1.99573675374078 },
+		{ 0.001650151897874045, 0.9999174924181343, -1.995562093764812 },
+		{ 0.001683983690982902, 0.9999158023167228, -1.995380206791496 },
+		{ 0.001718492402849802, 0.9999140778599506, -1.995190862118915 },
+		{ 0.001753673576262839, 0.9999123182299433, -1.994993740553757 },
+		{ 0.001789568637666189, 0.9999105226088372, -1.994788510935765 },
+		{ 0.001826209064144515, 0.9999086901787773, -1.994574829771868 },
+		{ 0.001863615317521377, 0.9999068201219198, -1.994352340862306 },
+		{ 0.001901788746344374, 0.9999049124384757, -1.994120775214283 },
+		{ 0.001940706509471819, 0.9999029646745285, -1.993879551503492 },
+		{ 0.001980462643738141, 0.9999009776483556, -1.993628475793971 },
+		{ 0.002021026821068445, 0.9998989497241095, -1.993367036992663 },
+		{ 0.002062403811038227, 0.9998968800840008, -1.993094809610142 },
+		{ 0.002104646939584971, 0.9998947679102512, -1.992811353043846 },
+		{ 0.002147754054246364, 0.9998926132031303, -1.992516324281504 },
+		{ 0.002191735531631751, 0.9998904135088131, -1.992209027229922 },
+		{ 0.002236625129714433, 0.9998881696456278, -1.991889201994786 },
+		{ 0.002236625129714433, 0.9998881696456278, -1.991889201994786 },
+		{ 0.002282417487209071, 0.999885879159783, -1.991556110010191 },
+		{ 0.002329161553150636, 0.9998835420515987, -1.991209343950037 },
+		{ 0.002376878174567234, 0.9998811566853499, -1.990848238183082 },
+		{ 0.002425538779167951, 0.9998787230613828, -1.990472353889809 },
+		{ 0.002475216938765361, 0.999876239544006, -1.990080983133808 },
+		{ 0.002525926376048747, 0.9998737044975512, -1.989673388172683 },
+		{ 0.002577671318019858, 0.9998711179224105, -1.989249071508427 },
+		{ 0.002630423253495733, 0.9998684790009683, -1.988807387456903 },
+		{ 0.002684296418177116, 0.9998657852796, -1.988347387062854 },
+		{ 0.002739264925004285, 0.9998630367587479, -1.987868508736378 },
+		{ 0.002795363943185863, 0.9998602318028463, -1.987369885991241 },
+		{ 0.002852613017864772, 0.9998573695943644, -1.986850767253516 },
+		{ 0.002911030620211539, 0.9998544484977852, -1.986310224125882 },
+		{ 0.00297064669162494, 0.9998514676956239, -1.985747447304694 },
+		{ 0.003031498641358918, 0.9998484255524165, -1.985161442896516 },
+		{ 0.00309360234454862, 0.9998453212507258, -1.984551340460858 },
+		{ 0.003156920578874497, 0.9998421539731369, -1.983916242562034 },
+		{ 0.003221577107512813, 0.9998389212662749, -1.983254886117099 },
+		{ 0.003287569200235229, 0.9998356223127858, -1.982566297348708 },
+		{ 0.00335487415350553, 0.9998322562953396, -1.981849472853484 },
+		{ 0.00335487415350553, 0.9998322562953396, -1.981849472853484 },
+		{ 0.003423599029982303, 0.999828820760664, -1.981103019954786 },
+		{ 0.003493693626753038, 0.9998253157094762, -1.980326035439061 },
+		{ 0.003565250339709658, 0.9998217378705986, -1.979516851126395 },
+		{ 0.003638262408489861, 0.999818087244812, -1.97867448338761 },
+		{ 0.003712757700869529, 0.999814362196972, -1.977797540440416 },
+		{ 0.003788797335250032, 0.9998105602740057, -1.976884381515368 },
+		{ 0.003866394659932316, 0.9998066806588259, -1.975933702673314 },
+		{ 0.003945572475753324, 0.9998027217164132, -1.974943955862735 },
+		{ 0.004026365305595682, 0.9997986818117934, -1.973913538063093 },
+		{ 0.004108816176029794, 0.9997945593100385, -1.972840789769813 },
+		{ 0.004192972082933647, 0.9997903517583148, -1.971723774136257 },
+		{ 0.004278847356033234, 0.999786058339749, -1.970560924517758 },
+		{ 0.004366451742288326, 0.9997816774195576, -1.969350402390515 },
+		{ 0.004455869229903977, 0.9997772065450697, -1.96809007359132 },
+		{ 0.00454711878163582, 0.9997726440816173, -1.966777958364523 },
+		{ 0.004640241153205008, 0.9997679883945882, -1.965412010393637 },
+		{ 0.004735262523288488, 0.9997632370314966, -1.963989867879101 },
+		{ 0.004832232945883836, 0.9997583883578566, -1.962509331432485 },
+		{ 0.0049311904579377, 0.9997534407392406, -1.960968129492788 },
+		{ 0.005032176701755309, 0.9997483917233665, -1.959363654103577 },
+		{ 0.005032176701755309, 0.9997483917233665, -1.959363654103577 },
+		{ 0.005135222913928389, 0.9997432388580316, -1.957693200565706 },
+		{ 0.005240403132878403, 0.9997379805090251, -1.955954237855477 },
+		{ 0.00534770187482622, 0.9997326150422022, -1.954144154614564 },
+		{ 0.00545720987840799, 0.9997271400055888, -1.952259973109287 },
+		{ 0.005568958229794463, 0.9997215521294041, -1.95029831892297 },
+		{ 0.005683008132713357, 0.9997158497797591, -1.94825627639151 },
+		{ 0.005799375304359897, 0.999710031322842, -1.946130840435897 },
+		{ 0.005918135555714374, 0.9997040934891557, -1.943918299203669 },
+		{ 0.006039324394980605, 0.9996980338271999, -1.941615112484381 },
+		{ 0.006163007528941001, 0.9996918498855774, -1.939217618761316 },
+		{ 0.006289199975889689, 0.9996855400308637, -1.936722358860956 },
+		{ 0.006418008056845191, 0.99967910017614, -1.934124772963851 },
+		{ 0.006549412386982013, 0.9996725295060644, -1.931421477743302 },
+		{ 0.006683532224318155, 0.999665823933969, -1.928607623725462 },
+		{ 0.006820403006319753, 0.9996589801911916, -1.925678524183088 },
+		{ 0.006960052140447594, 0.999651997462733, -1.922630405784291 },
+		{ 0.007102591524399525, 0.9996448708445106, -1.919457570273809 },
+		{ 0.00724801933852896, 0.9996375995217763, -1.916155961551933 },
+		{ 0.007396437177793124, 0.9996301785907653, -1.912719520321541 },
+		{ 0.007547891277817122, 0.999622605601367, -1.909143114567774 },
+		{ 0.007547891277817122, 0.999622605601367, -1.909143114567774 },
+		{ 0.007702457094359808, 0.9996148772858062, -1.905421057361298 },
+		{ 0.007860178601406293, 0.999606991194282, -1.901547875887236 },
+		{ 0.008021121951629243, 0.9995989440593495, -1.897517520067094 },
+		{ 0.008185368459988783, 0.9995907317959574, -1.893323319091786 },
+		{ 0.008352977345908919, 0.9995823511370513, -1.88895879589997 },
+		{ 0.008524028576898353, 0.9995737988157705, -1.88441726539139 },
+		{ 0.008698559862537375, 0.99956507238322, -1.879692277532843 },
+		{ 0.008876679293048424, 0.9995561661196417, -1.87477537804235 },
+		{ 0.009058433462772643, 0.9995470783943391, -1.869660110724906 },
+		{ 0.009243915353525447, 0.9995378043057931, -1.864337971451926 },
+		{ 0.009433196718067671, 0.9995283405882436, -1.858801121542007 },
+		{ 0.009626354627670584, 0.9995186823407025, -1.853040505376842 },
+		{ 0.009823457687054752, 0.9995088271156474, -1.847048261607008 },
+		{ 0.0100245998043521, 0.9994987700126283, -1.840814792492255 },
+		{ 0.01022986103322223, 0.9994885069492183, -1.83433070089014 },
+		{ 0.01043932316855263, 0.9994780338432835, -1.827586303064954 },
+		{ 0.01065307021374007, 0.9994673466129923, -1.820571624802648 },
+		{ 0.01087119526294563, 0.9994564403591457, -1.813275845648514 },
+		{ 0.0110937863526344, 0.9994453110005697, -1.805688368375811 },
+		{ 0.01132093202684736, 0.9994339536387602, -1.797797721108548 },
+		{ 0.01132093202684736, 0.9994339536387602, -1.797797721108548 },
+		{ 0.01155273343578635, 0.9994223633755894, -1.789592084740844 },
+		{ 0.01178928329418268, 0.9994105361309593, -1.781059884578526 },
+		{ 0.01203066622037807, 0.9993984670075006, -1.772188630029592 },
+		{ 0.01227697870843498, 0.9993861511082542, -1.762965474628943 },
+		{ 0.01252834938406426, 0.9993735827190736, -1.753376584372483 },
+		{ 0.01278484662223696, 0.9993607577614871, -1.743409001502562 },
+		{ 0.01304660669467555, 0.9993476697046619, -1.73304749509096 },
+		{ 0.01331372702378231, 0.9993343136534681, -1.722277708104648 },
+		{ 0.01358630767518142, 0.9993206847132516, -1.711084922351201 },
+		{ 0.01386447294176123, 0.9993067763547346, -1.699452680427131 },
+		{ 0.0141483274366055, 0.9992925836843232, -1.687365472997397 },
+		{ 0.01443799659611836, 0.9992781001738765, -1.674806005801567 },
+		{ 0.01473360337979033, 0.999263320113404, -1.661757260434955 },
+		{ 0.01503523033381786, 0.9992482386110222, -1.648202563051414 },
+		{ 0.01534304989413268, 0.9992328475054318, -1.634121884415178 },
+		{ 0.01565716352689529, 0.9992171419060505, -1.619497724926693 },
+		{ 0.01597771060069013, 0.9992011144704893, -1.604309920524775 },
+		{ 0.01630481221502586, 0.9991847594920502, -1.588539426077247 },
+		{ 0.01663861023270363, 0.9991680696298435, -1.572165228719799 },
+		{ 0.01697970701649509, 0.9991510342740881, -1.555162578563851 }
+	}
+};